@@ -0,0 +1,130 @@
+#include "bench_util.h"
+#include "crypto-suites/crypto-hash/sha256.h"
+
+using safeheron::mpc_flow::common::Stage;
+using safeheron::mpc_flow::common::Primitive;
+using safeheron::mpc_flow::common::StageMetrics;
+using safeheron::mpc_flow::common::STAGE_NUM;
+using safeheron::mpc_flow::common::PRIMITIVE_NUM;
+using safeheron::mpc_flow::common::StageName;
+using safeheron::mpc_flow::common::PrimitiveName;
+
+namespace safeheron {
+namespace bench {
+
+safeheron::curve::CurveType CurveByIndex(int64_t index) {
+    switch (index) {
+        case 0:
+            return safeheron::curve::CurveType::SECP256K1;
+        case 1:
+            return safeheron::curve::CurveType::P256;
+        case 2:
+            return safeheron::curve::CurveType::STARK;
+        default:
+            return safeheron::curve::CurveType::INVALID_CURVE;
+    }
+}
+
+const char *CurveName(int64_t index) {
+    switch (index) {
+        case 0:
+            return "secp256k1";
+        case 1:
+            return "p256";
+        case 2:
+            return "stark";
+        default:
+            return "invalid";
+    }
+}
+
+std::vector<int64_t> CurveArgs() {
+#ifdef TEST_STARK_CURVE
+    return {0, 1, 2};
+#else
+    return {0, 1};
+#endif
+}
+
+std::vector<std::string> MakePartyIds(size_t n_parties) {
+    std::vector<std::string> party_id_arr;
+    for (size_t i = 0; i < n_parties; ++i) {
+        party_id_arr.push_back("co_signer" + std::to_string(i + 1));
+    }
+    return party_id_arr;
+}
+
+std::vector<safeheron::bignum::BN> MakePartyIndexes(size_t n_parties) {
+    std::vector<safeheron::bignum::BN> party_index_arr;
+    for (size_t i = 0; i < n_parties; ++i) {
+        party_index_arr.emplace_back((long)(i + 1));
+    }
+    return party_index_arr;
+}
+
+void PartyArgs(benchmark::internal::Benchmark *b) {
+    const int64_t n_t_arr[][2] = {{2, 2}, {3, 2}, {3, 3}, {5, 3}};
+    b->ArgNames({"n", "t", "curve", "parallel"});
+    for (const auto &n_t: n_t_arr) {
+        for (int64_t curve: CurveArgs()) {
+            // parties one after another, or each in its own thread
+            b->Args({n_t[0], n_t[1], curve, 0});
+            b->Args({n_t[0], n_t[1], curve, 1});
+        }
+    }
+}
+
+safeheron::bignum::BN MakeDigest(uint32_t seed) {
+    std::string str = "multi-party-sig benchmark " + std::to_string(seed);
+    safeheron::hash::CSHA256 sha256;
+    uint8_t digest[safeheron::hash::CSHA256::OUTPUT_SIZE];
+    sha256.Write(reinterpret_cast<const unsigned char *>(str.c_str()), str.size());
+    sha256.Finalize(digest);
+    return safeheron::bignum::BN::FromBytesBE(digest, safeheron::hash::CSHA256::OUTPUT_SIZE);
+}
+
+void StageRecorder::OnStage(const StageMetrics &metrics) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    Entry &entry = map_round_entry_[metrics.round_index_];
+    entry.elapsed_ns_[static_cast<size_t>(metrics.stage_)] += metrics.elapsed_ns_;
+    for (size_t k = 0; k < PRIMITIVE_NUM; ++k) {
+        entry.primitive_count_[k] += metrics.primitive_count_[k];
+    }
+}
+
+void StageRecorder::Report(benchmark::State &state, size_t n_parties) const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (n_parties == 0) return;
+    const double scale = 1.0 / (double)n_parties;
+
+    uint64_t stage_ns[STAGE_NUM] = {0};
+    uint64_t primitive_count[PRIMITIVE_NUM] = {0};
+    for (const auto &item: map_round_entry_) {
+        const Entry &entry = item.second;
+        for (size_t s = 0; s < STAGE_NUM; ++s) stage_ns[s] += entry.elapsed_ns_[s];
+        for (size_t k = 0; k < PRIMITIVE_NUM; ++k) primitive_count[k] += entry.primitive_count_[k];
+
+        std::string name = "r" + std::to_string(item.first) + "." + StageName(Stage::ComputeVerify) + "_us";
+        state.counters[name] = benchmark::Counter(
+                (double)entry.elapsed_ns_[static_cast<size_t>(Stage::ComputeVerify)] * scale / 1000.0,
+                benchmark::Counter::kAvgIterations);
+    }
+    for (size_t s = 0; s < STAGE_NUM; ++s) {
+        std::string name = std::string(StageName(static_cast<Stage>(s))) + "_us";
+        state.counters[name] = benchmark::Counter((double)stage_ns[s] * scale / 1000.0,
+                                                  benchmark::Counter::kAvgIterations);
+    }
+    for (size_t k = 0; k < PRIMITIVE_NUM; ++k) {
+        if (primitive_count[k] == 0) continue;
+        state.counters[PrimitiveName(static_cast<Primitive>(k))] = benchmark::Counter(
+                (double)primitive_count[k] * scale, benchmark::Counter::kAvgIterations);
+    }
+}
+
+void StageRecorder::Reset() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    map_round_entry_.clear();
+}
+
+}
+}
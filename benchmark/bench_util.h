@@ -0,0 +1,101 @@
+#ifndef MULTI_PARTY_SIG_BENCHMARK_BENCH_UTIL_H
+#define MULTI_PARTY_SIG_BENCHMARK_BENCH_UTIL_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_simulator.h"
+
+namespace safeheron {
+namespace bench {
+
+/**
+ * Curves are passed to the benchmarks by index, so that the name of a benchmark says which curve it runs on.
+ * 0: SECP256K1, 1: P256, 2: STARK
+ */
+safeheron::curve::CurveType CurveByIndex(int64_t index);
+
+const char *CurveName(int64_t index);
+
+// Arguments of the curves to run, STARK is run if TEST_STARK_CURVE is on.
+std::vector<int64_t> CurveArgs();
+
+// "co_signer1", "co_signer2", ...
+std::vector<std::string> MakePartyIds(size_t n_parties);
+
+// 1, 2, ...
+std::vector<safeheron::bignum::BN> MakePartyIndexes(size_t n_parties);
+
+/**
+ * Arguments {n, t, curve, parallel} of the multi-party protocols: the number of parties, the threshold, the curve
+ * and how the parties are run (see RunProtocol).
+ */
+void PartyArgs(benchmark::internal::Benchmark *b);
+
+// A 256 bits digest for the benchmarks of signing.
+safeheron::bignum::BN MakeDigest(uint32_t seed = 0);
+
+/**
+ * Run the contexts of all parties to the end with MPCSimulator, on a network with no delay.
+ * @param ctx_arr contexts of all parties, created and not started yet.
+ * @param party_id_arr party_id_arr[i] is the id of the party of ctx_arr[i].
+ * @param parallel false: the parties are run one after another in the calling thread. true: every party is run in its
+ *      own thread.
+ * @param sink sink of the metrics of all contexts, nullptr for none.
+ * @param tap if set, called for every message sent.
+ * @return true if all contexts finished with no error.
+ */
+template<class Context>
+bool RunProtocol(std::vector<std::unique_ptr<Context>> &ctx_arr, const std::vector<std::string> &party_id_arr,
+                 bool parallel, safeheron::mpc_flow::common::MetricsSink *sink,
+                 const safeheron::mpc_flow::mpc_parallel_v2::MPCSimulator::MessageTap &tap = nullptr) {
+    if (ctx_arr.empty() || party_id_arr.size() != ctx_arr.size()) return false;
+    safeheron::mpc_flow::mpc_parallel_v2::SimulatorConfig config;
+    config.multi_threaded_ = parallel;
+    safeheron::mpc_flow::mpc_parallel_v2::MPCSimulator simulator(config);
+    for (size_t i = 0; i < ctx_arr.size(); ++i) {
+        ctx_arr[i]->set_metrics_sink(sink);
+        simulator.AddParty(party_id_arr[i], ctx_arr[i].get());
+    }
+    if (tap) simulator.set_message_tap(tap);
+    return simulator.Run();
+}
+
+/**
+ * Sink keeping the time spent in each stage of each round, to be reported as counters of a benchmark.
+ * It may be shared by the contexts of all parties, which run on several threads.
+ */
+class StageRecorder : public safeheron::mpc_flow::common::MetricsSink {
+public:
+    void OnStage(const safeheron::mpc_flow::common::StageMetrics &metrics) override;
+
+    /**
+     * Add the counters to the state, averaged over the iterations and the parties:
+     *  - "<stage>_us", time spent in the stage in all rounds
+     *  - "r<round>.ComputeVerify_us", time spent in ComputeVerify of each round
+     *  - "<primitive>", number of primitives counted in all rounds
+     */
+    void Report(benchmark::State &state, size_t n_parties) const;
+
+    void Reset();
+
+private:
+    struct Entry {
+        uint64_t elapsed_ns_[safeheron::mpc_flow::common::STAGE_NUM];
+        uint64_t primitive_count_[safeheron::mpc_flow::common::PRIMITIVE_NUM];
+    };
+    mutable std::mutex mutex_;
+    std::map<int, Entry> map_round_entry_;
+};
+
+}
+}
+
+#endif //MULTI_PARTY_SIG_BENCHMARK_BENCH_UTIL_H
@@ -0,0 +1,387 @@
+#include <memory>
+#include <tuple>
+#include "benchmark/benchmark.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/cmp.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/key_gen/context.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
+#include "bench_util.h"
+
+using safeheron::bignum::BN;
+using safeheron::curve::CurveType;
+using safeheron::multi_party_ecdsa::cmp::SignKey;
+using safeheron::multi_party_ecdsa::cmp::MinimalSignKey;
+using safeheron::bench::CurveByIndex;
+using safeheron::bench::CurveName;
+using safeheron::bench::MakePartyIds;
+using safeheron::bench::MakePartyIndexes;
+using safeheron::bench::MakeDigest;
+using safeheron::bench::PartyArgs;
+using safeheron::bench::RunProtocol;
+using safeheron::bench::StageRecorder;
+
+namespace minimal_key_gen = safeheron::multi_party_ecdsa::cmp::minimal_key_gen;
+namespace aux_info_key_refresh = safeheron::multi_party_ecdsa::cmp::aux_info_key_refresh;
+namespace key_gen = safeheron::multi_party_ecdsa::cmp::key_gen;
+namespace sign = safeheron::multi_party_ecdsa::cmp::sign;
+
+namespace {
+
+// A message of a signing session
+struct SignMessage {
+    std::string p2p_msg_;
+    std::string bc_msg_;
+};
+
+// Messages sent in each round, indexed by the round index of the messages.
+typedef std::vector<std::vector<SignMessage>> SignTranscript;
+
+struct CmpKeys {
+    std::vector<std::string> sign_key_base64_arr_;
+    std::vector<std::string> minimal_sign_key_base64_arr_;
+};
+
+// Create the key generation contexts of all parties.
+bool CreateKeyGenContexts(std::vector<std::unique_ptr<key_gen::Context>> &ctx_arr, CurveType curve_type,
+                          size_t n_parties, size_t threshold) {
+    const std::vector<std::string> party_id_arr = MakePartyIds(n_parties);
+    const std::vector<BN> party_index_arr = MakePartyIndexes(n_parties);
+    ctx_arr.clear();
+    for (size_t i = 0; i < n_parties; ++i) {
+        std::vector<std::string> remote_party_id_arr;
+        std::vector<BN> remote_party_index_arr;
+        for (size_t j = 0; j < n_parties; ++j) {
+            if (j == i) continue;
+            remote_party_id_arr.push_back(party_id_arr[j]);
+            remote_party_index_arr.push_back(party_index_arr[j]);
+        }
+        ctx_arr.emplace_back(new key_gen::Context((int)n_parties));
+        if (!key_gen::Context::CreateContext(*ctx_arr.back(), curve_type, (uint32_t)threshold, (uint32_t)n_parties,
+                                             party_index_arr[i], party_id_arr[i],
+                                             remote_party_index_arr, remote_party_id_arr, "sid")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Keys of the signing benchmarks, generated once for each (curve, n, t) by running the key generation protocol.
+ * Generating Paillier keys takes a while, so the first benchmark of a configuration is slow to start.
+ */
+const CmpKeys *GetCmpKeys(int64_t curve, size_t n_parties, size_t threshold) {
+    static std::mutex mutex;
+    static std::map<std::tuple<int64_t, size_t, size_t>, CmpKeys> cache;
+    std::lock_guard<std::mutex> lk(mutex);
+    auto key = std::make_tuple(curve, n_parties, threshold);
+    auto iter = cache.find(key);
+    if (iter != cache.end()) return &iter->second;
+
+    std::vector<std::unique_ptr<key_gen::Context>> ctx_arr;
+    if (!CreateKeyGenContexts(ctx_arr, CurveByIndex(curve), n_parties, threshold)) return nullptr;
+    if (!RunProtocol(ctx_arr, MakePartyIds(n_parties), 0, nullptr)) return nullptr;
+
+    CmpKeys keys;
+    for (auto &ctx: ctx_arr) {
+        std::string b64;
+        if (!ctx->sign_key_.ToBase64(b64)) return nullptr;
+        keys.sign_key_base64_arr_.push_back(b64);
+        if (!ctx->minimal_key_gen_ctx_.minimal_sign_key_.ToBase64(b64)) return nullptr;
+        keys.minimal_sign_key_base64_arr_.push_back(b64);
+    }
+    return &(cache[key] = keys);
+}
+
+// Sign keys of the first t parties, trimmed to sign without the others.
+bool GetSignerKeys(const CmpKeys &keys, size_t threshold, std::vector<std::string> &sign_key_base64_arr) {
+    const std::vector<std::string> signer_id_arr = MakePartyIds(threshold);
+    sign_key_base64_arr.clear();
+    for (size_t i = 0; i < threshold; ++i) {
+        std::string b64;
+        if (keys.sign_key_base64_arr_.size() == threshold) {
+            b64 = keys.sign_key_base64_arr_[i];
+        } else if (!safeheron::multi_party_ecdsa::cmp::trim_sign_key(b64, keys.sign_key_base64_arr_[i],
+                                                                       signer_id_arr)) {
+            return false;
+        }
+        sign_key_base64_arr.push_back(b64);
+    }
+    return true;
+}
+
+bool CreateSignContexts(std::vector<std::unique_ptr<sign::Context>> &ctx_arr,
+                        const std::vector<std::string> &sign_key_base64_arr, const BN &m, const std::string &ssid) {
+    ctx_arr.clear();
+    for (const auto &b64: sign_key_base64_arr) {
+        ctx_arr.emplace_back(new sign::Context((int)sign_key_base64_arr.size()));
+        if (!sign::Context::CreateContext(*ctx_arr.back(), b64, m, ssid)) return false;
+    }
+    return true;
+}
+
+// Messages of one signing session, input of the message (de)serialization benchmarks.
+const SignTranscript *GetCmpSignTranscript() {
+    static std::mutex mutex;
+    static std::unique_ptr<SignTranscript> transcript;
+    std::lock_guard<std::mutex> lk(mutex);
+    if (transcript) return transcript.get();
+
+    const CmpKeys *keys = GetCmpKeys(0, 3, 3);
+    if (!keys) return nullptr;
+    std::vector<std::unique_ptr<sign::Context>> ctx_arr;
+    if (!CreateSignContexts(ctx_arr, keys->sign_key_base64_arr_, MakeDigest(), "ssid")) return nullptr;
+    std::unique_ptr<SignTranscript> tmp(new SignTranscript());
+    auto tap = [&tmp](const std::string &src, const std::string &dst, int round,
+                      const std::string &p2p_msg, const std::string &bc_msg) {
+        if (tmp->size() <= (size_t)round) tmp->resize(round + 1);
+        (*tmp)[round].push_back({p2p_msg, bc_msg});
+    };
+    if (!RunProtocol(ctx_arr, MakePartyIds(3), 1, nullptr, tap)) return nullptr;
+    transcript = std::move(tmp);
+    return transcript.get();
+}
+
+}
+
+static void BM_CmpMinimalKeyGen(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const CurveType curve_type = CurveByIndex(state.range(2));
+    const bool parallel = state.range(3) != 0;
+    const std::vector<std::string> party_id_arr = MakePartyIds(n_parties);
+    const std::vector<BN> party_index_arr = MakePartyIndexes(n_parties);
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<minimal_key_gen::Context>> ctx_arr;
+        bool ok = true;
+        for (size_t i = 0; ok && i < n_parties; ++i) {
+            std::vector<std::string> remote_party_id_arr;
+            std::vector<BN> remote_party_index_arr;
+            for (size_t j = 0; j < n_parties; ++j) {
+                if (j == i) continue;
+                remote_party_id_arr.push_back(party_id_arr[j]);
+                remote_party_index_arr.push_back(party_index_arr[j]);
+            }
+            ctx_arr.emplace_back(new minimal_key_gen::Context((int)n_parties));
+            ok = minimal_key_gen::Context::CreateContext(*ctx_arr.back(), curve_type, (uint32_t)threshold,
+                                                         (uint32_t)n_parties, party_index_arr[i], party_id_arr[i],
+                                                         remote_party_index_arr, remote_party_id_arr, "sid");
+        }
+        if (!ok) {
+            state.SkipWithError("failed to create the cmp minimal key generation contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, party_id_arr, parallel, &recorder)) {
+            state.SkipWithError("cmp minimal key generation failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, n_parties);
+}
+BENCHMARK(BM_CmpMinimalKeyGen)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_CmpAuxInfoKeyRefresh(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const bool parallel = state.range(3) != 0;
+    const CmpKeys *keys = GetCmpKeys(state.range(2), n_parties, threshold);
+    if (!keys) {
+        state.SkipWithError("cmp key generation failed");
+        return;
+    }
+    std::vector<MinimalSignKey> minimal_sign_key_arr(n_parties);
+    for (size_t i = 0; i < n_parties; ++i) {
+        if (!minimal_sign_key_arr[i].FromBase64(keys->minimal_sign_key_base64_arr_[i])) {
+            state.SkipWithError("failed to decode the cmp minimal sign keys");
+            return;
+        }
+    }
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<aux_info_key_refresh::Context>> ctx_arr;
+        bool ok = true;
+        for (size_t i = 0; ok && i < n_parties; ++i) {
+            ctx_arr.emplace_back(new aux_info_key_refresh::Context((int)n_parties));
+            ok = aux_info_key_refresh::Context::CreateContext(*ctx_arr.back(), minimal_sign_key_arr[i], "ssid");
+        }
+        if (!ok) {
+            state.SkipWithError("failed to create the cmp aux info and key refresh contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, MakePartyIds(n_parties), parallel, &recorder)) {
+            state.SkipWithError("cmp aux info and key refresh failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, n_parties);
+}
+BENCHMARK(BM_CmpAuxInfoKeyRefresh)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_CmpKeyGen(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const CurveType curve_type = CurveByIndex(state.range(2));
+    const bool parallel = state.range(3) != 0;
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<key_gen::Context>> ctx_arr;
+        if (!CreateKeyGenContexts(ctx_arr, curve_type, n_parties, threshold)) {
+            state.SkipWithError("failed to create the cmp key generation contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, MakePartyIds(n_parties), parallel, &recorder)) {
+            state.SkipWithError("cmp key generation failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, n_parties);
+}
+BENCHMARK(BM_CmpKeyGen)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_CmpSign(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const bool parallel = state.range(3) != 0;
+    const CmpKeys *keys = GetCmpKeys(state.range(2), n_parties, threshold);
+    std::vector<std::string> sign_key_base64_arr;
+    if (!keys || !GetSignerKeys(*keys, threshold, sign_key_base64_arr)) {
+        state.SkipWithError("cmp key generation failed");
+        return;
+    }
+    const BN m = MakeDigest();
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<sign::Context>> ctx_arr;
+        if (!CreateSignContexts(ctx_arr, sign_key_base64_arr, m, "ssid")) {
+            state.SkipWithError("failed to create the cmp sign contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, MakePartyIds(threshold), parallel, &recorder)) {
+            state.SkipWithError("cmp sign failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, threshold);
+}
+BENCHMARK(BM_CmpSign)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Concurrent signing sessions, one per benchmark thread.
+static void BM_CmpSignConcurrent(benchmark::State &state) {
+    const size_t n_parties = 3;
+    const CmpKeys *keys = GetCmpKeys(0, n_parties, n_parties);
+    if (!keys) {
+        state.SkipWithError("cmp key generation failed");
+        return;
+    }
+    const BN m = MakeDigest((uint32_t)state.thread_index());
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<sign::Context>> ctx_arr;
+        if (!CreateSignContexts(ctx_arr, keys->sign_key_base64_arr_, m, "ssid")) {
+            state.SkipWithError("failed to create the cmp sign contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, MakePartyIds(n_parties), false, nullptr)) {
+            state.SkipWithError("cmp sign failed");
+            break;
+        }
+    }
+    state.counters["sessions"] = benchmark::Counter((double)state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CmpSignConcurrent)->ThreadRange(1, 8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Parse a message of a signing session.
+ * @param round round of the message
+ * @param bc true for the broadcast message, false for the P2P message
+ */
+template<class Message, int round, bool bc>
+static void BM_CmpSignMessageDecode(benchmark::State &state) {
+    const SignTranscript *transcript = GetCmpSignTranscript();
+    if (!transcript || transcript->size() <= (size_t)round || (*transcript)[round].empty()) {
+        state.SkipWithError("cmp sign failed");
+        return;
+    }
+    const SignMessage &msg = (*transcript)[round][0];
+    const std::string &b64 = bc ? msg.bc_msg_ : msg.p2p_msg_;
+
+    for (auto _: state) {
+        Message message;
+        bool ok = message.FromBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * b64.size()));
+}
+
+template<class Message, int round, bool bc>
+static void BM_CmpSignMessageEncode(benchmark::State &state) {
+    const SignTranscript *transcript = GetCmpSignTranscript();
+    if (!transcript || transcript->size() <= (size_t)round || (*transcript)[round].empty()) {
+        state.SkipWithError("cmp sign failed");
+        return;
+    }
+    const SignMessage &msg = (*transcript)[round][0];
+    Message message;
+    if (!message.FromBase64(bc ? msg.bc_msg_ : msg.p2p_msg_)) {
+        state.SkipWithError("invalid message");
+        return;
+    }
+
+    size_t bytes = 0;
+    for (auto _: state) {
+        std::string b64;
+        bool ok = message.ToBase64(b64);
+        benchmark::DoNotOptimize(ok);
+        bytes = b64.size();
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * bytes));
+}
+
+BENCHMARK_TEMPLATE(BM_CmpSignMessageDecode, sign::Round0BCMessage, 0, true);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageDecode, sign::Round0P2PMessage, 0, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageDecode, sign::Round1P2PMessage, 1, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageDecode, sign::Round2P2PMessage, 2, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageDecode, sign::Round3P2PMessage, 3, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageEncode, sign::Round0BCMessage, 0, true);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageEncode, sign::Round0P2PMessage, 0, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageEncode, sign::Round1P2PMessage, 1, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageEncode, sign::Round2P2PMessage, 2, false);
+BENCHMARK_TEMPLATE(BM_CmpSignMessageEncode, sign::Round3P2PMessage, 3, false);
+
+static void BM_CmpSignKeyDecode(benchmark::State &state) {
+    const CmpKeys *keys = GetCmpKeys(0, 3, 2);
+    if (!keys) {
+        state.SkipWithError("cmp key generation failed");
+        return;
+    }
+    const std::string &b64 = keys->sign_key_base64_arr_[0];
+    for (auto _: state) {
+        SignKey sign_key;
+        bool ok = sign_key.FromBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * b64.size()));
+}
+BENCHMARK(BM_CmpSignKeyDecode);
+
+static void BM_CmpSignKeyEncode(benchmark::State &state) {
+    const CmpKeys *keys = GetCmpKeys(0, 3, 2);
+    SignKey sign_key;
+    if (!keys || !sign_key.FromBase64(keys->sign_key_base64_arr_[0])) {
+        state.SkipWithError("cmp key generation failed");
+        return;
+    }
+    for (auto _: state) {
+        std::string b64;
+        bool ok = sign_key.ToBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+}
+BENCHMARK(BM_CmpSignKeyEncode);
@@ -0,0 +1,174 @@
+#include <memory>
+#include "benchmark/benchmark.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_simulator.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/gg18.h"
+#include "bench_util.h"
+#include "gg18_keys.h"
+
+using safeheron::bignum::BN;
+using safeheron::curve::CurveType;
+using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCSimulator;
+using safeheron::mpc_flow::mpc_parallel_v2::SimulatorConfig;
+using safeheron::mpc_flow::mpc_parallel_v2::SimulatorStats;
+using safeheron::bench::CurveByIndex;
+using safeheron::bench::CurveName;
+using safeheron::bench::GetGG18SignKeys;
+using safeheron::bench::GetGG18SignerKeys;
+using safeheron::bench::MakePartyIds;
+using safeheron::bench::MakePartyIndexes;
+using safeheron::bench::MakeDigest;
+using safeheron::bench::PartyArgs;
+using safeheron::bench::RunProtocol;
+using safeheron::bench::StageRecorder;
+
+namespace key_gen = safeheron::multi_party_ecdsa::gg18::key_gen;
+namespace sign = safeheron::multi_party_ecdsa::gg18::sign;
+
+static void BM_GG18KeyGen(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const CurveType curve_type = CurveByIndex(state.range(2));
+    const bool parallel = state.range(3) != 0;
+    const std::vector<std::string> party_id_arr = MakePartyIds(n_parties);
+    const std::vector<BN> party_index_arr = MakePartyIndexes(n_parties);
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<key_gen::Context>> ctx_arr;
+        bool ok = true;
+        for (size_t i = 0; ok && i < n_parties; ++i) {
+            std::vector<std::string> remote_party_id_arr;
+            for (size_t j = 0; j < n_parties; ++j) {
+                if (j != i) remote_party_id_arr.push_back(party_id_arr[j]);
+            }
+            ctx_arr.emplace_back(new key_gen::Context((int)n_parties));
+            ok = key_gen::Context::CreateContext(*ctx_arr.back(), curve_type, "workspace_0", (uint32_t)threshold,
+                                                 (uint32_t)n_parties, party_id_arr[i], party_index_arr[i],
+                                                 remote_party_id_arr);
+        }
+        if (!ok) {
+            state.SkipWithError("failed to create the gg18 key generation contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, party_id_arr, parallel, &recorder)) {
+            state.SkipWithError("gg18 key generation failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, n_parties);
+}
+BENCHMARK(BM_GG18KeyGen)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_GG18Sign(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const bool parallel = state.range(3) != 0;
+    std::vector<std::string> sign_key_base64_arr;
+    if (!GetGG18SignerKeys(state.range(2), n_parties, threshold, sign_key_base64_arr)) {
+        state.SkipWithError("gg18 key generation failed");
+        return;
+    }
+    const BN m = MakeDigest();
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<sign::Context>> ctx_arr;
+        bool ok = true;
+        for (size_t i = 0; ok && i < sign_key_base64_arr.size(); ++i) {
+            ctx_arr.emplace_back(new sign::Context((int)threshold));
+            ok = sign::Context::CreateContext(*ctx_arr.back(), sign_key_base64_arr[i], m);
+        }
+        if (!ok) {
+            state.SkipWithError("failed to create the gg18 sign contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, MakePartyIds(threshold), parallel, &recorder)) {
+            state.SkipWithError("gg18 sign failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, threshold);
+}
+BENCHMARK(BM_GG18Sign)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Signing over a simulated WAN. The time reported is the simulated time, computation included.
+static void BM_GG18SignWAN(benchmark::State &state) {
+    const size_t threshold = (size_t)state.range(0);
+    std::vector<std::string> sign_key_base64_arr;
+    if (!GetGG18SignerKeys(0, threshold, threshold, sign_key_base64_arr)) {
+        state.SkipWithError("gg18 key generation failed");
+        return;
+    }
+    const std::vector<std::string> party_id_arr = MakePartyIds(threshold);
+    const BN m = MakeDigest();
+    SimulatorConfig config;
+    config.latency_us_ = (uint64_t)state.range(1) * 1000;
+    config.jitter_us_ = config.latency_us_ / 10;
+    config.bandwidth_bytes_per_sec_ = 100 * 1000 * 1000 / 8;
+    uint64_t elapsed_us = 0;
+    uint64_t message_count = 0;
+    uint64_t byte_count = 0;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<sign::Context>> ctx_arr;
+        MPCSimulator simulator(config);
+        bool ok = true;
+        for (size_t i = 0; ok && i < threshold; ++i) {
+            ctx_arr.emplace_back(new sign::Context((int)threshold));
+            ok = sign::Context::CreateContext(*ctx_arr.back(), sign_key_base64_arr[i], m);
+            simulator.AddParty(party_id_arr[i], ctx_arr.back().get());
+        }
+        if (!ok) {
+            state.SkipWithError("failed to create the gg18 sign contexts");
+            break;
+        }
+        if (!simulator.Run()) {
+            state.SkipWithError(simulator.get_error_info().c_str());
+            break;
+        }
+        const SimulatorStats &stats = simulator.get_stats();
+        state.SetIterationTime((double)stats.elapsed_us_ / 1e6);
+        elapsed_us += stats.elapsed_us_;
+        message_count += stats.message_count_;
+        byte_count += stats.byte_count_;
+    }
+    state.counters["simulated_ms"] = benchmark::Counter((double)elapsed_us / 1000.0, benchmark::Counter::kAvgIterations);
+    state.counters["messages"] = benchmark::Counter((double)message_count, benchmark::Counter::kAvgIterations);
+    state.counters["bytes"] = benchmark::Counter((double)byte_count, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_GG18SignWAN)->ArgNames({"t", "latency_ms"})->ArgsProduct({{2, 3, 5}, {0, 20, 100}})
+        ->Unit(benchmark::kMillisecond)->UseManualTime();
+
+static void BM_GG18SignKeyDecode(benchmark::State &state) {
+    const std::vector<std::string> *key_arr = GetGG18SignKeys(0, 3, 2);
+    if (!key_arr) {
+        state.SkipWithError("gg18 key generation failed");
+        return;
+    }
+    const std::string &b64 = (*key_arr)[0];
+    for (auto _: state) {
+        SignKey sign_key;
+        bool ok = sign_key.FromBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * b64.size()));
+}
+BENCHMARK(BM_GG18SignKeyDecode);
+
+static void BM_GG18SignKeyEncode(benchmark::State &state) {
+    const std::vector<std::string> *key_arr = GetGG18SignKeys(0, 3, 2);
+    SignKey sign_key;
+    if (!key_arr || !sign_key.FromBase64((*key_arr)[0])) {
+        state.SkipWithError("gg18 key generation failed");
+        return;
+    }
+    for (auto _: state) {
+        std::string b64;
+        bool ok = sign_key.ToBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+}
+BENCHMARK(BM_GG18SignKeyEncode);
@@ -0,0 +1,68 @@
+#include "gg18_keys.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include "multi-party-sig/multi-party-ecdsa/gg18/gg18.h"
+#include "bench_util.h"
+
+using safeheron::bignum::BN;
+
+namespace key_gen = safeheron::multi_party_ecdsa::gg18::key_gen;
+
+namespace safeheron {
+namespace bench {
+
+const std::vector<std::string> *GetGG18SignKeys(int64_t curve, size_t n_parties, size_t threshold) {
+    static std::mutex mutex;
+    static std::map<std::tuple<int64_t, size_t, size_t>, std::vector<std::string>> cache;
+    std::lock_guard<std::mutex> lk(mutex);
+    auto key = std::make_tuple(curve, n_parties, threshold);
+    auto iter = cache.find(key);
+    if (iter != cache.end()) return &iter->second;
+
+    const std::vector<std::string> party_id_arr = MakePartyIds(n_parties);
+    const std::vector<BN> party_index_arr = MakePartyIndexes(n_parties);
+    std::vector<std::unique_ptr<key_gen::Context>> ctx_arr;
+    for (size_t i = 0; i < n_parties; ++i) {
+        std::vector<std::string> remote_party_id_arr;
+        for (size_t j = 0; j < n_parties; ++j) {
+            if (j != i) remote_party_id_arr.push_back(party_id_arr[j]);
+        }
+        ctx_arr.emplace_back(new key_gen::Context((int)n_parties));
+        if (!key_gen::Context::CreateContext(*ctx_arr.back(), CurveByIndex(curve), "workspace_0", (uint32_t)threshold,
+                                             (uint32_t)n_parties, party_id_arr[i], party_index_arr[i],
+                                             remote_party_id_arr)) {
+            return nullptr;
+        }
+    }
+    if (!RunProtocol(ctx_arr, party_id_arr, 0, nullptr)) return nullptr;
+
+    std::vector<std::string> sign_key_base64_arr;
+    for (auto &ctx: ctx_arr) {
+        std::string b64;
+        if (!ctx->sign_key_.ToBase64(b64)) return nullptr;
+        sign_key_base64_arr.push_back(b64);
+    }
+    return &(cache[key] = sign_key_base64_arr);
+}
+
+bool GetGG18SignerKeys(int64_t curve, size_t n_parties, size_t threshold, std::vector<std::string> &sign_key_base64_arr) {
+    const std::vector<std::string> *key_arr = GetGG18SignKeys(curve, n_parties, threshold);
+    if (!key_arr) return false;
+    const std::vector<std::string> signer_id_arr = MakePartyIds(threshold);
+    sign_key_base64_arr.clear();
+    for (size_t i = 0; i < threshold; ++i) {
+        std::string b64;
+        if (n_parties == threshold) {
+            b64 = (*key_arr)[i];
+        } else if (!safeheron::multi_party_ecdsa::gg18::trim_sign_key(b64, (*key_arr)[i], signer_id_arr)) {
+            return false;
+        }
+        sign_key_base64_arr.push_back(b64);
+    }
+    return true;
+}
+
+}
+}
@@ -0,0 +1,26 @@
+#ifndef MULTI_PARTY_SIG_BENCHMARK_GG18_KEYS_H
+#define MULTI_PARTY_SIG_BENCHMARK_GG18_KEYS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace safeheron {
+namespace bench {
+
+/**
+ * Sign keys of GG18 for the signing benchmarks of GG18 and GG20, generated once for each (curve, n, t) by running
+ * the key generation protocol.
+ * @return nullptr if the key generation failed.
+ */
+const std::vector<std::string> *GetGG18SignKeys(int64_t curve, size_t n_parties, size_t threshold);
+
+/**
+ * Sign keys of the first t parties, trimmed to sign without the others.
+ */
+bool GetGG18SignerKeys(int64_t curve, size_t n_parties, size_t threshold, std::vector<std::string> &sign_key_base64_arr);
+
+}
+}
+
+#endif //MULTI_PARTY_SIG_BENCHMARK_GG18_KEYS_H
@@ -0,0 +1,50 @@
+#include <memory>
+#include "benchmark/benchmark.h"
+#include "multi-party-sig/multi-party-ecdsa/gg20/gg20.h"
+#include "bench_util.h"
+#include "gg18_keys.h"
+
+using safeheron::bignum::BN;
+using safeheron::bench::CurveName;
+using safeheron::bench::GetGG18SignerKeys;
+using safeheron::bench::MakePartyIds;
+using safeheron::bench::MakeDigest;
+using safeheron::bench::PartyArgs;
+using safeheron::bench::RunProtocol;
+using safeheron::bench::StageRecorder;
+
+namespace sign = safeheron::multi_party_ecdsa::gg20::sign;
+
+// GG20 signs with the sign keys of GG18.
+static void BM_GG20Sign(benchmark::State &state) {
+    const size_t n_parties = (size_t)state.range(0);
+    const size_t threshold = (size_t)state.range(1);
+    const bool parallel = state.range(3) != 0;
+    std::vector<std::string> sign_key_base64_arr;
+    if (!GetGG18SignerKeys(state.range(2), n_parties, threshold, sign_key_base64_arr)) {
+        state.SkipWithError("gg18 key generation failed");
+        return;
+    }
+    const BN m = MakeDigest();
+    StageRecorder recorder;
+
+    for (auto _: state) {
+        std::vector<std::unique_ptr<sign::Context>> ctx_arr;
+        bool ok = true;
+        for (size_t i = 0; ok && i < sign_key_base64_arr.size(); ++i) {
+            ctx_arr.emplace_back(new sign::Context((int)threshold));
+            ok = sign::Context::CreateContext(*ctx_arr.back(), sign_key_base64_arr[i], m);
+        }
+        if (!ok) {
+            state.SkipWithError("failed to create the gg20 sign contexts");
+            break;
+        }
+        if (!RunProtocol(ctx_arr, MakePartyIds(threshold), parallel, &recorder)) {
+            state.SkipWithError("gg20 sign failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(2)));
+    recorder.Report(state, threshold);
+}
+BENCHMARK(BM_GG20Sign)->Apply(PartyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
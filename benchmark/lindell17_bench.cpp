@@ -0,0 +1,374 @@
+#include <map>
+#include <memory>
+#include <mutex>
+#include "benchmark/benchmark.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/P1KeyShare.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/P2KeyShare.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/message.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P1Context.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P2Context.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1Context.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2Context.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1PresignContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2PresignContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1Signer.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2Signer.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1BatchContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2BatchContext.h"
+#include "multi-party-sig/mpc-flow/common/pail_key_pool.h"
+#include "bench_util.h"
+
+using safeheron::bignum::BN;
+using safeheron::curve::CurveType;
+using safeheron::mpc_flow::common::PailKeyPool;
+using safeheron::two_party_ecdsa::lindell17::P1KeyShare;
+using safeheron::two_party_ecdsa::lindell17::P2KeyShare;
+using safeheron::bench::CurveArgs;
+using safeheron::bench::CurveByIndex;
+using safeheron::bench::CurveName;
+using safeheron::bench::MakeDigest;
+
+namespace key_gen = safeheron::two_party_ecdsa::lindell17::key_gen;
+namespace sign = safeheron::two_party_ecdsa::lindell17::sign;
+
+namespace {
+
+struct KeyGenTranscript {
+    std::string p1_message1_;
+    std::string p2_message1_;
+    std::string p1_message2_;
+    std::string p2_message2_;
+    std::string p1_message3_;
+    std::string p2_message3_;
+    std::string p1_message4_;
+};
+
+bool RunKeyGen(key_gen::P1Context &p1_ctx, key_gen::P2Context &p2_ctx, KeyGenTranscript &t) {
+    return p1_ctx.Step1(t.p1_message1_) &&
+           p2_ctx.Step1(t.p1_message1_, t.p2_message1_) &&
+           p1_ctx.Step2(t.p2_message1_, t.p1_message2_) &&
+           p2_ctx.Step2(t.p1_message2_, t.p2_message2_) &&
+           p1_ctx.Step3(t.p2_message2_, t.p1_message3_) &&
+           p2_ctx.Step3(t.p1_message3_, t.p2_message3_) &&
+           p1_ctx.Step4(t.p2_message3_, t.p1_message4_) &&
+           p2_ctx.Step4(t.p1_message4_);
+}
+
+struct Lindell17Keys {
+    std::string key_share1_b64_;
+    std::string key_share2_b64_;
+    KeyGenTranscript transcript_;
+};
+
+// Key shares of the signing benchmarks, generated once for each curve by running the key generation protocol.
+const Lindell17Keys *GetLindell17Keys(int64_t curve) {
+    static std::mutex mutex;
+    static std::map<int64_t, Lindell17Keys> cache;
+    std::lock_guard<std::mutex> lk(mutex);
+    auto iter = cache.find(curve);
+    if (iter != cache.end()) return &iter->second;
+
+    Lindell17Keys keys;
+    key_gen::P1Context p1_ctx;
+    key_gen::P2Context p2_ctx;
+    if (!p1_ctx.CreateContext(CurveByIndex(curve))) return nullptr;
+    if (!p2_ctx.CreateContext(CurveByIndex(curve))) return nullptr;
+    if (!RunKeyGen(p1_ctx, p2_ctx, keys.transcript_)) return nullptr;
+    if (!p1_ctx.export_key_share(keys.key_share1_b64_)) return nullptr;
+    if (!p2_ctx.export_key_share(keys.key_share2_b64_)) return nullptr;
+    return &(cache[curve] = keys);
+}
+
+bool RunSign(sign::P1Context &p1_ctx, sign::P2Context &p2_ctx) {
+    std::string p1_message0, p2_message0, p1_message1, p2_message1, p1_message2, p2_message2;
+    return p1_ctx.Step0(p1_message0) &&
+           p2_ctx.Step0(p1_message0, p2_message0) &&
+           p1_ctx.Step1(p2_message0, p1_message1) &&
+           p2_ctx.Step1(p1_message1, p2_message1) &&
+           p1_ctx.Step2(p2_message1, p1_message2) &&
+           p2_ctx.Step2(p1_message2, p2_message2) &&
+           p1_ctx.Step3(p2_message2);
+}
+
+bool RunPresign(CurveType c_type, size_t batch_size, size_t max_threads,
+                std::vector<sign::P1Nonce> &p1_nonce_arr, sign::NonceStore<sign::P2Nonce> &p2_nonce_store) {
+    sign::P1PresignContext p1_ctx;
+    sign::P2PresignContext p2_ctx;
+    std::string p1_message0, p2_message0, p1_message1, p2_message1, p1_message2;
+    return p1_ctx.CreateContext(c_type, batch_size, max_threads) &&
+           p2_ctx.CreateContext(c_type, batch_size, max_threads) &&
+           p1_ctx.Step0(p1_message0) &&
+           p2_ctx.Step0(p1_message0, p2_message0) &&
+           p1_ctx.Step1(p2_message0, p1_message1) &&
+           p2_ctx.Step1(p1_message1, p2_message1) &&
+           p1_ctx.Step2(p2_message1, p1_message2) &&
+           p2_ctx.Step2(p1_message2) &&
+           p1_ctx.export_nonces(p1_nonce_arr) &&
+           p2_ctx.export_nonces(p2_nonce_store);
+}
+
+void CurveArg(benchmark::internal::Benchmark *b) {
+    b->ArgNames({"curve"});
+    for (int64_t curve: CurveArgs()) b->Arg(curve);
+}
+
+// Arguments {batch, threads}
+void BatchArgs(benchmark::internal::Benchmark *b) {
+    b->ArgNames({"batch", "threads"});
+    for (int64_t batch_size: {1, 16, 128}) {
+        for (int64_t threads: {1, 4, 0}) {
+            b->Args({batch_size, threads});
+        }
+    }
+}
+
+}
+
+static void BM_Lindell17KeyGen(benchmark::State &state) {
+    const CurveType c_type = CurveByIndex(state.range(0));
+    for (auto _: state) {
+        key_gen::P1Context p1_ctx;
+        key_gen::P2Context p2_ctx;
+        KeyGenTranscript transcript;
+        if (!p1_ctx.CreateContext(c_type) || !p2_ctx.CreateContext(c_type) ||
+            !RunKeyGen(p1_ctx, p2_ctx, transcript)) {
+            state.SkipWithError("lindell17 key generation failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(0)));
+}
+BENCHMARK(BM_Lindell17KeyGen)->Apply(CurveArg)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Key generation with the Paillier key of P1 generated ahead of time, see PailKeyPool.
+static void BM_Lindell17KeyGenPooledPaillier(benchmark::State &state) {
+    const CurveType c_type = CurveByIndex(state.range(0));
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    // The same Paillier key is used in all iterations, which only matters to the security of real keys.
+    PailKeyPool pool(1, 0);
+    pool.Fill();
+    safeheron::pail::PailPrivKey pail_priv;
+    safeheron::pail::PailPubKey pail_pub;
+    if (!curv || !pool.Take(pail_priv, pail_pub)) {
+        state.SkipWithError("failed to generate the Paillier key");
+        return;
+    }
+
+    for (auto _: state) {
+        key_gen::P1Context p1_ctx;
+        key_gen::P2Context p2_ctx;
+        KeyGenTranscript transcript;
+        const BN x1 = safeheron::rand::RandomBNLt(curv->n);
+        if (!p1_ctx.CreateContext(c_type, x1, pail_priv, pail_pub) || !p2_ctx.CreateContext(c_type) ||
+            !RunKeyGen(p1_ctx, p2_ctx, transcript)) {
+            state.SkipWithError("lindell17 key generation failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(0)));
+}
+BENCHMARK(BM_Lindell17KeyGenPooledPaillier)->Apply(CurveArg)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_Lindell17Sign(benchmark::State &state) {
+    const CurveType c_type = CurveByIndex(state.range(0));
+    const Lindell17Keys *keys = GetLindell17Keys(state.range(0));
+    if (!keys) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    const BN m = MakeDigest();
+
+    for (auto _: state) {
+        sign::P1Context p1_ctx;
+        sign::P2Context p2_ctx;
+        if (!p1_ctx.CreateContext(c_type, keys->key_share1_b64_, m) ||
+            !p2_ctx.CreateContext(c_type, keys->key_share2_b64_, m) ||
+            !RunSign(p1_ctx, p2_ctx)) {
+            state.SkipWithError("lindell17 sign failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(0)));
+}
+BENCHMARK(BM_Lindell17Sign)->Apply(CurveArg)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Sign with prepared signers shared by the sessions, one session per benchmark thread.
+static void BM_Lindell17SignPrepared(benchmark::State &state) {
+    const CurveType c_type = CurveByIndex(state.range(0));
+    const Lindell17Keys *keys = GetLindell17Keys(state.range(0));
+    std::shared_ptr<sign::P1Signer> p1_signer(new sign::P1Signer());
+    std::shared_ptr<sign::P2Signer> p2_signer(new sign::P2Signer());
+    if (!keys || !p1_signer->CreateSigner(c_type, keys->key_share1_b64_) ||
+        !p2_signer->CreateSigner(c_type, keys->key_share2_b64_)) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    const BN m = MakeDigest((uint32_t)state.thread_index());
+
+    for (auto _: state) {
+        sign::P1Context p1_ctx;
+        sign::P2Context p2_ctx;
+        if (!p1_ctx.CreateContext(p1_signer, m) || !p2_ctx.CreateContext(p2_signer, m) ||
+            !RunSign(p1_ctx, p2_ctx)) {
+            state.SkipWithError("lindell17 sign failed");
+            break;
+        }
+    }
+    state.SetLabel(CurveName(state.range(0)));
+    state.counters["sessions"] = benchmark::Counter((double)state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_Lindell17SignPrepared)->Apply(CurveArg)->ThreadRange(1, 8)->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+static void BM_Lindell17Presign(benchmark::State &state) {
+    const size_t batch_size = (size_t)state.range(0);
+    const size_t threads = (size_t)state.range(1);
+    for (auto _: state) {
+        std::vector<sign::P1Nonce> p1_nonce_arr;
+        sign::NonceStore<sign::P2Nonce> p2_nonce_store;
+        if (!RunPresign(CurveType::SECP256K1, batch_size, threads, p1_nonce_arr, p2_nonce_store)) {
+            state.SkipWithError("lindell17 presign failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed((int64_t)(state.iterations() * batch_size));
+}
+BENCHMARK(BM_Lindell17Presign)->Apply(BatchArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Online phase with presigned nonces, which are made out of the timing.
+static void BM_Lindell17OnlineSign(benchmark::State &state) {
+    const CurveType c_type = CurveByIndex(state.range(0));
+    const Lindell17Keys *keys = GetLindell17Keys(state.range(0));
+    std::shared_ptr<sign::P1Signer> p1_signer(new sign::P1Signer());
+    std::shared_ptr<sign::P2Signer> p2_signer(new sign::P2Signer());
+    if (!keys || !p1_signer->CreateSigner(c_type, keys->key_share1_b64_) ||
+        !p2_signer->CreateSigner(c_type, keys->key_share2_b64_)) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    const BN m = MakeDigest();
+    std::vector<sign::P1Nonce> p1_nonce_arr;
+    sign::NonceStore<sign::P2Nonce> p2_nonce_store;
+    size_t next = 0;
+
+    for (auto _: state) {
+        if (next == p1_nonce_arr.size()) {
+            state.PauseTiming();
+            bool ok = RunPresign(c_type, 64, 0, p1_nonce_arr, p2_nonce_store);
+            next = 0;
+            state.ResumeTiming();
+            if (!ok) {
+                state.SkipWithError("lindell17 presign failed");
+                break;
+            }
+        }
+        sign::P1Context p1_ctx;
+        sign::P2Context p2_ctx;
+        std::string p1_request, p2_response;
+        if (!p1_ctx.CreateContext(p1_signer, m, p1_nonce_arr[next]) ||
+            !p2_ctx.CreateContext(p2_signer, m, p2_nonce_store, p1_nonce_arr[next].sid_) ||
+            !p1_ctx.OnlineStep0(p1_request) ||
+            !p2_ctx.OnlineStep0(p1_request, p2_response) ||
+            !p1_ctx.Step3(p2_response)) {
+            state.SkipWithError("lindell17 online sign failed");
+            break;
+        }
+        ++next;
+    }
+    state.SetLabel(CurveName(state.range(0)));
+}
+BENCHMARK(BM_Lindell17OnlineSign)->Apply(CurveArg)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void BM_Lindell17BatchSign(benchmark::State &state) {
+    const size_t batch_size = (size_t)state.range(0);
+    const size_t threads = (size_t)state.range(1);
+    const Lindell17Keys *keys = GetLindell17Keys(0);
+    std::shared_ptr<sign::P1Signer> p1_signer(new sign::P1Signer());
+    std::shared_ptr<sign::P2Signer> p2_signer(new sign::P2Signer());
+    if (!keys || !p1_signer->CreateSigner(CurveType::SECP256K1, keys->key_share1_b64_) ||
+        !p2_signer->CreateSigner(CurveType::SECP256K1, keys->key_share2_b64_)) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    std::vector<BN> m_arr;
+    for (size_t i = 0; i < batch_size; ++i) m_arr.push_back(MakeDigest((uint32_t)i));
+
+    for (auto _: state) {
+        sign::P1BatchContext p1_ctx;
+        sign::P2BatchContext p2_ctx;
+        std::string p1_message0, p2_message0, p1_message1, p2_message1, p1_message2, p2_message2;
+        if (!p1_ctx.CreateContext(p1_signer, m_arr, threads) ||
+            !p2_ctx.CreateContext(p2_signer, m_arr, threads) ||
+            !p1_ctx.Step0(p1_message0) ||
+            !p2_ctx.Step0(p1_message0, p2_message0) ||
+            !p1_ctx.Step1(p2_message0, p1_message1) ||
+            !p2_ctx.Step1(p1_message1, p2_message1) ||
+            !p1_ctx.Step2(p2_message1, p1_message2) ||
+            !p2_ctx.Step2(p1_message2, p2_message2) ||
+            !p1_ctx.Step3(p2_message2)) {
+            state.SkipWithError("lindell17 batch sign failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed((int64_t)(state.iterations() * batch_size));
+}
+BENCHMARK(BM_Lindell17BatchSign)->Apply(BatchArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Parse a message of the key generation, e.g. P1Message2 carries the Paillier public key and its proof.
+ */
+template<class Message, std::string KeyGenTranscript::*member>
+static void BM_Lindell17KeyGenMessageDecode(benchmark::State &state) {
+    const Lindell17Keys *keys = GetLindell17Keys(0);
+    if (!keys) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    const std::string &b64 = keys->transcript_.*member;
+    for (auto _: state) {
+        Message message;
+        bool ok = message.FromBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * b64.size()));
+}
+
+template<class Message, std::string KeyGenTranscript::*member>
+static void BM_Lindell17KeyGenMessageEncode(benchmark::State &state) {
+    const Lindell17Keys *keys = GetLindell17Keys(0);
+    Message message;
+    if (!keys || !message.FromBase64(keys->transcript_.*member)) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    for (auto _: state) {
+        std::string b64;
+        bool ok = message.ToBase64(b64);
+        benchmark::DoNotOptimize(ok);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P1Message1, &KeyGenTranscript::p1_message1_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P2Message1, &KeyGenTranscript::p2_message1_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P1Message2, &KeyGenTranscript::p1_message2_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P2Message2, &KeyGenTranscript::p2_message2_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P1Message3, &KeyGenTranscript::p1_message3_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P2Message3, &KeyGenTranscript::p2_message3_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageDecode, key_gen::P1Message4, &KeyGenTranscript::p1_message4_);
+BENCHMARK_TEMPLATE(BM_Lindell17KeyGenMessageEncode, key_gen::P1Message2, &KeyGenTranscript::p1_message2_);
+
+static void BM_Lindell17KeyShareDecode(benchmark::State &state) {
+    const Lindell17Keys *keys = GetLindell17Keys(0);
+    if (!keys) {
+        state.SkipWithError("lindell17 key generation failed");
+        return;
+    }
+    for (auto _: state) {
+        P1KeyShare key_share1;
+        P2KeyShare key_share2;
+        bool ok = key_share1.FromBase64(keys->key_share1_b64_) && key_share2.FromBase64(keys->key_share2_b64_);
+        benchmark::DoNotOptimize(ok);
+    }
+}
+BENCHMARK(BM_Lindell17KeyShareDecode);
@@ -0,0 +1,187 @@
+#include <memory>
+#include <mutex>
+#include "benchmark/benchmark.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-paillier/pail.h"
+#include "crypto-suites/crypto-zkp/dlog_proof_v2.h"
+#include "crypto-suites/crypto-zkp/pail/pail_n_proof.h"
+#include "multi-party-sig/mpc-flow/common/pail_crt_decryptor.h"
+#include "multi-party-sig/mpc-flow/common/fixed_base_exp.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "bench_util.h"
+
+using safeheron::bignum::BN;
+using safeheron::pail::PailPubKey;
+using safeheron::pail::PailPrivKey;
+using safeheron::mpc_flow::common::PailCRTDecryptor;
+using safeheron::mpc_flow::common::FixedBaseExp;
+using safeheron::mpc_flow::common::PailRandPool;
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::bench::CurveArgs;
+using safeheron::bench::CurveByIndex;
+using safeheron::bench::CurveName;
+
+namespace {
+
+struct PailKeyPair {
+    PailPrivKey priv_;
+    PailPubKey pub_;
+};
+
+// One Paillier key shared by the benchmarks of this file.
+const PailKeyPair &GetPailKeyPair() {
+    static std::once_flag flag;
+    static PailKeyPair key_pair;
+    std::call_once(flag, [] {
+        safeheron::pail::CreateKeyPair2048(key_pair.priv_, key_pair.pub_);
+    });
+    return key_pair;
+}
+
+}
+
+static void BM_PailEncrypt(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    const BN m = safeheron::rand::RandomBNLt(key_pair.pub_.n());
+    for (auto _: state) {
+        benchmark::DoNotOptimize(key_pair.pub_.Encrypt(m));
+    }
+}
+BENCHMARK(BM_PailEncrypt)->Unit(benchmark::kMicrosecond);
+
+// Encryption with (r, r^N) taken from a pool filled ahead of time.
+static void BM_PailEncryptWithRandPool(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    const BN m = safeheron::rand::RandomBNLt(key_pair.pub_.n());
+    PailRandPool pool(key_pair.pub_.n(), 1024, 0);
+    for (auto _: state) {
+        state.PauseTiming();
+        if (pool.Size() == 0) pool.Fill();
+        state.ResumeTiming();
+        BN r, r_pow_N;
+        pool.Take(r, r_pow_N);
+        benchmark::DoNotOptimize(safeheron::mpc_flow::common::EncryptWithRN(key_pair.pub_, m, r_pow_N));
+    }
+}
+BENCHMARK(BM_PailEncryptWithRandPool)->Unit(benchmark::kMicrosecond);
+
+static void BM_PailDecrypt(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    const BN c = key_pair.pub_.Encrypt(safeheron::rand::RandomBNLt(key_pair.pub_.n()));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(key_pair.priv_.Decrypt(c));
+    }
+}
+BENCHMARK(BM_PailDecrypt)->Unit(benchmark::kMicrosecond);
+
+static void BM_PailDecryptCRT(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    const BN c = key_pair.pub_.Encrypt(safeheron::rand::RandomBNLt(key_pair.pub_.n()));
+    PailCRTDecryptor decryptor;
+    if (!decryptor.Init(key_pair.pub_, key_pair.priv_)) {
+        state.SkipWithError("failed to prepare the decryptor");
+        return;
+    }
+    for (auto _: state) {
+        benchmark::DoNotOptimize(decryptor.Decrypt(c));
+    }
+}
+BENCHMARK(BM_PailDecryptCRT)->Unit(benchmark::kMicrosecond);
+
+// c^e mod N^2 for a 256 bits e, the homomorphic scalar multiplication of Lindell17 and MtA
+static void BM_PailMulPlain(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    const BN c = key_pair.pub_.Encrypt(safeheron::rand::RandomBNLt(key_pair.pub_.n()));
+    const BN e = safeheron::rand::RandomBN(256);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(c.PowM(e, key_pair.pub_.n_sqr()));
+    }
+}
+BENCHMARK(BM_PailMulPlain)->Unit(benchmark::kMicrosecond);
+
+static void BM_PailMulPlainFixedBase(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    const BN c = key_pair.pub_.Encrypt(safeheron::rand::RandomBNLt(key_pair.pub_.n()));
+    const BN e = safeheron::rand::RandomBN(256);
+    FixedBaseExp table(c, key_pair.pub_.n_sqr(), 256, (size_t)state.range(0));
+    for (auto _: state) {
+        benchmark::DoNotOptimize(table.Pow(e));
+    }
+}
+BENCHMARK(BM_PailMulPlainFixedBase)->ArgName("window")->DenseRange(2, 6, 2)->Unit(benchmark::kMicrosecond);
+
+static void BM_PailNProofProve(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    for (auto _: state) {
+        safeheron::zkp::pail::PailNProof proof;
+        proof.Prove(key_pair.priv_);
+        benchmark::DoNotOptimize(proof);
+    }
+}
+BENCHMARK(BM_PailNProofProve)->Unit(benchmark::kMillisecond);
+
+static void BM_PailNProofVerify(benchmark::State &state) {
+    const PailKeyPair &key_pair = GetPailKeyPair();
+    safeheron::zkp::pail::PailNProof proof;
+    proof.Prove(key_pair.priv_);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(proof.Verify(key_pair.pub_));
+    }
+}
+BENCHMARK(BM_PailNProofVerify)->Unit(benchmark::kMillisecond);
+
+static void BM_DLogProve(benchmark::State &state) {
+    const safeheron::curve::CurveType c_type = CurveByIndex(state.range(0));
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    const BN x = safeheron::rand::RandomBNLt(curv->n);
+    for (auto _: state) {
+        safeheron::zkp::dlog::DLogProof_V2 proof;
+        proof.SetSalt("salt");
+        proof.ProveEx(x, c_type);
+        benchmark::DoNotOptimize(proof);
+    }
+    state.SetLabel(CurveName(state.range(0)));
+}
+BENCHMARK(BM_DLogProve)->ArgName("curve")->ArgsProduct({CurveArgs()})->Unit(benchmark::kMicrosecond);
+
+static void BM_DLogVerify(benchmark::State &state) {
+    const safeheron::curve::CurveType c_type = CurveByIndex(state.range(0));
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    const BN x = safeheron::rand::RandomBNLt(curv->n);
+    const safeheron::curve::CurvePoint X = curv->g * x;
+    safeheron::zkp::dlog::DLogProof_V2 proof;
+    proof.SetSalt("salt");
+    proof.ProveEx(x, c_type);
+    for (auto _: state) {
+        benchmark::DoNotOptimize(proof.Verify(X));
+    }
+    state.SetLabel(CurveName(state.range(0)));
+}
+BENCHMARK(BM_DLogVerify)->ArgName("curve")->ArgsProduct({CurveArgs()})->Unit(benchmark::kMicrosecond);
+
+// Framing of the messages of a batch, see BatchMPCContext.
+static void BM_BatchMessageEncode(benchmark::State &state) {
+    std::vector<std::string> msg_arr((size_t)state.range(0), std::string(2048, 'm'));
+    for (auto _: state) {
+        std::string out;
+        BatchMPCContext::EncodeMessages(msg_arr, out);
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * state.range(0) * 2048));
+}
+BENCHMARK(BM_BatchMessageEncode)->ArgName("batch")->RangeMultiplier(8)->Range(1, 512);
+
+static void BM_BatchMessageDecode(benchmark::State &state) {
+    std::vector<std::string> msg_arr((size_t)state.range(0), std::string(2048, 'm'));
+    std::string in;
+    BatchMPCContext::EncodeMessages(msg_arr, in);
+    for (auto _: state) {
+        std::vector<std::string> out_arr;
+        bool ok = BatchMPCContext::DecodeMessages(in, out_arr);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetBytesProcessed((int64_t)(state.iterations() * in.size()));
+}
+BENCHMARK(BM_BatchMessageDecode)->ArgName("batch")->RangeMultiplier(8)->Range(1, 512);
@@ -0,0 +1,51 @@
+#include <utility>
+#include "multi-party-sig/mpc-flow/common/executor.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t thread_num): stop_(false) {
+    if (thread_num == 0) thread_num = std::thread::hardware_concurrency();
+    if (thread_num == 0) thread_num = 1;
+    thread_arr_.reserve(thread_num);
+    for (size_t i = 0; i < thread_num; ++i) {
+        thread_arr_.emplace_back([this] { Work(); });
+    }
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto &t: thread_arr_) t.join();
+}
+
+void ThreadPoolExecutor::Post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        task_queue_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void ThreadPoolExecutor::Work() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            cv_.wait(lk, [this] { return stop_ || !task_queue_.empty(); });
+            // Stop only after the queue is drained
+            if (task_queue_.empty()) return;
+            task = std::move(task_queue_.front());
+            task_queue_.pop_front();
+        }
+        task();
+    }
+}
+
+} // safeheron
+} // mpc_flow
+} // common
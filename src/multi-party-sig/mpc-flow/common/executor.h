@@ -0,0 +1,66 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_EXECUTOR_H
+#define SAFEHERON_MPC_FLOW_COMMON_EXECUTOR_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Something which runs tasks, e.g. a thread pool or the event loop of the application.
+ */
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    /**
+     * Run the task later, on any thread. Must not run it in the calling thread before returning.
+     */
+    virtual void Post(std::function<void()> task) = 0;
+};
+
+/**
+ * An executor with a fixed number of threads. Tasks posted are run in order of posting, by whichever thread is free.
+ * The destructor runs the tasks still queued, then joins the threads.
+ */
+class ThreadPoolExecutor : public Executor {
+public:
+    /**
+     * Constructor
+     * @param thread_num number of threads, 0 means std::thread::hardware_concurrency().
+     */
+    explicit ThreadPoolExecutor(size_t thread_num = 0);
+
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+
+    ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+
+    void Post(std::function<void()> task) override;
+
+    size_t get_thread_num() const { return thread_arr_.size(); }
+
+private:
+    void Work();
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> task_queue_;
+    bool stop_;
+    std::vector<std::thread> thread_arr_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_EXECUTOR_H
@@ -0,0 +1,90 @@
+#include <cstring>
+#include <string>
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/secure_zero.h"
+#include "multi-party-sig/mpc-flow/common/fixed_base_exp.h"
+
+using safeheron::bignum::BN;
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+// 0xff if a == b, 0 otherwise, without a branch
+static inline uint8_t EqMask(size_t a, size_t b) {
+    size_t x = a ^ b;
+    // The top bit of x | -x is set iff x != 0
+    size_t ne = (x | (0 - x)) >> (sizeof(size_t) * 8 - 1);
+    return (uint8_t)(ne - 1);
+}
+
+// Big endian on exactly len bytes, num < 256^len
+static void ToFixedBytesBE(const BN &num, uint8_t *out, size_t len) {
+    std::string buf;
+    num.ToBytesBE(buf);
+    memset(out, 0, len - buf.size());
+    memcpy(out + len - buf.size(), buf.data(), buf.size());
+    SecureZero(&buf[0], buf.size());
+}
+
+FixedBaseExp::FixedBaseExp(const BN &base, const BN &mod, size_t max_exp_bits, size_t window_bits)
+        : base_(base % mod), mod_(mod), max_exp_bits_(max_exp_bits), window_bits_(window_bits) {
+    if (window_bits_ < 1) window_bits_ = 1;
+    if (window_bits_ > 8) window_bits_ = 8;
+    window_num_ = (max_exp_bits_ + window_bits_ - 1) / window_bits_;
+    entry_size_ = ((size_t)mod_.BitLength() + 7) / 8;
+
+    const size_t digit_num = (size_t)1 << window_bits_;
+    table_.resize(window_num_ * digit_num * entry_size_);
+    // b = base^(2^(w*i))
+    BN b = base_;
+    for (size_t i = 0; i < window_num_; ++i) {
+        uint8_t *row = table_.data() + i * digit_num * entry_size_;
+        BN acc(1);
+        for (size_t d = 0; d < digit_num; ++d) {
+            ToFixedBytesBE(acc, row + d * entry_size_, entry_size_);
+            acc = (acc * b) % mod_;
+        }
+        // base^(2^(w*(i+1))) = T[i][2^w - 1] * b
+        b = acc;
+    }
+}
+
+BN FixedBaseExp::Pow(const BN &e) const {
+    if (e < 0 || (size_t)e.BitLength() > max_exp_bits_) {
+        CountPrimitive(Primitive::HelperModExp);
+        return base_.PowM(e, mod_);
+    }
+
+    // The exponent on a fixed number of bytes, so that the loops below do not depend on its length
+    std::vector<uint8_t> exp_bytes((window_num_ * window_bits_ + 7) / 8);
+    ToFixedBytesBE(e, exp_bytes.data(), exp_bytes.size());
+    const size_t digit_num = (size_t)1 << window_bits_;
+    std::vector<uint8_t> entry(entry_size_);
+
+    BN result(1);
+    for (size_t i = 0; i < window_num_; ++i) {
+        size_t d = 0;
+        for (size_t k = 0; k < window_bits_; ++k) {
+            size_t bit = i * window_bits_ + k;
+            uint8_t byte = exp_bytes[exp_bytes.size() - 1 - bit / 8];
+            d |= (size_t)((byte >> (bit % 8)) & 1) << k;
+        }
+        // Read the whole row, keep T[i][d]
+        const uint8_t *row = table_.data() + i * digit_num * entry_size_;
+        memset(entry.data(), 0, entry_size_);
+        for (size_t j = 0; j < digit_num; ++j) {
+            const uint8_t mask = EqMask(j, d);
+            const uint8_t *src = row + j * entry_size_;
+            for (size_t k = 0; k < entry_size_; ++k) entry[k] |= src[k] & mask;
+        }
+        result = (result * BN::FromBytesBE(entry.data(), entry_size_)) % mod_;
+    }
+    SecureZero(exp_bytes.data(), exp_bytes.size());
+    SecureZero(entry.data(), entry.size());
+    return result;
+}
+
+} // safeheron
+} // mpc_flow
+} // common
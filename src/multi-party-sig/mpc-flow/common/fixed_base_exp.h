@@ -0,0 +1,62 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_FIXED_BASE_EXP_H
+#define SAFEHERON_MPC_FLOW_COMMON_FIXED_BASE_EXP_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Fixed-base windowed exponentiation: base^e mod n for a base that is used many times.
+ *
+ * The exponent is split into windows of w bits, e = sum(d_i * 2^(w*i)), and the table holds
+ *     T[i][d] = base^(d * 2^(w*i)) mod n,  d in [0, 2^w)
+ * for every window i, so base^e = prod(T[i][d_i]) costs one multiplication per window and no squaring.
+ *
+ * The exponent may be secret: every window reads all the 2^w entries of its row and keeps T[i][d_i] with a mask, and
+ * multiplies even when d_i = 0, so neither the branches nor the memory accesses depend on the digits.
+ *
+ * The table has ceil(max_exp_bits / w) * 2^w entries of the byte length of n. Exponents out of [0, 2^max_exp_bits)
+ * fall back to PowM.
+ */
+class FixedBaseExp {
+public:
+    /**
+     * Build the table.
+     * @param base
+     * @param mod
+     * @param max_exp_bits maximum bit length of the exponents
+     * @param window_bits bits of a window, in [1, 8]
+     */
+    FixedBaseExp(const safeheron::bignum::BN &base, const safeheron::bignum::BN &mod,
+                 size_t max_exp_bits, size_t window_bits = 4);
+
+    const safeheron::bignum::BN &base() const { return base_; }
+
+    const safeheron::bignum::BN &mod() const { return mod_; }
+
+    /**
+     * @return base^e mod n
+     */
+    safeheron::bignum::BN Pow(const safeheron::bignum::BN &e) const;
+
+private:
+    safeheron::bignum::BN base_;
+    safeheron::bignum::BN mod_;
+    size_t max_exp_bits_;
+    size_t window_bits_;
+    size_t window_num_;
+    size_t entry_size_;
+    // table_[(i * 2^w + d) * entry_size_, ...) = base^(d * 2^(w*i)), big endian on entry_size_ bytes
+    std::vector<uint8_t> table_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_FIXED_BASE_EXP_H
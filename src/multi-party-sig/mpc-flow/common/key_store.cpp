@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "multi-party-sig/mpc-flow/common/key_store.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+static const char FILE_MAGIC[8] = {'S', 'F', 'K', 'S', 'T', 'O', 'R', 'E'};
+static const uint32_t FILE_VERSION = 2;
+static const uint32_t RECORD_MAGIC = 0x4B524543; // "KREC"
+
+struct FileHeader {
+    char magic_[8];
+    uint32_t version_;
+    uint32_t reserved_;
+};
+
+struct RecordHeader {
+    uint32_t magic_;
+    uint32_t type_;
+    uint32_t workspace_id_size_;
+    uint32_t party_id_size_;
+    uint64_t payload_size_;
+    uint64_t payload_checksum_;
+    uint64_t header_checksum_;
+};
+
+static size_t Align8(size_t size) {
+    return (size + 7) & ~(size_t)7;
+}
+
+// FNV-1a, to catch torn or damaged records, not an integrity check against an attacker.
+static uint64_t Checksum(const uint8_t *data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Checksum of the header of a record, but the magic and the header checksum, and of its ids
+static uint64_t HeaderChecksum(const RecordHeader &header, const uint8_t *ids) {
+    uint64_t checksum = Checksum(reinterpret_cast<const uint8_t *>(&header.type_),
+                                 offsetof(RecordHeader, header_checksum_) - offsetof(RecordHeader, type_));
+    return Checksum(ids, (size_t)header.workspace_id_size_ + header.party_id_size_, checksum);
+}
+
+static bool WriteAll(int fd, const uint8_t *data, size_t size, off_t offset) {
+    while (size > 0) {
+        ssize_t n = pwrite(fd, data, size, offset);
+        if (n <= 0) return false;
+        data += n;
+        size -= (size_t)n;
+        offset += n;
+    }
+    return true;
+}
+
+KeyStore::KeyStore(): fd_(-1), read_only_(true), data_(nullptr), size_(0), end_(0) {
+}
+
+KeyStore::~KeyStore() {
+    Close();
+}
+
+bool KeyStore::Open(const std::string &path, bool read_only) {
+    Close();
+    std::lock_guard<std::mutex> lk(mutex_);
+    int fd = read_only ? open(path.c_str(), O_RDONLY | O_CLOEXEC)
+                       : open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0) return false;
+    // One writer at a time
+    if (!read_only && flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        close(fd);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_t file_size = (size_t)st.st_size;
+    if (file_size == 0 && !read_only) {
+        FileHeader header;
+        memcpy(header.magic_, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version_ = FILE_VERSION;
+        header.reserved_ = 0;
+        if (!WriteAll(fd, reinterpret_cast<const uint8_t *>(&header), sizeof(header), 0)) {
+            close(fd);
+            return false;
+        }
+        file_size = sizeof(header);
+    }
+
+    fd_ = fd;
+    read_only_ = read_only;
+    bool ok = (file_size >= sizeof(FileHeader)) && Map(file_size);
+    if (ok) {
+        const FileHeader *header = reinterpret_cast<const FileHeader *>(data_);
+        ok = (memcmp(header->magic_, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0) && (header->version_ == FILE_VERSION);
+    }
+    if (ok) {
+        end_ = sizeof(FileHeader);
+        Scan();
+        // Drop a tail cut short by a crash, or restore the padding of the last record, so the next record is appended
+        // at a good place. Scan() only stops short of the end of the file when no good record follows.
+        if (end_ != size_ && !read_only_) ok = (ftruncate(fd_, (off_t)end_) == 0) && Map(end_);
+    }
+    if (!ok) {
+        Unmap();
+        close(fd_);
+        fd_ = -1;
+        end_ = 0;
+        map_key_offset_arr_.clear();
+        return false;
+    }
+    return true;
+}
+
+void KeyStore::Close() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    Unmap();
+    if (fd_ >= 0) close(fd_);
+    fd_ = -1;
+    end_ = 0;
+    map_key_offset_arr_.clear();
+}
+
+bool KeyStore::Map(size_t size) const {
+    Unmap();
+    void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd_, 0);
+    if (data == MAP_FAILED) return false;
+    // Keys are looked up at random, read ahead would page in keys nobody asked for.
+    madvise(data, size, MADV_RANDOM);
+    data_ = static_cast<uint8_t *>(data);
+    size_ = size;
+    return true;
+}
+
+void KeyStore::Unmap() const {
+    if (data_) munmap(data_, size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+bool KeyStore::IsRecord(size_t offset) const {
+    if (offset + sizeof(RecordHeader) > size_) return false;
+    RecordHeader header;
+    memcpy(&header, data_ + offset, sizeof(header));
+    if (header.magic_ != RECORD_MAGIC) return false;
+    if (header.payload_size_ > size_) return false;
+    size_t body_size = (size_t)header.workspace_id_size_ + header.party_id_size_ + (size_t)header.payload_size_;
+    if (body_size > size_ - offset - sizeof(RecordHeader)) return false;
+    return HeaderChecksum(header, data_ + offset + sizeof(RecordHeader)) == header.header_checksum_;
+}
+
+bool KeyStore::IsPayloadGood(size_t offset) const {
+    RecordHeader header;
+    memcpy(&header, data_ + offset, sizeof(header));
+    const uint8_t *payload = data_ + offset + sizeof(RecordHeader) + header.workspace_id_size_ + header.party_id_size_;
+    return Checksum(payload, (size_t)header.payload_size_) == header.payload_checksum_;
+}
+
+void KeyStore::Scan() {
+    size_t offset = end_;
+    while (offset + sizeof(RecordHeader) <= size_) {
+        if (!IsRecord(offset)) {
+            // A damaged header in the middle of the file: go on from the next good one. None is left after a tail
+            // torn by a crash, or a record being appended by the writer.
+            size_t next = offset + 8;
+            while (next + sizeof(RecordHeader) <= size_ && !IsRecord(next)) next += 8;
+            if (next + sizeof(RecordHeader) > size_) break;
+            offset = next;
+            continue;
+        }
+        RecordHeader header;
+        memcpy(&header, data_ + offset, sizeof(header));
+        size_t body_size = (size_t)header.workspace_id_size_ + header.party_id_size_ + (size_t)header.payload_size_;
+        const size_t next = offset + Align8(sizeof(RecordHeader) + body_size);
+        // The payload of the last record may not have reached the disk. The others are checked when looked up.
+        if (next >= size_ && !IsPayloadGood(offset)) break;
+
+        const char *ids = reinterpret_cast<const char *>(data_ + offset + sizeof(RecordHeader));
+        std::string workspace_id(ids, header.workspace_id_size_);
+        std::string party_id(ids + header.workspace_id_size_, header.party_id_size_);
+        map_key_offset_arr_[MakeIndexKey((KeyRecordType)header.type_, workspace_id, party_id)].push_back(offset);
+        offset = next;
+    }
+    // Aligned even if the padding of the last record is missing
+    end_ = offset;
+}
+
+bool KeyStore::Reload() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (fd_ < 0) return false;
+    struct stat st;
+    if (fstat(fd_, &st) != 0) return false;
+    if ((size_t)st.st_size <= end_) return true;
+    if (!Map((size_t)st.st_size)) return false;
+    Scan();
+    return true;
+}
+
+std::string KeyStore::MakeIndexKey(KeyRecordType type, const std::string &workspace_id,
+                                   const std::string &party_id) {
+    std::string key;
+    key.reserve(4 + 4 + workspace_id.size() + party_id.size());
+    uint32_t t = (uint32_t)type;
+    uint32_t workspace_id_size = (uint32_t)workspace_id.size();
+    key.append(reinterpret_cast<const char *>(&t), sizeof(t));
+    key.append(reinterpret_cast<const char *>(&workspace_id_size), sizeof(workspace_id_size));
+    key.append(workspace_id);
+    key.append(party_id);
+    return key;
+}
+
+bool KeyStore::Put(KeyRecordType type, const std::string &workspace_id, const std::string &party_id,
+                   const std::string &payload, bool sync) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (fd_ < 0 || read_only_) return false;
+    if (workspace_id.size() > UINT32_MAX || party_id.size() > UINT32_MAX) return false;
+
+    RecordHeader header;
+    header.magic_ = RECORD_MAGIC;
+    header.type_ = (uint32_t)type;
+    header.workspace_id_size_ = (uint32_t)workspace_id.size();
+    header.party_id_size_ = (uint32_t)party_id.size();
+    header.payload_size_ = payload.size();
+    header.payload_checksum_ = Checksum(reinterpret_cast<const uint8_t *>(payload.data()), payload.size());
+    uint64_t checksum = Checksum(reinterpret_cast<const uint8_t *>(&header.type_),
+                                 offsetof(RecordHeader, header_checksum_) - offsetof(RecordHeader, type_));
+    checksum = Checksum(reinterpret_cast<const uint8_t *>(workspace_id.data()), workspace_id.size(), checksum);
+    header.header_checksum_ = Checksum(reinterpret_cast<const uint8_t *>(party_id.data()), party_id.size(), checksum);
+
+    size_t record_size = Align8(sizeof(RecordHeader) + workspace_id.size() + party_id.size() + payload.size());
+    std::string record;
+    record.reserve(record_size);
+    record.append(reinterpret_cast<const char *>(&header), sizeof(header));
+    record.append(workspace_id);
+    record.append(party_id);
+    record.append(payload);
+    record.resize(record_size, '\0');
+
+    size_t offset = end_;
+    if (!WriteAll(fd_, reinterpret_cast<const uint8_t *>(record.data()), record.size(), (off_t)offset)
+        || (sync && fdatasync(fd_) != 0)) {
+        // Leave the file as it was
+        int ret = ftruncate(fd_, (off_t)offset);
+        (void)ret;
+        return false;
+    }
+
+    // Mapped again on the next read
+    end_ = offset + record_size;
+    map_key_offset_arr_[MakeIndexKey(type, workspace_id, party_id)].push_back(offset);
+    return true;
+}
+
+bool KeyStore::FindPayload(KeyRecordType type, const std::string &workspace_id, const std::string &party_id,
+                           const uint8_t *&payload, size_t &payload_size) const {
+    auto iter = map_key_offset_arr_.find(MakeIndexKey(type, workspace_id, party_id));
+    if (iter == map_key_offset_arr_.end()) return false;
+    if (size_ < end_ && !Map(end_)) return false;
+
+    // The latest record whose payload is good
+    for (auto offset = iter->second.rbegin(); offset != iter->second.rend(); ++offset) {
+        if (!IsPayloadGood(*offset)) continue;
+        RecordHeader header;
+        memcpy(&header, data_ + *offset, sizeof(header));
+        payload = data_ + *offset + sizeof(RecordHeader) + header.workspace_id_size_ + header.party_id_size_;
+        payload_size = (size_t)header.payload_size_;
+        return true;
+    }
+    return false;
+}
+
+bool KeyStore::Get(KeyRecordType type, const std::string &workspace_id, const std::string &party_id,
+                   std::string &payload) const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    if (!FindPayload(type, workspace_id, party_id, data, size)) return false;
+    payload.assign(reinterpret_cast<const char *>(data), size);
+    return true;
+}
+
+bool KeyStore::Contains(KeyRecordType type, const std::string &workspace_id, const std::string &party_id) const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return map_key_offset_arr_.count(MakeIndexKey(type, workspace_id, party_id)) != 0;
+}
+
+size_t KeyStore::Size() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return map_key_offset_arr_.size();
+}
+
+size_t KeyStore::FileSize() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return end_;
+}
+
+} // safeheron
+} // mpc_flow
+} // common
@@ -0,0 +1,167 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_KEY_STORE_H
+#define SAFEHERON_MPC_FLOW_COMMON_KEY_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Type of the key held by a record.
+ */
+enum class KeyRecordType : uint32_t {
+    CMP_SIGN_KEY = 1,
+    CMP_MINIMAL_SIGN_KEY = 2,
+    GG18_SIGN_KEY = 3,
+    LINDELL17_P1_KEY_SHARE = 4,
+    LINDELL17_P2_KEY_SHARE = 5,
+};
+
+/**
+ * An append-only file of key records, mapped in memory and indexed by (type, workspace_id, party_id).
+ *
+ * A record is a fixed header followed by the ids and the payload, the binary protobuf encoding of the key. Opening
+ * the store walks the record headers and checks their checksums, which cover the ids but not the payload; a payload
+ * is only read and checked when its key is looked up, so opening a store does not page in the keys. Putting a key
+ * that is already there appends a new record which replaces the old one; if the payload of the latest record of a
+ * key is damaged, the previous version of the key is served.
+ *
+ * Layout, in native byte order, every record aligned on 8 bytes:
+ *     file header:   magic "SFKSTORE" | version(u32) | reserved(u32)
+ *     record header: magic(u32) | type(u32) | workspace_id size(u32) | party_id size(u32) | payload size(u64)
+ *                    | payload checksum(u64) | header checksum(u64)
+ *     record body:   workspace_id | party_id | payload | padding
+ *
+ * A store is opened for writing by one process at a time, and by any number of readers. A damaged record header in
+ * the middle of the file is skipped up to the next good record header. Only a tail with no good record after it,
+ * e.g. a last record cut short or torn by a crash, is dropped at the next Open() for writing, and a missing padding
+ * is restored. Methods are thread safe.
+ *
+ * Scope: the payload is the protobuf encoding of the key, whose big numbers are hex strings, so GetKey() still parses
+ * and converts every number of the key it loads; the store saves the file reads and the parsing of the other keys,
+ * not the decoding of the key asked for.
+ */
+class KeyStore {
+public:
+    KeyStore();
+
+    ~KeyStore();
+
+    KeyStore(const KeyStore &) = delete;
+
+    KeyStore &operator=(const KeyStore &) = delete;
+
+    /**
+     * Open the store, create it if needed.
+     * @param path
+     * @param read_only
+     * @return false if the file is not a key store, or another process has it open for writing.
+     */
+    bool Open(const std::string &path, bool read_only = false);
+
+    void Close();
+
+    /**
+     * Append a record.
+     * @param sync flush the record to the disk before returning
+     */
+    bool Put(KeyRecordType type, const std::string &workspace_id, const std::string &party_id,
+             const std::string &payload, bool sync = false);
+
+    /**
+     * Copy the payload of a record.
+     * @return false if not found or corrupted.
+     */
+    bool Get(KeyRecordType type, const std::string &workspace_id, const std::string &party_id,
+             std::string &payload) const;
+
+    /**
+     * Store a key, e.g. PutKey<safeheron::proto::multi_party_ecdsa::cmp::SignKey>(KeyRecordType::CMP_SIGN_KEY, ...)
+     */
+    template<typename ProtoObject, typename Key>
+    bool PutKey(KeyRecordType type, const std::string &workspace_id, const std::string &party_id, const Key &key,
+                bool sync = false) {
+        ProtoObject proto_object;
+        if (!key.ToProtoObject(proto_object)) return false;
+        std::string payload;
+        if (!proto_object.SerializeToString(&payload)) return false;
+        return Put(type, workspace_id, party_id, payload, sync);
+    }
+
+    /**
+     * Load a key, parsed straight from the mapped file.
+     */
+    template<typename ProtoObject, typename Key>
+    bool GetKey(KeyRecordType type, const std::string &workspace_id, const std::string &party_id, Key &key) const {
+        ProtoObject proto_object;
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            const uint8_t *payload = nullptr;
+            size_t payload_size = 0;
+            if (!FindPayload(type, workspace_id, party_id, payload, payload_size)) return false;
+            if (!proto_object.ParseFromArray(payload, (int)payload_size)) return false;
+        }
+        return key.FromProtoObject(proto_object);
+    }
+
+    /**
+     * Index the records appended by the writer since the store was opened. For stores opened read only.
+     */
+    bool Reload();
+
+    bool Contains(KeyRecordType type, const std::string &workspace_id, const std::string &party_id) const;
+
+    // Number of keys, a key put more than once counts once.
+    size_t Size() const;
+
+    // Bytes of the records indexed
+    size_t FileSize() const;
+
+private:
+    static std::string MakeIndexKey(KeyRecordType type, const std::string &workspace_id,
+                                    const std::string &party_id);
+
+    // Caller holds mutex_
+    bool FindPayload(KeyRecordType type, const std::string &workspace_id, const std::string &party_id,
+                     const uint8_t *&payload, size_t &payload_size) const;
+
+    // Caller holds mutex_. Map the first size bytes of the file.
+    bool Map(size_t size) const;
+
+    // Caller holds mutex_
+    void Unmap() const;
+
+    // Caller holds mutex_. Whether the record at offset has a good header and lies within the mapping.
+    bool IsRecord(size_t offset) const;
+
+    // Caller holds mutex_. Whether the payload of the record at offset matches its checksum.
+    bool IsPayloadGood(size_t offset) const;
+
+    // Caller holds mutex_. Index the good records from end_ up to the end of the mapping, move end_ past the last
+    // complete one, padding included.
+    void Scan();
+
+private:
+    mutable std::mutex mutex_;
+    int fd_;
+    bool read_only_;
+    // The mapping is moved lazily when records are appended
+    mutable uint8_t *data_;
+    mutable size_t size_;
+    // End of the last complete record, aligned on 8 bytes
+    size_t end_;
+    // (type, workspace_id, party_id) -> offsets of its records, the latest last
+    std::unordered_map<std::string, std::vector<size_t>> map_key_offset_arr_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_KEY_STORE_H
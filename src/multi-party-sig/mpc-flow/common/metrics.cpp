@@ -0,0 +1,105 @@
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+static thread_local std::atomic<uint64_t> *t_primitive_counters = nullptr;
+
+const char *StageName(Stage stage) {
+    switch (stage) {
+        case Stage::ParseMsg:
+            return "ParseMsg";
+        case Stage::ReceiveVerify:
+            return "ReceiveVerify";
+        case Stage::ComputeVerify:
+            return "ComputeVerify";
+        case Stage::MakeMessage:
+            return "MakeMessage";
+    }
+    return "";
+}
+
+const char *PrimitiveName(Primitive primitive) {
+    switch (primitive) {
+        case Primitive::PailEncrypt:
+            return "PailEncrypt";
+        case Primitive::PailDecrypt:
+            return "PailDecrypt";
+        case Primitive::HelperModExp:
+            return "HelperModExp";
+        case Primitive::ZKProve:
+            return "ZKProve";
+        case Primitive::ZKVerify:
+            return "ZKVerify";
+    }
+    return "";
+}
+
+CounterMetricsSink::CounterMetricsSink() {
+    Reset();
+}
+
+void CounterMetricsSink::OnStage(const StageMetrics &metrics) {
+    size_t s = static_cast<size_t>(metrics.stage_);
+    elapsed_ns_[s].fetch_add(metrics.elapsed_ns_, std::memory_order_relaxed);
+    calls_[s].fetch_add(1, std::memory_order_relaxed);
+    for (size_t p = 0; p < PRIMITIVE_NUM; ++p) {
+        primitive_count_[s][p].fetch_add(metrics.primitive_count_[p], std::memory_order_relaxed);
+    }
+}
+
+uint64_t CounterMetricsSink::get_elapsed_ns(Stage stage) const {
+    return elapsed_ns_[static_cast<size_t>(stage)].load(std::memory_order_relaxed);
+}
+
+uint64_t CounterMetricsSink::get_calls(Stage stage) const {
+    return calls_[static_cast<size_t>(stage)].load(std::memory_order_relaxed);
+}
+
+uint64_t CounterMetricsSink::get_primitive_count(Stage stage, Primitive primitive) const {
+    return primitive_count_[static_cast<size_t>(stage)][static_cast<size_t>(primitive)].load(std::memory_order_relaxed);
+}
+
+void CounterMetricsSink::Reset() {
+    for (size_t s = 0; s < STAGE_NUM; ++s) {
+        elapsed_ns_[s] = 0;
+        calls_[s] = 0;
+        for (size_t p = 0; p < PRIMITIVE_NUM; ++p) {
+            primitive_count_[s][p] = 0;
+        }
+    }
+}
+
+void CountPrimitive(Primitive primitive, uint64_t n) {
+    if (t_primitive_counters) {
+        t_primitive_counters[static_cast<size_t>(primitive)].fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+std::atomic<uint64_t> *GetThreadPrimitiveCounters() {
+    return t_primitive_counters;
+}
+
+void SetThreadPrimitiveCounters(std::atomic<uint64_t> *counters) {
+    t_primitive_counters = counters;
+}
+
+PrimitiveCounterScope::PrimitiveCounterScope() : prev_counters_(t_primitive_counters) {
+    for (size_t p = 0; p < PRIMITIVE_NUM; ++p) {
+        counters_[p] = 0;
+    }
+    t_primitive_counters = counters_;
+}
+
+PrimitiveCounterScope::~PrimitiveCounterScope() {
+    t_primitive_counters = prev_counters_;
+}
+
+uint64_t PrimitiveCounterScope::get_count(Primitive primitive) const {
+    return counters_[static_cast<size_t>(primitive)].load(std::memory_order_relaxed);
+}
+
+} // safeheron
+} // mpc_flow
+} // common
@@ -0,0 +1,142 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_METRICS_H
+#define SAFEHERON_MPC_FLOW_COMMON_METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Stages of a round, see MPCRound.
+ */
+enum class Stage : uint32_t {
+    ParseMsg = 0,
+    ReceiveVerify = 1,
+    ComputeVerify = 2,
+    MakeMessage = 3,
+};
+
+const size_t STAGE_NUM = 4;
+
+/**
+ * Primitives counted while a stage is running. The rounds of gg18, gg20 and cmp count them; the Lindell17 contexts
+ * do not run in MPCRound stages and report no metrics.
+ */
+enum class Primitive : uint32_t {
+    PailEncrypt = 0,
+    PailDecrypt = 1,
+    // Modular exponentiations computed online by the helpers of mpc-flow/common: r^N of PailRandPool and SampleEncRandomness,
+    // g^m of EncryptWithRN, and FixedBaseExp::Pow out of its table. Exponentiations made by the protocols themselves
+    // or inside crypto-suites are not counted.
+    HelperModExp = 2,
+    ZKProve = 3,
+    ZKVerify = 4,
+};
+
+const size_t PRIMITIVE_NUM = 5;
+
+const char *StageName(Stage stage);
+
+const char *PrimitiveName(Primitive primitive);
+
+/**
+ * Metrics of one stage of one round, reported when the stage is over.
+ * Parsing and serialization of messages are part of ParseMsg and MakeMessage.
+ */
+struct StageMetrics {
+    std::string session_id_;
+    int round_index_;
+    Stage stage_;
+    uint64_t elapsed_ns_;
+    uint64_t primitive_count_[PRIMITIVE_NUM];
+};
+
+/**
+ * Interface of metric sinks. OnStage() may be called from several threads at the same time if the sink is shared
+ * by several contexts.
+ */
+class MetricsSink {
+public:
+    virtual ~MetricsSink() = default;
+
+    virtual void OnStage(const StageMetrics &metrics) = 0;
+};
+
+/**
+ * Sink forwarding the metrics to a callback.
+ */
+class CallbackMetricsSink : public MetricsSink {
+public:
+    explicit CallbackMetricsSink(std::function<void(const StageMetrics &)> callback) : callback_(std::move(callback)) {}
+
+    void OnStage(const StageMetrics &metrics) override { callback_(metrics); }
+
+private:
+    std::function<void(const StageMetrics &)> callback_;
+};
+
+/**
+ * Sink summing the metrics up in lock-free counters, to be read periodically by telemetry.
+ */
+class CounterMetricsSink : public MetricsSink {
+public:
+    CounterMetricsSink();
+
+    void OnStage(const StageMetrics &metrics) override;
+
+    uint64_t get_elapsed_ns(Stage stage) const;
+
+    uint64_t get_calls(Stage stage) const;
+
+    uint64_t get_primitive_count(Stage stage, Primitive primitive) const;
+
+    void Reset();
+
+private:
+    std::atomic<uint64_t> elapsed_ns_[STAGE_NUM];
+    std::atomic<uint64_t> calls_[STAGE_NUM];
+    std::atomic<uint64_t> primitive_count_[STAGE_NUM][PRIMITIVE_NUM];
+};
+
+/**
+ * Count a primitive in the stage running on the current thread. Does nothing if no stage is measured.
+ */
+void CountPrimitive(Primitive primitive, uint64_t n = 1);
+
+/**
+ * Counters of the stage running on the current thread, nullptr if there is none. ParallelFor uses them to count the
+ * primitives run by its worker threads in the stage of the calling thread.
+ */
+std::atomic<uint64_t> *GetThreadPrimitiveCounters();
+
+void SetThreadPrimitiveCounters(std::atomic<uint64_t> *counters);
+
+/**
+ * Count primitives on the current thread during the life of the object.
+ */
+class PrimitiveCounterScope {
+public:
+    PrimitiveCounterScope();
+
+    ~PrimitiveCounterScope();
+
+    PrimitiveCounterScope(const PrimitiveCounterScope &) = delete;
+
+    PrimitiveCounterScope &operator=(const PrimitiveCounterScope &) = delete;
+
+    uint64_t get_count(Primitive primitive) const;
+
+private:
+    std::atomic<uint64_t> counters_[PRIMITIVE_NUM];
+    std::atomic<uint64_t> *prev_counters_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_METRICS_H
@@ -0,0 +1,60 @@
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/pail_crt_decryptor.h"
+
+using safeheron::bignum::BN;
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+bool PailCRTDecryptor::Init(const safeheron::pail::PailPubKey &pub, const safeheron::pail::PailPrivKey &priv) {
+    initialized_ = false;
+    if (priv.p() * priv.q() != pub.n()) return false;
+
+    N_ = pub.n();
+    N_half_ = N_ / 2;
+    p_ = priv.p();
+    q_ = priv.q();
+    p_sqr_ = p_ * p_;
+    q_sqr_ = q_ * q_;
+    p_minus_1_ = p_ - 1;
+    q_minus_1_ = q_ - 1;
+
+    if (pub.g() == N_ + 1) {
+        // g^(p-1) = 1 + (p-1) * N mod p^2, so L_p(g^(p-1)) = (p-1) * q = -q mod p
+        h_p_ = (p_ - q_ % p_).InvM(p_);
+        h_q_ = (q_ - p_ % q_).InvM(q_);
+    } else {
+        h_p_ = ((pub.g().PowM(p_minus_1_, p_sqr_) - 1) / p_).InvM(p_);
+        h_q_ = ((pub.g().PowM(q_minus_1_, q_sqr_) - 1) / q_).InvM(q_);
+    }
+    q_inv_p_ = q_.InvM(p_);
+
+    initialized_ = true;
+    return true;
+}
+
+BN PailCRTDecryptor::DecryptMod(const BN &c, const BN &p, const BN &p_sqr, const BN &p_minus_1, const BN &h_p) const {
+    BN x = (c % p_sqr).PowM(p_minus_1, p_sqr);
+    return (((x - 1) / p) * h_p) % p;
+}
+
+BN PailCRTDecryptor::Decrypt(const BN &c) const {
+    BN m_p = DecryptMod(c, p_, p_sqr_, p_minus_1_, h_p_);
+    BN m_q = DecryptMod(c, q_, q_sqr_, q_minus_1_, h_q_);
+    CountPrimitive(Primitive::PailDecrypt);
+
+    // m = m_q + q * ((m_p - m_q) * q^(-1) mod p)
+    BN d = (m_p + p_ - m_q % p_) % p_;
+    return m_q + q_ * ((d * q_inv_p_) % p_);
+}
+
+BN PailCRTDecryptor::DecryptNeg(const BN &c) const {
+    BN m = Decrypt(c);
+    if (m > N_half_) m = m - N_;
+    return m;
+}
+
+} // safeheron
+} // mpc_flow
+} // common
@@ -0,0 +1,72 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PAIL_CRT_DECRYPTOR_H
+#define SAFEHERON_MPC_FLOW_COMMON_PAIL_CRT_DECRYPTOR_H
+
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-paillier/pail.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Paillier decryption with the CRT, for a private key that is used many times.
+ *
+ * The plaintext is recovered mod p and mod q separately:
+ *     m_p = L_p(c^(p-1) mod p^2) * h_p mod p,  L_p(x) = (x - 1) / p,  h_p = L_p(g^(p-1) mod p^2)^(-1) mod p
+ * and the same mod q, then combined with the CRT. The exponentiations are mod p^2 and q^2 with half size exponents
+ * instead of one mod N^2 with exponent lambda.
+ *
+ * h_p, h_q and the CRT coefficient are computed once in Init().
+ */
+class PailCRTDecryptor {
+public:
+    PailCRTDecryptor(): initialized_(false) {}
+
+    /**
+     * Precompute the constants.
+     * @param pub Paillier public key, g = pub.g()
+     * @param priv Paillier private key, with p and q
+     * @return false if p * q != N
+     */
+    bool Init(const safeheron::pail::PailPubKey &pub, const safeheron::pail::PailPrivKey &priv);
+
+    bool IsInitialized() const { return initialized_; }
+
+    /**
+     * Decrypt c into [0, N)
+     */
+    safeheron::bignum::BN Decrypt(const safeheron::bignum::BN &c) const;
+
+    /**
+     * Decrypt c into (-N/2, N/2], as PailPrivKey::DecryptNeg does.
+     */
+    safeheron::bignum::BN DecryptNeg(const safeheron::bignum::BN &c) const;
+
+private:
+    safeheron::bignum::BN DecryptMod(const safeheron::bignum::BN &c,
+                                     const safeheron::bignum::BN &p,
+                                     const safeheron::bignum::BN &p_sqr,
+                                     const safeheron::bignum::BN &p_minus_1,
+                                     const safeheron::bignum::BN &h_p) const;
+
+private:
+    bool initialized_;
+    safeheron::bignum::BN N_;
+    safeheron::bignum::BN N_half_;
+    safeheron::bignum::BN p_;
+    safeheron::bignum::BN q_;
+    safeheron::bignum::BN p_sqr_;
+    safeheron::bignum::BN q_sqr_;
+    safeheron::bignum::BN p_minus_1_;
+    safeheron::bignum::BN q_minus_1_;
+    safeheron::bignum::BN h_p_;
+    safeheron::bignum::BN h_q_;
+    // q^(-1) mod p
+    safeheron::bignum::BN q_inv_p_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PAIL_CRT_DECRYPTOR_H
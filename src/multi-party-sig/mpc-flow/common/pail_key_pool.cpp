@@ -0,0 +1,92 @@
+#include "multi-party-sig/mpc-flow/common/pail_key_pool.h"
+
+using safeheron::pail::PailPrivKey;
+using safeheron::pail::PailPubKey;
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+PailKeyPool::PailKeyPool(size_t capacity, size_t worker_num)
+        : capacity_(capacity), pending_(0), stopped_(false) {
+    for (size_t i = 0; i < worker_num; ++i) {
+        workers_.emplace_back(&PailKeyPool::WorkerLoop, this);
+    }
+}
+
+PailKeyPool::~PailKeyPool() {
+    Stop();
+}
+
+size_t PailKeyPool::Size() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return pairs_.size();
+}
+
+void PailKeyPool::Take(PailPrivKey &priv, PailPubKey &pub) {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (!pairs_.empty()) {
+            priv = pairs_.front().first;
+            pub = pairs_.front().second;
+            pairs_.pop_front();
+            cond_.notify_one();
+            return;
+        }
+    }
+    // Pool is exhausted, fall back to online generation.
+    safeheron::pail::CreateKeyPair2048(priv, pub);
+}
+
+void PailKeyPool::Fill() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if (pairs_.size() + pending_ >= capacity_) return;
+            pending_++;
+        }
+        PailPrivKey priv;
+        PailPubKey pub;
+        safeheron::pail::CreateKeyPair2048(priv, pub);
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            pending_--;
+            pairs_.emplace_back(priv, pub);
+        }
+    }
+}
+
+void PailKeyPool::WorkerLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            cond_.wait(lk, [this] { return stopped_ || pairs_.size() + pending_ < capacity_; });
+            if (stopped_) return;
+            pending_++;
+        }
+        PailPrivKey priv;
+        PailPubKey pub;
+        safeheron::pail::CreateKeyPair2048(priv, pub);
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            pending_--;
+            pairs_.emplace_back(priv, pub);
+        }
+    }
+}
+
+void PailKeyPool::Stop() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stopped_ = true;
+    }
+    cond_.notify_all();
+    for (auto &worker: workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    workers_.clear();
+}
+
+} // safeheron
+} // mpc_flow
+} // common
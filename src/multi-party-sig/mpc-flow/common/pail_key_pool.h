@@ -0,0 +1,74 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PAIL_KEY_POOL_H
+#define SAFEHERON_MPC_FLOW_COMMON_PAIL_KEY_POOL_H
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include "crypto-suites/crypto-paillier/pail.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * A pool of 2048 bits Paillier key pairs generated ahead of time.
+ *
+ * Generating a key pair means searching for two 1024 bits safe primes, which takes seconds and varies a lot from run
+ * to run. Background workers keep the pool filled up to its capacity, so that a key generation protocol can start
+ * with a ready key. Every key pair is handed out once.
+ */
+class PailKeyPool {
+public:
+    /**
+     * Constructor
+     * @param capacity maximum number of key pairs kept in the pool
+     * @param worker_num number of background threads refilling the pool, 0 means the pool is only filled by Fill().
+     */
+    explicit PailKeyPool(size_t capacity = 4, size_t worker_num = 1);
+
+    ~PailKeyPool();
+
+    PailKeyPool(const PailKeyPool &) = delete;
+
+    PailKeyPool &operator=(const PailKeyPool &) = delete;
+
+    size_t Capacity() const { return capacity_; }
+
+    size_t Size() const;
+
+    /**
+     * Take a key pair out of the pool. Generate it online if the pool is empty.
+     */
+    void Take(safeheron::pail::PailPrivKey &priv, safeheron::pail::PailPubKey &pub);
+
+    /**
+     * Fill the pool up to its capacity in the calling thread.
+     */
+    void Fill();
+
+    /**
+     * Stop the background workers. Key pairs left in the pool can still be taken.
+     */
+    void Stop();
+
+private:
+    void WorkerLoop();
+
+private:
+    size_t capacity_;
+    // Number of key pairs being generated by workers
+    size_t pending_;
+    bool stopped_;
+    std::deque<std::pair<safeheron::pail::PailPrivKey, safeheron::pail::PailPubKey>> pairs_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::vector<std::thread> workers_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PAIL_KEY_POOL_H
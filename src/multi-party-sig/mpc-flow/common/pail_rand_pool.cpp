@@ -0,0 +1,150 @@
+#include <map>
+#include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
+
+using safeheron::bignum::BN;
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+// Registry of pools, keyed by N.
+static std::mutex s_registry_mutex;
+static std::map<BN, std::shared_ptr<PailRandPool>> s_registry;
+
+PailRandPool::PailRandPool(const BN &N, size_t capacity, size_t worker_num)
+        : N_(N), N_sqr_(N * N), capacity_(capacity), pending_(0), stopped_(false) {
+    for (size_t i = 0; i < worker_num; ++i) {
+        workers_.emplace_back(&PailRandPool::WorkerLoop, this);
+    }
+}
+
+PailRandPool::~PailRandPool() {
+    Stop();
+}
+
+size_t PailRandPool::Size() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return pairs_.size();
+}
+
+void PailRandPool::Compute(BN &r, BN &r_pow_N) const {
+    r = safeheron::rand::RandomBNLtCoPrime(N_);
+    r_pow_N = r.PowM(N_, N_sqr_);
+}
+
+void PailRandPool::Take(BN &r, BN &r_pow_N) {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (!pairs_.empty()) {
+            r = pairs_.front().first;
+            r_pow_N = pairs_.front().second;
+            pairs_.pop_front();
+            cond_.notify_one();
+            return;
+        }
+    }
+    // Pool is exhausted, fall back to online computation.
+    Compute(r, r_pow_N);
+    CountPrimitive(Primitive::HelperModExp);
+}
+
+void PailRandPool::Fill() {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            if (pairs_.size() + pending_ >= capacity_) return;
+            pending_++;
+        }
+        BN r, r_pow_N;
+        Compute(r, r_pow_N);
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            pending_--;
+            pairs_.emplace_back(r, r_pow_N);
+        }
+    }
+}
+
+void PailRandPool::WorkerLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            cond_.wait(lk, [this] { return stopped_ || pairs_.size() + pending_ < capacity_; });
+            if (stopped_) return;
+            pending_++;
+        }
+        BN r, r_pow_N;
+        Compute(r, r_pow_N);
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            pending_--;
+            pairs_.emplace_back(r, r_pow_N);
+        }
+    }
+}
+
+void PailRandPool::Stop() {
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        stopped_ = true;
+    }
+    cond_.notify_all();
+    for (auto &worker: workers_) {
+        if (worker.joinable()) worker.join();
+    }
+    workers_.clear();
+}
+
+void PailRandPool::Register(const std::shared_ptr<PailRandPool> &pool) {
+    std::lock_guard<std::mutex> lk(s_registry_mutex);
+    s_registry[pool->N()] = pool;
+}
+
+void PailRandPool::Unregister(const BN &N) {
+    std::lock_guard<std::mutex> lk(s_registry_mutex);
+    s_registry.erase(N);
+}
+
+std::shared_ptr<PailRandPool> PailRandPool::Find(const BN &N) {
+    std::lock_guard<std::mutex> lk(s_registry_mutex);
+    auto iter = s_registry.find(N);
+    if (iter == s_registry.end()) return nullptr;
+    return iter->second;
+}
+
+void SampleEncRandomness(const safeheron::pail::PailPubKey &pub, BN &r, BN &r_pow_N) {
+    std::shared_ptr<PailRandPool> pool = PailRandPool::Find(pub.n());
+    if (pool) {
+        pool->Take(r, r_pow_N);
+        return;
+    }
+    r = safeheron::rand::RandomBNLtCoPrime(pub.n());
+    r_pow_N = r.PowM(pub.n(), pub.n_sqr());
+    CountPrimitive(Primitive::HelperModExp);
+}
+
+BN EncryptWithRN(const safeheron::pail::PailPubKey &pub, const BN &m, const BN &r_pow_N) {
+    const BN &N = pub.n();
+    const BN &N_sqr = pub.n_sqr();
+    BN m_mod_N = m % N;
+    BN g_m;
+    if (pub.g() == N + 1) {
+        // (1 + N)^m = 1 + m * N  mod N^2
+        g_m = (m_mod_N * N + 1) % N_sqr;
+    } else {
+        g_m = pub.g().PowM(m_mod_N, N_sqr);
+        CountPrimitive(Primitive::HelperModExp);
+    }
+    CountPrimitive(Primitive::PailEncrypt);
+    return (g_m * r_pow_N) % N_sqr;
+}
+
+BN HomomorphicAddPlainWithRN(const safeheron::pail::PailPubKey &pub, const BN &c, const BN &m, const BN &r_pow_N) {
+    return (c * EncryptWithRN(pub, m, r_pow_N)) % pub.n_sqr();
+}
+
+} // safeheron
+} // mpc_flow
+} // common
@@ -0,0 +1,117 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PAIL_RAND_POOL_H
+#define SAFEHERON_MPC_FLOW_COMMON_PAIL_RAND_POOL_H
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-paillier/pail.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * A pool of precomputed Paillier encryption randomness (r, r^N mod N^2) for one Paillier modulus N.
+ *
+ * Background workers keep the pool filled up to its capacity, so that the online phase of an encryption
+ * only costs a multiplication mod N^2. Every pair is handed out once and then dropped from the pool.
+ *
+ * Pools are looked up by N through a process wide registry, see Register() / Find(). Call sites use
+ * SampleEncRandomness(), which falls back to online computation if no pool is registered for the key.
+ */
+class PailRandPool {
+public:
+    /**
+     * Constructor
+     * @param N Paillier modulus
+     * @param capacity maximum number of pairs kept in the pool
+     * @param worker_num number of background threads refilling the pool, 0 means the pool is only filled by Fill().
+     */
+    explicit PailRandPool(const safeheron::bignum::BN &N, size_t capacity = 64, size_t worker_num = 1);
+
+    ~PailRandPool();
+
+    PailRandPool(const PailRandPool &) = delete;
+
+    PailRandPool &operator=(const PailRandPool &) = delete;
+
+    const safeheron::bignum::BN &N() const { return N_; }
+
+    size_t Capacity() const { return capacity_; }
+
+    size_t Size() const;
+
+    /**
+     * Take a pair (r, r^N mod N^2) out of the pool. Compute it online if the pool is empty.
+     * @param[out] r random number in Z_N*
+     * @param[out] r_pow_N r^N mod N^2
+     */
+    void Take(safeheron::bignum::BN &r, safeheron::bignum::BN &r_pow_N);
+
+    /**
+     * Fill the pool up to its capacity in the calling thread.
+     */
+    void Fill();
+
+    /**
+     * Stop the background workers. Pairs left in the pool can still be taken.
+     */
+    void Stop();
+
+    static void Register(const std::shared_ptr<PailRandPool> &pool);
+
+    static void Unregister(const safeheron::bignum::BN &N);
+
+    static std::shared_ptr<PailRandPool> Find(const safeheron::bignum::BN &N);
+
+private:
+    void WorkerLoop();
+
+    void Compute(safeheron::bignum::BN &r, safeheron::bignum::BN &r_pow_N) const;
+
+private:
+    safeheron::bignum::BN N_;
+    safeheron::bignum::BN N_sqr_;
+    size_t capacity_;
+    // Number of pairs being computed by workers
+    size_t pending_;
+    bool stopped_;
+    std::deque<std::pair<safeheron::bignum::BN, safeheron::bignum::BN>> pairs_;
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::vector<std::thread> workers_;
+};
+
+/**
+ * Sample r in Z_N* and compute r^N mod N^2 for the public key. A precomputed pair is taken from the pool registered
+ * for N if there is one.
+ * @param[in] pub Paillier public key
+ * @param[out] r
+ * @param[out] r_pow_N
+ */
+void SampleEncRandomness(const safeheron::pail::PailPubKey &pub, safeheron::bignum::BN &r, safeheron::bignum::BN &r_pow_N);
+
+/**
+ * Enc(m; r) = g^m * r^N mod N^2 with precomputed r^N. Negative m is encrypted as m mod N, as EncryptNegWithR does.
+ */
+safeheron::bignum::BN EncryptWithRN(const safeheron::pail::PailPubKey &pub,
+                                    const safeheron::bignum::BN &m,
+                                    const safeheron::bignum::BN &r_pow_N);
+
+/**
+ * c <hAdd> Enc(m; r) with precomputed r^N. Negative m is allowed.
+ */
+safeheron::bignum::BN HomomorphicAddPlainWithRN(const safeheron::pail::PailPubKey &pub,
+                                                const safeheron::bignum::BN &c,
+                                                const safeheron::bignum::BN &m,
+                                                const safeheron::bignum::BN &r_pow_N);
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PAIL_RAND_POOL_H
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+// Threads the loops run on this thread may use, set while the thread works for an outer loop. 0 means no outer loop.
+static thread_local size_t t_thread_cap = 0;
+
+// Threads a loop run on this thread may use in total
+static size_t GetThreadCap(size_t max_threads) {
+    size_t cap = t_thread_cap != 0 ? t_thread_cap : std::thread::hardware_concurrency();
+    if (cap == 0) cap = 1;
+    if (max_threads == 0) return cap;
+    // Nested in another loop: stay within the share of the outer loop
+    return t_thread_cap != 0 ? std::min(max_threads, t_thread_cap) : max_threads;
+}
+
+// Set the cap of the current thread for the life of the scope
+class ThreadCapScope {
+public:
+    explicit ThreadCapScope(size_t cap) : prev_cap_(t_thread_cap) { t_thread_cap = cap; }
+
+    ~ThreadCapScope() { t_thread_cap = prev_cap_; }
+
+private:
+    size_t prev_cap_;
+};
+
+void ParallelFor(size_t n, const std::function<void(size_t)> &task, size_t max_threads) {
+    if (n == 0) return;
+    const size_t cap = GetThreadCap(max_threads);
+    size_t thread_num = std::min(n, cap);
+
+    if (thread_num == 1) {
+        for (size_t i = 0; i < n; ++i) task(i);
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::mutex err_mutex;
+    std::exception_ptr err;
+    std::atomic<uint64_t> *counters = GetThreadPrimitiveCounters();
+    // Each thread gets an equal share of the cap for the loops its tasks run
+    const size_t inner_cap = std::max<size_t>(1, cap / thread_num);
+    auto worker = [&]() {
+        SetThreadPrimitiveCounters(counters);
+        ThreadCapScope cap_scope(inner_cap);
+        size_t i;
+        while ((i = next.fetch_add(1)) < n) {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(err_mutex);
+                if (!err) err = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_num; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t: threads) t.join();
+
+    if (err) std::rethrow_exception(err);
+}
+
+bool ParallelForAll(size_t n, const std::function<bool(size_t)> &task, size_t &first_failed,
+                    size_t max_threads, uint64_t time_budget_ms) {
+    first_failed = n;
+    if (n == 0) return true;
+    const size_t cap = GetThreadCap(max_threads);
+    size_t thread_num = std::min(n, cap);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(time_budget_ms);
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> stop(false);
+    std::atomic<bool> timeout(false);
+    std::mutex mutex;
+    std::exception_ptr err;
+    std::atomic<uint64_t> *counters = GetThreadPrimitiveCounters();
+    // Each thread gets an equal share of the cap for the loops its tasks run
+    const size_t inner_cap = std::max<size_t>(1, cap / thread_num);
+    auto worker = [&]() {
+        SetThreadPrimitiveCounters(counters);
+        ThreadCapScope cap_scope(inner_cap);
+        while (!stop.load()) {
+            if (next.load() >= n) return;
+            if (time_budget_ms != 0 && std::chrono::steady_clock::now() >= deadline) {
+                timeout = true;
+                stop = true;
+                return;
+            }
+            size_t i = next.fetch_add(1);
+            if (i >= n) return;
+            bool ok = false;
+            try {
+                ok = task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(mutex);
+                if (!err) err = std::current_exception();
+                stop = true;
+                return;
+            }
+            if (!ok) {
+                std::lock_guard<std::mutex> lk(mutex);
+                if (i < first_failed) first_failed = i;
+                stop = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_num; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t: threads) t.join();
+
+    if (err) std::rethrow_exception(err);
+    return first_failed == n && !timeout.load();
+}
+
+} // safeheron
+} // mpc_flow
+} // common
@@ -0,0 +1,47 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PARALLEL_FOR_H
+#define SAFEHERON_MPC_FLOW_COMMON_PARALLEL_FOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Run task(i) for every i in [0, n) on up to max_threads threads. The calling thread takes part in the work and
+ * the function returns after all tasks are done. The first exception thrown by a task is rethrown to the caller.
+ *
+ * Tasks must only write to state owned by index i.
+ *
+ * Loops run by the tasks share the threads of this loop: each of its T threads may use cap / T threads (at least 1),
+ * where cap is max_threads, so nested loops stay within max_threads in total. The same holds for ParallelForAll().
+ *
+ * @param n number of tasks
+ * @param task task to run
+ * @param max_threads maximum number of threads, 0 means std::thread::hardware_concurrency().
+ */
+void ParallelFor(size_t n, const std::function<void(size_t)> &task, size_t max_threads = 0);
+
+/**
+ * Run task(i) for i in [0, n) on up to max_threads threads, until a task returns false or the time budget runs out.
+ *
+ * Tasks are started in increasing order of i and a started task always runs to the end, so when task(k) fails every
+ * task(i) with i < k has been run too. This keeps the result the same as a sequential loop.
+ *
+ * @param n number of tasks
+ * @param task task to run, returns false to stop the loop
+ * @param[out] first_failed the smallest i that task(i) returned false, or n if none failed.
+ * @param max_threads maximum number of threads, 0 means std::thread::hardware_concurrency().
+ * @param time_budget_ms no task is started after the time budget runs out, 0 means no limit.
+ * @return true if all the tasks were run and returned true.
+ */
+bool ParallelForAll(size_t n, const std::function<bool(size_t)> &task, size_t &first_failed,
+                    size_t max_threads = 0, uint64_t time_budget_ms = 0);
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PARALLEL_FOR_H
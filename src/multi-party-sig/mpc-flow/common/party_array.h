@@ -0,0 +1,139 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PARTY_ARRAY_H
+#define SAFEHERON_MPC_FLOW_COMMON_PARTY_ARRAY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Per party data is kept in arrays indexed by the dense position of the party, not in maps keyed by party id.
+ * Party ids are only used at the boundary: in messages and in the public API.
+ *
+ * The functions below convert between the two, given party_id_arr, the id of the party at each position.
+ */
+
+static const size_t NO_PARTY_POS = SIZE_MAX;
+
+/**
+ * Positions sorted by party id, i.e. the order in which a std::map keyed by party id is walked. Digests over per
+ * party data keep this order.
+ */
+inline void SortPartyPositions(const std::vector<std::string> &party_id_arr, std::vector<size_t> &pos_arr) {
+    pos_arr.resize(party_id_arr.size());
+    for (size_t i = 0; i < pos_arr.size(); ++i) pos_arr[i] = i;
+    std::sort(pos_arr.begin(), pos_arr.end(), [&party_id_arr](size_t a, size_t b) {
+        return party_id_arr[a] < party_id_arr[b];
+    });
+}
+
+/**
+ * Map keyed by party id => array indexed by position.
+ * @param skip_pos position with no entry in the map, e.g. the sender of a message, NO_PARTY_POS for none.
+ * @return false if the map doesn't have exactly one entry for each party but skip_pos.
+ */
+template<class T>
+bool PartyArrayFromMap(const std::map<std::string, T> &in, const std::vector<std::string> &party_id_arr,
+                       std::vector<T> &out, size_t skip_pos = NO_PARTY_POS) {
+    size_t expected_size = party_id_arr.size() - (skip_pos < party_id_arr.size() ? 1 : 0);
+    if (in.size() != expected_size) return false;
+    out.clear();
+    out.resize(party_id_arr.size());
+    for (size_t i = 0; i < party_id_arr.size(); ++i) {
+        if (i == skip_pos) continue;
+        auto iter = in.find(party_id_arr[i]);
+        if (iter == in.end()) return false;
+        out[i] = iter->second;
+    }
+    return true;
+}
+
+/**
+ * Array indexed by position => map keyed by party id.
+ * @param skip_pos position left out of the map, NO_PARTY_POS for none.
+ */
+template<class T>
+void PartyArrayToMap(const std::vector<T> &in, const std::vector<std::string> &party_id_arr,
+                     std::map<std::string, T> &out, size_t skip_pos = NO_PARTY_POS) {
+    out.clear();
+    for (size_t i = 0; i < party_id_arr.size() && i < in.size(); ++i) {
+        if (i == skip_pos) continue;
+        out[party_id_arr[i]] = in[i];
+    }
+}
+
+/**
+ * Values of pairs of parties, e.g. D_{i,j} of cmp sign, in one contiguous array. Cell (i, j) may be unset.
+ */
+template<class T>
+class PartyMatrix {
+public:
+    explicit PartyMatrix(size_t n = 0) : n_(n), cell_arr_(n * n), set_arr_(n * n, 0) {}
+
+    // Clear and resize to n x n
+    void Reset(size_t n) {
+        n_ = n;
+        cell_arr_.assign(n * n, T());
+        set_arr_.assign(n * n, 0);
+    }
+
+    size_t size() const { return n_; }
+
+    void Set(size_t i, size_t j, const T &value) {
+        cell_arr_[i * n_ + j] = value;
+        set_arr_[i * n_ + j] = 1;
+    }
+
+    bool Has(size_t i, size_t j) const { return set_arr_[i * n_ + j] != 0; }
+
+    const T &At(size_t i, size_t j) const { return cell_arr_[i * n_ + j]; }
+
+    /**
+     * Map of maps keyed by party id => matrix.
+     * @return false if a party id is unknown.
+     */
+    bool FromMap(const std::map<std::string, std::map<std::string, T>> &in,
+                 const std::vector<std::string> &party_id_arr) {
+        Reset(party_id_arr.size());
+        std::map<std::string, size_t> map_id_pos;
+        for (size_t i = 0; i < party_id_arr.size(); ++i) map_id_pos[party_id_arr[i]] = i;
+        for (const auto &row: in) {
+            auto iter_i = map_id_pos.find(row.first);
+            if (iter_i == map_id_pos.end()) return false;
+            for (const auto &cell: row.second) {
+                auto iter_j = map_id_pos.find(cell.first);
+                if (iter_j == map_id_pos.end()) return false;
+                Set(iter_i->second, iter_j->second, cell.second);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Matrix => map of maps keyed by party id, cells unset are left out.
+     */
+    void ToMap(const std::vector<std::string> &party_id_arr, std::map<std::string, std::map<std::string, T>> &out) const {
+        for (size_t i = 0; i < n_ && i < party_id_arr.size(); ++i) {
+            for (size_t j = 0; j < n_ && j < party_id_arr.size(); ++j) {
+                if (Has(i, j)) out[party_id_arr[i]][party_id_arr[j]] = At(i, j);
+            }
+        }
+    }
+
+private:
+    size_t n_;
+    std::vector<T> cell_arr_;
+    std::vector<char> set_arr_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PARTY_ARRAY_H
@@ -0,0 +1,62 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PARTY_INDEX_H
+#define SAFEHERON_MPC_FLOW_COMMON_PARTY_INDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Hash index from party id to the position of the party in a list, e.g. the remote parties of a sign key.
+ *
+ * Contexts build it once in CreateContext, so that a message is matched to its sender without scanning the list.
+ * If an id shows up more than once, the first position is kept, as a linear scan would find.
+ */
+class PartyIndex {
+public:
+    /**
+     * Index a list of parties.
+     * @param party_arr container of objects with a member party_id_
+     */
+    template<class PartyArr>
+    void Build(const PartyArr &party_arr) {
+        map_id_pos_.clear();
+        map_id_pos_.reserve(party_arr.size());
+        for (size_t i = 0; i < party_arr.size(); ++i) {
+            map_id_pos_.emplace(party_arr[i].party_id_, (int)i);
+        }
+    }
+
+    /**
+     * Index a list of party ids.
+     */
+    void Build(const std::vector<std::string> &party_id_arr) {
+        map_id_pos_.clear();
+        map_id_pos_.reserve(party_id_arr.size());
+        for (size_t i = 0; i < party_id_arr.size(); ++i) {
+            map_id_pos_.emplace(party_id_arr[i], (int)i);
+        }
+    }
+
+    /**
+     * @return position of the party, -1 if not found.
+     */
+    int Find(const std::string &party_id) const {
+        auto iter = map_id_pos_.find(party_id);
+        return iter == map_id_pos_.end() ? -1 : iter->second;
+    }
+
+    size_t Size() const { return map_id_pos_.size(); }
+
+private:
+    std::unordered_map<std::string, int> map_id_pos_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PARTY_INDEX_H
@@ -0,0 +1,62 @@
+#include <memory>
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
+#include "multi-party-sig/mpc-flow/common/secure_zero.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+// The arena of a thread and the block it keeps
+class ThreadProtoArena {
+public:
+    ThreadProtoArena() : block_(new char[ProtoArenaScope::INITIAL_BLOCK_SIZE]), depth_(0) {
+        NewArena();
+    }
+
+    ~ThreadProtoArena() {
+        arena_.reset();
+        SecureZero(block_.get(), ProtoArenaScope::INITIAL_BLOCK_SIZE);
+    }
+
+    google::protobuf::Arena *Enter() {
+        depth_++;
+        return arena_.get();
+    }
+
+    void Leave() {
+        if (--depth_ > 0) return;
+        // The arena keeps its own state in the block, so it is made again rather than Reset()
+        arena_.reset();
+        SecureZero(block_.get(), ProtoArenaScope::INITIAL_BLOCK_SIZE);
+        NewArena();
+    }
+
+private:
+    void NewArena() {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block_.get();
+        options.initial_block_size = ProtoArenaScope::INITIAL_BLOCK_SIZE;
+        arena_.reset(new google::protobuf::Arena(options));
+    }
+
+private:
+    std::unique_ptr<char[]> block_;
+    std::unique_ptr<google::protobuf::Arena> arena_;
+    int depth_;
+};
+
+static ThreadProtoArena &GetThreadProtoArena() {
+    static thread_local ThreadProtoArena thread_arena;
+    return thread_arena;
+}
+
+ProtoArenaScope::ProtoArenaScope() : arena_(GetThreadProtoArena().Enter()) {
+}
+
+ProtoArenaScope::~ProtoArenaScope() {
+    GetThreadProtoArena().Leave();
+}
+
+} // safeheron
+} // mpc_flow
+} // common
@@ -0,0 +1,53 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_PROTO_ARENA_H
+#define SAFEHERON_MPC_FLOW_COMMON_PROTO_ARENA_H
+
+#include <cstddef>
+#include <google/protobuf/arena.h>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Protobuf messages made on a google::protobuf::Arena of the calling thread, for encoding and decoding.
+ *
+ * A message and all its sub-messages are allocated by bumping a pointer instead of one malloc per field, and are
+ * freed at once when the outermost scope of the thread ends. The first block of the arena is kept, zeroized, for the
+ * next message, so a round encoding or decoding message after message does not go back to malloc.
+ *
+ * Scopes may be nested, e.g. a key encoded while a message is encoded: only the outermost one resets the arena.
+ * Messages made in a scope must not be used once it ends.
+ *
+ * Usage:
+ *     ProtoArenaScope arena_scope;
+ *     ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
+ */
+class ProtoArenaScope {
+public:
+    // Size of the block kept between messages
+    static const size_t INITIAL_BLOCK_SIZE = 16 * 1024;
+
+    ProtoArenaScope();
+
+    ~ProtoArenaScope();
+
+    ProtoArenaScope(const ProtoArenaScope &) = delete;
+
+    ProtoArenaScope &operator=(const ProtoArenaScope &) = delete;
+
+    template<typename T>
+    T *Create() {
+        return google::protobuf::Arena::CreateMessage<T>(arena_);
+    }
+
+    google::protobuf::Arena *arena() const { return arena_; }
+
+private:
+    google::protobuf::Arena *arena_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_PROTO_ARENA_H
@@ -0,0 +1,16 @@
+#include <cstdint>
+#include "multi-party-sig/mpc-flow/common/secure_zero.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+void SecureZero(void *ptr, size_t size) {
+    if (!ptr || size == 0) return;
+    volatile uint8_t *p = static_cast<volatile uint8_t *>(ptr);
+    while (size--) *p++ = 0;
+}
+
+} // safeheron
+} // mpc_flow
+} // common
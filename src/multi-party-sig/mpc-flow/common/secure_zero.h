@@ -0,0 +1,19 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_SECURE_ZERO_H
+#define SAFEHERON_MPC_FLOW_COMMON_SECURE_ZERO_H
+
+#include <cstddef>
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Overwrite the memory with zeros, in a way the compiler does not remove.
+ */
+void SecureZero(void *ptr, size_t size);
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_SECURE_ZERO_H
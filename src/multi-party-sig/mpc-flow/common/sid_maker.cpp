@@ -9,21 +9,17 @@ namespace mpc_flow {
 namespace common {
 
 SIDMaker& SIDMaker::Append(const safeheron::bignum::BN &num){
-    std::string buf;
-    num.ToBytesBE(buf);
-    sha.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript_.Append(num);
     return *this;
 }
 
 SIDMaker& SIDMaker::Append(const safeheron::curve::CurvePoint &point){
-    std::string buf;
-    point.EncodeFull(buf);
-    sha.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript_.Append(point);
     return *this;
 }
 
 SIDMaker& SIDMaker::Append(const std::string &str){
-    sha.Write(reinterpret_cast<const unsigned char *>(str.c_str()), str.size());
+    transcript_.Append(str);
     return *this;
 }
 
@@ -4,6 +4,7 @@
 #include "crypto-suites/crypto-bn/bn.h"
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-hash/safe_hash256.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
 
 namespace safeheron {
 namespace mpc_flow {
@@ -12,7 +13,10 @@ namespace common {
 class SIDMaker{
 private:
     safeheron::hash::CSafeHash256 sha;
+    TranscriptWriter<safeheron::hash::CSafeHash256> transcript_;
 public:
+    SIDMaker() : transcript_(sha) {}
+
     static const size_t OUTPUT_SIZE = safeheron::hash::CSafeHash256::OUTPUT_SIZE;
 
     SIDMaker& Append(const safeheron::bignum::BN &num);
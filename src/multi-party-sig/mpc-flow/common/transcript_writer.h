@@ -0,0 +1,85 @@
+#ifndef SAFEHERON_MPC_FLOW_COMMON_TRANSCRIPT_WRITER_H
+#define SAFEHERON_MPC_FLOW_COMMON_TRANSCRIPT_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+
+namespace safeheron {
+namespace mpc_flow {
+namespace common {
+
+/**
+ * Writes the fields of a transcript, e.g. of a commitment or a session id, into a hasher such as CSafeHash256 or
+ * CSHA256.
+ *
+ * Each field is one Write() with the encoding the protocols have always used: BN::ToBytesBE for numbers and
+ * CurvePoint::EncodeFull for points. Positive numbers of up to 256 bits, e.g. indexes and scalars, are encoded in a
+ * buffer on the stack.
+ *
+ * Limit: points, and numbers longer than 256 bits such as Paillier moduli, ring-Pedersen parameters and proof values,
+ * still go through a string, because crypto-suites only encodes them into a std::string. This writer reuses one
+ * scratch string for all of them, whose capacity is kept from one field to the next, so a transcript costs a few
+ * allocations while the scratch grows instead of one per field, but not zero.
+ *
+ * Usage:
+ *     CSafeHash256 sha256;
+ *     TranscriptWriter<CSafeHash256> transcript(sha256);
+ *     transcript.Append(ssid).Append(index).Append(X);
+ */
+template<class Hasher>
+class TranscriptWriter {
+public:
+    explicit TranscriptWriter(Hasher &hasher) : hasher_(hasher) {}
+
+    TranscriptWriter(const TranscriptWriter &) = delete;
+
+    TranscriptWriter &operator=(const TranscriptWriter &) = delete;
+
+    TranscriptWriter &Append(const safeheron::bignum::BN &num) {
+        if (num > 0 && num.BitLength() <= 256) {
+            // ToBytesBE without the leading zeros of the 32 bytes
+            uint8_t buf32[32];
+            num.ToBytes32BE(buf32);
+            size_t skip = 32 - (num.BitLength() + 7) / 8;
+            hasher_.Write(buf32 + skip, 32 - skip);
+            return *this;
+        }
+        num.ToBytesBE(scratch_);
+        hasher_.Write(reinterpret_cast<const unsigned char *>(scratch_.c_str()), scratch_.size());
+        return *this;
+    }
+
+    TranscriptWriter &Append(const safeheron::curve::CurvePoint &point) {
+        point.EncodeFull(scratch_);
+        hasher_.Write(reinterpret_cast<const unsigned char *>(scratch_.c_str()), scratch_.size());
+        return *this;
+    }
+
+    TranscriptWriter &Append(const std::string &str) {
+        hasher_.Write(reinterpret_cast<const unsigned char *>(str.c_str()), str.size());
+        return *this;
+    }
+
+    TranscriptWriter &Append(const char *str) {
+        hasher_.Write(reinterpret_cast<const unsigned char *>(str), std::char_traits<char>::length(str));
+        return *this;
+    }
+
+    TranscriptWriter &Append(const unsigned char *data, size_t len) {
+        hasher_.Write(data, len);
+        return *this;
+    }
+
+private:
+    Hasher &hasher_;
+    std::string scratch_;
+};
+
+} // safeheron
+} // mpc_flow
+} // common
+
+#endif //SAFEHERON_MPC_FLOW_COMMON_TRANSCRIPT_WRITER_H
@@ -0,0 +1,140 @@
+#include <memory>
+#include <utility>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/async_mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+AsyncMPCContext::AsyncMPCContext(MPCContext *ctx, safeheron::mpc_flow::common::Executor *executor)
+        : ctx_(ctx), executor_(executor), running_(false), driver_(ctx), started_(false), done_(false),
+          ok_(true), finished_(false), cur_round_(0) {
+}
+
+AsyncMPCContext::~AsyncMPCContext() {
+    Wait();
+}
+
+void AsyncMPCContext::Post(std::function<void()> task) {
+    bool start = false;
+    {
+        std::lock_guard<std::mutex> lk(task_mutex_);
+        task_queue_.push_back(std::move(task));
+        if (!running_) {
+            running_ = true;
+            start = true;
+        }
+    }
+    if (start) executor_->Post([this] { Drain(); });
+}
+
+void AsyncMPCContext::Drain() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lk(task_mutex_);
+            if (task_queue_.empty()) {
+                running_ = false;
+                task_cv_.notify_all();
+                return;
+            }
+            task = std::move(task_queue_.front());
+            task_queue_.pop_front();
+        }
+        task();
+        UpdateStatus();
+    }
+}
+
+void AsyncMPCContext::Wait() {
+    std::unique_lock<std::mutex> lk(task_mutex_);
+    task_cv_.wait(lk, [this] { return !running_ && task_queue_.empty(); });
+}
+
+void AsyncMPCContext::StartAsync(CompletionCallback callback) {
+    Post([this, callback] {
+        if (started_ || done_) {
+            if (callback) callback(false);
+            return;
+        }
+        started_ = true;
+        std::vector<OutboundMessages> outbox;
+        bool ok = driver_.Start(outbox);
+        if (callback) callback(ok);
+        Deliver(ok, outbox);
+    });
+}
+
+std::future<bool> AsyncMPCContext::StartFuture() {
+    std::shared_ptr<std::promise<bool>> promise(new std::promise<bool>());
+    std::future<bool> future = promise->get_future();
+    StartAsync([promise](bool ok) { promise->set_value(ok); });
+    return future;
+}
+
+void AsyncMPCContext::PushMessageAsync(std::string p2p_msg, std::string bc_msg, std::string party_id,
+                                       int round_index_of_message, CompletionCallback callback) {
+    std::shared_ptr<ContextDriver::Incoming> msg(new ContextDriver::Incoming());
+    msg->src_ = std::move(party_id);
+    msg->round_ = round_index_of_message;
+    msg->p2p_msg_ = std::move(p2p_msg);
+    msg->bc_msg_ = std::move(bc_msg);
+    msg->callback_ = std::move(callback);
+    Post([this, msg] {
+        driver_.Hold(std::move(*msg));
+        if (!started_ || done_) return;
+        std::vector<OutboundMessages> outbox;
+        bool ok = driver_.Step(outbox);
+        Deliver(ok, outbox);
+    });
+}
+
+std::future<bool> AsyncMPCContext::PushMessageFuture(std::string p2p_msg, std::string bc_msg, std::string party_id,
+                                                     int round_index_of_message) {
+    std::shared_ptr<std::promise<bool>> promise(new std::promise<bool>());
+    std::future<bool> future = promise->get_future();
+    PushMessageAsync(std::move(p2p_msg), std::move(bc_msg), std::move(party_id), round_index_of_message,
+                     [promise](bool ok) { promise->set_value(ok); });
+    return future;
+}
+
+void AsyncMPCContext::Deliver(bool ok, const std::vector<OutboundMessages> &outbox) {
+    if (!ok || driver_.IsFinished()) done_ = true;
+    UpdateStatus();
+    if (messages_ready_callback_) {
+        for (const auto &out: outbox) messages_ready_callback_(out);
+    }
+    if (done_ && finished_callback_) finished_callback_(ok);
+}
+
+void AsyncMPCContext::UpdateStatus() {
+    std::lock_guard<std::mutex> lk(status_mutex_);
+    ok_ = ctx_->IsOK();
+    finished_ = ctx_->IsFinished();
+    cur_round_ = ctx_->get_cur_round();
+    error_info_ = ctx_->get_last_error_info();
+}
+
+bool AsyncMPCContext::IsOK() const {
+    std::lock_guard<std::mutex> lk(status_mutex_);
+    return ok_;
+}
+
+bool AsyncMPCContext::IsFinished() const {
+    std::lock_guard<std::mutex> lk(status_mutex_);
+    return finished_;
+}
+
+int AsyncMPCContext::get_cur_round() const {
+    std::lock_guard<std::mutex> lk(status_mutex_);
+    return cur_round_;
+}
+
+std::string AsyncMPCContext::get_last_error_info() const {
+    std::lock_guard<std::mutex> lk(status_mutex_);
+    return error_info_;
+}
+
+}
+}
+}
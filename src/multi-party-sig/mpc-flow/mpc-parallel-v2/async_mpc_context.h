@@ -0,0 +1,157 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_ASYNC_MPC_CONTEXT_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_ASYNC_MPC_CONTEXT_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/common/executor.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/context_driver.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Messages of a round, as returned by MPCContext::PopMessages().
+ */
+typedef ContextDriver::Outgoing OutboundMessages;
+
+/**
+ * Drive an MPCContext without blocking the caller.
+ *
+ * PushMessage() of a context runs ReceiveVerify() of the message, and on the last message of a round
+ * ComputeVerify() and MakeMessage() too, which may take hundreds of milliseconds. Here the calls return at once and
+ * the work is queued to an executor; the result comes back through a callback or a future. The work of one context
+ * is run one task at a time, in the order it was queued, so many contexts can share one executor and one I/O thread.
+ *
+ * Messages may be pushed as soon as they arrive: they are routed by a ContextDriver, so a message of a round the
+ * context has not reached yet is kept until the context gets there, and a message of a round the context is already
+ * past is dropped. When a round is finished its messages are popped and handed to the messages ready callback.
+ *
+ * Usage:
+ *      ThreadPoolExecutor executor(8);
+ *      AsyncMPCContext async_ctx(&ctx, &executor);
+ *      async_ctx.set_messages_ready_callback([&](const OutboundMessages &out) { send(out); });
+ *      async_ctx.set_finished_callback([&](bool ok) { ... });
+ *      async_ctx.StartAsync();
+ *      // On the I/O thread, for every message received
+ *      async_ctx.PushMessageAsync(p2p_msg, bc_msg, party_id, round);
+ *
+ * Callbacks are called on a thread of the executor, never two of one context at the same time. They may push more
+ * messages, but must not destroy the AsyncMPCContext.
+ */
+class AsyncMPCContext {
+public:
+    // ok: whether the context took the message, or started
+    typedef std::function<void(bool ok)> CompletionCallback;
+    typedef std::function<void(const OutboundMessages &out)> MessagesReadyCallback;
+    // ok: false if the context failed
+    typedef std::function<void(bool ok)> FinishedCallback;
+
+    /**
+     * Constructor
+     * @param ctx a context created but not started, not owned.
+     * @param executor not owned, must outlive this object.
+     */
+    AsyncMPCContext(MPCContext *ctx, safeheron::mpc_flow::common::Executor *executor);
+
+    /**
+     * Waits for the work queued to be done.
+     */
+    ~AsyncMPCContext();
+
+    AsyncMPCContext(const AsyncMPCContext &) = delete;
+
+    AsyncMPCContext &operator=(const AsyncMPCContext &) = delete;
+
+    // Set before starting the context
+    void set_messages_ready_callback(MessagesReadyCallback callback) { messages_ready_callback_ = std::move(callback); }
+
+    // Set before starting the context
+    void set_finished_callback(FinishedCallback callback) { finished_callback_ = std::move(callback); }
+
+    /**
+     * Start the context, as MPCContext::PushMessage().
+     */
+    void StartAsync(CompletionCallback callback = nullptr);
+
+    std::future<bool> StartFuture();
+
+    /**
+     * Push a message, as MPCContext::PushMessage(p2p_msg, bc_msg, party_id, round_index_of_message).
+     * The callback is called once the context took the message, which may be after some other messages if it is
+     * of a later round. A message dropped as too late gets the status of the context.
+     */
+    void PushMessageAsync(std::string p2p_msg, std::string bc_msg, std::string party_id, int round_index_of_message,
+                          CompletionCallback callback = nullptr);
+
+    std::future<bool> PushMessageFuture(std::string p2p_msg, std::string bc_msg, std::string party_id,
+                                        int round_index_of_message);
+
+    /**
+     * Block until the work queued so far is done.
+     */
+    void Wait();
+
+    // The following are safe to call from any thread.
+
+    bool IsOK() const;
+
+    bool IsFinished() const;
+
+    int get_cur_round() const;
+
+    std::string get_last_error_info() const;
+
+    /**
+     * The context, not to be touched while work is queued.
+     */
+    MPCContext *get_context() const { return ctx_; }
+
+private:
+    // Queue a task of this context
+    void Post(std::function<void()> task);
+
+    // Run the queued tasks one after another
+    void Drain();
+
+    // Hand the messages of the rounds the driver finished over, then report the end of the context
+    void Deliver(bool ok, const std::vector<OutboundMessages> &outbox);
+
+    void UpdateStatus();
+
+private:
+    MPCContext *ctx_;
+    safeheron::mpc_flow::common::Executor *executor_;
+    MessagesReadyCallback messages_ready_callback_;
+    FinishedCallback finished_callback_;
+
+    // Tasks of the context
+    std::mutex task_mutex_;
+    std::condition_variable task_cv_;
+    std::deque<std::function<void()>> task_queue_;
+    bool running_;
+
+    // Touched by the tasks only
+    ContextDriver driver_;
+    bool started_;
+    bool done_;
+
+    // Status of the context for other threads
+    mutable std::mutex status_mutex_;
+    bool ok_;
+    bool finished_;
+    int cur_round_;
+    std::string error_info_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_ASYNC_MPC_CONTEXT_H
@@ -0,0 +1,183 @@
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+
+using safeheron::mpc_flow::common::ParallelFor;
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+BatchMPCContext::BatchMPCContext(std::vector<MPCContext *> ctx_arr, size_t max_threads)
+        : ctx_arr_(std::move(ctx_arr)), max_threads_(max_threads) {
+}
+
+int BatchMPCContext::IsCurRoundFinished() const {
+    for (const auto &ctx: ctx_arr_) {
+        if (!ctx->IsCurRoundFinished()) return false;
+    }
+    return true;
+}
+
+int BatchMPCContext::IsFinished() const {
+    for (const auto &ctx: ctx_arr_) {
+        if (!ctx->IsFinished()) return false;
+    }
+    return true;
+}
+
+bool BatchMPCContext::PushMessage() {
+    std::vector<char> ok_arr(ctx_arr_.size(), 0);
+    ParallelFor(ctx_arr_.size(), [this, &ok_arr](size_t i) {
+        ok_arr[i] = ctx_arr_[i]->PushMessage() ? 1 : 0;
+    }, max_threads_);
+    CollectErrors(ok_arr);
+    return IsOK();
+}
+
+bool BatchMPCContext::PushMessage(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id, int round_index_of_message) {
+    std::vector<std::string> p2p_msg_arr;
+    std::vector<std::string> bc_msg_arr;
+    bool ok = DecodeMessages(p2p_msg, p2p_msg_arr) && DecodeMessages(bc_msg, bc_msg_arr);
+    if (!ok) {
+        PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to decode batch message from party: " + party_id);
+        return false;
+    }
+    // Empty message means the round has no such message.
+    if (p2p_msg_arr.empty()) p2p_msg_arr.resize(ctx_arr_.size());
+    if (bc_msg_arr.empty()) bc_msg_arr.resize(ctx_arr_.size());
+    if (p2p_msg_arr.size() != ctx_arr_.size() || bc_msg_arr.size() != ctx_arr_.size()) {
+        PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Size of batch message doesn't match the batch, party: " + party_id);
+        return false;
+    }
+
+    std::vector<char> ok_arr(ctx_arr_.size(), 0);
+    ParallelFor(ctx_arr_.size(), [&](size_t i) {
+        ok_arr[i] = ctx_arr_[i]->PushMessage(p2p_msg_arr[i], bc_msg_arr[i], party_id, round_index_of_message) ? 1 : 0;
+    }, max_threads_);
+    CollectErrors(ok_arr);
+    return IsOK();
+}
+
+bool BatchMPCContext::PopMessages(std::vector<std::string> &out_p2p_msg_arr, std::string &out_broadcast_msg, std::vector<std::string> &out_des_arr) {
+    out_p2p_msg_arr.clear();
+    out_broadcast_msg.clear();
+    out_des_arr.clear();
+    if (ctx_arr_.empty()) return true;
+
+    std::vector<std::string> bc_msg_arr;
+    // destination => messages of all contexts
+    std::map<std::string, std::vector<std::string>> p2p_msg_map;
+    bool has_p2p = false;
+    bool has_bc = false;
+    for (size_t i = 0; i < ctx_arr_.size(); ++i) {
+        std::vector<std::string> p2p_msg_arr;
+        std::string bc_msg;
+        std::vector<std::string> des_arr;
+        bool ok = ctx_arr_[i]->PopMessages(p2p_msg_arr, bc_msg, des_arr);
+        if (!ok) {
+            std::vector<char> ok_arr(ctx_arr_.size(), 1);
+            ok_arr[i] = 0;
+            CollectErrors(ok_arr);
+            return false;
+        }
+        if (i == 0) out_des_arr = des_arr;
+        if (des_arr.size() != out_des_arr.size()) {
+            PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Contexts in the batch have different parties!");
+            return false;
+        }
+        has_p2p = has_p2p || !p2p_msg_arr.empty();
+        has_bc = has_bc || !bc_msg.empty();
+        for (size_t j = 0; j < p2p_msg_arr.size(); ++j) {
+            p2p_msg_map[des_arr[j]].push_back(p2p_msg_arr[j]);
+        }
+        bc_msg_arr.push_back(bc_msg);
+    }
+
+    if (has_bc) EncodeMessages(bc_msg_arr, out_broadcast_msg);
+    if (has_p2p) {
+        for (const auto &des: out_des_arr) {
+            const auto iter = p2p_msg_map.find(des);
+            if (iter == p2p_msg_map.end() || iter->second.size() != ctx_arr_.size()) {
+                PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Contexts in the batch have different parties!");
+                return false;
+            }
+            out_p2p_msg_arr.emplace_back();
+            EncodeMessages(iter->second, out_p2p_msg_arr.back());
+        }
+    }
+    return true;
+}
+
+int BatchMPCContext::get_last_error_code() const {
+    if (error_info_stack_.empty()) return 0;
+    return error_info_stack_.back().code_;
+}
+
+const char *BatchMPCContext::get_last_error_info() const {
+    if (error_info_stack_.empty()) return "";
+    return error_info_stack_.back().info_.c_str();
+}
+
+void BatchMPCContext::get_error_stack(std::vector<ErrorInfo> &error_stack) const {
+    for (const auto &err: error_info_stack_) {
+        error_stack.push_back(err);
+    }
+}
+
+void BatchMPCContext::EncodeMessages(const std::vector<std::string> &msg_arr, std::string &out) {
+    out.clear();
+    for (const auto &msg: msg_arr) {
+        out.append(std::to_string(msg.size()));
+        out.push_back(':');
+        out.append(msg);
+        out.push_back(',');
+    }
+}
+
+bool BatchMPCContext::DecodeMessages(const std::string &in, std::vector<std::string> &msg_arr) {
+    msg_arr.clear();
+    size_t pos = 0;
+    while (pos < in.size()) {
+        size_t len = 0;
+        size_t digits = 0;
+        while (pos < in.size() && in[pos] >= '0' && in[pos] <= '9') {
+            if (digits++ >= 10) return false;
+            len = len * 10 + (in[pos] - '0');
+            pos++;
+        }
+        if (digits == 0 || pos >= in.size() || in[pos] != ':') return false;
+        pos++;
+        if (in.size() - pos < len + 1 || in[pos + len] != ',') return false;
+        msg_arr.emplace_back(in, pos, len);
+        pos += len + 1;
+    }
+    return true;
+}
+
+void BatchMPCContext::PushErrorCode(int error_code, const std::string &file_name, int line_num, const std::string &func_name,
+                                    const std::string &error_info) {
+    ErrorInfo error;
+    error.code_ = error_code;
+    error.info_ = file_name + ":" + std::to_string(line_num) + ":" + func_name + ":" + error_info;
+    error_info_stack_.push_back(error);
+}
+
+void BatchMPCContext::CollectErrors(const std::vector<char> &ok_arr) {
+    for (size_t i = 0; i < ok_arr.size(); ++i) {
+        if (ok_arr[i]) continue;
+        std::vector<ErrorInfo> error_stack;
+        ctx_arr_[i]->get_error_stack(error_stack);
+        for (const auto &err: error_stack) {
+            error_info_stack_.push_back(err);
+        }
+        PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Context " + std::to_string(i) + " in the batch failed!");
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,82 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_BATCH_MPC_CONTEXT_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_BATCH_MPC_CONTEXT_H
+
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Run a batch of contexts of the same protocol among the same set of parties as one protocol run.
+ *
+ * In each round the messages of all contexts to one party are packed into a single message, so the number of
+ * messages exchanged is the same as in a single run, whatever the size of the batch. Contexts of a batch are
+ * computed in parallel.
+ *
+ * The contexts are not owned by the batch, and every party must put its contexts in the same order, e.g. sorted by
+ * wallet. The interface mirrors MPCContext.
+ */
+class BatchMPCContext {
+public:
+    /**
+     * Constructor
+     * @param ctx_arr contexts, all created and not started yet.
+     * @param max_threads maximum number of threads computing the contexts, 0 means std::thread::hardware_concurrency().
+     *                    Parallel loops inside the contexts share these threads, see ParallelFor().
+     */
+    explicit BatchMPCContext(std::vector<MPCContext *> ctx_arr, size_t max_threads = 0);
+
+    bool PushMessage(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id, int round_index_of_message);
+
+    bool PushMessage();
+
+    bool PopMessages(std::vector<std::string> &out_p2p_msg_arr, std::string &out_broadcast_msg, std::vector<std::string> &out_des_arr);
+
+    size_t size() const { return ctx_arr_.size(); }
+
+    MPCContext *get_context(size_t i) const { return ctx_arr_[i]; }
+
+    int get_cur_round() const { return ctx_arr_.empty() ? 0 : ctx_arr_[0]->get_cur_round(); }
+
+    int get_total_rounds() const { return ctx_arr_.empty() ? 0 : ctx_arr_[0]->get_total_rounds(); }
+
+    int IsOK() const { return get_last_error_code() == 0; }
+
+    int IsCurRoundFinished() const;
+
+    int IsFinished() const;
+
+    int get_last_error_code() const;
+
+    const char *get_last_error_info() const;
+
+    void get_error_stack(std::vector<ErrorInfo> &error_stack) const;
+
+    /**
+     * Pack messages of the contexts into one message. Each message is encoded as "<length>:<bytes>,".
+     */
+    static void EncodeMessages(const std::vector<std::string> &msg_arr, std::string &out);
+
+    static bool DecodeMessages(const std::string &in, std::vector<std::string> &msg_arr);
+
+private:
+    void PushErrorCode(int error_code, const std::string &file_name, int line_num, const std::string &func_name,
+                       const std::string &error_info);
+
+    // Collect error information of the failed contexts.
+    void CollectErrors(const std::vector<char> &ok_arr);
+
+private:
+    std::vector<MPCContext *> ctx_arr_;
+    size_t max_threads_;
+    std::vector<ErrorInfo> error_info_stack_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_BATCH_MPC_CONTEXT_H
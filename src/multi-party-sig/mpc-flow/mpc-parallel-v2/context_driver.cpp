@@ -0,0 +1,77 @@
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/context_driver.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+bool ContextDriver::Start(std::vector<Outgoing> &outbox) {
+    if (!ctx_->PushMessage()) {
+        error_info_ = ctx_->get_last_error_info();
+        DropPending(false);
+        return false;
+    }
+    return Step(outbox);
+}
+
+void ContextDriver::Hold(Incoming &&msg) {
+    // Nobody takes it any more
+    if (ctx_->IsFinished() || !ctx_->IsOK() || msg.round_ < popped_rounds_ - 1) {
+        if (msg.callback_) msg.callback_(ctx_->IsOK());
+        return;
+    }
+    pending_[msg.round_].push_back(std::move(msg));
+}
+
+bool ContextDriver::Step(std::vector<Outgoing> &outbox) {
+    for (;;) {
+        // Pop the messages of the round just finished
+        if (ctx_->IsCurRoundFinished() && popped_rounds_ == ctx_->get_cur_round()) {
+            Outgoing out;
+            out.round_ = ctx_->get_cur_round();
+            if (!ctx_->PopMessages(out.p2p_msg_arr_, out.bc_msg_, out.des_arr_)) {
+                error_info_ = ctx_->get_last_error_info();
+                DropPending(false);
+                return false;
+            }
+            popped_rounds_++;
+            outbox.push_back(std::move(out));
+            if (ctx_->IsFinished()) {
+                DropPending(true);
+                return true;
+            }
+        }
+
+        // The context takes the messages of the last round popped
+        auto iter = pending_.find(popped_rounds_ - 1);
+        if (iter == pending_.end()) return true;
+        std::vector<Incoming> msg_arr;
+        msg_arr.swap(iter->second);
+        pending_.erase(iter);
+        for (size_t i = 0; i < msg_arr.size(); ++i) {
+            const Incoming &msg = msg_arr[i];
+            bool ok = ctx_->PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.src_, msg.round_);
+            if (msg.callback_) msg.callback_(ok);
+            if (!ok) {
+                error_info_ = ctx_->get_last_error_info();
+                for (size_t j = i + 1; j < msg_arr.size(); ++j) {
+                    if (msg_arr[j].callback_) msg_arr[j].callback_(false);
+                }
+                DropPending(false);
+                return false;
+            }
+        }
+    }
+}
+
+void ContextDriver::DropPending(bool ok) {
+    for (auto &pair: pending_) {
+        for (auto &msg: pair.second) {
+            if (msg.callback_) msg.callback_(ok);
+        }
+    }
+    pending_.clear();
+}
+
+}
+}
+}
@@ -0,0 +1,94 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_CONTEXT_DRIVER_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_CONTEXT_DRIVER_H
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Routes the messages of one party into and out of its context: messages of a round the context is not ready for are
+ * held back, and the messages of every round the context finishes are popped. Moving the messages between parties is
+ * left to the transport, e.g. MPCSimulator or ShmTransport.
+ *
+ * Usage:
+ *      ContextDriver driver(&ctx);
+ *      std::vector<ContextDriver::Outgoing> outbox;
+ *      bool ok = driver.Start(outbox);
+ *      while (ok && !driver.IsFinished()) {
+ *          // Send the messages in outbox, receive a message
+ *          driver.Hold(std::move(incoming));
+ *          outbox.clear();
+ *          ok = driver.Step(outbox);
+ *      }
+ */
+class ContextDriver {
+public:
+    struct Incoming {
+        std::string src_;
+        int round_;
+        std::string p2p_msg_;
+        std::string bc_msg_;
+        // Optional, called once the context took the message. ok: false if the context rejected the message or
+        // failed. A message dropped because it came too late gets the status of the context.
+        std::function<void(bool ok)> callback_;
+    };
+
+    struct Outgoing {
+        int round_;
+        std::vector<std::string> p2p_msg_arr_;
+        std::string bc_msg_;
+        std::vector<std::string> des_arr_;
+    };
+
+    /**
+     * @param ctx a context created but not started. Not owned by the driver.
+     */
+    explicit ContextDriver(MPCContext *ctx): ctx_(ctx), popped_rounds_(0) {}
+
+    /**
+     * Start the context, then Step().
+     */
+    bool Start(std::vector<Outgoing> &outbox);
+
+    /**
+     * Keep a message until the context takes it in Step(). Messages coming after the context finished or failed, or
+     * of a round the context is already past, are dropped.
+     */
+    void Hold(Incoming &&msg);
+
+    /**
+     * Run the context as far as the messages held allow, appending the messages of every round it finishes to outbox.
+     * @return false if the context failed, see get_error_info().
+     */
+    bool Step(std::vector<Outgoing> &outbox);
+
+    bool IsFinished() const { return ctx_->IsFinished(); }
+
+    MPCContext *get_context() const { return ctx_; }
+
+    const std::string &get_error_info() const { return error_info_; }
+
+private:
+    // Drop the messages held, calling their callbacks with ok
+    void DropPending(bool ok);
+
+private:
+    MPCContext *ctx_;
+    // round -> messages not taken by the context yet
+    std::map<int, std::vector<Incoming>> pending_;
+    // Rounds whose messages were popped
+    int popped_rounds_;
+    std::string error_info_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_CONTEXT_DRIVER_H
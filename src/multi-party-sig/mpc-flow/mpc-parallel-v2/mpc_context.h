@@ -10,6 +10,7 @@
 #include <vector>
 #include <cassert>
 #include <iostream>
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_round.h"
 
 namespace safeheron{
@@ -30,7 +31,7 @@ enum class Role : uint32_t {
 
 class MPCContext {
 public:
-    MPCContext(int total_parties): total_parties_(total_parties), current_round_(0) {};
+    MPCContext(int total_parties): total_parties_(total_parties), current_round_(0), metrics_sink_(nullptr) {};
     virtual ~MPCContext() = default;;
 
 private:
@@ -72,6 +73,20 @@ public:
     virtual void PushErrorCode(int error_code, const std::string &file_name, int line_num, const std::string &func_name,
                        const std::string &error_info);
 
+    /**
+     * Report the time spent in each stage of each round, and the primitives counted in it, to the sink.
+     * @param sink not owned by the context, nullptr to turn metrics off.
+     * @param session_id id of the session in the metrics.
+     */
+    void set_metrics_sink(safeheron::mpc_flow::common::MetricsSink *sink, const std::string &session_id = std::string()) {
+        metrics_sink_ = sink;
+        session_id_ = session_id;
+    }
+
+    safeheron::mpc_flow::common::MetricsSink *get_metrics_sink() const { return metrics_sink_; }
+
+    const std::string &get_session_id() const { return session_id_; }
+
 
 private:
     // If there is some thing wrong in the round, information of the error will be show by '_error'
@@ -80,6 +95,9 @@ private:
     int total_parties_;
     int current_round_;
     std::vector<MPCRound *> round_arr_;
+    // Metrics
+    safeheron::mpc_flow::common::MetricsSink *metrics_sink_;
+    std::string session_id_;
 };
 
 }
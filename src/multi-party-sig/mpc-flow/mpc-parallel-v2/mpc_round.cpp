@@ -3,16 +3,47 @@
 //
 
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_round.h"
+#include <chrono>
 #include <string>
 #include <vector>
 #include <cassert>
 #include <iostream>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 
 namespace safeheron{
 namespace mpc_flow{
 namespace mpc_parallel_v2{
 
-class MPCContext;
+using safeheron::mpc_flow::common::Stage;
+using safeheron::mpc_flow::common::StageMetrics;
+using safeheron::mpc_flow::common::MetricsSink;
+using safeheron::mpc_flow::common::PrimitiveCounterScope;
+using safeheron::mpc_flow::common::Primitive;
+using safeheron::mpc_flow::common::PRIMITIVE_NUM;
+
+template <typename F>
+bool MPCRound::RunStage(Stage stage, F func) {
+    MetricsSink *sink = ctx_ ? ctx_->get_metrics_sink() : nullptr;
+    if (!sink) return func();
+
+    StageMetrics metrics;
+    bool ok;
+    {
+        PrimitiveCounterScope counter_scope;
+        auto start = std::chrono::steady_clock::now();
+        ok = func();
+        auto end = std::chrono::steady_clock::now();
+        metrics.elapsed_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        for (size_t p = 0; p < PRIMITIVE_NUM; ++p) {
+            metrics.primitive_count_[p] = counter_scope.get_count(static_cast<Primitive>(p));
+        }
+    }
+    metrics.session_id_ = ctx_->get_session_id();
+    metrics.round_index_ = round_index_;
+    metrics.stage_ = stage;
+    sink->OnStage(metrics);
+    return ok;
+}
 
 std::string MPCRound::make_error_msg(int error_code_, const std::string &file_name, int line_num, const std::string &func_name,
                            const std::string &error_description){
@@ -29,13 +60,13 @@ std::string MPCRound::make_error_msg(int error_code_, const std::string &file_na
 bool MPCRound::InternalPushMessage(int &error_code, std::string &error_msg) {
     assert(round_index_ == 0);
     bool ok = true;
-    ok = ComputeVerify();
+    ok = RunStage(Stage::ComputeVerify, [this]() { return ComputeVerify(); });
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ComputeVerify failed!");
         return false;
     }
-    ok = MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_);
+    ok = RunStage(Stage::MakeMessage, [this]() { return MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_); });
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "MakeMessage failed!");
@@ -69,13 +100,13 @@ bool MPCRound::InternalPushMessage(const std::string &p2p_msg, const std::string
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "Failed to check in_message_type_!: ok = (in_message_type_ & MessageType::BROADCAST) &&  bc_msg.empty()");
         return false;
     }
-    ok = ParseMsg(p2p_msg, bc_msg, party_id);
+    ok = RunStage(Stage::ParseMsg, [&]() { return ParseMsg(p2p_msg, bc_msg, party_id); });
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ParseMsg failed!");
         return false;
     }
-    ok = ReceiveVerify(party_id);
+    ok = RunStage(Stage::ReceiveVerify, [&]() { return ReceiveVerify(party_id); });
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ReceiveVerify failed!");
@@ -85,13 +116,13 @@ bool MPCRound::InternalPushMessage(const std::string &p2p_msg, const std::string
 
     // If all messages were received.
     if (msg_count_ == total_parties_ - 1) {
-        ok = ComputeVerify();
+        ok = RunStage(Stage::ComputeVerify, [this]() { return ComputeVerify(); });
         if (!ok) {
             error_code = 1;
             error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ComputeVerify failed!");
             return false;
         }
-        ok = MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_);
+        ok = RunStage(Stage::MakeMessage, [this]() { return MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_); });
         if (!ok) {
             error_code = 1;
             error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "MakeMessage failed!");
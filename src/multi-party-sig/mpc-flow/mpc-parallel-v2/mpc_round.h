@@ -9,6 +9,7 @@
 #include <vector>
 #include <cassert>
 
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/message_type.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/error_info.h"
 
@@ -49,6 +50,10 @@ public:
 private:
     void set_total_parties(int total) { total_parties_ = total; }
 
+    // Run a stage, and report its metrics if the context has a metrics sink.
+    template <typename F>
+    bool RunStage(safeheron::mpc_flow::common::Stage stage, F func);
+
 public:
 
     int get_total_parties() const { return total_parties_; }
@@ -106,6 +111,18 @@ private:
     // std::vector<CustomObject> _inMessageCache;
 };
 
+/**
+ * A round bound to the context type of its protocol, which reaches its context through get_context() instead of a
+ * dynamic_cast in every stage. The round must be added to a context of that type.
+ */
+template<class Context>
+class TypedMPCRound : public MPCRound {
+public:
+    TypedMPCRound(MessageType in_message_type, MessageType out_message_type): MPCRound(in_message_type, out_message_type) {}
+
+    Context *get_context() const { return static_cast<Context *>(get_mpc_context()); }
+};
+
 }
 }
 }
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <thread>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_simulator.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+MPCSimulator::MPCSimulator(const SimulatorConfig &config): config_(config), seq_(0), rng_(config.seed_),
+                                                           busy_num_(0), in_flight_num_(0), finished_num_(0),
+                                                           done_(false) {
+    stats_.elapsed_us_ = 0;
+    stats_.compute_us_ = 0;
+    stats_.message_count_ = 0;
+    stats_.byte_count_ = 0;
+    stats_.lost_count_ = 0;
+    stats_.dropped_count_ = 0;
+}
+
+void MPCSimulator::AddParty(const std::string &party_id, MPCContext *ctx) {
+    std::unique_ptr<Party> party(new Party(ctx));
+    party->id_ = party_id;
+    party->ready_us_ = 0;
+    party->link_free_us_ = 0;
+    party->finished_ = false;
+    map_id_index_[party_id] = party_arr_.size();
+    party_arr_.push_back(std::move(party));
+}
+
+bool MPCSimulator::Run() {
+    if (party_arr_.empty()) {
+        SetError("No party to run");
+        return false;
+    }
+    if (map_id_index_.size() != party_arr_.size()) {
+        SetError("Duplicated party id");
+        return false;
+    }
+    return config_.multi_threaded_ ? RunMultiThreaded() : RunSingleThreaded();
+}
+
+bool MPCSimulator::Start(Party &party, std::vector<Outgoing> &outbox) {
+    if (!party.driver_.Start(outbox)) {
+        SetError(party.id_ + ": " + party.driver_.get_error_info());
+        return false;
+    }
+    return true;
+}
+
+bool MPCSimulator::Receive(Party &party, std::vector<Envelope> &envelope_arr, std::vector<Outgoing> &outbox) {
+    for (auto &envelope: envelope_arr) {
+        party.driver_.Hold(std::move(envelope));
+    }
+    envelope_arr.clear();
+    if (!party.driver_.Step(outbox)) {
+        SetError(party.id_ + ": " + party.driver_.get_error_info());
+        return false;
+    }
+    return true;
+}
+
+bool MPCSimulator::Post(size_t src, const std::vector<Outgoing> &outbox, uint64_t now_us) {
+    Party &party = *party_arr_[src];
+    std::uniform_int_distribution<uint64_t> jitter_dist(0, config_.jitter_us_);
+    std::uniform_real_distribution<double> loss_dist(0.0, 1.0);
+    for (const auto &out: outbox) {
+        if (stats_.round_finish_us_.size() <= (size_t)out.round_) stats_.round_finish_us_.resize(out.round_ + 1, 0);
+        stats_.round_finish_us_[out.round_] = std::max(stats_.round_finish_us_[out.round_], now_us);
+
+        for (size_t k = 0; k < out.des_arr_.size(); ++k) {
+            auto iter = map_id_index_.find(out.des_arr_[k]);
+            if (iter == map_id_index_.end()) {
+                SetError(party.id_ + ": unknown destination " + out.des_arr_[k]);
+                return false;
+            }
+            Event event;
+            event.dst_ = iter->second;
+            event.seq_ = seq_++;
+            event.envelope_.src_ = party.id_;
+            event.envelope_.round_ = out.round_;
+            event.envelope_.bc_msg_ = out.bc_msg_;
+            if (k < out.p2p_msg_arr_.size()) event.envelope_.p2p_msg_ = out.p2p_msg_arr_[k];
+            if (tap_) tap_(party.id_, out.des_arr_[k], out.round_, event.envelope_.p2p_msg_, event.envelope_.bc_msg_);
+
+            const uint64_t bytes = event.envelope_.bc_msg_.size() + event.envelope_.p2p_msg_.size();
+            stats_.message_count_++;
+            stats_.byte_count_ += bytes;
+
+            // Serialize on the uplink of the sender, then travel
+            uint64_t time_us = std::max(now_us, party.link_free_us_);
+            if (config_.bandwidth_bytes_per_sec_ > 0) {
+                time_us += bytes * 1000000 / config_.bandwidth_bytes_per_sec_;
+            }
+            party.link_free_us_ = time_us;
+            time_us += config_.latency_us_;
+            if (config_.jitter_us_ > 0) time_us += jitter_dist(rng_);
+
+            bool dropped = false;
+            while (config_.loss_rate_ > 0 && loss_dist(rng_) < config_.loss_rate_) {
+                stats_.lost_count_++;
+                if (config_.retransmit_timeout_us_ == 0) {
+                    dropped = true;
+                    break;
+                }
+                time_us += config_.retransmit_timeout_us_;
+            }
+            if (dropped) {
+                stats_.dropped_count_++;
+                continue;
+            }
+
+            event.time_us_ = time_us;
+            event_queue_.push(std::move(event));
+            in_flight_num_++;
+        }
+    }
+    return true;
+}
+
+bool MPCSimulator::RunSingleThreaded() {
+    std::vector<Outgoing> outbox;
+    std::vector<Envelope> envelope_arr;
+
+    // Measure the compute time of a party, and move its clock forward.
+    auto run_party = [&](Party &party, uint64_t now_us, const std::function<bool()> &func) {
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        bool ok = func();
+        uint64_t compute_us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - begin).count();
+        stats_.compute_us_ += compute_us;
+        party.ready_us_ = std::max(now_us, party.ready_us_) + (config_.count_compute_time_ ? compute_us : 0);
+        return ok;
+    };
+
+    for (size_t i = 0; i < party_arr_.size(); ++i) {
+        Party &party = *party_arr_[i];
+        outbox.clear();
+        if (!run_party(party, 0, [&] { return Start(party, outbox); })) return false;
+        if (!Post(i, outbox, party.ready_us_)) return false;
+    }
+
+    while (!event_queue_.empty()) {
+        Event event = event_queue_.top();
+        event_queue_.pop();
+        in_flight_num_--;
+        Party &party = *party_arr_[event.dst_];
+        envelope_arr.clear();
+        envelope_arr.push_back(std::move(event.envelope_));
+        outbox.clear();
+        if (!run_party(party, event.time_us_, [&] { return Receive(party, envelope_arr, outbox); })) return false;
+        if (!Post(event.dst_, outbox, party.ready_us_)) return false;
+    }
+
+    for (const auto &party: party_arr_) {
+        if (!party->ctx_->IsFinished()) {
+            SetError(party->id_ + ": stalled in round " + std::to_string(party->ctx_->get_cur_round())
+                     + ", " + std::to_string(stats_.dropped_count_) + " messages dropped");
+            return false;
+        }
+        stats_.elapsed_us_ = std::max(stats_.elapsed_us_, party->ready_us_);
+    }
+    return true;
+}
+
+uint64_t MPCSimulator::ElapsedUs() const {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+}
+
+void MPCSimulator::SetError(const std::string &error_info) {
+    std::lock_guard<std::mutex> lk(error_mutex_);
+    if (error_info_.empty()) error_info_ = error_info;
+}
+
+// Caller holds mutex_. Nothing can happen any more if no party is computing and no message is in flight.
+void MPCSimulator::CheckStalled() {
+    if (done_ || busy_num_ > 0 || in_flight_num_ > 0) return;
+    done_ = true;
+    if (finished_num_ < party_arr_.size()) {
+        SetError("Stalled with " + std::to_string(party_arr_.size() - finished_num_) + " parties not finished, "
+                 + std::to_string(stats_.dropped_count_) + " messages dropped");
+    }
+}
+
+void MPCSimulator::RunRouter() {
+    std::unique_lock<std::mutex> lk(mutex_);
+    while (!done_) {
+        if (event_queue_.empty()) {
+            router_cond_.wait(lk);
+            continue;
+        }
+        std::chrono::steady_clock::time_point due = start_ + std::chrono::microseconds(event_queue_.top().time_us_);
+        if (std::chrono::steady_clock::now() < due) {
+            router_cond_.wait_until(lk, due);
+            continue;
+        }
+        Event event = event_queue_.top();
+        event_queue_.pop();
+        Party &party = *party_arr_[event.dst_];
+        if (party.finished_) {
+            // Nobody takes it any more
+            in_flight_num_--;
+            CheckStalled();
+            continue;
+        }
+        party.inbox_.push_back(std::move(event.envelope_));
+        party.cond_.notify_one();
+    }
+}
+
+void MPCSimulator::RunParty(size_t index) {
+    Party &party = *party_arr_[index];
+    std::vector<Outgoing> outbox;
+    std::vector<Envelope> envelope_arr;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    bool ok = Start(party, outbox);
+    for (;;) {
+        uint64_t compute_us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - begin).count();
+
+        std::unique_lock<std::mutex> lk(mutex_);
+        stats_.compute_us_ += compute_us;
+        busy_num_--;
+        uint64_t now_us = ElapsedUs();
+        ok = ok && Post(index, outbox, now_us);
+        outbox.clear();
+        if (!ok) {
+            done_ = true;
+        } else if (party.ctx_->IsFinished()) {
+            party.finished_ = true;
+            in_flight_num_ -= party.inbox_.size();
+            party.inbox_.clear();
+            finished_num_++;
+            stats_.elapsed_us_ = std::max(stats_.elapsed_us_, now_us);
+            if (finished_num_ == party_arr_.size()) done_ = true;
+        }
+        CheckStalled();
+        if (done_) {
+            router_cond_.notify_one();
+            for (auto &p: party_arr_) p->cond_.notify_one();
+            return;
+        }
+        router_cond_.notify_one();
+        if (party.finished_) return;
+
+        party.cond_.wait(lk, [&] { return !party.inbox_.empty() || done_; });
+        if (done_) return;
+        in_flight_num_ -= party.inbox_.size();
+        busy_num_++;
+        envelope_arr.assign(std::make_move_iterator(party.inbox_.begin()),
+                            std::make_move_iterator(party.inbox_.end()));
+        party.inbox_.clear();
+        lk.unlock();
+
+        begin = std::chrono::steady_clock::now();
+        ok = Receive(party, envelope_arr, outbox);
+    }
+}
+
+bool MPCSimulator::RunMultiThreaded() {
+    start_ = std::chrono::steady_clock::now();
+    busy_num_ = party_arr_.size();
+    std::thread router(&MPCSimulator::RunRouter, this);
+    std::vector<std::thread> thread_arr;
+    for (size_t i = 0; i < party_arr_.size(); ++i) {
+        thread_arr.emplace_back(&MPCSimulator::RunParty, this, i);
+    }
+    for (auto &t: thread_arr) t.join();
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        done_ = true;
+    }
+    router_cond_.notify_one();
+    router.join();
+    return error_info_.empty() && finished_num_ == party_arr_.size();
+}
+
+}
+}
+}
@@ -0,0 +1,193 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_SIMULATOR_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_SIMULATOR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/context_driver.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Network model of the simulator.
+ */
+struct SimulatorConfig {
+    SimulatorConfig(): latency_us_(0), jitter_us_(0), bandwidth_bytes_per_sec_(0), loss_rate_(0),
+                       retransmit_timeout_us_(0), seed_(0), multi_threaded_(false), count_compute_time_(true) {}
+
+    // One way latency of every link
+    uint64_t latency_us_;
+    // Extra latency drawn uniformly in [0, jitter_us_] for each message, so later messages may overtake earlier ones.
+    uint64_t jitter_us_;
+    // Uplink bandwidth of every party, messages of one sender are serialized on its uplink. 0 means unlimited.
+    uint64_t bandwidth_bytes_per_sec_;
+    // Probability that one transmission of a message is lost
+    double loss_rate_;
+    // A lost transmission is sent again after the timeout. 0 means lost messages are dropped for good.
+    uint64_t retransmit_timeout_us_;
+    // Seed of the random number generator of the network
+    uint64_t seed_;
+    // false: all parties are run in the calling thread on a virtual clock.
+    // true: every party is run in its own thread and messages are delayed in real time.
+    bool multi_threaded_;
+    // Single threaded mode only. true: the time a party spends in its context is added to the virtual clock.
+    // false: computation takes no virtual time, so the order of delivery only depends on the seed.
+    bool count_compute_time_;
+};
+
+struct SimulatorStats {
+    // Time from the start to the last party finished, virtual time in single threaded mode.
+    uint64_t elapsed_us_;
+    // Time spent in the contexts of all parties
+    uint64_t compute_us_;
+    // Messages sent, one message per receiver
+    uint64_t message_count_;
+    uint64_t byte_count_;
+    // Transmissions lost, including those sent again
+    uint64_t lost_count_;
+    // Messages never delivered
+    uint64_t dropped_count_;
+    // round_finish_us_[r]: time when the last party finished round r
+    std::vector<uint64_t> round_finish_us_;
+};
+
+/**
+ * Run all parties of a protocol in one process, with messages delivered through an in-memory network of configurable
+ * latency, jitter, bandwidth and loss.
+ *
+ * Any MPCContext works. A party takes the messages of a round as soon as its context is ready for them, messages
+ * arriving early are held back until then.
+ *
+ * Usage:
+ *      MPCSimulator simulator(config);
+ *      for (...) simulator.AddParty(party_id, &ctx);
+ *      bool ok = simulator.Run();
+ *      const SimulatorStats &stats = simulator.get_stats();
+ */
+class MPCSimulator {
+public:
+    explicit MPCSimulator(const SimulatorConfig &config = SimulatorConfig());
+
+    MPCSimulator(const MPCSimulator &) = delete;
+
+    MPCSimulator &operator=(const MPCSimulator &) = delete;
+
+    /**
+     * Add a party.
+     * @param party_id id of the party, as used in the destinations of the messages of the protocol.
+     * @param ctx context of the party, created and not started yet. Not owned by the simulator.
+     */
+    void AddParty(const std::string &party_id, MPCContext *ctx);
+
+    /**
+     * Called for every message sent, once per receiver, e.g. to keep a transcript. Calls are never concurrent.
+     */
+    typedef std::function<void(const std::string &src, const std::string &dst, int round,
+                               const std::string &p2p_msg, const std::string &bc_msg)> MessageTap;
+
+    void set_message_tap(const MessageTap &tap) { tap_ = tap; }
+
+    /**
+     * Run the protocol until all parties finished, one of them failed, or no message is left in flight.
+     * Call it once.
+     * @return true if all contexts finished with no error.
+     */
+    bool Run();
+
+    const SimulatorStats &get_stats() const { return stats_; }
+
+    const std::string &get_error_info() const { return error_info_; }
+
+private:
+    typedef ContextDriver::Incoming Envelope;
+
+    typedef ContextDriver::Outgoing Outgoing;
+
+    struct Event {
+        uint64_t time_us_;
+        uint64_t seq_;
+        size_t dst_;
+        Envelope envelope_;
+
+        bool operator>(const Event &other) const {
+            return time_us_ != other.time_us_ ? time_us_ > other.time_us_ : seq_ > other.seq_;
+        }
+    };
+
+    struct Party {
+        explicit Party(MPCContext *ctx): ctx_(ctx), driver_(ctx) {}
+
+        std::string id_;
+        MPCContext *ctx_;
+        ContextDriver driver_;
+        // The party is busy until then
+        uint64_t ready_us_;
+        // Its uplink is busy until then
+        uint64_t link_free_us_;
+        // Multi threaded mode
+        bool finished_;
+        std::deque<Envelope> inbox_;
+        std::condition_variable cond_;
+    };
+
+    typedef std::priority_queue<Event, std::vector<Event>, std::greater<Event>> EventQueue;
+
+    bool Start(Party &party, std::vector<Outgoing> &outbox);
+
+    bool Receive(Party &party, std::vector<Envelope> &envelope_arr, std::vector<Outgoing> &outbox);
+
+    bool Post(size_t src, const std::vector<Outgoing> &outbox, uint64_t now_us);
+
+    bool RunSingleThreaded();
+
+    bool RunMultiThreaded();
+
+    void RunParty(size_t index);
+
+    void RunRouter();
+
+    void CheckStalled();
+
+    uint64_t ElapsedUs() const;
+
+    void SetError(const std::string &error_info);
+
+private:
+    SimulatorConfig config_;
+    SimulatorStats stats_;
+    std::string error_info_;
+    std::mutex error_mutex_;
+    std::vector<std::unique_ptr<Party>> party_arr_;
+    std::map<std::string, size_t> map_id_index_;
+    MessageTap tap_;
+    EventQueue event_queue_;
+    uint64_t seq_;
+    std::mt19937_64 rng_;
+
+    // Multi threaded mode
+    std::mutex mutex_;
+    std::condition_variable router_cond_;
+    std::chrono::steady_clock::time_point start_;
+    size_t busy_num_;
+    size_t in_flight_num_;
+    size_t finished_num_;
+    bool done_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_SIMULATOR_H
@@ -0,0 +1,443 @@
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/context_driver.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/shm_transport.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "the ring needs lock free 64 bit atomics");
+
+static const uint32_t RING_MAGIC = 0x53484D52; // "SHMR"
+static const uint32_t FRAME_PADDING = 1;
+static const size_t CACHE_LINE = 64;
+
+// Shared by the two processes, followed by the data. head_ and tail_ live on cache lines of their own.
+struct ShmRing::Header {
+    std::atomic<uint32_t> magic_;
+    // Process of the consumer, to tell a ring left by a crashed run
+    int32_t pid_;
+    uint64_t capacity_;
+    alignas(CACHE_LINE) std::atomic<uint64_t> head_;
+    alignas(CACHE_LINE) std::atomic<uint64_t> tail_;
+    alignas(CACHE_LINE) uint8_t reserved_[CACHE_LINE];
+};
+
+// Every frame starts with its size and flags, and is aligned on 8 bytes.
+struct FrameHeader {
+    uint32_t size_;
+    uint32_t flags_;
+};
+
+static uint64_t Align8(uint64_t size) {
+    return (size + 7) & ~(uint64_t)7;
+}
+
+ShmRing::ShmRing(): header_(nullptr), data_(nullptr), map_size_(0), mask_(0), peek_frame_size_(0), broken_(false) {
+}
+
+ShmRing::~ShmRing() {
+    Close();
+}
+
+bool ShmRing::Map(int fd, size_t size) {
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) return false;
+    header_ = static_cast<Header *>(ptr);
+    data_ = reinterpret_cast<uint8_t *>(header_) + sizeof(Header);
+    map_size_ = size;
+    return true;
+}
+
+bool ShmRing::Create(const std::string &name, size_t capacity) {
+    Close();
+    uint64_t cap = 4096;
+    while (cap < capacity) cap <<= 1;
+
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) return false;
+    size_t size = sizeof(Header) + cap;
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    if (!Map(fd, size)) {
+        shm_unlink(name.c_str());
+        return false;
+    }
+    name_ = name;
+    header_->pid_ = (int32_t)getpid();
+    header_->capacity_ = cap;
+    header_->head_.store(0, std::memory_order_relaxed);
+    header_->tail_.store(0, std::memory_order_relaxed);
+    mask_ = cap - 1;
+    // The producer does not touch the ring before it sees the magic.
+    header_->magic_.store(RING_MAGIC, std::memory_order_release);
+    return true;
+}
+
+bool ShmRing::Open(const std::string &name) {
+    Close();
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size <= sizeof(Header)) {
+        close(fd);
+        return false;
+    }
+    if (!Map(fd, (size_t)st.st_size)) return false;
+    const uint64_t cap = header_->capacity_;
+    if (header_->magic_.load(std::memory_order_acquire) != RING_MAGIC
+        || cap < 4096 || (cap & (cap - 1)) != 0 || sizeof(Header) + cap != map_size_
+        || (kill(header_->pid_, 0) != 0 && errno == ESRCH)) {
+        Close();
+        return false;
+    }
+    name_ = name;
+    mask_ = cap - 1;
+    return true;
+}
+
+void ShmRing::Close() {
+    if (header_) munmap(header_, map_size_);
+    header_ = nullptr;
+    data_ = nullptr;
+    map_size_ = 0;
+    mask_ = 0;
+    peek_frame_size_ = 0;
+    broken_ = false;
+    name_.clear();
+}
+
+void ShmRing::Unlink(const std::string &name) {
+    shm_unlink(name.c_str());
+}
+
+size_t ShmRing::MaxFrameSize() const {
+    return header_ ? (size_t)((mask_ + 1) / 2 - sizeof(FrameHeader)) : 0;
+}
+
+bool ShmRing::TryWrite(const Segment *segment_arr, size_t segment_num) {
+    if (!header_) return false;
+    uint64_t size = 0;
+    for (size_t i = 0; i < segment_num; ++i) size += segment_arr[i].size_;
+    if (size > MaxFrameSize()) return false;
+
+    const uint64_t cap = mask_ + 1;
+    const uint64_t head = header_->head_.load(std::memory_order_relaxed);
+    const uint64_t tail = header_->tail_.load(std::memory_order_acquire);
+    const uint64_t frame_size = Align8(sizeof(FrameHeader) + size);
+    uint64_t pos = head & mask_;
+    // A frame does not wrap around, the end of the ring is skipped instead.
+    uint64_t padding = (cap - pos < frame_size) ? cap - pos : 0;
+    if (cap - (head - tail) < padding + frame_size) return false;
+
+    if (padding > 0) {
+        FrameHeader pad;
+        pad.size_ = (uint32_t)(padding - sizeof(FrameHeader));
+        pad.flags_ = FRAME_PADDING;
+        memcpy(data_ + pos, &pad, sizeof(pad));
+        pos = 0;
+    }
+    FrameHeader frame;
+    frame.size_ = (uint32_t)size;
+    frame.flags_ = 0;
+    memcpy(data_ + pos, &frame, sizeof(frame));
+    uint8_t *dst = data_ + pos + sizeof(FrameHeader);
+    for (size_t i = 0; i < segment_num; ++i) {
+        memcpy(dst, segment_arr[i].data_, segment_arr[i].size_);
+        dst += segment_arr[i].size_;
+    }
+    header_->head_.store(head + padding + frame_size, std::memory_order_release);
+    return true;
+}
+
+bool ShmRing::Peek(const uint8_t *&data, size_t &size) {
+    if (!header_ || broken_) return false;
+    const uint64_t cap = mask_ + 1;
+    for (;;) {
+        const uint64_t tail = header_->tail_.load(std::memory_order_relaxed);
+        const uint64_t head = header_->head_.load(std::memory_order_acquire);
+        if (tail == head) return false;
+        // The indexes and the frame are written by the other process
+        const uint64_t used = head - tail;
+        const uint64_t pos = tail & mask_;
+        if (used > cap || used < sizeof(FrameHeader) || (tail & 7) != 0) {
+            broken_ = true;
+            return false;
+        }
+        FrameHeader frame;
+        memcpy(&frame, data_ + pos, sizeof(frame));
+        const uint64_t frame_size = sizeof(FrameHeader) + (uint64_t)frame.size_;
+        if (frame.flags_ & FRAME_PADDING) {
+            // Padding runs to the end of the ring
+            if (frame_size != cap - pos || frame_size > used) {
+                broken_ = true;
+                return false;
+            }
+            header_->tail_.store(tail + frame_size, std::memory_order_release);
+            continue;
+        }
+        if (frame_size > cap - pos || Align8(frame_size) > used) {
+            broken_ = true;
+            return false;
+        }
+        data = data_ + pos + sizeof(FrameHeader);
+        size = frame.size_;
+        peek_frame_size_ = Align8(frame_size);
+        return true;
+    }
+}
+
+void ShmRing::Pop() {
+    if (!header_ || peek_frame_size_ == 0) return;
+    const uint64_t tail = header_->tail_.load(std::memory_order_relaxed);
+    header_->tail_.store(tail + peek_frame_size_, std::memory_order_release);
+    peek_frame_size_ = 0;
+}
+
+// Frame of a message: the sizes of ssid, from, to, p2p_msg, bc_msg, the round, then the bytes of the strings.
+struct MessageFrame {
+    uint32_t ssid_size_;
+    uint32_t from_size_;
+    uint32_t to_size_;
+    int32_t round_;
+    uint64_t p2p_msg_size_;
+    uint64_t bc_msg_size_;
+};
+
+static bool DecodeMessage(const uint8_t *data, size_t size, ShmMessage &msg) {
+    MessageFrame frame;
+    if (size < sizeof(frame)) return false;
+    memcpy(&frame, data, sizeof(frame));
+    uint64_t total = (uint64_t)frame.ssid_size_ + frame.from_size_ + frame.to_size_;
+    if (frame.p2p_msg_size_ > size || frame.bc_msg_size_ > size) return false;
+    total += frame.p2p_msg_size_ + frame.bc_msg_size_;
+    if (total != size - sizeof(frame)) return false;
+
+    const char *p = reinterpret_cast<const char *>(data + sizeof(frame));
+    msg.ssid_.assign(p, frame.ssid_size_);
+    p += frame.ssid_size_;
+    msg.from_.assign(p, frame.from_size_);
+    p += frame.from_size_;
+    msg.to_.assign(p, frame.to_size_);
+    p += frame.to_size_;
+    msg.p2p_msg_.assign(p, frame.p2p_msg_size_);
+    p += frame.p2p_msg_size_;
+    msg.bc_msg_.assign(p, frame.bc_msg_size_);
+    msg.round_ = frame.round_;
+    return true;
+}
+
+// Spin first, the other party is likely to answer within microseconds, then back off.
+class Backoff {
+public:
+    explicit Backoff(uint64_t timeout_ms): count_(0),
+                                           deadline_(std::chrono::steady_clock::now()
+                                                     + std::chrono::milliseconds(timeout_ms)) {}
+
+    // false once the deadline is passed
+    bool Wait() {
+        ++count_;
+        if (count_ < 1000) return true;
+        if (count_ < 2000) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        return (count_ & 63) != 0 || std::chrono::steady_clock::now() < deadline_;
+    }
+
+private:
+    uint64_t count_;
+    std::chrono::steady_clock::time_point deadline_;
+};
+
+ShmTransport::ShmTransport(const std::string &prefix, const std::string &local_party_id,
+                           const std::vector<std::string> &remote_party_id_arr, size_t ring_capacity):
+        prefix_(prefix), local_party_id_(local_party_id), remote_party_id_arr_(remote_party_id_arr),
+        ring_capacity_(ring_capacity), next_in_ring_(0), backlog_num_(0), backlog_size_(0) {
+}
+
+ShmTransport::~ShmTransport() {
+    for (size_t i = 0; i < in_ring_arr_.size(); ++i) {
+        ShmRing::Unlink(RingName(remote_party_id_arr_[i], local_party_id_));
+    }
+}
+
+std::string ShmTransport::RingName(const std::string &from, const std::string &to) const {
+    return prefix_ + "-" + from + "-" + to;
+}
+
+bool ShmTransport::Init(uint64_t timeout_ms) {
+    in_ring_arr_.clear();
+    out_ring_arr_.clear();
+    for (const auto &remote_party_id: remote_party_id_arr_) {
+        std::unique_ptr<ShmRing> ring(new ShmRing());
+        if (!ring->Create(RingName(remote_party_id, local_party_id_), ring_capacity_)) {
+            error_info_ = "Failed to create the ring from " + remote_party_id;
+            return false;
+        }
+        in_ring_arr_.push_back(std::move(ring));
+    }
+    for (const auto &remote_party_id: remote_party_id_arr_) {
+        std::unique_ptr<ShmRing> ring(new ShmRing());
+        Backoff backoff(timeout_ms);
+        while (!ring->Open(RingName(local_party_id_, remote_party_id))) {
+            if (!backoff.Wait()) {
+                error_info_ = "Timeout while waiting for " + remote_party_id;
+                return false;
+            }
+        }
+        out_ring_arr_.push_back(std::move(ring));
+    }
+    return true;
+}
+
+bool ShmTransport::Send(const std::string &ssid, int round, const std::string &to, const std::string &p2p_msg,
+                        const std::string &bc_msg, uint64_t timeout_ms) {
+    size_t pos = 0;
+    while (pos < remote_party_id_arr_.size() && remote_party_id_arr_[pos] != to) ++pos;
+    if (pos == out_ring_arr_.size()) {
+        error_info_ = "Unknown party " + to;
+        return false;
+    }
+
+    MessageFrame frame;
+    frame.ssid_size_ = (uint32_t)ssid.size();
+    frame.from_size_ = (uint32_t)local_party_id_.size();
+    frame.to_size_ = (uint32_t)to.size();
+    frame.round_ = round;
+    frame.p2p_msg_size_ = p2p_msg.size();
+    frame.bc_msg_size_ = bc_msg.size();
+    const ShmRing::Segment segment_arr[] = {
+            {&frame, sizeof(frame)},
+            {ssid.data(), ssid.size()},
+            {local_party_id_.data(), local_party_id_.size()},
+            {to.data(), to.size()},
+            {p2p_msg.data(), p2p_msg.size()},
+            {bc_msg.data(), bc_msg.size()},
+    };
+
+    ShmRing &ring = *out_ring_arr_[pos];
+    size_t size = 0;
+    for (const auto &segment: segment_arr) size += segment.size_;
+    if (size > ring.MaxFrameSize()) {
+        error_info_ = "Message to " + to + " is too large for the ring";
+        return false;
+    }
+    Backoff backoff(timeout_ms);
+    while (!ring.TryWrite(segment_arr, sizeof(segment_arr) / sizeof(segment_arr[0]))) {
+        if (!backoff.Wait()) {
+            error_info_ = "Timeout while sending to " + to;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ShmTransport::Receive(ShmMessage &msg, uint64_t timeout_ms) {
+    Backoff backoff(timeout_ms);
+    for (;;) {
+        for (size_t k = 0; k < in_ring_arr_.size(); ++k) {
+            size_t i = (next_in_ring_ + k) % in_ring_arr_.size();
+            const uint8_t *data = nullptr;
+            size_t size = 0;
+            if (!in_ring_arr_[i]->Peek(data, size)) {
+                if (in_ring_arr_[i]->IsBroken()) {
+                    error_info_ = "Corrupted ring from " + remote_party_id_arr_[i];
+                    return false;
+                }
+                continue;
+            }
+            bool ok = DecodeMessage(data, size, msg);
+            in_ring_arr_[i]->Pop();
+            // Round robin, so a busy party does not starve the others
+            next_in_ring_ = i + 1;
+            if (!ok || msg.from_ != remote_party_id_arr_[i] || msg.to_ != local_party_id_) {
+                error_info_ = "Malformed message from " + remote_party_id_arr_[i];
+                return false;
+            }
+            return true;
+        }
+        if (!backoff.Wait()) {
+            error_info_ = "Timeout while receiving";
+            return false;
+        }
+    }
+}
+
+static size_t MessageSize(const ShmMessage &msg) {
+    return msg.ssid_.size() + msg.from_.size() + msg.to_.size() + msg.p2p_msg_.size() + msg.bc_msg_.size();
+}
+
+bool ShmTransport::ReceiveOf(const std::string &ssid, ShmMessage &msg, uint64_t timeout_ms) {
+    auto iter = map_ssid_backlog_.find(ssid);
+    if (iter != map_ssid_backlog_.end()) {
+        msg = std::move(iter->second.front());
+        iter->second.erase(iter->second.begin());
+        if (iter->second.empty()) map_ssid_backlog_.erase(iter);
+        backlog_num_--;
+        backlog_size_ -= MessageSize(msg);
+        return true;
+    }
+    for (;;) {
+        if (!Receive(msg, timeout_ms)) return false;
+        if (msg.ssid_ == ssid) return true;
+        const size_t msg_size = MessageSize(msg);
+        if (backlog_num_ >= MAX_BACKLOG_MESSAGES || backlog_size_ + msg_size > MAX_BACKLOG_SIZE) {
+            error_info_ = "Too many messages of other sessions from " + msg.from_;
+            return false;
+        }
+        backlog_num_++;
+        backlog_size_ += msg_size;
+        map_ssid_backlog_[msg.ssid_].push_back(std::move(msg));
+    }
+}
+
+bool ShmTransport::Run(MPCContext *ctx, const std::string &ssid, uint64_t timeout_ms) {
+    ContextDriver driver(ctx);
+    std::vector<ContextDriver::Outgoing> outbox;
+
+    bool ok = driver.Start(outbox);
+    for (;;) {
+        if (!ok) {
+            error_info_ = driver.get_error_info();
+            return false;
+        }
+        for (const auto &out: outbox) {
+            for (size_t k = 0; k < out.des_arr_.size(); ++k) {
+                const std::string &p2p_msg = (k < out.p2p_msg_arr_.size()) ? out.p2p_msg_arr_[k] : std::string();
+                if (!Send(ssid, out.round_, out.des_arr_[k], p2p_msg, out.bc_msg_, timeout_ms)) return false;
+            }
+        }
+        if (driver.IsFinished()) return true;
+
+        ShmMessage msg;
+        if (!ReceiveOf(ssid, msg, timeout_ms)) return false;
+        ContextDriver::Incoming incoming;
+        incoming.src_ = std::move(msg.from_);
+        incoming.round_ = msg.round_;
+        incoming.p2p_msg_ = std::move(msg.p2p_msg_);
+        incoming.bc_msg_ = std::move(msg.bc_msg_);
+        driver.Hold(std::move(incoming));
+        outbox.clear();
+        ok = driver.Step(outbox);
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,206 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SHM_TRANSPORT_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SHM_TRANSPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * A ring buffer of frames in POSIX shared memory, with one producer and one consumer, which may live in different
+ * processes. No lock is taken: the producer owns the head, the consumer owns the tail.
+ *
+ * The consumer creates the ring, the producer opens it. A ring left by a consumer which is gone is not opened.
+ *
+ * Each side only trusts what it owns: the indexes and the frames written by the other process are checked before use,
+ * and a ring found corrupted is not read any further, see IsBroken().
+ */
+class ShmRing {
+public:
+    struct Segment {
+        const void *data_;
+        size_t size_;
+    };
+
+    ShmRing();
+
+    ~ShmRing();
+
+    ShmRing(const ShmRing &) = delete;
+
+    ShmRing &operator=(const ShmRing &) = delete;
+
+    /**
+     * Create the ring, replacing a ring of the same name left by an earlier run.
+     * @param name name of the shared memory object, e.g. "/mpc-party1-party2"
+     * @param capacity bytes of the ring, rounded up to a power of 2
+     */
+    bool Create(const std::string &name, size_t capacity);
+
+    /**
+     * Open a ring created by the consumer.
+     * @return false if it does not exist or is not ready yet.
+     */
+    bool Open(const std::string &name);
+
+    void Close();
+
+    /**
+     * Remove the name of the ring. Processes which have it open can go on using it.
+     */
+    static void Unlink(const std::string &name);
+
+    /**
+     * Producer: append a frame made of the segments, copied into the ring directly.
+     * @return false if the ring is full for now, or the frame is larger than half of the ring.
+     */
+    bool TryWrite(const Segment *segment_arr, size_t segment_num);
+
+    /**
+     * Consumer: the frame at the tail, valid until Pop().
+     * @return false if the ring is empty or broken.
+     */
+    bool Peek(const uint8_t *&data, size_t &size);
+
+    /**
+     * Consumer: release the frame returned by Peek().
+     */
+    void Pop();
+
+    /**
+     * Consumer: true once the producer left indexes or a frame out of the ring, e.g. a faulty or compromised peer.
+     */
+    bool IsBroken() const { return broken_; }
+
+    // Largest frame that fits
+    size_t MaxFrameSize() const;
+
+private:
+    struct Header;
+
+    bool Map(int fd, size_t size);
+
+private:
+    std::string name_;
+    Header *header_;
+    uint8_t *data_;
+    size_t map_size_;
+    // Capacity - 1, kept out of the shared memory
+    uint64_t mask_;
+    // Bytes Pop() releases, checked by Peek()
+    uint64_t peek_frame_size_;
+    bool broken_;
+};
+
+/**
+ * A message of a round, as carried by ShmTransport.
+ */
+struct ShmMessage {
+    std::string ssid_;
+    int round_;
+    std::string from_;
+    std::string to_;
+    std::string p2p_msg_;
+    std::string bc_msg_;
+};
+
+/**
+ * Reference transport for parties which run on the same host, in separate processes.
+ *
+ * There is one ShmRing per ordered pair of parties, named "<prefix>-<from>-<to>". Messages are framed with
+ * (ssid, round, from, to) and copied straight from the strings popped from the context into the ring; the receiver
+ * copies them once more into the strings taken by MPCContext::PushMessage(). Nothing is base64 encoded.
+ *
+ * Usage, in the process of every party:
+ *      ShmTransport transport("/mpc", "party1", {"party2", "party3"});
+ *      transport.Init(5000);
+ *      bool ok = transport.Run(&ctx, ssid, 60000);
+ *
+ * One transport serves any number of sessions, one after the other: messages of another session are kept aside
+ * until Run() is called for it. A transport is used by one thread at a time.
+ */
+class ShmTransport {
+public:
+    // Messages of other sessions kept aside at most, so that a peer cannot make the backlog grow without bound
+    static const size_t MAX_BACKLOG_MESSAGES = 1024;
+    static const size_t MAX_BACKLOG_SIZE = 64 * 1024 * 1024;
+
+    /**
+     * Constructor
+     * @param prefix prefix of the names of the rings, starting with '/'
+     * @param local_party_id
+     * @param remote_party_id_arr
+     * @param ring_capacity bytes of each ring
+     */
+    ShmTransport(const std::string &prefix, const std::string &local_party_id,
+                 const std::vector<std::string> &remote_party_id_arr, size_t ring_capacity = 4 * 1024 * 1024);
+
+    ~ShmTransport();
+
+    ShmTransport(const ShmTransport &) = delete;
+
+    ShmTransport &operator=(const ShmTransport &) = delete;
+
+    /**
+     * Create the rings to the local party, and open the rings to the remote parties once their processes created them.
+     * @param timeout_ms time to wait for the remote parties
+     */
+    bool Init(uint64_t timeout_ms);
+
+    /**
+     * Send a message. Waits while the ring to the receiver is full.
+     */
+    bool Send(const std::string &ssid, int round, const std::string &to, const std::string &p2p_msg,
+              const std::string &bc_msg, uint64_t timeout_ms);
+
+    /**
+     * Receive a message of any session from any remote party.
+     * @return false on timeout
+     */
+    bool Receive(ShmMessage &msg, uint64_t timeout_ms);
+
+    /**
+     * Run a context until it finishes, exchanging the messages of the session ssid with the remote parties.
+     * @param ctx a context created but not started
+     * @param ssid id of the session, the same in all parties
+     * @param timeout_ms time to wait for a message
+     */
+    bool Run(MPCContext *ctx, const std::string &ssid, uint64_t timeout_ms);
+
+    const std::string &get_error_info() const { return error_info_; }
+
+private:
+    std::string RingName(const std::string &from, const std::string &to) const;
+
+    // Take a message of the session ssid, from the backlog or the rings.
+    bool ReceiveOf(const std::string &ssid, ShmMessage &msg, uint64_t timeout_ms);
+
+private:
+    std::string prefix_;
+    std::string local_party_id_;
+    std::vector<std::string> remote_party_id_arr_;
+    size_t ring_capacity_;
+    // in_ring_arr_[i]: from remote party i, out_ring_arr_[i]: to remote party i
+    std::vector<std::unique_ptr<ShmRing>> in_ring_arr_;
+    std::vector<std::unique_ptr<ShmRing>> out_ring_arr_;
+    // Next ring to poll
+    size_t next_in_ring_;
+    // ssid -> messages received for a session not being run
+    std::map<std::string, std::vector<ShmMessage>> map_ssid_backlog_;
+    size_t backlog_num_;
+    size_t backlog_size_;
+    std::string error_info_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SHM_TRANSPORT_H
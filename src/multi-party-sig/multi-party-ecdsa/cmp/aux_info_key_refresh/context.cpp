@@ -73,6 +73,9 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     sign_key_ = ctx.sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
+    party_id_arr_ = ctx.party_id_arr_;
+    sorted_party_pos_arr_ = ctx.sorted_party_pos_arr_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -102,6 +105,9 @@ Context &Context::operator=(const Context &ctx){
     sign_key_ = ctx.sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
+    party_id_arr_ = ctx.party_id_arr_;
+    sorted_party_pos_arr_ = ctx.sorted_party_pos_arr_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -160,6 +166,8 @@ bool Context::CreateContext(Context &ctx,
     ctx.ComputeSSID(sid);
     ctx.ComputeSSID_Index();
 
+    ctx.IndexParties();
+
     return true;
 }
 
@@ -225,9 +233,21 @@ bool Context::CreateContext(Context &ctx,
     ctx.ComputeSSID(sid);
     ctx.ComputeSSID_Index();
 
+    ctx.IndexParties();
+
     return true;
 }
 
+void Context::IndexParties() {
+    remote_party_pos_index_.Build(sign_key_.remote_parties_);
+    party_id_arr_.clear();
+    for (const auto &party: sign_key_.remote_parties_) {
+        party_id_arr_.push_back(party.party_id_);
+    }
+    party_id_arr_.push_back(sign_key_.local_party_.party_id_);
+    safeheron::mpc_flow::common::SortPartyPositions(party_id_arr_, sorted_party_pos_arr_);
+}
+
 void Context::ComputeSSID(const std::string &sid){
     // Compute ssid = (sid, g, q, P, rid, X)
     const curve::Curve *curv = curve::GetCurveParam(curve_type_);
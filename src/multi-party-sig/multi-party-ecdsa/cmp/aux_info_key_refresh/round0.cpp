@@ -3,12 +3,17 @@
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/context.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
 using safeheron::hash::CSafeHash256;
 using safeheron::bignum::BN;
 using safeheron::curve::CurvePoint;
+using safeheron::mpc_flow::common::TranscriptWriter;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -16,7 +21,7 @@ namespace cmp {
 namespace aux_info_key_refresh {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
     bool ok = true;
@@ -62,19 +67,21 @@ bool Round0::ComputeVerify() {
                                                                  ctx->local_party_.f_arr_,
                                                                  curv->n,
                                                                  curv->g);
-    ctx->local_party_.map_party_id_x_[sign_key.local_party_.party_id_] = share_points[share_index_arr.size() - 1].y;
-    ctx->local_party_.map_party_id_X_[sign_key.local_party_.party_id_] = curv->g * share_points[share_index_arr.size() - 1].y;
-    for(size_t j = 0; j < sign_key.n_parties_ - 1; ++j){
-        ctx->local_party_.map_party_id_x_[sign_key.remote_parties_[j].party_id_] = share_points[j].y;
-        ctx->local_party_.map_party_id_X_[sign_key.remote_parties_[j].party_id_] = curv->g * share_points[j].y;
+    // share_points are in the order of the party positions
+    ctx->local_party_.x_arr_.clear();
+    ctx->local_party_.X_arr_.clear();
+    for(size_t j = 0; j < share_points.size(); ++j){
+        ctx->local_party_.x_arr_.push_back(share_points[j].y);
+        ctx->local_party_.X_arr_.push_back(curv->g * share_points[j].y);
     }
 
     // Sample (tau_1, A_1), ... , (tau_n, A_n)
-    for (const auto &remote_party: sign_key.remote_parties_) {
+    ctx->local_party_.tau_arr_.clear();
+    ctx->local_party_.A_arr_.clear();
+    for (size_t j = 0; j < sign_key.remote_parties_.size(); ++j) {
         BN tau = safeheron::rand::RandomBN(256);
-        CurvePoint A = curv->g * tau;
-        ctx->local_party_.map_remote_party_id_tau_[remote_party.party_id_] = tau;
-        ctx->local_party_.map_remote_party_id_A_[remote_party.party_id_] = A;
+        ctx->local_party_.A_arr_.push_back(curv->g * tau);
+        ctx->local_party_.tau_arr_.push_back(tau);
     }
 
     // Sample (rho, u)
@@ -92,71 +99,54 @@ bool Round0::ComputeVerify() {
                                        ctx->local_party_.qq_,
                                        sign_key.local_party_.alpha_,
                                        sign_key.local_party_.beta_);
+    CountPrimitive(Primitive::ZKProve);
 
     // V = H( ssid || i || X_arr || A_arr || Y || B || N || s || t || psi_tilde || rho || flag_update_minimal_key || u)
     uint8_t digest[CSafeHash256::OUTPUT_SIZE];
     CSafeHash256 sha256;
-    string buf;
+    TranscriptWriter<CSafeHash256> transcript(sha256);
     // sid
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->ssid_.c_str()), ctx->ssid_.size());
+    transcript.Append(ctx->ssid_);
     // index
-    sign_key.local_party_.index_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.index_);
     // X
-    for(const auto &item : ctx->local_party_.map_party_id_X_){
-        item.second.EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    for(size_t pos : ctx->sorted_party_pos_arr_){
+        transcript.Append(ctx->local_party_.X_arr_[pos]);
     }
     // c
     for(size_t i = 0; i < ctx->local_party_.c_.size(); ++i){
-        ctx->local_party_.c_[i].EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(ctx->local_party_.c_[i]);
     }
     // A
-    for(const auto &item: ctx->local_party_.map_remote_party_id_A_){
-        item.second.EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    for(size_t pos : ctx->sorted_party_pos_arr_){
+        if (pos == ctx->get_local_party_pos()) continue;
+        transcript.Append(ctx->local_party_.A_arr_[pos]);
     }
     // Y
-    sign_key.local_party_.Y_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.Y_);
     // B
-    ctx->local_party_.B_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.B_);
     // N
-    sign_key.local_party_.N_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.N_);
     // s
-    sign_key.local_party_.s_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.s_);
     // t
-    sign_key.local_party_.t_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.t_);
     // psi_tilde
     for(size_t i = 0; i < ctx->local_party_.psi_tilde_.dln_proof_1_.alpha_arr_.size(); ++i){
-        ctx->local_party_.psi_tilde_.dln_proof_1_.alpha_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-        ctx->local_party_.psi_tilde_.dln_proof_1_.t_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(ctx->local_party_.psi_tilde_.dln_proof_1_.alpha_arr_[i]);
+        transcript.Append(ctx->local_party_.psi_tilde_.dln_proof_1_.t_arr_[i]);
     }
     for(size_t i = 0; i < ctx->local_party_.psi_tilde_.dln_proof_2_.alpha_arr_.size(); ++i){
-        ctx->local_party_.psi_tilde_.dln_proof_2_.alpha_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-        ctx->local_party_.psi_tilde_.dln_proof_2_.t_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(ctx->local_party_.psi_tilde_.dln_proof_2_.alpha_arr_[i]);
+        transcript.Append(ctx->local_party_.psi_tilde_.dln_proof_2_.t_arr_[i]);
     }
     // rho
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->local_party_.rho_.c_str()), ctx->local_party_.rho_.size());
+    transcript.Append(ctx->local_party_.rho_);
     //flag_update_minimal_key
-    if (ctx->flag_update_minimal_key_) {
-        std::string bool_str = "true";
-        sha256.Write(reinterpret_cast<const unsigned char *>(bool_str.c_str()), bool_str.size());
-    } else {
-        std::string bool_str = "false";
-        sha256.Write(reinterpret_cast<const unsigned char *>(bool_str.c_str()), bool_str.size());
-    }
+    transcript.Append(ctx->flag_update_minimal_key_ ? "true" : "false");
     // u
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->local_party_.u_.c_str()), ctx->local_party_.u_.size());
+    transcript.Append(ctx->local_party_.u_);
     sha256.Finalize(digest);
 
     ctx->local_party_.V_.assign((const char *) digest, sizeof(digest));
@@ -166,7 +156,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
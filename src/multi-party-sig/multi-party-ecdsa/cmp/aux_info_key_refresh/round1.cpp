@@ -16,17 +16,17 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &minimal_sign_key = ctx->sign_key_;
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -42,11 +42,11 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -72,7 +72,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     return true;
@@ -80,7 +80,7 @@ bool Round1::ComputeVerify() {
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -94,8 +94,9 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     Round1BCMessage bc_message;
     bc_message.ssid_ = ctx->ssid_;
     bc_message.index_ = sign_key.local_party_.index_;
-    bc_message.map_party_id_X_ = ctx->local_party_.map_party_id_X_;
-    bc_message.map_party_id_A_ = ctx->local_party_.map_remote_party_id_A_;
+    safeheron::mpc_flow::common::PartyArrayToMap(ctx->local_party_.X_arr_, ctx->party_id_arr_, bc_message.map_party_id_X_);
+    safeheron::mpc_flow::common::PartyArrayToMap(ctx->local_party_.A_arr_, ctx->party_id_arr_, bc_message.map_party_id_A_,
+                                                 ctx->get_local_party_pos());
     bc_message.c_ = ctx->local_party_.c_;
     bc_message.Y_ = sign_key.local_party_.Y_;
     bc_message.B_ = ctx->local_party_.B_;
@@ -13,12 +13,14 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
 
-    Round1() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST) {}
+    Round1() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST) {}
 
     void Init() override;
 
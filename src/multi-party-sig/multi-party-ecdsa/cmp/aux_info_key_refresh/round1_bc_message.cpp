@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -24,7 +25,6 @@ bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::au
     bool ok = true;
 
     string str;
-    safeheron::proto::CurvePoint point;
 
     str = safeheron::encode::hex::EncodeToHex(ssid_);
     message.set_ssid(str);
@@ -57,13 +57,11 @@ bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::au
         if (!ok) return false;
     }
 
-    ok = Y_.ToProtoObject(point);
+    ok = Y_.ToProtoObject(*message.mutable_g_y());
     if (!ok) return false;
-    message.mutable_g_y()->CopyFrom(point);
 
-    ok = B_.ToProtoObject(point);
+    ok = B_.ToProtoObject(*message.mutable_b());
     if (!ok) return false;
-    message.mutable_b()->CopyFrom(point);
 
     N_.ToHexStr(str);
     message.set_n(str);
@@ -74,10 +72,8 @@ bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::au
     t_.ToHexStr(str);
     message.set_t(str);
 
-    safeheron::proto::TwoDLNProof two_dln_proof;
-    ok = psi_tilde_.ToProtoObject(two_dln_proof);
+    ok = psi_tilde_.ToProtoObject(*message.mutable_psi_tilde());
     if (!ok) return false;
-    message.mutable_psi_tilde()->CopyFrom(two_dln_proof);
 
     str = safeheron::encode::hex::EncodeToHex(rho_);
     message.set_rho(str);
@@ -171,7 +167,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::aux_info_key_refresh::Round1BC
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -185,7 +182,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -195,7 +193,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -209,7 +208,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
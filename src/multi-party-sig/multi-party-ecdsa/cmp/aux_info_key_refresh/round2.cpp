@@ -4,6 +4,8 @@
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/round2.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::hash::CSafeHash256;
@@ -13,6 +15,9 @@ using safeheron::curve::CurveType;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::zkp::pail::PailProof;
+using safeheron::mpc_flow::common::TranscriptWriter;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -20,17 +25,17 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -46,12 +51,12 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
     const Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -73,6 +78,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
     // Verify DLN Proof (N, s, t)
     bc_message_arr_[pos].psi_tilde_.SetSalt(ctx->remote_parties_[pos].ssid_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].psi_tilde_.Verify(bc_message_arr_[pos].N_, bc_message_arr_[pos].s_, bc_message_arr_[pos].t_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].psi_tilde_.Verify(message_arr_[pos].N_, message_arr_[pos].s_, message_arr_[pos].t_);");
@@ -82,67 +88,48 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     // Verify V = H( ssid || i || X_arr || A_arr || Y || B || N || s || t || psi_tilde || rho || flag_update_minimal_key || u )
     uint8_t digest[CSafeHash256::OUTPUT_SIZE];
     CSafeHash256 sha256;
-    string buf;
+    TranscriptWriter<CSafeHash256> transcript(sha256);
     // sid
-    sha256.Write(reinterpret_cast<const unsigned char *>(bc_message_arr_[pos].ssid_.c_str()), bc_message_arr_[pos].ssid_.size());
+    transcript.Append(bc_message_arr_[pos].ssid_);
     // index
-    bc_message_arr_[pos].index_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].index_);
     // X
     for(const auto &item: bc_message_arr_[pos].map_party_id_X_){
-        item.second.EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(item.second);
     }
     // c
     for(size_t i = 0; i < bc_message_arr_[pos].c_.size(); ++i){
-        bc_message_arr_[pos].c_[i].EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(bc_message_arr_[pos].c_[i]);
     }
     // A
     for(const auto &item: bc_message_arr_[pos].map_party_id_A_){
-        item.second.EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(item.second);
     }
     // Y
-    bc_message_arr_[pos].Y_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].Y_);
     // B
-    bc_message_arr_[pos].B_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].B_);
     // N
-    bc_message_arr_[pos].N_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].N_);
     // s
-    bc_message_arr_[pos].s_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].s_);
     // t
-    bc_message_arr_[pos].t_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].t_);
     // psi_tilde
     for(size_t i = 0; i < ctx->local_party_.psi_tilde_.dln_proof_1_.alpha_arr_.size(); ++i){
-        bc_message_arr_[pos].psi_tilde_.dln_proof_1_.alpha_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-        bc_message_arr_[pos].psi_tilde_.dln_proof_1_.t_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(bc_message_arr_[pos].psi_tilde_.dln_proof_1_.alpha_arr_[i]);
+        transcript.Append(bc_message_arr_[pos].psi_tilde_.dln_proof_1_.t_arr_[i]);
     }
     for(size_t i = 0; i < ctx->local_party_.psi_tilde_.dln_proof_2_.alpha_arr_.size(); ++i){
-        bc_message_arr_[pos].psi_tilde_.dln_proof_2_.alpha_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-        bc_message_arr_[pos].psi_tilde_.dln_proof_2_.t_arr_[i].ToBytesBE(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(bc_message_arr_[pos].psi_tilde_.dln_proof_2_.alpha_arr_[i]);
+        transcript.Append(bc_message_arr_[pos].psi_tilde_.dln_proof_2_.t_arr_[i]);
     }
     // rho
-    sha256.Write(reinterpret_cast<const unsigned char *>(bc_message_arr_[pos].rho_.c_str()), bc_message_arr_[pos].rho_.size());
+    transcript.Append(bc_message_arr_[pos].rho_);
     //flag_update_minimal_key
-    if (ctx->flag_update_minimal_key_) {
-        std::string bool_str = "true";
-        sha256.Write(reinterpret_cast<const unsigned char *>(bool_str.c_str()), bool_str.size());
-    } else {
-        std::string bool_str = "false";
-        sha256.Write(reinterpret_cast<const unsigned char *>(bool_str.c_str()), bool_str.size());
-    }
+    transcript.Append(ctx->flag_update_minimal_key_ ? "true" : "false");
     // u
-    sha256.Write(reinterpret_cast<const unsigned char *>(bc_message_arr_[pos].u_.c_str()), bc_message_arr_[pos].u_.size());
+    transcript.Append(bc_message_arr_[pos].u_);
     sha256.Finalize(digest);
 
     // check Commitment
@@ -152,6 +139,16 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
+    // From party ids to party positions
+    std::vector<CurvePoint> X_arr;
+    std::vector<CurvePoint> A_arr;
+    ok = safeheron::mpc_flow::common::PartyArrayFromMap(bc_message_arr_[pos].map_party_id_X_, ctx->party_id_arr_, X_arr)
+         && safeheron::mpc_flow::common::PartyArrayFromMap(bc_message_arr_[pos].map_party_id_A_, ctx->party_id_arr_, A_arr, pos);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Party ids of map_party_id_X_ or map_party_id_A_ don't match the parties!");
+        return false;
+    }
+
     std::vector<BN> share_index_arr;
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         share_index_arr.push_back(sign_key.remote_parties_[i].index_);
@@ -161,9 +158,9 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     std::vector<BN> l_arr;
     Polynomial::GetLArray(l_arr, BN::ZERO, share_index_arr, curv->n);
 
-    CurvePoint ExpectedX = bc_message_arr_[pos].map_party_id_X_.at(sign_key.local_party_.party_id_) * l_arr.back();
-    for(size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-        ExpectedX += bc_message_arr_[pos].map_party_id_X_.at(sign_key.remote_parties_[i].party_id_) * l_arr[i];
+    CurvePoint ExpectedX = X_arr[0] * l_arr[0];
+    for(size_t i = 1; i < X_arr.size(); ++i) {
+        ExpectedX += X_arr[i] * l_arr[i];
     }
     ok = (ExpectedX == curv->g * BN(0));
     if (!ok) {
@@ -172,8 +169,8 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     }
 
     // Save( X, A, Y, B, N, s, t, rho, u)
-    ctx->remote_parties_[pos].map_party_id_X_ = bc_message_arr_[pos].map_party_id_X_;
-    ctx->remote_parties_[pos].map_remote_party_id_A_ = bc_message_arr_[pos].map_party_id_A_;
+    ctx->remote_parties_[pos].X_arr_ = std::move(X_arr);
+    ctx->remote_parties_[pos].A_arr_ = std::move(A_arr);
     ctx->remote_parties_[pos].c_ = bc_message_arr_[pos].c_;
     ctx->remote_parties_[pos].B_ = bc_message_arr_[pos].B_;
     ctx->remote_parties_[pos].rho_ = bc_message_arr_[pos].rho_;
@@ -188,7 +185,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
     const curve::Curve *curv = ctx->GetCurrentCurve();
@@ -208,6 +205,7 @@ bool Round2::ComputeVerify() {
     ctx->local_party_.psi_.Prove(sign_key.local_party_.N_,
                                  sign_key.local_party_.p_,
                                  sign_key.local_party_.q_);
+    CountPrimitive(Primitive::ZKProve);
 
     // No small factor proof
     for(size_t j = 0; j < sign_key.remote_parties_.size(); ++j){
@@ -218,30 +216,34 @@ bool Round2::ComputeVerify() {
         safeheron::zkp::no_small_factor_proof::NoSmallFactorWitness witness(sign_key.local_party_.p_, sign_key.local_party_.q_);
         ctx->remote_parties_[j].phi_.SetSalt(ctx->local_party_.sid_rho_index_);
         ctx->remote_parties_[j].phi_.Prove(set_up, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
 
     // C = Enc(x) for every remote party
     // DlogProof for x
     for(size_t j = 0; j < sign_key.remote_parties_.size(); ++j){
         safeheron::pail::PailPubKey pail_pub(sign_key.remote_parties_[j].N_, sign_key.remote_parties_[j].N_ + 1);
-        BN &tau = ctx->local_party_.map_remote_party_id_tau_[sign_key.remote_parties_[j].party_id_];
-        BN &x = ctx->local_party_.map_party_id_x_[sign_key.remote_parties_[j].party_id_];
+        const BN &tau = ctx->local_party_.tau_arr_[j];
+        const BN &x = ctx->local_party_.x_arr_[j];
 
         ctx->remote_parties_[j].C_ = pail_pub.Encrypt(x);
+        CountPrimitive(Primitive::PailEncrypt);
         ctx->remote_parties_[j].psi_.SetSalt(ctx->local_party_.sid_rho_index_);
         ctx->remote_parties_[j].psi_.ProveWithREx(x, tau, ctx->GetCurrentCurveType());
+        CountPrimitive(Primitive::ZKProve);
     }
 
     // Schnorr Proof
     ctx->local_party_.pi_.SetSalt(ctx->local_party_.sid_rho_index_);
     ctx->local_party_.pi_.ProveWithREx(ctx->local_party_.y_, ctx->local_party_.tau_, ctx->GetCurrentCurveType());
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -29,28 +30,20 @@ bool Round2P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::a
     index_.ToHexStr(str);
     message.set_index(str);
 
-    safeheron::proto::PailBlumModulusProof pail_blum_modulus_proof;
-    ok = psi_.ToProtoObject(pail_blum_modulus_proof);
+    ok = psi_.ToProtoObject(*message.mutable_psi());
     if (!ok) return false;
-    message.mutable_psi()->CopyFrom(pail_blum_modulus_proof);
 
-    safeheron::proto::NoSmallFactorProof no_small_factor_proof;
-    ok = phi_ij_.ToProtoObject(no_small_factor_proof);
+    ok = phi_ij_.ToProtoObject(*message.mutable_phi_ij());
     if (!ok) return false;
-    message.mutable_phi_ij()->CopyFrom(no_small_factor_proof);
 
-    safeheron::proto::DLogProof_V2 dlog_proof_0;
-    ok = pi_.ToProtoObject(dlog_proof_0);
+    ok = pi_.ToProtoObject(*message.mutable_pi());
     if (!ok) return false;
-    message.mutable_pi()->CopyFrom(dlog_proof_0);
 
     C_.ToHexStr(str);
     message.set_c(str);
 
-    safeheron::proto::DLogProof_V2 dlog_proof_1;
-    ok = psi_ij_.ToProtoObject(dlog_proof_1);
+    ok = psi_ij_.ToProtoObject(*message.mutable_psi_ij());
     if (!ok) return false;
-    message.mutable_psi_ij()->CopyFrom(dlog_proof_1);
 
     return true;
 }
@@ -87,7 +80,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::aux_info_key_refresh::Round2P2
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -101,7 +95,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -111,7 +106,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -125,7 +121,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/round3.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -10,6 +11,8 @@ using safeheron::sss::Polynomial;
 using safeheron::curve::CurveType;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -19,17 +22,17 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -45,12 +48,12 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
     bool ok = true;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -69,9 +72,10 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
     const BN mu = lambda.InvM(N);
     safeheron::pail::PailPrivKey pail_priv(lambda, mu, N);
     BN x = pail_priv.Decrypt(p2p_message_arr_[pos].C_);
+    CountPrimitive(Primitive::PailDecrypt);
     x = x % q;
     CurvePoint X = curv->g * x;
-    CurvePoint expected_X = ctx->remote_parties_[pos].map_party_id_X_[sign_key.local_party_.party_id_];
+    const CurvePoint &expected_X = ctx->remote_parties_[pos].X_arr_[ctx->get_local_party_pos()];
     ok = (X == expected_X);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = (X == expected_X)");
@@ -92,6 +96,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
     }
 
     p2p_message_arr_[pos].psi_.SetSalt(ctx->remote_parties_[pos].ssid_rho_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_.Verify(sign_key.remote_parties_[pos].N_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].psi_.Verify(sign_key.remote_parties_[pos].N_)");
@@ -103,6 +108,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
                                                                      sign_key.local_party_.t_);
     safeheron::zkp::no_small_factor_proof::NoSmallFactorStatement statement(sign_key.remote_parties_[pos].N_, 256, 512);
     p2p_message_arr_[pos].phi_ij_.SetSalt(ctx->remote_parties_[pos].ssid_rho_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].phi_ij_.Verify(set_up, statement);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].psi_.Verify(sign_key.remote_parties_[pos].N_)");
@@ -110,6 +116,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
     }
 
     p2p_message_arr_[pos].pi_.SetSalt(ctx->remote_parties_[pos].ssid_rho_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].pi_.Verify(sign_key.remote_parties_[pos].Y_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].pi_.Verify(expected_X)");
@@ -123,12 +130,13 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 
 
     p2p_message_arr_[pos].psi_ij_.SetSalt(ctx->remote_parties_[pos].ssid_rho_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_ij_.Verify(expected_X);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].psi_ij_.Verify(ctx->remote_parties_[pos].Y_)");
         return false;
     }
-    CurvePoint expected_A = ctx->remote_parties_[pos].map_remote_party_id_A_[sign_key.local_party_.party_id_];
+    const CurvePoint &expected_A = ctx->remote_parties_[pos].A_arr_[ctx->get_local_party_pos()];
     ok = (p2p_message_arr_[pos].psi_ij_.A_ == expected_A);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in (message_arr_[pos].psi_ij_.A_ == expected_A)");
@@ -142,24 +150,19 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 
 bool Round3::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
 
     if (ctx->flag_update_minimal_key_) {
         // Update private key share and public key share of local party
-        const auto iter0 = ctx->local_party_.map_party_id_x_.find(sign_key.local_party_.party_id_);
-        if (iter0 == ctx->local_party_.map_party_id_x_.end()) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__,
-                               "iter0 == ctx->local_party_.map_remote_party_id_X_.end()");
-            return false;
-        }
+        const size_t local_pos = ctx->get_local_party_pos();
         // Compute
         //  - x_i = x_i + \Sum_j{x_ij}
         //  - X_i = g * x_i
         BN x = sign_key.local_party_.x_;
         // add share(x_ij) from local party
-        x = (x + iter0->second) % curv->n;
+        x = (x + ctx->local_party_.x_arr_[local_pos]) % curv->n;
         for (const auto &remote_party: ctx->remote_parties_) {
             // add share(x_ij) from remote party
             x = (x + remote_party.x_) % curv->n;
@@ -170,24 +173,10 @@ bool Round3::ComputeVerify() {
         // Update public key share of remote parties
         // Compute X_i = X_i + \Sum_j{X_ij}
         for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-            const string &current_party_id = sign_key.remote_parties_[i].party_id_;
             CurvePoint X = sign_key.remote_parties_[i].X_;
-            const auto iter1 = ctx->local_party_.map_party_id_X_.find(current_party_id);
-            if (iter1 == ctx->local_party_.map_party_id_X_.end()) {
-                ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__,
-                                   "ctx->local_party_.map_remote_party_id_X_.find(current_party_id)");
-                return false;
-            }
-            X += iter1->second;
+            X += ctx->local_party_.X_arr_[i];
             for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-                const auto &remote_party = ctx->remote_parties_[j];
-                const auto iter2 = remote_party.map_party_id_X_.find(current_party_id);
-                if (iter2 == remote_party.map_party_id_X_.end()) {
-                    ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__,
-                                       "remote_party.map_party_id_X_.find(current_party_id)");
-                    return false;
-                }
-                X += iter2->second;
+                X += ctx->remote_parties_[j].X_arr_[i];
             }
             sign_key.remote_parties_[i].X_ = X;
         }
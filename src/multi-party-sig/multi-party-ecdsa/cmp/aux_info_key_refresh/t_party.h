@@ -38,13 +38,15 @@ public:
     safeheron::curve::CurvePoint B_; // B = g^tau
     safeheron::bignum::BN y_;
 
-    std::map<std::string, safeheron::bignum::BN> map_remote_party_id_tau_;
-    std::map<std::string, safeheron::curve::CurvePoint> map_remote_party_id_A_; // A = g^tau
+    // Indexed by position of the remote party
+    std::vector<safeheron::bignum::BN> tau_arr_;
+    std::vector<safeheron::curve::CurvePoint> A_arr_; // A = g^tau
 
 //    safeheron::bignum::BN x_;
 //    safeheron::curve::CurvePoint X_;
-    std::map<std::string, safeheron::bignum::BN> map_party_id_x_;
-    std::map<std::string, safeheron::curve::CurvePoint> map_party_id_X_;
+    // Indexed by party position, see Context::party_id_arr_
+    std::vector<safeheron::bignum::BN> x_arr_;
+    std::vector<safeheron::curve::CurvePoint> X_arr_;
     std::vector<safeheron::curve::CurvePoint> c_; // Commitment of VSS Scheme
     std::vector<safeheron::bignum::BN> f_arr_;
 
@@ -67,9 +69,11 @@ public:
     std::string V_;
     safeheron::bignum::BN x_;
     safeheron::curve::CurvePoint B_; // B = g^tau
-    std::map<std::string, safeheron::curve::CurvePoint> map_party_id_X_;
+    // Indexed by party position, see Context::party_id_arr_
+    std::vector<safeheron::curve::CurvePoint> X_arr_;
     std::vector<safeheron::curve::CurvePoint> c_; // Commitment of VSS Scheme
-    std::map<std::string, safeheron::curve::CurvePoint> map_remote_party_id_A_; // A = g^tau
+    // A = g^tau, indexed by party position, none for the remote party itself
+    std::vector<safeheron::curve::CurvePoint> A_arr_;
     safeheron::zkp::no_small_factor_proof::NoSmallFactorProof phi_;
     safeheron::zkp::dlog::DLogProof_V2 psi_;
     safeheron::bignum::BN C_;
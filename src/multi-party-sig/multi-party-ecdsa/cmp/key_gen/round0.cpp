@@ -6,7 +6,7 @@ namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_gen {
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     bool ok = ctx->minimal_key_gen_ctx_.PushMessage();
     if (!ok) {
         std::string err_info = safeheron::multi_party_ecdsa::cmp::get_err_info(ctx);
@@ -20,7 +20,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector <std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector <std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     ctx->minimal_key_gen_ctx_.PopMessages(out_p2p_msg_arr, out_bc_msg, out_des_arr);
 
     return true;
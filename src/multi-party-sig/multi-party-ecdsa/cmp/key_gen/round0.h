@@ -5,10 +5,12 @@ namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_gen {
-class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
-    Round0() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
+    Round0() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg,
                   const std::string &party_id) override { return true; }
@@ -6,7 +6,7 @@ namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_gen {
 bool Round1_6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     bool ok = true;
     std::string err_info;
@@ -69,7 +69,7 @@ bool Round1_6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, c
 
 bool Round1_6::MakeMessage(std::vector <std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                            std::vector <std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     if (ctx->get_cur_round() < ctx->minimal_key_gen_ctx_.get_total_rounds() - 1) {
         ctx->minimal_key_gen_ctx_.PopMessages(out_p2p_msg_arr, out_bc_msg, out_des_arr);
     } else if (ctx->get_cur_round() < ctx->get_total_rounds() - 1) {
@@ -5,10 +5,12 @@ namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp{
 namespace key_gen {
-class Round1_6 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1_6 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
-    Round1_6() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
-                          safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
+    Round1_6() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+                               safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg,
                   const std::string &party_id) override;
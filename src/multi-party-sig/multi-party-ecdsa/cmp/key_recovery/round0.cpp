@@ -4,6 +4,10 @@
 #include "crypto-suites/crypto-hash/safe_hash256.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/round0.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -11,7 +15,7 @@ namespace cmp {
 namespace key_recovery {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(ctx->curve_type_);
     if (!curv) {
@@ -36,33 +40,28 @@ bool Round0::ComputeVerify() {
 
     // Compute \phi_i = \mathcal{M}(prove, \Pi^{log}, (X_i); (x_i, r_i))
     ctx->local_party_.phi_i_.ProveWithREx(ctx->x_i_, ctx->local_party_.r_i_, ctx->curve_type_);
+    CountPrimitive(Primitive::ZKProve);
 
     // Compute V_i = H(X_i, i, j, k, A_i, B_i, R_i, T_i , \phi_{i})
     safeheron::hash::CSafeHash256 sha256;
     uint8_t digest[safeheron::hash::CSafeHash256::OUTPUT_SIZE];
 
+    safeheron::mpc_flow::common::TranscriptWriter<safeheron::hash::CSafeHash256> transcript(sha256);
     std::string buf;
-    ctx->local_party_.X_i_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.X_i_);
 
-    ctx->local_party_.i_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-    ctx->local_party_.j_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-    ctx->local_party_.k_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.i_);
+    transcript.Append(ctx->local_party_.j_);
+    transcript.Append(ctx->local_party_.k_);
 
-    ctx->local_party_.A_i_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.A_i_);
 
-    ctx->local_party_.R_i_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.R_i_);
 
-    ctx->local_party_.T_i_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.T_i_);
 
     ctx->local_party_.phi_i_.ToBase64(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(buf);
 
     sha256.Finalize(digest);
     ctx->local_party_.V_i_.assign((const char*)digest, sizeof(digest));
@@ -72,7 +71,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     out_p2p_msg_arr.clear();
     out_bc_msg.clear();
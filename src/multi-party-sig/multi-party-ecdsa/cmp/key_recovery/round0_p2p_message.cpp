@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using google::protobuf::util::Status;
 using google::protobuf::util::MessageToJsonString;
@@ -31,7 +32,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::key_recovery::Round0P2PMessage
 bool Round0P2PMessage::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -45,7 +47,8 @@ bool Round0P2PMessage::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -55,7 +58,8 @@ bool Round0P2PMessage::FromBase64(const std::string &b64) {
 bool Round0P2PMessage::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -68,7 +72,8 @@ bool Round0P2PMessage::ToJsonString(std::string &json_str) const {
 }
 
 bool Round0P2PMessage::FromJsonString(const std::string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
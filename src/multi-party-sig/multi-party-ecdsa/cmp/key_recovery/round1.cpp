@@ -5,7 +5,7 @@ namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_recovery {
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     if(party_id != ctx->remote_party_.party_id_) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -22,21 +22,21 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     ctx->remote_party_.V_j_ = p2p_message_.V_;
 
     return true;
 }
 
 bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     return true;
 }
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                  std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     out_p2p_msg_arr.clear();
     out_bc_msg.clear();
@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using google::protobuf::util::Status;
 using google::protobuf::util::MessageToJsonString;
@@ -16,12 +17,9 @@ bool Round1P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::k
     bool ok = true;
 
     std::string str;
-    safeheron::proto::CurvePoint point;
-    safeheron::proto::DLogProof_V2 dlog_proof;
 
-    ok = X_.ToProtoObject(point);
+    ok = X_.ToProtoObject(*message.mutable_x());
     if (!ok) return false;
-    message.mutable_x()->CopyFrom(point);
 
     i_.ToHexStr(str);
     message.set_i(str);
@@ -32,21 +30,17 @@ bool Round1P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::k
     k_.ToHexStr(str);
     message.set_k(str);
 
-    ok = A_.ToProtoObject(point);
+    ok = A_.ToProtoObject(*message.mutable_a());
     if (!ok) return false;
-    message.mutable_a()->CopyFrom(point);
 
-    ok = R_.ToProtoObject(point);
+    ok = R_.ToProtoObject(*message.mutable_r());
     if (!ok) return false;
-    message.mutable_r()->CopyFrom(point);
 
-    ok = T_.ToProtoObject(point);
+    ok = T_.ToProtoObject(*message.mutable_t());
     if (!ok) return false;
-    message.mutable_t()->CopyFrom(point);
 
-    ok = phi_.ToProtoObject(dlog_proof);
+    ok = phi_.ToProtoObject(*message.mutable_phi());
     if (!ok) return false;
-    message.mutable_phi()->CopyFrom(dlog_proof);
 
     return true;
 }
@@ -89,7 +83,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::key_recovery::Round1P2PMessage
 bool Round1P2PMessage::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -103,7 +98,8 @@ bool Round1P2PMessage::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -113,7 +109,8 @@ bool Round1P2PMessage::FromBase64(const std::string &b64) {
 bool Round1P2PMessage::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -126,7 +123,8 @@ bool Round1P2PMessage::ToJsonString(std::string &json_str) const {
 }
 
 bool Round1P2PMessage::FromJsonString(const std::string &json_str) {
-    ProtoObject  proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -2,13 +2,17 @@
 #include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/context.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_recovery {
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     if(party_id != ctx->remote_party_.party_id_) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -25,7 +29,7 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     if (p2p_message_.i_ != ctx->local_party_.j_
         || p2p_message_.j_ != ctx->local_party_.i_
@@ -34,6 +38,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
+    CountPrimitive(Primitive::ZKVerify);
     bool ok = p2p_message_.phi_.Verify(p2p_message_.X_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message_.phi_.Verify(ctx->remote_parties_.X_)");
@@ -48,28 +53,22 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     safeheron::hash::CSafeHash256 sha256;
     uint8_t digest[safeheron::hash::CSafeHash256::OUTPUT_SIZE];
 
+    safeheron::mpc_flow::common::TranscriptWriter<safeheron::hash::CSafeHash256> transcript(sha256);
     std::string buf;
-    p2p_message_.X_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(p2p_message_.X_);
 
-    p2p_message_.i_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-    p2p_message_.j_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-    p2p_message_.k_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(p2p_message_.i_);
+    transcript.Append(p2p_message_.j_);
+    transcript.Append(p2p_message_.k_);
 
-    p2p_message_.A_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(p2p_message_.A_);
 
-    p2p_message_.R_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(p2p_message_.R_);
 
-    p2p_message_.T_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(p2p_message_.T_);
 
     p2p_message_.phi_.ToBase64(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(buf);
 
     sha256.Finalize(digest);
     std::string remote_V((const char*)digest, sizeof(digest));
@@ -89,7 +88,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(ctx->curve_type_);
     if (!curv) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ctx->curve_type_ is invalid!");
@@ -128,13 +127,14 @@ bool Round2::ComputeVerify() {
     ctx->local_party_.X_ki_ = curv->g * ctx->x_ki_;
     // Compute \psi_{i} = \mathcal{M}(prove, \Pi^{log}, (X_{k,i}); (x_{k,i}, t_i))
     ctx->local_party_.psi_i_.ProveWithREx(ctx->x_ki_, ctx->local_party_.t_i_, ctx->curve_type_);
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                  std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     out_p2p_msg_arr.clear();
     out_bc_msg.clear();
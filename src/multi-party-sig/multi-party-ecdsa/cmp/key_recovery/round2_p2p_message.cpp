@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using google::protobuf::util::Status;
 using google::protobuf::util::MessageToJsonString;
@@ -16,15 +17,12 @@ bool Round2P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::k
     bool ok = true;
 
     safeheron::proto::CurvePoint point ;
-    safeheron::proto::DLogProof_V2 dlog_proof;
 
-    ok = X_ki_.ToProtoObject(point);
+    ok = X_ki_.ToProtoObject(*message.mutable_x_ki());
     if (!ok) return false;
-    message.mutable_x_ki()->CopyFrom(point);
 
-    ok = psi_.ToProtoObject(dlog_proof);
+    ok = psi_.ToProtoObject(*message.mutable_psi());
     if (!ok) return false;
-    message.mutable_psi()->CopyFrom(dlog_proof);
 
     return true;
 }
@@ -45,7 +43,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::key_recovery::Round2P2PMessage
 bool Round2P2PMessage::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -59,7 +58,8 @@ bool Round2P2PMessage::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -69,7 +69,8 @@ bool Round2P2PMessage::FromBase64(const std::string &b64) {
 bool Round2P2PMessage::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -82,7 +83,8 @@ bool Round2P2PMessage::ToJsonString(std::string &json_str) const {
 }
 
 bool Round2P2PMessage::FromJsonString(const std::string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -1,11 +1,14 @@
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/key_recovery/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_recovery {
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     if(party_id != ctx->remote_party_.party_id_) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -22,9 +25,10 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
 
     // \mathcal{M}(Verify, \Pi^{log}, (X_{k,j}), \psi_{j}) = 1
+    CountPrimitive(Primitive::ZKVerify);
     bool ok = p2p_message_.psi_.Verify(p2p_message_.X_ki_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message_.psi_.Verify(bc_message_.S_i_)");
@@ -42,7 +46,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round3::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(ctx->curve_type_);
     if (!curv) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ctx->curve_type_ is invalid!");
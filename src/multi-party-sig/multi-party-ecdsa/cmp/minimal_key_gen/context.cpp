@@ -25,6 +25,9 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     minimal_sign_key_ = ctx.minimal_sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
+    party_id_arr_ = ctx.party_id_arr_;
+    sorted_party_pos_arr_ = ctx.sorted_party_pos_arr_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -50,6 +53,9 @@ Context &Context::operator=(const Context &ctx){
     minimal_sign_key_ = ctx.minimal_sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
+    party_id_arr_ = ctx.party_id_arr_;
+    sorted_party_pos_arr_ = ctx.sorted_party_pos_arr_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -110,6 +116,8 @@ bool Context::CreateContext(Context &ctx,
     std::sort(t_party_index_arr.begin(), t_party_index_arr.end());
     ctx.ComputeSID(sid);
 
+    ctx.IndexParties();
+
     return true;
 }
 
@@ -127,6 +135,16 @@ bool Context::CreateContext(Context &ctx,
     return CreateContext(ctx, curve_type, threshold, n_parties, x, index, local_party_id, remote_party_index_arr, remote_party_id_arr, sid);
 }
 
+void Context::IndexParties() {
+    remote_party_pos_index_.Build(minimal_sign_key_.remote_parties_);
+    party_id_arr_.clear();
+    for (const auto &party: minimal_sign_key_.remote_parties_) {
+        party_id_arr_.push_back(party.party_id_);
+    }
+    party_id_arr_.push_back(minimal_sign_key_.local_party_.party_id_);
+    safeheron::mpc_flow::common::SortPartyPositions(party_id_arr_, sorted_party_pos_arr_);
+}
+
 void Context::ComputeSID(const std::string &sid){
     // Compute sid = (sid, g, q, P)
     const curve::Curve *curv = curve::GetCurveParam(curve_type_);
@@ -5,6 +5,8 @@
 
 #include <vector>
 #include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/common/party_array.h"
+#include "multi-party-sig/mpc-flow/common/party_index.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/party.h"
@@ -40,6 +42,15 @@ public:
 public:
     void BindAllRounds();
 
+    /**
+     * Position of a remote party in remote_parties_ of the sign key, -1 if not found. It is looked up in an index
+     * built by CreateContext.
+     */
+    int get_remote_party_pos(const std::string &party_id) const { return remote_party_pos_index_.Find(party_id); }
+
+    // Position of the local party in per party arrays, after the remote parties
+    size_t get_local_party_pos() const { return minimal_sign_key_.remote_parties_.size(); }
+
     static bool CreateContext(Context &ctx,
                               safeheron::curve::CurveType curve_type,
                               uint32_t threshold, uint32_t n_parties,
@@ -75,11 +86,20 @@ public:
 
     void ComputeSID_Index_RID();
 
+    // Build the index of the remote parties and the positions of all parties, once the sign key is set.
+    void IndexParties();
+
 public:
     safeheron::curve::CurveType curve_type_;
     MinimalSignKey minimal_sign_key_;
     LocalTParty local_party_;
     std::vector<RemoteTParty> remote_parties_;
+    // Party id -> position in remote_parties_, not to be confused with the Shamir share index index_
+    safeheron::mpc_flow::common::PartyIndex remote_party_pos_index_;
+    // Id of the party at each position: the remote parties, then the local party
+    std::vector<std::string> party_id_arr_;
+    // Positions sorted by party id, the order of the digests
+    std::vector<size_t> sorted_party_pos_arr_;
     Round0 round0_;
     Round1 round1_;
     Round2 round2_;
@@ -4,6 +4,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/context.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
 
 using std::string;
 using std::vector;
@@ -11,6 +12,7 @@ using std::map;
 using safeheron::hash::CSafeHash256;
 using safeheron::bignum::BN;
 using safeheron::curve::CurvePoint;
+using safeheron::mpc_flow::common::TranscriptWriter;
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -18,7 +20,7 @@ namespace cmp{
 namespace minimal_key_gen {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     const curve::Curve* curv = ctx->GetCurrentCurve();
 
@@ -71,11 +73,12 @@ bool Round0::ComputeVerify() {
                                                                  ctx->local_party_.f_arr_,
                                                                  curv->n,
                                                                  curv->g);
-    ctx->local_party_.map_party_id_x_[minimal_sign_key.local_party_.party_id_] = share_points[share_index_arr.size() - 1].y;
-    ctx->local_party_.map_party_id_X_[minimal_sign_key.local_party_.party_id_] = curv->g * share_points[share_index_arr.size() - 1].y;
-    for(size_t j = 0; j < minimal_sign_key.n_parties_ - 1; ++j){
-        ctx->local_party_.map_party_id_x_[minimal_sign_key.remote_parties_[j].party_id_] = share_points[j].y;
-        ctx->local_party_.map_party_id_X_[minimal_sign_key.remote_parties_[j].party_id_] = curv->g * share_points[j].y;
+    // share_points are in the order of the party positions
+    ctx->local_party_.x_arr_.clear();
+    ctx->local_party_.X_arr_.clear();
+    for(size_t j = 0; j < share_points.size(); ++j){
+        ctx->local_party_.x_arr_.push_back(share_points[j].y);
+        ctx->local_party_.X_arr_.push_back(curv->g * share_points[j].y);
     }
 
     safeheron::rand::RandomBytes(buf32, sizeof(buf32));
@@ -84,36 +87,29 @@ bool Round0::ComputeVerify() {
     // V_i = H(sid, i, rid_i, X_i, A_i, B_i, {c_i = g * f_i}, {X_i} u_i)
     uint8_t digest[CSafeHash256::OUTPUT_SIZE];
     CSafeHash256 sha256;
-    string buf;
+    TranscriptWriter<CSafeHash256> transcript(sha256);
     // sid
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->sid_.c_str()), ctx->sid_.size());
+    transcript.Append(ctx->sid_);
     // index
-    minimal_sign_key.local_party_.index_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(minimal_sign_key.local_party_.index_);
     // rid
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->local_party_.rid_.c_str()), ctx->local_party_.rid_.size());
+    transcript.Append(ctx->local_party_.rid_);
     // X
-    ctx->local_party_.X_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.X_);
     // A
-    ctx->local_party_.A_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.A_);
     // B
-    ctx->local_party_.B_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(ctx->local_party_.B_);
     // c
     for(size_t k = 0; k < ctx->local_party_.c_.size(); ++k){
-        ctx->local_party_.c_[k].EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(ctx->local_party_.c_[k]);
     }
     // map_id_X
-    map<string, CurvePoint>::iterator iter;
-    for(iter = ctx->local_party_.map_party_id_X_.begin(); iter != ctx->local_party_.map_party_id_X_.end(); ++iter){
-        iter->second.EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    for(size_t pos : ctx->sorted_party_pos_arr_){
+        transcript.Append(ctx->local_party_.X_arr_[pos]);
     }
     // u
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->local_party_.u_.c_str()), ctx->local_party_.u_.size());
+    transcript.Append(ctx->local_party_.u_);
     sha256.Finalize(digest);
 
     ctx->local_party_.V_.assign((const char*)digest, sizeof(digest));
@@ -123,7 +119,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     out_p2p_msg_arr.clear();
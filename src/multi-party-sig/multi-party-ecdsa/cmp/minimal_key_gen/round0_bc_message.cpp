@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -55,7 +56,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::minimal_key_gen::Round0BCMessa
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -69,7 +71,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -79,7 +82,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -93,7 +97,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -17,17 +17,17 @@ namespace cmp{
 namespace minimal_key_gen {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -43,11 +43,11 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -67,7 +67,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     return true;
@@ -76,7 +76,7 @@ bool Round1::ComputeVerify() {
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -91,7 +91,7 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         Round1P2PMessage p2p_message;
         p2p_message.sid_ = ctx->sid_;
         p2p_message.index_ = minimal_sign_key.local_party_.index_;
-        p2p_message.x_ij_ = ctx->local_party_.map_party_id_x_[minimal_sign_key.remote_parties_[j].party_id_];
+        p2p_message.x_ij_ = ctx->local_party_.x_arr_[j];
         string base64;
         bool ok = p2p_message.ToBase64(base64);
         if (!ok) {
@@ -109,7 +109,7 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.A_ = ctx->local_party_.A_;
     bc_message.B_ = ctx->local_party_.B_;
     bc_message.c_ = ctx->local_party_.c_;
-    bc_message.map_party_id_X_ = ctx->local_party_.map_party_id_X_;
+    safeheron::mpc_flow::common::PartyArrayToMap(ctx->local_party_.X_arr_, ctx->party_id_arr_, bc_message.map_party_id_X_);
     bc_message.u_ = ctx->local_party_.u_;
     ok = bc_message.ToBase64(out_bc_msg);
     if (!ok) {
@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -32,18 +33,14 @@ bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::mi
     str = safeheron::encode::hex::EncodeToHex(rid_);
     message.set_rid(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = X_.ToProtoObject(point);
+    ok = X_.ToProtoObject(*message.mutable_g_x());
     if (!ok) return false;
-    message.mutable_g_x()->CopyFrom(point);
 
-    ok = A_.ToProtoObject(point);
+    ok = A_.ToProtoObject(*message.mutable_a());
     if (!ok) return false;
-    message.mutable_a()->CopyFrom(point);
 
-    ok = B_.ToProtoObject(point);
+    ok = B_.ToProtoObject(*message.mutable_b());
     if (!ok) return false;
-    message.mutable_b()->CopyFrom(point);
 
     for(const auto &item :map_party_id_X_){
         message.add_party_id_arr_1(item.first);
@@ -121,7 +118,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::minimal_key_gen::Round1BCMessa
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -135,7 +133,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -145,7 +144,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -159,7 +159,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -5,6 +5,8 @@
 #include "multi-party-sig/mpc-flow/common/sid_maker.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/round2.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -16,6 +18,9 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::zkp::pail::PailProof;
 using safeheron::mpc_flow::common::SIDMaker;
+using safeheron::mpc_flow::common::TranscriptWriter;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -23,7 +28,7 @@ namespace cmp {
 namespace minimal_key_gen {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -31,10 +36,10 @@ void Round2::Init() {
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -56,12 +61,12 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
     const Curve *curv = ctx->GetCurrentCurve();
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -82,38 +87,30 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     // Check V_j == H(sid, j, rid_j, X_j, A_j, B_j, {c_j = g * f_j}, {X_j}, u_j)
     uint8_t digest[CSafeHash256::OUTPUT_SIZE];
     CSafeHash256 sha256;
-    string buf;
+    TranscriptWriter<CSafeHash256> transcript(sha256);
     // sid
-    sha256.Write(reinterpret_cast<const unsigned char *>(bc_message_arr_[pos].sid_.c_str()),
-                 bc_message_arr_[pos].sid_.size());
+    transcript.Append(bc_message_arr_[pos].sid_);
     // index
-    bc_message_arr_[pos].index_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].index_);
     // rid
-    sha256.Write(reinterpret_cast<const unsigned char *>(bc_message_arr_[pos].rid_.c_str()),
-                 bc_message_arr_[pos].rid_.size());
+    transcript.Append(bc_message_arr_[pos].rid_);
     // X
-    bc_message_arr_[pos].X_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].X_);
     // A
-    bc_message_arr_[pos].A_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].A_);
     // B
-    bc_message_arr_[pos].B_.EncodeFull(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(bc_message_arr_[pos].B_);
     // c
     for (size_t k = 0; k < bc_message_arr_[pos].c_.size(); ++k) {
-        bc_message_arr_[pos].c_[k].EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(bc_message_arr_[pos].c_[k]);
     }
     // map_id_X
     map<string, CurvePoint>::iterator iter;
     for (iter = bc_message_arr_[pos].map_party_id_X_.begin(); iter != bc_message_arr_[pos].map_party_id_X_.end(); ++iter) {
-        iter->second.EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(iter->second);
     }
     // u
-    sha256.Write(reinterpret_cast<const unsigned char *>(bc_message_arr_[pos].u_.c_str()), bc_message_arr_[pos].u_.size());
+    transcript.Append(bc_message_arr_[pos].u_);
     sha256.Finalize(digest);
 
     // check Commitment
@@ -146,17 +143,19 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
-    iter = bc_message_arr_[pos].map_party_id_X_.find(minimal_sign_key.local_party_.party_id_);
-    if(iter == ctx->remote_parties_[pos].map_party_id_X_.end()){
+    // From party ids to party positions
+    std::vector<CurvePoint> X_arr;
+    ok = safeheron::mpc_flow::common::PartyArrayFromMap(bc_message_arr_[pos].map_party_id_X_, ctx->party_id_arr_, X_arr);
+    if(!ok){
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__,
-                           "invalid party_id : iter = ctx->local_party_.map_party_id_X_.find(minimal_sign_key.remote_parties_[pos].party_id_)");
+                           "Party ids of map_party_id_X_ don't match the parties!");
         return false;
     }
 
-    ok = iter->second == curv->g * p2p_message_arr_[pos].x_ij_;
+    ok = X_arr[ctx->get_local_party_pos()] == curv->g * p2p_message_arr_[pos].x_ij_;
     if(!ok){
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__,
-                           "ok = iter->second == curv->g * message_arr_[pos].x_ij_");
+                           "ok = X_arr[ctx->get_local_party_pos()] == curv->g * message_arr_[pos].x_ij_");
         return false;
     }
 
@@ -175,7 +174,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     // save F_arr
     ctx->remote_parties_[pos].c_ = bc_message_arr_[pos].c_;
     // save map_id_X
-    ctx->remote_parties_[pos].map_party_id_X_ = bc_message_arr_[pos].map_party_id_X_;
+    ctx->remote_parties_[pos].X_arr_ = std::move(X_arr);
     // save x_ij
     ctx->remote_parties_[pos].x_ij_ = p2p_message_arr_[pos].x_ij_;
 
@@ -183,28 +182,28 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
     const curve::Curve *curv = ctx->GetCurrentCurve();
 
-    BN x = ctx->local_party_.map_party_id_x_[minimal_sign_key.local_party_.party_id_];
+    const size_t local_pos = ctx->get_local_party_pos();
+    BN x = ctx->local_party_.x_arr_[local_pos];
     for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
         x = (x + ctx->remote_parties_[j].x_ij_) % curv->n;
     }
     minimal_sign_key.local_party_.x_ = x;
 
     // set X^*
-    CurvePoint X_star = ctx->local_party_.map_party_id_X_[minimal_sign_key.local_party_.party_id_];
+    CurvePoint X_star = ctx->local_party_.X_arr_[local_pos];
     for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-        X_star += ctx->remote_parties_[j].map_party_id_X_[minimal_sign_key.local_party_.party_id_];
+        X_star += ctx->remote_parties_[j].X_arr_[local_pos];
     }
     minimal_sign_key.local_party_.X_ = X_star;
-    map<string, CurvePoint>::iterator iter;
     for (size_t k = 0; k < ctx->remote_parties_.size(); ++k) {
-        X_star = ctx->local_party_.map_party_id_X_[minimal_sign_key.remote_parties_[k].party_id_];
+        X_star = ctx->local_party_.X_arr_[k];
         for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-            X_star += ctx->remote_parties_[j].map_party_id_X_[minimal_sign_key.remote_parties_[k].party_id_];
+            X_star += ctx->remote_parties_[j].X_arr_[k];
         }
         minimal_sign_key.remote_parties_[k].X_ = X_star;
     }
@@ -221,16 +220,18 @@ bool Round2::ComputeVerify() {
     // Schnorr Non-interactive Zero-Knowledge Proof
     ctx->local_party_.psi_.SetSalt(ctx->local_party_.sid_index_rid_);
     ctx->local_party_.psi_.ProveWithREx(ctx->local_party_.x_, ctx->local_party_.tau_, ctx->GetCurrentCurveType());
+    CountPrimitive(Primitive::ZKProve);
 
     ctx->local_party_.phi_.SetSalt(ctx->local_party_.sid_index_rid_);
     ctx->local_party_.phi_.ProveWithREx(minimal_sign_key.local_party_.x_, ctx->local_party_.r_, ctx->GetCurrentCurveType());
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     out_p2p_msg_arr.clear();
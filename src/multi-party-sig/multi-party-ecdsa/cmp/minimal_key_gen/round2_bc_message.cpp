@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -29,15 +30,11 @@ bool Round2BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::mi
     index_.ToHexStr(str);
     message.set_index(str);
 
-    safeheron::proto::DLogProof_V2 dlog_proof_1;
-    ok = psi_.ToProtoObject(dlog_proof_1);
+    ok = psi_.ToProtoObject(*message.mutable_psi());
     if (!ok) return false;
-    message.mutable_psi()->CopyFrom(dlog_proof_1);
 
-    safeheron::proto::DLogProof_V2 dlog_proof_2;
-    ok = phi_.ToProtoObject(dlog_proof_2);
+    ok = phi_.ToProtoObject(*message.mutable_phi());
     if (!ok) return false;
-    message.mutable_phi()->CopyFrom(dlog_proof_2);
 
     return true;
 }
@@ -66,7 +63,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::minimal_key_gen::Round2BCMessa
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -80,7 +78,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -90,7 +89,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -104,7 +104,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
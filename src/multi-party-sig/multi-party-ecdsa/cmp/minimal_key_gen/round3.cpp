@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/round3.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -10,6 +11,8 @@ using safeheron::sss::Polynomial;
 using safeheron::curve::CurveType;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -19,17 +22,17 @@ namespace cmp{
 namespace minimal_key_gen {
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -45,11 +48,11 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
 
-    int pos = minimal_sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -67,6 +70,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
         return false;
     }
     bc_message_arr_[pos].psi_.SetSalt(ctx->remote_parties_[pos].sid_index_rid_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].psi_.Verify(ctx->remote_parties_[pos].X_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Receive a differentr g^sign_key_share, or failed to verify schnorr proof of sign_key share!");
@@ -79,6 +83,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
         return false;
     }
     bc_message_arr_[pos].phi_.SetSalt(ctx->remote_parties_[pos].sid_index_rid_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].phi_.Verify(minimal_sign_key.remote_parties_[pos].X_);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Receive a differentr g^sign_key_share, or failed to verify schnorr proof of sign_key share!");
@@ -90,7 +95,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 
 bool Round3::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
 
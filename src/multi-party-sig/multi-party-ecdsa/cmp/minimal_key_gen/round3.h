@@ -12,12 +12,14 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace minimal_key_gen {
 
-class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round2BCMessage> bc_message_arr_;
 
-    Round3() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
+    Round3() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     void Init() override;
 
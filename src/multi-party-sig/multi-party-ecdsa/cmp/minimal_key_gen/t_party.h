@@ -33,8 +33,9 @@ public:
     std::string V_;
     safeheron::zkp::dlog::DLogProof_V2 psi_;
     safeheron::zkp::dlog::DLogProof_V2 phi_;
-    std::map<std::string, safeheron::bignum::BN> map_party_id_x_;
-    std::map<std::string, safeheron::curve::CurvePoint> map_party_id_X_;
+    // Indexed by party position, see Context::party_id_arr_
+    std::vector<safeheron::bignum::BN> x_arr_;
+    std::vector<safeheron::curve::CurvePoint> X_arr_;
     std::vector<safeheron::curve::CurvePoint> c_; // Commitment of VSS Scheme
     std::vector<safeheron::bignum::BN> f_arr_;
 };
@@ -52,7 +53,8 @@ public:
     std::string V_;
     safeheron::zkp::dlog::DLogProof_V2 psi_;
     safeheron::zkp::dlog::DLogProof_V2 phi_;
-    std::map<std::string, safeheron::curve::CurvePoint> map_party_id_X_;
+    // Indexed by party position, see Context::party_id_arr_
+    std::vector<safeheron::curve::CurvePoint> X_arr_;
     std::vector<safeheron::curve::CurvePoint> c_; // Commitment of VSS Scheme
 };
 
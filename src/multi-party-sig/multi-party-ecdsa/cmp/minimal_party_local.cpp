@@ -3,6 +3,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_party.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -32,10 +33,8 @@ bool MinimalLocalParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::
     x_.ToHexStr(str);
     party.set_x(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = X_.ToProtoObject(point);
+    ok = X_.ToProtoObject(*party.mutable_g_x());
     if (!ok) return false;
-    party.mutable_g_x()->CopyFrom(point);
 
     return true;
 }
@@ -70,7 +69,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::MinimalParty ProtoObject;
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -84,7 +84,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -94,7 +95,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -108,7 +110,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -4,6 +4,7 @@
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_sign_key.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using std::vector;
@@ -41,23 +42,16 @@ bool MinimalSignKey::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::Min
     sign_key.set_threshold(threshold_);
     sign_key.set_n_parties(n_parties_);
 
-    safeheron::proto::multi_party_ecdsa::cmp::MinimalParty local_party;
-    ok = local_party_.ToProtoObject(local_party);
+    ok = local_party_.ToProtoObject(*sign_key.mutable_local_party());
     if (!ok) return false;
-    sign_key.mutable_local_party()->CopyFrom(local_party);
 
     for (size_t i = 0; i < remote_parties_.size(); i++) {
-        safeheron::proto::multi_party_ecdsa::cmp::MinimalParty remote_party;
-        ok = remote_parties_[i].ToProtoObject(remote_party);
+        ok = remote_parties_[i].ToProtoObject(*sign_key.add_remote_parties());
         if (!ok) return false;
-        safeheron::proto::multi_party_ecdsa::cmp::MinimalParty *new_party = sign_key.add_remote_parties();
-        new_party->CopyFrom(remote_party);
     }
 
-    safeheron::proto::CurvePoint point;
-    ok = X_.ToProtoObject(point);
+    ok = X_.ToProtoObject(*sign_key.mutable_g_x());
     if (!ok) return false;
-    sign_key.mutable_g_x()->CopyFrom(point);
 
     str = safeheron::encode::hex::EncodeToHex(rid_);
     sign_key.set_rid(str);
@@ -130,7 +124,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::MinimalSignKey ProtoObject;
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -144,7 +139,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -154,7 +150,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -168,7 +165,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
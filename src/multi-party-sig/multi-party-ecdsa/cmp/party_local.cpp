@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/party.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -30,14 +31,11 @@ bool LocalParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::Party &
     x_.ToHexStr(str);
     party.set_x(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = X_.ToProtoObject(point);
+    ok = X_.ToProtoObject(*party.mutable_g_x());
     if (!ok) return false;
-    party.mutable_g_x()->CopyFrom(point);
 
-    ok = Y_.ToProtoObject(point);
+    ok = Y_.ToProtoObject(*party.mutable_g_y());
     if (!ok) return false;
-    party.mutable_g_y()->CopyFrom(point);
 
     N_.ToHexStr(str);
     party.set_n(str);
@@ -123,7 +121,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::Party ProtoObject;
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -137,7 +136,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -147,7 +147,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -161,7 +162,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -1,5 +1,6 @@
 
 
+#include <algorithm>
 #include <utility>
 #include "crypto-suites/crypto-bn/bn.h"
 #include "crypto-suites/crypto-bn/rand.h"
@@ -24,7 +25,8 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace sign {
 
-Context::Context(int total_parties): MPCContext(total_parties){
+Context::Context(int total_parties): MPCContext(total_parties),
+                                     identification_parallelism_(0), identification_time_budget_ms_(0){
     // Assign all the member variables.
     // End Assignments.
     BindAllRounds();
@@ -38,6 +40,9 @@ Context::Context(const Context &ctx): MPCContext(ctx){
 
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
+    party_id_arr_ = ctx.party_id_arr_;
+    party_pos_index_ = ctx.party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -59,6 +64,8 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     identify_round_index_ = ctx.identify_round_index_;
     identify_need_proof_in_pre_sign_phase_ = ctx.identify_need_proof_in_pre_sign_phase_;
     identify_need_proof_in_sign_phase_ = ctx.identify_need_proof_in_sign_phase_;
+    identification_parallelism_ = ctx.identification_parallelism_;
+    identification_time_budget_ms_ = ctx.identification_time_budget_ms_;
     // End Assignments.
 
     BindAllRounds();
@@ -78,6 +85,9 @@ Context &Context::operator=(const Context &ctx){
 
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
+    party_id_arr_ = ctx.party_id_arr_;
+    party_pos_index_ = ctx.party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -99,6 +109,8 @@ Context &Context::operator=(const Context &ctx){
     identify_round_index_ = ctx.identify_round_index_;
     identify_need_proof_in_pre_sign_phase_ = ctx.identify_need_proof_in_pre_sign_phase_;
     identify_need_proof_in_sign_phase_ = ctx.identify_need_proof_in_sign_phase_;
+    identification_parallelism_ = ctx.identification_parallelism_;
+    identification_time_budget_ms_ = ctx.identification_time_budget_ms_;
     // End Assignments.
 
     BindAllRounds();
@@ -131,22 +143,9 @@ static void PreprocessSignKey(SignKey &sign_key){
     }
 }
 
-bool Context::CreateContext(Context &ctx,
-                            const std::string &sign_key_base64,
-                            const safeheron::bignum::BN &m,
-                            const std::string &ssid) {
-    bool ok = true;
-
-    // Parse the sign key
-    SignKey &sign_key = ctx.sign_key_;
-    ok = sign_key.FromBase64(sign_key_base64);
-    if (!ok) return false;
-    ok = ((int)sign_key.n_parties_ == ctx.get_total_parties());
-    if (!ok) return false;
-
-    // Preprocessing to generate additive shards
-    PreprocessSignKey(sign_key);
-
+// Set up the context once sign_key_ holds the additive shards of the participants.
+static bool InitContext(Context &ctx, const safeheron::bignum::BN &m, const std::string &ssid) {
+    const SignKey &sign_key = ctx.sign_key_;
     ctx.m_ = m;
 
     // set Paillier key pair of local party
@@ -167,9 +166,54 @@ bool Context::CreateContext(Context &ctx,
     ctx.ComputeSSID(ssid);
     ctx.ComputeSSID_Index();
 
+    ctx.remote_party_pos_index_.Build(ctx.sign_key_.remote_parties_);
+    ctx.party_id_arr_.clear();
+    ctx.party_id_arr_.push_back(sign_key.local_party_.party_id_);
+    for (const auto &party: sign_key.remote_parties_) {
+        ctx.party_id_arr_.push_back(party.party_id_);
+    }
+    std::sort(ctx.party_id_arr_.begin(), ctx.party_id_arr_.end());
+    ctx.party_pos_index_.Build(ctx.party_id_arr_);
+
+    // Bound of the low S form, used in round 4
+    ctx.round4_.half_n_ = ctx.GetCurrentCurve()->n / 2;
+
     return true;
 }
 
+bool Context::CreateContext(Context &ctx,
+                            const std::string &sign_key_base64,
+                            const safeheron::bignum::BN &m,
+                            const std::string &ssid) {
+    bool ok = true;
+
+    // Parse the sign key
+    SignKey &sign_key = ctx.sign_key_;
+    ok = sign_key.FromBase64(sign_key_base64);
+    if (!ok) return false;
+    ok = ((int)sign_key.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+
+    // Preprocessing to generate additive shards
+    PreprocessSignKey(sign_key);
+
+    return InitContext(ctx, m, ssid);
+}
+
+bool Context::CreateContext(Context &ctx,
+                            const SignKeyView &sign_key_view,
+                            const safeheron::bignum::BN &m,
+                            const std::string &ssid) {
+    bool ok = true;
+
+    // The shards are additive already
+    ok = ((int)sign_key_view.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+    ctx.sign_key_ = sign_key_view.sign_key_;
+
+    return InitContext(ctx, m, ssid);
+}
+
 void Context::BindAllRounds() {
     RemoveAllRounds();
     AddRound(&round0_);
@@ -181,7 +225,7 @@ void Context::BindAllRounds() {
 
 bool Context::IsValidPartyID(const std::string& party_id)  const{
     if(sign_key_.local_party_.party_id_ == party_id) return true;
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     return (pos != -1);
 }
 
@@ -189,7 +233,7 @@ std::string Context::GetSSIDIndex(const std::string& party_id) const{
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.ssid_index_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].ssid_index_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -199,7 +243,7 @@ const safeheron::pail::PailPubKey& Context::GetPailPub(const std::string& party_
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.pail_pub_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].pail_pub_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -208,7 +252,7 @@ const safeheron::bignum::BN& Context::GetK(const std::string& party_id)  const{
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.K_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].K_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -217,7 +261,7 @@ const safeheron::bignum::BN& Context::GetG(const std::string& party_id)  const{
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.G_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].G_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -226,7 +270,7 @@ const safeheron::bignum::BN& Context::GetDelta(const std::string& party_id)  con
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.delta_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].delta_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -235,7 +279,7 @@ const safeheron::bignum::BN& Context::GetSigma(const std::string& party_id)  con
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.sigma_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].sigma_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -244,7 +288,7 @@ const safeheron::curve::CurvePoint& Context::GetGamma(const std::string& party_i
     if(sign_key_.local_party_.party_id_ == party_id) {
         return local_party_.Gamma_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return remote_parties_[pos].Gamma_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -253,7 +297,7 @@ const safeheron::curve::CurvePoint& Context::GetX(const std::string& party_id)
     if(sign_key_.local_party_.party_id_ == party_id) {
         return sign_key_.local_party_.X_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return sign_key_.remote_parties_[pos].X_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -262,7 +306,7 @@ const safeheron::bignum::BN& Context::GetN(const std::string& party_id)  const{
     if(sign_key_.local_party_.party_id_ == party_id) {
         return sign_key_.local_party_.N_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return sign_key_.remote_parties_[pos].N_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -271,7 +315,7 @@ const safeheron::bignum::BN& Context::GetS(const std::string& party_id)  const{
     if(sign_key_.local_party_.party_id_ == party_id) {
         return sign_key_.local_party_.s_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return sign_key_.remote_parties_[pos].s_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -280,7 +324,7 @@ const safeheron::bignum::BN& Context::GetT(const std::string& party_id)  const{
     if(sign_key_.local_party_.party_id_ == party_id) {
         return sign_key_.local_party_.t_;
     }
-    int pos = sign_key_.get_remote_party_pos(party_id);
+    int pos = get_remote_party_pos(party_id);
     if(pos != -1) return sign_key_.remote_parties_[pos].t_;
     throw LocatedException(__FILE__, __LINE__, __FUNCTION__, -1, ("Invalid party_id: " + party_id).c_str());;
 }
@@ -301,6 +345,30 @@ void Context::ExportD_hat_F_hat(std::map<std::string, std::map<std::string,safeh
     }
 }
 
+void Context::ExportDF(safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D,
+                       safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F) const{
+    if (all_D.size() != party_id_arr_.size()) all_D.Reset(party_id_arr_.size());
+    if (all_F.size() != party_id_arr_.size()) all_F.Reset(party_id_arr_.size());
+    size_t i = (size_t)get_party_pos(sign_key_.local_party_.party_id_);
+    for(size_t j = 0; j < sign_key_.remote_parties_.size(); ++j){
+        size_t pos_j = (size_t)get_party_pos(sign_key_.remote_parties_[j].party_id_);
+        all_D.Set(i, pos_j, remote_parties_[j].D_ji);
+        all_F.Set(i, pos_j, remote_parties_[j].F_ji);
+    }
+}
+
+void Context::ExportD_hat_F_hat(safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D_hat,
+                                safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F_hat) const{
+    if (all_D_hat.size() != party_id_arr_.size()) all_D_hat.Reset(party_id_arr_.size());
+    if (all_F_hat.size() != party_id_arr_.size()) all_F_hat.Reset(party_id_arr_.size());
+    size_t i = (size_t)get_party_pos(sign_key_.local_party_.party_id_);
+    for(size_t j = 0; j < sign_key_.remote_parties_.size(); ++j){
+        size_t pos_j = (size_t)get_party_pos(sign_key_.remote_parties_[j].party_id_);
+        all_D_hat.Set(i, pos_j, remote_parties_[j].D_hat_ji);
+        all_F_hat.Set(i, pos_j, remote_parties_[j].F_hat_ji);
+    }
+}
+
 void Context::ComputeSSID(const std::string &sid){
     // Compute ssid = (sid, g, q, P, rid, X, Y, N, s, t)
     const curve::Curve *curv = curve::GetCurveParam(sign_key_.X_.GetCurveType());
@@ -5,10 +5,13 @@
 #include <vector>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/common/party_array.h"
+#include "multi-party-sig/mpc-flow/common/party_index.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign_key.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/t_party.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign/sign_key_view.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round1.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round2.h"
@@ -40,11 +43,31 @@ public:
 public:
     void BindAllRounds();
 
+    /**
+     * Position of a remote party in remote_parties_ of the sign key, -1 if not found. It is looked up in an index
+     * built by CreateContext.
+     */
+    int get_remote_party_pos(const std::string &party_id) const { return remote_party_pos_index_.Find(party_id); }
+
+    /**
+     * Position of a party, local or remote, in party_id_arr_, -1 if not found.
+     */
+    int get_party_pos(const std::string &party_id) const { return party_pos_index_.Find(party_id); }
+
     static bool CreateContext(Context &ctx,
                               const std::string &sign_key_base64,
                               const safeheron::bignum::BN &m,
                               const std::string &ssid);
 
+    /**
+     * Same as above, with no decoding of the sign key and no Lagrange interpolation.
+     * @param sign_key_view view of the participants, see SignKeyViewCache.
+     */
+    static bool CreateContext(Context &ctx,
+                              const SignKeyView &sign_key_view,
+                              const safeheron::bignum::BN &m,
+                              const std::string &ssid);
+
     const safeheron::curve::Curve * GetCurrentCurve() const{
         assert(sign_key_.X_.GetCurveType() != safeheron::curve::CurveType::INVALID_CURVE);
         const safeheron::curve::Curve* curv = safeheron::curve::GetCurveParam(sign_key_.X_.GetCurveType());;
@@ -76,15 +99,31 @@ public:
     void ExportD_hat_F_hat(std::map<std::string, std::map<std::string,safeheron::bignum::BN>> &all_D_hat,
                            std::map<std::string, std::map<std::string,safeheron::bignum::BN>> &all_F_hat) const;
 
+    /**
+     * Same as above, into matrices indexed by the positions of the parties in party_id_arr_. All the parties export
+     * into the same matrices, which are resized to n x n if needed.
+     */
+    void ExportDF(safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D,
+                  safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F) const;
+
+    void ExportD_hat_F_hat(safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D_hat,
+                           safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F_hat) const;
+
     bool BuildProofInPreSignPhase(){ return round3_.BuildProof();}
     bool VerifyProof(std::map<std::string, ProofInPreSignPhase> &map_proof,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_D,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F){ return round3_.VerifyProof(map_proof, all_D, all_F); }
+    bool VerifyProof(std::map<std::string, ProofInPreSignPhase> &map_proof,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F){ return round3_.VerifyProof(map_proof, all_D, all_F); }
 
     bool BuildProofInSignPhase(){ return round4_.BuildProof();}
     bool VerifyProof(std::map<std::string, ProofInSignPhase> &map_proof,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_D_hat,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F_hat){ return round4_.VerifyProof(map_proof, all_D_hat, all_F_hat); }
+    bool VerifyProof(std::map<std::string, ProofInSignPhase> &map_proof,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D_hat,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F_hat){ return round4_.VerifyProof(map_proof, all_D_hat, all_F_hat); }
 
     void Identify(const std::string &culprit,
                   int32_t round_index,
@@ -101,6 +140,11 @@ public:
     bool IdentifyNeedProofInPreSignPhase() const { return identify_need_proof_in_pre_sign_phase_; };
     bool IdentifyNeedProofInSignPhase() const { return identify_need_proof_in_sign_phase_; };
 
+    void SetIdentificationOptions(size_t parallelism, uint64_t time_budget_ms){
+        identification_parallelism_ = parallelism;
+        identification_time_budget_ms_ = time_budget_ms;
+    }
+
     void ComputeSSID(const std::string &sid);
 
     void ComputeSSID_Index();
@@ -112,6 +156,10 @@ public:
 
     LocalTParty local_party_;
     std::vector<RemoteTParty> remote_parties_;
+    safeheron::mpc_flow::common::PartyIndex remote_party_pos_index_;
+    // Ids of all the parties, sorted. The position of a party in a PartyMatrix is the same in every party.
+    std::vector<std::string> party_id_arr_;
+    safeheron::mpc_flow::common::PartyIndex party_pos_index_;
     Round0 round0_;
     Round1 round1_;
     Round2 round2_;
@@ -138,6 +186,11 @@ public:
     bool identify_need_proof_in_pre_sign_phase_;
     bool identify_need_proof_in_sign_phase_;
 
+    // Maximum number of threads building / verifying proofs for identification, 0 means std::thread::hardware_concurrency().
+    size_t identification_parallelism_;
+    // Time budget of building / verifying proofs for identification in milliseconds, 0 means no limit.
+    uint64_t identification_time_budget_ms_;
+
 };
 
 }
@@ -4,6 +4,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/identification.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -41,10 +42,8 @@ bool ProofInPreSignPhase::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp
         }
     }
 
-    safeheron::proto::PailEncMulProof t_pail_enc_mul_proof;
-    ok = pail_enc_mul_proof_.ToProtoObject(t_pail_enc_mul_proof);
+    ok = pail_enc_mul_proof_.ToProtoObject(*message.mutable_pail_enc_mul_proof());
     if (!ok) return false;
-    message.mutable_pail_enc_mul_proof()->CopyFrom(t_pail_enc_mul_proof);
 
     for (auto & pair : id_dec_proof_map_) {
         safeheron::proto::PailDecModuloProof t_pail_dec_proof;
@@ -97,7 +96,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::sign::ProofInPreSignPhase Prot
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -111,7 +111,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -121,7 +122,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -135,7 +137,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -5,6 +5,8 @@
 #include "crypto-suites/crypto-hash/safe_hash256.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/security_param.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/context.h"
@@ -21,6 +23,10 @@ using safeheron::hash::CSafeHash256;
 using safeheron::zkp::pail::PailEncRangeSetUp_V2;
 using safeheron::zkp::pail::PailEncRangeStatement_V2;
 using safeheron::zkp::pail::PailEncRangeProof_V2;
+using safeheron::mpc_flow::common::SampleEncRandomness;
+using safeheron::mpc_flow::common::EncryptWithRN;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 
 namespace safeheron {
@@ -29,7 +35,7 @@ namespace cmp{
 namespace sign {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
@@ -37,17 +43,18 @@ bool Round0::ComputeVerify() {
     ctx->local_party_.k_ = safeheron::rand::RandomBNLt(curv->n);
     ctx->local_party_.gamma_ = safeheron::rand::RandomBNLt(curv->n);
 
-    // Sample \rho_i, \nu_i in ZN*
-    ctx->local_party_.rho_ = safeheron::rand::RandomBNLtCoPrime(ctx->local_party_.pail_pub_.n());
-    ctx->local_party_.nu_ = safeheron::rand::RandomBNLtCoPrime(ctx->local_party_.pail_pub_.n());
+    // Sample \rho_i, \nu_i in ZN*, and take \rho_i^N, \nu_i^N from the precomputed pool if there is one
+    BN rho_pow_N, nu_pow_N;
+    SampleEncRandomness(ctx->local_party_.pail_pub_, ctx->local_party_.rho_, rho_pow_N);
+    SampleEncRandomness(ctx->local_party_.pail_pub_, ctx->local_party_.nu_, nu_pow_N);
 
     // \Gamma_i = g * \gamma_i
     ctx->local_party_.Gamma_ = curv->g * ctx->local_party_.gamma_;
 
     // G_i = enc_i(\gamma_i, \nu_i)
-    ctx->local_party_.G_ = ctx->local_party_.pail_pub_.EncryptNegWithR(ctx->local_party_.gamma_, ctx->local_party_.nu_);
+    ctx->local_party_.G_ = EncryptWithRN(ctx->local_party_.pail_pub_, ctx->local_party_.gamma_, nu_pow_N);
     // K_i = enc_i(\k_i, \rho_i)
-    ctx->local_party_.K_ = ctx->local_party_.pail_pub_.EncryptNegWithR(ctx->local_party_.k_, ctx->local_party_.rho_);
+    ctx->local_party_.K_ = EncryptWithRN(ctx->local_party_.pail_pub_, ctx->local_party_.k_, rho_pow_N);
 
     // MTA(k, gamma) / MTA(k, x)   - step 1
     // Party i prove to party j that K_i = enc_i(\k_i, \rho_i),  i != j
@@ -65,6 +72,7 @@ bool Round0::ComputeVerify() {
                                                   ctx->local_party_.rho_);
         ctx->remote_parties_[j].psi_0_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[j].psi_0_ji_.Prove(setup, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
 
     return true;
@@ -73,7 +81,7 @@ bool Round0::ComputeVerify() {
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
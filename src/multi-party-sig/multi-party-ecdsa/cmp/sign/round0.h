@@ -12,10 +12,12 @@ namespace cmp{
 namespace sign {
 
 
-class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
-    Round0() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST) {}
+    Round0() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override { return true; }
 
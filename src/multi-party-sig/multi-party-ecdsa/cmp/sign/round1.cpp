@@ -1,6 +1,8 @@
 
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/security_param.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round1.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/context.h"
@@ -27,6 +29,11 @@ using safeheron::zkp::pail::PailEncGroupEleRangeProof;
 using safeheron::zkp::pail::PailAffRangeSetUp;
 using safeheron::zkp::pail::PailAffRangeStatement;
 using safeheron::zkp::pail::PailAffRangeProof;
+using safeheron::mpc_flow::common::SampleEncRandomness;
+using safeheron::mpc_flow::common::EncryptWithRN;
+using safeheron::mpc_flow::common::HomomorphicAddPlainWithRN;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -36,7 +43,7 @@ namespace cmp{
 namespace sign {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -44,12 +51,12 @@ void Round1::Init() {
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -74,12 +81,12 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -126,6 +133,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
                                        SECURITY_PARAM_EPSILON);
 
     p2p_message_arr_[pos].psi_0_ij_.SetSalt(ctx->remote_parties_[pos].ssid_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_0_ij_.Verify(setup, statement);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
@@ -150,36 +158,37 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
  * @param c_a
  * @param b
  * @param beta
- * @param r1_lt_coprime_remote_pail_n
- * @param r2_lt_coprime_local_pail_n
+ * @param r1_pow_N: r1^N mod N_remote^2, where r1 is coprime with N_remote
+ * @param r2_pow_N: r2^N mod N_local^2, where r2 is coprime with N_local
  * @param cypher_alpha
  * @param cypher_beta
  */
 static void MTA_Step2(const pail::PailPubKey &remote_pub, const pail::PailPubKey &local_pub,
                const BN &cypher_a, const BN &b, const BN &beta,
-               const BN &r1_lt_coprime_remote_pail_n,
-               const BN &r2_lt_coprime_local_pail_n,
+               const BN &r1_pow_N,
+               const BN &r2_pow_N,
                BN &cypher_alpha,
                BN &cypher_beta){
     // cypher_alpha = a <hMul> b  <hAdd> negative_beta
     BN bma = remote_pub.HomomorphicMulPlain(cypher_a, b);
-    cypher_alpha = remote_pub.HomomorphicAddPlainWithR(bma, beta.Neg(), r1_lt_coprime_remote_pail_n);
-    cypher_beta = local_pub.EncryptNegWithR(beta.Neg(), r2_lt_coprime_local_pail_n);
+    cypher_alpha = HomomorphicAddPlainWithRN(remote_pub, bma, beta.Neg(), r1_pow_N);
+    cypher_beta = EncryptWithRN(local_pub, beta.Neg(), r2_pow_N);
 }
 
 bool Round1::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         // MTA(k, gamma) / MTA(k, x)
-        // Sample r_ij, s_ij, \hat{r}_ij, \hat{s}_ij in Zn*
-        ctx->remote_parties_[i].r_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.N_);
-        ctx->remote_parties_[i].s_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.remote_parties_[i].N_);
-        ctx->remote_parties_[i].r_hat_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.N_);
-        ctx->remote_parties_[i].s_hat_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.remote_parties_[i].N_);
+        // Sample r_ij, s_ij, \hat{r}_ij, \hat{s}_ij in Zn*, along with their N-th powers
+        BN r_pow_N, s_pow_N, r_hat_pow_N, s_hat_pow_N;
+        SampleEncRandomness(ctx->local_party_.pail_pub_, ctx->remote_parties_[i].r_ij_, r_pow_N);
+        SampleEncRandomness(ctx->remote_parties_[i].pail_pub_, ctx->remote_parties_[i].s_ij_, s_pow_N);
+        SampleEncRandomness(ctx->local_party_.pail_pub_, ctx->remote_parties_[i].r_hat_ij_, r_hat_pow_N);
+        SampleEncRandomness(ctx->remote_parties_[i].pail_pub_, ctx->remote_parties_[i].s_hat_ij_, s_hat_pow_N);
 
         // Sample \beta_ij, \hat{beta}_ij in limit_J
         ctx->remote_parties_[i].beta_ij_ = safeheron::rand::RandomNegBNInSymInterval(SECURITY_PARAM_LIMIT_J);
@@ -193,8 +202,8 @@ bool Round1::ComputeVerify() {
                   ctx->remote_parties_[i].K_,
                   ctx->local_party_.gamma_,
                   ctx->remote_parties_[i].beta_ij_,
-                  ctx->remote_parties_[i].s_ij_,
-                  ctx->remote_parties_[i].r_ij_,
+                  s_pow_N,
+                  r_pow_N,
                   ctx->remote_parties_[i].D_ji,
                   ctx->remote_parties_[i].F_ji);
 
@@ -206,8 +215,8 @@ bool Round1::ComputeVerify() {
                   ctx->remote_parties_[i].K_,
                   sign_key.local_party_.x_,
                   ctx->remote_parties_[i].beta_hat_ij_,
-                  ctx->remote_parties_[i].s_hat_ij_,
-                  ctx->remote_parties_[i].r_hat_ij_,
+                  s_hat_pow_N,
+                  r_hat_pow_N,
                   ctx->remote_parties_[i].D_hat_ji,
                   ctx->remote_parties_[i].F_hat_ji);
 
@@ -240,6 +249,7 @@ bool Round1::ComputeVerify() {
 
         ctx->remote_parties_[i].psi_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[i].psi_ji_.Prove(setup, statement_1, witness_1);
+        CountPrimitive(Primitive::ZKProve);
 
         // - Mta(k, x) step 2: bob proof
         // Prove that \hat{D}_ji is well formed, according to \PI^{aff-g}
@@ -265,6 +275,7 @@ bool Round1::ComputeVerify() {
 
         ctx->remote_parties_[i].psi_hat_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[i].psi_hat_ji_.Prove(setup, statement_2, witness_2);
+        CountPrimitive(Primitive::ZKProve);
 
         // Prove that according to \PI^{log*}
         // - G_i = enc_i(\gamma_i, \nu_i)
@@ -287,6 +298,7 @@ bool Round1::ComputeVerify() {
 
         ctx->remote_parties_[i].psi_prime_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[i].psi_prime_ji_.Prove(setup_3, statement_3, witness_3);
+        CountPrimitive(Primitive::ZKProve);
     }
 
     return true;
@@ -295,7 +307,7 @@ bool Round1::ComputeVerify() {
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
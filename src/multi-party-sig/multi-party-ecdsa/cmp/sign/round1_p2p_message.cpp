@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 
 using std::string;
@@ -30,10 +31,8 @@ bool Round1P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::s
     index_.ToHexStr(str);
     message.set_index(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = Gamma_.ToProtoObject(point);
+    ok = Gamma_.ToProtoObject(*message.mutable_g_gamma());
     if (!ok) return false;
-    message.mutable_g_gamma()->CopyFrom(point);
 
     D_ij_.ToHexStr(str);
     message.set_d_ij(str);
@@ -47,20 +46,14 @@ bool Round1P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::s
     F_hat_ij_.ToHexStr(str);
     message.set_f_hat_ij(str);
 
-    safeheron::proto::PailAffGroupEleRangeProof_V2 t_proof_1;
-    ok = psi_ij_.ToProtoObject(t_proof_1);
+    ok = psi_ij_.ToProtoObject(*message.mutable_psi_ij());
     if (!ok) return false;
-    message.mutable_psi_ij()->CopyFrom(t_proof_1);
 
-    safeheron::proto::PailAffGroupEleRangeProof_V2 t_proof_2;
-    ok = psi_hat_ij_.ToProtoObject(t_proof_2);
+    ok = psi_hat_ij_.ToProtoObject(*message.mutable_psi_hat_ij());
     if (!ok) return false;
-    message.mutable_psi_hat_ij()->CopyFrom(t_proof_2);
 
-    safeheron::proto::PailEncGroupEleRangeProof t_proof_3;
-    ok = psi_prime_ij_.ToProtoObject(t_proof_3);
+    ok = psi_prime_ij_.ToProtoObject(*message.mutable_psi_prime_ij());
     if (!ok) return false;
-    message.mutable_psi_prime_ij()->CopyFrom(t_proof_3);
 
     return true;
 }
@@ -105,7 +98,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::sign::Round1P2PMessage ProtoOb
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -119,7 +113,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -129,7 +124,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -143,7 +139,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
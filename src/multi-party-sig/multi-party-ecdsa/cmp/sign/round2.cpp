@@ -3,6 +3,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-hash/safe_hash256.h"
 #include "crypto-suites/crypto-encode/hex.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/security_param.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/context.h"
@@ -40,6 +41,8 @@ using safeheron::zkp::pail::PailEncGroupEleRangeProof;
 using safeheron::zkp::pail::PailAffRangeSetUp;
 using safeheron::zkp::pail::PailAffRangeStatement;
 using safeheron::zkp::pail::PailAffRangeProof;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -49,19 +52,19 @@ namespace cmp{
 namespace sign {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->Identify(party_id, ctx->get_cur_round());
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -81,12 +84,12 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->Identify(party_id, ctx->get_cur_round());
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -129,6 +132,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
             SECURITY_PARAM_EPSILON);
 
     p2p_message_arr_[pos].psi_ij_.SetSalt(ctx->remote_parties_[pos].ssid_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_ij_.Verify(setup, statement_1);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
@@ -153,6 +157,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
             SECURITY_PARAM_EPSILON);
 
     p2p_message_arr_[pos].psi_hat_ij_.SetSalt(ctx->remote_parties_[pos].ssid_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_hat_ij_.Verify(setup, statement_2);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
@@ -178,6 +183,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
             SECURITY_PARAM_EPSILON);
 
     p2p_message_arr_[pos].psi_prime_ij_.SetSalt(ctx->remote_parties_[pos].ssid_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_prime_ij_.Verify(setup_3, statement_3);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
@@ -196,7 +202,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
 bool Round2::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -219,8 +225,10 @@ bool Round2::ComputeVerify() {
     for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
         // \alpha_ij = dec_i{D_ij}
         ctx->remote_parties_[j].alpha_ij_ = ctx->local_party_.pail_priv_.DecryptNeg(p2p_message_arr_[j].D_ij_);
+        CountPrimitive(Primitive::PailDecrypt);
         // \hat{\alpha}_ij = dec_i{\hat{D}_ij}
         ctx->remote_parties_[j].alpha_hat_ij_ = ctx->local_party_.pail_priv_.DecryptNeg(p2p_message_arr_[j].D_hat_ij_);
+        CountPrimitive(Primitive::PailDecrypt);
     }
 
     // \delta_i = \gamma_i * \k_i + \Sum_{j!=i}{ \alpha_ij + \beta_ij }     mod q
@@ -259,6 +267,7 @@ bool Round2::ComputeVerify() {
 
         ctx->remote_parties_[j].psi_double_prime_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[j].psi_double_prime_ji_.Prove(setup, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
 
     return true;
@@ -267,7 +276,7 @@ bool Round2::ComputeVerify() {
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
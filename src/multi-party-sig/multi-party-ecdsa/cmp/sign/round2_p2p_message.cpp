@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -32,15 +33,11 @@ bool Round2P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::cmp::s
     delta_.ToHexStr(str);
     message.set_delta(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = Delta_.ToProtoObject(point);
+    ok = Delta_.ToProtoObject(*message.mutable_var_delta());
     if (!ok) return false;
-    message.mutable_var_delta()->CopyFrom(point);
 
-    safeheron::proto::PailEncGroupEleRangeProof t_proof_1;
-    ok = psi_double_prime_ij_.ToProtoObject(t_proof_1);
+    ok = psi_double_prime_ij_.ToProtoObject(*message.mutable_psi_double_prime_ij());
     if (!ok) return false;
-    message.mutable_psi_double_prime_ij()->CopyFrom(t_proof_1);
 
     return true;
 }
@@ -73,7 +70,8 @@ typedef safeheron::proto::multi_party_ecdsa::cmp::sign::Round2P2PMessage ProtoOb
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -87,7 +85,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -97,7 +96,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -111,7 +111,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
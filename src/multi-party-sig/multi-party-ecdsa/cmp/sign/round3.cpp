@@ -1,7 +1,10 @@
+#include <functional>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-hash/safe_hash256.h"
 #include "crypto-suites/crypto-encode/hex.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/security_param.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round3.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/context.h"
@@ -31,6 +34,10 @@ using safeheron::zkp::pail::PailDecModuloSetUp;
 using safeheron::zkp::pail::PailDecModuloStatement;
 using safeheron::zkp::pail::PailDecModuloWitness;
 using safeheron::zkp::pail::PailDecModuloProof;
+using safeheron::mpc_flow::common::ParallelForAll;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
+using safeheron::mpc_flow::common::PartyMatrix;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -56,19 +63,19 @@ static BN get_rho_in_pail_cypher(const BN& c, const BN& m, const BN& N, const BN
 }
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->Identify(party_id, ctx->get_cur_round());
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -88,11 +95,11 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
 
     ok = compare_bytes(ctx->ssid_, p2p_message_arr_[pos].ssid_) == 0;
     if (!ok) {
@@ -125,6 +132,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
             256, 512);
 
     p2p_message_arr_[pos].psi_double_prime_ij_.SetSalt(ctx->remote_parties_[pos].ssid_index_);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].psi_double_prime_ij_.Verify(setup, statement);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
@@ -141,7 +149,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 bool Round3::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -180,7 +188,7 @@ bool Round3::ComputeVerify() {
 bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -210,47 +218,55 @@ bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
 
 bool Round3::BuildProof() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
 
+    // All the proofs are independent, so they are collected as tasks and proved in parallel.
+    std::vector<std::function<void()>> task_arr;
+
     // (a) For l != i, party i reprove to party l that {D_{j,i}}_{j!=i,l} are well formed according to \PI^{aff-g}
+    std::vector<std::pair<size_t, size_t>> l_j_arr;
     for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
-        safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(sign_key.remote_parties_[l].N_,
-                                                                 sign_key.remote_parties_[l].s_,
-                                                                 sign_key.remote_parties_[l].t_);
-        // For each j != i,l, prove {D_{j,i}}_{j!=i,l} are well formed
         for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-            if (j != l) {
-                PailAffGroupEleRangeStatement_V2 statement(
-                        ctx->remote_parties_[j].pail_pub_.n(),
-                        ctx->remote_parties_[j].pail_pub_.n_sqr(),
-                        ctx->local_party_.pail_pub_.n(),
-                        ctx->local_party_.pail_pub_.n_sqr(),
-                        ctx->remote_parties_[j].K_,
-                        ctx->remote_parties_[j].D_ji,
-                        ctx->remote_parties_[j].F_ji,
-                        ctx->local_party_.Gamma_,
-                        curv->n,
-                        SECURITY_PARAM_L,
-                        SECURITY_PARAM_L_PRIME,
-                        SECURITY_PARAM_EPSILON);
-
-                PailAffGroupEleRangeWitness_V2 witness(
-                        ctx->local_party_.gamma_,
-                        ctx->remote_parties_[j].beta_ij_.Neg(),
-                        ctx->remote_parties_[j].s_ij_,
-                        ctx->remote_parties_[j].r_ij_);
-
-                PailAffGroupEleRangeProof_V2 proof;
-                proof.SetSalt(ctx->local_party_.ssid_index_);
-                proof.Prove(setup, statement, witness);
-                ctx->proof_in_pre_sign_phase_.id_map_map_[sign_key.remote_parties_[l].party_id_][sign_key.remote_parties_[j].party_id_] = proof;
-            }
+            if (j != l) l_j_arr.emplace_back(l, j);
         }
     }
+    std::vector<PailAffGroupEleRangeProof_V2> aff_proof_arr(l_j_arr.size());
+    for (size_t k = 0; k < l_j_arr.size(); ++k) {
+        task_arr.emplace_back([ctx, &sign_key, curv, &l_j_arr, &aff_proof_arr, k]() {
+            size_t l = l_j_arr[k].first;
+            size_t j = l_j_arr[k].second;
+            safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(sign_key.remote_parties_[l].N_,
+                                                                     sign_key.remote_parties_[l].s_,
+                                                                     sign_key.remote_parties_[l].t_);
+            // For each j != i,l, prove {D_{j,i}}_{j!=i,l} are well formed
+            PailAffGroupEleRangeStatement_V2 statement(
+                    ctx->remote_parties_[j].pail_pub_.n(),
+                    ctx->remote_parties_[j].pail_pub_.n_sqr(),
+                    ctx->local_party_.pail_pub_.n(),
+                    ctx->local_party_.pail_pub_.n_sqr(),
+                    ctx->remote_parties_[j].K_,
+                    ctx->remote_parties_[j].D_ji,
+                    ctx->remote_parties_[j].F_ji,
+                    ctx->local_party_.Gamma_,
+                    curv->n,
+                    SECURITY_PARAM_L,
+                    SECURITY_PARAM_L_PRIME,
+                    SECURITY_PARAM_EPSILON);
 
+            PailAffGroupEleRangeWitness_V2 witness(
+                    ctx->local_party_.gamma_,
+                    ctx->remote_parties_[j].beta_ij_.Neg(),
+                    ctx->remote_parties_[j].s_ij_,
+                    ctx->remote_parties_[j].r_ij_);
+
+            aff_proof_arr[k].SetSalt(ctx->local_party_.ssid_index_);
+            aff_proof_arr[k].Prove(setup, statement, witness);
+            CountPrimitive(Primitive::ZKProve);
+        });
+    }
 
     // (b) Compute H_i = Enc_i(k_i, gamma_i) and prove in ZK that H_i is well formed wrt K_i and G_i in \PI^{mul}
     // Sample rho in Z_N*
@@ -259,24 +275,25 @@ bool Round3::BuildProof() {
     BN c_k_gamma = (ctx->local_party_.G_.PowM(ctx->local_party_.k_, ctx->local_party_.pail_pub_.n_sqr())
                     * rho.PowM(ctx->local_party_.pail_pub_.n(), ctx->local_party_.pail_pub_.n_sqr())) %
                    ctx->local_party_.pail_pub_.n_sqr();
-    PailEncMulStatement statement(
-            ctx->local_party_.pail_pub_.n(),
-            ctx->local_party_.pail_pub_.n_sqr(),
-            ctx->local_party_.K_,
-            ctx->local_party_.G_,
-            c_k_gamma,
-            curv->n);
-
-    PailEncMulWitness witness(
-            ctx->local_party_.k_,
-            rho,
-            ctx->local_party_.rho_);
-
-    PailEncMulProof proof;
-    proof.SetSalt(ctx->local_party_.ssid_index_);
-    proof.Prove(statement, witness);
-    ctx->proof_in_pre_sign_phase_.pail_enc_mul_proof_ = proof;
-    ctx->proof_in_pre_sign_phase_.c_k_gamma_ = c_k_gamma;
+    PailEncMulProof enc_mul_proof;
+    task_arr.emplace_back([ctx, curv, &c_k_gamma, &rho, &enc_mul_proof]() {
+        PailEncMulStatement statement(
+                ctx->local_party_.pail_pub_.n(),
+                ctx->local_party_.pail_pub_.n_sqr(),
+                ctx->local_party_.K_,
+                ctx->local_party_.G_,
+                c_k_gamma,
+                curv->n);
+
+        PailEncMulWitness witness(
+                ctx->local_party_.k_,
+                rho,
+                ctx->local_party_.rho_);
+
+        enc_mul_proof.SetSalt(ctx->local_party_.ssid_index_);
+        enc_mul_proof.Prove(statement, witness);
+        CountPrimitive(Primitive::ZKProve);
+    });
 
     // (c) For l != i, prove in ZK that \delta is the plaintext value mod q of the cypher text obtained as
     //     H_i * \PI_{j!=i}{D_{i,j} * F_{j,i}} according to \PI^{dec}
@@ -306,27 +323,50 @@ bool Round3::BuildProof() {
     // prove that
     // - c_deta = Enc(raw_deta, rho)
     // - raw_delta = delta mod q
+    std::vector<PailDecModuloProof> dec_proof_arr(ctx->remote_parties_.size());
     for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
-        safeheron::zkp::pail::PailDecModuloSetUp setup(sign_key.remote_parties_[l].N_,
-                                                       sign_key.remote_parties_[l].s_,
-                                                       sign_key.remote_parties_[l].t_);
-        zkp::pail::PailDecModuloStatement statement(
-                curv->n,
-                ctx->local_party_.pail_pub_.n(),
-                ctx->local_party_.pail_pub_.n_sqr(),
-                c_deta,
-                ctx->local_party_.delta_,
-                SECURITY_PARAM_L,
-                SECURITY_PARAM_EPSILON);
-
-        PailDecModuloWitness witness(
-                raw_delta,
-                final_rho);
-
-        PailDecModuloProof proof;
-        proof.SetSalt(ctx->local_party_.ssid_index_);
-        proof.Prove(setup, statement, witness);
-        ctx->proof_in_pre_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = proof;
+        task_arr.emplace_back([ctx, &sign_key, curv, &c_deta, &raw_delta, &final_rho, &dec_proof_arr, l]() {
+            safeheron::zkp::pail::PailDecModuloSetUp setup(sign_key.remote_parties_[l].N_,
+                                                           sign_key.remote_parties_[l].s_,
+                                                           sign_key.remote_parties_[l].t_);
+            zkp::pail::PailDecModuloStatement statement(
+                    curv->n,
+                    ctx->local_party_.pail_pub_.n(),
+                    ctx->local_party_.pail_pub_.n_sqr(),
+                    c_deta,
+                    ctx->local_party_.delta_,
+                    SECURITY_PARAM_L,
+                    SECURITY_PARAM_EPSILON);
+
+            PailDecModuloWitness witness(
+                    raw_delta,
+                    final_rho);
+
+            dec_proof_arr[l].SetSalt(ctx->local_party_.ssid_index_);
+            dec_proof_arr[l].Prove(setup, statement, witness);
+            CountPrimitive(Primitive::ZKProve);
+        });
+    }
+
+    size_t failed_task;
+    ok = ParallelForAll(task_arr.size(), [&task_arr](size_t k) {
+        task_arr[k]();
+        return true;
+    }, failed_task, ctx->identification_parallelism_, ctx->identification_time_budget_ms_);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Time budget of building proofs ran out!");
+        return false;
+    }
+
+    for (size_t k = 0; k < l_j_arr.size(); ++k) {
+        const string &party_id_l = sign_key.remote_parties_[l_j_arr[k].first].party_id_;
+        const string &party_id_j = sign_key.remote_parties_[l_j_arr[k].second].party_id_;
+        ctx->proof_in_pre_sign_phase_.id_map_map_[party_id_l][party_id_j] = aff_proof_arr[k];
+    }
+    ctx->proof_in_pre_sign_phase_.pail_enc_mul_proof_ = enc_mul_proof;
+    ctx->proof_in_pre_sign_phase_.c_k_gamma_ = c_k_gamma;
+    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+        ctx->proof_in_pre_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = dec_proof_arr[l];
     }
 
     return true;
@@ -336,69 +376,101 @@ bool Round3::VerifyProof(
         std::map<std::string, ProofInPreSignPhase> &map_proof,
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_D,
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F) {
+    Context *ctx = get_context();
+    PartyMatrix<BN> all_D_matrix;
+    PartyMatrix<BN> all_F_matrix;
+    bool ok = all_D_matrix.FromMap(all_D, ctx->party_id_arr_) && all_F_matrix.FromMap(all_F, ctx->party_id_arr_);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID in all_D or all_F!");
+        return false;
+    }
+    return VerifyProof(map_proof, all_D_matrix, all_F_matrix);
+}
+
+bool Round3::VerifyProof(
+        std::map<std::string, ProofInPreSignPhase> &map_proof,
+        const PartyMatrix<BN> &all_D,
+        const PartyMatrix<BN> &all_F) {
     bool ok = true;
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    const SignKey &sign_key = ctx->sign_key_;
+    Context *ctx = get_context();
+    if (all_D.size() != ctx->party_id_arr_.size() || all_F.size() != ctx->party_id_arr_.size()) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Size of all_D or all_F doesn't match the parties!");
+        return false;
+    }
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
 
+    // Checks on the shape of the proofs are done in place, and the verifications are collected as tasks, together with
+    // the party to blame, then run in parallel. The culprit is the same as the one found by verifying in order.
+    std::vector<std::function<bool()>> task_arr;
+    std::vector<string> culprit_arr;
+    // Set if a check failed before all the tasks were collected.
+    bool check_failed = false;
+    string check_culprit;
+
     // In case of failure in Figure 7, do:
     for (auto &item_i: map_proof) {
-        if((int)(item_i.second.id_map_map_.size() + 1) != ctx->get_total_parties()) return false;
-        if((int)(item_i.second.id_dec_proof_map_.size() + 1) != ctx->get_total_parties()) return false;
+        if((int)(item_i.second.id_map_map_.size() + 1) != ctx->get_total_parties()) { check_failed = true; break; }
+        if((int)(item_i.second.id_dec_proof_map_.size() + 1) != ctx->get_total_parties()) { check_failed = true; break; }
         const std::string &party_id_i = item_i.first;
-        if( !ctx->IsValidPartyID(party_id_i) ) return false;
+        if( !ctx->IsValidPartyID(party_id_i) ) { check_failed = true; break; }
+        const size_t pos_i = (size_t)ctx->get_party_pos(party_id_i);
+        const std::string ssid_index_i = ctx->GetSSIDIndex(party_id_i);
+        const safeheron::pail::PailPubKey *pail_pub_i = &ctx->GetPailPub(party_id_i);
 
         // (a) For l != i, party i reprove to party l that {D_{j,i}}_{j!=i,l} are well formed according to \PI^{aff-g}
         for (auto &item_l: item_i.second.id_map_map_) {
-            if((int)(item_l.second.size() + 2) != ctx->get_total_parties()) return false;
+            if((int)(item_l.second.size() + 2) != ctx->get_total_parties()) { check_failed = true; break; }
             const std::string &party_id_l = item_l.first;
-            if( !ctx->IsValidPartyID(party_id_l) ) return false;
-            safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(ctx->GetN(party_id_l),
-                                                                     ctx->GetS(party_id_l),
-                                                                     ctx->GetT(party_id_l));
+            if( !ctx->IsValidPartyID(party_id_l) ) { check_failed = true; break; }
+            PailAffGroupEleRangeSetUp_V2 setup(ctx->GetN(party_id_l), ctx->GetS(party_id_l), ctx->GetT(party_id_l));
             // For each j != i,l, prove {D_{j,i}}_{j!=i,l} are well formed
             for (auto &item_j: item_l.second) {
                 const std::string &party_id_j = item_j.first;
-                if( !ctx->IsValidPartyID(party_id_j) ) return false;
+                if( !ctx->IsValidPartyID(party_id_j) ) { check_failed = true; break; }
+                const size_t pos_j = (size_t)ctx->get_party_pos(party_id_j);
+                if( !all_D.Has(pos_i, pos_j) || !all_F.Has(pos_i, pos_j) ) { check_failed = true; break; }
                 PailAffGroupEleRangeStatement_V2 statement(
                         ctx->GetPailPub(party_id_j).n(),
                         ctx->GetPailPub(party_id_j).n_sqr(),
-                        ctx->GetPailPub(party_id_i).n(),
-                        ctx->GetPailPub(party_id_i).n_sqr(),
+                        pail_pub_i->n(),
+                        pail_pub_i->n_sqr(),
                         ctx->GetK(party_id_j),
-                        all_D.at(party_id_i).at(party_id_j),
-                        all_F.at(party_id_i).at(party_id_j),
+                        all_D.At(pos_i, pos_j),
+                        all_F.At(pos_i, pos_j),
                         ctx->GetGamma(party_id_i),
                         curv->n,
                         SECURITY_PARAM_L,
                         SECURITY_PARAM_L_PRIME,
                         SECURITY_PARAM_EPSILON);
-
-                item_j.second.SetSalt(ctx->GetSSIDIndex(party_id_i));
-                ok = item_j.second.Verify(setup, statement);
-                if (!ok) {
-                    ctx->identify_culprit_ = party_id_i;
-                    return false;
-                }
+                PailAffGroupEleRangeProof_V2 *proof = &item_j.second;
+                task_arr.emplace_back([proof, setup, statement, ssid_index_i]() {
+                    proof->SetSalt(ssid_index_i);
+                    CountPrimitive(Primitive::ZKVerify);
+                    return proof->Verify(setup, statement);
+                });
+                culprit_arr.push_back(party_id_i);
             }
+            if (check_failed) break;
         }
+        if (check_failed) break;
 
         // (b) Compute H_i = Enc_i(k_i, gamma_i) and party i prove to party l in ZK that H_i is well formed wrt K_i and G_i in \PI^{mul}
-        PailEncMulStatement statement(
-                ctx->GetPailPub(party_id_i).n(),
-                ctx->GetPailPub(party_id_i).n_sqr(),
+        PailEncMulStatement enc_mul_statement(
+                pail_pub_i->n(),
+                pail_pub_i->n_sqr(),
                 ctx->GetK(party_id_i),
                 ctx->GetG(party_id_i),
                 item_i.second.c_k_gamma_,
                 curv->n);
-        item_i.second.pail_enc_mul_proof_.SetSalt(ctx->GetSSIDIndex(party_id_i));
-        ok = item_i.second.pail_enc_mul_proof_.Verify(statement);
-        if (!ok) {
-            ctx->identify_culprit_ = party_id_i;
-            return false;
-        }
+        PailEncMulProof *enc_mul_proof = &item_i.second.pail_enc_mul_proof_;
+        task_arr.emplace_back([enc_mul_proof, enc_mul_statement, ssid_index_i]() {
+            enc_mul_proof->SetSalt(ssid_index_i);
+            CountPrimitive(Primitive::ZKVerify);
+            return enc_mul_proof->Verify(enc_mul_statement);
+        });
+        culprit_arr.push_back(party_id_i);
 
         // (c) For l != i, party i prove to party j in ZK that \delta is the plaintext value mod q of the cypher text obtained as
         //     H_i * \PI_{j!=i}{D_{i,j} * F_{j,i}} according to \PI^{dec}
@@ -406,18 +478,14 @@ bool Round3::VerifyProof(
         //         - c_delta = Enc(raw_delta, final_rho) = H_i * \PI_{j!=i}{D_{i,j} * F_{j,i}}
         //         - raw_delta = delta mod q
         BN c_deta = item_i.second.c_k_gamma_;
-        for (const auto &from: all_D) {
-            for (const auto &to: from.second) {
-                if (from.first != party_id_i && to.first == party_id_i) {
-                    c_deta = (c_deta * to.second) % ctx->GetPailPub(party_id_i).n_sqr();
-                }
+        for (size_t j = 0; j < all_D.size(); ++j) {
+            if (j != pos_i && all_D.Has(j, pos_i)) {
+                c_deta = (c_deta * all_D.At(j, pos_i)) % pail_pub_i->n_sqr();
             }
         }
-        for (const auto &from: all_F) {
-            for (const auto &to: from.second) {
-                if (from.first == party_id_i && to.first != party_id_i) {
-                    c_deta = (c_deta * to.second.InvM(ctx->GetPailPub(party_id_i).n_sqr())) % ctx->GetPailPub(party_id_i).n_sqr();
-                }
+        for (size_t j = 0; j < all_F.size(); ++j) {
+            if (j != pos_i && all_F.Has(pos_i, j)) {
+                c_deta = (c_deta * all_F.At(pos_i, j).InvM(pail_pub_i->n_sqr())) % pail_pub_i->n_sqr();
             }
         }
         // prove that:
@@ -426,8 +494,9 @@ bool Round3::VerifyProof(
         for (auto &item_l: item_i.second.id_dec_proof_map_) {
             const std::string &party_id_l = item_l.first;
             if( !ctx->IsValidPartyID(party_id_l) ) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
+                check_failed = true;
+                check_culprit = party_id_i;
+                break;
             }
 
             safeheron::zkp::pail::PailDecModuloSetUp setup(ctx->GetN(party_id_l),
@@ -435,21 +504,38 @@ bool Round3::VerifyProof(
                                                            ctx->GetT(party_id_l));
             zkp::pail::PailDecModuloStatement statement(
                     curv->n,
-                    ctx->GetPailPub(party_id_i).n(),
-                    ctx->GetPailPub(party_id_i).n_sqr(),
+                    pail_pub_i->n(),
+                    pail_pub_i->n_sqr(),
                     c_deta,
                     ctx->GetDelta(party_id_i),
                     SECURITY_PARAM_L,
                     SECURITY_PARAM_EPSILON);
-
-            item_l.second.SetSalt(ctx->GetSSIDIndex(party_id_i));
-            ok = item_l.second.Verify(setup, statement);
-            if (!ok) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
-
+            PailDecModuloProof *proof = &item_l.second;
+            task_arr.emplace_back([proof, setup, statement, ssid_index_i]() {
+                proof->SetSalt(ssid_index_i);
+                CountPrimitive(Primitive::ZKVerify);
+                return proof->Verify(setup, statement);
+            });
+            culprit_arr.push_back(party_id_i);
         }
+        if (check_failed) break;
+    }
+
+    size_t failed_task;
+    ok = ParallelForAll(task_arr.size(), [&task_arr](size_t k) {
+        return task_arr[k]();
+    }, failed_task, ctx->identification_parallelism_, ctx->identification_time_budget_ms_);
+    if (failed_task < task_arr.size()) {
+        ctx->identify_culprit_ = culprit_arr[failed_task];
+        return false;
+    }
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Time budget of verifying proofs ran out!");
+        return false;
+    }
+    if (check_failed) {
+        if (!check_culprit.empty()) ctx->identify_culprit_ = check_culprit;
+        return false;
     }
     return true;
 }
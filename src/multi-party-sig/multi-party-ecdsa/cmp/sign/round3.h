@@ -4,6 +4,7 @@
 
 #include <string>
 #include <vector>
+#include "multi-party-sig/mpc-flow/common/party_array.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/message.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/identification.h"
@@ -14,12 +15,14 @@ namespace cmp{
 namespace sign {
 
 
-class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round2P2PMessage> p2p_message_arr_;
 
-    Round3() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
+    Round3() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
 
     void Init() override;
 
@@ -36,6 +39,9 @@ public:
     bool VerifyProof(std::map<std::string, ProofInPreSignPhase> &map_proof,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_D,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F);
+    bool VerifyProof(std::map<std::string, ProofInPreSignPhase> &map_proof,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F);
 };
 
 }
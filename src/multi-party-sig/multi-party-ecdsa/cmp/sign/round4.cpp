@@ -1,6 +1,9 @@
+#include <functional>
 #include <vector>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/security_param.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round4.h"
@@ -28,10 +31,14 @@ using safeheron::zkp::pail::PailDecModuloSetUp;
 using safeheron::zkp::pail::PailDecModuloStatement;
 using safeheron::zkp::pail::PailDecModuloWitness;
 using safeheron::zkp::pail::PailDecModuloProof;
+using safeheron::mpc_flow::common::ParallelForAll;
 using safeheron::zkp::pail::PailMulGroupEleRangeSetUp;
 using safeheron::zkp::pail::PailMulGroupEleRangeStatement;
 using safeheron::zkp::pail::PailMulGroupEleRangeWitness;
 using safeheron::zkp::pail::PailMulGroupEleRangeProof;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
+using safeheron::mpc_flow::common::PartyMatrix;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -58,19 +65,19 @@ static BN get_rho_in_pail_cypher(const BN& c, const BN& m, const BN& N, const BN
 
 
 void Round4::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->Identify(party_id, ctx->get_cur_round());
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -91,12 +98,12 @@ bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round4::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->Identify(party_id, ctx->get_cur_round());
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
@@ -124,7 +131,7 @@ bool Round4::ReceiveVerify(const std::string &party_id) {
 
 bool Round4::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = ctx->GetCurrentCurve();
 
@@ -139,8 +146,7 @@ bool Round4::ComputeVerify() {
     s = s % curv->n;
 
     // Low S
-    BN half_n = curv->n / 2;
-    if (s > half_n){
+    if (s > half_n_){
         s = curv->n - s;
         recovery_param ^= 1;
     }
@@ -166,45 +172,54 @@ bool Round4::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
 bool Round4::BuildProof() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
 
+    // All the proofs are independent, so they are collected as tasks and proved in parallel.
+    std::vector<std::function<void()>> task_arr;
+
     // In case of failure in Figure 8, then retrieve the presigning transcript and do:
     // (a) For l != i, party i reprove to party l that {\hat{D}_{j,i}}_{j!=i,l} are well formed according to \PI^{aff-g}
+    std::vector<std::pair<size_t, size_t>> l_j_arr;
     for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
-        safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(sign_key.remote_parties_[l].N_,
-                                                                 sign_key.remote_parties_[l].s_,
-                                                                 sign_key.remote_parties_[l].t_);
         for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-            if (l != j) {
-                PailAffGroupEleRangeStatement_V2 statement(
-                        ctx->remote_parties_[j].pail_pub_.n(),
-                        ctx->remote_parties_[j].pail_pub_.n_sqr(),
-                        ctx->local_party_.pail_pub_.n(),
-                        ctx->local_party_.pail_pub_.n_sqr(),
-                        ctx->remote_parties_[j].K_,
-                        ctx->remote_parties_[j].D_hat_ji,
-                        ctx->remote_parties_[j].F_hat_ji,
-                        sign_key.local_party_.X_,
-                        curv->n,
-                        SECURITY_PARAM_L,
-                        SECURITY_PARAM_L_PRIME,
-                        SECURITY_PARAM_EPSILON);
+            if (l != j) l_j_arr.emplace_back(l, j);
+        }
+    }
+    std::vector<PailAffGroupEleRangeProof_V2> aff_proof_arr(l_j_arr.size());
+    for (size_t k = 0; k < l_j_arr.size(); ++k) {
+        task_arr.emplace_back([ctx, &sign_key, curv, &l_j_arr, &aff_proof_arr, k]() {
+            size_t l = l_j_arr[k].first;
+            size_t j = l_j_arr[k].second;
+            safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(sign_key.remote_parties_[l].N_,
+                                                                     sign_key.remote_parties_[l].s_,
+                                                                     sign_key.remote_parties_[l].t_);
+            PailAffGroupEleRangeStatement_V2 statement(
+                    ctx->remote_parties_[j].pail_pub_.n(),
+                    ctx->remote_parties_[j].pail_pub_.n_sqr(),
+                    ctx->local_party_.pail_pub_.n(),
+                    ctx->local_party_.pail_pub_.n_sqr(),
+                    ctx->remote_parties_[j].K_,
+                    ctx->remote_parties_[j].D_hat_ji,
+                    ctx->remote_parties_[j].F_hat_ji,
+                    sign_key.local_party_.X_,
+                    curv->n,
+                    SECURITY_PARAM_L,
+                    SECURITY_PARAM_L_PRIME,
+                    SECURITY_PARAM_EPSILON);
 
-                PailAffGroupEleRangeWitness_V2 witness(
-                        sign_key.local_party_.x_,
-                        ctx->remote_parties_[j].beta_hat_ij_.Neg(),
-                        ctx->remote_parties_[j].s_hat_ij_,
-                        ctx->remote_parties_[j].r_hat_ij_);
+            PailAffGroupEleRangeWitness_V2 witness(
+                    sign_key.local_party_.x_,
+                    ctx->remote_parties_[j].beta_hat_ij_.Neg(),
+                    ctx->remote_parties_[j].s_hat_ij_,
+                    ctx->remote_parties_[j].r_hat_ij_);
 
-                PailAffGroupEleRangeProof_V2 proof;
-                proof.SetSalt(ctx->local_party_.ssid_index_);
-                proof.Prove(setup, statement, witness);
-                ctx->proof_in_sign_phase_.id_map_map_[sign_key.remote_parties_[l].party_id_][sign_key.remote_parties_[j].party_id_] = proof;
-            }
-        }
+            aff_proof_arr[k].SetSalt(ctx->local_party_.ssid_index_);
+            aff_proof_arr[k].Prove(setup, statement, witness);
+            CountPrimitive(Primitive::ZKProve);
+        });
     }
 
 
@@ -215,30 +230,30 @@ bool Round4::BuildProof() {
     BN c_k_x = (ctx->local_party_.K_.PowM(sign_key.local_party_.x_, ctx->local_party_.pail_pub_.n_sqr())
                     * rho.PowM(ctx->local_party_.pail_pub_.n(), ctx->local_party_.pail_pub_.n_sqr())) %
                    ctx->local_party_.pail_pub_.n_sqr();
-    ctx->proof_in_sign_phase_.c_k_x_ = c_k_x;
 
+    std::vector<PailMulGroupEleRangeProof> mul_proof_arr(ctx->remote_parties_.size());
     for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
-        PailMulGroupEleRangeSetUp setup(sign_key.remote_parties_[l].N_,
-                                                       sign_key.remote_parties_[l].s_,
-                                                       sign_key.remote_parties_[l].t_);
-        PailMulGroupEleRangeStatement statement(
-                ctx->local_party_.pail_pub_.n(),
-                ctx->local_party_.pail_pub_.n_sqr(),
-                ctx->local_party_.K_,
-                c_k_x,
-                sign_key.local_party_.X_,
-                curv->g,
-                curv->n,
-                SECURITY_PARAM_L,
-                SECURITY_PARAM_EPSILON);
-
-        PailMulGroupEleRangeWitness witness(sign_key.local_party_.x_, rho);
-
-        PailMulGroupEleRangeProof proof;
-        proof.SetSalt(ctx->local_party_.ssid_index_);
-        proof.Prove(setup, statement, witness);
-        ctx->proof_in_sign_phase_.id_mul_group_ele_proof_map_[sign_key.remote_parties_[l].party_id_] = proof;
+        task_arr.emplace_back([ctx, &sign_key, curv, &c_k_x, &rho, &mul_proof_arr, l]() {
+            PailMulGroupEleRangeSetUp setup(sign_key.remote_parties_[l].N_,
+                                            sign_key.remote_parties_[l].s_,
+                                            sign_key.remote_parties_[l].t_);
+            PailMulGroupEleRangeStatement statement(
+                    ctx->local_party_.pail_pub_.n(),
+                    ctx->local_party_.pail_pub_.n_sqr(),
+                    ctx->local_party_.K_,
+                    c_k_x,
+                    sign_key.local_party_.X_,
+                    curv->g,
+                    curv->n,
+                    SECURITY_PARAM_L,
+                    SECURITY_PARAM_EPSILON);
+
+            PailMulGroupEleRangeWitness witness(sign_key.local_party_.x_, rho);
 
+            mul_proof_arr[l].SetSalt(ctx->local_party_.ssid_index_);
+            mul_proof_arr[l].Prove(setup, statement, witness);
+            CountPrimitive(Primitive::ZKProve);
+        });
     }
 
     // (c) For l != i, prove in ZK that \sigma is the plaintext value mod q of the cypher text obtained as
@@ -274,33 +289,53 @@ bool Round4::BuildProof() {
                  c_chi.PowM(r, ctx->local_party_.pail_pub_.n_sqr()) ) % ctx->local_party_.pail_pub_.n_sqr();
     BN raw_sigma = ctx->local_party_.k_ * ctx->m_ + r * raw_chi;
 
-
-    BN t_c_sigma = ( (raw_sigma * ctx->local_party_.pail_pub_.n() + 1) * final_rho.PowM(ctx->local_party_.pail_pub_.n(), ctx->local_party_.pail_pub_.n_sqr()) ) % ctx->local_party_.pail_pub_.n_sqr();
-
     // Prove that:
     //         - c_sigma = Enc(raw_sigma, final_rho) = K_i^m * (\hat{H}_i * \PI_{j!=i}{\hat{D}_{i,j} * \hat{F}_{j,i}})^r
     //         - raw_sigma = sigma mod q
+    std::vector<PailDecModuloProof> dec_proof_arr(ctx->remote_parties_.size());
+    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+        task_arr.emplace_back([ctx, &sign_key, curv, &c_sigma, &raw_sigma, &final_rho, &dec_proof_arr, l]() {
+            safeheron::zkp::pail::PailDecModuloSetUp setup(sign_key.remote_parties_[l].N_,
+                                                           sign_key.remote_parties_[l].s_,
+                                                           sign_key.remote_parties_[l].t_);
+            zkp::pail::PailDecModuloStatement statement(
+                    curv->n,
+                    ctx->local_party_.pail_pub_.n(),
+                    ctx->local_party_.pail_pub_.n_sqr(),
+                    c_sigma,
+                    ctx->local_party_.sigma_,
+                    SECURITY_PARAM_L,
+                    SECURITY_PARAM_EPSILON);
+
+            PailDecModuloWitness witness(
+                    raw_sigma,
+                    final_rho);
+
+            dec_proof_arr[l].SetSalt(ctx->local_party_.ssid_index_);
+            dec_proof_arr[l].Prove(setup, statement, witness);
+            CountPrimitive(Primitive::ZKProve);
+        });
+    }
+
+    size_t failed_task;
+    ok = ParallelForAll(task_arr.size(), [&task_arr](size_t k) {
+        task_arr[k]();
+        return true;
+    }, failed_task, ctx->identification_parallelism_, ctx->identification_time_budget_ms_);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Time budget of building proofs ran out!");
+        return false;
+    }
+
+    for (size_t k = 0; k < l_j_arr.size(); ++k) {
+        const string &party_id_l = sign_key.remote_parties_[l_j_arr[k].first].party_id_;
+        const string &party_id_j = sign_key.remote_parties_[l_j_arr[k].second].party_id_;
+        ctx->proof_in_sign_phase_.id_map_map_[party_id_l][party_id_j] = aff_proof_arr[k];
+    }
+    ctx->proof_in_sign_phase_.c_k_x_ = c_k_x;
     for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
-        safeheron::zkp::pail::PailDecModuloSetUp setup(sign_key.remote_parties_[l].N_,
-                                                       sign_key.remote_parties_[l].s_,
-                                                       sign_key.remote_parties_[l].t_);
-        zkp::pail::PailDecModuloStatement statement(
-                curv->n,
-                ctx->local_party_.pail_pub_.n(),
-                ctx->local_party_.pail_pub_.n_sqr(),
-                c_sigma,
-                ctx->local_party_.sigma_,
-                SECURITY_PARAM_L,
-                SECURITY_PARAM_EPSILON);
-
-        PailDecModuloWitness witness(
-                raw_sigma,
-                final_rho);
-
-        PailDecModuloProof proof;
-        proof.SetSalt(ctx->local_party_.ssid_index_);
-        proof.Prove(setup, statement, witness);
-        ctx->proof_in_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = proof;
+        ctx->proof_in_sign_phase_.id_mul_group_ele_proof_map_[sign_key.remote_parties_[l].party_id_] = mul_proof_arr[l];
+        ctx->proof_in_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = dec_proof_arr[l];
     }
 
     return true;
@@ -310,91 +345,98 @@ bool Round4::VerifyProof(
         std::map<std::string, ProofInSignPhase> &map_proof,
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_D_hat,
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F_hat) {
+    Context *ctx = get_context();
+    PartyMatrix<BN> all_D_hat_matrix;
+    PartyMatrix<BN> all_F_hat_matrix;
+    bool ok = all_D_hat_matrix.FromMap(all_D_hat, ctx->party_id_arr_) && all_F_hat_matrix.FromMap(all_F_hat, ctx->party_id_arr_);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID in all_D_hat or all_F_hat!");
+        return false;
+    }
+    return VerifyProof(map_proof, all_D_hat_matrix, all_F_hat_matrix);
+}
+
+bool Round4::VerifyProof(
+        std::map<std::string, ProofInSignPhase> &map_proof,
+        const PartyMatrix<BN> &all_D_hat,
+        const PartyMatrix<BN> &all_F_hat) {
     bool ok = true;
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    const SignKey &sign_key = ctx->sign_key_;
+    Context *ctx = get_context();
+    if (all_D_hat.size() != ctx->party_id_arr_.size() || all_F_hat.size() != ctx->party_id_arr_.size()) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Size of all_D_hat or all_F_hat doesn't match the parties!");
+        return false;
+    }
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
 
+    // Checks on the shape of the proofs are done in place, and the verifications are collected as tasks, together with
+    // the party to blame, then run in parallel. The culprit is the same as the one found by verifying in order.
+    std::vector<std::function<bool()>> task_arr;
+    std::vector<string> culprit_arr;
+    // Set if a check failed before all the tasks were collected.
+    bool check_failed = false;
+    string check_culprit;
+
     // In case of failure in Figure 8, then retrieve the presigning transcript and do:
     // (a) For l != i, party i reprove to party l that {\hat{D}_{j,i}}_{j!=i,l} are well formed according to \PI^{aff-g}
     for (auto &item_i: map_proof) {
         const std::string &party_id_i = item_i.first;
-        if( !ctx->IsValidPartyID(party_id_i) )
-        {
-            ctx->identify_culprit_ = party_id_i;
-            return false;
-        }
-        if((int)item_i.second.id_map_map_.size() + 1 != ctx->get_total_parties()) {
-            ctx->identify_culprit_ = party_id_i;
-            return false;
-        }
-        if((int)item_i.second.id_dec_proof_map_.size() + 1 != ctx->get_total_parties()){
-            ctx->identify_culprit_ = party_id_i;
-            return false;
-        }
+        check_culprit = party_id_i;
+        if( !ctx->IsValidPartyID(party_id_i) ) { check_failed = true; break; }
+        const size_t pos_i = (size_t)ctx->get_party_pos(party_id_i);
+        if((int)item_i.second.id_map_map_.size() + 1 != ctx->get_total_parties()) { check_failed = true; break; }
+        if((int)item_i.second.id_dec_proof_map_.size() + 1 != ctx->get_total_parties()) { check_failed = true; break; }
+        const std::string ssid_index_i = ctx->GetSSIDIndex(party_id_i);
+        const safeheron::pail::PailPubKey *pail_pub_i = &ctx->GetPailPub(party_id_i);
 
         for (auto &item_l: item_i.second.id_map_map_) {
-            if((int)(item_l.second.size() + 2) != ctx->get_total_parties()) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
+            if((int)(item_l.second.size() + 2) != ctx->get_total_parties()) { check_failed = true; break; }
             const std::string &party_id_l = item_l.first;
-            if( !ctx->IsValidPartyID(party_id_l) ) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
-            safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(ctx->GetN(party_id_l),
-                                                                     ctx->GetS(party_id_l),
-                                                                     ctx->GetT(party_id_l));
+            if( !ctx->IsValidPartyID(party_id_l) ) { check_failed = true; break; }
+            PailAffGroupEleRangeSetUp_V2 setup(ctx->GetN(party_id_l), ctx->GetS(party_id_l), ctx->GetT(party_id_l));
             for (auto &item_j: item_l.second) {
                 const std::string &party_id_j = item_j.first;
-                if( !ctx->IsValidPartyID(party_id_j) ) {
-                    ctx->identify_culprit_ = party_id_i;
-                    return false;
-                }
+                if( !ctx->IsValidPartyID(party_id_j) ) { check_failed = true; break; }
+                const size_t pos_j = (size_t)ctx->get_party_pos(party_id_j);
+                if( !all_D_hat.Has(pos_i, pos_j) || !all_F_hat.Has(pos_i, pos_j) ) { check_failed = true; break; }
                 PailAffGroupEleRangeStatement_V2 statement(
                         ctx->GetPailPub(party_id_j).n(),
                         ctx->GetPailPub(party_id_j).n_sqr(),
-                        ctx->GetPailPub(party_id_i).n(),
-                        ctx->GetPailPub(party_id_i).n_sqr(),
+                        pail_pub_i->n(),
+                        pail_pub_i->n_sqr(),
                         ctx->GetK(party_id_j),
-                        all_D_hat.at(party_id_i).at(party_id_j),
-                        all_F_hat.at(party_id_i).at(party_id_j),
+                        all_D_hat.At(pos_i, pos_j),
+                        all_F_hat.At(pos_i, pos_j),
                         ctx->GetX(party_id_i),
                         curv->n,
                         SECURITY_PARAM_L,
                         SECURITY_PARAM_L_PRIME,
                         SECURITY_PARAM_EPSILON);
-
-                item_j.second.SetSalt(ctx->GetSSIDIndex(party_id_i));
-                ok = item_j.second.Verify(setup, statement);
-                if (!ok) {
-                    ctx->identify_culprit_ = party_id_i;
-                    return false;
-                }
+                PailAffGroupEleRangeProof_V2 *proof = &item_j.second;
+                task_arr.emplace_back([proof, setup, statement, ssid_index_i]() {
+                    proof->SetSalt(ssid_index_i);
+                    CountPrimitive(Primitive::ZKVerify);
+                    return proof->Verify(setup, statement);
+                });
+                culprit_arr.push_back(party_id_i);
             }
+            if (check_failed) break;
         }
+        if (check_failed) break;
 
         // (b) Compute H_i = Enc_i(k_i, x_i) and prove in ZK that \hat{H}_i is well formed wrt K_i and X_i in \PI^{mul*}
-        if((int)(item_i.second.id_mul_group_ele_proof_map_.size() + 1) != ctx->get_total_parties()) {
-            ctx->identify_culprit_ = party_id_i;
-            return false;
-        }
+        if((int)(item_i.second.id_mul_group_ele_proof_map_.size() + 1) != ctx->get_total_parties()) { check_failed = true; break; }
         for (auto &item_l: item_i.second.id_mul_group_ele_proof_map_) {
             const std::string &party_id_l = item_l.first;
-            if( !ctx->IsValidPartyID(party_id_l) ) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
+            if( !ctx->IsValidPartyID(party_id_l) ) { check_failed = true; break; }
 
             PailMulGroupEleRangeSetUp setup(ctx->GetN(party_id_l),
-                                                           ctx->GetS(party_id_l),
-                                                           ctx->GetT(party_id_l));
+                                            ctx->GetS(party_id_l),
+                                            ctx->GetT(party_id_l));
             PailMulGroupEleRangeStatement statement(
-                    ctx->GetPailPub(party_id_i).n(),
-                    ctx->GetPailPub(party_id_i).n_sqr(),
+                    pail_pub_i->n(),
+                    pail_pub_i->n_sqr(),
                     ctx->GetK(party_id_i),
                     item_i.second.c_k_x_,
                     ctx->GetX(party_id_i),
@@ -402,41 +444,35 @@ bool Round4::VerifyProof(
                     curv->n,
                     SECURITY_PARAM_L,
                     SECURITY_PARAM_EPSILON);
-
-            item_i.second.id_mul_group_ele_proof_map_.at(party_id_l).SetSalt(ctx->GetSSIDIndex(party_id_i));
-            ok = item_i.second.id_mul_group_ele_proof_map_.at(party_id_l).Verify(setup, statement);
-            if(!ok) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
+            PailMulGroupEleRangeProof *proof = &item_l.second;
+            task_arr.emplace_back([proof, setup, statement, ssid_index_i]() {
+                proof->SetSalt(ssid_index_i);
+                CountPrimitive(Primitive::ZKVerify);
+                return proof->Verify(setup, statement);
+            });
+            culprit_arr.push_back(party_id_i);
         }
+        if (check_failed) break;
 
         // (c) For l != i, prove in ZK that \sigma is the plaintext value mod q of the cypher text obtained as
         //     K_i^m * (\hat{H}_i * \PI_{j!=i}{\hat{D}_{i,j} * \hat{F}_{j,i}})^r according to \PI^{dec}
         BN c_chi = item_i.second.c_k_x_;
-        for (const auto &from: all_D_hat) {
-            for (const auto &to: from.second) {
-                if (from.first != party_id_i && to.first == party_id_i) {
-                    c_chi = (c_chi * to.second) % ctx->GetPailPub(party_id_i).n_sqr();
-                }
+        for (size_t j = 0; j < all_D_hat.size(); ++j) {
+            if (j != pos_i && all_D_hat.Has(j, pos_i)) {
+                c_chi = (c_chi * all_D_hat.At(j, pos_i)) % pail_pub_i->n_sqr();
             }
         }
-        for (const auto &from: all_F_hat) {
-            for (const auto &to: from.second) {
-                if (from.first == party_id_i && to.first != party_id_i) {
-                    c_chi = (c_chi * to.second.InvM(ctx->GetPailPub(party_id_i).n_sqr())) % ctx->GetPailPub(party_id_i).n_sqr();
-                }
+        for (size_t j = 0; j < all_F_hat.size(); ++j) {
+            if (j != pos_i && all_F_hat.Has(pos_i, j)) {
+                c_chi = (c_chi * all_F_hat.At(pos_i, j).InvM(pail_pub_i->n_sqr())) % pail_pub_i->n_sqr();
             }
         }
         BN r = ctx->R_.x();
-        BN c_sigma = ( ctx->GetK(party_id_i).PowM(ctx->m_, ctx->GetPailPub(party_id_i).n_sqr()) *
-                       c_chi.PowM(r, ctx->GetPailPub(party_id_i).n_sqr()) ) % ctx->GetPailPub(party_id_i).n_sqr();
+        BN c_sigma = ( ctx->GetK(party_id_i).PowM(ctx->m_, pail_pub_i->n_sqr()) *
+                       c_chi.PowM(r, pail_pub_i->n_sqr()) ) % pail_pub_i->n_sqr();
         for (auto &item_l: item_i.second.id_dec_proof_map_) {
             const std::string &party_id_l = item_l.first;
-            if( !ctx->IsValidPartyID(party_id_l) ) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
+            if( !ctx->IsValidPartyID(party_id_l) ) { check_failed = true; break; }
 
             // Prove that:
             //         - c_sigma = Enc(raw_sigma, final_rho) = K_i^m * (\hat{H}_i * \PI_{j!=i}{\hat{D}_{i,j} * \hat{F}_{j,i}})^r
@@ -446,20 +482,38 @@ bool Round4::VerifyProof(
                                                            ctx->GetT(party_id_l));
             zkp::pail::PailDecModuloStatement statement(
                     curv->n,
-                    ctx->GetPailPub(party_id_i).n(),
-                    ctx->GetPailPub(party_id_i).n_sqr(),
+                    pail_pub_i->n(),
+                    pail_pub_i->n_sqr(),
                     c_sigma,
                     ctx->GetSigma(party_id_i),
                     SECURITY_PARAM_L,
                     SECURITY_PARAM_EPSILON);
-
-            item_l.second.SetSalt(ctx->GetSSIDIndex(party_id_i));
-            ok = item_l.second.Verify(setup, statement);
-            if (!ok) {
-                ctx->identify_culprit_ = party_id_i;
-                return false;
-            }
+            PailDecModuloProof *proof = &item_l.second;
+            task_arr.emplace_back([proof, setup, statement, ssid_index_i]() {
+                proof->SetSalt(ssid_index_i);
+                CountPrimitive(Primitive::ZKVerify);
+                return proof->Verify(setup, statement);
+            });
+            culprit_arr.push_back(party_id_i);
         }
+        if (check_failed) break;
+    }
+
+    size_t failed_task;
+    ok = ParallelForAll(task_arr.size(), [&task_arr](size_t k) {
+        return task_arr[k]();
+    }, failed_task, ctx->identification_parallelism_, ctx->identification_time_budget_ms_);
+    if (failed_task < task_arr.size()) {
+        ctx->identify_culprit_ = culprit_arr[failed_task];
+        return false;
+    }
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Time budget of verifying proofs ran out!");
+        return false;
+    }
+    if (check_failed) {
+        ctx->identify_culprit_ = check_culprit;
+        return false;
     }
     return true;
 }
@@ -4,6 +4,7 @@
 
 #include <string>
 #include <vector>
+#include "multi-party-sig/mpc-flow/common/party_array.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/message.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/identification.h"
@@ -14,12 +15,16 @@ namespace cmp{
 namespace sign {
 
 
-class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round3P2PMessage> p2p_message_arr_;
+    // n / 2, bound of the low S form
+    safeheron::bignum::BN half_n_;
 
-    Round4() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
+    Round4() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     void Init() override;
 
@@ -35,6 +40,9 @@ public:
     bool VerifyProof(std::map<std::string, ProofInSignPhase> &map_proof,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_D_hat,
                      std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F_hat);
+    bool VerifyProof(std::map<std::string, ProofInSignPhase> &map_proof,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_D_hat,
+                     const safeheron::mpc_flow::common::PartyMatrix<safeheron::bignum::BN> &all_F_hat);
 };
 
 }
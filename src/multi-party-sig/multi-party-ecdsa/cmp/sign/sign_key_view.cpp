@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <unordered_set>
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-sss/polynomial.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign/sign_key_view.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::CurvePoint;
+using safeheron::sss::Polynomial;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+namespace sign {
+
+bool MakeSignKeyView(SignKeyView &view, const SignKey &sign_key, const std::vector<std::string> &participant_id_arr) {
+    bool ok = true;
+    std::unordered_set<string> participant_id_set(participant_id_arr.begin(), participant_id_arr.end());
+    ok = (participant_id_set.count(sign_key.local_party_.party_id_) != 0);
+    if (!ok) return false;
+
+    // Copy the participants only
+    SignKey &t_sign_key = view.sign_key_;
+    t_sign_key.workspace_id_ = sign_key.workspace_id_;
+    t_sign_key.threshold_ = sign_key.threshold_;
+    t_sign_key.local_party_ = sign_key.local_party_;
+    t_sign_key.X_ = sign_key.X_;
+    t_sign_key.rid_ = sign_key.rid_;
+    t_sign_key.remote_parties_.clear();
+    for (const auto &party: sign_key.remote_parties_) {
+        if (participant_id_set.count(party.party_id_) != 0) t_sign_key.remote_parties_.push_back(party);
+    }
+    t_sign_key.n_parties_ = (uint32_t)t_sign_key.remote_parties_.size() + 1;
+
+    ok = (2 <= t_sign_key.threshold_) && (t_sign_key.threshold_ <= t_sign_key.n_parties_);
+    if (!ok) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(sign_key.X_.GetCurveType());
+    if (!curv) return false;
+
+    // Lagrange coefficients lambda_i of the participants at 0
+    vector<BN> share_index_arr;
+    for (const auto &party: t_sign_key.remote_parties_) {
+        share_index_arr.push_back(party.index_);
+    }
+    share_index_arr.push_back(t_sign_key.local_party_.index_);
+    ok = CheckIndexArr(share_index_arr, curv->n);
+    if (!ok) return false;
+    Polynomial::GetLArray(view.l_arr_, BN::ZERO, share_index_arr, curv->n);
+
+    // Check g^x_i == X_i for the local party
+    if (curv->g * t_sign_key.local_party_.x_ != t_sign_key.local_party_.X_) return false;
+
+    // Additive shards, which also check X == \sum_i lambda_i * X_i
+    t_sign_key.local_party_.x_ = (t_sign_key.local_party_.x_ * view.l_arr_.back()) % curv->n;
+    t_sign_key.local_party_.X_ *= view.l_arr_.back();
+    CurvePoint pub = t_sign_key.local_party_.X_;
+    for (size_t i = 0; i < t_sign_key.remote_parties_.size(); ++i) {
+        t_sign_key.remote_parties_[i].X_ *= view.l_arr_[i];
+        pub += t_sign_key.remote_parties_[i].X_;
+    }
+    if (pub != t_sign_key.X_) return false;
+
+    return true;
+}
+
+SignKeyViewCache::SignKeyViewCache(const SignKey &sign_key, size_t max_size): sign_key_(sign_key),
+                                                                             max_size_(std::max(max_size, (size_t)1)) {
+}
+
+std::shared_ptr<const SignKeyView> SignKeyViewCache::Get(const std::vector<std::string> &participant_id_arr) {
+    vector<string> key(participant_id_arr);
+    std::sort(key.begin(), key.end());
+    key.erase(std::unique(key.begin(), key.end()), key.end());
+
+    {
+        std::lock_guard<std::mutex> lk(mutex_);
+        auto iter = map_participants_view_.find(key);
+        if (iter != map_participants_view_.end()) return iter->second;
+    }
+
+    // Built out of the lock, two threads may build the same view and the first one is kept.
+    std::shared_ptr<SignKeyView> view(new SignKeyView());
+    if (!MakeSignKeyView(*view, sign_key_, key)) return nullptr;
+
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto iter = map_participants_view_.find(key);
+    if (iter != map_participants_view_.end()) return iter->second;
+    if (map_participants_view_.size() >= max_size_) {
+        map_participants_view_.erase(key_arr_.front());
+        key_arr_.pop_front();
+    }
+    map_participants_view_[key] = view;
+    key_arr_.push_back(std::move(key));
+    return view;
+}
+
+size_t SignKeyViewCache::Size() const {
+    std::lock_guard<std::mutex> lk(mutex_);
+    return map_participants_view_.size();
+}
+
+void SignKeyViewCache::Clear() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    map_participants_view_.clear();
+    key_arr_.clear();
+}
+
+}
+}
+}
+}
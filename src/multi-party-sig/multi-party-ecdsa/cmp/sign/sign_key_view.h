@@ -0,0 +1,86 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_CMP_SIGN_SIGN_KEY_VIEW_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_CMP_SIGN_SIGN_KEY_VIEW_H
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign_key.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+namespace sign {
+
+/**
+ * A sign key restricted to the participants of a signature, ready for Context::CreateContext.
+ *
+ * The key shards are turned into additive ones with the Lagrange coefficients of the participants:
+ *     x_i = lambda_i * x_i,  X_i = lambda_i * X_i
+ * so that X = \sum_i X_i.
+ */
+struct SignKeyView {
+    SignKey sign_key_;
+    // Lagrange coefficients of the remote parties of sign_key_, then of the local party
+    std::vector<safeheron::bignum::BN> l_arr_;
+};
+
+/**
+ * Build the view of the participants from a parsed sign key. It is checked on the way, with one multiplication
+ * per party instead of the two of trim_sign_key() followed by Context::CreateContext().
+ * @param view
+ * @param sign_key the whole sign key of the local party
+ * @param participant_id_arr all the parties that take part in the signature, including the local one
+ * @return false if the participants do not make a valid sign key
+ */
+bool MakeSignKeyView(SignKeyView &view, const SignKey &sign_key, const std::vector<std::string> &participant_id_arr);
+
+/**
+ * Views of one sign key, cached per participant set. The order of participant_id_arr does not matter.
+ *
+ * Thread safe. Views returned stay valid after they are evicted.
+ */
+class SignKeyViewCache {
+public:
+    /**
+     * Constructor
+     * @param sign_key the whole sign key of the local party
+     * @param max_size views kept at most, the oldest one is evicted first.
+     */
+    explicit SignKeyViewCache(const SignKey &sign_key, size_t max_size = 64);
+
+    SignKeyViewCache(const SignKeyViewCache &) = delete;
+
+    SignKeyViewCache &operator=(const SignKeyViewCache &) = delete;
+
+    /**
+     * Get the view of the participants, build it on the first request.
+     * @return nullptr if the participants do not make a valid sign key
+     */
+    std::shared_ptr<const SignKeyView> Get(const std::vector<std::string> &participant_id_arr);
+
+    size_t Size() const;
+
+    void Clear();
+
+    const SignKey &get_sign_key() const { return sign_key_; }
+
+private:
+    const SignKey sign_key_;
+    const size_t max_size_;
+    mutable std::mutex mutex_;
+    // Sorted participant ids -> view
+    std::map<std::vector<std::string>, std::shared_ptr<const SignKeyView>> map_participants_view_;
+    // Keys of map_participants_view_ in insertion order
+    std::deque<std::vector<std::string>> key_arr_;
+};
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_CMP_SIGN_SIGN_KEY_VIEW_H
@@ -22,6 +22,7 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     sign_key_ = ctx.sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -45,6 +46,7 @@ Context &Context::operator=(const Context &ctx){
     sign_key_ = ctx.sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -95,6 +97,8 @@ bool Context::CreateContext(Context &ctx,
         ctx.remote_parties_.emplace_back();
     }
 
+    ctx.remote_party_pos_index_.Build(ctx.sign_key_.remote_parties_);
+
     return true;
 }
 
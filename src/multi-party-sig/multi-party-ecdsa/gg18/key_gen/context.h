@@ -4,6 +4,7 @@
 
 #include <vector>
 #include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/common/party_index.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/party.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/t_party.h"
@@ -39,6 +40,12 @@ public:
 public:
     void BindAllRounds();
 
+    /**
+     * Position of a remote party in remote_parties_ of the sign key, -1 if not found. It is looked up in an index
+     * built by CreateContext.
+     */
+    int get_remote_party_pos(const std::string &party_id) const { return remote_party_pos_index_.Find(party_id); }
+
     static bool CreateContext(Context &ctx,
                               safeheron::curve::CurveType curve_type,
                               const std::string &workspace_id,
@@ -53,6 +60,7 @@ public:
     SignKey sign_key_;
     LocalTParty local_party_;
     std::vector<RemoteTParty> remote_parties_;
+    safeheron::mpc_flow::common::PartyIndex remote_party_pos_index_;
     Round0 round0_;
     Round1 round1_;
     Round2 round2_;
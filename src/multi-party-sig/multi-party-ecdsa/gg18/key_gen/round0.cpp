@@ -2,8 +2,11 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -11,7 +14,7 @@ namespace gg18 {
 namespace key_gen {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
@@ -43,19 +46,21 @@ bool Round0::ComputeVerify() {
                                         sign_key.local_party_.p_,
                                         sign_key.local_party_.q_,
                                         sign_key.local_party_.alpha_);
+    CountPrimitive(Primitive::ZKProve);
     ctx->local_party_.dln_proof2_.Prove(sign_key.local_party_.N_tilde_,
                                         sign_key.local_party_.h2_,
                                         sign_key.local_party_.h1_,
                                         sign_key.local_party_.p_,
                                         sign_key.local_party_.q_,
                                         sign_key.local_party_.beta_);
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
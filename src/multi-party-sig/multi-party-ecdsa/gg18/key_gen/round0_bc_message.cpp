@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -33,23 +34,17 @@ bool Round0BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::k
     h2_.ToHexStr(str);
     message.set_h2(str);
 
-    safeheron::proto::DLNProof t_dln_proof1;
-    ok = dln_proof_1_.ToProtoObject(t_dln_proof1);
+    ok = dln_proof_1_.ToProtoObject(*message.mutable_dln_proof1());
     if (!ok) return false;
-    message.mutable_dln_proof1()->CopyFrom(t_dln_proof1);
 
-    safeheron::proto::DLNProof t_dln_proof2;
-    ok = dln_proof_2_.ToProtoObject(t_dln_proof2);
+    ok = dln_proof_2_.ToProtoObject(*message.mutable_dln_proof2());
     if (!ok) return false;
-    message.mutable_dln_proof2()->CopyFrom(t_dln_proof2);
 
     index_.ToHexStr(str);
     message.set_index(str);
 
-    safeheron::proto::PailPub t_pail_pub;
-    ok = pail_pub_.ToProtoObject(t_pail_pub);
+    ok = pail_pub_.ToProtoObject(*message.mutable_pail_pub());
     if (!ok) return false;
-    message.mutable_pail_pub()->CopyFrom(t_pail_pub);
     return true;
 }
 
@@ -92,7 +87,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::key_gen::Round0BCMessage Prot
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -106,7 +102,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -116,7 +113,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -130,7 +128,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
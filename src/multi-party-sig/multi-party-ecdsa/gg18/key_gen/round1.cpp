@@ -3,6 +3,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/round1.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -10,6 +11,8 @@ using safeheron::bignum::BN;
 using safeheron::curve::Curve;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -17,17 +20,17 @@ namespace gg18{
 namespace key_gen {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -43,16 +46,17 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
     }
 
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].dln_proof_1_.Verify(bc_message_arr_[pos].N_tilde_,
                                                bc_message_arr_[pos].h1_,
                                                bc_message_arr_[pos].h2_);
@@ -60,6 +64,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, string("Failed to verify DLN proof(dln_proof1_) from party :") + sign_key.remote_parties_[pos].party_id_);
         return false;
     }
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].dln_proof_2_.Verify(bc_message_arr_[pos].N_tilde_,
                                                   bc_message_arr_[pos].h2_,
                                                   bc_message_arr_[pos].h1_);
@@ -82,7 +87,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 
 bool Round1::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
@@ -129,6 +134,7 @@ bool Round1::ComputeVerify() {
         safeheron::zkp::no_small_factor_proof::NoSmallFactorStatement statement(sign_key.local_party_.pail_pub_.n(), 256, 512);
         safeheron::zkp::no_small_factor_proof::NoSmallFactorWitness witness(sign_key.local_party_.pail_priv_.p(), sign_key.local_party_.pail_priv_.q());
         ctx->remote_parties_[i].nsf_proof_.Prove(set_up, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
 
     return true;
@@ -136,7 +142,7 @@ bool Round1::ComputeVerify() {
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -22,10 +23,8 @@ namespace key_gen {
 bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::key_gen::Round1BCMessage &message) const {
     bool ok = true;
 
-    safeheron::proto::KGD kgdPoint;
-    ok = kgd_y_.ToProtoObject(kgdPoint);
+    ok = kgd_y_.ToProtoObject(*message.mutable_kgd_y());
     if (!ok) return false;
-    message.mutable_kgd_y()->CopyFrom(kgdPoint);
 
     for(size_t i = 0; i < vs_.size(); ++i){
         safeheron::proto::CurvePoint * point_ptr = message.mutable_vs()->Add();
@@ -57,7 +56,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::key_gen::Round1BCMessage Prot
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -71,7 +71,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -81,7 +82,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -95,7 +97,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -4,6 +4,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/round2.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -11,6 +12,8 @@ using safeheron::curve::CurveType;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::zkp::pail::PailProof;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -18,7 +21,7 @@ namespace gg18{
 namespace key_gen {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         p2p_message_arr_.emplace_back();
         bc_message_arr_.emplace_back();
@@ -26,10 +29,10 @@ void Round2::Init() {
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -52,11 +55,11 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -79,6 +82,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
                                                                      sign_key.local_party_.h1_,
                                                                      sign_key.local_party_.h2_);
     safeheron::zkp::no_small_factor_proof::NoSmallFactorStatement statement(sign_key.remote_parties_[pos].pail_pub_.n(), 256, 512);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].nsf_proof_.Verify(set_up, statement);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].nsf_proof_.Verify(set_up, statement)");
@@ -92,7 +96,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
 bool Round2::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
@@ -121,18 +125,20 @@ bool Round2::ComputeVerify() {
     // Schnorr Non-interactive Zero-Knowledge Proof
     ctx->local_party_.rand_num_for_schnorr_proof_ = safeheron::rand::RandomBNLt(curv->n);
     ctx->local_party_.dlog_proof_x_.ProveWithREx(sign_key.local_party_.x_, ctx->local_party_.rand_num_for_schnorr_proof_, ctx->curve_type_);
+    CountPrimitive(Primitive::ZKProve);
 
     // Paillier proof
     ctx->local_party_.pail_proof_.Prove(sign_key.local_party_.pail_pub_.n(),
                                         sign_key.local_party_.pail_priv_.p(),
                                         sign_key.local_party_.pail_priv_.q());
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -20,20 +21,14 @@ namespace key_gen {
 bool Round2BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::key_gen::Round2BCMessage &message) const {
     bool ok = true;
 
-    safeheron::proto::DLogProof dlog_proof;
-    ok = dlog_proof_x_.ToProtoObject(dlog_proof);
+    ok = dlog_proof_x_.ToProtoObject(*message.mutable_dlog_proof_x());
     if (!ok) return false;
-    message.mutable_dlog_proof_x()->CopyFrom(dlog_proof);
 
-    safeheron::proto::CurvePoint point;
-    ok = pub_.ToProtoObject(point);
+    ok = pub_.ToProtoObject(*message.mutable_pub());
     if (!ok) return false;
-    message.mutable_pub()->CopyFrom(point);
 
-    safeheron::proto::PailBlumModulusProof pail_proof;
-    ok = pail_proof_.ToProtoObject(pail_proof);
+    ok = pail_proof_.ToProtoObject(*message.mutable_pail_proof());
     if (!ok) return false;
-    message.mutable_pail_proof()->CopyFrom(pail_proof);
 
     return true;
 }
@@ -58,7 +53,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::key_gen::Round2BCMessage Prot
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -72,7 +68,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -82,7 +79,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -96,7 +94,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
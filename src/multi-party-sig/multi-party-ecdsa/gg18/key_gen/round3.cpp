@@ -4,6 +4,7 @@
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/round3.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -12,6 +13,8 @@ using safeheron::sss::Polynomial;
 using safeheron::curve::CurveType;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -21,17 +24,17 @@ namespace gg18{
 namespace key_gen {
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -48,10 +51,10 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -63,12 +66,14 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].dlog_proof_x_.Verify();
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Receive a differentr g^sign_key_share, or failed to verify schnorr proof of sign_key share!");
         return false;
     }
 
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].pail_proof_.Verify(sign_key.remote_parties_[pos].pail_pub_.n());
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify paillier proof!");
@@ -81,7 +86,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round3::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = GetCurveParam(ctx->curve_type_);
 
@@ -15,7 +15,7 @@ namespace multi_party_ecdsa{
 namespace gg18{
 namespace key_refresh {
 
-Context::Context(int total_parties): MPCContext(total_parties){
+Context::Context(int total_parties): MPCContext(total_parties), flag_prepare_pail_key_(false), flag_prepare_aux_proofs_(false){
     BindAllRounds();
 }
 
@@ -24,11 +24,14 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     sign_key_ = ctx.sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
     round3_ = ctx.round3_;
     round4_ = ctx.round4_;
+    flag_prepare_pail_key_ = ctx.flag_prepare_pail_key_;
+    flag_prepare_aux_proofs_ = ctx.flag_prepare_aux_proofs_;
     // End Assignments.
 
     BindAllRounds();
@@ -45,11 +48,14 @@ Context &Context::operator=(const Context &ctx){
     sign_key_ = ctx.sign_key_;
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
     round3_ = ctx.round3_;
     round4_ = ctx.round4_;
+    flag_prepare_pail_key_ = ctx.flag_prepare_pail_key_;
+    flag_prepare_aux_proofs_ = ctx.flag_prepare_aux_proofs_;
     // End Assignments.
 
     BindAllRounds();
@@ -68,6 +74,80 @@ bool Context::CreateContext(Context &ctx, std::string &sign_key_base64) {
         ctx.remote_parties_.emplace_back();
     }
 
+    ctx.remote_party_pos_index_.Build(ctx.sign_key_.remote_parties_);
+
+    return true;
+}
+
+bool Context::CreateContext(Context &ctx, std::string &sign_key_base64,
+                            const BN &N_tilde,
+                            const BN &h1,
+                            const BN &h2,
+                            const BN &p,
+                            const BN &q,
+                            const BN &alpha,
+                            const BN &beta,
+                            const safeheron::pail::PailPrivKey &pail_priv,
+                            const safeheron::pail::PailPubKey &pail_pub) {
+    bool ok = CreateContext(ctx, sign_key_base64);
+    if (!ok) return false;
+
+    // N_tilde = (2p + 1)(2q + 1), h2 = h1^alpha, h1 = h2^beta
+    if (N_tilde.BitLength() < 2046 || (p * 2 + 1) * (q * 2 + 1) != N_tilde) return false;
+    if (h1.PowM(alpha, N_tilde) != h2 || h2.PowM(beta, N_tilde) != h1) return false;
+    if (pail_pub.n() != pail_priv.p() * pail_priv.q()) return false;
+
+    SignKey &sign_key = ctx.sign_key_;
+    sign_key.local_party_.N_tilde_ = N_tilde;
+    sign_key.local_party_.h1_ = h1;
+    sign_key.local_party_.h2_ = h2;
+    sign_key.local_party_.p_ = p;
+    sign_key.local_party_.q_ = q;
+    sign_key.local_party_.alpha_ = alpha;
+    sign_key.local_party_.beta_ = beta;
+    sign_key.local_party_.pail_priv_ = pail_priv;
+    sign_key.local_party_.pail_pub_ = pail_pub;
+    ctx.flag_prepare_pail_key_ = true;
+
+    return true;
+}
+
+bool Context::ShareAuxProofs(const std::vector<Context *> &ctx_arr) {
+    if (ctx_arr.empty()) return false;
+    const SignKey &first_key = ctx_arr[0]->sign_key_;
+    for (const Context *ctx: ctx_arr) {
+        if (!ctx->flag_prepare_pail_key_) return false;
+        const SignKey &sign_key = ctx->sign_key_;
+        if (sign_key.local_party_.N_tilde_ != first_key.local_party_.N_tilde_ ||
+            sign_key.local_party_.h1_ != first_key.local_party_.h1_ ||
+            sign_key.local_party_.h2_ != first_key.local_party_.h2_ ||
+            sign_key.local_party_.pail_pub_.n() != first_key.local_party_.pail_pub_.n()) {
+            return false;
+        }
+    }
+
+    LocalTParty &first_party = ctx_arr[0]->local_party_;
+    first_party.dln_proof_1_.Prove(first_key.local_party_.N_tilde_,
+                                   first_key.local_party_.h1_,
+                                   first_key.local_party_.h2_,
+                                   first_key.local_party_.p_,
+                                   first_key.local_party_.q_,
+                                   first_key.local_party_.alpha_);
+    first_party.dln_proof_2_.Prove(first_key.local_party_.N_tilde_,
+                                   first_key.local_party_.h2_,
+                                   first_key.local_party_.h1_,
+                                   first_key.local_party_.p_,
+                                   first_key.local_party_.q_,
+                                   first_key.local_party_.beta_);
+    first_party.pail_proof_.Prove(first_key.local_party_.pail_pub_.n(),
+                                  first_key.local_party_.pail_priv_.p(),
+                                  first_key.local_party_.pail_priv_.q());
+    for (Context *ctx: ctx_arr) {
+        ctx->local_party_.dln_proof_1_ = first_party.dln_proof_1_;
+        ctx->local_party_.dln_proof_2_ = first_party.dln_proof_2_;
+        ctx->local_party_.pail_proof_ = first_party.pail_proof_;
+        ctx->flag_prepare_aux_proofs_ = true;
+    }
     return true;
 }
 
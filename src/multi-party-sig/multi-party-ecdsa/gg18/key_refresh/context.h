@@ -4,6 +4,7 @@
 
 #include <vector>
 #include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/common/party_index.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign_key.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/t_party.h"
@@ -39,17 +40,50 @@ public:
 
     void BindAllRounds();
 
+    /**
+     * Position of a remote party in remote_parties_ of the sign key, -1 if not found. It is looked up in an index
+     * built by CreateContext.
+     */
+    int get_remote_party_pos(const std::string &party_id) const { return remote_party_pos_index_.Find(party_id); }
+
     static bool CreateContext(Context &ctx, std::string &sign_key_base64);
 
+    /**
+     * Create a context with prepared (N_tilde, h1, h2) and Paillier key pair, instead of generating new ones in round 0.
+     * Useful to share one set of freshly generated auxiliary parameters across a batch of key refreshes.
+     */
+    static bool CreateContext(Context &ctx, std::string &sign_key_base64,
+                              const safeheron::bignum::BN &N_tilde,
+                              const safeheron::bignum::BN &h1,
+                              const safeheron::bignum::BN &h2,
+                              const safeheron::bignum::BN &p,
+                              const safeheron::bignum::BN &q,
+                              const safeheron::bignum::BN &alpha,
+                              const safeheron::bignum::BN &beta,
+                              const safeheron::pail::PailPrivKey &pail_priv,
+                              const safeheron::pail::PailPubKey &pail_pub);
+
+    /**
+     * Prove (N_tilde, h1, h2) and the Paillier key once for contexts created with the same prepared parameters, e.g.
+     * the wallets of a batch. These proofs depend on the parameters only, so rounds 1 and 2 of all the contexts send
+     * the shared proofs instead of proving again.
+     * @return false if a context was not created with the prepared parameters of the first one.
+     */
+    static bool ShareAuxProofs(const std::vector<Context *> &ctx_arr);
+
 public:
     safeheron::multi_party_ecdsa::gg18::SignKey sign_key_;
     LocalTParty local_party_;
     std::vector<RemoteTParty> remote_parties_;
+    safeheron::mpc_flow::common::PartyIndex remote_party_pos_index_;
     Round0 round0_;
     Round1 round1_;
     Round2 round2_;
     Round3 round3_;
     Round4 round4_;
+
+    bool flag_prepare_pail_key_;
+    bool flag_prepare_aux_proofs_;
 };
 
 }
@@ -1,9 +1,11 @@
+#include <future>
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "crypto-suites/crypto-hash/sha256.h"
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/context.h"
+#include "multi-party-sig/mpc-flow/common/transcript_writer.h"
 
 using std::string;
 using std::vector;
@@ -13,6 +15,7 @@ using safeheron::curve::Curve;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
 using safeheron::sss::Polynomial;
+using safeheron::mpc_flow::common::TranscriptWriter;
 
 using safeheron::multi_party_ecdsa::gg18::SignKey;
 
@@ -23,10 +26,30 @@ namespace key_refresh {
 
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const Curve *curv = GetCurveParam(sign_key.X_.GetCurveType());
 
+    // Prime generation dominates this round, so start generating (N_tilde, h1, h2) and Paillier's key pair in the
+    // background, and compute the VSSS shares in the meantime.
+    // Both are skipped if they were prepared when the context was created.
+    std::future<void> n_tilde_future;
+    std::future<void> pail_future;
+    if (!ctx->flag_prepare_pail_key_) {
+        n_tilde_future = std::async(std::launch::async, [&sign_key]() {
+            safeheron::zkp::dln_proof::GenerateN_tilde(sign_key.local_party_.N_tilde_,
+                                                       sign_key.local_party_.h1_,
+                                                       sign_key.local_party_.h2_,
+                                                       sign_key.local_party_.p_,
+                                                       sign_key.local_party_.q_,
+                                                       sign_key.local_party_.alpha_,
+                                                       sign_key.local_party_.beta_);
+        });
+        pail_future = std::async(std::launch::async, [&sign_key]() {
+            CreateKeyPair2048(sign_key.local_party_.pail_priv_, sign_key.local_party_.pail_pub_);
+        });
+    }
+
     // Compute w = x * lambda % q
     vector<BN> share_index_arr;
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
@@ -50,17 +73,9 @@ bool Round0::ComputeVerify() {
                                                 curv->n,
                                                 curv->g);
 
-    // Generate (N_tilde, h1, h2)
-    safeheron::zkp::dln_proof::GenerateN_tilde(sign_key.local_party_.N_tilde_,
-                    sign_key.local_party_.h1_,
-                    sign_key.local_party_.h2_,
-                    sign_key.local_party_.p_,
-                    sign_key.local_party_.q_,
-                    sign_key.local_party_.alpha_,
-                    sign_key.local_party_.beta_);
-
-    // Generate Paillier's Key Pair
-    CreateKeyPair2048(sign_key.local_party_.pail_priv_, sign_key.local_party_.pail_pub_);
+    // Wait for (N_tilde, h1, h2) and Paillier's Key Pair
+    if (n_tilde_future.valid()) n_tilde_future.get();
+    if (pail_future.valid()) pail_future.get();
 
     // Commitment(VS || N_tilde || h1 || h2 || pail_pub)
     char blind_factor_buf[256];
@@ -69,27 +84,21 @@ bool Round0::ComputeVerify() {
 
     uint8_t digest[CSHA256::OUTPUT_SIZE];
     CSHA256 sha256;
-    string buf;
+    TranscriptWriter<CSHA256> transcript(sha256);
     // VS Commitment
     for(size_t i = 0; i < ctx->local_party_.vs_.size(); ++i){
-        ctx->local_party_.vs_[i].EncodeFull(buf);
-        sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+        transcript.Append(ctx->local_party_.vs_[i]);
     }
     // N_tilde
-    sign_key.local_party_.N_tilde_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.N_tilde_);
     // h1
-    sign_key.local_party_.h1_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.h1_);
     // h2
-    sign_key.local_party_.h2_.ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
+    transcript.Append(sign_key.local_party_.h2_);
     // pail_pub
-    sign_key.local_party_.pail_pub_.n().ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-    sign_key.local_party_.pail_pub_.g().ToBytesBE(buf);
-    sha256.Write(reinterpret_cast<const unsigned char *>(buf.c_str()), buf.size());
-    sha256.Write(reinterpret_cast<const unsigned char *>(ctx->local_party_.blind_factor_.c_str()), ctx->local_party_.blind_factor_.size());
+    transcript.Append(sign_key.local_party_.pail_pub_.n());
+    transcript.Append(sign_key.local_party_.pail_pub_.g());
+    transcript.Append(ctx->local_party_.blind_factor_);
     sha256.Finalize(digest);
     ctx->local_party_.V_.assign((const char*)digest, sizeof digest);
 
@@ -104,7 +113,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/round1.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -9,6 +10,8 @@ using safeheron::curve::Curve;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -17,17 +20,17 @@ namespace key_refresh {
 
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -43,10 +46,10 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -58,27 +61,31 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
-    // DLN Proof
-    ctx->local_party_.dln_proof_1_.Prove(sign_key.local_party_.N_tilde_,
-                                        sign_key.local_party_.h1_,
-                                        sign_key.local_party_.h2_,
-                                        sign_key.local_party_.p_,
-                                        sign_key.local_party_.q_,
-                                        sign_key.local_party_.alpha_);
-    ctx->local_party_.dln_proof_2_.Prove(sign_key.local_party_.N_tilde_,
-                                        sign_key.local_party_.h2_,
-                                        sign_key.local_party_.h1_,
-                                        sign_key.local_party_.p_,
-                                        sign_key.local_party_.q_,
-                                        sign_key.local_party_.beta_);
+    // DLN Proof, unless shared by ShareAuxProofs
+    if (!ctx->flag_prepare_aux_proofs_) {
+        ctx->local_party_.dln_proof_1_.Prove(sign_key.local_party_.N_tilde_,
+                                            sign_key.local_party_.h1_,
+                                            sign_key.local_party_.h2_,
+                                            sign_key.local_party_.p_,
+                                            sign_key.local_party_.q_,
+                                            sign_key.local_party_.alpha_);
+        CountPrimitive(Primitive::ZKProve);
+        ctx->local_party_.dln_proof_2_.Prove(sign_key.local_party_.N_tilde_,
+                                            sign_key.local_party_.h2_,
+                                            sign_key.local_party_.h1_,
+                                            sign_key.local_party_.p_,
+                                            sign_key.local_party_.q_,
+                                            sign_key.local_party_.beta_);
+        CountPrimitive(Primitive::ZKProve);
+    }
     return true;
 }
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -12,12 +12,14 @@ namespace multi_party_ecdsa{
 namespace gg18{
 namespace key_refresh {
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
 
 public:
-    Round1(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST){}
+    Round1(): TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST){}
 
     void Init() override;
 
@@ -2,8 +2,10 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-hash/sha256.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -14,6 +16,8 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -23,7 +27,7 @@ namespace gg18{
 namespace key_refresh {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -31,10 +35,10 @@ void Round2::Init() {
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -58,11 +62,11 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -111,6 +115,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
     sign_key.remote_parties_[pos].N_tilde_ = bc_message_arr_[pos].N_tilde_;
     sign_key.remote_parties_[pos].h1_ = bc_message_arr_[pos].h1_;
     sign_key.remote_parties_[pos].h2_ = bc_message_arr_[pos].h2_;
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].dln_proof_1_.Verify(bc_message_arr_[pos].N_tilde_,
                                                   bc_message_arr_[pos].h1_,
                                                   bc_message_arr_[pos].h2_);
@@ -118,6 +123,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, string("Failed to verify DLN proof(dln_proof_1_) from party :") + sign_key.remote_parties_[pos].party_id_);
         return false;
     }
+    CountPrimitive(Primitive::ZKVerify);
     ok = bc_message_arr_[pos].dln_proof_2_.Verify(bc_message_arr_[pos].N_tilde_,
                                                   bc_message_arr_[pos].h2_,
                                                   bc_message_arr_[pos].h1_);
@@ -137,7 +143,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
 bool Round2::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -148,28 +154,33 @@ bool Round2::ComputeVerify() {
     ctx->local_party_.new_X_ = curv->g * ctx->local_party_.new_x_;
     ctx->local_party_.rand_num_for_schnorr_proof_ = safeheron::rand::RandomBNLt(curv->n);
     ctx->local_party_.dlog_proof_x_.ProveWithREx(ctx->local_party_.new_x_, ctx->local_party_.rand_num_for_schnorr_proof_, sign_key.X_.GetCurveType());
-
-    // Paillier proof
-    ctx->local_party_.pail_proof_.Prove(sign_key.local_party_.pail_pub_.n(),
-                                        sign_key.local_party_.pail_priv_.p(),
-                                        sign_key.local_party_.pail_priv_.q());
+    CountPrimitive(Primitive::ZKProve);
+
+    // Paillier proof, unless shared by ShareAuxProofs
+    if (!ctx->flag_prepare_aux_proofs_) {
+        ctx->local_party_.pail_proof_.Prove(sign_key.local_party_.pail_pub_.n(),
+                                            sign_key.local_party_.pail_priv_.p(),
+                                            sign_key.local_party_.pail_priv_.q());
+        CountPrimitive(Primitive::ZKProve);
+    }
 
 
-    // No small factor proof
-    for(size_t i = 0; i < sign_key.remote_parties_.size(); ++i){
+    // No small factor proof, one per remote party. The proofs are independent, so prove them in parallel.
+    safeheron::mpc_flow::common::ParallelFor(sign_key.remote_parties_.size(), [ctx, &sign_key](size_t i) {
         safeheron::zkp::no_small_factor_proof::NoSmallFactorSetUp set_up(sign_key.remote_parties_[i].N_tilde_,
                                                                          sign_key.remote_parties_[i].h1_,
                                                                          sign_key.remote_parties_[i].h2_);
         safeheron::zkp::no_small_factor_proof::NoSmallFactorStatement statement(sign_key.local_party_.pail_pub_.n(), 256, 512);
         safeheron::zkp::no_small_factor_proof::NoSmallFactorWitness witness(sign_key.local_party_.pail_priv_.p(), sign_key.local_party_.pail_priv_.q());
         ctx->remote_parties_[i].nsf_proof_.Prove(set_up, statement, witness);
-    }
+        CountPrimitive(Primitive::ZKProve);
+    });
     return true;
 }
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -19,20 +20,14 @@ namespace key_refresh {
 bool Round2P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::key_refresh::Round2P2PMessage &message) const {
     bool ok = true;
 
-    safeheron::proto::DLogProof dlog_proof;
-    ok = dlog_proof_x_.ToProtoObject(dlog_proof);
+    ok = dlog_proof_x_.ToProtoObject(*message.mutable_dlog_proof_x());
     if (!ok) return false;
-    message.mutable_dlog_proof_x()->CopyFrom(dlog_proof);
 
-    safeheron::proto::PailBlumModulusProof pail_proof;
-    ok = pail_proof_.ToProtoObject(pail_proof);
+    ok = pail_proof_.ToProtoObject(*message.mutable_pail_proof());
     if (!ok) return false;
-    message.mutable_pail_proof()->CopyFrom(pail_proof);
 
-    safeheron::proto::NoSmallFactorProof no_small_factor_proof;
-    ok = nsf_proof_.ToProtoObject(no_small_factor_proof);
+    ok = nsf_proof_.ToProtoObject(*message.mutable_nsf_proof());
     if (!ok) return false;
-    message.mutable_nsf_proof()->CopyFrom(no_small_factor_proof);
 
     return true;
 }
@@ -59,7 +54,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::key_refresh::Round2P2PMessage
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -73,7 +69,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -83,7 +80,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -97,7 +95,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
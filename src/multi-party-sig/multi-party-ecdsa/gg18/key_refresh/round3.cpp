@@ -1,7 +1,9 @@
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/round3.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -11,6 +13,8 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -20,17 +24,17 @@ namespace gg18{
 namespace key_refresh {
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -46,46 +50,56 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
     }
+    CountPrimitive(Primitive::ZKVerify);
     bool ok = p2p_message_arr_[pos].dlog_proof_x_.Verify();
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify commitment of schnorr proof of hd_sign key share!");
         return false;
     }
 
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].pail_proof_.Verify(sign_key.remote_parties_[pos].pail_pub_.n());
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify paillier proof!");
         return false;
     }
 
-    safeheron::zkp::no_small_factor_proof::NoSmallFactorSetUp set_up(sign_key.local_party_.N_tilde_,
-                                                                     sign_key.local_party_.h1_,
-                                                                     sign_key.local_party_.h2_);
-    safeheron::zkp::no_small_factor_proof::NoSmallFactorStatement statement(sign_key.remote_parties_[pos].pail_pub_.n(), 256, 512);
-    ok = p2p_message_arr_[pos].nsf_proof_.Verify(set_up, statement);
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ok = message_arr_[pos].nsf_proof_.Verify(set_up, statement)");
-        return false;
-    }
-
+    // No small factor proofs are verified in parallel in ComputeVerify, once all of them have arrived.
     return true;
 }
 
 bool Round3::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
+    // No small factor proofs
+    vector<char> nsf_ok_arr(p2p_message_arr_.size(), 0);
+    safeheron::mpc_flow::common::ParallelFor(p2p_message_arr_.size(), [this, &sign_key, &nsf_ok_arr](size_t i) {
+        safeheron::zkp::no_small_factor_proof::NoSmallFactorSetUp set_up(sign_key.local_party_.N_tilde_,
+                                                                         sign_key.local_party_.h1_,
+                                                                         sign_key.local_party_.h2_);
+        safeheron::zkp::no_small_factor_proof::NoSmallFactorStatement statement(sign_key.remote_parties_[i].pail_pub_.n(), 256, 512);
+        CountPrimitive(Primitive::ZKVerify);
+        nsf_ok_arr[i] = p2p_message_arr_[i].nsf_proof_.Verify(set_up, statement) ? 1 : 0;
+    });
+    for (size_t i = 0; i < nsf_ok_arr.size(); ++i) {
+        if (!nsf_ok_arr[i]) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, string("Failed to verify no small factor proof from party: ") + sign_key.remote_parties_[i].party_id_);
+            return false;
+        }
+    }
+
     vector<BN> share_index_arr;
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         share_index_arr.push_back(sign_key.remote_parties_[i].index_);
@@ -122,7 +136,7 @@ bool Round3::ComputeVerify() {
 
 bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
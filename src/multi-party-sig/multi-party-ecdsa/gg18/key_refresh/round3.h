@@ -12,12 +12,14 @@ namespace multi_party_ecdsa{
 namespace gg18{
 namespace key_refresh {
 
-class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round2P2PMessage> p2p_message_arr_;
 
 public:
-    Round3(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P, safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
+    Round3(): TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P, safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
 
     void Init() override;
 
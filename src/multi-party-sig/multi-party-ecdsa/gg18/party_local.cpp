@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/party.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -29,23 +30,17 @@ bool LocalParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::Party
     index_.ToHexStr(str);
     party.set_index(str);
 
-    safeheron::proto::PailPriv pail_priv;
-    ok = pail_priv_.ToProtoObject(pail_priv);
+    ok = pail_priv_.ToProtoObject(*party.mutable_pail_priv());
     if (!ok) return false;
-    party.mutable_pail_priv()->CopyFrom(pail_priv);
 
-    safeheron::proto::PailPub pail_pub;
-    ok = pail_pub_.ToProtoObject(pail_pub);
+    ok = pail_pub_.ToProtoObject(*party.mutable_pail_pub());
     if (!ok) return false;
-    party.mutable_pail_pub()->CopyFrom(pail_pub);
 
     x_.ToHexStr(str);
     party.set_x(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = g_x_.ToProtoObject(point);
+    ok = g_x_.ToProtoObject(*party.mutable_g_x());
     if (!ok) return false;
-    party.mutable_g_x()->CopyFrom(point);
 
     N_tilde_.ToHexStr(str);
     party.set_n_tilde(str);
@@ -135,7 +130,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::Party ProtoObject;
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -149,7 +145,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -159,7 +156,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -173,7 +171,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -28,6 +28,7 @@ Context::Context(const Context &ctx): MPCContext(ctx){
 
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -64,6 +65,7 @@ Context &Context::operator=(const Context &ctx){
 
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
+    remote_party_pos_index_ = ctx.remote_party_pos_index_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
     round2_ = ctx.round2_;
@@ -89,17 +91,29 @@ Context &Context::operator=(const Context &ctx){
 
 bool Context::CreateContext(Context &ctx, const std::string &sign_key_base64, const safeheron::bignum::BN &m) {
     bool ok = true;
-    ctx.m_ = m;
 
-    ok = ctx.sign_key_.FromBase64(sign_key_base64);
+    safeheron::multi_party_ecdsa::gg18::SignKey sign_key;
+    ok = sign_key.FromBase64(sign_key_base64);
     if (!ok) return false;
-    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+
+    return CreateContext(ctx, sign_key, m);
+}
+
+bool Context::CreateContext(Context &ctx, const safeheron::multi_party_ecdsa::gg18::SignKey &sign_key,
+                            const safeheron::bignum::BN &m) {
+    bool ok = true;
+    ctx.m_ = m;
+
+    ok = ((int)sign_key.n_parties_ == ctx.get_total_parties());
     if (!ok) return false;
+    ctx.sign_key_ = sign_key;
 
     for (uint32_t i = 0; i < ctx.sign_key_.n_parties_ - 1; ++i) {
         ctx.remote_parties_.emplace_back();
     }
 
+    ctx.remote_party_pos_index_.Build(ctx.sign_key_.remote_parties_);
+
     return true;
 }
 
@@ -3,7 +3,9 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/exception/located_exception.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/mta.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -16,6 +18,8 @@ using safeheron::bignum::BN;
 using safeheron::curve::CurvePoint;
 using namespace safeheron::rand;
 using namespace safeheron::encode;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -25,6 +29,12 @@ namespace sign {
 void
 MtA_Step1(BN &message_a, const pail::PailPubKey &pail_pub, const BN &input_a, const BN &r_lt_pailN) {
     message_a = pail_pub.EncryptWithR(input_a, r_lt_pailN);
+    CountPrimitive(Primitive::PailEncrypt);
+}
+
+void
+MtA_Step1WithRN(BN &message_a, const pail::PailPubKey &pail_pub, const BN &input_a, const BN &r_pow_N) {
+    message_a = safeheron::mpc_flow::common::EncryptWithRN(pail_pub, input_a, r_pow_N);
 }
 
 void
@@ -36,6 +46,21 @@ MtA_Step2(safeheron::bignum::BN &message_b, safeheron::bignum::BN &beta, const p
 
     BN bma = pub.HomomorphicMulPlain(c_a, input_b);
     BN c_b = pub.HomomorphicAddPlainWithR(bma, beta_tag, r_for_pail);
+    CountPrimitive(Primitive::PailEncrypt);
+
+    beta = beta_tag.Neg() % order;
+    message_b = c_b;
+}
+
+void
+MtA_Step2WithRN(safeheron::bignum::BN &message_b, safeheron::bignum::BN &beta, const pail::PailPubKey &pub,
+                const safeheron::bignum::BN &input_b,
+                const safeheron::bignum::BN &message_a, const safeheron::bignum::BN &beta_tag,
+                const safeheron::bignum::BN &r_pow_N, const safeheron::bignum::BN &order) {
+    const BN &c_a = message_a;
+
+    BN bma = pub.HomomorphicMulPlain(c_a, input_b);
+    BN c_b = safeheron::mpc_flow::common::HomomorphicAddPlainWithRN(pub, bma, beta_tag, r_pow_N);
 
     beta = beta_tag.Neg() % order;
     message_b = c_b;
@@ -44,6 +69,7 @@ MtA_Step2(safeheron::bignum::BN &message_b, safeheron::bignum::BN &beta, const p
 void MtA_Step3(BN &alpha, const safeheron::bignum::BN &message_b, const pail::PailPrivKey &pail_priv,
                const safeheron::bignum::BN &order) {
     alpha = pail_priv.Decrypt(message_b);
+    CountPrimitive(Primitive::PailDecrypt);
     alpha = alpha % order;
 }
 
@@ -25,6 +25,18 @@ void MtA_Step1(safeheron::bignum::BN &message_a,
                const safeheron::bignum::BN &input_a,
                const safeheron::bignum::BN &r_lt_pailN);
 
+/**
+ * Construct message A of MTA protocol with precomputed r^N.
+ *
+ * @param [out] message_a
+ * @param [in] pub Paillier Public Key.
+ * @param [in] input_a
+ * @param [in] r_pow_N r^pailN mod pailN^2, where r in (0, pailN) and gcd(r, pailN) = 1
+ */
+void MtA_Step1WithRN(safeheron::bignum::BN &message_a,
+                     const pail::PailPubKey &pub,
+                     const safeheron::bignum::BN &input_a,
+                     const safeheron::bignum::BN &r_pow_N);
 
 /**
  * Construct Message B for MTA protocol and get beta where
@@ -48,6 +60,27 @@ MtA_Step2(safeheron::bignum::BN &message_b, safeheron::bignum::BN &beta,
           const safeheron::bignum::BN &r_for_pail,
           const safeheron::bignum::BN &order);
 
+/**
+ * Construct Message B for MTA protocol with precomputed r^N.
+ *
+ * @param [out] message_b
+ * @param [out] beta
+ * @param [in] pub Paillier Public Key.
+ * @param [in] input_b
+ * @param [in] message_a
+ * @param [in] beta_tag in (0, pailN)
+ * @param [in] r_pow_N r^pailN mod pailN^2, where r in (0, pailN) and gcd(r, pailN) = 1
+ * @param [in] order:  order of the curve
+ */
+void
+MtA_Step2WithRN(safeheron::bignum::BN &message_b, safeheron::bignum::BN &beta,
+                const pail::PailPubKey &pub,
+                const safeheron::bignum::BN &input_b,
+                const safeheron::bignum::BN &message_a,
+                const safeheron::bignum::BN &beta_tag,
+                const safeheron::bignum::BN &r_pow_N,
+                const safeheron::bignum::BN &order);
+
 /**
  * Get alpha where
  *      alpha + beta = input_a * input_b
@@ -2,9 +2,11 @@
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/mta.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -23,6 +25,8 @@ using safeheron::zkp::pail::PailAffGroupEleRangeProof_V1;
 using safeheron::zkp::pail::PailEncGroupEleRangeSetUp;
 using safeheron::zkp::pail::PailEncGroupEleRangeStatement;
 using safeheron::zkp::pail::PailEncGroupEleRangeProof;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -34,7 +38,7 @@ namespace sign{
 bool Round0::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -64,11 +68,12 @@ bool Round0::ComputeVerify() {
 
     // MTA(k, gamma) / MTA(k, w) step1
     // - Constructor message A
-    ctx->local_party_.r_for_pail_for_mta_msg_a_ = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.pail_pub_.n());
-    MtA_Step1(ctx->local_party_.message_a_,
-              sign_key.local_party_.pail_pub_,
-              ctx->local_party_.k_,
-              ctx->local_party_.r_for_pail_for_mta_msg_a_);
+    BN r_pow_N;
+    safeheron::mpc_flow::common::SampleEncRandomness(sign_key.local_party_.pail_pub_, ctx->local_party_.r_for_pail_for_mta_msg_a_, r_pow_N);
+    MtA_Step1WithRN(ctx->local_party_.message_a_,
+                    sign_key.local_party_.pail_pub_,
+                    ctx->local_party_.k_,
+                    r_pow_N);
     // - Generate proof from alice's side.
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         PailEncRangeSetUp_V1 setup(sign_key.remote_parties_[i].N_tilde_,
@@ -82,13 +87,14 @@ bool Round0::ComputeVerify() {
         zkp::pail::PailEncRangeWitness_V1 witness(ctx->local_party_.k_,
                                                   ctx->local_party_.r_for_pail_for_mta_msg_a_);
         ctx->remote_parties_[i].alice_proof_.Prove(setup, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
     return true;
 }
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
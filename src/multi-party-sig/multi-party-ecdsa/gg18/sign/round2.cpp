@@ -2,6 +2,7 @@
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/mta.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -16,6 +17,8 @@ using safeheron::zkp::pail::PailAffRangeProof;
 using safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V1;
 using safeheron::zkp::pail::PailAffGroupEleRangeStatement_V1;
 using safeheron::zkp::pail::PailAffGroupEleRangeProof_V1;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -25,17 +28,17 @@ namespace gg18{
 namespace sign{
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -51,12 +54,12 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -69,6 +72,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
                                       p2p_message_arr_[pos].message_b_for_k_gamma_,
                                       sign_key.local_party_.pail_pub_,
                                       curv->n);
+    CountPrimitive(Primitive::ZKVerify);
     bool ok = p2p_message_arr_[pos].bob_proof_1_.Verify(setup_1, statement_1);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the 'bob_proof_1_'!");
@@ -83,6 +87,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
                                       sign_key.local_party_.pail_pub_,
                                       sign_key.remote_parties_[pos].g_x_ * ctx->local_party_.l_arr_[pos],
                                       curv->n);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].bob_proof_2_.Verify(setup_2, statement_2);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the 'bob_proof_2_'!");
@@ -95,7 +100,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 bool Round2::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -131,7 +136,7 @@ bool Round2::ComputeVerify() {
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -3,6 +3,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/round4.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -11,6 +12,8 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -20,17 +23,17 @@ namespace gg18{
 namespace sign{
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -52,7 +55,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 bool Round3::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -65,13 +68,14 @@ bool Round3::ComputeVerify() {
 
     ctx->local_party_.rand_num_for_proof_gamma_ = safeheron::rand::RandomBNLt(curv->n);
     ctx->local_party_.dlog_proof_gamma_.ProveWithREx(ctx->local_party_.gamma_, ctx->local_party_.rand_num_for_proof_gamma_, sign_key.X_.GetCurveType());
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,6 +1,8 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -9,6 +11,8 @@ using google::protobuf::util::MessageToJsonString;
 using google::protobuf::util::JsonStringToMessage;
 using google::protobuf::util::JsonPrintOptions;
 using google::protobuf::util::JsonParseOptions;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 
 namespace safeheron {
@@ -23,10 +27,8 @@ bool Round3BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::s
     blind_factor_.ToHexStr(str);
     message.set_blind_factor(str);
 
-    safeheron::proto::DLogProof dlog_proof;
-    ok = dlog_proof_gamma_.ToProtoObject(dlog_proof);
+    ok = dlog_proof_gamma_.ToProtoObject(*message.mutable_dlog_proof_gamma_());
     if (!ok) return false;
-    message.mutable_dlog_proof_gamma_()->CopyFrom(dlog_proof);
 
     return true;
 }
@@ -37,7 +39,9 @@ bool Round3BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa:
     blind_factor_ = BN::FromHexStr(message.blind_factor());
 
     ok = dlog_proof_gamma_.FromProtoObject(message.dlog_proof_gamma_());
-    ok = ok && dlog_proof_gamma_.Verify();
+    if (!ok) return false;
+    CountPrimitive(Primitive::ZKVerify);
+    ok = dlog_proof_gamma_.Verify();
     if (!ok) return false;
 
     return true;
@@ -50,7 +54,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::sign::Round3BCMessage ProtoOb
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -64,7 +69,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -74,7 +80,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -88,7 +95,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -12,13 +12,15 @@ namespace multi_party_ecdsa{
 namespace gg18{
 namespace sign{
 
-class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round3BCMessage> bc_message_arr_;
 
 public:
-    Round4(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
-                       safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
+    Round4(): TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                            safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
 
     void Init() override;
 
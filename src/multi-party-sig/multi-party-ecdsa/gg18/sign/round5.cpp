@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/round5.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -10,6 +11,8 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -19,17 +22,17 @@ namespace gg18{
 namespace sign{
 
 void Round5::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round5::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -45,12 +48,12 @@ bool Round5::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round5::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -63,7 +66,7 @@ bool Round5::ReceiveVerify(const std::string &party_id) {
 bool Round5::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -79,16 +82,18 @@ bool Round5::ComputeVerify() {
     // Generate VRG proof
     ctx->local_party_.lc_proof_VRG_.Prove(ctx->local_party_.lc_statement_VRG_,
                                             ctx->local_party_.lc_witness_VRG_);
+    CountPrimitive(Primitive::ZKProve);
 
     // Schnorr Proof ( A_rho =  g^rho)
     ctx->local_party_.dlog_proof_rho_.ProveEx(ctx->local_party_.rho_, sign_key.X_.GetCurveType());
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round5::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
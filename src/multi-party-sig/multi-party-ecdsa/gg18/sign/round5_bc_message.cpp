@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -19,28 +20,21 @@ namespace sign{
 bool Round5BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::sign::Round5BCMessage &message) const {
     bool ok = true;
 
-    safeheron::proto::CurvePoint point;
-    ok = V_.ToProtoObject(point);
+    ok = V_.ToProtoObject(*message.mutable_v());
     if (!ok) return false;
-    message.mutable_v()->CopyFrom(point);
 
-    ok = A_.ToProtoObject(point);
+    ok = A_.ToProtoObject(*message.mutable_a());
     if (!ok) return false;
-    message.mutable_a()->CopyFrom(point);
 
     string str;
     blind_factor_.ToHexStr(str);
     message.set_blind_factor(str);
 
-    safeheron::proto::LinearCombinationProof VRG_proof;
-    ok = lc_proof_VRG_.ToProtoObject(VRG_proof);
+    ok = lc_proof_VRG_.ToProtoObject(*message.mutable_lc_proof_vrg());
     if (!ok) return false;
-    message.mutable_lc_proof_vrg()->CopyFrom(VRG_proof);
 
-    safeheron::proto::DLogProof_V2 dlog_proof;
-    ok = dlog_proof_rho_.ToProtoObject(dlog_proof);
+    ok = dlog_proof_rho_.ToProtoObject(*message.mutable_dlog_proof_rho());
     if (!ok) return false;
-    message.mutable_dlog_proof_rho()->CopyFrom(dlog_proof);
 
     return true;
 }
@@ -72,7 +66,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::sign::Round5BCMessage ProtoOb
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -86,7 +81,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -96,7 +92,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -110,7 +107,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
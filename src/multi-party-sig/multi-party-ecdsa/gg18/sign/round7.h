@@ -13,13 +13,15 @@ namespace gg18{
 namespace sign{
 
 
-class Round7 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round7 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round6BCMessage> bc_message_arr_;
 
 public:
-    Round7(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
-                       safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
+    Round7(): TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                            safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
 
     void Init() override;
 
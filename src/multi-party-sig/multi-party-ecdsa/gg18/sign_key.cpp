@@ -3,6 +3,7 @@
 #include "crypto-suites/crypto-encode/base64.h"
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign_key.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using std::vector;
@@ -40,23 +41,16 @@ bool SignKey::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg18::SignKey &
     sign_key.set_threshold(threshold_);
     sign_key.set_n_parties(n_parties_);
 
-    safeheron::proto::multi_party_ecdsa::gg18::Party local_party;
-    ok = local_party_.ToProtoObject(local_party);
+    ok = local_party_.ToProtoObject(*sign_key.mutable_local_party());
     if (!ok) return false;
-    sign_key.mutable_local_party()->CopyFrom(local_party);
 
     for (size_t i = 0; i < remote_parties_.size(); i++) {
-        safeheron::proto::multi_party_ecdsa::gg18::Party remote_party;
-        ok = remote_parties_[i].ToProtoObject(remote_party);
+        ok = remote_parties_[i].ToProtoObject(*sign_key.add_remote_parties());
         if (!ok) return false;
-        safeheron::proto::multi_party_ecdsa::gg18::Party *new_party = sign_key.add_remote_parties();
-        new_party->CopyFrom(remote_party);
     }
 
-    safeheron::proto::CurvePoint point;
-    ok = X_.ToProtoObject(point);
+    ok = X_.ToProtoObject(*sign_key.mutable_g_x());
     if (!ok) return false;
-    sign_key.mutable_g_x()->CopyFrom(point);
 
     return true;
 }
@@ -123,7 +117,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg18::SignKey ProtoObject;
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -137,7 +132,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -147,7 +143,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -161,7 +158,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -1,3 +1,4 @@
+#include <unordered_set>
 
 
 #include "crypto-suites/crypto-bn/rand.h"
@@ -44,18 +45,18 @@ int find_party_id(std::string &party_id, const std::vector<std::string> &party_i
     return ret;
 }
 
-bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr){
+bool trim_sign_key(SignKey &out_sign_key, const SignKey &in_sign_key, const std::vector<std::string> &participant_id_arr){
     bool ok = true;
-    SignKey sign_key;
-    ok = sign_key.FromBase64(in_sign_key_base64);
-    if(!ok) return false;
+    if (&out_sign_key != &in_sign_key) out_sign_key = in_sign_key;
+    SignKey &sign_key = out_sign_key;
 
-    ok = (find_party_id(sign_key.local_party_.party_id_, participant_id_arr) != -1);
+    std::unordered_set<std::string> participant_id_set(participant_id_arr.begin(), participant_id_arr.end());
+    ok = (participant_id_set.count(sign_key.local_party_.party_id_) != 0);
     if(!ok) return false;
 
     auto iter = sign_key.remote_parties_.begin();
     while(iter != sign_key.remote_parties_.end()){
-        bool found = (find_party_id((*iter).party_id_, participant_id_arr) != -1);
+        bool found = (participant_id_set.count((*iter).party_id_) != 0);
         if(found){
             ++iter;
         }else{
@@ -70,6 +71,18 @@ bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_
     ok = sign_key.ValidityTest();
     if (!ok) return false;
 
+    return true;
+}
+
+bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr){
+    bool ok = true;
+    SignKey sign_key;
+    ok = sign_key.FromBase64(in_sign_key_base64);
+    if(!ok) return false;
+
+    ok = trim_sign_key(sign_key, sign_key, participant_id_arr);
+    if(!ok) return false;
+
     ok = sign_key.ToBase64(out_sign_key_base64 );
     if (!ok) return false;
 
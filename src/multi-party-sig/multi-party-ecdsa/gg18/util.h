@@ -6,6 +6,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-paillier/pail.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/sign_key.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -24,6 +25,15 @@ int find_party_id(std::string &party_id, const std::vector<std::string> &party_i
  */
 bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr);
 
+/**
+ * Same as above, on a parsed sign key.
+ * @param out_sign_key may be in_sign_key.
+ * @param in_sign_key
+ * @param participant_id_arr
+ */
+bool trim_sign_key(SignKey &out_sign_key, const SignKey &in_sign_key,
+                   const std::vector<std::string> &participant_id_arr);
+
 }
 }
 }
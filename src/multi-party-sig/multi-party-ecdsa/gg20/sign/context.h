@@ -5,6 +5,7 @@
 #include <vector>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/common/party_index.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/gg18.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/t_party.h"
@@ -42,14 +43,28 @@ public:
 public:
     void BindAllRounds();
 
+    /**
+     * Position of a remote party in remote_parties_ of the sign key, -1 if not found. It is looked up in an index
+     * built by CreateContext.
+     */
+    int get_remote_party_pos(const std::string &party_id) const { return remote_party_pos_index_.Find(party_id); }
+
     static bool CreateContext(Context &ctx, const std::string &sign_key_base64, const safeheron::bignum::BN &m);
 
+    /**
+     * Same as above, with no decoding of the sign key.
+     * @param sign_key sign key of the participants, see trim_sign_key().
+     */
+    static bool CreateContext(Context &ctx, const safeheron::multi_party_ecdsa::gg18::SignKey &sign_key,
+                              const safeheron::bignum::BN &m);
+
 public:
     safeheron::multi_party_ecdsa::gg18::SignKey sign_key_;
     safeheron::bignum::BN m_;
 
     LocalTParty local_party_;
     std::vector<RemoteTParty> remote_parties_;
+    safeheron::mpc_flow::common::PartyIndex remote_party_pos_index_;
     Round0 round0_;
     Round1 round1_;
     Round2 round2_;
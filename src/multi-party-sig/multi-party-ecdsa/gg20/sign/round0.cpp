@@ -1,9 +1,11 @@
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/mta.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -16,7 +18,9 @@ using safeheron::multi_party_ecdsa::gg18::SignKey;
 using safeheron::zkp::pail::PailEncRangeSetUp_V1;
 using safeheron::zkp::pail::PailEncRangeStatement_V1;
 using safeheron::zkp::pail::PailEncRangeProof_V1;
-using safeheron::multi_party_ecdsa::gg18::sign::MtA_Step1;
+using safeheron::multi_party_ecdsa::gg18::sign::MtA_Step1WithRN;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -27,7 +31,7 @@ namespace sign{
 
 bool Round0::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
@@ -57,11 +61,12 @@ bool Round0::ComputeVerify() {
     ctx->local_party_.com_Gamma_ = safeheron::commitment::CreateComWithBlind(ctx->local_party_.Gamma_, ctx->local_party_.com_Gamma_blinding_factor_);
 
     // MTA(k, w) / MTA(k, gamma) - step 1
-    ctx->local_party_.r_for_pail_for_mta_msg_a_ = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.pail_pub_.n());
-    MtA_Step1(ctx->local_party_.message_a_,
-              sign_key.local_party_.pail_pub_,
-              ctx->local_party_.k_,
-              ctx->local_party_.r_for_pail_for_mta_msg_a_);
+    BN r_pow_N;
+    safeheron::mpc_flow::common::SampleEncRandomness(sign_key.local_party_.pail_pub_, ctx->local_party_.r_for_pail_for_mta_msg_a_, r_pow_N);
+    MtA_Step1WithRN(ctx->local_party_.message_a_,
+                    sign_key.local_party_.pail_pub_,
+                    ctx->local_party_.k_,
+                    r_pow_N);
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
 
         PailEncRangeSetUp_V1 setup(sign_key.remote_parties_[i].N_tilde_,
@@ -75,13 +80,14 @@ bool Round0::ComputeVerify() {
         zkp::pail::PailEncRangeWitness_V1 witness(ctx->local_party_.k_,
                                                 ctx->local_party_.r_for_pail_for_mta_msg_a_);
         ctx->remote_parties_[i].alice_proof_.Prove(setup, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
     return true;
 }
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,9 +1,11 @@
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/mta.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/round1.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -23,7 +25,9 @@ using safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V1;
 using safeheron::zkp::pail::PailAffGroupEleRangeStatement_V1;
 using safeheron::zkp::pail::PailAffGroupEleRangeWitness_V1;
 using safeheron::zkp::pail::PailAffGroupEleRangeProof_V1;
-using safeheron::multi_party_ecdsa::gg18::sign::MtA_Step2;
+using safeheron::multi_party_ecdsa::gg18::sign::MtA_Step2WithRN;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -33,7 +37,7 @@ namespace gg20{
 namespace sign{
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -41,12 +45,12 @@ void Round1::Init() {
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -69,12 +73,12 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -89,6 +93,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
                                        sign_key.remote_parties_[pos].pail_pub_.n(),
                                        sign_key.remote_parties_[pos].pail_pub_.n_sqr(),
                                        curv->n);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].alice_proof_.Verify(setup, statement);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the 'alice_proof_'!");
@@ -102,7 +107,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 
 bool Round1::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
     BN q2 = curv->n * curv->n;
@@ -115,16 +120,17 @@ bool Round1::ComputeVerify() {
         //      - Sample beta_tag in q^5
         //      - Sample r in (0, N)
         ctx->remote_parties_[i].beta_tag_for_mta_k_gamma_msg_b_ = safeheron::rand::RandomBNLt(q5);
-        ctx->remote_parties_[i].r_for_pail_for_mta_k_gamma_msg_b_ = safeheron::rand::RandomBNLtCoPrime(sign_key.remote_parties_[i].pail_pub_.n());
-
-        MtA_Step2(ctx->remote_parties_[i].message_b_for_k_gamma_,
-                ctx->remote_parties_[i].beta_for_k_gamma_,
-                sign_key.remote_parties_[i].pail_pub_,
-                ctx->local_party_.gamma_,
-                bc_message_arr_[i].message_a_,
-                ctx->remote_parties_[i].beta_tag_for_mta_k_gamma_msg_b_,
-                ctx->remote_parties_[i].r_for_pail_for_mta_k_gamma_msg_b_,
-                curv->n);
+        BN r_pow_N_for_mta_k_gamma_msg_b;
+        safeheron::mpc_flow::common::SampleEncRandomness(sign_key.remote_parties_[i].pail_pub_, ctx->remote_parties_[i].r_for_pail_for_mta_k_gamma_msg_b_, r_pow_N_for_mta_k_gamma_msg_b);
+
+        MtA_Step2WithRN(ctx->remote_parties_[i].message_b_for_k_gamma_,
+                        ctx->remote_parties_[i].beta_for_k_gamma_,
+                        sign_key.remote_parties_[i].pail_pub_,
+                        ctx->local_party_.gamma_,
+                        bc_message_arr_[i].message_a_,
+                        ctx->remote_parties_[i].beta_tag_for_mta_k_gamma_msg_b_,
+                        r_pow_N_for_mta_k_gamma_msg_b,
+                        curv->n);
 
         // - Mta(k, gamma) step 2: bob proof
         PailAffRangeSetUp setup_1(sign_key.remote_parties_[i].N_tilde_,
@@ -138,20 +144,22 @@ bool Round1::ComputeVerify() {
                                       ctx->remote_parties_[i].beta_tag_for_mta_k_gamma_msg_b_,
                                       ctx->remote_parties_[i].r_for_pail_for_mta_k_gamma_msg_b_);
         ctx->remote_parties_[i].bob_proof_1_.Prove(setup_1, statement_1, witness_1);
+        CountPrimitive(Primitive::ZKProve);
 
         // - Mta(k, w) step 2: construct message b
         //      - Sample beta_tag in q^5
         //      - Sample r in (0, N)
         ctx->remote_parties_[i].beta_tag_for_mta_k_w_msg_b_ = safeheron::rand::RandomBNLt(q5);
-        ctx->remote_parties_[i].r_for_pail_for_mta_k_w_msg_b_ = safeheron::rand::RandomBNLtCoPrime(sign_key.remote_parties_[i].pail_pub_.n());
-        MtA_Step2(ctx->remote_parties_[i].message_b_for_k_w_,
-                ctx->remote_parties_[i].beta_for_k_w_,
-                sign_key.remote_parties_[i].pail_pub_,
-                ctx->local_party_.w_,
-                bc_message_arr_[i].message_a_,
-                ctx->remote_parties_[i].beta_tag_for_mta_k_w_msg_b_,
-                ctx->remote_parties_[i].r_for_pail_for_mta_k_w_msg_b_,
-                curv->n);
+        BN r_pow_N_for_mta_k_w_msg_b;
+        safeheron::mpc_flow::common::SampleEncRandomness(sign_key.remote_parties_[i].pail_pub_, ctx->remote_parties_[i].r_for_pail_for_mta_k_w_msg_b_, r_pow_N_for_mta_k_w_msg_b);
+        MtA_Step2WithRN(ctx->remote_parties_[i].message_b_for_k_w_,
+                        ctx->remote_parties_[i].beta_for_k_w_,
+                        sign_key.remote_parties_[i].pail_pub_,
+                        ctx->local_party_.w_,
+                        bc_message_arr_[i].message_a_,
+                        ctx->remote_parties_[i].beta_tag_for_mta_k_w_msg_b_,
+                        r_pow_N_for_mta_k_w_msg_b,
+                        curv->n);
 
         // - Mta(k, w) step 2: bob proof
         PailAffGroupEleRangeSetUp_V1 setup_2(sign_key.remote_parties_[i].N_tilde_,
@@ -166,6 +174,7 @@ bool Round1::ComputeVerify() {
                                       ctx->remote_parties_[i].beta_tag_for_mta_k_w_msg_b_,
                                       ctx->remote_parties_[i].r_for_pail_for_mta_k_w_msg_b_);
         ctx->remote_parties_[i].bob_proof_2_.Prove(setup_2, statement_2, witness_2);
+        CountPrimitive(Primitive::ZKProve);
 
     }
 
@@ -174,7 +183,7 @@ bool Round1::ComputeVerify() {
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -13,13 +13,15 @@ namespace gg20{
 namespace sign{
 
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
     std::vector<Round0P2PMessage> p2p_message_arr_;
 
-    Round1() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
+    Round1() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
 
     void Init() override;
 
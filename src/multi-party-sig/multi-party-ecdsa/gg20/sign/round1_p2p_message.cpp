@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -27,15 +28,11 @@ bool Round1P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg20::
     message_b_for_k_w_.ToHexStr(str);
     message.set_message_b_for_k_w(str);
 
-    safeheron::proto::PailAffRangeProof t_bob_proof_1;
-    ok = bob_proof_1_.ToProtoObject(t_bob_proof_1);
+    ok = bob_proof_1_.ToProtoObject(*message.mutable_bob_proof_1());
     if (!ok) return false;
-    message.mutable_bob_proof_1()->CopyFrom(t_bob_proof_1);
 
-    safeheron::proto::PailAffGroupEleRangeProof_V1 t_bob_proof_2;
-    ok = bob_proof_2_.ToProtoObject(t_bob_proof_2);
+    ok = bob_proof_2_.ToProtoObject(*message.mutable_bob_proof_2());
     if (!ok) return false;
-    message.mutable_bob_proof_2()->CopyFrom(t_bob_proof_2);
 
     return true;
 }
@@ -62,7 +59,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg20::sign::Round1P2PMessage ProtoO
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -76,7 +74,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -86,7 +85,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -100,7 +100,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
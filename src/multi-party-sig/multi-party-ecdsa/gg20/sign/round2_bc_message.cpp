@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -24,19 +25,14 @@ bool Round2BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg20::s
     delta_.ToHexStr(str);
     message.set_delta(str);
 
-    safeheron::proto::CurvePoint point;
-    ok = T_.ToProtoObject(point);
+    ok = T_.ToProtoObject(*message.mutable_t());
     if (!ok) return false;
-    message.mutable_t()->CopyFrom(point);
 
-    ok = H_.ToProtoObject(point);
+    ok = H_.ToProtoObject(*message.mutable_h());
     if (!ok) return false;
-    message.mutable_h()->CopyFrom(point);
 
-    safeheron::proto::PedersenProof t_proof;
-    ok = pedersen_proof_.ToProtoObject(t_proof);
+    ok = pedersen_proof_.ToProtoObject(*message.mutable_pedersen_proof());
     if (!ok) return false;
-    message.mutable_pedersen_proof()->CopyFrom(t_proof);
 
     return true;
 }
@@ -65,7 +61,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg20::sign::Round2BCMessage ProtoOb
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -79,7 +76,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -89,7 +87,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -103,7 +102,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
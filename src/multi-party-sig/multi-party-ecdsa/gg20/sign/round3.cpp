@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/round4.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -13,6 +14,8 @@ using safeheron::multi_party_ecdsa::gg18::SignKey;
 using safeheron::zkp::pedersen_proof::PedersenStatement;
 using safeheron::zkp::pedersen_proof::PedersenWitness;
 using safeheron::zkp::pedersen_proof::PedersenProof;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -22,19 +25,19 @@ namespace gg20{
 namespace sign{
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -50,13 +53,14 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
 
     PedersenStatement pedersen_statement(curv->g, bc_message_arr_[pos].H_, bc_message_arr_[pos].T_);
+    CountPrimitive(Primitive::ZKVerify);
     bool ok = bc_message_arr_[pos].pedersen_proof_.Verify(pedersen_statement);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the 'pedersen_proof_'!");
@@ -73,7 +77,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 bool Round3::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -89,7 +93,7 @@ bool Round3::ComputeVerify() {
 
 bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
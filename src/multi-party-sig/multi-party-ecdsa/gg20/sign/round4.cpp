@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/round4.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -15,6 +16,8 @@ using safeheron::zkp::pail::PailEncGroupEleRangeSetUp;
 using safeheron::zkp::pail::PailEncGroupEleRangeStatement;
 using safeheron::zkp::pail::PailEncGroupEleRangeWitness;
 using safeheron::zkp::pail::PailEncGroupEleRangeProof;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -24,19 +27,19 @@ namespace gg20{
 namespace sign{
 
 void Round4::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -53,12 +56,12 @@ bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round4::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -79,7 +82,7 @@ bool Round4::ReceiveVerify(const std::string &party_id) {
 bool Round4::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -114,6 +117,7 @@ bool Round4::ComputeVerify() {
                                                 256, 512);
         PailEncGroupEleRangeWitness witness(ctx->local_party_.k_, ctx->local_party_.r_for_pail_for_mta_msg_a_);
         ctx->remote_parties_[i].pail_enc_group_ele_range_proof_.Prove(setup, statement, witness);
+        CountPrimitive(Primitive::ZKProve);
     }
 
     return true;
@@ -121,7 +125,7 @@ bool Round4::ComputeVerify() {
 
 bool Round4::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -13,12 +13,14 @@ namespace gg20{
 namespace sign{
 
 
-class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::TypedMPCRound<Context> {
 public:
     std::vector<Round3BCMessage> bc_message_arr_;
 
-    Round4() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
-                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST) {}
+    Round4() : TypedMPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                             safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST) {}
 
     void Init() override;
 
@@ -3,6 +3,7 @@
 #include "crypto-suites/crypto-bn/rand.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/round5.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -18,6 +19,8 @@ using safeheron::zkp::pail::PailEncGroupEleRangeProof;
 using safeheron::zkp::heg::HEGStatement_V3;
 using safeheron::zkp::heg::HEGProof_V3;
 using safeheron::zkp::heg::HEGWitness_V3;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -27,7 +30,7 @@ namespace gg20{
 namespace sign{
 
 void Round5::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -35,12 +38,12 @@ void Round5::Init() {
 }
 
 bool Round5::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -63,12 +66,12 @@ bool Round5::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round5::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -84,6 +87,7 @@ bool Round5::ReceiveVerify(const std::string &party_id) {
                                             bc_message_arr_[pos].R_,
                                             ctx->R_,
                                             256, 512);
+    CountPrimitive(Primitive::ZKVerify);
     ok = p2p_message_arr_[pos].pail_enc_group_ele_range_proof_.Verify(setup, statement);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the 'pail_enc_group_ele_range_proof_'!");
@@ -98,7 +102,7 @@ bool Round5::ReceiveVerify(const std::string &party_id) {
 bool Round5::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -118,13 +122,14 @@ bool Round5::ComputeVerify() {
     HEGStatement_V3 statement(ctx->local_party_.T_, curv->g, ctx->local_party_.H_, ctx->local_party_.S_, ctx->R_, curv->n);
     HEGWitness_V3 witness(ctx->local_party_.sigma_, ctx->local_party_.l_);
     ctx->local_party_.heg_proof_.Prove(statement, witness);
+    CountPrimitive(Primitive::ZKProve);
 
     return true;
 }
 
 bool Round5::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,6 +1,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/message.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -20,15 +21,11 @@ namespace sign{
 bool Round5BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::gg20::sign::Round5BCMessage &message) const {
     bool ok = true;
 
-    safeheron::proto::CurvePoint point;
-    ok = S_.ToProtoObject(point);
+    ok = S_.ToProtoObject(*message.mutable_s());
     if (!ok) return false;
-    message.mutable_s()->CopyFrom(point);
 
-    safeheron::proto::HEGProof_V3 t_proof;
-    ok = heg_proof_.ToProtoObject(t_proof);
+    ok = heg_proof_.ToProtoObject(*message.mutable_heg_proof());
     if (!ok) return false;
-    message.mutable_heg_proof()->CopyFrom(t_proof);
 
     return true;
 }
@@ -52,7 +49,8 @@ typedef safeheron::proto::multi_party_ecdsa::gg20::sign::Round5BCMessage ProtoOb
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -66,7 +64,8 @@ bool TheClass::FromBase64(const string &b64) {
 
     string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -76,7 +75,8 @@ bool TheClass::FromBase64(const string &b64) {
 bool TheClass::ToJsonString(string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -90,7 +90,8 @@ bool TheClass::ToJsonString(string &json_str) const {
 
 
 bool TheClass::FromJsonString(const string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     google::protobuf::util::JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/round6.h"
 #include "multi-party-sig/multi-party-ecdsa/gg20/sign/context.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
 
 using std::string;
 using std::vector;
@@ -14,6 +15,8 @@ using safeheron::multi_party_ecdsa::gg18::SignKey;
 using safeheron::zkp::heg::HEGStatement_V3;
 using safeheron::zkp::heg::HEGProof_V3;
 using safeheron::zkp::heg::HEGWitness_V3;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::Primitive;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -23,19 +26,19 @@ namespace gg20{
 namespace sign{
 
 void Round6::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
@@ -51,18 +54,19 @@ bool Round6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round6::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    int pos = sign_key.get_remote_party_pos(party_id);
+    int pos = ctx->get_remote_party_pos(party_id);
     if (pos == -1) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
     }
 
     HEGStatement_V3 statement(ctx->remote_parties_[pos].T_, curv->g, ctx->remote_parties_[pos].H_, bc_message_arr_[pos].S_, ctx->R_, curv->n);
+    CountPrimitive(Primitive::ZKVerify);
     bool ok = bc_message_arr_[pos].heg_proof_.Verify(statement);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify heg proof!");
@@ -78,7 +82,7 @@ bool Round6::ComputeVerify() {
 
 bool Round6::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -1,6 +1,7 @@
 #include "P1KeyShare.h"
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 #include <google/protobuf/port_def.inc>
 #include <google/protobuf/port_undef.inc>
 using google::protobuf::util::Status;
@@ -19,20 +20,14 @@ bool P1KeyShare::ToProtoObject(safeheron::proto::two_party_ecdsa::lindell17::P1K
     x1_.ToHexStr(str);
     p1_key_share.set_x1(str);
 
-    safeheron::proto::CurvePoint Q;
-    ok = Q_.ToProtoObject(Q);
+    ok = Q_.ToProtoObject(*p1_key_share.mutable_q());
     if (!ok) return false;
-    p1_key_share.mutable_q()->CopyFrom(Q);
 
-    safeheron::proto::PailPriv pail_priv;
-    ok = pail_priv_.ToProtoObject(pail_priv);
+    ok = pail_priv_.ToProtoObject(*p1_key_share.mutable_pail_priv());
     if (!ok) return false;
-    p1_key_share.mutable_pail_priv()->CopyFrom(pail_priv);
 
-    safeheron::proto::PailPub pail_pub;
-    ok = pail_pub_.ToProtoObject(pail_pub);
+    ok = pail_pub_.ToProtoObject(*p1_key_share.mutable_pail_pub());
     if (!ok) return false;
-    p1_key_share.mutable_pail_pub()->CopyFrom(pail_pub);
 
     return true;
 }
@@ -60,7 +55,8 @@ typedef safeheron::proto::two_party_ecdsa::lindell17::P1KeyShare ProtoObject;
 bool TheClass::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -74,7 +70,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -84,7 +81,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 bool TheClass::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -97,7 +95,8 @@ bool TheClass::ToJsonString(std::string &json_str) const {
 }
 
 bool TheClass::FromJsonString(const std::string &json_str) {
-    ProtoObject  proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -0,0 +1,131 @@
+#include "P1BatchContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+#include "crypto-suites/crypto-bn/rand.h"
+
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace key_gen {
+
+bool P1BatchContext::CreateContext(const safeheron::curve::CurveType &c_type,
+                                   const std::vector<safeheron::bignum::BN> &x1_arr,
+                                   const safeheron::pail::PailPrivKey &pail_priv,
+                                   const safeheron::pail::PailPubKey &pail_pub,
+                                   size_t max_threads) {
+    if (x1_arr.empty()) return false;
+    c_type_ = c_type;
+    max_threads_ = max_threads;
+
+    // One proof of the Paillier key for the whole batch, computed in the background until Step2.
+    std::shared_future<safeheron::zkp::pail::PailNProof> pail_n_proof = std::async(std::launch::async, [pail_priv] {
+        safeheron::zkp::pail::PailNProof proof;
+        proof.Prove(pail_priv);
+        return proof;
+    }).share();
+
+    ctx_arr_.clear();
+    ctx_arr_.resize(x1_arr.size());
+    for (size_t i = 0; i < x1_arr.size(); ++i) {
+        if (!ctx_arr_[i].CreateContext(c_type, x1_arr[i], pail_priv, pail_pub, pail_n_proof)) return false;
+    }
+
+    return true;
+}
+
+bool P1BatchContext::CreateContext(const safeheron::curve::CurveType &c_type,
+                                   size_t batch_size,
+                                   const safeheron::pail::PailPrivKey &pail_priv,
+                                   const safeheron::pail::PailPubKey &pail_pub,
+                                   size_t max_threads) {
+    if (!check_ecdsa_curve(c_type)) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    if (curv == nullptr) return false;
+
+    std::vector<safeheron::bignum::BN> x1_arr;
+    for (size_t i = 0; i < batch_size; ++i) {
+        x1_arr.push_back(safeheron::rand::RandomBNLt(curv->n));
+    }
+
+    return CreateContext(c_type, x1_arr, pail_priv, pail_pub, max_threads);
+}
+
+bool P1BatchContext::Step1(std::string &out_msg) {
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step1(out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P1BatchContext::Step2(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step2(in_msg_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P1BatchContext::Step3(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step3(in_msg_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P1BatchContext::Step4(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step4(in_msg_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P1BatchContext::export_key_shares(std::vector<std::string> &p1_key_share_base64_arr) const {
+    p1_key_share_base64_arr.clear();
+    p1_key_share_base64_arr.resize(ctx_arr_.size());
+    for (size_t i = 0; i < ctx_arr_.size(); ++i) {
+        if (!ctx_arr_[i].export_key_share(p1_key_share_base64_arr[i])) return false;
+    }
+
+    return true;
+}
+
+}
+}
+}
+}
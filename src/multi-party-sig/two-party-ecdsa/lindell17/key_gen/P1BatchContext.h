@@ -0,0 +1,66 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_KEY_GEN_P1BATCHCONTEXT_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_KEY_GEN_P1BATCHCONTEXT_H
+#include <vector>
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P1Context.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace key_gen {
+
+/**
+ * Generate a batch of key shares of P1 under one Paillier key in one run.
+ *
+ * The Paillier key and its proof are shared by all the key generations of the batch, and the DLog / PDL proofs of
+ * the batch are computed in parallel. In each step the messages of the batch are packed into one message.
+ */
+class P1BatchContext {
+public:
+    P1BatchContext() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), max_threads_(0) {}
+
+    /**
+     * @param c_type
+     * @param x1_arr secret shares of P1, one for each key
+     * @param pail_priv Paillier key shared by the batch, which must not be used by another party.
+     * @param pail_pub
+     * @param max_threads maximum number of threads, 0 means std::thread::hardware_concurrency().
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                       const std::vector<safeheron::bignum::BN> &x1_arr,
+                       const safeheron::pail::PailPrivKey &pail_priv,
+                       const safeheron::pail::PailPubKey &pail_pub,
+                       size_t max_threads = 0);
+
+    // Generate batch_size random secret shares.
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                       size_t batch_size,
+                       const safeheron::pail::PailPrivKey &pail_priv,
+                       const safeheron::pail::PailPubKey &pail_pub,
+                       size_t max_threads = 0);
+
+public:
+    bool Step1(std::string &out_msg);
+
+    bool Step2(const std::string &in_msg, std::string &out_msg);
+
+    bool Step3(const std::string &in_msg, std::string &out_msg);
+
+    bool Step4(const std::string &in_msg, std::string &out_msg);
+
+    size_t size() const { return ctx_arr_.size(); }
+
+    bool export_key_shares(std::vector<std::string> &p1_key_share_base64_arr) const;
+
+private:
+    safeheron::curve::CurveType c_type_;
+    size_t max_threads_;
+    std::vector<P1Context> ctx_arr_;
+};
+
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_KEY_GEN_P1BATCHCONTEXT_H
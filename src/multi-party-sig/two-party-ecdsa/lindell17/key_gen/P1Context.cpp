@@ -33,9 +33,55 @@ bool P1Context::CreateContext(const safeheron::curve::CurveType &c_type, const s
 
     if (!(x1 >= 0 && x1 < q)) return false;
 
-    key_share_.x1_ = x1;
+    safeheron::pail::PailPrivKey pail_priv;
+    safeheron::pail::PailPubKey pail_pub;
+    safeheron::pail::CreateKeyPair2048(pail_priv, pail_pub);
+
+    return CreateContext(c_type, x1, pail_priv, pail_pub);
+}
+
+bool P1Context::CreateContext(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1,
+                              const safeheron::pail::PailPrivKey &pail_priv, const safeheron::pail::PailPubKey &pail_pub) {
+    if (!CheckContextParam(c_type, x1, pail_priv, pail_pub)) return false;
+
+    pail_n_proof_ = std::async(std::launch::async, [pail_priv] {
+        safeheron::zkp::pail::PailNProof pail_n_proof;
+        pail_n_proof.Prove(pail_priv);
+        return pail_n_proof;
+    }).share();
+
+    return true;
+}
+
+bool P1Context::CreateContext(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1,
+                              const safeheron::pail::PailPrivKey &pail_priv, const safeheron::pail::PailPubKey &pail_pub,
+                              const std::shared_future<safeheron::zkp::pail::PailNProof> &pail_n_proof) {
+    if (!CheckContextParam(c_type, x1, pail_priv, pail_pub)) return false;
+    if (!pail_n_proof.valid()) return false;
+
+    pail_n_proof_ = pail_n_proof;
+
+    return true;
+}
 
-    safeheron::pail::CreateKeyPair2048(key_share_.pail_priv_, key_share_.pail_pub_);
+bool P1Context::CheckContextParam(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1,
+                                  const safeheron::pail::PailPrivKey &pail_priv, const safeheron::pail::PailPubKey &pail_pub) {
+    if (!check_ecdsa_curve(c_type)) return false;
+    c_type_ = c_type;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    if (!(x1 >= 0 && x1 < q)) return false;
+
+    // The sign protocol requires N > 2^2046, and the key pair must match.
+    if (pail_pub.n().BitLength() <= 2046 || pail_priv.p() * pail_priv.q() != pail_pub.n()) return false;
+
+    key_share_.x1_ = x1;
+    key_share_.pail_priv_ = pail_priv;
+    key_share_.pail_pub_ = pail_pub;
 
     return true;
 }
@@ -75,8 +121,7 @@ bool P1Context::Step2(const std::string &in_msg, std::string &out_msg) {
     r_ = safeheron::rand::RandomBNLtCoPrime(key_share_.pail_pub_.n());
     c_ = key_share_.pail_pub_.EncryptWithR(key_share_.x1_, r_);
 
-    safeheron::zkp::pail::PailNProof pail_n_proof;
-    pail_n_proof.Prove(key_share_.pail_priv_);
+    if (!pail_n_proof_.valid()) return false;
 
     P1Message2 p1_msg2;
     p1_msg2.Q1_ = Q1;
@@ -84,7 +129,7 @@ bool P1Context::Step2(const std::string &in_msg, std::string &out_msg) {
     p1_msg2.blind_factor_ = blind_factor_;
     p1_msg2.c_ = c_;
     p1_msg2.pail_pub_ = key_share_.pail_pub_;
-    p1_msg2.pail_n_proof_ = pail_n_proof;
+    p1_msg2.pail_n_proof_ = pail_n_proof_.get();
 
     if (!p1_msg2.ToBase64(out_msg)) return false;
 
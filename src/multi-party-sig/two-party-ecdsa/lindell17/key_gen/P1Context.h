@@ -3,6 +3,8 @@
 #include "multi-party-sig/two-party-ecdsa//lindell17/P1KeyShare.h"
 #include "crypto-suites/crypto-zkp/dlog_proof_v2.h"
 #include "crypto-suites/crypto-zkp/pdl/pdl_proof.h"
+#include "crypto-suites/crypto-zkp/pail/pail_n_proof.h"
+#include <future>
 
 namespace safeheron {
 namespace two_party_ecdsa {
@@ -17,6 +19,21 @@ public:
 
     bool CreateContext(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1);
 
+    /**
+     * Create a context with a Paillier key generated ahead of time, e.g. taken from a PailKeyPool.
+     * The key must not be used by another party.
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1,
+                       const safeheron::pail::PailPrivKey &pail_priv, const safeheron::pail::PailPubKey &pail_pub);
+
+    /**
+     * Same as above, with the proof of the Paillier key computed by the caller. Key generations sharing a Paillier
+     * key can share the proof too, see P1BatchContext.
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1,
+                       const safeheron::pail::PailPrivKey &pail_priv, const safeheron::pail::PailPubKey &pail_pub,
+                       const std::shared_future<safeheron::zkp::pail::PailNProof> &pail_n_proof);
+
 public:
     bool Step1(std::string &out_msg);
 
@@ -28,6 +45,10 @@ public:
 
     bool export_key_share(std::string &p1_key_share_base64) const;
 
+private:
+    bool CheckContextParam(const safeheron::curve::CurveType &c_type, const safeheron::bignum::BN &x1,
+                           const safeheron::pail::PailPrivKey &pail_priv, const safeheron::pail::PailPubKey &pail_pub);
+
 private:
     safeheron::zkp::dlog::DLogProof_V2 d_log_proof_Q1_;
     std::string blind_factor_;
@@ -39,6 +60,9 @@ private:
 
     safeheron::bignum::BN r_;
     safeheron::bignum::BN c_;
+
+    // Proof of the Paillier key, computed in the background from CreateContext on. It doesn't depend on P2.
+    std::shared_future<safeheron::zkp::pail::PailNProof> pail_n_proof_;
 };
 
 }
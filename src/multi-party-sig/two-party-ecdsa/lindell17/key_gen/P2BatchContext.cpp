@@ -0,0 +1,129 @@
+#include "P2BatchContext.h"
+#include "message.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+#include "crypto-suites/crypto-bn/rand.h"
+
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace key_gen {
+
+bool P2BatchContext::CreateContext(const safeheron::curve::CurveType &c_type,
+                                   const std::vector<safeheron::bignum::BN> &x2_arr,
+                                   size_t max_threads) {
+    if (x2_arr.empty()) return false;
+    c_type_ = c_type;
+    max_threads_ = max_threads;
+
+    ctx_arr_.clear();
+    ctx_arr_.resize(x2_arr.size());
+    for (size_t i = 0; i < x2_arr.size(); ++i) {
+        if (!ctx_arr_[i].CreateContext(c_type, x2_arr[i])) return false;
+    }
+
+    return true;
+}
+
+bool P2BatchContext::CreateContext(const safeheron::curve::CurveType &c_type,
+                                   size_t batch_size,
+                                   size_t max_threads) {
+    if (!check_ecdsa_curve(c_type)) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    if (curv == nullptr) return false;
+
+    std::vector<safeheron::bignum::BN> x2_arr;
+    for (size_t i = 0; i < batch_size; ++i) {
+        x2_arr.push_back(safeheron::rand::RandomBNLt(curv->n));
+    }
+
+    return CreateContext(c_type, x2_arr, max_threads);
+}
+
+bool P2BatchContext::Step1(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step1(in_msg_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P2BatchContext::Step2(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    // Verify the proof of the Paillier key of the first message once. The contexts skip it for the same key, and
+    // still verify the proof of any other key.
+    P1Message2 p1_msg2;
+    if (!p1_msg2.FromBase64(in_msg_arr[0])) return false;
+    if (!p1_msg2.pail_n_proof_.Verify(p1_msg2.pail_pub_)) return false;
+    for (auto &ctx: ctx_arr_) {
+        ctx.set_verified_pail_pub(p1_msg2.pail_pub_);
+    }
+
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step2(in_msg_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P2BatchContext::Step3(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(ctx_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step3(in_msg_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P2BatchContext::Step4(const std::string &in_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != ctx_arr_.size()) return false;
+
+    size_t first_failed = 0;
+    return ParallelForAll(ctx_arr_.size(), [&](size_t i) {
+        return ctx_arr_[i].Step4(in_msg_arr[i]);
+    }, first_failed, max_threads_);
+}
+
+bool P2BatchContext::export_key_shares(std::vector<std::string> &p2_key_share_base64_arr) const {
+    p2_key_share_base64_arr.clear();
+    p2_key_share_base64_arr.resize(ctx_arr_.size());
+    for (size_t i = 0; i < ctx_arr_.size(); ++i) {
+        if (!ctx_arr_[i].export_key_share(p2_key_share_base64_arr[i])) return false;
+    }
+
+    return true;
+}
+
+}
+}
+}
+}
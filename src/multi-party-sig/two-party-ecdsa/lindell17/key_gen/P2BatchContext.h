@@ -0,0 +1,54 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_KEY_GEN_P2BATCHCONTEXT_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_KEY_GEN_P2BATCHCONTEXT_H
+#include <vector>
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P2Context.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace key_gen {
+
+/**
+ * Batch key generation of P2, the counterpart of P1BatchContext.
+ *
+ * The proof of a Paillier key shared by the batch is verified once.
+ */
+class P2BatchContext {
+public:
+    P2BatchContext() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), max_threads_(0) {}
+
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                       const std::vector<safeheron::bignum::BN> &x2_arr,
+                       size_t max_threads = 0);
+
+    // Generate batch_size random secret shares.
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                       size_t batch_size,
+                       size_t max_threads = 0);
+
+public:
+    bool Step1(const std::string &in_msg, std::string &out_msg);
+
+    bool Step2(const std::string &in_msg, std::string &out_msg);
+
+    bool Step3(const std::string &in_msg, std::string &out_msg);
+
+    bool Step4(const std::string &in_msg);
+
+    size_t size() const { return ctx_arr_.size(); }
+
+    bool export_key_shares(std::vector<std::string> &p2_key_share_base64_arr) const;
+
+private:
+    safeheron::curve::CurveType c_type_;
+    size_t max_threads_;
+    std::vector<P2Context> ctx_arr_;
+};
+
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_KEY_GEN_P2BATCHCONTEXT_H
@@ -3,6 +3,7 @@
 #include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
 #include "crypto-suites/crypto-commitment/com256.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include <future>
 
 namespace safeheron{
 namespace two_party_ecdsa {
@@ -66,6 +67,17 @@ bool P2Context::Step2(const std::string &in_msg, std::string &out_msg) {
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
     if (curv == nullptr) return false;
 
+    // Verify the proof of the Paillier key in the background, it is the most expensive check of the step.
+    bool pail_pub_verified = flag_verified_pail_pub_
+                             && verified_pail_pub_.n() == p1_msg2.pail_pub_.n()
+                             && verified_pail_pub_.g() == p1_msg2.pail_pub_.g();
+    std::future<bool> pail_n_proof_ok;
+    if (!pail_pub_verified) {
+        pail_n_proof_ok = std::async(std::launch::async, [&p1_msg2] {
+            return p1_msg2.pail_n_proof_.Verify(p1_msg2.pail_pub_);
+        });
+    }
+
     // decommits( Q1 ,d_log_proof_.A_; blind_factor )
     safeheron::commitment::HashCommit256 sha256_com;
     sha256_com.UpdateCurvePoint(p1_msg2.Q1_);
@@ -75,9 +87,6 @@ bool P2Context::Step2(const std::string &in_msg, std::string &out_msg) {
     // verify DLOG proof of Q1
     if (!p1_msg2.d_log_proof_Q1_.Verify(p1_msg2.Q1_)) return false;
 
-    //verify pail N proof
-    if (!p1_msg2.pail_n_proof_.Verify(p1_msg2.pail_pub_)) return false;
-
     key_share_.Q_ = curv->g * key_share_.x2_ + p1_msg2.Q1_;
 
     if (!(p1_msg2.c_ > 0 && p1_msg2.c_ < p1_msg2.pail_pub_.n_sqr() && p1_msg2.c_.Gcd(p1_msg2.pail_pub_.n_sqr()) == 1)) return false;
@@ -91,6 +100,9 @@ bool P2Context::Step2(const std::string &in_msg, std::string &out_msg) {
     safeheron::zkp::pdl::PDLVMessage1 pdl_v_message1;
     if (!pdl_verifier_.Step1(pdl_v_message1)) return false;
 
+    //verify pail N proof
+    if (!pail_pub_verified && !pail_n_proof_ok.get()) return false;
+
     P2Message2 p2_msg2;
     p2_msg2.pdl_v_message1_ = pdl_v_message1;
     if (!p2_msg2.ToBase64(out_msg)) return false;
@@ -123,6 +135,11 @@ bool P2Context::Step4(const std::string &in_msg) {
     return true;
 }
 
+void P2Context::set_verified_pail_pub(const safeheron::pail::PailPubKey &pail_pub) {
+    flag_verified_pail_pub_ = true;
+    verified_pail_pub_ = pail_pub;
+}
+
 bool P2Context::export_key_share(std::string &p2_key_share_base64) const {
     if (!key_share_.ToBase64(p2_key_share_base64)) return false;
 
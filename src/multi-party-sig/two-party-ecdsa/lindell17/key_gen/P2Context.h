@@ -10,7 +10,7 @@ namespace lindell17 {
 namespace key_gen {
 class P2Context {
 public:
-    P2Context() : c_type_(safeheron::curve::CurveType::INVALID_CURVE) {}
+    P2Context() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), flag_verified_pail_pub_(false) {}
 
     bool CreateContext(const safeheron::curve::CurveType &c_type);
 
@@ -27,12 +27,21 @@ public:
 
     bool export_key_share(std::string &p2_key_share_base64) const;
 
+    /**
+     * Skip the verification of the proof of the Paillier key in Step2 if P1 sends this key, whose proof has been
+     * verified by the caller. Used by P2BatchContext, where all key generations share one Paillier key.
+     */
+    void set_verified_pail_pub(const safeheron::pail::PailPubKey &pail_pub);
+
 private:
     std::string commitment_;
     safeheron::zkp::pdl::PDLVerifier_V2 pdl_verifier_;
 
     safeheron::curve::CurveType c_type_;
     P2KeyShare key_share_;
+
+    bool flag_verified_pail_pub_;
+    safeheron::pail::PailPubKey verified_pail_pub_;
 };
 
 }
@@ -2,6 +2,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/hex.h"
 #include "crypto-suites/crypto-encode/base64.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 #include <google/protobuf/port_def.inc>
 #include <google/protobuf/port_undef.inc>
 using google::protobuf::util::Status;
@@ -18,15 +19,11 @@ namespace key_gen {
 bool P1Message2::ToProtoObject(safeheron::proto::two_party_ecdsa::lindell17::key_gen::P1Message2 &p1_msg2) const {
     bool ok = true;
 
-    safeheron::proto::CurvePoint point_obj;
-    ok = Q1_.ToProtoObject(point_obj);
+    ok = Q1_.ToProtoObject(*p1_msg2.mutable_q1());
     if (!ok) return false;
-    p1_msg2.mutable_q1()->CopyFrom(point_obj);
 
-    safeheron::proto::DLogProof_V2 d_log_proof_obj;
-    ok = d_log_proof_Q1_.ToProtoObject(d_log_proof_obj);
+    ok = d_log_proof_Q1_.ToProtoObject(*p1_msg2.mutable_d_log_proof_q1());
     if (!ok) return false;
-    p1_msg2.mutable_d_log_proof_q1()->CopyFrom(d_log_proof_obj);
 
     p1_msg2.set_blind_factor(safeheron::encode::hex::EncodeToHex(blind_factor_));
 
@@ -34,15 +31,11 @@ bool P1Message2::ToProtoObject(safeheron::proto::two_party_ecdsa::lindell17::key
     c_.ToHexStr(str);
     p1_msg2.set_c(str);
 
-    safeheron::proto::PailPub pail_pub_obj;
-    ok = pail_pub_.ToProtoObject(pail_pub_obj);
+    ok = pail_pub_.ToProtoObject(*p1_msg2.mutable_pail_pub());
     if (!ok) return false;
-    p1_msg2.mutable_pail_pub()->CopyFrom(pail_pub_obj);
 
-    safeheron::proto::PailNProof pail_n_proof_obj;
-    ok = pail_n_proof_.ToProtoObject(pail_n_proof_obj);
+    ok = pail_n_proof_.ToProtoObject(*p1_msg2.mutable_pail_n_proof());
     if (!ok) return false;
-    p1_msg2.mutable_pail_n_proof()->CopyFrom(pail_n_proof_obj);
 
     return true;
 }
@@ -75,7 +68,8 @@ typedef safeheron::proto::two_party_ecdsa::lindell17::key_gen::P1Message2 ProtoO
 bool TheClass::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -89,7 +83,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -99,7 +94,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 bool TheClass::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -112,7 +108,8 @@ bool TheClass::ToJsonString(std::string &json_str) const {
 }
 
 bool TheClass::FromJsonString(const std::string &json_str) {
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -1,6 +1,7 @@
 #include "message.h"
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 #include <google/protobuf/port_def.inc>
 #include <google/protobuf/port_undef.inc>
 using google::protobuf::util::Status;
@@ -16,15 +17,11 @@ namespace key_gen {
 bool P2Message1::ToProtoObject(safeheron::proto::two_party_ecdsa::lindell17::key_gen::P2Message1 &p2_msg1) const {
     bool ok = true;
 
-    safeheron::proto::CurvePoint point_obj;
-    ok = Q2_.ToProtoObject(point_obj);
+    ok = Q2_.ToProtoObject(*p2_msg1.mutable_q2());
     if (!ok) return false;
-    p2_msg1.mutable_q2()->CopyFrom(point_obj);
 
-    safeheron::proto::DLogProof_V2 d_log_proof_obj;
-    ok = d_log_proof_Q2_.ToProtoObject(d_log_proof_obj);
+    ok = d_log_proof_Q2_.ToProtoObject(*p2_msg1.mutable_d_log_proof_q2());
     if (!ok) return false;
-    p2_msg1.mutable_d_log_proof_q2()->CopyFrom(d_log_proof_obj);
 
     return true;
 }
@@ -45,7 +42,8 @@ typedef safeheron::proto::two_party_ecdsa::lindell17::key_gen::P2Message1 ProtoO
 bool TheClass::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -59,7 +57,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -69,7 +68,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 bool TheClass::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -82,7 +82,8 @@ bool TheClass::ToJsonString(std::string &json_str) const {
 }
 
 bool TheClass::FromJsonString(const std::string &json_str) {
-    ProtoObject  proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
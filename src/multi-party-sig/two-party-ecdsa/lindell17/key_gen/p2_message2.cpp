@@ -2,6 +2,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/hex.h"
 #include "crypto-suites/crypto-encode/base64.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 #include <google/protobuf/port_def.inc>
 #include <google/protobuf/port_undef.inc>
 using google::protobuf::util::Status;
@@ -15,9 +16,7 @@ namespace two_party_ecdsa {
 namespace lindell17 {
 namespace key_gen {
 bool P2Message2::ToProtoObject(safeheron::proto::two_party_ecdsa::lindell17::key_gen::P2Message2 &p2_msg2) const {
-    safeheron::proto::PDLVMessage1 pdl_v_msg1_obj;
-    if (!pdl_v_message1_.ToProtoObject(pdl_v_msg1_obj)) return false;
-    p2_msg2.mutable_pdl_v_message1()->CopyFrom(pdl_v_msg1_obj);
+    if (!pdl_v_message1_.ToProtoObject(*p2_msg2.mutable_pdl_v_message1())) return false;
     return true;
 }
 
@@ -32,7 +31,8 @@ typedef safeheron::proto::two_party_ecdsa::lindell17::key_gen::P2Message2 ProtoO
 bool TheClass::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -46,7 +46,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -56,7 +57,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 bool TheClass::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -69,7 +71,8 @@ bool TheClass::ToJsonString(std::string &json_str) const {
 }
 
 bool TheClass::FromJsonString(const std::string &json_str) {
-    ProtoObject  proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
@@ -0,0 +1,86 @@
+#include "P1BatchContext.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+bool P1BatchContext::CreateContext(const safeheron::curve::CurveType &c_type, const std::string &p1_key_share_base64,
+                                   const std::vector<safeheron::bignum::BN> &m_arr, size_t max_threads) {
+    std::shared_ptr<P1Signer> signer = std::make_shared<P1Signer>();
+    if (!signer->CreateSigner(c_type, p1_key_share_base64)) return false;
+
+    return CreateContext(signer, m_arr, max_threads);
+}
+
+bool P1BatchContext::CreateContext(const std::shared_ptr<const P1Signer> &signer,
+                                   const std::vector<safeheron::bignum::BN> &m_arr, size_t max_threads) {
+    if (!signer || !signer->IsInitialized()) return false;
+    if (m_arr.empty()) return false;
+
+    signer_ = signer;
+    c_type_ = signer->curve_type();
+    m_arr_ = m_arr;
+    max_threads_ = max_threads;
+    sign_context_arr_.clear();
+
+    return presign_context_.CreateContext(c_type_, m_arr_.size(), max_threads_);
+}
+
+bool P1BatchContext::Step0(std::string &out_msg) {
+    return presign_context_.Step0(out_msg);
+}
+
+bool P1BatchContext::Step1(const std::string &in_msg, std::string &out_msg) {
+    return presign_context_.Step1(in_msg, out_msg);
+}
+
+bool P1BatchContext::Step2(const std::string &in_msg, std::string &out_msg) {
+    std::string presign_msg;
+    if (!presign_context_.Step2(in_msg, presign_msg)) return false;
+
+    std::vector<P1Nonce> nonce_arr;
+    if (!presign_context_.export_nonces(nonce_arr)) return false;
+
+    sign_context_arr_.clear();
+    sign_context_arr_.resize(m_arr_.size());
+    std::vector<std::string> request_arr(m_arr_.size());
+    for (size_t i = 0; i < m_arr_.size(); ++i) {
+        if (!sign_context_arr_[i].CreateContext(signer_, m_arr_[i], nonce_arr[i])) return false;
+        if (!sign_context_arr_[i].OnlineStep0(request_arr[i])) return false;
+    }
+
+    // [presign message, online requests]
+    std::string request_batch_msg;
+    BatchMPCContext::EncodeMessages(request_arr, request_batch_msg);
+    BatchMPCContext::EncodeMessages({presign_msg, request_batch_msg}, out_msg);
+
+    return true;
+}
+
+bool P1BatchContext::Step3(const std::string &in_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != sign_context_arr_.size()) return false;
+
+    // Decryptions are independent, run them in parallel.
+    size_t first_failed = 0;
+    return ParallelForAll(sign_context_arr_.size(), [&](size_t i) {
+        return sign_context_arr_[i].Step3(in_msg_arr[i]);
+    }, first_failed, max_threads_);
+}
+
+bool P1BatchContext::export_sig(size_t index, uint8_t *sig64, uint32_t &v) const {
+    if (index >= sign_context_arr_.size()) return false;
+    return sign_context_arr_[index].export_sig(sig64, v);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,63 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1BATCHCONTEXT_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1BATCHCONTEXT_H
+#include <memory>
+#include <vector>
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1Context.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1PresignContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1Signer.h"
+
+namespace safeheron{
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Sign a batch of messages with the same key in one session.
+ *
+ * Step0 to Step2 negotiate a nonce for every message as P1PresignContext does, and the last message of P1 carries
+ * the online requests (see P1Context::OnlineStep0) of the batch as well. P2 replies with a vector of c3, which are
+ * decrypted in parallel in Step3. The number of messages is the same as in P1Context, whatever the size of the batch.
+ */
+class P1BatchContext {
+public:
+    P1BatchContext() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), max_threads_(0) {}
+
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                        const std::string &p1_key_share_base64,
+                        const std::vector<safeheron::bignum::BN> &m_arr,
+                        size_t max_threads = 0);
+
+    bool CreateContext(const std::shared_ptr<const P1Signer> &signer,
+                        const std::vector<safeheron::bignum::BN> &m_arr,
+                        size_t max_threads = 0);
+
+public:
+    bool Step0(std::string &out_msg);
+
+    bool Step1(const std::string &in_msg, std::string &out_msg);
+
+    bool Step2(const std::string &in_msg, std::string &out_msg);
+
+    bool Step3(const std::string &in_msg);
+
+    size_t size() const { return m_arr_.size(); }
+
+    // Signature of m_arr[index]
+    bool export_sig(size_t index, uint8_t *sig64, uint32_t &v) const;
+
+private:
+    safeheron::curve::CurveType c_type_;
+    std::shared_ptr<const P1Signer> signer_;
+    std::vector<safeheron::bignum::BN> m_arr_;
+    size_t max_threads_;
+
+    P1PresignContext presign_context_;
+    std::vector<P1Context> sign_context_arr_;
+};
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1BATCHCONTEXT_H
@@ -10,23 +10,52 @@ namespace lindell17 {
 namespace sign {
 
 bool P1Context::CreateContext(const safeheron::curve::CurveType &c_type, const std::string &p1_key_share_base64, const safeheron::bignum::BN &m) {
-    P1KeyShare p1_key_share;
-    if (!p1_key_share.FromBase64(p1_key_share_base64)) return false;
+    std::shared_ptr<P1Signer> signer = std::make_shared<P1Signer>();
+    if (!signer->CreateSigner(c_type, p1_key_share_base64)) return false;
 
-    if (!check_ecdsa_curve(c_type)) return false;
-    c_type_ = c_type;
+    return CreateContext(signer, m);
+}
+
+bool P1Context::CreateContext(const safeheron::curve::CurveType &c_type, const std::string &p1_key_share_base64,
+                              const safeheron::bignum::BN &m, const P1Nonce &nonce) {
+    if (!CreateContext(c_type, p1_key_share_base64, m)) return false;
+
+    return SetNonce(nonce);
+}
+
+bool P1Context::CreateContext(const std::shared_ptr<const P1Signer> &signer, const safeheron::bignum::BN &m) {
+    if (!signer || !signer->IsInitialized()) return false;
+    signer_ = signer;
+    c_type_ = signer->curve_type();
+
+    m_ = m;
+
+    return true;
+}
 
+bool P1Context::CreateContext(const std::shared_ptr<const P1Signer> &signer, const safeheron::bignum::BN &m,
+                              const P1Nonce &nonce) {
+    if (!CreateContext(signer, m)) return false;
+
+    return SetNonce(nonce);
+}
+
+bool P1Context::SetNonce(const P1Nonce &nonce) {
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
     if (curv == nullptr) return false;
 
     const safeheron::bignum::BN &q = curv->n;
 
-    if (!(p1_key_share.x1_ >= 0 && p1_key_share.x1_ < q)
-        || p1_key_share.pail_pub_.n().BitLength() <= 2046)
-        return false;
-    key_share_ = p1_key_share;
+    if (nonce.sid_.length() != 32
+        || !(nonce.k1_ > 0 && nonce.k1_ < q)
+        || nonce.R_.GetCurveType() != c_type_
+        || nonce.R_.IsInfinity()
+        || nonce.r_ != nonce.R_.x() % q) return false;
 
-    m_ = m;
+    sid_ = nonce.sid_;
+    k1_ = nonce.k1_;
+    R_ = nonce.R_;
+    r_ = nonce.r_;
 
     return true;
 }
@@ -120,7 +149,7 @@ bool P1Context::Step3(const std::string &in_msg) {
     const safeheron::bignum::BN &q = curv->n;
 
     safeheron::bignum::BN k1_inv = k1_.InvM(q);
-    safeheron::bignum::BN s_prime = key_share_.pail_priv_.Decrypt(p2_msg2.c3_);
+    safeheron::bignum::BN s_prime = signer_->Decrypt(p2_msg2.c3_);
 
     const safeheron::bignum::BN q2 = q * q;
     const safeheron::bignum::BN q3 = q * q * q;
@@ -135,14 +164,26 @@ bool P1Context::Step3(const std::string &in_msg) {
         v_ ^= 1;
     }
 
-    bool ok = safeheron::curve::ecdsa::VerifyPublicKey(key_share_.Q_,
-                                                       key_share_.Q_.GetCurveType(),
+    const P1KeyShare &key_share = signer_->key_share();
+    bool ok = safeheron::curve::ecdsa::VerifyPublicKey(key_share.Q_,
+                                                       key_share.Q_.GetCurveType(),
                                                        m_, r_, s_, v_);
     if (!ok) return false;
 
     return true;
 }
 
+bool P1Context::OnlineStep0(std::string &out_msg) {
+    if (sid_.empty()) return false;
+
+    P1OnlineMessage p1_online_msg;
+    p1_online_msg.sid_ = sid_;
+    p1_online_msg.m_ = m_;
+    if (!p1_online_msg.ToBase64(out_msg)) return false;
+
+    return true;
+}
+
 bool P1Context::export_sig(uint8_t *sig64, uint32_t &v) const {
     r_.ToBytes32BE(sig64);
     s_.ToBytes32BE(sig64 + 32);
@@ -1,6 +1,9 @@
 #ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1CONTEXT_H
 #define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1CONTEXT_H
+#include <memory>
 #include "multi-party-sig/two-party-ecdsa/lindell17/P1KeyShare.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P1Signer.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/nonce.h"
 #include "crypto-suites/crypto-zkp/dlog_proof_v2.h"
 
 namespace safeheron{
@@ -15,6 +18,27 @@ public:
                         const std::string &p1_key_share_base64,
                         const safeheron::bignum::BN &m);
 
+    /**
+     * Create a context for the online phase with a nonce agreed on in the presign phase (see P1PresignContext).
+     * The online phase is OnlineStep0 followed by Step3, one request / response with P2.
+     * The nonce must not be used again.
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                        const std::string &p1_key_share_base64,
+                        const safeheron::bignum::BN &m,
+                        const P1Nonce &nonce);
+
+    /**
+     * Create a context with a prepared signer, which saves parsing the key share in every session and decrypts
+     * with the CRT.
+     */
+    bool CreateContext(const std::shared_ptr<const P1Signer> &signer,
+                        const safeheron::bignum::BN &m);
+
+    bool CreateContext(const std::shared_ptr<const P1Signer> &signer,
+                        const safeheron::bignum::BN &m,
+                        const P1Nonce &nonce);
+
 public:
     // Add extra step0 to negotiate sid with P2
     bool Step0(std::string &out_msg);
@@ -25,8 +49,14 @@ public:
 
     bool Step3(const std::string &in_msg);
 
+    // Send m and sid of the presigned nonce to P2.
+    bool OnlineStep0(std::string &out_msg);
+
     bool export_sig(uint8_t *sig64, uint32_t &v) const;
 
+private:
+    bool SetNonce(const P1Nonce &nonce);
+
 private:
     safeheron::zkp::dlog::DLogProof_V2 d_log_proof_R1_;
     std::string sid1_blind_factor_;
@@ -35,7 +65,7 @@ private:
     safeheron::curve::CurveType c_type_;
 
     safeheron::bignum::BN m_;
-    P1KeyShare key_share_;
+    std::shared_ptr<const P1Signer> signer_;
 
     safeheron::bignum::BN k1_;
     safeheron::curve::CurvePoint R_;
@@ -0,0 +1,153 @@
+#include "P1PresignContext.h"
+#include "message.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-commitment/com256.h"
+
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+bool P1PresignContext::CreateContext(const safeheron::curve::CurveType &c_type, size_t batch_size, size_t max_threads) {
+    if (!check_ecdsa_curve(c_type)) return false;
+    if (batch_size == 0) return false;
+    c_type_ = c_type;
+    max_threads_ = max_threads;
+
+    state_arr_.clear();
+    state_arr_.resize(batch_size);
+    finished_ = false;
+
+    return true;
+}
+
+bool P1PresignContext::Step0(std::string &out_msg) {
+    std::vector<std::string> out_msg_arr(state_arr_.size());
+    for (size_t i = 0; i < state_arr_.size(); ++i) {
+        NonceState &st = state_arr_[i];
+        st.sid1_ = safeheron::rand::RandomBytes(32);
+        st.sid1_blind_factor_ = safeheron::rand::RandomBytes(32);
+
+        safeheron::commitment::HashCommit256 sha256_com;
+        sha256_com.UpdateString(st.sid1_);
+
+        P1Message0 p1_msg0;
+        p1_msg0.sid1_commitment_ = sha256_com.Commit(st.sid1_blind_factor_);
+        if (!p1_msg0.ToBase64(out_msg_arr[i])) return false;
+    }
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P1PresignContext::Step1(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != state_arr_.size()) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    std::vector<std::string> out_msg_arr(state_arr_.size());
+    // Nonces of the batch are independent, compute them in parallel.
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(state_arr_.size(), [&](size_t i) {
+        NonceState &st = state_arr_[i];
+        P2Message0 p2_msg0;
+        if (!p2_msg0.FromBase64(in_msg_arr[i])) return false;
+
+        if (st.sid1_.length() != p2_msg0.sid2_.length()) return false;
+
+        std::string &sid = st.nonce_.sid_;
+        sid = st.sid1_;
+        for (size_t k = 0; k < st.sid1_.length(); ++k) {
+            sid[k] ^= p2_msg0.sid2_[k];
+        }
+
+        st.nonce_.k1_ = safeheron::rand::RandomBNLt(q);
+        safeheron::curve::CurvePoint R1 = curv->g * st.nonce_.k1_;
+        st.d_log_proof_R1_.SetSalt(sid + "1");
+        st.d_log_proof_R1_.ProveEx(st.nonce_.k1_, c_type_);
+
+        st.t_ = safeheron::rand::RandomBNLt(q);
+
+        // (com-prove, sid || 1, R1, d_log_proof_R1_.A_, t_)
+        safeheron::commitment::HashCommit256 sha256_com;
+        sha256_com.UpdateString(sid + "1");
+        sha256_com.UpdateCurvePoint(R1);
+        sha256_com.UpdateCurvePoint(st.d_log_proof_R1_.A_);
+        sha256_com.UpdateBN(st.t_);
+        st.zk_pk_blind_factor_ = safeheron::rand::RandomBytes(32);
+
+        P1Message1 p1_msg1;
+        p1_msg1.sid1_ = st.sid1_;
+        p1_msg1.sid1_blind_factor_ = st.sid1_blind_factor_;
+        p1_msg1.zk_pk_commitment_ = sha256_com.Commit(st.zk_pk_blind_factor_);
+        if (!p1_msg1.ToBase64(out_msg_arr[i])) return false;
+        return true;
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P1PresignContext::Step2(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != state_arr_.size()) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    std::vector<std::string> out_msg_arr(state_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(state_arr_.size(), [&](size_t i) {
+        NonceState &st = state_arr_[i];
+        P2Message1 p2_msg1;
+        if (!p2_msg1.FromBase64(in_msg_arr[i])) return false;
+
+        p2_msg1.d_log_proof_R2_.SetSalt(st.nonce_.sid_ + "2");
+        if (!p2_msg1.d_log_proof_R2_.Verify(p2_msg1.R2_)) return false;
+
+        st.nonce_.R_ = (p2_msg1.R2_ * st.t_) * st.nonce_.k1_;
+        st.nonce_.r_ = st.nonce_.R_.x() % q;
+
+        P1Message2 p1_msg2;
+        p1_msg2.R1_ = curv->g * st.nonce_.k1_;
+        p1_msg2.d_log_proof_R1_ = st.d_log_proof_R1_;
+        p1_msg2.t_ = st.t_;
+        p1_msg2.zk_pk_blind_factor_ = st.zk_pk_blind_factor_;
+        if (!p1_msg2.ToBase64(out_msg_arr[i])) return false;
+        return true;
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+    finished_ = true;
+
+    return true;
+}
+
+bool P1PresignContext::export_nonces(std::vector<P1Nonce> &nonce_arr) const {
+    if (!finished_) return false;
+    nonce_arr.clear();
+    for (const auto &st: state_arr_) {
+        nonce_arr.push_back(st.nonce_);
+    }
+    return true;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,62 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1PRESIGNCONTEXT_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1PRESIGNCONTEXT_H
+#include <vector>
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/nonce.h"
+#include "crypto-suites/crypto-zkp/dlog_proof_v2.h"
+
+namespace safeheron{
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Presign phase of P1: negotiate the sid and the nonce R of a batch of signatures ahead of time, so that the online
+ * phase is a single request / response (see P1Context::OnlineStep0).
+ *
+ * The steps are Step0 to Step2 of P1Context run for every nonce of the batch, and the messages of the batch are
+ * packed into one message per step.
+ */
+class P1PresignContext {
+public:
+    P1PresignContext() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), max_threads_(0), finished_(false) {}
+
+    /**
+     * @param c_type
+     * @param batch_size number of nonces
+     * @param max_threads maximum number of threads computing the nonces of the batch, 0 means
+     *      std::thread::hardware_concurrency().
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type, size_t batch_size, size_t max_threads = 0);
+
+public:
+    bool Step0(std::string &out_msg);
+
+    bool Step1(const std::string &in_msg, std::string &out_msg);
+
+    bool Step2(const std::string &in_msg, std::string &out_msg);
+
+    // Nonces are available after Step2.
+    bool export_nonces(std::vector<P1Nonce> &nonce_arr) const;
+
+private:
+    struct NonceState {
+        safeheron::zkp::dlog::DLogProof_V2 d_log_proof_R1_;
+        std::string sid1_blind_factor_;
+        std::string zk_pk_blind_factor_;
+        std::string sid1_;
+        safeheron::bignum::BN t_;
+        P1Nonce nonce_;
+    };
+
+    safeheron::curve::CurveType c_type_;
+    std::vector<NonceState> state_arr_;
+    size_t max_threads_;
+    bool finished_;
+};
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1PRESIGNCONTEXT_H
@@ -0,0 +1,38 @@
+#include "P1Signer.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+bool P1Signer::CreateSigner(const safeheron::curve::CurveType &c_type, const std::string &p1_key_share_base64) {
+    initialized_ = false;
+
+    P1KeyShare p1_key_share;
+    if (!p1_key_share.FromBase64(p1_key_share_base64)) return false;
+
+    if (!check_ecdsa_curve(c_type)) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    if (!(p1_key_share.x1_ >= 0 && p1_key_share.x1_ < q)
+        || p1_key_share.pail_pub_.n().BitLength() <= 2046)
+        return false;
+
+    if (!decryptor_.Init(p1_key_share.pail_pub_, p1_key_share.pail_priv_)) return false;
+
+    c_type_ = c_type;
+    key_share_ = p1_key_share;
+    initialized_ = true;
+
+    return true;
+}
+
+}
+}
+}
+}
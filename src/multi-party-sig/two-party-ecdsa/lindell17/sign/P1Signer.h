@@ -0,0 +1,46 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1SIGNER_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1SIGNER_H
+#include "multi-party-sig/two-party-ecdsa/lindell17/P1KeyShare.h"
+#include "multi-party-sig/mpc-flow/common/pail_crt_decryptor.h"
+
+namespace safeheron{
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Prepared key share of P1, shared by sign sessions of the same key.
+ *
+ * The key share is parsed and checked once, and the Paillier private key is prepared for CRT decryption.
+ * The signer is immutable after CreateSigner(), so it can be used by concurrent sessions, see
+ * P1Context::CreateContext(const std::shared_ptr<const P1Signer> &, ...).
+ */
+class P1Signer {
+public:
+    P1Signer() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), initialized_(false) {}
+
+    bool CreateSigner(const safeheron::curve::CurveType &c_type,
+                      const std::string &p1_key_share_base64);
+
+    bool IsInitialized() const { return initialized_; }
+
+    const safeheron::curve::CurveType &curve_type() const { return c_type_; }
+
+    const P1KeyShare &key_share() const { return key_share_; }
+
+    // Decrypt with the CRT
+    safeheron::bignum::BN Decrypt(const safeheron::bignum::BN &c) const { return decryptor_.Decrypt(c); }
+
+private:
+    safeheron::curve::CurveType c_type_;
+    P1KeyShare key_share_;
+    safeheron::mpc_flow::common::PailCRTDecryptor decryptor_;
+    bool initialized_;
+};
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P1SIGNER_H
@@ -0,0 +1,78 @@
+#include "P2BatchContext.h"
+#include "P2Context.h"
+#include "message.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+bool P2BatchContext::CreateContext(const safeheron::curve::CurveType &c_type, const std::string &p2_key_share_base64,
+                                   const std::vector<safeheron::bignum::BN> &m_arr, size_t max_threads) {
+    // The exponentiation table pays off from a few signatures on.
+    std::shared_ptr<P2Signer> signer = std::make_shared<P2Signer>();
+    if (!signer->CreateSigner(c_type, p2_key_share_base64, m_arr.size() > 4 ? 4 : 0)) return false;
+
+    return CreateContext(signer, m_arr, max_threads);
+}
+
+bool P2BatchContext::CreateContext(const std::shared_ptr<const P2Signer> &signer,
+                                   const std::vector<safeheron::bignum::BN> &m_arr, size_t max_threads) {
+    if (!signer || !signer->IsInitialized()) return false;
+    if (m_arr.empty()) return false;
+
+    signer_ = signer;
+    c_type_ = signer->curve_type();
+    m_arr_ = m_arr;
+    max_threads_ = max_threads;
+
+    return presign_context_.CreateContext(c_type_, m_arr_.size(), max_threads_);
+}
+
+bool P2BatchContext::Step0(const std::string &in_msg, std::string &out_msg) {
+    return presign_context_.Step0(in_msg, out_msg);
+}
+
+bool P2BatchContext::Step1(const std::string &in_msg, std::string &out_msg) {
+    return presign_context_.Step1(in_msg, out_msg);
+}
+
+bool P2BatchContext::Step2(const std::string &in_msg, std::string &out_msg) {
+    // [presign message, online requests]
+    std::vector<std::string> part_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, part_arr)) return false;
+    if (part_arr.size() != 2) return false;
+
+    if (!presign_context_.Step2(part_arr[0])) return false;
+
+    NonceStore<P2Nonce> nonce_store;
+    if (!presign_context_.export_nonces(nonce_store)) return false;
+
+    std::vector<std::string> request_arr;
+    if (!BatchMPCContext::DecodeMessages(part_arr[1], request_arr)) return false;
+    if (request_arr.size() != m_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(m_arr_.size());
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(m_arr_.size(), [&](size_t i) {
+        P1OnlineMessage request;
+        if (!request.FromBase64(request_arr[i])) return false;
+        P2Context sign_context;
+        if (!sign_context.CreateContext(signer_, m_arr_[i], nonce_store, request.sid_)) return false;
+        return sign_context.OnlineStep0(request_arr[i], out_msg_arr[i]);
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,54 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2BATCHCONTEXT_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2BATCHCONTEXT_H
+#include <memory>
+#include <vector>
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2PresignContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2Signer.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Batch signing of P2, the counterpart of P1BatchContext.
+ *
+ * Step2 checks that P1 asks for the messages in m_arr, in the same order, and replies with a vector of c3.
+ */
+class P2BatchContext {
+public:
+    P2BatchContext() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), max_threads_(0) {}
+
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                        const std::string &p2_key_share_base64,
+                        const std::vector<safeheron::bignum::BN> &m_arr,
+                        size_t max_threads = 0);
+
+    bool CreateContext(const std::shared_ptr<const P2Signer> &signer,
+                        const std::vector<safeheron::bignum::BN> &m_arr,
+                        size_t max_threads = 0);
+
+public:
+    bool Step0(const std::string &in_msg, std::string &out_msg);
+
+    bool Step1(const std::string &in_msg, std::string &out_msg);
+
+    bool Step2(const std::string &in_msg, std::string &out_msg);
+
+    size_t size() const { return m_arr_.size(); }
+
+private:
+    safeheron::curve::CurveType c_type_;
+    std::shared_ptr<const P2Signer> signer_;
+    std::vector<safeheron::bignum::BN> m_arr_;
+    size_t max_threads_;
+
+    P2PresignContext presign_context_;
+};
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2BATCHCONTEXT_H
@@ -1,6 +1,7 @@
 #include "P2Context.h"
 #include "message.h"
 #include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-commitment/com256.h"
 
@@ -9,22 +10,56 @@ namespace two_party_ecdsa {
 namespace lindell17 {
 namespace sign {
 bool P2Context::CreateContext(const safeheron::curve::CurveType &c_type, const std::string &p2_key_share_base64, const safeheron::bignum::BN &m) {
-    P2KeyShare p2_key_share;
-    if (!p2_key_share.FromBase64(p2_key_share_base64)) return false;
+    // No exponentiation table for a signer of one session
+    std::shared_ptr<P2Signer> signer = std::make_shared<P2Signer>();
+    if (!signer->CreateSigner(c_type, p2_key_share_base64, 0)) return false;
 
-    if (!check_ecdsa_curve(c_type)) return false;
-    c_type_ = c_type;
+    return CreateContext(signer, m);
+}
+
+bool P2Context::CreateContext(const safeheron::curve::CurveType &c_type, const std::string &p2_key_share_base64,
+                              const safeheron::bignum::BN &m, NonceStore<P2Nonce> &nonce_store,
+                              const std::string &sid) {
+    if (!CreateContext(c_type, p2_key_share_base64, m)) return false;
+
+    P2Nonce nonce;
+    if (!nonce_store.Take(sid, nonce)) return false;
+    return SetNonce(nonce);
+}
+
+bool P2Context::CreateContext(const std::shared_ptr<const P2Signer> &signer, const safeheron::bignum::BN &m) {
+    if (!signer || !signer->IsInitialized()) return false;
+    signer_ = signer;
+    c_type_ = signer->curve_type();
+
+    m_ = m;
+
+    return true;
+}
+
+bool P2Context::CreateContext(const std::shared_ptr<const P2Signer> &signer, const safeheron::bignum::BN &m,
+                              NonceStore<P2Nonce> &nonce_store, const std::string &sid) {
+    if (!CreateContext(signer, m)) return false;
 
+    P2Nonce nonce;
+    if (!nonce_store.Take(sid, nonce)) return false;
+    return SetNonce(nonce);
+}
+
+bool P2Context::SetNonce(const P2Nonce &nonce) {
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
     if (curv == nullptr) return false;
 
     const safeheron::bignum::BN &q = curv->n;
 
-    if (!(p2_key_share.x2_ >= 0 && p2_key_share.x2_ < q)
-        || !(p2_key_share.c_ > 0 && p2_key_share.c_ < p2_key_share.pail_pub_.n_sqr())) return false;
-    key_share_ = p2_key_share;
+    if (nonce.sid_.length() != 32
+        || !(nonce.k2_prime_ > 0 && nonce.k2_prime_ < q)
+        || nonce.R_.GetCurveType() != c_type_
+        || nonce.R_.IsInfinity()) return false;
 
-    m_ = m;
+    sid_ = nonce.sid_;
+    k2_prime_ = nonce.k2_prime_;
+    R_ = nonce.R_;
 
     return true;
 }
@@ -105,22 +140,56 @@ bool P2Context::Step2(const std::string &in_msg, std::string &out_msg) {
 
     k2_prime_ = (k2_ * p1_msg2.t_) % q;
     R_ = p1_msg2.R1_ * k2_prime_;
+
+    safeheron::bignum::BN c3;
+    if (!ComputeC3(c3)) return false;
+
+    P2Message2 p2_msg_2;
+    p2_msg_2.c3_ = c3;
+    if (!p2_msg_2.ToBase64(out_msg)) return false;
+
+    return true;
+}
+
+bool P2Context::OnlineStep0(const std::string &in_msg, std::string &out_msg) {
+    P1OnlineMessage p1_online_msg;
+    if (!p1_online_msg.FromBase64(in_msg)) return false;
+
+    // P1 must ask for the signature of the message and the nonce that P2 has agreed to.
+    if (sid_.empty() || p1_online_msg.sid_ != sid_) return false;
+    if (p1_online_msg.m_ != m_) return false;
+
+    safeheron::bignum::BN c3;
+    if (!ComputeC3(c3)) return false;
+
+    P2Message2 p2_msg_2;
+    p2_msg_2.c3_ = c3;
+    if (!p2_msg_2.ToBase64(out_msg)) return false;
+
+    return true;
+}
+
+bool P2Context::ComputeC3(safeheron::bignum::BN &c3) const {
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+    const P2KeyShare &key_share = signer_->key_share();
+
     safeheron::bignum::BN r = R_.x() % q;
     // Sample rho in (0, q^2)
     safeheron::bignum::BN rho = safeheron::rand::RandomBNLt(q * q);
     safeheron::bignum::BN k2_inv = k2_prime_.InvM(q);
     // c1 = Enc(pail_pub, rho*q + (k2_inv * r * x2 + k2_inv * m) mod q)
-    safeheron::bignum::BN c1 = key_share_.pail_pub_.Encrypt(rho * q + (k2_inv * r * key_share_.x2_ + k2_inv * m_) % q);
+    safeheron::bignum::BN r_pail, r_pail_pow_N;
+    safeheron::mpc_flow::common::SampleEncRandomness(key_share.pail_pub_, r_pail, r_pail_pow_N);
+    safeheron::bignum::BN c1 = safeheron::mpc_flow::common::EncryptWithRN(key_share.pail_pub_, rho * q + (k2_inv * r * key_share.x2_ + k2_inv * m_) % q, r_pail_pow_N);
     // v = (k2_inv * r) mod q
     safeheron::bignum::BN v = (k2_inv * r) % q;
     // c2 = Enc(pail_pub, v * (x1 + q) ;r)
-    safeheron::bignum::BN c2 = key_share_.pail_pub_.HomomorphicMulPlain(key_share_.pail_pub_.HomomorphicAdd(key_share_.c_, key_share_.pail_pub_.EncryptWithR(q, safeheron::bignum::BN(1))), v);
+    safeheron::bignum::BN c2 = signer_->MulPlainCq(v);
     // c3 = HAdd(c1, c2) = Enc(pail_pub, [rho*q + (k2_inv * r * x2 + k2_inv * m) mod q] + [(k2_inv * r) mod q] * (x1 + q))
-    safeheron::bignum::BN c3 = key_share_.pail_pub_.HomomorphicAdd(c1,c2);
-
-    P2Message2 p2_msg_2;
-    p2_msg_2.c3_ = c3;
-    if (!p2_msg_2.ToBase64(out_msg)) return false;
+    c3 = key_share.pail_pub_.HomomorphicAdd(c1,c2);
 
     return true;
 }
@@ -1,6 +1,9 @@
 #ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2CONTEXT_H
 #define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2CONTEXT_H
+#include <memory>
 #include "multi-party-sig/two-party-ecdsa/lindell17/P2KeyShare.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/P2Signer.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/nonce.h"
 
 namespace safeheron {
 namespace two_party_ecdsa {
@@ -14,6 +17,30 @@ public:
                         const std::string &p2_key_share_base64,
                         const safeheron::bignum::BN &m);
 
+    /**
+     * Create a context for the online phase with a nonce agreed on in the presign phase (see P2PresignContext).
+     * The nonce is taken out of the store, so it is never used for a second signature.
+     * @param sid sid of the nonce, found in the request of P1, see P1OnlineMessage.
+     * @return false if the store has no nonce of this sid, e.g. it was already taken.
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type,
+                        const std::string &p2_key_share_base64,
+                        const safeheron::bignum::BN &m,
+                        NonceStore<P2Nonce> &nonce_store,
+                        const std::string &sid);
+
+    /**
+     * Create a context with a prepared signer, which saves parsing the key share in every session and computes c2
+     * with the fixed-base table of the signer.
+     */
+    bool CreateContext(const std::shared_ptr<const P2Signer> &signer,
+                        const safeheron::bignum::BN &m);
+
+    bool CreateContext(const std::shared_ptr<const P2Signer> &signer,
+                        const safeheron::bignum::BN &m,
+                        NonceStore<P2Nonce> &nonce_store,
+                        const std::string &sid);
+
 public:
     // Add extra step0 to negotiate sid with P1
     bool Step0(const std::string &in_msg, std::string &out_msg);
@@ -22,13 +49,21 @@ public:
 
     bool Step2(const std::string &in_msg, std::string &out_msg);
 
+    // Reply c3 to the online request of P1.
+    bool OnlineStep0(const std::string &in_msg, std::string &out_msg);
+
+private:
+    bool SetNonce(const P2Nonce &nonce);
+
+    bool ComputeC3(safeheron::bignum::BN &c3) const;
+
 private:
     std::string sid1_commitment_;
     std::string zk_pk_commmitment_;
 
     safeheron::curve::CurveType c_type_;
     safeheron::bignum::BN m_;
-    P2KeyShare key_share_;
+    std::shared_ptr<const P2Signer> signer_;
 
     safeheron::bignum::BN k2_;
     safeheron::bignum::BN k2_prime_;
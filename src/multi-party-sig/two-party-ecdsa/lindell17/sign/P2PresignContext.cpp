@@ -0,0 +1,161 @@
+#include "P2PresignContext.h"
+#include "message.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-commitment/com256.h"
+
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+bool P2PresignContext::CreateContext(const safeheron::curve::CurveType &c_type, size_t batch_size, size_t max_threads) {
+    if (!check_ecdsa_curve(c_type)) return false;
+    if (batch_size == 0) return false;
+    c_type_ = c_type;
+    max_threads_ = max_threads;
+
+    state_arr_.clear();
+    state_arr_.resize(batch_size);
+    finished_ = false;
+    exported_ = false;
+
+    return true;
+}
+
+bool P2PresignContext::Step0(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != state_arr_.size()) return false;
+
+    std::vector<std::string> out_msg_arr(state_arr_.size());
+    for (size_t i = 0; i < state_arr_.size(); ++i) {
+        NonceState &st = state_arr_[i];
+        P1Message0 p1_msg0;
+        if (!p1_msg0.FromBase64(in_msg_arr[i])) return false;
+
+        st.sid1_commitment_ = p1_msg0.sid1_commitment_;
+
+        st.sid2_ = safeheron::rand::RandomBytes(32);
+
+        P2Message0 p2_msg0;
+        p2_msg0.sid2_ = st.sid2_;
+        if (!p2_msg0.ToBase64(out_msg_arr[i])) return false;
+    }
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P2PresignContext::Step1(const std::string &in_msg, std::string &out_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != state_arr_.size()) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    std::vector<std::string> out_msg_arr(state_arr_.size());
+    // Nonces of the batch are independent, compute them in parallel.
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(state_arr_.size(), [&](size_t i) {
+        NonceState &st = state_arr_[i];
+        P1Message1 p1_msg1;
+        if (!p1_msg1.FromBase64(in_msg_arr[i])) return false;
+
+        safeheron::commitment::HashCommit256 sha256_com;
+        sha256_com.UpdateString(p1_msg1.sid1_);
+        if (!sha256_com.OpenAndVerify(p1_msg1.sid1_blind_factor_, st.sid1_commitment_)) return false;
+
+        if (st.sid2_.length() != p1_msg1.sid1_.length()) return false;
+
+        std::string &sid = st.nonce_.sid_;
+        sid = st.sid2_;
+        for (size_t k = 0; k < st.sid2_.length(); ++k) {
+            sid[k] ^= p1_msg1.sid1_[k];
+        }
+
+        st.zk_pk_commmitment_ = p1_msg1.zk_pk_commitment_;
+
+        st.k2_ = safeheron::rand::RandomBNLt(q);
+        safeheron::curve::CurvePoint R2 = curv->g * st.k2_;
+        safeheron::zkp::dlog::DLogProof_V2 d_log_proof_R2;
+        d_log_proof_R2.SetSalt(sid + "2");
+        d_log_proof_R2.ProveEx(st.k2_, c_type_);
+
+        P2Message1 p2_msg1;
+        p2_msg1.R2_ = R2;
+        p2_msg1.d_log_proof_R2_ = d_log_proof_R2;
+        if (!p2_msg1.ToBase64(out_msg_arr[i])) return false;
+        return true;
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    BatchMPCContext::EncodeMessages(out_msg_arr, out_msg);
+
+    return true;
+}
+
+bool P2PresignContext::Step2(const std::string &in_msg) {
+    std::vector<std::string> in_msg_arr;
+    if (!BatchMPCContext::DecodeMessages(in_msg, in_msg_arr)) return false;
+    if (in_msg_arr.size() != state_arr_.size()) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    size_t first_failed = 0;
+    bool ok = ParallelForAll(state_arr_.size(), [&](size_t i) {
+        NonceState &st = state_arr_[i];
+        P1Message2 p1_msg2;
+        if (!p1_msg2.FromBase64(in_msg_arr[i])) return false;
+
+        if ((p1_msg2.t_ % q) == 0) return false;
+
+        // (decom-proof, sid || 1, R1, d_log_proof_R1_.A_, t_)
+        safeheron::commitment::HashCommit256 sha256_com;
+        sha256_com.UpdateString(st.nonce_.sid_ + "1");
+        sha256_com.UpdateCurvePoint(p1_msg2.R1_);
+        sha256_com.UpdateCurvePoint(p1_msg2.d_log_proof_R1_.A_);
+        sha256_com.UpdateBN(p1_msg2.t_);
+        if (!sha256_com.OpenAndVerify(p1_msg2.zk_pk_blind_factor_, st.zk_pk_commmitment_)) return false;
+
+        // verify DLOG proof of R1
+        p1_msg2.d_log_proof_R1_.SetSalt(st.nonce_.sid_ + "1");
+        if (!p1_msg2.d_log_proof_R1_.Verify(p1_msg2.R1_)) return false;
+
+        st.nonce_.k2_prime_ = (st.k2_ * p1_msg2.t_) % q;
+        st.nonce_.R_ = p1_msg2.R1_ * st.nonce_.k2_prime_;
+        return true;
+    }, first_failed, max_threads_);
+    if (!ok) return false;
+    finished_ = true;
+
+    return true;
+}
+
+bool P2PresignContext::export_nonces(NonceStore<P2Nonce> &nonce_store) {
+    if (!finished_ || exported_) return false;
+    std::vector<P2Nonce> nonce_arr;
+    for (const auto &st: state_arr_) {
+        nonce_arr.push_back(st.nonce_);
+    }
+    nonce_store.Add(nonce_arr);
+    // No copy is left behind
+    state_arr_.clear();
+    exported_ = true;
+    return true;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,63 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2PRESIGNCONTEXT_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2PRESIGNCONTEXT_H
+#include <vector>
+#include "multi-party-sig/two-party-ecdsa/lindell17/sign/nonce.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Presign phase of P2, the counterpart of P1PresignContext.
+ *
+ * P2 has nothing to send after Step2: the nonces are ready once the decommitments of P1 are verified.
+ */
+class P2PresignContext {
+public:
+    P2PresignContext() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), max_threads_(0), finished_(false),
+                         exported_(false) {}
+
+    /**
+     * @param c_type
+     * @param batch_size number of nonces
+     * @param max_threads maximum number of threads computing the nonces of the batch, 0 means
+     *      std::thread::hardware_concurrency().
+     */
+    bool CreateContext(const safeheron::curve::CurveType &c_type, size_t batch_size, size_t max_threads = 0);
+
+public:
+    bool Step0(const std::string &in_msg, std::string &out_msg);
+
+    bool Step1(const std::string &in_msg, std::string &out_msg);
+
+    bool Step2(const std::string &in_msg);
+
+    /**
+     * Move the nonces into the store, after Step2. They can only be exported once, P2Context takes each of them out
+     * of the store for one signature.
+     */
+    bool export_nonces(NonceStore<P2Nonce> &nonce_store);
+
+private:
+    struct NonceState {
+        std::string sid1_commitment_;
+        std::string zk_pk_commmitment_;
+        std::string sid2_;
+        safeheron::bignum::BN k2_;
+        P2Nonce nonce_;
+    };
+
+    safeheron::curve::CurveType c_type_;
+    std::vector<NonceState> state_arr_;
+    size_t max_threads_;
+    bool finished_;
+    bool exported_;
+};
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2PRESIGNCONTEXT_H
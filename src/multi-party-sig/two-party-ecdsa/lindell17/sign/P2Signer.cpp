@@ -0,0 +1,63 @@
+#include "P2Signer.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/util.h"
+
+using safeheron::mpc_flow::common::FixedBaseExp;
+using safeheron::mpc_flow::common::PailRandPool;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+P2Signer::~P2Signer() {
+    if (rand_pool_ && PailRandPool::Find(rand_pool_->N()) == rand_pool_) {
+        PailRandPool::Unregister(rand_pool_->N());
+    }
+}
+
+bool P2Signer::CreateSigner(const safeheron::curve::CurveType &c_type, const std::string &p2_key_share_base64,
+                            size_t window_bits) {
+    if (initialized_) return false;
+
+    P2KeyShare p2_key_share;
+    if (!p2_key_share.FromBase64(p2_key_share_base64)) return false;
+
+    if (!check_ecdsa_curve(c_type)) return false;
+
+    const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type);
+    if (curv == nullptr) return false;
+
+    const safeheron::bignum::BN &q = curv->n;
+
+    if (!(p2_key_share.x2_ >= 0 && p2_key_share.x2_ < q)
+        || !(p2_key_share.c_ > 0 && p2_key_share.c_ < p2_key_share.pail_pub_.n_sqr())) return false;
+
+    c_type_ = c_type;
+    key_share_ = p2_key_share;
+    c_q_ = key_share_.pail_pub_.HomomorphicAdd(key_share_.c_, key_share_.pail_pub_.EncryptWithR(q, safeheron::bignum::BN(1)));
+    window_bits_ = window_bits;
+    initialized_ = true;
+
+    return true;
+}
+
+void P2Signer::EnableRandPool(size_t capacity, size_t worker_num) {
+    if (!initialized_ || rand_pool_) return;
+    rand_pool_ = std::make_shared<PailRandPool>(key_share_.pail_pub_.n(), capacity, worker_num);
+    PailRandPool::Register(rand_pool_);
+}
+
+safeheron::bignum::BN P2Signer::MulPlainCq(const safeheron::bignum::BN &v) const {
+    if (window_bits_ == 0) return key_share_.pail_pub_.HomomorphicMulPlain(c_q_, v);
+
+    std::call_once(table_flag_, [this] {
+        const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(c_type_);
+        table_.reset(new FixedBaseExp(c_q_, key_share_.pail_pub_.n_sqr(), curv->n.BitLength(), window_bits_));
+    });
+    return table_->Pow(v);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,75 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2SIGNER_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2SIGNER_H
+#include <memory>
+#include <mutex>
+#include "multi-party-sig/two-party-ecdsa/lindell17/P2KeyShare.h"
+#include "multi-party-sig/mpc-flow/common/fixed_base_exp.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Prepared key share of P2, shared by sign sessions of the same key.
+ *
+ * In every signature P2 computes c2 = (c * Enc(q; 1))^v mod N^2, where the base c * Enc(q; 1) is fixed for the key
+ * share. The signer keeps the base and a fixed-base exponentiation table for it, built on first use. The randomness
+ * of c1 is taken from a PailRandPool, see EnableRandPool().
+ */
+class P2Signer {
+public:
+    P2Signer() : c_type_(safeheron::curve::CurveType::INVALID_CURVE), window_bits_(0), initialized_(false) {}
+
+    ~P2Signer();
+
+    P2Signer(const P2Signer &) = delete;
+
+    P2Signer &operator=(const P2Signer &) = delete;
+
+    /**
+     * @param c_type
+     * @param p2_key_share_base64
+     * @param window_bits window size of the exponentiation table, 0 means no table.
+     *      A table of window w takes ceil(256 / w) * 2^w numbers of size N^2, d = 0 included, which is
+     *      64 * 16 * 512 bytes = 512KB for w = 4 and a 2048 bits N.
+     */
+    bool CreateSigner(const safeheron::curve::CurveType &c_type,
+                      const std::string &p2_key_share_base64,
+                      size_t window_bits = 4);
+
+    /**
+     * Start a pool of (r, r^N) for the Paillier key of the key share, which is used by SampleEncRandomness().
+     */
+    void EnableRandPool(size_t capacity = 64, size_t worker_num = 1);
+
+    bool IsInitialized() const { return initialized_; }
+
+    const safeheron::curve::CurveType &curve_type() const { return c_type_; }
+
+    const P2KeyShare &key_share() const { return key_share_; }
+
+    /**
+     * @return (c * Enc(q; 1))^v mod N^2
+     */
+    safeheron::bignum::BN MulPlainCq(const safeheron::bignum::BN &v) const;
+
+private:
+    safeheron::curve::CurveType c_type_;
+    P2KeyShare key_share_;
+    // c * Enc(q; 1) mod N^2
+    safeheron::bignum::BN c_q_;
+    size_t window_bits_;
+    mutable std::once_flag table_flag_;
+    mutable std::unique_ptr<safeheron::mpc_flow::common::FixedBaseExp> table_;
+    std::shared_ptr<safeheron::mpc_flow::common::PailRandPool> rand_pool_;
+    bool initialized_;
+};
+}
+}
+}
+}
+
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_P2SIGNER_H
@@ -117,6 +117,25 @@ public:
 
     bool FromJsonString(const std::string &json_str);
 
+};
+/**
+ * Online request of P1 in the presign mode: the sid of the presigned nonce and the message to sign.
+ * It is the protobuf message "P1OnlineMessage { string sid = 1; string m = 2; }", whose descriptor is built at run
+ * time instead of being generated into proto_gen, see p1_online_message.cpp.
+ */
+class P1OnlineMessage {
+public:
+    std::string sid_;
+    safeheron::bignum::BN m_;
+public:
+    bool ToBase64(std::string &b64) const;
+
+    bool FromBase64(const std::string &b64);
+
+    bool ToJsonString(std::string &json_str) const;
+
+    bool FromJsonString(const std::string &json_str);
+
 };
 
 }
@@ -0,0 +1,87 @@
+#ifndef MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_NONCE_H
+#define MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_NONCE_H
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve_point.h"
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Nonce of P1 agreed on in the presign phase, see P1PresignContext.
+ * R_ = k1 * t * k2 * G, r_ = R_.x mod q
+ */
+class P1Nonce {
+public:
+    std::string sid_;
+    safeheron::bignum::BN k1_;
+    safeheron::curve::CurvePoint R_;
+    safeheron::bignum::BN r_;
+};
+
+/**
+ * Nonce of P2 agreed on in the presign phase, see P2PresignContext.
+ * k2_prime_ = k2 * t mod q, R_ = k1 * k2_prime_ * G
+ */
+class P2Nonce {
+public:
+    std::string sid_;
+    safeheron::bignum::BN k2_prime_;
+    safeheron::curve::CurvePoint R_;
+};
+
+/**
+ * Thread safe store of presigned nonces. A nonce is removed from the store when it is taken, so it can't be
+ * used to sign twice. Signing two messages with the same nonce leaks the key share.
+ */
+template<class Nonce>
+class NonceStore {
+public:
+    void Add(const std::vector<Nonce> &nonce_arr) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        for (const auto &nonce: nonce_arr) nonce_arr_.push_back(nonce);
+    }
+
+    // Take the oldest nonce.
+    bool Take(Nonce &nonce) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (nonce_arr_.empty()) return false;
+        nonce = nonce_arr_.front();
+        nonce_arr_.pop_front();
+        return true;
+    }
+
+    // Take the nonce with the specified sid.
+    bool Take(const std::string &sid, Nonce &nonce) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        for (auto iter = nonce_arr_.begin(); iter != nonce_arr_.end(); ++iter) {
+            if (iter->sid_ == sid) {
+                nonce = *iter;
+                nonce_arr_.erase(iter);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return nonce_arr_.size();
+    }
+
+private:
+    std::deque<Nonce> nonce_arr_;
+    mutable std::mutex mutex_;
+};
+
+}
+}
+}
+}
+
+#endif //MULTI_PARTY_SIG_TWO_PARTY_ECDSA_LINDELL17_SIGN_NONCE_H
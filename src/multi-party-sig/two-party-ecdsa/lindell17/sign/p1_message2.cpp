@@ -2,6 +2,7 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/hex.h"
 #include "crypto-suites/crypto-encode/base64.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
 #include <google/protobuf/port_def.inc>
 #include <google/protobuf/port_undef.inc>
 using google::protobuf::util::Status;
@@ -17,15 +18,11 @@ namespace sign {
 bool P1Message2::ToProtoObject(safeheron::proto::two_party_ecdsa::lindell17::sign::P1Message2 &p1_msg2) const {
     bool ok = true;
 
-    safeheron::proto::CurvePoint point_obj;
-    ok = R1_.ToProtoObject(point_obj);
+    ok = R1_.ToProtoObject(*p1_msg2.mutable_r1());
     if (!ok) return false;
-    p1_msg2.mutable_r1()->CopyFrom(point_obj);
 
-    safeheron::proto::DLogProof_V2 d_log_proof_obj;
-    ok = d_log_proof_R1_.ToProtoObject(d_log_proof_obj);
+    ok = d_log_proof_R1_.ToProtoObject(*p1_msg2.mutable_d_log_proof_r1());
     if (!ok) return false;
-    p1_msg2.mutable_d_log_proof_r1()->CopyFrom(d_log_proof_obj);
 
     std::string str;
     t_.ToHexStr(str);
@@ -56,7 +53,8 @@ typedef safeheron::proto::two_party_ecdsa::lindell17::sign::P1Message2 ProtoObje
 bool TheClass::ToBase64(std::string &b64) const {
     bool ok = true;
     b64.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -70,7 +68,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 
     std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
 
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = proto_object.ParseFromString(data);
     if (!ok) return false;
 
@@ -80,7 +79,8 @@ bool TheClass::FromBase64(const std::string &b64) {
 bool TheClass::ToJsonString(std::string &json_str) const {
     bool ok = true;
     json_str.clear();
-    ProtoObject proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     ok = ToProtoObject(proto_object);
     if (!ok) return false;
 
@@ -93,7 +93,8 @@ bool TheClass::ToJsonString(std::string &json_str) const {
 }
 
 bool TheClass::FromJsonString(const std::string &json_str) {
-    ProtoObject  proto_object;
+    safeheron::mpc_flow::common::ProtoArenaScope arena_scope;
+    ProtoObject &proto_object = *arena_scope.Create<ProtoObject>();
     JsonParseOptions jp_option;
     jp_option.ignore_unknown_fields = true;
     Status stat = JsonStringToMessage(json_str, &proto_object);
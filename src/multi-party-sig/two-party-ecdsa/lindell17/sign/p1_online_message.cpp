@@ -0,0 +1,146 @@
+#include "message.h"
+#include <memory>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/util/json_util.h>
+#include "crypto-suites/crypto-encode/hex.h"
+#include "crypto-suites/crypto-encode/base64.h"
+#include <google/protobuf/port_def.inc>
+#include <google/protobuf/port_undef.inc>
+using google::protobuf::util::Status;
+using google::protobuf::util::MessageToJsonString;
+using google::protobuf::util::JsonStringToMessage;
+using google::protobuf::util::JsonPrintOptions;
+using google::protobuf::util::JsonParseOptions;
+using google::protobuf::Descriptor;
+using google::protobuf::DescriptorPool;
+using google::protobuf::DynamicMessageFactory;
+using google::protobuf::FieldDescriptorProto;
+using google::protobuf::FileDescriptor;
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::Message;
+
+namespace safeheron {
+namespace two_party_ecdsa {
+namespace lindell17 {
+namespace sign {
+
+/**
+ * Prototype of
+ *     message P1OnlineMessage {
+ *       string sid = 1;
+ *       string m = 2;
+ *     }
+ * built from its descriptor at run time, so that no generated source is needed for each supported protobuf version.
+ */
+static const Message *GetPrototype() {
+    static DescriptorPool pool;
+    static DynamicMessageFactory factory(&pool);
+    static const Message *prototype = []() -> const Message * {
+        FileDescriptorProto file_proto;
+        file_proto.set_name("lindell17/online_sign.proto");
+        file_proto.set_package("safeheron.proto.two_party_ecdsa.lindell17.sign");
+        file_proto.set_syntax("proto3");
+        google::protobuf::DescriptorProto *message_proto = file_proto.add_message_type();
+        message_proto->set_name("P1OnlineMessage");
+        const char *field_name_arr[] = {"sid", "m"};
+        for (int i = 0; i < 2; ++i) {
+            FieldDescriptorProto *field_proto = message_proto->add_field();
+            field_proto->set_name(field_name_arr[i]);
+            field_proto->set_number(i + 1);
+            field_proto->set_type(FieldDescriptorProto::TYPE_STRING);
+            field_proto->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+        }
+        const FileDescriptor *file = pool.BuildFile(file_proto);
+        if (file == nullptr) return nullptr;
+        return factory.GetPrototype(file->message_type(0));
+    }();
+    return prototype;
+}
+
+static bool ToProtoObject(const P1OnlineMessage &p1_online_msg, Message &proto_object) {
+    const Descriptor *descriptor = proto_object.GetDescriptor();
+    const google::protobuf::Reflection *reflection = proto_object.GetReflection();
+    reflection->SetString(&proto_object, descriptor->FindFieldByNumber(1),
+                          safeheron::encode::hex::EncodeToHex(p1_online_msg.sid_));
+
+    std::string str;
+    p1_online_msg.m_.ToHexStr(str);
+    reflection->SetString(&proto_object, descriptor->FindFieldByNumber(2), str);
+
+    return true;
+}
+
+static bool FromProtoObject(const Message &proto_object, P1OnlineMessage &p1_online_msg) {
+    const Descriptor *descriptor = proto_object.GetDescriptor();
+    const google::protobuf::Reflection *reflection = proto_object.GetReflection();
+    p1_online_msg.sid_ = safeheron::encode::hex::DecodeFromHex(
+            reflection->GetString(proto_object, descriptor->FindFieldByNumber(1)));
+    p1_online_msg.m_ = safeheron::bignum::BN::FromHexStr(reflection->GetString(proto_object, descriptor->FindFieldByNumber(2)));
+
+    return true;
+}
+
+typedef P1OnlineMessage TheClass;
+
+bool TheClass::ToBase64(std::string &b64) const {
+    bool ok = true;
+    b64.clear();
+    const Message *prototype = GetPrototype();
+    if (prototype == nullptr) return false;
+    std::unique_ptr<Message> proto_object(prototype->New());
+    ok = ToProtoObject(*this, *proto_object);
+    if (!ok) return false;
+
+    std::string proto_bin = proto_object->SerializeAsString();
+    b64 = safeheron::encode::base64::EncodeToBase64(proto_bin, true);
+    return true;
+}
+
+bool TheClass::FromBase64(const std::string &b64) {
+    bool ok = true;
+
+    std::string data = safeheron::encode::base64::DecodeFromBase64(b64);
+
+    const Message *prototype = GetPrototype();
+    if (prototype == nullptr) return false;
+    std::unique_ptr<Message> proto_object(prototype->New());
+    ok = proto_object->ParseFromString(data);
+    if (!ok) return false;
+
+    return FromProtoObject(*proto_object, *this);
+}
+
+bool TheClass::ToJsonString(std::string &json_str) const {
+    bool ok = true;
+    json_str.clear();
+    const Message *prototype = GetPrototype();
+    if (prototype == nullptr) return false;
+    std::unique_ptr<Message> proto_object(prototype->New());
+    ok = ToProtoObject(*this, *proto_object);
+    if (!ok) return false;
+
+    JsonPrintOptions jp_option;
+    jp_option.add_whitespace = true;
+    Status stat = MessageToJsonString(*proto_object, &json_str, jp_option);
+    if (!stat.ok()) return false;
+
+    return  true;
+}
+
+bool TheClass::FromJsonString(const std::string &json_str) {
+    const Message *prototype = GetPrototype();
+    if (prototype == nullptr) return false;
+    std::unique_ptr<Message> proto_object(prototype->New());
+    JsonParseOptions jp_option;
+    jp_option.ignore_unknown_fields = true;
+    Status stat = JsonStringToMessage(json_str, proto_object.get());
+    if (!stat.ok()) return false;
+
+    return FromProtoObject(*proto_object, *this);
+}
+}
+}
+}
+}
@@ -0,0 +1,160 @@
+#include <map>
+#include <sstream>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-zkp/dln_proof.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/cmp.h"
+#include "../message.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::multi_party_ecdsa::cmp::aux_info_key_refresh::Context;
+using safeheron::multi_party_ecdsa::cmp::MinimalSignKey;
+
+const int PARTY_NUM = 3;
+
+// The error stack of a context, to explain a failed assertion.
+string error_stack_of(BatchMPCContext *ctx_ptr) {
+    vector<ErrorInfo> error_stack;
+    ctx_ptr->get_error_stack(error_stack);
+    std::ostringstream oss;
+    for (const auto &err: error_stack) {
+        oss << "error code (" << err.code_ << "): " << err.info_ << "\n";
+    }
+    return oss.str();
+}
+
+::testing::AssertionResult send_messages(BatchMPCContext *ctx_ptr, const std::string& party_id,
+                                         std::map<std::string, std::vector<Msg>> &map_id_queue) {
+    std::vector<string> out_p2p_message_arr;
+    string out_bc_message;
+    std::vector<string> out_des_arr;
+    bool ok = ctx_ptr->PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr);
+    if (!ok) return ::testing::AssertionFailure() << party_id << ": " << error_stack_of(ctx_ptr);
+    for (size_t k = 0; k < out_des_arr.size(); ++k) {
+        map_id_queue[out_des_arr[k]].push_back({
+                                                       party_id,
+                                                       out_bc_message,
+                                                       out_p2p_message_arr.empty() ? string()
+                                                                                   : out_p2p_message_arr[k]
+                                               });
+    }
+    return ::testing::AssertionSuccess();
+}
+
+::testing::AssertionResult run_round(BatchMPCContext *ctx_ptr, const std::string& party_id, int round_index,
+                                     std::map<std::string, std::vector<Msg>> &map_id_queue) {
+    if (round_index == 0) {
+        if (!ctx_ptr->PushMessage()) {
+            return ::testing::AssertionFailure() << party_id << ", round 0: " << error_stack_of(ctx_ptr);
+        }
+        return send_messages(ctx_ptr, party_id, map_id_queue);
+    }
+    std::vector<Msg>::iterator iter;
+    for (iter = map_id_queue[party_id].begin(); iter != map_id_queue[party_id].end(); ) {
+        if (!ctx_ptr->PushMessage(iter->p2p_msg_, iter->bc_msg_, iter->src_, round_index - 1)) {
+            return ::testing::AssertionFailure() << party_id << ", round " << round_index << ": "
+                                                 << error_stack_of(ctx_ptr);
+        }
+        iter = map_id_queue[party_id].erase(iter);
+        if (ctx_ptr->IsCurRoundFinished()) {
+            return send_messages(ctx_ptr, party_id, map_id_queue);
+        }
+    }
+    return ::testing::AssertionFailure() << party_id << ", round " << round_index << ": messages missing";
+}
+
+/**
+ * Refresh the auxiliary information of several wallets held by the same parties in one batch.
+ * @param wallet_key_arr wallet_key_arr[k][i] is the minimal sign key of party i in wallet k.
+ */
+void testBatchKeyRefresh(const vector<vector<string>> &wallet_key_arr){
+    const size_t wallet_num = wallet_key_arr.size();
+    std::map<std::string, std::vector<Msg>> map_id_message_queue;
+
+    vector<vector<Context>> party_ctx_arr(PARTY_NUM, vector<Context>(wallet_num, Context(PARTY_NUM)));
+    vector<BatchMPCContext *> batch_ctx_arr;
+    vector<string> party_id_arr;
+    for (int i = 0; i < PARTY_NUM; ++i) {
+        // One set of auxiliary parameters per party, shared by all the wallets in the batch.
+        BN N, s, t, p, q, alpha, beta;
+        safeheron::zkp::dln_proof::GenerateN_tilde(N, s, t, p, q, alpha, beta);
+
+        vector<MPCContext *> ctx_arr;
+        for (size_t k = 0; k < wallet_num; ++k) {
+            MinimalSignKey minimal_sign_key;
+            ASSERT_TRUE(minimal_sign_key.FromBase64(wallet_key_arr[k][i]));
+            ASSERT_TRUE(Context::CreateContext(party_ctx_arr[i][k], minimal_sign_key, "ssid",
+                                               N, s, t, p, q, alpha, beta));
+            ctx_arr.push_back(&party_ctx_arr[i][k]);
+        }
+        batch_ctx_arr.push_back(new BatchMPCContext(ctx_arr));
+        party_id_arr.push_back(party_ctx_arr[i][0].sign_key_.local_party_.party_id_);
+    }
+
+    // round 0 ~ 3
+    for (int round = 0; round <= 3; ++round) {
+        for (int i = 0; i < PARTY_NUM; ++i) {
+            ASSERT_TRUE(run_round(batch_ctx_arr[i], party_id_arr[i], round, map_id_message_queue));
+        }
+    }
+
+    for (int i = 0; i < PARTY_NUM; ++i) {
+        EXPECT_TRUE(batch_ctx_arr[i]->IsFinished());
+        const Context &first_ctx = party_ctx_arr[i][0];
+        for (size_t k = 0; k < wallet_num; ++k) {
+            MinimalSignKey old_sign_key;
+            ASSERT_TRUE(old_sign_key.FromBase64(wallet_key_arr[k][i]));
+            const Context &ctx = party_ctx_arr[i][k];
+            EXPECT_TRUE(ctx.sign_key_.ValidityTest());
+            EXPECT_TRUE(ctx.sign_key_.X_ == old_sign_key.X_);
+            EXPECT_TRUE(ctx.sign_key_.local_party_.x_ != old_sign_key.local_party_.x_);
+            EXPECT_TRUE(ctx.sign_key_.local_party_.N_ == first_ctx.sign_key_.local_party_.N_);
+            // The wallets are distinct
+            if (k > 0) EXPECT_TRUE(ctx.sign_key_.X_ != first_ctx.sign_key_.X_);
+        }
+        delete batch_ctx_arr[i];
+    }
+}
+
+TEST(CoSignKey, BatchKeyRefresh)
+{
+    // One wallet per curve, all held by the same 3 parties.
+    vector<vector<string>> wallet_key_arr = {
+            //SECP256k1 sign key
+            {
+                    "EAMYAyLkAQoKY29fc2lnbmVyMRICMDEaQDI0ODlEMEU2QjY3RkVGNjVFN0U0NUZEQjI0Q0E5ODRFOURGQkMxNzMxREYwNzgzNjY4OTFDMjEwMEQ2N0I5OTUijwEKQDEwNzJEQjIzOTE5RDY1QjU3NERCOEQ5NjlEN0E2RUZDRjdENDRERTUxQTNDQkE2MzEwMDQxQjRBMTI3OUM2RDUSQEVGREEzRDEzMThFNUMyRUEyMjFCRDA3NDUwOUM1RjEyOUVCRUM4NEFDODBEREY1NEM2QzNGOUExRTA3Njc3MzcaCXNlY3AyNTZrMSqiAQoKY29fc2lnbmVyMhICMDIijwEKQDExRDc2MUREREI1NDBDMjRCOEJFNjA1RjNFRTE1QTdGNzc2RkYxQTNDODY1NUVCMzg1QzhDRTA2QkE3QjNCMTESQDI2QzMwN0U4NjU0QTFDQkU1QTcxRjhENERGNkUxRDNDQjdBQ0Y4NTFGOUJDRDQ1MEMyQTY1NTc3NjY1NjEzNDgaCXNlY3AyNTZrMSqiAQoKY29fc2lnbmVyMxICMDMijwEKQDRFNTE5MkE1QjI4RUMzMjcxQjcxQzEzMEM3MTRBM0NDQjk4NTU2ODk4REJCQjk1NTRCRDhEQ0M2N0QyQTdBQzQSQDY2RjBEREMxNEMyRkY4MTE2Mzk0Q0NERkFDM0MyNkExODM0RjFGRDcyQzUxN0Q5MkNERDUxQUU4OUQ5NjE5OTAaCXNlY3AyNTZrMTKPAQpAMUVERjNCRkRGMUMzN0Y1N0NENTI2RjJENDdGNzkwMkIzRTY1MDlFRkJDNzkxRTc3NTQ2QzhEQThFNzdCRjRENxJANUIxMDhGNzlDOTgyRDcwRDkwRjgxMUFGMDJENzAzRjNFRTM4OUY4M0M0MzVEOTVCMDA4MzIyN0IxQjg3Q0YyNxoJc2VjcDI1Nmsx",
+                    "EAMYAyLkAQoKY29fc2lnbmVyMhICMDIaQEU3MjY3RTU0MkQ0NjY4ODdEM0M4RUZGMjdCQjUzODExOUM2MENCQ0IzRDZDRUY5RjBGQ0RFOEZBQzM1RTU5NjIijwEKQDExRDc2MUREREI1NDBDMjRCOEJFNjA1RjNFRTE1QTdGNzc2RkYxQTNDODY1NUVCMzg1QzhDRTA2QkE3QjNCMTESQDI2QzMwN0U4NjU0QTFDQkU1QTcxRjhENERGNkUxRDNDQjdBQ0Y4NTFGOUJDRDQ1MEMyQTY1NTc3NjY1NjEzNDgaCXNlY3AyNTZrMSqiAQoKY29fc2lnbmVyMRICMDEijwEKQDEwNzJEQjIzOTE5RDY1QjU3NERCOEQ5NjlEN0E2RUZDRjdENDRERTUxQTNDQkE2MzEwMDQxQjRBMTI3OUM2RDUSQEVGREEzRDEzMThFNUMyRUEyMjFCRDA3NDUwOUM1RjEyOUVCRUM4NEFDODBEREY1NEM2QzNGOUExRTA3Njc3MzcaCXNlY3AyNTZrMSqiAQoKY29fc2lnbmVyMxICMDMijwEKQDRFNTE5MkE1QjI4RUMzMjcxQjcxQzEzMEM3MTRBM0NDQjk4NTU2ODk4REJCQjk1NTRCRDhEQ0M2N0QyQTdBQzQSQDY2RjBEREMxNEMyRkY4MTE2Mzk0Q0NERkFDM0MyNkExODM0RjFGRDcyQzUxN0Q5MkNERDUxQUU4OUQ5NjE5OTAaCXNlY3AyNTZrMTKPAQpAMUVERjNCRkRGMUMzN0Y1N0NENTI2RjJENDdGNzkwMkIzRTY1MDlFRkJDNzkxRTc3NTQ2QzhEQThFNzdCRjRENxJANUIxMDhGNzlDOTgyRDcwRDkwRjgxMUFGMDJENzAzRjNFRTM4OUY4M0M0MzVEOTVCMDA4MzIyN0IxQjg3Q0YyNxoJc2VjcDI1Nmsx",
+                    "EAMYAyLkAQoKY29fc2lnbmVyMxICMDMaQEY3NjhEODAwMDFENTY0MTk1RjM1Q0IxQkExODZBQ0E4MTM2NDUzMzQ0QzQ1RTdBNEU2MDkxRERBQTM5OTkwRjIijwEKQDRFNTE5MkE1QjI4RUMzMjcxQjcxQzEzMEM3MTRBM0NDQjk4NTU2ODk4REJCQjk1NTRCRDhEQ0M2N0QyQTdBQzQSQDY2RjBEREMxNEMyRkY4MTE2Mzk0Q0NERkFDM0MyNkExODM0RjFGRDcyQzUxN0Q5MkNERDUxQUU4OUQ5NjE5OTAaCXNlY3AyNTZrMSqiAQoKY29fc2lnbmVyMRICMDEijwEKQDEwNzJEQjIzOTE5RDY1QjU3NERCOEQ5NjlEN0E2RUZDRjdENDRERTUxQTNDQkE2MzEwMDQxQjRBMTI3OUM2RDUSQEVGREEzRDEzMThFNUMyRUEyMjFCRDA3NDUwOUM1RjEyOUVCRUM4NEFDODBEREY1NEM2QzNGOUExRTA3Njc3MzcaCXNlY3AyNTZrMSqiAQoKY29fc2lnbmVyMhICMDIijwEKQDExRDc2MUREREI1NDBDMjRCOEJFNjA1RjNFRTE1QTdGNzc2RkYxQTNDODY1NUVCMzg1QzhDRTA2QkE3QjNCMTESQDI2QzMwN0U4NjU0QTFDQkU1QTcxRjhENERGNkUxRDNDQjdBQ0Y4NTFGOUJDRDQ1MEMyQTY1NTc3NjY1NjEzNDgaCXNlY3AyNTZrMTKPAQpAMUVERjNCRkRGMUMzN0Y1N0NENTI2RjJENDdGNzkwMkIzRTY1MDlFRkJDNzkxRTc3NTQ2QzhEQThFNzdCRjRENxJANUIxMDhGNzlDOTgyRDcwRDkwRjgxMUFGMDJENzAzRjNFRTM4OUY4M0M0MzVEOTVCMDA4MzIyN0IxQjg3Q0YyNxoJc2VjcDI1Nmsx"
+            },
+            //P256 sign key
+            {
+                    "EAMYAyLfAQoKY29fc2lnbmVyMRICMDEaQDA1MENCRDlENUUyNkFCNTkzQUEwRDI3RDM4NEM0MDMzMEI2QzJFMTU0NzhCOEQwNjIxRERERUE4NTNBRkMyMkEiigEKQDg0RjM2M0RGRDg5RTQ0MDczMTcyN0Y4NzM3QzA1OEYzQTE5QTZERDNGNjlENDA1RDU2QjFGN0Y2MERDMDNEQzQSQDZCQzRDRTUzQ0JGMzQzQzA2QkMwMjFFQUU1MEJFRUM4NEI5MDIxNzc0MUM5NTA5RDZDNzA1RkE2ODBBRkNGNDcaBHAyNTYqnQEKCmNvX3NpZ25lcjISAjAyIooBCkAxRUNDRTg3MjhGRjYzMzQyQTNFMDI5MDY5MUEzNTM2MDQ0RkZBNDNBOTFDRERCQjhBRUVGOURGMDg3MzlENkI1EkA5QjJEODUzOEFCNEQxNjBCRTQ1M0I4QjBGQ0VFODZBRTBDQzkxOTk5QkI2MjY0MUUwNzIwQTQyMEMxMTIyRjg5GgRwMjU2Kp0BCgpjb19zaWduZXIzEgIwMyKKAQpANzg0OTY0MEZCQjdGODlFNDNCMjBENzAzNDI4RjQyMkEyNjAyNTYzODZBQUU2OUNBMjc0NDNDNTdBQTUxNUUyRhJANkM0NDg1OEI1QzVCRDhDMzcwNjY4QjA3RTg0NURCMTZDNEJCOEJEQjUyQTI5QTJBODYzQTI2QkNEQzYzQzc4NxoEcDI1NjKKAQpAQzg4OUVFRDBCMkQzQjdGQTU0MjBBMjUyRTk1RThCNjYyQTgzRjAyQ0JENTQwMDMzRTdBRjI0QUE5NUQxOUY3MhJAQjk3MTIxNzIxNDQzMTg1QTUyNEY1RDFGNTk5RUY5MUQ0QzQxQTRFN0RDMzFBMjc5QzI1QjRBOEJGODU5MTc0NRoEcDI1Ng..",
+                    "EAMYAyLfAQoKY29fc2lnbmVyMhICMDIaQDg1NjRCODk0NERCOUFBMDY3OUYyQjRBNzY4RkFDMUY3OUM4MUNCMzU3NTE4RTM0Nzk0NUYyNTgzRUIxMzBDQzciigEKQDFFQ0NFODcyOEZGNjMzNDJBM0UwMjkwNjkxQTM1MzYwNDRGRkE0M0E5MUNEREJCOEFFRUY5REYwODczOUQ2QjUSQDlCMkQ4NTM4QUI0RDE2MEJFNDUzQjhCMEZDRUU4NkFFMENDOTE5OTlCQjYyNjQxRTA3MjBBNDIwQzExMjJGODkaBHAyNTYqnQEKCmNvX3NpZ25lcjESAjAxIooBCkA4NEYzNjNERkQ4OUU0NDA3MzE3MjdGODczN0MwNThGM0ExOUE2REQzRjY5RDQwNUQ1NkIxRjdGNjBEQzAzREM0EkA2QkM0Q0U1M0NCRjM0M0MwNkJDMDIxRUFFNTBCRUVDODRCOTAyMTc3NDFDOTUwOUQ2QzcwNUZBNjgwQUZDRjQ3GgRwMjU2Kp0BCgpjb19zaWduZXIzEgIwMyKKAQpANzg0OTY0MEZCQjdGODlFNDNCMjBENzAzNDI4RjQyMkEyNjAyNTYzODZBQUU2OUNBMjc0NDNDNTdBQTUxNUUyRhJANkM0NDg1OEI1QzVCRDhDMzcwNjY4QjA3RTg0NURCMTZDNEJCOEJEQjUyQTI5QTJBODYzQTI2QkNEQzYzQzc4NxoEcDI1NjKKAQpAQzg4OUVFRDBCMkQzQjdGQTU0MjBBMjUyRTk1RThCNjYyQTgzRjAyQ0JENTQwMDMzRTdBRjI0QUE5NUQxOUY3MhJAQjk3MTIxNzIxNDQzMTg1QTUyNEY1RDFGNTk5RUY5MUQ0QzQxQTRFN0RDMzFBMjc5QzI1QjRBOEJGODU5MTc0NRoEcDI1Ng..",
+                    "EAMYAyLfAQoKY29fc2lnbmVyMxICMDMaQEIzMjFGODA1QzI4NDkwRTA3REIwQTdEQUVERjQxQjRFQTBCMTkxMEM4NEJBMDY1RDdCNEI1OEVFMTI2RTQ5MDUiigEKQDc4NDk2NDBGQkI3Rjg5RTQzQjIwRDcwMzQyOEY0MjJBMjYwMjU2Mzg2QUFFNjlDQTI3NDQzQzU3QUE1MTVFMkYSQDZDNDQ4NThCNUM1QkQ4QzM3MDY2OEIwN0U4NDVEQjE2QzRCQjhCREI1MkEyOUEyQTg2M0EyNkJDREM2M0M3ODcaBHAyNTYqnQEKCmNvX3NpZ25lcjESAjAxIooBCkA4NEYzNjNERkQ4OUU0NDA3MzE3MjdGODczN0MwNThGM0ExOUE2REQzRjY5RDQwNUQ1NkIxRjdGNjBEQzAzREM0EkA2QkM0Q0U1M0NCRjM0M0MwNkJDMDIxRUFFNTBCRUVDODRCOTAyMTc3NDFDOTUwOUQ2QzcwNUZBNjgwQUZDRjQ3GgRwMjU2Kp0BCgpjb19zaWduZXIyEgIwMiKKAQpAMUVDQ0U4NzI4RkY2MzM0MkEzRTAyOTA2OTFBMzUzNjA0NEZGQTQzQTkxQ0REQkI4QUVFRjlERjA4NzM5RDZCNRJAOUIyRDg1MzhBQjREMTYwQkU0NTNCOEIwRkNFRTg2QUUwQ0M5MTk5OUJCNjI2NDFFMDcyMEE0MjBDMTEyMkY4ORoEcDI1NjKKAQpAQzg4OUVFRDBCMkQzQjdGQTU0MjBBMjUyRTk1RThCNjYyQTgzRjAyQ0JENTQwMDMzRTdBRjI0QUE5NUQxOUY3MhJAQjk3MTIxNzIxNDQzMTg1QTUyNEY1RDFGNTk5RUY5MUQ0QzQxQTRFN0RDMzFBMjc5QzI1QjRBOEJGODU5MTc0NRoEcDI1Ng.."
+            },
+    };
+#ifdef TEST_STARK_CURVE
+    //STARK sign key
+    wallet_key_arr.push_back({
+            "EAMYAyLgAQoKY29fc2lnbmVyMRICMDEaQDA1RDk2OUE1ODM4NTA2MTdFN0FDNTVBRTQ2MkYwNTlCMkQ1MTdDNDM2OUYyQzZCM0I5REVFRTIwRjY0NDUxRjgiiwEKQDAyMjZBRjNFMjczQzc4RUE3QUMwQzQxN0NGMzhGQTBFOEIyOEU2NUZGQkUyQ0Q0OEI3NDM1NjY4MjVBRkNCNEYSQDA2M0RCNzdCRTJEMUQ5OTcwNkMyNDQ0ODM5QzM1QzBFMjBEOTJBNEEyMzIwOTlEOTlDMTQ0QTVDNUU3MzM5MjYaBXN0YXJrKpwBCgpjb19zaWduZXIyEgIwMiKJAQpAMDU3RUFBQTE1OEE2MEY3OTcyM0Q3QjhFNDI3QThGRDJDMzZCQ0E0Q0MyODg2Mzk0RjE0RDFDRTc1MjVDN0NDORI-ODIwOUMxQkYxRUUzMzM1QjA1QjZCQUU0Mzg1ODcwOThFM0VEQkU3MzFBRUQxNjQzMjk0OEM5REQ3OTNFMUYaBXN0YXJrKp4BCgpjb19zaWduZXIzEgIwMyKLAQpAMDczRjk2MEY3RUQxRjQwRDE0RUZBNTJFOUNGREQwQjY1QjM2QThCNDM0ODgwNTIzNzU4RDMwRjQ5QjJDNTFFMhJAMDRFREJDMDM1OUExQzkxRTJFQTYyRDhGNEZFOTQ5NDM5OUI3MjM5MDg4MjhFNzcxRDhENzBCRjk5QUY3NjdFMhoFc3RhcmsyiwEKQDA1REUxRERDRTkxMEMwQThGRTg3RDhBOTU5NTE4NkVDOTBGOUUxNDQ2QjkyMDI5QzJEMDFENzIzNDI2RDRBQjcSQDA3MTE2RDRDMTQ3MTU5MTYzOThCQUE0NjlDOTJGODc0MzZGNUExQjBEMDUzRENFN0FFNzJGMzY4N0U2NTYxMUQaBXN0YXJr",
+            "EAMYAyLeAQoKY29fc2lnbmVyMhICMDIaQDAxODk2RUVEMjE4NjA2QzFEMEY1RDZEMTU2RUM1RjUzNTMxMjEyMDA5RDA1MTNFNTlGNzlEMTE3ODIzNTYxOUEiiQEKQDA1N0VBQUExNThBNjBGNzk3MjNEN0I4RTQyN0E4RkQyQzM2QkNBNENDMjg4NjM5NEYxNEQxQ0U3NTI1QzdDQzkSPjgyMDlDMUJGMUVFMzMzNUIwNUI2QkFFNDM4NTg3MDk4RTNFREJFNzMxQUVEMTY0MzI5NDhDOURENzkzRTFGGgVzdGFyayqeAQoKY29fc2lnbmVyMRICMDEiiwEKQDAyMjZBRjNFMjczQzc4RUE3QUMwQzQxN0NGMzhGQTBFOEIyOEU2NUZGQkUyQ0Q0OEI3NDM1NjY4MjVBRkNCNEYSQDA2M0RCNzdCRTJEMUQ5OTcwNkMyNDQ0ODM5QzM1QzBFMjBEOTJBNEEyMzIwOTlEOTlDMTQ0QTVDNUU3MzM5MjYaBXN0YXJrKp4BCgpjb19zaWduZXIzEgIwMyKLAQpAMDczRjk2MEY3RUQxRjQwRDE0RUZBNTJFOUNGREQwQjY1QjM2QThCNDM0ODgwNTIzNzU4RDMwRjQ5QjJDNTFFMhJAMDRFREJDMDM1OUExQzkxRTJFQTYyRDhGNEZFOTQ5NDM5OUI3MjM5MDg4MjhFNzcxRDhENzBCRjk5QUY3NjdFMhoFc3RhcmsyiwEKQDA1REUxRERDRTkxMEMwQThGRTg3RDhBOTU5NTE4NkVDOTBGOUUxNDQ2QjkyMDI5QzJEMDFENzIzNDI2RDRBQjcSQDA3MTE2RDRDMTQ3MTU5MTYzOThCQUE0NjlDOTJGODc0MzZGNUExQjBEMDUzRENFN0FFNzJGMzY4N0U2NTYxMUQaBXN0YXJr",
+            "EAMYAyLgAQoKY29fc2lnbmVyMxICMDMaQDA0RTJGQ0QxRUQ4OUY5RjhEODNBOUZDOEI5RjlGQkNENUNDNUU4RkIyM0ZBQTdCOEQzNUQ5M0QyRjY2NkI3NEUiiwEKQDA3M0Y5NjBGN0VEMUY0MEQxNEVGQTUyRTlDRkREMEI2NUIzNkE4QjQzNDg4MDUyMzc1OEQzMEY0OUIyQzUxRTISQDA0RURCQzAzNTlBMUM5MUUyRUE2MkQ4RjRGRTk0OTQzOTlCNzIzOTA4ODI4RTc3MUQ4RDcwQkY5OUFGNzY3RTIaBXN0YXJrKp4BCgpjb19zaWduZXIxEgIwMSKLAQpAMDIyNkFGM0UyNzNDNzhFQTdBQzBDNDE3Q0YzOEZBMEU4QjI4RTY1RkZCRTJDRDQ4Qjc0MzU2NjgyNUFGQ0I0RhJAMDYzREI3N0JFMkQxRDk5NzA2QzI0NDQ4MzlDMzVDMEUyMEQ5MkE0QTIzMjA5OUQ5OUMxNDRBNUM1RTczMzkyNhoFc3RhcmsqnAEKCmNvX3NpZ25lcjISAjAyIokBCkAwNTdFQUFBMTU4QTYwRjc5NzIzRDdCOEU0MjdBOEZEMkMzNkJDQTRDQzI4ODYzOTRGMTREMUNFNzUyNUM3Q0M5Ej44MjA5QzFCRjFFRTMzMzVCMDVCNkJBRTQzODU4NzA5OEUzRURCRTczMUFFRDE2NDMyOTQ4QzlERDc5M0UxRhoFc3RhcmsyiwEKQDA1REUxRERDRTkxMEMwQThGRTg3RDhBOTU5NTE4NkVDOTBGOUUxNDQ2QjkyMDI5QzJEMDFENzIzNDI2RDRBQjcSQDA3MTE2RDRDMTQ3MTU5MTYzOThCQUE0NjlDOTJGODc0MzZGNUExQjBEMDUzRENFN0FFNzJGMzY4N0U2NTYxMUQaBXN0YXJr"
+    });
+#endif
+    testBatchKeyRefresh(wallet_key_arr);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
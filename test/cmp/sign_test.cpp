@@ -1,5 +1,6 @@
 
 #include <cstring>
+#include <memory>
 #include <vector>
 #include <google/protobuf/stubs/common.h>
 #include "crypto-suites/exception/located_exception.h"
@@ -18,6 +19,7 @@ using safeheron::multi_party_ecdsa::cmp::sign::Context;
 using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
 using safeheron::multi_party_ecdsa::cmp::sign::ProofInPreSignPhase;
 using safeheron::multi_party_ecdsa::cmp::sign::ProofInSignPhase;
+using safeheron::mpc_flow::common::PartyMatrix;
 
 void print_context_stack_if_failed(Context *ctx_ptr, bool failed){
     if(failed){
@@ -154,6 +156,8 @@ void testCoSign_n_n(std::vector<std::string> &sign_key_base64){
         std::map<std::string, ProofInPreSignPhase> map_proof;
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> all_D;
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> all_F;
+        // Build and verify proofs with 2 threads and no time budget
+        co_signer1_context.SetIdentificationOptions(2, 0);
         co_signer1_context.BuildProofInPreSignPhase();
         co_signer2_context.BuildProofInPreSignPhase();
         co_signer3_context.BuildProofInPreSignPhase();
@@ -166,6 +170,28 @@ void testCoSign_n_n(std::vector<std::string> &sign_key_base64){
         std::cout << "Verify proof_in_pre_sign_phase: " << co_signer1_context.VerifyProof(map_proof, all_D, all_F) << std::endl;
         std::cout << "Verify proof_in_pre_sign_phase: " << co_signer2_context.VerifyProof(map_proof, all_D, all_F) << std::endl;
         std::cout << "Verify proof_in_pre_sign_phase: " << co_signer3_context.VerifyProof(map_proof, all_D, all_F) << std::endl;
+        // Same with the dense API
+        PartyMatrix<BN> D_matrix;
+        PartyMatrix<BN> F_matrix;
+        co_signer1_context.ExportDF(D_matrix, F_matrix);
+        co_signer2_context.ExportDF(D_matrix, F_matrix);
+        co_signer3_context.ExportDF(D_matrix, F_matrix);
+        EXPECT_TRUE(co_signer1_context.VerifyProof(map_proof, D_matrix, F_matrix));
+        // A tampered proof blames the same party in order and in parallel
+        std::map<std::string, ProofInPreSignPhase> tampered_map_proof = map_proof;
+        const string &tampered_party_id = co_signer2_context.sign_key_.local_party_.party_id_;
+        tampered_map_proof[tampered_party_id].c_k_gamma_ = tampered_map_proof[tampered_party_id].c_k_gamma_ + 1;
+        co_signer2_context.SetIdentificationOptions(1, 0);
+        co_signer3_context.SetIdentificationOptions(4, 0);
+        EXPECT_FALSE(co_signer2_context.VerifyProof(tampered_map_proof, all_D, all_F));
+        EXPECT_FALSE(co_signer3_context.VerifyProof(tampered_map_proof, all_D, all_F));
+        EXPECT_EQ(co_signer2_context.IdentifyCulprit(), tampered_party_id);
+        EXPECT_EQ(co_signer3_context.IdentifyCulprit(), co_signer2_context.IdentifyCulprit());
+        // A proof takes longer than 1 ms, so the loop stops before all the proofs are verified, blaming nobody
+        co_signer1_context.SetIdentificationOptions(1, 1);
+        EXPECT_FALSE(co_signer1_context.VerifyProof(map_proof, all_D, all_F));
+        EXPECT_TRUE(co_signer1_context.IdentifyCulprit().empty());
+        co_signer1_context.SetIdentificationOptions(2, 0);
 
         // Figure 8 ( ECDSA Signing)
         // Verify the signature, In case of failure do:
@@ -188,6 +214,13 @@ void testCoSign_n_n(std::vector<std::string> &sign_key_base64){
         std::cout << "identify_culprit : " << co_signer2_context.IdentifyCulprit() << std::endl;
         std::cout << "Verify proof_in_sign_phase: " << co_signer3_context.VerifyProof(map_proof_2, all_D_hat, all_F_hat) << std::endl;
         std::cout << "identify_culprit : " << co_signer3_context.IdentifyCulprit() << std::endl;
+        // Same with the dense API
+        PartyMatrix<BN> D_hat_matrix;
+        PartyMatrix<BN> F_hat_matrix;
+        co_signer1_context.ExportD_hat_F_hat(D_hat_matrix, F_hat_matrix);
+        co_signer2_context.ExportD_hat_F_hat(D_hat_matrix, F_hat_matrix);
+        co_signer3_context.ExportD_hat_F_hat(D_hat_matrix, F_hat_matrix);
+        EXPECT_TRUE(co_signer1_context.VerifyProof(map_proof_2, D_hat_matrix, F_hat_matrix));
 
     }catch (const safeheron::exception::LocatedException &e) {
         std::cout << e.what() << std::endl;
@@ -262,6 +295,67 @@ void testCoSign_t_n(std::vector<std::string> &sign_key_base64){
     }
 }
 
+void testCoSign_t_n_view(const std::vector<std::string> &sign_key_base64){
+    using safeheron::multi_party_ecdsa::cmp::SignKey;
+    using safeheron::multi_party_ecdsa::cmp::sign::SignKeyView;
+    using safeheron::multi_party_ecdsa::cmp::sign::SignKeyViewCache;
+    bool ok = true;
+
+    std::map<std::string, std::vector<Msg>> map_id_message_queue;
+
+    std::vector<std::unique_ptr<SignKeyViewCache>> cache_arr;
+    for (int i = 0; i < 3; ++i) {
+        SignKey sign_key;
+        ok = sign_key.FromBase64(sign_key_base64[i]);
+        ASSERT_TRUE(ok);
+        cache_arr.emplace_back(new SignKeyViewCache(sign_key));
+    }
+
+    // Fewer participants than the threshold
+    EXPECT_TRUE(cache_arr[0]->Get({"co_signer1", "co_signer2"}) == nullptr);
+
+    // The order of the participants does not matter
+    std::vector<string> participant_id_arr = {"co_signer3", "co_signer1", "co_signer2"};
+    std::shared_ptr<const SignKeyView> view = cache_arr[0]->Get(participant_id_arr);
+    ASSERT_TRUE(view != nullptr);
+    EXPECT_EQ(view, cache_arr[0]->Get({"co_signer1", "co_signer2", "co_signer3"}));
+    EXPECT_EQ(cache_arr[0]->Size(), (size_t)1);
+    EXPECT_EQ(view->sign_key_.n_parties_, (uint32_t)3);
+
+    // Same shards as trim_sign_key() followed by CreateContext()
+    string t_sign_key_base64;
+    ok = safeheron::multi_party_ecdsa::cmp::trim_sign_key(t_sign_key_base64, sign_key_base64[0], participant_id_arr);
+    EXPECT_TRUE(ok);
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    string ssid("ssid");
+    Context ref_context(3);
+    ok = Context::CreateContext(ref_context, t_sign_key_base64, m, ssid);
+    EXPECT_TRUE(ok);
+
+    Context co_signer1_context(3);
+    Context co_signer2_context(3);
+    Context co_signer3_context(3);
+    vector<Context *> ctx_arr = {&co_signer1_context, &co_signer2_context, &co_signer3_context};
+    for (int i = 0; i < 3; ++i) {
+        view = cache_arr[i]->Get(participant_id_arr);
+        ASSERT_TRUE(view != nullptr);
+        ok = Context::CreateContext(*ctx_arr[i], *view, m, ssid);
+        EXPECT_TRUE(ok);
+    }
+    EXPECT_TRUE(co_signer1_context.sign_key_.local_party_.x_ == ref_context.sign_key_.local_party_.x_);
+    EXPECT_EQ(co_signer1_context.ssid_, ref_context.ssid_);
+
+    for (int round = 0; round <= 4; ++round) {
+        for (int i = 0; i < 3; ++i) {
+            run_round(ctx_arr[i], ctx_arr[i]->sign_key_.local_party_.party_id_, round, map_id_message_queue);
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(ctx_arr[i]->IsFinished());
+        EXPECT_TRUE(ctx_arr[i]->s_ == ctx_arr[0]->s_);
+    }
+}
+
 TEST(CoSign, Sign_n_n)
 {
     for(int i = 0; i < 1; ++i){
@@ -311,6 +405,7 @@ TEST(CoSign, Sign_t_n)
                 "EAMYBSKMGwoKY29fc2lnbmVyNBICMDQaQDM1OTVCMkVBQTA1MkE1NENBN0Q4QTdDN0RBMTkxMzc1NzA4ODA3RjJCMUUxMTdBQjBEMzc5QUY0QUZBRjlCMEEijwEKQEQ2QUU2MEJGQkM1OTdCRjQ5QkUyMDg5MDRGN0UxMjZBMkZCN0M4OTk0OUFFRjFGOTcwQjRDQkU5OTNFM0JDQjUSQDJBRTU4QzEyOUMxMUFFOTU3QTZCNUI3MTExODkwOEZEMkUzNTE3MzI0ODAxQzZDNzlGNkZCODQ5QjI1NzJCMUIaCXNlY3AyNTZrMSqPAQpAREM3MDdDNEUwMkMxODU0NTgzRTE2NTJBNDA1MEY3NDgzQzIzMEY3MTA2RTdCMjZGNEQ4ODNDQTM5Q0NGQTM3OBJAMjcwREU1NzY1Nzc5ODM1RDBDNUMxNDc4MEE2QzU2ODQ1QTk5MUU0RjJDNzIyQTFEN0MyNTlFQUYxOTg5NEI2MxoJc2VjcDI1NmsxUoAERjg5RTZFNTZFMjI1QTBGRDAzMjJGRTgwNzlDOTJGODM3ODZDRkYxNDE1RTRGNjNCMzQ3ODRDMDZFMzk2M0Q5NjRBRjdENkQ4Nzk2Rjk1QUM4NTU0MUFEQjAzRkY3ODlFOTUzQ0I0N0NBQTlCQjgwODIxMThFRkEyRDJEMjRDM0I1MTkzNjM4MTFFMDYzRTRGQTcwMzc0NzA5QkE2MjQ1OEIyNkEyRUY3RTQ2OTEwMzQ2MEQwRTBGNEVCRjg4QUVCN0ExRDg0MzEwRENCOUY3QzcyNzBERURDRkQ2ODk4MzlGRTU0QjJGMjA2MDMzRTUyN0VFRDVCNjA2NzMzNkZFMkRFNjA0NEVDQUFBRTE4OUYwMEZCRDg0RTIwRjUwNkYwMUI2RUQ0M0ZGRUQwNTQ3M0IwNzJFMkZGNTA2MjI3RTRGQTEzOUY1NzY2NERBMUQ3MTdDRjIzNjZEODZERTVCMzBFQ0IzOUIzMDYxMjg4RkRBODRBNTlBN0U4MjY1MEZCNDgzOEI0NjA4NzRGNjQwQjdDOThBM0VCOTgwRUVFODI0MUUyMTFFOUUyNTkxRkE4M0QwNkQyNDQ1NDc2MjUzNkY5N0IxMTk2MUQ1Njg3OUE1RjExMjgxRTAzN0Q3NjNCMDdBNjVBNjMyNTgwMDc5NTlFMEExM0NCMjQyOTM3RDlagAQwOEU2MjEyNThDQ0M4MDVCMjRBQ0Q5RjA5QjBFRTIxQzQ0NEJGMUY3MzIyODVCNEI4REQ0MDI4REY4QjFENDQ5MTkxNDUzQzlENUY3RjExQkMzM0M5ODVGM0NDRDcwMzdBNTAzNzREMTBGOUJGRkNGQTNFQzM5NDY4NEU4NkE2MkNGNzczOUYzRTVGMDdCMDI4MDI1MDg0RjFCODdERUY5NEEzRkE0ODA0OUM3QTQyNEY4MjdFMzBCODlDREY2M0I1REQ0NzFDOEE2MjVENzlBQjRGMzUwQTZCMzUwRTNFNEMwM0I5M0RDQjE4RERBQjREQTdEMjgwMDkwMTMzMzdENTk5NEU5MDE5MTE2ODRBOTEwMUM1M0JERTg1QkE2Q0VEMkIyRTEzMDI0NDU4QjRDOTY1RTBDQjRGNjcyNDJGNTNDRUNCNjlGRTI0NjE3MUE3OEU0OUY3ODgyRTczNzJGQjA0MEM1QzZFNTlDRkQyNkE4MjMxOEYwQ0JGNkJDOUFGMDA2QjMxNDRFRjkyMDgyNjU5QTEwM0E2QTJCM0NFM0Q3RjBBMzBFOThBQjUwMDc5NUI0NTRDMTcwRDk2OEY2RTJFMzRENzkyQTU2MjkwOTZFMUMwRkREMjM5NEE4NEJEMzE4MTMzODc3QUM2MjNFNkNGQjBBMzdGNEVFQzdEN2KABDBFRUM2RTZGQkY2NzhEREZFNzBDMDE2OUI2Nzg3RDhFOTA1N0M1MEVFMTBEQTRGMjM2MDg2MEE3MDg4Rjg2RTMyMEU2ODNERkE1RDc2MEM1Njg3QkY3MUUzQjRCMzY3QzJCN0E0MjkyQTYzQ0YxMEQ0Q0UyODkwNERBNDFCMDZGOEUyNzA2REU3REY0N0FBOEM4OTYwN0U3OTE3MjQ1NTNBOUIxRjU3OUZGQTBDRjI5QjZFNDU3NTIyQjY0OTczMDFEMkY3OTE5QTI5NTU0NTExOTE4ODVBQzVBNjk4RjcwQTAyNTI5NEMzREQ5RDRFNTE0OUY2N0RBNUMxNTA1RUUyMUE4MTg0MDYzQjlCQzIwNjczQzc3QjcyREE5QkMyRUYyQzdEMDJGQ0I2RTAwRkE4N0ZFM0Q3Njc2RDA5RTZERDk5RDVCODNGQkRGNTJDNDJCQjZGNTY3Qzg0NTdBMDQ3ODA2Mjc4REZDQzY5MDEyQzEyRTMwNEFFRjc4OTQyQzMxQTU4MzIzM0IyMkQ0OEUxODhFQzZGMDJGRjc1M0FFMjQ1MTAwRTgxQjMzOEVDMzkxQUMyNzgzMTk2MENEMEUyMEIxODUyRDhFN0FEQjg0NEU2MUMwNEIxQzMzRTc0MkNEQjMzMEQwNDE5RUEzQkQ5OTY3M0NFQjU3NkQwMzREaoACRkZGNDRBQ0Q5NDhFOUNBREQxNTAzOTNGNDlFRkQwRURBQkRGRDJGNDE0RjcwNUQ2RUMyMEU0QzlFQjczRUJFRTg1OUQwMDc5MERFNDNBQzcyMzRFMjQ3MDMwMURFOUZCRjE0Njg4MEU2MTlCNjdCNTVFRTk2OUQ4MEYyNUQyNUE1NzRGMEEyQzgzRDExMDU1MTZDNjVFMTdFOTBCMTFEOTU1OEJBRUFGRUM0NkM4MDRDMzY5MTBDNjYwMkYxNzlCQjZCRTg0NUIxQjYwMTAxNkZDNkQwRTM3RjY4MTNDNzdBNTAxMTZERkZFRjI4MTA0QzA5MjFCM0FGQ0Q2QjNBRnKAAkY4QTlDREEzQzAxQUVGNTQ5MTE1NDM0MjMxMzEwMjVDRDZBOTM2NkUxMTA4RjU3NzM5OUFGMjc4QURGMjdFNjhCMUU0NzA1M0EzMkFEODJENkQ2QjlDRDAzN0I1RUVFMjUxRUYwNDYyQUUyMDMyMTAyNjlFOTI0MzYyNUFFMzAyNzk0NTM1OENEMkQ1MEU4NTU4QzhFREFENDZBM0EwQTI3NzEzM0YwQTA3OERBNDYyRkFFM0E3RkNCNzEwQ0UzNzVGOEYxMUEwQjRGQjc1Qzc3QzUzRUEyMUQzMkI2N0Q3MDUxQkJENTI1QjVCMEQ2OTlGREVGOUFCREEyMDQ2Rjd6gAQ2MkUwODA4NjBENDY1ODE2MjU0RkFGNzI5M0NGMDg4QjA0RjJBNUZFMTg2NDhGNTQzOURDRTlBREM4QTI0OThBM0FDRUE1RDkyQUMzNjM5OEVGMDRERDlBM0I1QUYyNEY0MUNFRkZFRDY0QjI3NURFOUE2Q0NERDcwNTI0NDk1REUyOTIyQTg4MjFGOEY2ODYyMjEwQjU2QkJFQjNGMkFCNURCMjUyQzkxOTJDQkE3NDgxMDJEQzdFMDZENTgwN0Q5MTUwREEyNTQ1RDNCNEZBQzZBQTY3OTI3NTRCNEZCODk3MzlGQTAzNkQwQzY3Njc0QjI1REY2RkI5ODZEQjlCNjlFRjQxQTkzNDBBQzMxQ0QwMjJEQjU0MDQ5MzM4RDYzODU4REY1Qzc4NjJEODlEOUYyNUFFMkVBQzk2RTM0QzE1RjU0QjM4QURDQzk0MkQzMzdENDhGQzRFOTU0MDZERjI0MjUxQTFFMEZBNTQzNkEwNjAxNkFCNEEyNzNFMjIzRTIzNzlGOTI5Qzc2Mjc4NUM0RTgyQjNGQzBFRTMzM0I5Q0Q5NEEwMDUzMzU1MUQwOTk4QkU5ODRDODExMjNDMTVDM0U3MDM2NUEwN0M5Q0U0RkM5QjY0RDEzQkE0MTk3REVGM0E2MzhEQUNENDZCREEzMzFGNDU1RkI0MTEyMIIBgAQzMzhCMUUwMzBGOEQzOUU2RDBGQ0YxRUE2ODhGRTFGODlCQzY4MkE5M0ZFMkFEODcyOEY4OTlFODkzOTkxQzA1QzFCMzhDMjE5RjJCRUNGRUMxMjNDQjA5MTRGRUQ5NkM4NUMwRUUzNTI4MDIzODlERkMxQkU1QzNFNkJBMzg4NTBBOTgzRkU2Q0RERjRBOUExRTA5QkY5ODZDODJEQ0JGQTA0QTVDOEZCOEUxOEIzQUQyMDFDRTJCMDVCNjZBNjdGRDFBNUY2NTE0ODM2NzM1NEYzRkVDRTlENzAwRkNCQTQzQUYzQjI2NTA5RjA1MUYwQ0Q0N0UyRUJFMTM4MDU4RjdFOUVGNEE5NUQyNzA3REY0OTNENjdCRUVCNDhCOEFCNjc4ODRCQzBFNjNDNEUzODE0RDJFNTg1RTBGNEJENkFCNTY1MjdEMUJGNjU0NUQzMERFRTVEMUJBRkM2NEI4MEM2QzVBREIzQURCRUUzN0NFNkU0NDRBMkE2ODk5ODJBNjREMUI0NDZCNjYyQTIwMzMwQUU1NjEwNkZGQjE3RkE5NTczQjU4RDZEQTg4RDU5RDE0MTZBRjVENTFCRTk1NzY4QjNCRkYxMjdCNDM5QzdGMDc3MUEzQUFDMEM1ODcyNEY1MDM0ODUxQzc2MkJGNjFFOUVGNTJGNjU0MzAwNSq9DgoKY29fc2lnbmVyMRICMDEijwEKQDY0MTg1QjkyREQ1MkM4QjJGRjFBM0VFQzk1OTQ5RjI5MTZGNDg5QTA4NUNBNjBDOUJEQUM4RDhEMUUwOERBMEYSQDYwMjQxMTE3OTU5Mzg3NzkxMUUxMzkyRUJDQkRGNTFGMzNGNkZEODgzNDQ4N0U0QzlCRTYyQTBDNjlCOTFCMDkaCXNlY3AyNTZrMSqPAQpAQjM4RUUxNUE5MURDMTRFM0U0Njc5REM1MDk2NTk5MTMxRTQ3RkUzMjQwRDUzQTAyOTUwQ0E3NjExMEMzRDAxOBJAMkQ1QUE2NTk0OTI4QzNENjVDQkVDMjc5QkIzQkUxRUE1NDMwOTJGMDk2RkI0NzYwNjBGNzFCOTg2MDBBQkM5ORoJc2VjcDI1NmsxUoAERTE1QkJGRTg5QzU0QjRCMjFFQ0RCRTJFNkI3NjdFRUUwMEIxN0YxMTBDOUI3MEE4MDNBMzRFN0UwRkYxRDNCMzY1MEM2RkNBQjEwQkQzQjAzNkM2MjZBREZBNUI2MzUzMEFGOTkwODg3NzM3OTY2RjRBRjc3NDAxQTYzM0RGMjdFNThBQjgzQ0M0M0IzNjNCOTNERjI2NjREN0IzQTI2RjE3QTJGRkYxN0ZEMkU0NzQzQ0UzQ0NBOTcyM0FGMzFCRTQyNzhFQjQ2MEJBNEVBRUI1MkVGN0E1RDRCRjc5RDlGMTQwODhBOTI0MDdCM0E0RTJEQTkzNTYxOUFFQjc1MENFQUM2MzRBRTY4ODRGNTgzQzlDNjQ2RjUzNzRDOTgyNjVDODRBRUQ0ODY5Q0Q3NzZGRUU2RkQyNDBENDkwMEI3MkVEN0MwQkFERTg1OTE2RjA3QzZCNERFRTI1OTA3MkYzNUY0NjYzRUM5ODk3Nzk5QkRFMTlDNTQ0OTgxM0UzNzkyNDU1NTEzMjgwRDIxNkU1QzNGMjFERDlFRTA5OTNFOUI2MjJBQzcxQUREOEQzM0Q2RkY3MjFEOTI2QjhDNkUwMTAzRjhCRURBNTk4RTA3NDEyNzU5M0RDNjNGMkJFMEY3NzYxMjU1RUVGRjI4QUIyOTk5MjEyMERDQjM5QjFagARBNUUxQTA5NzFFM0UwMUEzNjk4QzZFQTc3QTY1ODNCNkUzMEJBNUVGOUU5RkEyMjFBQTlEMUUxMzJCRjU2RThEOURFMUQxMzlBOTA1MDI4MEI3NDUxMDYyNUM2REMwQTU1OUQ1QTAzMUEyMENDRUE3MDRERUQ1MTBERDg0OUUxMkM1MDRFRjQwQjMzMUVBNzRFRjBCNjI2MENGQTQ4MUVEQjQ0NUE2RDNENUJBQkMyNzFEQzNDN0U4RTFFNzQxRkU0MkExMEZCRkRBRjE1ODE2MDlDMzNDQzRFNzdBN0M1RkNBQ0E1MDAwQTQ3NkU2NEJFNzU3QzFERjYyNTMzNjQ2RTk2Nzk0RUZGMjA0N0M4MDg0NzJFM0FGMjc3NzRDRDQ4MzQ1QjcyNUJDQzY2OUI0RERGQTM2MjNBNENENjRERUVERUNBRjM0MzA0MjRCMkIzQkE1NUM0MTk5MUNCMEY1MEJCNDFCN0EwQTBBMjcyQ0Q5ODdFNDExN0Y5Q0U3QTYwMzc1RTkwN0QzRTNFMjI2Qjc5MDc0ODQxN0I4MEQ1RjMyOUExN0UzN0U4OTA2NTJBMzY0RUNEQjNFQzYxRTI3QUJGNzcwMjRGNDAyRTc5MDExRjlFMTI4REM4OURGNTQwNDA5MzhFNERGRjA5RUJFQzNDMEQ4NEM2QUUwNzc0Q2KABEFFRjA0RUQyQTlERjVDOEMzOTIwRUE5QTU4OEQ1REU1NzMyNzE2Q0E2NDdGREJCQzU2OEVBNkVEQzA0NDA1N0YyRDhDOTUxMUY0MUZERUQ2RUU5ODhGNDVBQkQxNUM0NTk1ODlCN0U4RUQ4RTMxMjMxOEMxMzdBMjUwQjJDODlERTY0NDFCOTBGQUNEMjg4RkM2RDQ3ODVDN0I4OTM0MTA2Q0UzQUE2Q0ZFRThEMDNCRUI0NzI5QTYzMUQ5ODY2MDQwN0IzQTM2ODY1NjE2REZGRUEwNERGQjRGMEI5NEU5MjNFQzUzODM4QjNFODA4RTE0NDIxMjZDRTFBRjFEQzMyMjM3NDExNDg4QkU2Rjg5MjQxRDNGNDE4RURFRjRFQUE3RjY5MDYxQzQ0N0M0OEZEQTc1QTIwODFBODlBOTc2NjkwQzBDMjM0QURFNUM3MkM5QjczRjQyQ0IzNDgzQzMwMDYyOTRFOEM4M0U5RTQ3Nzc1RDA3NDMzRjQ4NTQyMjA3NjVBN0FBODExNjM0MkM1NDM3NzQ5MzlGNzMzODE4QjMzMDQzRDcyNTVCRTlGRDAzQTQ2QTU3QkI4MTkzQkI2MTBFOTlFRkNFRUEzMjJCMkY1OTgyQURERjgwNDhGMzcwMTU0MTMzNjg3MTE0MzA5RTkwODg0ODNCQkFGNDJFKr0OCgpjb19zaWduZXIyEgIwMiKPAQpAOTg1NkE5NUI2QzRCNzMzN0NEMDJBNDk2NTJCMzM3MzlERjJGMTFFQjYyNzkwODg5NEM5N0ZDNkI4MzYxRUU1MhJAQTkxNzc2NDkzQzQ5M0JFQzI1NDJCQjJERDBEREFBQTg5RjgxRjhBMkYyM0YxMkE1QkJBRjI3NTQwNEQ2RDYyMRoJc2VjcDI1NmsxKo8BCkAzNTBGODUxQTREN0Q0NDdFQkVEREMxRkRFQURBMTNERkNEQjFEQjE0RkJCQThCQThCNkM2RjlCQTM2RTVDMUU0EkA2MDY1QTE3MDMxNTJCRjU5RDQ2MEY5MTA3RTYzNjQyMEZGQjU2RUE5OTFCQjEyOEFCODJCODEwNzMwRDJCODVCGglzZWNwMjU2azFSgARDN0IyMDMyQTA1NDBFNzVBM0Q1NTExQ0Q0RTUzMTJDQkJGM0ZDQUI0NkIzNzQ4OUU0REFBQTlDREVEM0FCMjE2RDBGMTRBMEFBOTU4N0M2RDBGQTk4ODVFRkRDMUM2NzQ2REYwQzE0QzgwMDEyNjdFNjQ5NEY3NzRDMUE2NUI5RDNGNDUwODI1NkY0MUMyQTQzREFGNzIzQzdCQjYxQ0FEMkQ1Mjc3OEI4NEZEODYxOThFNUM2NkMzNkQ2MjUzODQ2Q0NFQTdCNEI4OTJCNTAwMEU2Mjc0Njg1Mjk5NkMwOTlFQjNCNTUxMjkzQTVGQkU3NzFCRDA4NzlDRTQ0NEJFMDUyMUQ1M0Y5NzlDNUE2MURBNDc2MzVGRDUzQjNCMDU4NDhFQUQ2MzNEM0I5QTcyRTE1QUUzQjc1N0I0NUMyMzRFOTFGRDk4MTM5MkE2QjZDMUVBMkVCOUZCQ0UyNTgwMUIyQkU0MEEzQUE5RDNDNDM1RTIzRjExQjZDN0RDQjM1ODRFMTY4MzA1QURENzAzMDlBQjNGOTI2NTc4RTdGODRGOUMwQjQwREMwQTkwNjE5MkRBOEYyNUM4QzgyMUExNTFFMUQ3RDM3NTBCQjQ5MEZDRjgzRTBCMTNGMENDMEU1RUJGOTAwNjA2RTIyODBEOTRBNDc1RkU4NjkzNjFDRFqABEE4Q0Y4NUJDQTAxQjZCMDE5QTZDRDY5RkVBRTA3RjlFRkYyOUQ4MEIwNDhGM0Y1M0Y2Rjk1OTZBMzdERTEyRUZGNEJFMjM5RkVCOTgwODg1MTU5ODVCRDZEMDc1RkIyMEFGRkEyQUIwOUQ5NjRDODE5MkVDNDkyOTY0N0FDRjY4RkM1M0Q3MUYyQkE1RDBGNkVDMTdDNDU1MjJCQTZFMzhEMUNDNThFN0RCNTdDNTY1OUNDODAwRUE4MEY0RjFDNzM3QURDNjcwMEExOEE0QzU4MDY0M0MwNUMwNkIxMzk3Nzc3MTBENEI5NjM2NzMyMzBBRThDOEE3RThBNTUxNEFFNEY5Q0VDQjgxQ0ZGNEQ0NEQ4QTYzNTE4MzI2QzU3OTBCODUxNUMxOEU5N0FEQjAzQUM2NDhGNjM5MTRGQ0FFM0RDQ0MzOUMwOTBBRTRGNUEzNUMxNDYxNjI2QTAyNUM0NzNEQUQzMzNFNDdDQzk2N0QwNUNFRjAxQzQyRjU1RTZBRjBBNjRFQjAzMkVFRUEwRTVBRTdDMDBCQTY4Mzg1M0JCNEU5REMwMkU4OEVFMDQ4QzlERDExRkNCNjlGM0RGMkE1N0I4OTIwRjcyNjBBQzlEQTlFNjcxRDg0RjFGMkNERkYzNDk0MkU1Rjg2MTJCQjJGNDYzQzQxODE5MDZGYoAENzYyODk3MEI4MjYxQjk1N0Q0M0EzQ0ZBNDZFQUU1MDQ3NjlCMzI1MTdCODFDNzgyQkNDOUJCQzc5QkQ0OEM2OEQ1MEQzMkREQjdEMThDRjIxMDQyREI4RUMxRjk0RkIxNzdERDRGRUFBMkRBQkU4MTdFOEVBNzc1MDlDMkQ1Q0ZFNkJGMDcwMEI0MDkyN0ZENzJCRDNGRTlERTlERTJFREJFMDNBRkE4RTA5ODNFMzUzMThCMDZBREU5MjMxMjZFMzI5RDE1MUJCRjBBODkyQjdCRUVCM0ZFNjYxQTVBQkFBQjlFNTIxQ0UyMkQ1MDFEMEJBNUQxRDM0MUI1QjMwMDU1NUU0Mjc0NTEzNURENjlENDVEMTM0QzhEQzQ3OUFCRjAyNzE3Rjc5RkMyMTY4RTI4NzY4RjNBM0YyQUM2MDgwNDYyNzdGRkJCQ0M3MjBBNDcxMDNBOTE2RDRFQzcyRjIyMDZFMzhFMTJCQkE5MDlBNzQ5NkI2NDVENzhFQUFEODA3N0JGNTAwQUUyQ0YxMUIyM0IzNjI2RTEyNjc0NDE3RjY2MjdFMjQ1OERBNzUzMDE3QTA2MEEzQjRGMTNBOEJFNUVCQ0Q0QUY5RjNERUUyRTg4MDY2MTVGM0RFNTA4MjI0MzNCRTY4QTM2NTZCQzhFRDU1RUJGNjhERjFGMkEqvQ4KCmNvX3NpZ25lcjMSAjAzIo8BCkBEQkY2MkIxRTQ2OEFFQzFFMTU1MTAwOTFGRUY0RTQwMDZBOTM1NDMxMEQyNTU4Nzk0RkQzNUI1RTNDNjJGQjlBEkBFRDBCOUMyQkVFMTZEMzkzOUVGNjA3NzZDQzQyNEQ3NENCNjIxMjIxODY1QjYwQzY0OTJEMTdERkIwQzY5REY1GglzZWNwMjU2azEqjwEKQERDRjE4QzYzQzNDNDk5NDREQUM3M0RGQTgwNEE2QUFGQkVEMTlBNkZCQkYzMEIyQUM2OTM4NDBGMDQzN0YyRkYSQDM4NjA1MDM0MEZGMThFMDRFQUYxODZFNTNGQkRFNkE5NkRDRjQ0QjBFOEY1MEUxMUY1QTkzQ0ExQjQ2RTVFQ0IaCXNlY3AyNTZrMVKABDlCNTZGRkY5NzMzQjI5MjVBRDJCOTNFQTYyNzFCRUZDRDE3REQ3M0IzMERCNDk1MTlDODBBNENCN0M4OUI4RDY4OEZFNzI3MkJFRTNFMzZBMURCODI0MUNENEM0MTE1ODQ5MjE4OUE1OEJFQkQzRENBNDQ1RDAxOTY1QjdDRDZDRDExREU0NkIyQTlGMDI5QzlBRjA1QjcyQTc1NzlDRjU3NTQ0NkM0NEE1RTI2QUI3Njc4QjI2MTdDMkExOTlDQzA1RUE5MjJBMDNCODI3OTRGQzIxODAwQzk5MUFEQ0YwMzc4MzlGNkVGRTNCRjI5RUExRUM0MDlBOUM3N0VFMzJEQUU4NDUyOTk4QjJCRDk0MkREOERBNDhCNzU3QkQ5REQyNDI1MkY5MENFN0I1MjJDRjUwODI1NUQ3MjI3QzdGRDk2NkQ1MDU4ODIxRUI5OTdDQzgwODUwQkE0RENFQTA5NEZCM0QwM0U2NjgyNzhDM0UzODgwODM4NjAwNTM2MjkzNjFGNDY2RDU2QUFFN0I0NzIyREFFNzIzMEIxMEQ4RDhGRjE2MkIzQkQ5MjAxMTJGQkJBNzYyQUE4MjQ0N0M5N0UzN0I1NkI4NTBFMDFEQzRDMzY5OUE5NTZGQjJEMDU1RTE5QTI2RkE2NjY1NUQ5MDY0RkUwQkVDMjYyRUIxWoAEOTMyMDc4QkM0QzA2Njg1MkEyOUZDOUJBRDE4NjIxRDU2MDM2Q0E3M0JERDM0QjBCRkU5Q0Q0NjE2NDUxMTk5RjA3RUQ5OTdFMThFMjBEOURCOTVGN0IxNUJDQzY3NDJENUI3M0UwNzVFREMxMjE3QkY0MzI0MUNEOTRCMUQ4RDMxMUZCMzEzNzk4OTRDOTFDQjUxREYzN0Q4RDJGQTRGNzQxRTIzQUExRDBDREJGMUYxQzUxRDJGQUY4QkJGOTM4NjE1NEM3NzE0NTdBMUU5RkM0RDU1NDBEMkJDMUJDQTZFMjAzMDFDOTczMUQ3QzBERURFRDg3REY5NkFCQ0JGMUMwNjNBOUE4MzhDNDYyMUI1Q0Y4NTIwOUFFMzFEMjg3RTI0Q0U3ODU1RjIxMTJEN0ZDMjlCM0NFNDZCOTlGQkE3RjU3NkMxQzZEOThERUZCNjQyMjhCM0U2OUM2MTEyMTVENkQwREQxQTQ1NDgzQjBFMEE0Q0JDQzI3QTdCQzRCMkQxOTc3QkE3QzBENjMxNjZGNzE3ODE1NkY5MTU1RkQwRkEyM0ExNkMxMzgzNTVDQkM1Qjk3NzM1ODIzOTlEMDA0QjEyMzJCOUI5OUQzMTZDRTE1MTEzQkEyQzEwNkRENEMyMjgyNzQ0MTI4RDZEMjRDRTY3M0JDMkQwQ0FEMzdigAQzMjVDRjRFNTg2NUZCOTMxM0VDOUYxMkY4NzhDRDFCN0U3MUU2OEZDNDU4MUQyRjA5OTREMEMwNDRFQ0JGQzg5MEM1RTBEMDA1RjNBQjlGOUFCOUE5ODgyMTAyRkRGQzY1QTM2MjBFQ0EwQUY5M0NFNTc2RjI4QTJFQ0YxRTA1RUJDRTlCRUQ3OTBCMDdCOUI0OUYzMUJCNTJFMjgyQ0ZGNUU4NDIwQURFNDc3MDIwQjQ1MkFBQzIyNDMwRkNFQjAxRDUwNjJCMEQ3OUI2OTNFNzE2N0YzNkZCRTVFRkUwMzM2MkQyQkNFNTNFMDI4NjVFRDBDODE0N0M2OUU5MzVDMDBCQTcwRjA4RThGOTQ2NjM1OUYwMjk5NThGRTg5RkNDQjIyNEZGOTY2Qjk3RkY1NzM1NjFBRjg4MkNEMTFGMTI4QjQ3MjI4RDAzRTFDQTcyRDI1QkMzNDE1RjUyQkE0MTMyODQwMzgyQUE5NjVFQTc3Q0I4OUM2NjkyMjk3MDM1MkFFNERDNzRBQ0JCNkU2QkY5MDE4RDFCMTZCRDEyOTExQkMxOTNFNDY5RTc4N0MyMkMxNkUxRUI0NUM2QTg5NjE4NDQ0ODk3RkVGOTE1MkI4MzFCQUFFQTAzRDZDMkJCMkE2OUU3RDNDREM1QUExOEZEMzJCQUU1MTM0OEEzMiq9DgoKY29fc2lnbmVyNRICMDUijwEKQEUzRDZEQTQzMDBBN0E5RDQ2NjIyQkExNjlENjlDOEQ0MTA5MTgwNDRBNzVFNkE5MDk2Q0RGMUM1NkQ4NDVBQUMSQENFOTQ0RTg2NTE1NEMyNjFGNjMyQzNENDI1QUJGNTcyRkJDNzYxNzVGMjBGREM0OUNBNUYxMTA2NzU5MEFFMzUaCXNlY3AyNTZrMSqPAQpARUIxNzMzN0I0Q0I3NzUxMENEM0NBNkJFNzY0RDUyQjE0QTVBMzY5OTY2MzM0NzY4N0Y1OEU1MjE5M0Q1RTk2NxJARjlEMzdDMEQ3OTkzQTE2RDk4RkJEQjBCRkZDN0I1NEVFRjczQURERUI2MjgzRUE4RjczQjFCNUUzODc3MDU1NBoJc2VjcDI1NmsxUoAEQzI3QzNDMDUwNTMwMDhBOTQ4NDg5REREOUY3Q0YzN0U2MEJERkUxQUQ5RkJCMTczRDJGREJENDQyRTIxRTc4RUMxNDVFMkIxNTYzMzhERkRENjg2REE5MzU5QjdBMjU2MkUyMUQ3MUE4OUIyN0UzQzc5OTQ1NTc2Nzg3RUMwODUzRTk5QTkxRjI3Q0Q1ODgxNEE1RTA3ODU1NkQ5MEMyNDZGNzlCOUVFRUMyMjRFQjVBQ0YxOTc4MjdCMTgxREM0QjUwRTAzOEYyODcyMUMxMEIwRDJEMjc5NzFBMUNFNUE2QTY0QUY3RDY3OENGQzg5MDdDQzZCRkY2M0VFRjlCNDY0NjdEOTVDM0JCMjY5NTc0N0IxQTgxRjQwN0MwMjMzMTU4QzU2NjdCRjgyQjkzQ0I1QkZBQTIwNURBOTU0Q0Q4MEQwQkRDMDVDNzJGMDAwQUE2RjFERkZDNDUwQ0Q1RkNCNzJEQzI1NTFDNTc2MUI3NjU2NzAzQTg4RDFGMDEwMEYxMjFGMEZBRjk1NzY1RDkwNjZFNDg1MUVDRjBBMzA4RTVBQjkxQzRBMTM2NTVFQjE2MzlGMzBEQzRCQzVBMUUwQUZEQkM3RDc0RDAwMEYwN0NDRUNEMEZEODVDMUNDNzA3NTdBQjE2MTBEQzcwMTYwREMxOUFERjU2NjA2NURagAQ3OTFDM0JBRENBMEVGNDNCNDAzNEE0MUMyOTYwRDg4OTYxNTdBNUIxRjc0QTU5RkE0NzcxQjRGOUEzNDhBNThBRDU2N0Y4OTA5QUNDQjhDOEUwNTIyQjkwOEZGNTM3RUEyRTY2RUQwM0RCMjlCRjI3NjcwN0ZGRjgyOUUyQ0ZEMzYwNDMwRTRDQzA4NzdBQ0U2MjA5RjMyMUFGOTJERTQ1MDc2NDZCQkVDRjQ4N0U3MzZFMEYwMTI1RDY2RDU3RDA2MDY0NjNBNEY0OUVBNjhGNDUzM0Q5NDU4Nzg1RkJDOTFEQUM1QURDQTEwMjM2NDhEOUVFRjVBN0I3M0Y5RDI4MzM2NDAxNTc0Njc0QzA3MUNGREIzODlDMDBBQzVDMDk1NUVCODQ2NDg4RjJCRDIyRDVEMzk2RkVBOUYzNERFQzkzMkRCNDQ1RjQ2NkYzNDk0NDE2NEZCN0I0NDc3RjA3NzgzQjQxMkQzRTQ3MTkwQjM2RkEyMEZFQTIwRTM1N0ZBNEUxNjk3NzE2MTk4QTFDNTBFOEVEODc0RTk3RjJFRkQ4RTBERDAxOUE2MUVBOTdCOTcwQTRDRTU3MzEyN0EzNEM5RURGQ0ExRTIyRkYxQUFCMzg4RDEzNTI0Q0YxQUJDRjdGNjkzQUE3NjdBNjYyMEIxMTcwMTZBNjA1OTY0QWKABDBDODc0NzVBQzE5Qzc0N0RGRDU1RTQ1MTEzREU3NjI1RTczMTM5OTVDNjcyNTg4MzAyRTFDNDgyNUQyQkY0MUM3MkZBODU1REUwN0M2QzQ3QUIyNTFFRURFQzYyRURBMjE2RDYyNDMwMkI5QTkzMDVFNkQ4RkYwRDlGODczRjYwOEE0QkNCQUJFMkVEQjFGMzc3OEQ4RUIwMTA5OUE4QzI3NDI1RkI2RkNENjJFRDkxREU4Q0YwOTlFQzBGQzExQjBFMkZFQjNGOTg4MTM0REJFNzQ0RkJCRkJBREEyQzlDRTVGNDA0MEJCNEYyQkU4MjFDMTcwQkY2RjFGMTlCQTY1Q0ZCRDY2OUY4MTJBNDAwMENENkZERDQ1MEZENEM0NEZFNDg0RkU4REExRTA4MDQzNUNCN0E3Q0M5M0ZENEU1N0M5MEU5MjNENjAzRTlFNjg2QTA5QzhBQUQ1QzVBQzVBMTA4ODExNzREMjdGNEEyRjY2RTMzRkIyQ0E0MDhGMTAxNzVBRjg2MjcxRjBCMDA2MDkxMUM1RjcxMjM1N0I2NjE0ODIwQkMwQUQ3NTIyMzYxMTNEQzI5MUIwMDZGNUY4QjA4OEZENEQ5NTAxQkVGQjhBRkNBNjU2RkIwNUYyRUI2Mjc1OTI5NkRGQUYwMzRCNzcyNDdBMkZBMDFEMDcxMo8BCkA0MjUwRTk0NEU2MTJBMEU5Rjk0OTlGREQxMDQ4NUM3QTk1MTI0ODc4QTBCQ0Q0MjEzMjIyODZEQUE1REExOEY3EkBEQTAzMEYzRUY1QUEzNjYxQTMzOTE2RDUxMTZDQkIwRjZEOTk3RDA1RURBRjVENEI3M0JEQzExRUFCREQ5RUFDGglzZWNwMjU2azE.",
                 "EAMYBSKMGwoKY29fc2lnbmVyNRICMDUaQDBDQkRFQUM0NTYzMTM5NDU2M0ZGQ0JBMEM3NDkzMTkyQzAzODRBOTlENjkyMEFCOUE4RkJBQjFCQkEwNkRCNDAijwEKQEUzRDZEQTQzMDBBN0E5RDQ2NjIyQkExNjlENjlDOEQ0MTA5MTgwNDRBNzVFNkE5MDk2Q0RGMUM1NkQ4NDVBQUMSQENFOTQ0RTg2NTE1NEMyNjFGNjMyQzNENDI1QUJGNTcyRkJDNzYxNzVGMjBGREM0OUNBNUYxMTA2NzU5MEFFMzUaCXNlY3AyNTZrMSqPAQpARUIxNzMzN0I0Q0I3NzUxMENEM0NBNkJFNzY0RDUyQjE0QTVBMzY5OTY2MzM0NzY4N0Y1OEU1MjE5M0Q1RTk2NxJARjlEMzdDMEQ3OTkzQTE2RDk4RkJEQjBCRkZDN0I1NEVFRjczQURERUI2MjgzRUE4RjczQjFCNUUzODc3MDU1NBoJc2VjcDI1NmsxUoAEQzI3QzNDMDUwNTMwMDhBOTQ4NDg5REREOUY3Q0YzN0U2MEJERkUxQUQ5RkJCMTczRDJGREJENDQyRTIxRTc4RUMxNDVFMkIxNTYzMzhERkRENjg2REE5MzU5QjdBMjU2MkUyMUQ3MUE4OUIyN0UzQzc5OTQ1NTc2Nzg3RUMwODUzRTk5QTkxRjI3Q0Q1ODgxNEE1RTA3ODU1NkQ5MEMyNDZGNzlCOUVFRUMyMjRFQjVBQ0YxOTc4MjdCMTgxREM0QjUwRTAzOEYyODcyMUMxMEIwRDJEMjc5NzFBMUNFNUE2QTY0QUY3RDY3OENGQzg5MDdDQzZCRkY2M0VFRjlCNDY0NjdEOTVDM0JCMjY5NTc0N0IxQTgxRjQwN0MwMjMzMTU4QzU2NjdCRjgyQjkzQ0I1QkZBQTIwNURBOTU0Q0Q4MEQwQkRDMDVDNzJGMDAwQUE2RjFERkZDNDUwQ0Q1RkNCNzJEQzI1NTFDNTc2MUI3NjU2NzAzQTg4RDFGMDEwMEYxMjFGMEZBRjk1NzY1RDkwNjZFNDg1MUVDRjBBMzA4RTVBQjkxQzRBMTM2NTVFQjE2MzlGMzBEQzRCQzVBMUUwQUZEQkM3RDc0RDAwMEYwN0NDRUNEMEZEODVDMUNDNzA3NTdBQjE2MTBEQzcwMTYwREMxOUFERjU2NjA2NURagAQ3OTFDM0JBRENBMEVGNDNCNDAzNEE0MUMyOTYwRDg4OTYxNTdBNUIxRjc0QTU5RkE0NzcxQjRGOUEzNDhBNThBRDU2N0Y4OTA5QUNDQjhDOEUwNTIyQjkwOEZGNTM3RUEyRTY2RUQwM0RCMjlCRjI3NjcwN0ZGRjgyOUUyQ0ZEMzYwNDMwRTRDQzA4NzdBQ0U2MjA5RjMyMUFGOTJERTQ1MDc2NDZCQkVDRjQ4N0U3MzZFMEYwMTI1RDY2RDU3RDA2MDY0NjNBNEY0OUVBNjhGNDUzM0Q5NDU4Nzg1RkJDOTFEQUM1QURDQTEwMjM2NDhEOUVFRjVBN0I3M0Y5RDI4MzM2NDAxNTc0Njc0QzA3MUNGREIzODlDMDBBQzVDMDk1NUVCODQ2NDg4RjJCRDIyRDVEMzk2RkVBOUYzNERFQzkzMkRCNDQ1RjQ2NkYzNDk0NDE2NEZCN0I0NDc3RjA3NzgzQjQxMkQzRTQ3MTkwQjM2RkEyMEZFQTIwRTM1N0ZBNEUxNjk3NzE2MTk4QTFDNTBFOEVEODc0RTk3RjJFRkQ4RTBERDAxOUE2MUVBOTdCOTcwQTRDRTU3MzEyN0EzNEM5RURGQ0ExRTIyRkYxQUFCMzg4RDEzNTI0Q0YxQUJDRjdGNjkzQUE3NjdBNjYyMEIxMTcwMTZBNjA1OTY0QWKABDBDODc0NzVBQzE5Qzc0N0RGRDU1RTQ1MTEzREU3NjI1RTczMTM5OTVDNjcyNTg4MzAyRTFDNDgyNUQyQkY0MUM3MkZBODU1REUwN0M2QzQ3QUIyNTFFRURFQzYyRURBMjE2RDYyNDMwMkI5QTkzMDVFNkQ4RkYwRDlGODczRjYwOEE0QkNCQUJFMkVEQjFGMzc3OEQ4RUIwMTA5OUE4QzI3NDI1RkI2RkNENjJFRDkxREU4Q0YwOTlFQzBGQzExQjBFMkZFQjNGOTg4MTM0REJFNzQ0RkJCRkJBREEyQzlDRTVGNDA0MEJCNEYyQkU4MjFDMTcwQkY2RjFGMTlCQTY1Q0ZCRDY2OUY4MTJBNDAwMENENkZERDQ1MEZENEM0NEZFNDg0RkU4REExRTA4MDQzNUNCN0E3Q0M5M0ZENEU1N0M5MEU5MjNENjAzRTlFNjg2QTA5QzhBQUQ1QzVBQzVBMTA4ODExNzREMjdGNEEyRjY2RTMzRkIyQ0E0MDhGMTAxNzVBRjg2MjcxRjBCMDA2MDkxMUM1RjcxMjM1N0I2NjE0ODIwQkMwQUQ3NTIyMzYxMTNEQzI5MUIwMDZGNUY4QjA4OEZENEQ5NTAxQkVGQjhBRkNBNjU2RkIwNUYyRUI2Mjc1OTI5NkRGQUYwMzRCNzcyNDdBMkZBMDFEMDcxaoACRjVFRTQxOEM1NEE1RkVGMEUxQjYyNUZFRjJEQjExOEZCRjQyRkJBQkM2NDEwMTVCRkFFQTVCQTEzRTE5MjU2REI0ODc4REI3OTg2RjE5NTJBNjRBRjNBNUI5QzVFMENBNEUxNjE5QTNBNEE2NzQ2ODU5RTE0MUE0ODRFMkU2NkVBQTYzMUEyNzhCMzA3OUJERjlCRkY1RUUxMzUzMUY4Qjc5RDc2OEZDQTA0MTRBRjA2Q0RFRDBDMTVDMzNCQ0RDMzE3ODVBOEVBQUNENjEzNDMyQ0YwQzFGRDlCRDc5OTE2MEU4Rjk0NDJBQTExMEYwRjZENjFGNEVBQ0RBRUJERnKAAkNBNzJCRkJEQ0UzNUE3NTNCNzJGMTQ4MUNBNjI0MDlCNzk2OEZEMDU0ODVDMDU5MTQyOTM1RTUwNzI3MDQ4RDhFQzBFNzIwNDc3RDAyQUIzRUJBNTNBQzY1RTk4RkIwMEQ1MzE0MzAzOTIyMEY0QTcwMjkyMzZCREJCQzk1NDMwNTk5MDIwNkRFRjA0NTczNzRFMkIyRTVGQTk3QjIyQkI1QkU0RkVDM0RGNjYzNjFBQzRGODlCNkVDRTVFQTU4MTE3NEY0NjMyMjBDRjJENzA4NEM4NjE2OUQwRUNBNjRGMEQxMzNDMTJFNzY2MEJFMjY4RjVFN0VDMjU1RjE1NDN6gAQxNkI5NThDN0JDMEE0QTMxQzVCNzU4Q0RDQ0Y5Qzg1QjE0NTAzRjI1MDNFQjBEMkNGRTE2NDExQURDMkVEREFFQzlBQjkzRDE2QzAwMjYxODE0Rjc2OERGOTY3NzlDRjUyNkUzMUI0QkIzQUNDN0Y3Njk0RjkxNjYwMzNCMTM2RkRFMTFCQkRDQUQwNTk4QzJBMDNBM0ZGMkZDMjg4OTU5MjUxOUVDNjQzNkJEMzhGODQyQzE4QkYzNkJFNDEzOTY1MEIzNTE3NkVGQTlBNDUyQzJEQzk5NDU4N0U5NjcwOUU1OEUzMkRGM0NFRjc3QzgzRjMyMEM5RUM2RjFENDMxNEY4N0NBNTNDRDEzNEZENDQxMjIyQkVGQzUxMjZDMEIyNENGMUFGODVCQzI2NEQzNTIyQjU5RUQzMzI4QzE5NDlERjc5ODVCQTVCRDczNDQ4NTJGNjJBMjM3MjdGRDk0MjJDNEU2OTc4OEVDQ0QwRDhGNzA4RUE4QzYwRENCQUU0NkIwQkZBOTU0QkEyQTI4RUIwRjNFMkVEMjcwNEU0NzE3NEEzM0VDRkRENkU5MjM3OUNDOTk4MDRDOUJFRkE2Q0RFMjRCRTFBMUREMDVBNkRBMUVCMzlGMDczM0VBNDUzQjU4NTE0QzA0NUUzOThGNTM3MzJGMTRCQzUyMkUyMoIBgAQyNDNENkQ0NUMzQkRGRTNCQ0Q1RTMwODg2MTU2QkY5NjVDMDJDMzExNjBBRjM0RUNCNERBNUFGMDc1NjRBMzRBM0JERTkxNzBERjQxQjA4NzIxQ0RCNDlGMzM2NjMzQzVFQTgzNEZCMDE0Rjk0QUFDOTBENTBENjRGODVFQjQ3Q0IwMDZBMTAwQzU0NkU0OUZCOTFEQTc1Rjk5Njc2NjRDOTYzNzYzM0U4RDJDNDE3Mjc1QUEwMUVGRTFGMDgzRThDNzUzQUUwNjU3NEJDMjAxQTYyNkU3M0VCMTlDQjk2NTNFMEZENzIxMzU5MzgyRkQxRTZFRjQ0NzQzQUM2RjkzRDQ2NzFGMjhBNUNBRDE2NzEzMkUyMEZGMkYyMEVGODZFMUIzMDE2NTFFREU4OUUzQTU3MEIyQzFENDNFNkY2RUQ5NjAwMkEwMjFFODIzQzU3MDIxODI5N0EyRTlENURDNDM0NzJBODZDQ0JGQzYyRjEwQzUxREM5MkNDODZBQUM1NjBFQzBGQzA1QTZBMEFDMzU4NDk1RjNCNEFFOTQ3NzlBQTQxOUQ2NUIzN0JFMUZCNDFCMkZFOTg1NTM1NDIzRkM2NEE0MjRFOUI5Q0JDRDI5MURENzA1OUJDNDAxODlCMTdDOTJFN0E2Qjk5OTFCMTgwNTEyOEMzMDdDM0MxMiq9DgoKY29fc2lnbmVyMRICMDEijwEKQDY0MTg1QjkyREQ1MkM4QjJGRjFBM0VFQzk1OTQ5RjI5MTZGNDg5QTA4NUNBNjBDOUJEQUM4RDhEMUUwOERBMEYSQDYwMjQxMTE3OTU5Mzg3NzkxMUUxMzkyRUJDQkRGNTFGMzNGNkZEODgzNDQ4N0U0QzlCRTYyQTBDNjlCOTFCMDkaCXNlY3AyNTZrMSqPAQpAQjM4RUUxNUE5MURDMTRFM0U0Njc5REM1MDk2NTk5MTMxRTQ3RkUzMjQwRDUzQTAyOTUwQ0E3NjExMEMzRDAxOBJAMkQ1QUE2NTk0OTI4QzNENjVDQkVDMjc5QkIzQkUxRUE1NDMwOTJGMDk2RkI0NzYwNjBGNzFCOTg2MDBBQkM5ORoJc2VjcDI1NmsxUoAERTE1QkJGRTg5QzU0QjRCMjFFQ0RCRTJFNkI3NjdFRUUwMEIxN0YxMTBDOUI3MEE4MDNBMzRFN0UwRkYxRDNCMzY1MEM2RkNBQjEwQkQzQjAzNkM2MjZBREZBNUI2MzUzMEFGOTkwODg3NzM3OTY2RjRBRjc3NDAxQTYzM0RGMjdFNThBQjgzQ0M0M0IzNjNCOTNERjI2NjREN0IzQTI2RjE3QTJGRkYxN0ZEMkU0NzQzQ0UzQ0NBOTcyM0FGMzFCRTQyNzhFQjQ2MEJBNEVBRUI1MkVGN0E1RDRCRjc5RDlGMTQwODhBOTI0MDdCM0E0RTJEQTkzNTYxOUFFQjc1MENFQUM2MzRBRTY4ODRGNTgzQzlDNjQ2RjUzNzRDOTgyNjVDODRBRUQ0ODY5Q0Q3NzZGRUU2RkQyNDBENDkwMEI3MkVEN0MwQkFERTg1OTE2RjA3QzZCNERFRTI1OTA3MkYzNUY0NjYzRUM5ODk3Nzk5QkRFMTlDNTQ0OTgxM0UzNzkyNDU1NTEzMjgwRDIxNkU1QzNGMjFERDlFRTA5OTNFOUI2MjJBQzcxQUREOEQzM0Q2RkY3MjFEOTI2QjhDNkUwMTAzRjhCRURBNTk4RTA3NDEyNzU5M0RDNjNGMkJFMEY3NzYxMjU1RUVGRjI4QUIyOTk5MjEyMERDQjM5QjFagARBNUUxQTA5NzFFM0UwMUEzNjk4QzZFQTc3QTY1ODNCNkUzMEJBNUVGOUU5RkEyMjFBQTlEMUUxMzJCRjU2RThEOURFMUQxMzlBOTA1MDI4MEI3NDUxMDYyNUM2REMwQTU1OUQ1QTAzMUEyMENDRUE3MDRERUQ1MTBERDg0OUUxMkM1MDRFRjQwQjMzMUVBNzRFRjBCNjI2MENGQTQ4MUVEQjQ0NUE2RDNENUJBQkMyNzFEQzNDN0U4RTFFNzQxRkU0MkExMEZCRkRBRjE1ODE2MDlDMzNDQzRFNzdBN0M1RkNBQ0E1MDAwQTQ3NkU2NEJFNzU3QzFERjYyNTMzNjQ2RTk2Nzk0RUZGMjA0N0M4MDg0NzJFM0FGMjc3NzRDRDQ4MzQ1QjcyNUJDQzY2OUI0RERGQTM2MjNBNENENjRERUVERUNBRjM0MzA0MjRCMkIzQkE1NUM0MTk5MUNCMEY1MEJCNDFCN0EwQTBBMjcyQ0Q5ODdFNDExN0Y5Q0U3QTYwMzc1RTkwN0QzRTNFMjI2Qjc5MDc0ODQxN0I4MEQ1RjMyOUExN0UzN0U4OTA2NTJBMzY0RUNEQjNFQzYxRTI3QUJGNzcwMjRGNDAyRTc5MDExRjlFMTI4REM4OURGNTQwNDA5MzhFNERGRjA5RUJFQzNDMEQ4NEM2QUUwNzc0Q2KABEFFRjA0RUQyQTlERjVDOEMzOTIwRUE5QTU4OEQ1REU1NzMyNzE2Q0E2NDdGREJCQzU2OEVBNkVEQzA0NDA1N0YyRDhDOTUxMUY0MUZERUQ2RUU5ODhGNDVBQkQxNUM0NTk1ODlCN0U4RUQ4RTMxMjMxOEMxMzdBMjUwQjJDODlERTY0NDFCOTBGQUNEMjg4RkM2RDQ3ODVDN0I4OTM0MTA2Q0UzQUE2Q0ZFRThEMDNCRUI0NzI5QTYzMUQ5ODY2MDQwN0IzQTM2ODY1NjE2REZGRUEwNERGQjRGMEI5NEU5MjNFQzUzODM4QjNFODA4RTE0NDIxMjZDRTFBRjFEQzMyMjM3NDExNDg4QkU2Rjg5MjQxRDNGNDE4RURFRjRFQUE3RjY5MDYxQzQ0N0M0OEZEQTc1QTIwODFBODlBOTc2NjkwQzBDMjM0QURFNUM3MkM5QjczRjQyQ0IzNDgzQzMwMDYyOTRFOEM4M0U5RTQ3Nzc1RDA3NDMzRjQ4NTQyMjA3NjVBN0FBODExNjM0MkM1NDM3NzQ5MzlGNzMzODE4QjMzMDQzRDcyNTVCRTlGRDAzQTQ2QTU3QkI4MTkzQkI2MTBFOTlFRkNFRUEzMjJCMkY1OTgyQURERjgwNDhGMzcwMTU0MTMzNjg3MTE0MzA5RTkwODg0ODNCQkFGNDJFKr0OCgpjb19zaWduZXIyEgIwMiKPAQpAOTg1NkE5NUI2QzRCNzMzN0NEMDJBNDk2NTJCMzM3MzlERjJGMTFFQjYyNzkwODg5NEM5N0ZDNkI4MzYxRUU1MhJAQTkxNzc2NDkzQzQ5M0JFQzI1NDJCQjJERDBEREFBQTg5RjgxRjhBMkYyM0YxMkE1QkJBRjI3NTQwNEQ2RDYyMRoJc2VjcDI1NmsxKo8BCkAzNTBGODUxQTREN0Q0NDdFQkVEREMxRkRFQURBMTNERkNEQjFEQjE0RkJCQThCQThCNkM2RjlCQTM2RTVDMUU0EkA2MDY1QTE3MDMxNTJCRjU5RDQ2MEY5MTA3RTYzNjQyMEZGQjU2RUE5OTFCQjEyOEFCODJCODEwNzMwRDJCODVCGglzZWNwMjU2azFSgARDN0IyMDMyQTA1NDBFNzVBM0Q1NTExQ0Q0RTUzMTJDQkJGM0ZDQUI0NkIzNzQ4OUU0REFBQTlDREVEM0FCMjE2RDBGMTRBMEFBOTU4N0M2RDBGQTk4ODVFRkRDMUM2NzQ2REYwQzE0QzgwMDEyNjdFNjQ5NEY3NzRDMUE2NUI5RDNGNDUwODI1NkY0MUMyQTQzREFGNzIzQzdCQjYxQ0FEMkQ1Mjc3OEI4NEZEODYxOThFNUM2NkMzNkQ2MjUzODQ2Q0NFQTdCNEI4OTJCNTAwMEU2Mjc0Njg1Mjk5NkMwOTlFQjNCNTUxMjkzQTVGQkU3NzFCRDA4NzlDRTQ0NEJFMDUyMUQ1M0Y5NzlDNUE2MURBNDc2MzVGRDUzQjNCMDU4NDhFQUQ2MzNEM0I5QTcyRTE1QUUzQjc1N0I0NUMyMzRFOTFGRDk4MTM5MkE2QjZDMUVBMkVCOUZCQ0UyNTgwMUIyQkU0MEEzQUE5RDNDNDM1RTIzRjExQjZDN0RDQjM1ODRFMTY4MzA1QURENzAzMDlBQjNGOTI2NTc4RTdGODRGOUMwQjQwREMwQTkwNjE5MkRBOEYyNUM4QzgyMUExNTFFMUQ3RDM3NTBCQjQ5MEZDRjgzRTBCMTNGMENDMEU1RUJGOTAwNjA2RTIyODBEOTRBNDc1RkU4NjkzNjFDRFqABEE4Q0Y4NUJDQTAxQjZCMDE5QTZDRDY5RkVBRTA3RjlFRkYyOUQ4MEIwNDhGM0Y1M0Y2Rjk1OTZBMzdERTEyRUZGNEJFMjM5RkVCOTgwODg1MTU5ODVCRDZEMDc1RkIyMEFGRkEyQUIwOUQ5NjRDODE5MkVDNDkyOTY0N0FDRjY4RkM1M0Q3MUYyQkE1RDBGNkVDMTdDNDU1MjJCQTZFMzhEMUNDNThFN0RCNTdDNTY1OUNDODAwRUE4MEY0RjFDNzM3QURDNjcwMEExOEE0QzU4MDY0M0MwNUMwNkIxMzk3Nzc3MTBENEI5NjM2NzMyMzBBRThDOEE3RThBNTUxNEFFNEY5Q0VDQjgxQ0ZGNEQ0NEQ4QTYzNTE4MzI2QzU3OTBCODUxNUMxOEU5N0FEQjAzQUM2NDhGNjM5MTRGQ0FFM0RDQ0MzOUMwOTBBRTRGNUEzNUMxNDYxNjI2QTAyNUM0NzNEQUQzMzNFNDdDQzk2N0QwNUNFRjAxQzQyRjU1RTZBRjBBNjRFQjAzMkVFRUEwRTVBRTdDMDBCQTY4Mzg1M0JCNEU5REMwMkU4OEVFMDQ4QzlERDExRkNCNjlGM0RGMkE1N0I4OTIwRjcyNjBBQzlEQTlFNjcxRDg0RjFGMkNERkYzNDk0MkU1Rjg2MTJCQjJGNDYzQzQxODE5MDZGYoAENzYyODk3MEI4MjYxQjk1N0Q0M0EzQ0ZBNDZFQUU1MDQ3NjlCMzI1MTdCODFDNzgyQkNDOUJCQzc5QkQ0OEM2OEQ1MEQzMkREQjdEMThDRjIxMDQyREI4RUMxRjk0RkIxNzdERDRGRUFBMkRBQkU4MTdFOEVBNzc1MDlDMkQ1Q0ZFNkJGMDcwMEI0MDkyN0ZENzJCRDNGRTlERTlERTJFREJFMDNBRkE4RTA5ODNFMzUzMThCMDZBREU5MjMxMjZFMzI5RDE1MUJCRjBBODkyQjdCRUVCM0ZFNjYxQTVBQkFBQjlFNTIxQ0UyMkQ1MDFEMEJBNUQxRDM0MUI1QjMwMDU1NUU0Mjc0NTEzNURENjlENDVEMTM0QzhEQzQ3OUFCRjAyNzE3Rjc5RkMyMTY4RTI4NzY4RjNBM0YyQUM2MDgwNDYyNzdGRkJCQ0M3MjBBNDcxMDNBOTE2RDRFQzcyRjIyMDZFMzhFMTJCQkE5MDlBNzQ5NkI2NDVENzhFQUFEODA3N0JGNTAwQUUyQ0YxMUIyM0IzNjI2RTEyNjc0NDE3RjY2MjdFMjQ1OERBNzUzMDE3QTA2MEEzQjRGMTNBOEJFNUVCQ0Q0QUY5RjNERUUyRTg4MDY2MTVGM0RFNTA4MjI0MzNCRTY4QTM2NTZCQzhFRDU1RUJGNjhERjFGMkEqvQ4KCmNvX3NpZ25lcjMSAjAzIo8BCkBEQkY2MkIxRTQ2OEFFQzFFMTU1MTAwOTFGRUY0RTQwMDZBOTM1NDMxMEQyNTU4Nzk0RkQzNUI1RTNDNjJGQjlBEkBFRDBCOUMyQkVFMTZEMzkzOUVGNjA3NzZDQzQyNEQ3NENCNjIxMjIxODY1QjYwQzY0OTJEMTdERkIwQzY5REY1GglzZWNwMjU2azEqjwEKQERDRjE4QzYzQzNDNDk5NDREQUM3M0RGQTgwNEE2QUFGQkVEMTlBNkZCQkYzMEIyQUM2OTM4NDBGMDQzN0YyRkYSQDM4NjA1MDM0MEZGMThFMDRFQUYxODZFNTNGQkRFNkE5NkRDRjQ0QjBFOEY1MEUxMUY1QTkzQ0ExQjQ2RTVFQ0IaCXNlY3AyNTZrMVKABDlCNTZGRkY5NzMzQjI5MjVBRDJCOTNFQTYyNzFCRUZDRDE3REQ3M0IzMERCNDk1MTlDODBBNENCN0M4OUI4RDY4OEZFNzI3MkJFRTNFMzZBMURCODI0MUNENEM0MTE1ODQ5MjE4OUE1OEJFQkQzRENBNDQ1RDAxOTY1QjdDRDZDRDExREU0NkIyQTlGMDI5QzlBRjA1QjcyQTc1NzlDRjU3NTQ0NkM0NEE1RTI2QUI3Njc4QjI2MTdDMkExOTlDQzA1RUE5MjJBMDNCODI3OTRGQzIxODAwQzk5MUFEQ0YwMzc4MzlGNkVGRTNCRjI5RUExRUM0MDlBOUM3N0VFMzJEQUU4NDUyOTk4QjJCRDk0MkREOERBNDhCNzU3QkQ5REQyNDI1MkY5MENFN0I1MjJDRjUwODI1NUQ3MjI3QzdGRDk2NkQ1MDU4ODIxRUI5OTdDQzgwODUwQkE0RENFQTA5NEZCM0QwM0U2NjgyNzhDM0UzODgwODM4NjAwNTM2MjkzNjFGNDY2RDU2QUFFN0I0NzIyREFFNzIzMEIxMEQ4RDhGRjE2MkIzQkQ5MjAxMTJGQkJBNzYyQUE4MjQ0N0M5N0UzN0I1NkI4NTBFMDFEQzRDMzY5OUE5NTZGQjJEMDU1RTE5QTI2RkE2NjY1NUQ5MDY0RkUwQkVDMjYyRUIxWoAEOTMyMDc4QkM0QzA2Njg1MkEyOUZDOUJBRDE4NjIxRDU2MDM2Q0E3M0JERDM0QjBCRkU5Q0Q0NjE2NDUxMTk5RjA3RUQ5OTdFMThFMjBEOURCOTVGN0IxNUJDQzY3NDJENUI3M0UwNzVFREMxMjE3QkY0MzI0MUNEOTRCMUQ4RDMxMUZCMzEzNzk4OTRDOTFDQjUxREYzN0Q4RDJGQTRGNzQxRTIzQUExRDBDREJGMUYxQzUxRDJGQUY4QkJGOTM4NjE1NEM3NzE0NTdBMUU5RkM0RDU1NDBEMkJDMUJDQTZFMjAzMDFDOTczMUQ3QzBERURFRDg3REY5NkFCQ0JGMUMwNjNBOUE4MzhDNDYyMUI1Q0Y4NTIwOUFFMzFEMjg3RTI0Q0U3ODU1RjIxMTJEN0ZDMjlCM0NFNDZCOTlGQkE3RjU3NkMxQzZEOThERUZCNjQyMjhCM0U2OUM2MTEyMTVENkQwREQxQTQ1NDgzQjBFMEE0Q0JDQzI3QTdCQzRCMkQxOTc3QkE3QzBENjMxNjZGNzE3ODE1NkY5MTU1RkQwRkEyM0ExNkMxMzgzNTVDQkM1Qjk3NzM1ODIzOTlEMDA0QjEyMzJCOUI5OUQzMTZDRTE1MTEzQkEyQzEwNkRENEMyMjgyNzQ0MTI4RDZEMjRDRTY3M0JDMkQwQ0FEMzdigAQzMjVDRjRFNTg2NUZCOTMxM0VDOUYxMkY4NzhDRDFCN0U3MUU2OEZDNDU4MUQyRjA5OTREMEMwNDRFQ0JGQzg5MEM1RTBEMDA1RjNBQjlGOUFCOUE5ODgyMTAyRkRGQzY1QTM2MjBFQ0EwQUY5M0NFNTc2RjI4QTJFQ0YxRTA1RUJDRTlCRUQ3OTBCMDdCOUI0OUYzMUJCNTJFMjgyQ0ZGNUU4NDIwQURFNDc3MDIwQjQ1MkFBQzIyNDMwRkNFQjAxRDUwNjJCMEQ3OUI2OTNFNzE2N0YzNkZCRTVFRkUwMzM2MkQyQkNFNTNFMDI4NjVFRDBDODE0N0M2OUU5MzVDMDBCQTcwRjA4RThGOTQ2NjM1OUYwMjk5NThGRTg5RkNDQjIyNEZGOTY2Qjk3RkY1NzM1NjFBRjg4MkNEMTFGMTI4QjQ3MjI4RDAzRTFDQTcyRDI1QkMzNDE1RjUyQkE0MTMyODQwMzgyQUE5NjVFQTc3Q0I4OUM2NjkyMjk3MDM1MkFFNERDNzRBQ0JCNkU2QkY5MDE4RDFCMTZCRDEyOTExQkMxOTNFNDY5RTc4N0MyMkMxNkUxRUI0NUM2QTg5NjE4NDQ0ODk3RkVGOTE1MkI4MzFCQUFFQTAzRDZDMkJCMkE2OUU3RDNDREM1QUExOEZEMzJCQUU1MTM0OEEzMiq9DgoKY29fc2lnbmVyNBICMDQijwEKQEQ2QUU2MEJGQkM1OTdCRjQ5QkUyMDg5MDRGN0UxMjZBMkZCN0M4OTk0OUFFRjFGOTcwQjRDQkU5OTNFM0JDQjUSQDJBRTU4QzEyOUMxMUFFOTU3QTZCNUI3MTExODkwOEZEMkUzNTE3MzI0ODAxQzZDNzlGNkZCODQ5QjI1NzJCMUIaCXNlY3AyNTZrMSqPAQpAREM3MDdDNEUwMkMxODU0NTgzRTE2NTJBNDA1MEY3NDgzQzIzMEY3MTA2RTdCMjZGNEQ4ODNDQTM5Q0NGQTM3OBJAMjcwREU1NzY1Nzc5ODM1RDBDNUMxNDc4MEE2QzU2ODQ1QTk5MUU0RjJDNzIyQTFEN0MyNTlFQUYxOTg5NEI2MxoJc2VjcDI1NmsxUoAERjg5RTZFNTZFMjI1QTBGRDAzMjJGRTgwNzlDOTJGODM3ODZDRkYxNDE1RTRGNjNCMzQ3ODRDMDZFMzk2M0Q5NjRBRjdENkQ4Nzk2Rjk1QUM4NTU0MUFEQjAzRkY3ODlFOTUzQ0I0N0NBQTlCQjgwODIxMThFRkEyRDJEMjRDM0I1MTkzNjM4MTFFMDYzRTRGQTcwMzc0NzA5QkE2MjQ1OEIyNkEyRUY3RTQ2OTEwMzQ2MEQwRTBGNEVCRjg4QUVCN0ExRDg0MzEwRENCOUY3QzcyNzBERURDRkQ2ODk4MzlGRTU0QjJGMjA2MDMzRTUyN0VFRDVCNjA2NzMzNkZFMkRFNjA0NEVDQUFBRTE4OUYwMEZCRDg0RTIwRjUwNkYwMUI2RUQ0M0ZGRUQwNTQ3M0IwNzJFMkZGNTA2MjI3RTRGQTEzOUY1NzY2NERBMUQ3MTdDRjIzNjZEODZERTVCMzBFQ0IzOUIzMDYxMjg4RkRBODRBNTlBN0U4MjY1MEZCNDgzOEI0NjA4NzRGNjQwQjdDOThBM0VCOTgwRUVFODI0MUUyMTFFOUUyNTkxRkE4M0QwNkQyNDQ1NDc2MjUzNkY5N0IxMTk2MUQ1Njg3OUE1RjExMjgxRTAzN0Q3NjNCMDdBNjVBNjMyNTgwMDc5NTlFMEExM0NCMjQyOTM3RDlagAQwOEU2MjEyNThDQ0M4MDVCMjRBQ0Q5RjA5QjBFRTIxQzQ0NEJGMUY3MzIyODVCNEI4REQ0MDI4REY4QjFENDQ5MTkxNDUzQzlENUY3RjExQkMzM0M5ODVGM0NDRDcwMzdBNTAzNzREMTBGOUJGRkNGQTNFQzM5NDY4NEU4NkE2MkNGNzczOUYzRTVGMDdCMDI4MDI1MDg0RjFCODdERUY5NEEzRkE0ODA0OUM3QTQyNEY4MjdFMzBCODlDREY2M0I1REQ0NzFDOEE2MjVENzlBQjRGMzUwQTZCMzUwRTNFNEMwM0I5M0RDQjE4RERBQjREQTdEMjgwMDkwMTMzMzdENTk5NEU5MDE5MTE2ODRBOTEwMUM1M0JERTg1QkE2Q0VEMkIyRTEzMDI0NDU4QjRDOTY1RTBDQjRGNjcyNDJGNTNDRUNCNjlGRTI0NjE3MUE3OEU0OUY3ODgyRTczNzJGQjA0MEM1QzZFNTlDRkQyNkE4MjMxOEYwQ0JGNkJDOUFGMDA2QjMxNDRFRjkyMDgyNjU5QTEwM0E2QTJCM0NFM0Q3RjBBMzBFOThBQjUwMDc5NUI0NTRDMTcwRDk2OEY2RTJFMzRENzkyQTU2MjkwOTZFMUMwRkREMjM5NEE4NEJEMzE4MTMzODc3QUM2MjNFNkNGQjBBMzdGNEVFQzdEN2KABDBFRUM2RTZGQkY2NzhEREZFNzBDMDE2OUI2Nzg3RDhFOTA1N0M1MEVFMTBEQTRGMjM2MDg2MEE3MDg4Rjg2RTMyMEU2ODNERkE1RDc2MEM1Njg3QkY3MUUzQjRCMzY3QzJCN0E0MjkyQTYzQ0YxMEQ0Q0UyODkwNERBNDFCMDZGOEUyNzA2REU3REY0N0FBOEM4OTYwN0U3OTE3MjQ1NTNBOUIxRjU3OUZGQTBDRjI5QjZFNDU3NTIyQjY0OTczMDFEMkY3OTE5QTI5NTU0NTExOTE4ODVBQzVBNjk4RjcwQTAyNTI5NEMzREQ5RDRFNTE0OUY2N0RBNUMxNTA1RUUyMUE4MTg0MDYzQjlCQzIwNjczQzc3QjcyREE5QkMyRUYyQzdEMDJGQ0I2RTAwRkE4N0ZFM0Q3Njc2RDA5RTZERDk5RDVCODNGQkRGNTJDNDJCQjZGNTY3Qzg0NTdBMDQ3ODA2Mjc4REZDQzY5MDEyQzEyRTMwNEFFRjc4OTQyQzMxQTU4MzIzM0IyMkQ0OEUxODhFQzZGMDJGRjc1M0FFMjQ1MTAwRTgxQjMzOEVDMzkxQUMyNzgzMTk2MENEMEUyMEIxODUyRDhFN0FEQjg0NEU2MUMwNEIxQzMzRTc0MkNEQjMzMEQwNDE5RUEzQkQ5OTY3M0NFQjU3NkQwMzREMo8BCkA0MjUwRTk0NEU2MTJBMEU5Rjk0OTlGREQxMDQ4NUM3QTk1MTI0ODc4QTBCQ0Q0MjEzMjIyODZEQUE1REExOEY3EkBEQTAzMEYzRUY1QUEzNjYxQTMzOTE2RDUxMTZDQkIwRjZEOTk3RDA1RURBRjVENEI3M0JEQzExRUFCREQ5RUFDGglzZWNwMjU2azE."
         };
+        testCoSign_t_n_view(sign_key_base64_arr_1);
         testCoSign_t_n(sign_key_base64_arr_1);
 
         std::cout << "Test cmp sign with P256 curve" << std::endl;
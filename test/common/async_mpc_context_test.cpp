@@ -0,0 +1,253 @@
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/executor.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/async_mpc_context.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+using std::string;
+using std::vector;
+using safeheron::mpc_flow::common::ThreadPoolExecutor;
+using safeheron::mpc_flow::mpc_parallel_v2::AsyncMPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCRound;
+using safeheron::mpc_flow::mpc_parallel_v2::MessageType;
+using safeheron::mpc_flow::mpc_parallel_v2::OutboundMessages;
+
+const vector<string> ID_ARR = {"party1", "party2", "party3", "party4"};
+
+// A toy protocol of 3 rounds: every party broadcasts its id in round 0, sends "src>dst" to every other party in
+// round 1, and checks what it got in round 2. Computing a round takes a while.
+class ToyRound : public MPCRound {
+public:
+    ToyRound(MessageType in, MessageType out, string id) : MPCRound(in, out), id_(std::move(id)) {}
+
+    bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override {
+        if (get_round_index() == 1) return bc_msg == party_id;
+        return p2p_msg == party_id + ">" + id_;
+    }
+
+    bool ReceiveVerify(const std::string &party_id) override {
+        return true;
+    }
+
+    bool ComputeVerify() override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return true;
+    }
+
+    bool MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                     std::vector<std::string> &out_des_arr) const override {
+        out_p2p_msg_arr.clear();
+        out_des_arr.clear();
+        out_bc_msg.clear();
+        if (get_round_index() == 2) return true;
+        for (const auto &id: ID_ARR) {
+            if (id == id_) continue;
+            out_des_arr.push_back(id);
+            if (get_round_index() == 1) out_p2p_msg_arr.push_back(id_ + ">" + id);
+        }
+        if (get_round_index() == 0) out_bc_msg = id_;
+        return true;
+    }
+
+    string id_;
+};
+
+class ToyContext : public MPCContext {
+public:
+    explicit ToyContext(const string &id) : MPCContext((int)ID_ARR.size()),
+                                            round0_(MessageType::None, MessageType::BROADCAST, id),
+                                            round1_(MessageType::BROADCAST, MessageType::P2P, id),
+                                            round2_(MessageType::P2P, MessageType::None, id) {
+        AddRound(&round0_);
+        AddRound(&round1_);
+        AddRound(&round2_);
+    }
+
+    ToyRound round0_;
+    ToyRound round1_;
+    ToyRound round2_;
+};
+
+struct Envelope {
+    size_t session_;
+    size_t dst_;
+    string src_;
+    int round_;
+    string p2p_msg_;
+    string bc_msg_;
+};
+
+// Messages between the parties, delivered by one I/O thread
+class Mailbox {
+public:
+    void Put(Envelope envelope) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        queue_.push_back(std::move(envelope));
+        cv_.notify_one();
+    }
+
+    void PutFinished(bool ok) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        finished_num_++;
+        if (!ok) failed_num_++;
+        cv_.notify_one();
+    }
+
+    // Wait for a message, false once all sessions are finished
+    bool Take(Envelope &envelope, int session_num) {
+        std::unique_lock<std::mutex> lk(mutex_);
+        cv_.wait(lk, [&] { return !queue_.empty() || finished_num_ == session_num; });
+        if (queue_.empty()) return false;
+        envelope = std::move(queue_.front());
+        queue_.pop_front();
+        return true;
+    }
+
+    int failed_num() {
+        std::lock_guard<std::mutex> lk(mutex_);
+        return failed_num_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Envelope> queue_;
+    int finished_num_ = 0;
+    int failed_num_ = 0;
+};
+
+void post_messages(Mailbox &mailbox, size_t session, size_t src, const OutboundMessages &out) {
+    for (size_t k = 0; k < out.des_arr_.size(); ++k) {
+        Envelope envelope;
+        envelope.session_ = session;
+        for (size_t j = 0; j < ID_ARR.size(); ++j) {
+            if (ID_ARR[j] == out.des_arr_[k]) envelope.dst_ = j;
+        }
+        envelope.src_ = ID_ARR[src];
+        envelope.round_ = out.round_;
+        envelope.bc_msg_ = out.bc_msg_;
+        if (k < out.p2p_msg_arr_.size()) envelope.p2p_msg_ = out.p2p_msg_arr_[k];
+        mailbox.Put(std::move(envelope));
+    }
+}
+
+TEST(AsyncMPCContext, ManySessionsOneIOThread) {
+    const size_t SESSION_NUM = 8;
+    ThreadPoolExecutor executor(4);
+    Mailbox mailbox;
+    vector<std::unique_ptr<ToyContext>> ctx_arr;
+    vector<std::unique_ptr<AsyncMPCContext>> async_ctx_arr;
+    for (size_t s = 0; s < SESSION_NUM; ++s) {
+        for (size_t i = 0; i < ID_ARR.size(); ++i) {
+            ctx_arr.emplace_back(new ToyContext(ID_ARR[i]));
+            async_ctx_arr.emplace_back(new AsyncMPCContext(ctx_arr.back().get(), &executor));
+            AsyncMPCContext *async_ctx = async_ctx_arr.back().get();
+            async_ctx->set_messages_ready_callback([&mailbox, s, i](const OutboundMessages &out) {
+                post_messages(mailbox, s, i, out);
+            });
+            async_ctx->set_finished_callback([&mailbox](bool ok) { mailbox.PutFinished(ok); });
+        }
+    }
+    for (auto &async_ctx: async_ctx_arr) async_ctx->StartAsync();
+
+    // The I/O thread only hands the messages over
+    Envelope envelope;
+    while (mailbox.Take(envelope, (int)async_ctx_arr.size())) {
+        AsyncMPCContext *async_ctx = async_ctx_arr[envelope.session_ * ID_ARR.size() + envelope.dst_].get();
+        async_ctx->PushMessageAsync(std::move(envelope.p2p_msg_), std::move(envelope.bc_msg_), envelope.src_,
+                                    envelope.round_);
+    }
+    for (auto &async_ctx: async_ctx_arr) {
+        async_ctx->Wait();
+        EXPECT_TRUE(async_ctx->IsOK());
+        EXPECT_TRUE(async_ctx->IsFinished());
+        EXPECT_TRUE(async_ctx->get_context()->IsFinished());
+    }
+    EXPECT_EQ(mailbox.failed_num(), 0);
+}
+
+TEST(AsyncMPCContext, EarlyMessages) {
+    ThreadPoolExecutor executor(2);
+    ToyContext ctx(ID_ARR[0]);
+    AsyncMPCContext async_ctx(&ctx, &executor);
+    vector<OutboundMessages> out_arr;
+    async_ctx.set_messages_ready_callback([&out_arr](const OutboundMessages &out) { out_arr.push_back(out); });
+
+    // Messages of round 1 come first, before the context is even started
+    vector<std::future<bool>> future_arr;
+    for (size_t i = 1; i < ID_ARR.size(); ++i) {
+        future_arr.push_back(async_ctx.PushMessageFuture(ID_ARR[i] + ">" + ID_ARR[0], "", ID_ARR[i], 1));
+    }
+    EXPECT_TRUE(async_ctx.StartFuture().get());
+    for (size_t i = 1; i < ID_ARR.size(); ++i) {
+        future_arr.push_back(async_ctx.PushMessageFuture("", ID_ARR[i], ID_ARR[i], 0));
+    }
+    for (auto &future: future_arr) EXPECT_TRUE(future.get());
+    async_ctx.Wait();
+    EXPECT_TRUE(async_ctx.IsOK());
+    EXPECT_TRUE(async_ctx.IsFinished());
+    ASSERT_EQ(out_arr.size(), (size_t)3);
+    EXPECT_EQ(out_arr[0].round_, 0);
+    EXPECT_EQ(out_arr[0].bc_msg_, ID_ARR[0]);
+    EXPECT_EQ(out_arr[1].round_, 1);
+    EXPECT_EQ(out_arr[1].p2p_msg_arr_.size(), (size_t)3);
+    EXPECT_EQ(out_arr[2].round_, 2);
+
+    // Too late
+    EXPECT_TRUE(async_ctx.PushMessageFuture("", ID_ARR[1], ID_ARR[1], 0).get());
+    EXPECT_FALSE(async_ctx.StartFuture().get());
+}
+
+TEST(AsyncMPCContext, BadMessage) {
+    ThreadPoolExecutor executor(2);
+    ToyContext ctx(ID_ARR[0]);
+    AsyncMPCContext async_ctx(&ctx, &executor);
+    std::promise<bool> finished;
+    async_ctx.set_finished_callback([&finished](bool ok) { finished.set_value(ok); });
+    async_ctx.StartAsync();
+    std::future<bool> good = async_ctx.PushMessageFuture("", ID_ARR[1], ID_ARR[1], 0);
+    std::future<bool> bad = async_ctx.PushMessageFuture("", "forged", ID_ARR[2], 0);
+    std::future<bool> waiting = async_ctx.PushMessageFuture(ID_ARR[1] + ">" + ID_ARR[0], "", ID_ARR[1], 1);
+    EXPECT_TRUE(good.get());
+    EXPECT_FALSE(bad.get());
+    EXPECT_FALSE(waiting.get());
+    EXPECT_FALSE(finished.get_future().get());
+    async_ctx.Wait();
+    EXPECT_FALSE(async_ctx.IsOK());
+    EXPECT_FALSE(async_ctx.IsFinished());
+    EXPECT_FALSE(async_ctx.get_last_error_info().empty());
+    EXPECT_FALSE(async_ctx.PushMessageFuture("", ID_ARR[3], ID_ARR[3], 0).get());
+}
+
+TEST(AsyncMPCContext, StaleMessage) {
+    ThreadPoolExecutor executor(2);
+    ToyContext ctx(ID_ARR[0]);
+    AsyncMPCContext async_ctx(&ctx, &executor);
+    EXPECT_TRUE(async_ctx.StartFuture().get());
+    for (size_t i = 1; i < ID_ARR.size(); ++i) {
+        EXPECT_TRUE(async_ctx.PushMessageFuture("", ID_ARR[i], ID_ARR[i], 0).get());
+    }
+    EXPECT_EQ(async_ctx.get_cur_round(), 1);
+
+    // A round 0 message sent again is dropped and does not fail the context
+    EXPECT_TRUE(async_ctx.PushMessageFuture("", "replayed", ID_ARR[1], 0).get());
+    EXPECT_TRUE(async_ctx.IsOK());
+    for (size_t i = 1; i < ID_ARR.size(); ++i) {
+        EXPECT_TRUE(async_ctx.PushMessageFuture(ID_ARR[i] + ">" + ID_ARR[0], "", ID_ARR[i], 1).get());
+    }
+    async_ctx.Wait();
+    EXPECT_TRUE(async_ctx.IsOK());
+    EXPECT_TRUE(async_ctx.IsFinished());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
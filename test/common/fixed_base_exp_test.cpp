@@ -0,0 +1,40 @@
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/mpc-flow/common/fixed_base_exp.h"
+
+using safeheron::bignum::BN;
+using safeheron::mpc_flow::common::FixedBaseExp;
+
+TEST(FixedBaseExp, Pow) {
+    BN mod = safeheron::rand::RandomBNStrict(4096);
+    if (!mod.IsOdd()) mod = mod + 1;
+    BN base = safeheron::rand::RandomBNLt(mod);
+
+    for (size_t w = 1; w <= 8; ++w) {
+        FixedBaseExp fixed_base_exp(base, mod, 256, w);
+        EXPECT_TRUE(fixed_base_exp.Pow(BN(0)) == BN(1));
+        EXPECT_TRUE(fixed_base_exp.Pow(BN(1)) == base);
+        for (int i = 0; i < 8; ++i) {
+            BN e = safeheron::rand::RandomBN(256);
+            EXPECT_TRUE(fixed_base_exp.Pow(e) == base.PowM(e, mod));
+        }
+    }
+}
+
+TEST(FixedBaseExp, OutOfRange) {
+    BN mod = safeheron::rand::RandomBNStrict(2048);
+    if (!mod.IsOdd()) mod = mod + 1;
+    BN base = safeheron::rand::RandomBNLt(mod);
+    FixedBaseExp fixed_base_exp(base, mod, 64);
+
+    // Exponents longer than the table fall back to PowM.
+    BN e = safeheron::rand::RandomBNStrict(256);
+    EXPECT_TRUE(fixed_base_exp.Pow(e) == base.PowM(e, mod));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
@@ -0,0 +1,261 @@
+#include <cstdio>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/key_store.h"
+
+using std::string;
+using safeheron::mpc_flow::common::KeyStore;
+using safeheron::mpc_flow::common::KeyRecordType;
+
+// A key with the interface of the key classes, the "proto object" is the string itself.
+struct StringProto {
+    bool SerializeToString(string *out) const { *out = value_; return true; }
+    bool ParseFromArray(const void *data, int size) { value_.assign(static_cast<const char *>(data), size); return true; }
+    string value_;
+};
+
+struct StringKey {
+    bool ToProtoObject(StringProto &proto) const { proto.value_ = value_; return true; }
+    bool FromProtoObject(const StringProto &proto) { value_ = proto.value_; return true; }
+    string value_;
+};
+
+class KeyStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char path[] = "/tmp/key_store_test_XXXXXX";
+        int fd = mkstemp(path);
+        ASSERT_GE(fd, 0);
+        close(fd);
+        path_ = path;
+        // Start from an empty file
+        ASSERT_EQ(truncate(path_.c_str(), 0), 0);
+    }
+
+    void TearDown() override {
+        unlink(path_.c_str());
+    }
+
+    string path_;
+};
+
+TEST_F(KeyStoreTest, PutGet) {
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_));
+    EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws1", "party1", "key of party1"));
+    EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws1", "party2", string(10000, 'x')));
+    EXPECT_TRUE(store.Put(KeyRecordType::GG18_SIGN_KEY, "ws1", "party1", "gg18 key of party1"));
+
+    string payload;
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws1", "party1", payload));
+    EXPECT_EQ(payload, "key of party1");
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws1", "party2", payload));
+    EXPECT_EQ(payload, string(10000, 'x'));
+    EXPECT_TRUE(store.Get(KeyRecordType::GG18_SIGN_KEY, "ws1", "party1", payload));
+    EXPECT_EQ(payload, "gg18 key of party1");
+    EXPECT_FALSE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws1", "party3", payload));
+    // No ambiguity between ("ws1", "party1") and ("ws1p", "arty1")
+    EXPECT_FALSE(store.Contains(KeyRecordType::CMP_SIGN_KEY, "ws1p", "arty1"));
+    EXPECT_EQ(store.Size(), (size_t)3);
+
+    // Replace
+    EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws1", "party1", "new key of party1"));
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws1", "party1", payload));
+    EXPECT_EQ(payload, "new key of party1");
+    EXPECT_EQ(store.Size(), (size_t)3);
+}
+
+TEST_F(KeyStoreTest, Reopen) {
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        StringKey key;
+        for (int i = 0; i < 1000; ++i) {
+            key.value_ = "key" + std::to_string(i);
+            EXPECT_TRUE(store.PutKey<StringProto>(KeyRecordType::LINDELL17_P1_KEY_SHARE, "ws", std::to_string(i), key));
+        }
+        key.value_ = "key0 again";
+        EXPECT_TRUE(store.PutKey<StringProto>(KeyRecordType::LINDELL17_P1_KEY_SHARE, "ws", "0", key, true));
+    }
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_, true));
+    EXPECT_EQ(store.Size(), (size_t)1000);
+    StringKey key;
+    EXPECT_TRUE(store.GetKey<StringProto>(KeyRecordType::LINDELL17_P1_KEY_SHARE, "ws", "0", key));
+    EXPECT_EQ(key.value_, "key0 again");
+    EXPECT_TRUE(store.GetKey<StringProto>(KeyRecordType::LINDELL17_P1_KEY_SHARE, "ws", "999", key));
+    EXPECT_EQ(key.value_, "key999");
+    // Read only
+    EXPECT_FALSE(store.Put(KeyRecordType::LINDELL17_P1_KEY_SHARE, "ws", "1000", "key1000"));
+}
+
+TEST_F(KeyStoreTest, OneWriter) {
+    KeyStore writer;
+    ASSERT_TRUE(writer.Open(path_));
+    KeyStore other_writer;
+    EXPECT_FALSE(other_writer.Open(path_));
+
+    KeyStore reader;
+    ASSERT_TRUE(reader.Open(path_, true));
+    EXPECT_TRUE(writer.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key1"));
+    EXPECT_FALSE(reader.Contains(KeyRecordType::CMP_SIGN_KEY, "ws", "party1"));
+    EXPECT_TRUE(reader.Reload());
+    string payload;
+    EXPECT_TRUE(reader.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", payload));
+    EXPECT_EQ(payload, "key1");
+}
+
+TEST_F(KeyStoreTest, TornRecord) {
+    size_t good_size = 0;
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key1"));
+        good_size = store.FileSize();
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", string(1000, 'y')));
+    }
+    // Cut the last record short
+    ASSERT_EQ(truncate(path_.c_str(), (off_t)(good_size + 100)), 0);
+
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_));
+    EXPECT_EQ(store.Size(), (size_t)1);
+    EXPECT_EQ(store.FileSize(), good_size);
+    EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", "key2"));
+    string payload;
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", payload));
+    EXPECT_EQ(payload, "key2");
+}
+
+TEST_F(KeyStoreTest, MissingPadding) {
+    size_t unpadded_size = 0;
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key1"));
+        // 40 + 2 + 6 + 5 bytes, 3 of padding
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", "key22"));
+        unpadded_size = store.FileSize() - 3;
+    }
+    // The padding of the last record did not reach the disk
+    ASSERT_EQ(truncate(path_.c_str(), (off_t)unpadded_size), 0);
+
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_EQ(store.Size(), (size_t)2);
+        EXPECT_EQ(store.FileSize(), unpadded_size + 3);
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party3", "key3"));
+    }
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_, true));
+    string payload;
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", payload));
+    EXPECT_EQ(payload, "key22");
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party3", payload));
+    EXPECT_EQ(payload, "key3");
+}
+
+TEST_F(KeyStoreTest, Corrupted) {
+    size_t first_size = 0;
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key1"));
+        first_size = store.FileSize();
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key2"));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", "key3"));
+    }
+    // Flip the last byte of the payload of the second record, whose size is still consistent
+    FILE *file = fopen(path_.c_str(), "r+b");
+    ASSERT_TRUE(file != nullptr);
+    fseek(file, (long)(first_size + 40 + 2 + 6 + 3), SEEK_SET);
+    fputc('X', file);
+    fclose(file);
+
+    // The payload of the damaged record fails its check when looked up, the previous version of the key is served
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_, true));
+    string payload;
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", payload));
+    EXPECT_EQ(payload, "key1");
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", payload));
+    EXPECT_EQ(payload, "key3");
+
+    // Not a key store
+    file = fopen(path_.c_str(), "wb");
+    fputs("not a key store", file);
+    fclose(file);
+    EXPECT_FALSE(store.Open(path_, true));
+}
+
+TEST_F(KeyStoreTest, TornLastRecord) {
+    size_t good_size = 0;
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key1"));
+        good_size = store.FileSize();
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key2"));
+    }
+    // The body of the last record is the size of its header says, but its bytes did not all reach the disk
+    FILE *file = fopen(path_.c_str(), "r+b");
+    ASSERT_TRUE(file != nullptr);
+    fseek(file, (long)(good_size + 40 + 2 + 6), SEEK_SET);
+    fputc(0, file);
+    fclose(file);
+
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_));
+    EXPECT_EQ(store.FileSize(), good_size);
+    string payload;
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", payload));
+    EXPECT_EQ(payload, "key1");
+}
+
+TEST_F(KeyStoreTest, DamagedHeader) {
+    size_t first_size = 0;
+    size_t full_size = 0;
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", "key1"));
+        first_size = store.FileSize();
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", string(1000, 'y')));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party3", "key3"));
+        full_size = store.FileSize();
+    }
+    // Damage the payload size of the second record, so its end is lost
+    FILE *file = fopen(path_.c_str(), "r+b");
+    ASSERT_TRUE(file != nullptr);
+    fseek(file, (long)(first_size + 16), SEEK_SET);
+    fputc(0x7F, file);
+    fclose(file);
+
+    // Opened for writing, the good record after the damaged one is kept
+    {
+        KeyStore store;
+        ASSERT_TRUE(store.Open(path_));
+        EXPECT_EQ(store.FileSize(), full_size);
+        EXPECT_TRUE(store.Contains(KeyRecordType::CMP_SIGN_KEY, "ws", "party1"));
+        EXPECT_FALSE(store.Contains(KeyRecordType::CMP_SIGN_KEY, "ws", "party2"));
+        EXPECT_TRUE(store.Put(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", "key2"));
+    }
+    KeyStore store;
+    ASSERT_TRUE(store.Open(path_, true));
+    EXPECT_EQ(store.Size(), (size_t)3);
+    string payload;
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party1", payload));
+    EXPECT_EQ(payload, "key1");
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party2", payload));
+    EXPECT_EQ(payload, "key2");
+    EXPECT_TRUE(store.Get(KeyRecordType::CMP_SIGN_KEY, "ws", "party3", payload));
+    EXPECT_EQ(payload, "key3");
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/metrics.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "../message.h"
+
+using std::string;
+using std::vector;
+using safeheron::mpc_flow::common::Stage;
+using safeheron::mpc_flow::common::Primitive;
+using safeheron::mpc_flow::common::StageMetrics;
+using safeheron::mpc_flow::common::CountPrimitive;
+using safeheron::mpc_flow::common::ParallelFor;
+using safeheron::mpc_flow::common::CounterMetricsSink;
+using safeheron::mpc_flow::common::CallbackMetricsSink;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCRound;
+using safeheron::mpc_flow::mpc_parallel_v2::MessageType;
+
+// A toy protocol of 2 rounds: every party broadcasts its id in round 0, and counts 4 ZK proofs in round 1 on a
+// worker pool.
+class ToyRound : public MPCRound {
+public:
+    ToyRound(MessageType in, MessageType out, string id) : MPCRound(in, out), id_(std::move(id)) {}
+
+    bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override {
+        return bc_msg == party_id;
+    }
+
+    bool ReceiveVerify(const std::string &party_id) override {
+        CountPrimitive(Primitive::ZKVerify);
+        return true;
+    }
+
+    bool ComputeVerify() override {
+        ParallelFor(4, [](size_t i) { CountPrimitive(Primitive::ZKProve); }, 4);
+        return true;
+    }
+
+    bool MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                     std::vector<std::string> &out_des_arr) const override {
+        out_p2p_msg_arr.clear();
+        out_des_arr.clear();
+        out_bc_msg = id_;
+        for (const auto &id: id_arr_) {
+            if (id != id_) out_des_arr.push_back(id);
+        }
+        return true;
+    }
+
+    string id_;
+    vector<string> id_arr_ = {"party1", "party2", "party3"};
+};
+
+class ToyContext : public MPCContext {
+public:
+    explicit ToyContext(const string &id) : MPCContext(3),
+                                            round0_(MessageType::None, MessageType::BROADCAST, id),
+                                            round1_(MessageType::BROADCAST, MessageType::BROADCAST, id) {
+        AddRound(&round0_);
+        AddRound(&round1_);
+    }
+
+    ToyRound round0_;
+    ToyRound round1_;
+};
+
+void run_toy_protocol(vector<ToyContext *> &ctx_arr) {
+    std::map<std::string, std::vector<Msg>> map_id_queue;
+    for (auto ctx: ctx_arr) {
+        EXPECT_TRUE(ctx->PushMessage());
+        vector<string> out_p2p_msg_arr, out_des_arr;
+        string out_bc_msg;
+        EXPECT_TRUE(ctx->PopMessages(out_p2p_msg_arr, out_bc_msg, out_des_arr));
+        for (const auto &des: out_des_arr) {
+            map_id_queue[des].push_back({ctx->round0_.id_, out_bc_msg, string()});
+        }
+    }
+    for (auto ctx: ctx_arr) {
+        for (const auto &msg: map_id_queue[ctx->round0_.id_]) {
+            EXPECT_TRUE(ctx->PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.src_, 0));
+        }
+        EXPECT_TRUE(ctx->IsFinished());
+    }
+}
+
+TEST(Metrics, CounterSink) {
+    ToyContext ctx1("party1"), ctx2("party2"), ctx3("party3");
+    vector<ToyContext *> ctx_arr = {&ctx1, &ctx2, &ctx3};
+    CounterMetricsSink sink;
+    for (auto ctx: ctx_arr) ctx->set_metrics_sink(&sink, "session");
+
+    run_toy_protocol(ctx_arr);
+
+    // 3 parties * 2 rounds
+    EXPECT_EQ(sink.get_calls(Stage::ComputeVerify), 6u);
+    EXPECT_EQ(sink.get_calls(Stage::MakeMessage), 6u);
+    // 3 parties * 2 messages
+    EXPECT_EQ(sink.get_calls(Stage::ParseMsg), 6u);
+    EXPECT_EQ(sink.get_calls(Stage::ReceiveVerify), 6u);
+    EXPECT_EQ(sink.get_primitive_count(Stage::ReceiveVerify, Primitive::ZKVerify), 6u);
+    EXPECT_EQ(sink.get_primitive_count(Stage::ParseMsg, Primitive::ZKVerify), 0u);
+    // Primitives counted on the worker threads belong to the stage.
+    EXPECT_EQ(sink.get_primitive_count(Stage::ComputeVerify, Primitive::ZKProve), 24u);
+
+    sink.Reset();
+    EXPECT_EQ(sink.get_calls(Stage::ComputeVerify), 0u);
+}
+
+TEST(Metrics, CallbackSink) {
+    ToyContext ctx1("party1"), ctx2("party2"), ctx3("party3");
+    vector<ToyContext *> ctx_arr = {&ctx1, &ctx2, &ctx3};
+    std::mutex mutex;
+    vector<StageMetrics> metrics_arr;
+    CallbackMetricsSink sink([&](const StageMetrics &metrics) {
+        std::lock_guard<std::mutex> lk(mutex);
+        metrics_arr.push_back(metrics);
+    });
+    ctx1.set_metrics_sink(&sink, "session_1");
+
+    run_toy_protocol(ctx_arr);
+
+    // Round 0: ComputeVerify, MakeMessage. Round 1: 2 * (ParseMsg, ReceiveVerify), ComputeVerify, MakeMessage.
+    EXPECT_EQ(metrics_arr.size(), 8u);
+    for (const auto &metrics: metrics_arr) {
+        EXPECT_EQ(metrics.session_id_, "session_1");
+    }
+    EXPECT_EQ(metrics_arr[0].round_index_, 0);
+    EXPECT_EQ(metrics_arr[0].stage_, Stage::ComputeVerify);
+    EXPECT_EQ(metrics_arr[0].primitive_count_[static_cast<size_t>(Primitive::ZKProve)], 4u);
+    EXPECT_EQ(metrics_arr[7].round_index_, 1);
+    EXPECT_EQ(metrics_arr[7].stage_, Stage::MakeMessage);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
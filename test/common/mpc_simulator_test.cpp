@@ -0,0 +1,181 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_simulator.h"
+
+using std::string;
+using std::vector;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCRound;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCSimulator;
+using safeheron::mpc_flow::mpc_parallel_v2::SimulatorConfig;
+using safeheron::mpc_flow::mpc_parallel_v2::SimulatorStats;
+using safeheron::mpc_flow::mpc_parallel_v2::MessageType;
+
+const vector<string> ID_ARR = {"party1", "party2", "party3", "party4"};
+
+// A toy protocol of 3 rounds: every party broadcasts its id in round 0, sends "src>dst" to every other party in
+// round 1, and checks what it got in round 2. Messages received are logged in order.
+class ToyRound : public MPCRound {
+public:
+    ToyRound(MessageType in, MessageType out, string id, vector<string> *log) : MPCRound(in, out),
+                                                                                id_(std::move(id)), log_(log) {}
+
+    bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override {
+        log_->push_back(party_id);
+        if (get_round_index() == 1) return bc_msg == party_id;
+        return p2p_msg == party_id + ">" + id_;
+    }
+
+    bool ReceiveVerify(const std::string &party_id) override {
+        return true;
+    }
+
+    bool ComputeVerify() override {
+        return true;
+    }
+
+    bool MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                     std::vector<std::string> &out_des_arr) const override {
+        out_p2p_msg_arr.clear();
+        out_des_arr.clear();
+        out_bc_msg.clear();
+        if (get_round_index() == 2) return true;
+        for (const auto &id: ID_ARR) {
+            if (id == id_) continue;
+            out_des_arr.push_back(id);
+            if (get_round_index() == 1) out_p2p_msg_arr.push_back(id_ + ">" + id);
+        }
+        if (get_round_index() == 0) out_bc_msg = id_;
+        return true;
+    }
+
+    string id_;
+    vector<string> *log_;
+};
+
+class ToyContext : public MPCContext {
+public:
+    explicit ToyContext(const string &id) : MPCContext((int)ID_ARR.size()),
+                                            round0_(MessageType::None, MessageType::BROADCAST, id, &log_),
+                                            round1_(MessageType::BROADCAST, MessageType::P2P, id, &log_),
+                                            round2_(MessageType::P2P, MessageType::None, id, &log_) {
+        AddRound(&round0_);
+        AddRound(&round1_);
+        AddRound(&round2_);
+    }
+
+    vector<string> log_;
+    ToyRound round0_;
+    ToyRound round1_;
+    ToyRound round2_;
+};
+
+bool run_toy_protocol(const SimulatorConfig &config, SimulatorStats &stats, vector<vector<string>> &log_arr) {
+    vector<std::unique_ptr<ToyContext>> ctx_arr;
+    MPCSimulator simulator(config);
+    for (const auto &id: ID_ARR) {
+        ctx_arr.emplace_back(new ToyContext(id));
+        simulator.AddParty(id, ctx_arr.back().get());
+    }
+    bool ok = simulator.Run();
+    EXPECT_EQ(ok, simulator.get_error_info().empty());
+    stats = simulator.get_stats();
+    log_arr.clear();
+    for (const auto &ctx: ctx_arr) {
+        EXPECT_EQ(ok, ctx->IsFinished() != 0);
+        log_arr.push_back(ctx->log_);
+    }
+    return ok;
+}
+
+TEST(MPCSimulator, NoDelay) {
+    SimulatorConfig config;
+    SimulatorStats stats;
+    vector<vector<string>> log_arr;
+    EXPECT_TRUE(run_toy_protocol(config, stats, log_arr));
+    EXPECT_EQ(stats.message_count_, (uint64_t)(2 * 4 * 3));
+    EXPECT_EQ(stats.lost_count_, (uint64_t)0);
+    EXPECT_EQ(stats.round_finish_us_.size(), (size_t)3);
+}
+
+TEST(MPCSimulator, Latency) {
+    SimulatorConfig config;
+    config.latency_us_ = 50000;
+    config.count_compute_time_ = false;
+    SimulatorStats stats;
+    vector<vector<string>> log_arr;
+    EXPECT_TRUE(run_toy_protocol(config, stats, log_arr));
+    // Two rounds of messages
+    EXPECT_EQ(stats.elapsed_us_, (uint64_t)100000);
+    EXPECT_EQ(stats.round_finish_us_[1], (uint64_t)50000);
+}
+
+TEST(MPCSimulator, Bandwidth) {
+    SimulatorConfig config;
+    // One byte per ms, the 3 broadcasts of 6 bytes are serialized on the uplink
+    config.bandwidth_bytes_per_sec_ = 1000;
+    config.count_compute_time_ = false;
+    SimulatorStats stats;
+    vector<vector<string>> log_arr;
+    EXPECT_TRUE(run_toy_protocol(config, stats, log_arr));
+    EXPECT_EQ(stats.round_finish_us_[1], (uint64_t)18000);
+}
+
+TEST(MPCSimulator, DeterministicWithSeed) {
+    SimulatorConfig config;
+    config.latency_us_ = 1000;
+    config.jitter_us_ = 5000;
+    config.loss_rate_ = 0.3;
+    config.retransmit_timeout_us_ = 2000;
+    config.count_compute_time_ = false;
+    config.seed_ = 42;
+    SimulatorStats stats0, stats1;
+    vector<vector<string>> log_arr0, log_arr1;
+    EXPECT_TRUE(run_toy_protocol(config, stats0, log_arr0));
+    EXPECT_TRUE(run_toy_protocol(config, stats1, log_arr1));
+    EXPECT_EQ(stats0.elapsed_us_, stats1.elapsed_us_);
+    EXPECT_EQ(stats0.lost_count_, stats1.lost_count_);
+    EXPECT_EQ(stats0.round_finish_us_, stats1.round_finish_us_);
+    EXPECT_EQ(log_arr0, log_arr1);
+    EXPECT_EQ(stats0.dropped_count_, (uint64_t)0);
+}
+
+TEST(MPCSimulator, LossWithoutRetransmit) {
+    SimulatorConfig config;
+    config.loss_rate_ = 1.0;
+    SimulatorStats stats;
+    vector<vector<string>> log_arr;
+    EXPECT_FALSE(run_toy_protocol(config, stats, log_arr));
+    EXPECT_EQ(stats.dropped_count_, (uint64_t)(4 * 3));
+}
+
+TEST(MPCSimulator, MultiThreaded) {
+    SimulatorConfig config;
+    config.multi_threaded_ = true;
+    config.latency_us_ = 2000;
+    config.jitter_us_ = 2000;
+    config.loss_rate_ = 0.2;
+    config.retransmit_timeout_us_ = 1000;
+    SimulatorStats stats;
+    vector<vector<string>> log_arr;
+    EXPECT_TRUE(run_toy_protocol(config, stats, log_arr));
+    EXPECT_GE(stats.elapsed_us_, (uint64_t)4000);
+    for (const auto &log: log_arr) EXPECT_EQ(log.size(), (size_t)6);
+}
+
+TEST(MPCSimulator, MultiThreadedStalled) {
+    SimulatorConfig config;
+    config.multi_threaded_ = true;
+    config.loss_rate_ = 1.0;
+    SimulatorStats stats;
+    vector<vector<string>> log_arr;
+    EXPECT_FALSE(run_toy_protocol(config, stats, log_arr));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
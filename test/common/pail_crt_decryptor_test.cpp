@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-paillier/pail.h"
+#include "multi-party-sig/mpc-flow/common/pail_crt_decryptor.h"
+
+using safeheron::bignum::BN;
+using safeheron::pail::PailPubKey;
+using safeheron::pail::PailPrivKey;
+using safeheron::mpc_flow::common::PailCRTDecryptor;
+
+TEST(PailCRTDecryptor, Decrypt) {
+    PailPrivKey priv;
+    PailPubKey pub;
+    safeheron::pail::CreateKeyPair2048(priv, pub);
+
+    PailCRTDecryptor decryptor;
+    EXPECT_TRUE(decryptor.Init(pub, priv));
+
+    for (int i = 0; i < 16; ++i) {
+        BN m = safeheron::rand::RandomBNLt(pub.n());
+        BN c = pub.Encrypt(m);
+        EXPECT_TRUE(decryptor.Decrypt(c) == m);
+        EXPECT_TRUE(decryptor.Decrypt(c) == priv.Decrypt(c));
+    }
+
+    // Boundaries
+    EXPECT_TRUE(decryptor.Decrypt(pub.Encrypt(BN(0))) == BN(0));
+    EXPECT_TRUE(decryptor.Decrypt(pub.Encrypt(pub.n() - 1)) == pub.n() - 1);
+}
+
+TEST(PailCRTDecryptor, DecryptNeg) {
+    PailPrivKey priv;
+    PailPubKey pub;
+    safeheron::pail::CreateKeyPair2048(priv, pub);
+
+    PailCRTDecryptor decryptor;
+    EXPECT_TRUE(decryptor.Init(pub, priv));
+
+    for (int i = 0; i < 16; ++i) {
+        BN m = safeheron::rand::RandomBNLt(pub.n() / 2);
+        if (i % 2) m = m.Neg();
+        BN r = safeheron::rand::RandomBNLtCoPrime(pub.n());
+        BN c = pub.EncryptNegWithR(m, r);
+        EXPECT_TRUE(decryptor.DecryptNeg(c) == m);
+        EXPECT_TRUE(decryptor.DecryptNeg(c) == priv.DecryptNeg(c));
+    }
+}
+
+TEST(PailCRTDecryptor, MismatchedKey) {
+    PailPrivKey priv1, priv2;
+    PailPubKey pub1, pub2;
+    safeheron::pail::CreateKeyPair2048(priv1, pub1);
+    safeheron::pail::CreateKeyPair2048(priv2, pub2);
+
+    PailCRTDecryptor decryptor;
+    EXPECT_FALSE(decryptor.Init(pub1, priv2));
+    EXPECT_FALSE(decryptor.IsInitialized());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
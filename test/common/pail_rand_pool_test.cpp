@@ -0,0 +1,59 @@
+#include <memory>
+#include <thread>
+#include <chrono>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-paillier/pail.h"
+#include "multi-party-sig/mpc-flow/common/pail_rand_pool.h"
+
+using safeheron::bignum::BN;
+using safeheron::pail::PailPubKey;
+using safeheron::pail::PailPrivKey;
+using safeheron::mpc_flow::common::PailRandPool;
+using safeheron::mpc_flow::common::SampleEncRandomness;
+using safeheron::mpc_flow::common::EncryptWithRN;
+using safeheron::mpc_flow::common::HomomorphicAddPlainWithRN;
+
+TEST(PailRandPool, EncryptWithPool) {
+    PailPrivKey priv;
+    PailPubKey pub;
+    safeheron::pail::CreateKeyPair2048(priv, pub);
+
+    std::shared_ptr<PailRandPool> pool = std::make_shared<PailRandPool>(pub.n(), 8, 2);
+    // Wait for the background workers to fill the pool
+    while (pool->Size() < pool->Capacity()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    PailRandPool::Register(pool);
+    EXPECT_EQ(PailRandPool::Find(pub.n()), pool);
+
+    for (int i = 0; i < 16; ++i) {
+        BN m = safeheron::rand::RandomBNLt(pub.n());
+        BN r, r_pow_N;
+        SampleEncRandomness(pub, r, r_pow_N);
+        EXPECT_TRUE(r_pow_N == r.PowM(pub.n(), pub.n_sqr()));
+
+        BN c = EncryptWithRN(pub, m, r_pow_N);
+        EXPECT_TRUE(c == pub.EncryptWithR(m, r));
+        EXPECT_TRUE(priv.Decrypt(c) == m);
+
+        // Negative plaintext
+        BN c_neg = EncryptWithRN(pub, m.Neg(), r_pow_N);
+        EXPECT_TRUE(c_neg == pub.EncryptNegWithR(m.Neg(), r));
+
+        BN m2 = safeheron::rand::RandomBNLt(pub.n());
+        BN c2 = HomomorphicAddPlainWithRN(pub, c, m2, r_pow_N);
+        EXPECT_TRUE(c2 == pub.HomomorphicAddPlainWithR(c, m2, r));
+    }
+
+    PailRandPool::Unregister(pub.n());
+    EXPECT_EQ(PailRandPool::Find(pub.n()), nullptr);
+    pool->Stop();
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
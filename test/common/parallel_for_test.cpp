@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/parallel_for.h"
+
+using std::vector;
+using safeheron::mpc_flow::common::ParallelFor;
+using safeheron::mpc_flow::common::ParallelForAll;
+
+// Counts the tasks running at the same time
+class Concurrency {
+public:
+    void Enter() {
+        size_t cur = ++active_;
+        size_t max = max_.load();
+        while (cur > max && !max_.compare_exchange_weak(max, cur)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    void Leave() { --active_; }
+
+    size_t get_max() const { return max_.load(); }
+
+private:
+    std::atomic<size_t> active_{0};
+    std::atomic<size_t> max_{0};
+};
+
+TEST(ParallelFor, AllTasksRun) {
+    vector<int> done(100, 0);
+    ParallelFor(done.size(), [&done](size_t i) { done[i] = 1; }, 4);
+    EXPECT_EQ(std::count(done.begin(), done.end(), 1), 100);
+}
+
+TEST(ParallelFor, FirstFailed) {
+    size_t first_failed = 0;
+    EXPECT_FALSE(ParallelForAll(100, [](size_t i) { return i != 37 && i != 60; }, first_failed, 4));
+    EXPECT_EQ(first_failed, 37u);
+    EXPECT_TRUE(ParallelForAll(100, [](size_t i) { return true; }, first_failed, 4));
+    EXPECT_EQ(first_failed, 100u);
+}
+
+TEST(ParallelFor, NestedLoopsShareThreads) {
+    // 4 outer threads of a cap of 8: each inner loop gets 2, whatever it asks for
+    Concurrency concurrency;
+    ParallelFor(4, [&concurrency](size_t i) {
+        ParallelFor(16, [&concurrency](size_t j) {
+            concurrency.Enter();
+            concurrency.Leave();
+        });
+        size_t first_failed = 0;
+        ParallelForAll(16, [&concurrency](size_t j) {
+            concurrency.Enter();
+            concurrency.Leave();
+            return true;
+        }, first_failed, 16);
+    }, 8);
+    EXPECT_LE(concurrency.get_max(), 8u);
+
+    // As many outer threads as the cap: the inner loops run on the thread of their task
+    Concurrency serial;
+    ParallelFor(4, [&serial](size_t i) {
+        ParallelFor(16, [&serial](size_t j) {
+            serial.Enter();
+            serial.Leave();
+        });
+    }, 4);
+    EXPECT_LE(serial.get_max(), 4u);
+
+    // The cap is gone once the outer loop is over
+    Concurrency top;
+    ParallelFor(8, [&top](size_t i) {
+        top.Enter();
+        top.Leave();
+    }, 8);
+    EXPECT_GT(top.get_max(), 1u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
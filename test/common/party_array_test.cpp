@@ -0,0 +1,85 @@
+#include <map>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/party_array.h"
+
+using std::map;
+using std::string;
+using std::vector;
+using safeheron::mpc_flow::common::PartyArrayFromMap;
+using safeheron::mpc_flow::common::PartyArrayToMap;
+using safeheron::mpc_flow::common::PartyMatrix;
+using safeheron::mpc_flow::common::SortPartyPositions;
+
+// Remote parties, then the local party
+const vector<string> ID_ARR = {"co_signer3", "co_signer1", "co_signer4", "co_signer2"};
+
+TEST(PartyArray, SortPartyPositions) {
+    vector<size_t> pos_arr;
+    SortPartyPositions(ID_ARR, pos_arr);
+    EXPECT_EQ(pos_arr, vector<size_t>({1, 3, 0, 2}));
+
+    // The order of a map keyed by party id
+    map<string, int> map_id_value;
+    for (size_t i = 0; i < ID_ARR.size(); ++i) map_id_value[ID_ARR[i]] = (int)i;
+    size_t k = 0;
+    for (const auto &item: map_id_value) EXPECT_EQ((size_t)item.second, pos_arr[k++]);
+}
+
+TEST(PartyArray, MapConversion) {
+    vector<int> value_arr = {30, 10, 40, 20};
+    map<string, int> map_id_value;
+    PartyArrayToMap(value_arr, ID_ARR, map_id_value);
+    EXPECT_EQ(map_id_value.size(), (size_t)4);
+    EXPECT_EQ(map_id_value["co_signer3"], 30);
+
+    vector<int> out_arr;
+    EXPECT_TRUE(PartyArrayFromMap(map_id_value, ID_ARR, out_arr));
+    EXPECT_EQ(out_arr, value_arr);
+
+    // Without the sender
+    PartyArrayToMap(value_arr, ID_ARR, map_id_value, 2);
+    EXPECT_EQ(map_id_value.count("co_signer4"), (size_t)0);
+    EXPECT_FALSE(PartyArrayFromMap(map_id_value, ID_ARR, out_arr));
+    EXPECT_TRUE(PartyArrayFromMap(map_id_value, ID_ARR, out_arr, 2));
+    EXPECT_EQ(out_arr[0], 30);
+    EXPECT_EQ(out_arr[3], 20);
+
+    // Unknown party
+    map_id_value.erase("co_signer1");
+    map_id_value["co_signer5"] = 50;
+    EXPECT_FALSE(PartyArrayFromMap(map_id_value, ID_ARR, out_arr, 2));
+}
+
+TEST(PartyMatrix, FromMapToMap) {
+    map<string, map<string, int>> in;
+    in["co_signer1"]["co_signer2"] = 12;
+    in["co_signer1"]["co_signer3"] = 13;
+    in["co_signer4"]["co_signer1"] = 41;
+
+    PartyMatrix<int> matrix;
+    ASSERT_TRUE(matrix.FromMap(in, ID_ARR));
+    EXPECT_EQ(matrix.size(), (size_t)4);
+    EXPECT_TRUE(matrix.Has(1, 3));
+    EXPECT_EQ(matrix.At(1, 3), 12);
+    EXPECT_EQ(matrix.At(2, 1), 41);
+    EXPECT_FALSE(matrix.Has(3, 1));
+    EXPECT_FALSE(matrix.Has(1, 1));
+
+    map<string, map<string, int>> out;
+    matrix.ToMap(ID_ARR, out);
+    EXPECT_EQ(out, in);
+
+    in["co_signer5"]["co_signer1"] = 51;
+    EXPECT_FALSE(matrix.FromMap(in, ID_ARR));
+
+    matrix.Reset(2);
+    EXPECT_EQ(matrix.size(), (size_t)2);
+    EXPECT_FALSE(matrix.Has(1, 1));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
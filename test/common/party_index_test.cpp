@@ -0,0 +1,35 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/party_index.h"
+
+using safeheron::mpc_flow::common::PartyIndex;
+
+struct Party {
+    std::string party_id_;
+};
+
+TEST(PartyIndex, Find) {
+    std::vector<Party> party_arr;
+    for (int i = 0; i < 100; ++i) party_arr.push_back({"co_signer" + std::to_string(i)});
+    // The first one wins, as a linear scan
+    party_arr.push_back({"co_signer7"});
+
+    PartyIndex index;
+    index.Build(party_arr);
+    EXPECT_EQ(index.Size(), (size_t)100);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(index.Find("co_signer" + std::to_string(i)), i);
+    EXPECT_EQ(index.Find("co_signer100"), -1);
+    EXPECT_EQ(index.Find(""), -1);
+
+    // Rebuilt from scratch
+    party_arr.resize(2);
+    index.Build(party_arr);
+    EXPECT_EQ(index.Size(), (size_t)2);
+    EXPECT_EQ(index.Find("co_signer7"), -1);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,54 @@
+#include <string>
+#include <google/protobuf/struct.pb.h>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/common/proto_arena.h"
+
+using google::protobuf::Struct;
+using google::protobuf::Value;
+using safeheron::mpc_flow::common::ProtoArenaScope;
+
+void fill(Struct &obj, int k) {
+    for (int i = 0; i < 32; ++i) {
+        Value &value = (*obj.mutable_fields())["field_" + std::to_string(i)];
+        value.set_string_value(std::string(64, (char)('a' + (i + k) % 26)));
+    }
+}
+
+TEST(ProtoArenaScope, EncodeDecode) {
+    for (int k = 0; k < 100; ++k) {
+        std::string bin;
+        {
+            ProtoArenaScope arena_scope;
+            Struct &obj = *arena_scope.Create<Struct>();
+            EXPECT_EQ(obj.GetArena(), arena_scope.arena());
+            fill(obj, k);
+            bin = obj.SerializeAsString();
+        }
+        ProtoArenaScope arena_scope;
+        Struct &obj = *arena_scope.Create<Struct>();
+        ASSERT_TRUE(obj.ParseFromString(bin));
+        EXPECT_EQ(obj.fields().size(), 32);
+        EXPECT_EQ(obj.fields().at("field_1").string_value(), std::string(64, (char)('a' + (1 + k) % 26)));
+    }
+}
+
+TEST(ProtoArenaScope, Nested) {
+    ProtoArenaScope outer;
+    Struct &obj = *outer.Create<Struct>();
+    fill(obj, 0);
+    {
+        ProtoArenaScope inner;
+        EXPECT_EQ(inner.arena(), outer.arena());
+        Struct &tmp = *inner.Create<Struct>();
+        fill(tmp, 1);
+        obj.MergeFrom(tmp);
+    }
+    // The inner scope did not reset the arena
+    EXPECT_EQ(obj.fields().size(), 32);
+    EXPECT_EQ(obj.fields().at("field_0").string_value(), std::string(64, 'b'));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
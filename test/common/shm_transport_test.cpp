@@ -0,0 +1,223 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/shm_transport.h"
+
+using std::string;
+using std::vector;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCRound;
+using safeheron::mpc_flow::mpc_parallel_v2::MessageType;
+using safeheron::mpc_flow::mpc_parallel_v2::ShmRing;
+using safeheron::mpc_flow::mpc_parallel_v2::ShmTransport;
+
+const vector<string> ID_ARR = {"party1", "party2", "party3", "party4"};
+
+// Names unique to this run of the test
+string ring_prefix(const string &name) {
+    return "/shm_transport_test_" + std::to_string(getpid()) + "_" + name;
+}
+
+// A toy protocol of 3 rounds: every party broadcasts its id in round 0, sends "src>dst" to every other party in
+// round 1, and checks what it got in round 2.
+class ToyRound : public MPCRound {
+public:
+    ToyRound(MessageType in, MessageType out, string id) : MPCRound(in, out), id_(std::move(id)) {}
+
+    bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override {
+        if (get_round_index() == 1) return bc_msg == party_id;
+        return p2p_msg == party_id + ">" + id_;
+    }
+
+    bool ReceiveVerify(const std::string &party_id) override {
+        return true;
+    }
+
+    bool ComputeVerify() override {
+        return true;
+    }
+
+    bool MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                     std::vector<std::string> &out_des_arr) const override {
+        out_p2p_msg_arr.clear();
+        out_des_arr.clear();
+        out_bc_msg.clear();
+        if (get_round_index() == 2) return true;
+        for (const auto &id: ID_ARR) {
+            if (id == id_) continue;
+            out_des_arr.push_back(id);
+            if (get_round_index() == 1) out_p2p_msg_arr.push_back(id_ + ">" + id);
+        }
+        if (get_round_index() == 0) out_bc_msg = id_;
+        return true;
+    }
+
+    string id_;
+};
+
+class ToyContext : public MPCContext {
+public:
+    explicit ToyContext(const string &id) : MPCContext((int)ID_ARR.size()),
+                                            round0_(MessageType::None, MessageType::BROADCAST, id),
+                                            round1_(MessageType::BROADCAST, MessageType::P2P, id),
+                                            round2_(MessageType::P2P, MessageType::None, id) {
+        AddRound(&round0_);
+        AddRound(&round1_);
+        AddRound(&round2_);
+    }
+
+    ToyRound round0_;
+    ToyRound round1_;
+    ToyRound round2_;
+};
+
+// Run the sessions of one party
+bool run_party(const string &prefix, size_t index, const vector<string> &ssid_arr) {
+    vector<string> remote_id_arr;
+    for (size_t i = 0; i < ID_ARR.size(); ++i) {
+        if (i != index) remote_id_arr.push_back(ID_ARR[i]);
+    }
+    ShmTransport transport(prefix, ID_ARR[index], remote_id_arr, 4096);
+    if (!transport.Init(10000)) {
+        std::cout << ID_ARR[index] << ": " << transport.get_error_info() << std::endl;
+        return false;
+    }
+    for (const auto &ssid: ssid_arr) {
+        ToyContext ctx(ID_ARR[index]);
+        if (!transport.Run(&ctx, ssid, 10000) || !ctx.IsFinished()) {
+            std::cout << ID_ARR[index] << ": " << transport.get_error_info() << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(ShmRing, WrapAround) {
+    const string name = ring_prefix("ring");
+    ShmRing consumer;
+    ASSERT_TRUE(consumer.Create(name, 4096));
+    ShmRing producer;
+    ASSERT_TRUE(producer.Open(name));
+    EXPECT_EQ(producer.MaxFrameSize(), (size_t)(2048 - 8));
+
+    const int FRAME_NUM = 100000;
+    std::thread writer([&] {
+        for (int i = 0; i < FRAME_NUM; ++i) {
+            string payload(i % 1000, (char)i);
+            ShmRing::Segment segment_arr[] = {{&i, sizeof(i)}, {payload.data(), payload.size()}};
+            while (!producer.TryWrite(segment_arr, 2)) std::this_thread::yield();
+        }
+    });
+    int bad_num = 0;
+    for (int i = 0; i < FRAME_NUM; ++i) {
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+        while (!consumer.Peek(data, size)) std::this_thread::yield();
+        int k = -1;
+        memcpy(&k, data, sizeof(k));
+        if (k != i || size != sizeof(int) + i % 1000) bad_num++;
+        else if (size > sizeof(int) && data[size - 1] != (uint8_t)i) bad_num++;
+        consumer.Pop();
+    }
+    writer.join();
+    EXPECT_EQ(bad_num, 0);
+
+    // Too large
+    string payload(4096, 'a');
+    ShmRing::Segment segment = {payload.data(), payload.size()};
+    EXPECT_FALSE(producer.TryWrite(&segment, 1));
+    ShmRing::Unlink(name);
+}
+
+TEST(ShmRing, StaleRing) {
+    const string name = ring_prefix("stale");
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // The consumer creates the ring and is gone
+        ShmRing ring;
+        _exit(ring.Create(name, 4096) ? 0 : 1);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    ShmRing producer;
+    EXPECT_FALSE(producer.Open(name));
+    ShmRing::Unlink(name);
+}
+
+TEST(ShmRing, CorruptedFrame) {
+    const string name = ring_prefix("corrupted");
+    ShmRing consumer;
+    ASSERT_TRUE(consumer.Create(name, 4096));
+    ShmRing producer;
+    ASSERT_TRUE(producer.Open(name));
+    const string payload = "payload of the corrupted frame";
+    ShmRing::Segment segment = {payload.data(), payload.size()};
+    ASSERT_TRUE(producer.TryWrite(&segment, 1));
+
+    // A faulty producer rewrites the size of the frame, which is just before the payload
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    struct stat st;
+    ASSERT_EQ(fstat(fd, &st), 0);
+    void *ptr = mmap(nullptr, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(ptr, MAP_FAILED);
+    uint8_t *p = static_cast<uint8_t *>(memmem(ptr, (size_t)st.st_size, payload.data(), payload.size()));
+    ASSERT_TRUE(p != nullptr);
+    uint32_t size = 1u << 30;
+    memcpy(p - 8, &size, sizeof(size));
+
+    const uint8_t *data = nullptr;
+    size_t data_size = 0;
+    EXPECT_FALSE(consumer.Peek(data, data_size));
+    EXPECT_TRUE(consumer.IsBroken());
+    munmap(ptr, (size_t)st.st_size);
+    ShmRing::Unlink(name);
+}
+
+TEST(ShmTransport, Threads) {
+    const string prefix = ring_prefix("threads");
+    const vector<string> ssid_arr = {"session1", "session2", "session3"};
+    vector<int> ok_arr(ID_ARR.size(), 0);
+    vector<std::thread> thread_arr;
+    for (size_t i = 0; i < ID_ARR.size(); ++i) {
+        thread_arr.emplace_back([&, i] { ok_arr[i] = run_party(prefix, i, ssid_arr) ? 1 : 0; });
+    }
+    for (auto &t: thread_arr) t.join();
+    for (size_t i = 0; i < ID_ARR.size(); ++i) EXPECT_EQ(ok_arr[i], 1);
+}
+
+TEST(ShmTransport, Processes) {
+    const string prefix = ring_prefix("processes");
+    const vector<string> ssid_arr = {"session1", "session2"};
+    vector<pid_t> pid_arr;
+    for (size_t i = 1; i < ID_ARR.size(); ++i) {
+        pid_t pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) _exit(run_party(prefix, i, ssid_arr) ? 0 : 1);
+        pid_arr.push_back(pid);
+    }
+    EXPECT_TRUE(run_party(prefix, 0, ssid_arr));
+    for (auto pid: pid_arr) {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        EXPECT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(WEXITSTATUS(status), 0);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
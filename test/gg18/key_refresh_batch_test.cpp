@@ -0,0 +1,178 @@
+#include <sstream>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/batch_mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/gg18.h"
+#include "../message.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::BatchMPCContext;
+using safeheron::multi_party_ecdsa::gg18::key_refresh::Context;
+using safeheron::multi_party_ecdsa::gg18::SignKey;
+
+const int PARTY_NUM = 3;
+
+// The error stack of a context, to explain a failed assertion.
+string error_stack_of(BatchMPCContext *ctx_ptr) {
+    vector<ErrorInfo> error_stack;
+    ctx_ptr->get_error_stack(error_stack);
+    std::ostringstream oss;
+    for (const auto &err: error_stack) {
+        oss << "error code (" << err.code_ << "): " << err.info_ << "\n";
+    }
+    return oss.str();
+}
+
+::testing::AssertionResult send_messages(BatchMPCContext *ctx_ptr, const std::string& party_id,
+                                         std::map<std::string, std::vector<Msg>> &map_id_queue) {
+    std::vector<string> out_p2p_message_arr;
+    string out_bc_message;
+    std::vector<string> out_des_arr;
+    bool ok = ctx_ptr->PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr);
+    if (!ok) return ::testing::AssertionFailure() << party_id << ": " << error_stack_of(ctx_ptr);
+    for (size_t k = 0; k < out_des_arr.size(); ++k) {
+        map_id_queue[out_des_arr[k]].push_back({
+                                                       party_id,
+                                                       out_bc_message,
+                                                       out_p2p_message_arr.empty() ? string()
+                                                                                   : out_p2p_message_arr[k]
+                                               });
+    }
+    return ::testing::AssertionSuccess();
+}
+
+::testing::AssertionResult run_round(BatchMPCContext *ctx_ptr, const std::string& party_id, int round_index,
+                                     std::map<std::string, std::vector<Msg>> &map_id_queue) {
+    if (round_index == 0) {
+        if (!ctx_ptr->PushMessage()) {
+            return ::testing::AssertionFailure() << party_id << ", round 0: " << error_stack_of(ctx_ptr);
+        }
+        return send_messages(ctx_ptr, party_id, map_id_queue);
+    }
+    std::vector<Msg>::iterator iter;
+    for (iter = map_id_queue[party_id].begin(); iter != map_id_queue[party_id].end(); ) {
+        if (!ctx_ptr->PushMessage(iter->p2p_msg_, iter->bc_msg_, iter->src_, round_index - 1)) {
+            return ::testing::AssertionFailure() << party_id << ", round " << round_index << ": "
+                                                 << error_stack_of(ctx_ptr);
+        }
+        iter = map_id_queue[party_id].erase(iter);
+        if (ctx_ptr->IsCurRoundFinished()) {
+            return send_messages(ctx_ptr, party_id, map_id_queue);
+        }
+    }
+    return ::testing::AssertionFailure() << party_id << ", round " << round_index << ": messages missing";
+}
+
+/**
+ * Refresh the keys of several wallets held by the same parties in one batch.
+ * @param wallet_key_arr wallet_key_arr[k][i] is the sign key of party i in wallet k.
+ */
+void testBatchKeyRefresh(const vector<vector<string>> &wallet_key_arr){
+    const size_t wallet_num = wallet_key_arr.size();
+    std::map<std::string, std::vector<Msg>> map_id_message_queue;
+
+    vector<vector<Context>> party_ctx_arr(PARTY_NUM, vector<Context>(wallet_num, Context(PARTY_NUM)));
+    vector<BatchMPCContext *> batch_ctx_arr;
+    vector<string> party_id_arr;
+    for (int i = 0; i < PARTY_NUM; ++i) {
+        // One set of auxiliary parameters per party, shared by all the wallets in the batch.
+        BN N_tilde, h1, h2, p, q, alpha, beta;
+        safeheron::zkp::dln_proof::GenerateN_tilde(N_tilde, h1, h2, p, q, alpha, beta);
+        safeheron::pail::PailPrivKey pail_priv;
+        safeheron::pail::PailPubKey pail_pub;
+        safeheron::pail::CreateKeyPair2048(pail_priv, pail_pub);
+
+        vector<Context *> party_ctx_ptr_arr;
+        vector<MPCContext *> ctx_arr;
+        for (size_t k = 0; k < wallet_num; ++k) {
+            string sign_key_base64 = wallet_key_arr[k][i];
+            ASSERT_TRUE(Context::CreateContext(party_ctx_arr[i][k], sign_key_base64,
+                                               N_tilde, h1, h2, p, q, alpha, beta, pail_priv, pail_pub));
+            party_ctx_ptr_arr.push_back(&party_ctx_arr[i][k]);
+            ctx_arr.push_back(&party_ctx_arr[i][k]);
+        }
+        ASSERT_TRUE(Context::ShareAuxProofs(party_ctx_ptr_arr));
+        batch_ctx_arr.push_back(new BatchMPCContext(ctx_arr));
+        party_id_arr.push_back(party_ctx_arr[i][0].sign_key_.local_party_.party_id_);
+    }
+
+    // round 0 ~ 4
+    for (int round = 0; round <= 4; ++round) {
+        for (int i = 0; i < PARTY_NUM; ++i) {
+            ASSERT_TRUE(run_round(batch_ctx_arr[i], party_id_arr[i], round, map_id_message_queue));
+        }
+    }
+
+    for (int i = 0; i < PARTY_NUM; ++i) {
+        EXPECT_TRUE(batch_ctx_arr[i]->IsFinished());
+        const Context &first_ctx = party_ctx_arr[i][0];
+        string first_dln_proof_1, first_dln_proof_2, first_pail_proof;
+        ASSERT_TRUE(first_ctx.local_party_.dln_proof_1_.ToBase64(first_dln_proof_1));
+        ASSERT_TRUE(first_ctx.local_party_.dln_proof_2_.ToBase64(first_dln_proof_2));
+        ASSERT_TRUE(first_ctx.local_party_.pail_proof_.ToBase64(first_pail_proof));
+        for (size_t k = 0; k < wallet_num; ++k) {
+            SignKey old_sign_key;
+            ASSERT_TRUE(old_sign_key.FromBase64(wallet_key_arr[k][i]));
+            const Context &ctx = party_ctx_arr[i][k];
+            const SignKey &sign_key = ctx.sign_key_;
+            EXPECT_TRUE(sign_key.ValidityTest());
+            EXPECT_TRUE(sign_key.X_ == old_sign_key.X_);
+            EXPECT_TRUE(sign_key.local_party_.x_ != old_sign_key.local_party_.x_);
+            EXPECT_TRUE(sign_key.local_party_.N_tilde_ == first_ctx.sign_key_.local_party_.N_tilde_);
+            EXPECT_TRUE(sign_key.local_party_.pail_pub_.n() == first_ctx.sign_key_.local_party_.pail_pub_.n());
+            // The wallets are distinct
+            if (k > 0) EXPECT_TRUE(sign_key.X_ != first_ctx.sign_key_.X_);
+
+            // The proofs of the auxiliary parameters were made once for the batch
+            string dln_proof_1, dln_proof_2, pail_proof;
+            ASSERT_TRUE(ctx.local_party_.dln_proof_1_.ToBase64(dln_proof_1));
+            ASSERT_TRUE(ctx.local_party_.dln_proof_2_.ToBase64(dln_proof_2));
+            ASSERT_TRUE(ctx.local_party_.pail_proof_.ToBase64(pail_proof));
+            EXPECT_EQ(dln_proof_1, first_dln_proof_1);
+            EXPECT_EQ(dln_proof_2, first_dln_proof_2);
+            EXPECT_EQ(pail_proof, first_pail_proof);
+        }
+        delete batch_ctx_arr[i];
+    }
+}
+
+TEST(CoSignKey, BatchKeyRefresh)
+{
+    // One wallet per curve, all held by the same 3 parties.
+    vector<vector<string>> wallet_key_arr = {
+            //SECP256k1 sign key
+            {
+                    "Cgt3b3Jrc3BhY2VfMBADGAMqrUYKCmNvX3NpZ25lcjEaAjAxMqckCoAEQzU0RTE3QTJCNzgyNUQ0QUMzNzA0MURBMkNGMzdCREEzMTA3MDY2QjJENDlBQ0FDQkZGRENBNTY0NUM0QUI3N0I4QzVGNzExNUY5RDJEREM4REM3MjY2NkJCNjEzNkJEMzkxNTlDOUI5MkMxMDZENjgwNTA5MTM4MTk5OUI5RTlEREQzNjMxQzAwREE4MkQxOEM5OEUwQ0E2MDZGMEUzQkJBNjNEMTIwRDg2MjNCOTkxMTBFQTMwOThERjZCNjgyQTE4RTZGOEEzRjY1RUFDQjUxN0VGRTU5QTBCMTM3MzIxMzM0QUMxM0Y3QzRCMkYxMEE2N0VFODNDMDgyRjg5ODAwNUQxRDdCQkFGQjhBRjQ0QzcyRENBMEUyMkY4RTMxNDYxODUwQkQ0NDYxM0U0MTRGQjFEMEVCNjZBMDE3QTQxQUNDNjVEQzE1MjE1MERBQjEyOTMxRDE1RkNFNDQ0QTJGMjc2NTIxQkJGMjI1QzI4RkM5MDZCRTVCMTkyNzM2QTU2NTRGNTEyMkFGNTVGNjdCNEY2NzdCMDQxQTNGRDFBNTkxNjBBNzU1QTgxNkZBRjRFQjk3MTI2MTkyNjYxRTIyMkRGMUU0ODI2QzAzMzgyMkY0NEZCOUJGQjMxNEMyOUM3NTVGMEVGOEE1RUE5QkM4REQ5QUY1OTc3RjU0OTkSgARDNTRFMTdBMkI3ODI1RDRBQzM3MDQxREEyQ0YzN0JEQTMxMDcwNjZCMkQ0OUFDQUNCRkZEQ0E1NjQ1QzRBQjc3QjhDNUY3MTE1RjlEMkREQzhEQzcyNjY2QkI2MTM2QkQzOTE1OUM5QjkyQzEwNkQ2ODA1MDkxMzgxOTk5QjlFOURERDM2MzFDMDBEQTgyRDE4Qzk4RTBDQTYwNkYwRTNCQkE2M0QxMjBEODYyM0I5OTExMEVBMzA5OERGNkI2ODJBMThFNkY4QTNGNjVFQUNCNTE3RUZFNTlBMEIxMzczMjEzMzRBQzEzRjdDNEIyRjEwQTY3RUU4M0MwODJGODk2M0IzQzMyNzMwQUE4N0FFMEQ4RUEyMjkzRkIzODA5QzhGMjQxMDUxOTM1RThERjY3OUIwODIzNjg4QTdCQ0Y4RTczQThCMjI4QTIxQzIyRkE3OEY0RTZGNzAwREU3RDk1OTQ1QTU2NTQzOTM5QzcwNzQ1QTA5MDUyMUJENjBBODM1MURDQzdERjc2NDlGOTMzODgxRkFGRjlBRDRDNzMzRjlFQkRDNDlBMTZFNzdFQTI2RDQ4RkQ4ODQ0NjVCNjJGN0Y2QjFDNzgxRTBDNTc2NzY1NEIzQzVFRUJDM0Q0RDc2MjIwQUEyMUJFQUE5RUU0NTEyNjhCMTUxRUE5RTMyNBqABDRGMEU2M0M4Nzk4NzZBQzBFRkIxNkE2RDYzMzIwNjA1NjVFOTMyOTU5QTI2QzA4MjA5RDY2NzI0NDNFNjU5RDM2RTg4MTkxRjRFQjJGNUM2MjFGNTFCRUE4NEI1RkQ5RkU0RUUyNTQ3NTk3QkM2NTVDODI5OTM2NTY0MEVBODJDNTVBRjhGQjA2RDlDQkQzOEM5OTg0ODFCRTkyRjU1QkMyN0ZDNDRFQURENzk1Q0JBN0ZFRERBQjY2NjVBNzI2OEIyMERDOTQ3OUY2QUYwQTA4RTY1RDFERkU3M0JFMTU4Nzk2MjU4QTFCQUE1MTcyMDc5MjUwMjBDRjUyMjVBRDQwNEVEQTBERTZBNTkwNEFCMjVEMkVFM0Q3MTg5ODZGMkI2MDkzRTNEQjkzMUEyNjI3NzM2QjcxQTk5NDgyMzMzREQ0NDEyNDQxRjJBNDJENjU5QzQyOTdFODQwNjY1NDk2OTc4NDY2MTNDMERGRkNBRUJGQTlGQUMzRUM4RTY3MkQ5NTg4MjdBQjVGNzc4OTMwNUM4MkFGN0MyOTcxMDA4OUU2NDQwQzAyNDgzMkE3M0VCMzgzRjQ2QTE4MEQ0QkFBMDU5M0U5NkUyQTlENDM0MzY1NDgzRjZFQ0RCOEQ0MDY4QzFGNTVDQ0ZEQTAxODAzQTZFQTE1MEM4MEJEOUI4IoACRkYzOEVFQTk5MkE2Q0VFMEY5QUE5OTREMTc1QzhFMjdFRjA3MkFEMTkxMUU2RTRBOTM5RDk1MjEyNjBBQ0VGNjgwMDJERTlEMkUwQzY2RjVEOTdDN0JFRDNEMTAwOTUyNTU3MjQ4MEU1NjVGQ0E5MUU1NzQ0RjlFMUQyQzczMTQ2RERDREMzM0ZENzUyM0VDNUI3RDM1NTU5NDEyOUFDRjVFMkY5M0U4RDIzOUJFNDJEMkJDOTMwNjczQjdGRUIwNkYyMTMzQzg0NUYxNjk3OTI5MTRFQzdFOUUxOTU4M0Q4RjA4NTAxNkRCMjAyMEJFMTY4NjJBQkIzNUI0NjBEQiqAAkM1RTdGQzVGMURBQzQxMzI3OURFMjBCRkNGOUFGNjQwNjREMDIwRDI3RDU5RjA4RjIxMEMxODYxQjYxOTc5MUYyNzIwRDUxNjQ0RjhDNkVBNUVCN0NFRUQyMURGQkQ2MjQ1NUFDNkJGMkM1ODk0Mjk2NEI0MjZDRTIyMTZBOTlFRTVBQkFCM0RBRUYwMzhENjk3QjI4MjJCQzJCQjMxQzJBOEE0MDgyNDZDODZEQTE1QjRFNjA2ODNBOTc0QjEzRTMzQTFBMUE0MUU2RTQyNTc5NDk0MjZEQzM1RDVFN0FEQUI0QzY0RDY1RURCMkFGOTYxMzBFNTI1NDMyMTEwOUIygARGRTcyNzgxRjFBRDgzNjFGRDBCOTNERjcwRTQ3OTI4OURCOTA1MjMyRDJBRkQ0REQ5Njc4NTQxNkM2MzI4NkQzNjgwNzE0RUQ3MDUzMEE2OUZBOEYzNDQ5QkQwRDU1MDc5OUUwNTYxMkI5OUJDNTlFMzBBODVEOUM3REREN0JBMEEzOTg2QjE4MjVGNDZBODU3OUFENzQ4Mzk5RThCRjlEOEQ5RjQyOTU4NTYzMzM0OTQ5QjVBOUZEOTI3OUVBRDM1RkYxMUM4OEU1RDc3NzI0MEUwMzMxNDIwMTc0NjMwMEZEOTI3Qjk5Q0IyMUMxQjREMDE4NDMwN0MwRjRDNzlCMkIyMEI4N0I0M0ExNURENEE0Q0JCMzRBN0YzMTJBRUMyNjQ3NkQ0MkEzQ0E5N0JENURCNzJEMzFCQjI0RjBEODhGMDQxOEUwMkZEMDBDMEEyMUQ3MDIxOTMyNEIzODVFNjg1NEFBRUNFQ0RENTkyQzgzNDg2NzhCRjUzQ0M4QjQzRTIwOUJGNkUxQjJCODc0QUY4NTBCMEFDQzg3RTU5MkY2N0M3MkRDQzBGNDlEREY5M0JCMzRGQUYwQjExNEZENjEwMEJDNTE4NUE2Q0EyNDAzMUYwRDZERDMwOTMzMDRBN0JCMjE2Q0E5MEZCNTE1QjlENThCMjUwNjlDRkI1OTqABDk4RkVEQ0EzRDAxRTBFRjc4MjRDMEI1NzJGMEREOTdBQzU2MUNFNzUyREYxRkMyRDg4REUzOTM0QkU2N0QyMjI0QTE5RjFDNzk5NDkyNzZCRDc1MkI1RkZBRkFBMzI2MkMxRkEzRjNCNUY3NUZEQUQ2N0FCMEJCOTBDRTU4RTQ2RDRBODhBQTE4ODVGMzAxQ0MxNTcwQzc0MkRDQUU2ODAyRDk0MjFFODVBQTY4RDY1Q0JGM0E4NTcxMTAxMjY0RDREOTQ4MjY4M0JCOTE2RDYwNTAzOTdDNzlEMkQ5M0RFRDJERTMzOTY3RThCQTJCNTFGN0MwQUNDQkIwN0E0OTU0QjMwMjEzRUExRjVFMUM1NTgxRDY4REE1ODdEQkYzMEIxRkU1MkVGQjc2MzM4OEZBRTAwNzc3OEQzRUU3MjlCMDc0NUI2MThDMUFBNUU4QkI1MDhBRUNDMEM4MEZDNEM4NkE1MTdFRjhCQUZCN0I1RUE0QzU4RDU1MEU3NzY0QTM4MDJFRjczMkFCMzI4MjUzNjM5MUQ2ODUwODEzQzY2REFFQTcxNUVCMTJCQUU4REI2NTYxQkVFQjQ4NEQ2NThCMzYyNThCQkM5QkI1RTlDOTM3NDRCMDY2RTZCNjJDRUFBOEExMTY4QTRFQjE0MDc1MEZFNkRDNDZCMDlCREQ5QoACRkYzOEVFQTk5MkE2Q0VFMEY5QUE5OTREMTc1QzhFMjdFRjA3MkFEMTkxMUU2RTRBOTM5RDk1MjEyNjBBQ0VGNjgwMDJERTlEMkUwQzY2RjVEOTdDN0JFRDNEMTAwOTUyNTU3MjQ4MEU1NjVGQ0E5MUU1NzQ0RjlFMUQyQzczMTQ2RERDREMzM0ZENzUyM0VDNUI3RDM1NTU5NDEyOUFDRjVFMkY5M0U4RDIzOUJFNDJEMkJDOTMwNjczQjdGRUIwNkYyMTMzQzg0NUYxNjk3OTI5MTRFQzdFOUUxOTU4M0Q4RjA4NTAxNkRCMjAyMEJFMTY4NjJBQkIzNUI0NjBEQUqAAkM1RTdGQzVGMURBQzQxMzI3OURFMjBCRkNGOUFGNjQwNjREMDIwRDI3RDU5RjA4RjIxMEMxODYxQjYxOTc5MUYyNzIwRDUxNjQ0RjhDNkVBNUVCN0NFRUQyMURGQkQ2MjQ1NUFDNkJGMkM1ODk0Mjk2NEI0MjZDRTIyMTZBOTlFRTVBQkFCM0RBRUYwMzhENjk3QjI4MjJCQzJCQjMxQzJBOEE0MDgyNDZDODZEQTE1QjRFNjA2ODNBOTc0QjEzRTMzQTFBMUE0MUU2RTQyNTc5NDk0MjZEQzM1RDVFN0FEQUI0QzY0RDY1RURCMkFGOTYxMzBFNTI1NDMyMTEwOUFSgAJDRDlENUI4NzMwOEZDQjYxOThDQjBDRDJBNDdENTVBMTlBNjVCQTQ4NTUzQzRDM0RGMDA3NzM2MDg1NjNDQzk2MTNGRjUwMEYzMEQ3REFGNTNEMzBDRDVDOTM2RjI0NDcyRkU2MkYyREI1MUYzMzEzRjJGMjk4NzM2RTcxRUJCMTY0ODM4NkZCQUFBMkU1MzdDNTE5RjgwREQ4OEUyNDFBNDY3QUMxMUIzNUZCRkQ4MUFBM0RGOUU0ODc0RURDMTBCMTBGNDE4QUM1QUQ2ODE4OTU4QzczMjIzNkU2RUI3MEZDNURENkQ3N0FGNjVCODgzRUNFMDVDMUFENjNBMUM5WoACMjY3Nzk2MTM2Mzc4MDNERUEzRUY2NkVDMkVGMUZCMTYyQTA1QTNDNjc5MjhFODY3RThGQjJEODYxOUM0QjFCOTYwQjIzNkQyQTk3QzlDQkNCMEMzMDE5NkRCREJCRkU0MEVERjlGMUI4Q0JFNTc2NjM5QkM1ODBGQUJCQzM5M0M2NzA4ODYwOEYyMTFGQkRFRDc3MkQ5MkQ3NTQ5Q0QyQkI4OTcyNjNFODU1RTJDMDNBM0ZDQUEwNDMyNjJBNTQzRTgxNzUxQTMwMjBBODhDRDI3MUM0OTkzMEZEMTNDRTdFODUyMUUwMEFDRjdGNDgxMDY4MUM4QUVFODk1MEUzRmKAAjMxOUI5MzIyNjIxNzAzN0Y2MERGOEM3QTcyREYzODg2NTRBMTcwODkzQkUyMjIwQ0EzOTYyMUMwQTBBNzAyNjA2QzAzOEU4REZEMzQ4QzAwOUM0QkFFOTBBOUEwRTUwQjI1OEMxOEUwQTE0MDk3N0RGMjgxQjcyQUFFQkE4NzYzMDk1OTU1Mzg1MkQyM0VCNDk2NjMzRDQ3QkI4NDc2QjUxN0I0RDJDRDlDM0RDMEMxMjg3RTk5MjFFQzY5MjI5RkJFMTFGMjNEODA0NDAxNjA5Mzg4Nzk1QzY3MzI2Q0NDOTJBQTc5M0Y2MDI5QzUzNUQ3QjgyNEY5ODg1MEJGMTJqgAI5RjcwNjY0QkJBMzQzRDUzRDVFRUI5RDNBMEE4RkIyQTNBQ0E3RDBDMDQzMTA4MjczODEwRUFEQjlDNTRDNzY1QzY2RTlFNDM5QjdDMkEyREFERjRDRDU2NDYwM0ZEN0UzNjdCMjdBMzlGOUEzQ0MzMkFGN0NFQkU3NjVBNzA2MjdFQTMyNTM0QkNERTNDRjdDMDNGQThGRTRENzE2NDk2RjAwQ0UxRTVFNzI4QUUxMjEwRTk1QzdGNzcxMjBCRkE0QjhBNTAwMTFDNjNCOThBNkQ3N0RENDkyNjA0QUFDNUMyRkE0NkQ1QjFFMzM2Nzg1QUFGMUM3NjVBOEMwMjVDOoYICoAEQzU0RTE3QTJCNzgyNUQ0QUMzNzA0MURBMkNGMzdCREEzMTA3MDY2QjJENDlBQ0FDQkZGRENBNTY0NUM0QUI3N0I4QzVGNzExNUY5RDJEREM4REM3MjY2NkJCNjEzNkJEMzkxNTlDOUI5MkMxMDZENjgwNTA5MTM4MTk5OUI5RTlEREQzNjMxQzAwREE4MkQxOEM5OEUwQ0E2MDZGMEUzQkJBNjNEMTIwRDg2MjNCOTkxMTBFQTMwOThERjZCNjgyQTE4RTZGOEEzRjY1RUFDQjUxN0VGRTU5QTBCMTM3MzIxMzM0QUMxM0Y3QzRCMkYxMEE2N0VFODNDMDgyRjg5ODAwNUQxRDdCQkFGQjhBRjQ0QzcyRENBMEUyMkY4RTMxNDYxODUwQkQ0NDYxM0U0MTRGQjFEMEVCNjZBMDE3QTQxQUNDNjVEQzE1MjE1MERBQjEyOTMxRDE1RkNFNDQ0QTJGMjc2NTIxQkJGMjI1QzI4RkM5MDZCRTVCMTkyNzM2QTU2NTRGNTEyMkFGNTVGNjdCNEY2NzdCMDQxQTNGRDFBNTkxNjBBNzU1QTgxNkZBRjRFQjk3MTI2MTkyNjYxRTIyMkRGMUU0ODI2QzAzMzgyMkY0NEZCOUJGQjMxNEMyOUM3NTVGMEVGOEE1RUE5QkM4REQ5QUY1OTc3RjU0OTkSgARDNTRFMTdBMkI3ODI1RDRBQzM3MDQxREEyQ0YzN0JEQTMxMDcwNjZCMkQ0OUFDQUNCRkZEQ0E1NjQ1QzRBQjc3QjhDNUY3MTE1RjlEMkREQzhEQzcyNjY2QkI2MTM2QkQzOTE1OUM5QjkyQzEwNkQ2ODA1MDkxMzgxOTk5QjlFOURERDM2MzFDMDBEQTgyRDE4Qzk4RTBDQTYwNkYwRTNCQkE2M0QxMjBEODYyM0I5OTExMEVBMzA5OERGNkI2ODJBMThFNkY4QTNGNjVFQUNCNTE3RUZFNTlBMEIxMzczMjEzMzRBQzEzRjdDNEIyRjEwQTY3RUU4M0MwODJGODk4MDA1RDFEN0JCQUZCOEFGNDRDNzJEQ0EwRTIyRjhFMzE0NjE4NTBCRDQ0NjEzRTQxNEZCMUQwRUI2NkEwMTdBNDFBQ0M2NURDMTUyMTUwREFCMTI5MzFEMTVGQ0U0NDRBMkYyNzY1MjFCQkYyMjVDMjhGQzkwNkJFNUIxOTI3MzZBNTY1NEY1MTIyQUY1NUY2N0I0RjY3N0IwNDFBM0ZEMUE1OTE2MEE3NTVBODE2RkFGNEVCOTcxMjYxOTI2NjFFMjIyREYxRTQ4MjZDMDMzODIyRjQ0RkI5QkZCMzE0QzI5Qzc1NUYwRUY4QTVFQTlCQzhERDlBRjU5NzdGNTQ5QUJAQzEyQTA4NTUxMkM1M0Y5Mjg0QzY1OUVBRkRDRTIyODhFNjc5NTA5NDczNDAyNUM0QzZBNjA3QTRGMDkzMjg3RkqPAQpANkE4QjYwOUE3RDAyQkI4RThFNzE2NENBMkQyNDAxQUZGMEQ3QTZDNTdEOTgzOTkzMzUzQzEzRTJGNDAyNTU0MBJAQjFGQjFFOUM5QjBGRDYwNjBCMzgwOUNBRThEQzE4OEM5QTVEQ0I2RjI5NEZBRDZDMEU5NENENUM5RDgxQ0M4MBoJc2VjcDI1NmsxUoAEQ0EyRThCQjYxM0FENDYyMzk4QUMwNEU0Q0JCRUFFMDYxNzU4RTZDMTkzMDk0NTVCQjcwQzVCOEM3MUI5OEEwRjE5REE4REQzQzE3QTZENjE4RkUyRTg1RUFBRDMyMjZGM0EwMjlCM0I1RDhDNzU1OTREOUYxMzkwNjNGRDg1MjY2NDhERjVBMzVDRTkyNTA4ODUyN0Q4ODU1RkRBRjdDRUY1OEVGQzE4REFEQzYxQzU0MDMwNzNBNzkwMzY3M0U1M0ZGRjNENUY4QkZEQzVBNTEwRUZEN0FGQUJCRkYzNjNGRTA0Rjc5QzBCQkZGQTZBMEY3MTY3ODhCMDA5N0Y5NURFMDAzMjBBOEQxRDIwNDU4REQ1Q0YyODM1RkUxNDlBNzZCNUEyQzQ0QkQyNkNDQzA0RTkyRUU4NUE4RkZCRDUzRjE2Mjg0OEY4QzIyQjVFNUJCMUNDRThEMUE0Mjk1NzNFQTY3Rjk1QkU3RjVDOEEyRUJEQkI1Q0QwQzE1NDZFRkNGOEIxNURGNEZENEM3OTFCQ0YwREE4NENFNEE5MEIzOUZBN0JEN0NBQjYyNUI4MjAxQkIzRTEzQkNCMzM3NjhDQ0UyM0NFNUE0RkQ3NDhFRkQ0NzFGMDg3NzNERTgxMzdFMjQzNjUzNjVGRkE0RjVENkMxRTYzRTZERDFBRDVagAI2QTcxOTdGRDcyQkY3RTlDMDU3QTkwODg2Q0FFMkU2NDlDNDg4NkYyMTY2OTczN0YwQ0Y1MzhBQzAzQUM3OTA4NzE4MzhDOURFQkRDRkU2ODAyRTkxQjlCMTYxMjAyNDMyQTEwRTc2NjYxRDUwNjIzQUMzREJFNkZBQjgyREQ3OEY0MEM2OTYxNThDNjNBOEQ1NTE5ODc2MDQwODI0OEE2QkYyMjc5MDQ0MjkxMzg3NjQyNzI0QzFDMjlBODFCQkE1Q0Y5NDMxM0NFRUFDMDY0RUFDQTFEMEVERDVGMkUwNzI0MUI3NTU0MDZDODQ0MEQ4N0I1ODczODFGMDFCQkE3YoACNzk5MDJCQzBDM0MwRDA2MzdEMTlDRkQ0RENCMzU0MjRENzJFNjU1NUZCRUQ3RTREMjM2QTU0RjJDRDhFRjIzOUIzNDRFRjBEODJENEUzOTlCODlEMzQ3NzQ0Njk5NUQwNUNFQ0ZCQzgwNDcwMUY1OUZFOTBGQTQ1RTA3M0YzNjgzOTBBNUVBNUMyQkNCMTA0N0M5MzZEODc1QUY4MTRERkYxRkI1M0E2QzRGREQ4MzhCNzA2OTcxRTU2MTk5QzMyOUFFRjE5ODg5MUM0MDZDRTBDMkYzMjY1QUQxN0UwRUQxNUQwRTNCMzZEMTUwMzhEMkI3NTIwQUQ0NEMzNjE0RGqABDFBNUQ4MThGNTExMTg4Rjc5MDMyODRCNEU3MDAxREE1MTBBRjEyMDFEMjJBNTFCNTA4QzYyODBBRjFBQ0U3OENCNjExMjk2NzRBODAwN0U2RDhGMzUzQTM3REYyRUJCMzk5OTdCNEM3RUEyMDhENTI2Mjk0QURBMEQwRTlCOUQ0QkVEODIzQTRDQjU0NjhEMEJEMDhCNDVEMjFBQjExRTE5RjQ0REU2Njg5QUEyREI5QTI0NUZGRkQ1NTdBNEJGREE5QTAxQ0JEOUFGQTMwNTdGQkZBMEQ0QkQ3MEEwOTQ4OUVCQTEwRkJFMzhGNjZEQzQ0RjZDMzZDMDgyQ0RGRTg3M0ZGMjQxQUYyOTM0QTc0OTdGQ0U3MUNGMzg5MzA4NjgwQzI1MjY5QjNBODMzQzZCODNDOEM3M0QyMDQ4REM5MUQ2RkFGMzdERjIyQzI2OUMwNEE2N0U0OEI1QjA2RTdBRDBDREI0NDU5ODhFRUVFQkNDNDhBMDU2QTI3MTNDMzc1NkQxODE5RUZBMTFGMENCQUY1QkI3QkZBNDlEMjZEODM0NTgwOERDMEU1MDBCQkI3ODZEN0QyODk0QzA1NzcyNzhBQzQ0MkYwNDM1Qjg4QjFGMkU0RkNDMDlDQUZBN0I2MEY5RjVDQUJFOEVCMTgyQkVCQkNBMEY2QjZDRjM3coAEQUMwNTM3MEE5OEMwQTk2RTAxRUYzQTdEODVCMjkzNkEwMEU5Q0M5MzNBMjBENUI2MTM3Q0VBMzRGRUM5MDZBNzJDNUIwQTMyNDZBMkRGOThFNjdGMUQ3OEQzNjg2MzQ0ODU2QjFGMDEzQTZERjU0ODY4NTJFNjcxN0M3MzFCNTlGOTZFMzQyQ0Q5QzYxOUZCOTkzNkEwNURFMTZDNEUyQ0U3ODIwQ0QxNTVGQURBNTExNzIxMjBBNEM2OEYxREE3MEZDM0Y2MEQwRTI4OEUyRENDOUU3MjAyNEZGRUZCNzYzMzUzNjA2RjBGQThGM0U5QUU5NDcyN0QxNUNGM0U2MkU4QTlGOEYyN0Q4NzFGRUI4MzYzNDFCQ0QxM0EzOTM0NEM3QTk0ODA0MEI5MzUyNzZEOUY4NzdFQkQ1QTFDNjBENjAyREExQUY4NThEQTg3RTg3RENBMjgxQTczMkY3MTQyQjJDNzM1MUE2MjExQ0Y0MUVDM0RCRUFERDEzRDc2NjI1MjYwMEU3OERGMEU0M0M4MkM3OTcyRDQ3NTg3RkMwOUVDNjQwNENCRTNCRUM4Q0E2MUIwNzFCOUQyMzE4RkVBRjE5QTdEMDI2RTQwQkU4NTBDRUEwNTk2Q0Q2NEQzRDJCNUE2MjRBOUEyOTI1N0U0NDdEMEJGQkNGMDUxOUZ6gAQ0M0Y0Qzk5RThDQTJCREMyRUQ5MEZBRTNGNDM5NThDMjRCNjVENDk4MUU1QTcxOTczM0FCNkM2NjI2OUNDNDAzNEVGOTVGMzZFNkFGNEEyMTBDOEYwNUUyOENBN0QyQjg4NkJGNDk4OEFCNzU5MjIxNUU3MkQzQkJDNTkzRjZERDA2NkU3NjhFNkI2REMxMUI4NTdGMTc3QjAxRDQ4ODJDQjM1QzdFRjM0QTkxOEMyM0E4NjgwMTc0ODI1NUY3REU3NzVCRDY2QkQwMjkyODc1M0ZFREEzQUVDRkY5QTg1QTM2QTc0Q0M5M0JGN0JDMUVBNEE2NzI3MzcwMDI1NDlFODdBNkJFOTkyNkNEQUE4MjI2RDJBQzk1N0YyNjVDQjc2NTBEM0Y1RDU2QjY0NDMxOUNBQjE2NTZBRUY0QjMzRUJBNTQwOTIwQkVGNzBDRUI4MEM3N0MzOEI3NDI2QkVFQzhBRDZEQTZERUZENjA5NjQ2RUVGRUVDMzEyRUE2OEU1QTk5RkRFOEYxODNDRDc3NUQ5ODczNjQyQ0REMDFDODE3MUFBOTNGNUExQzY5MzA5ODgwMTYyMTI2MUVFNDA5RTNDQTZFRjkzMUY3QzVDNjEyODYzRkI3N0MwNkQ1NUU5RUY4NkIwNUFFRTEyRDZCMTdFODZBMUM3MzA5M0VGMIIBgAQxMzUzNzg1NTQxMDdDMUJFNzc4NTI5MzU2Nzg0QTMzM0M2RTc5NzNCNTQxMUQ5OTY5OTczREZCQkZBOTRGNUI2QUMzQkMyNzNGRURGNTIyQjZEMTgxOEI2N0IxODJERTg0Mjg0Q0U0Nzk5MEUyNzk5MDE5QzA3QjhCMzk3RDE4QjFEQkIyNUVCOTJCRUVEREJFMUU5MkEzN0VFMjZBMUZBNzFFNTVFNzIwNzNFRUYzRjZEMTk4RTkzODhGNkQxRUQxMjc4NDhCNjgzNkU3MUQ3Q0NEQzVEMEQ5MkNERTlFMDVFNDgxMTgwMjcyQTMyMEI0QUIyMTNEN0NEREFFNEFENDlBOUI4Q0E3ODQ3QjEyMzE2RkIyNzY3ODU4MENDRjUzOEUzMUNDMzIwQTY5RURGNjA5RDM4N0JERUMxNTJENkU1Qjg1QTlERTQ5N0Y5OTFBM0M4RjczMjVBODE0N0I5OTY2RDZGRkU2M0Y0MDQxM0U5RjRFMjEyOUZFNEYxODI2RDlGRTVDNzZFMEY2Q0U4MDA1RjgxQkQ5MURFMjFDMDE4NzIzOTlBQjM2QTE0QTVDNEVCQjc4QURBQjBENUNGMUFCQjZFQkE4RjRBQzhEOUJGRDAwREY5MUExQkU1N0FCQzFCN0ZGMTcwRDM2RTE0MUUwMTEzQkIwMkQyQTM3QTK0FQoKY29fc2lnbmVyMhoCMDI6hggKgAQ5N0NCNEI5RTEzQTExQ0I1QkQ1OEFBNjMzRUUzMEJEQzZEQUMwMDQ0NzVENkM4OTExRTA1M0E4NDg1NjEyOUI1QkRDM0NGNjFFQUNGQTI2NzFGMEQwRjNCOTIzNkNBNjkxNUZGOEE0RUFDOUFBREVDRTQyOEFCNTRCREI1MzNCNEIzNkIzQjU5MTBCODhCMjJFNTQ2NUQ5NzhBRjE2REY5Q0NDNjIyOTA1MDRFMkQ4MzUzMDczRTc1QTU4OUFGMjExRDFENkE3RTAzQjk5MUJDOTc4MDQyRUUwRkFDMTkzRjBCOTMxM0FCNjkwOTBBNzk4RjVFMUUyOENBMTQxNzkzOTU2RTNGOUFCNkEzNTJCODY1QzQzOTE2Njc2MUUwMzZBMTQzNzcyRjAxNTUwMUNCNUY2OEFEMjczRkNFMzRGOEQxNEQyMTM5NzI1NEVBNDAyRTYzRjEyNzI4QkZGRjlDRTQxQ0FDNjg4NTRDOUFBNDAzQThDMEQ2NzAxNjdGMzg5MjE0MUJCQTc5QjY4MUYyN0M3N0E4MTBBRDI2QzZDNzI2NTlEOTE0NUQxOTVGMzk1NTFFNTJCNEQwRUNDMDkwNDNEOTkyNUFCNkFGRkE0MjExOTc0NUUwNUY4NDVGMkI4RjlCQjVCNzdBRkJCNjRCRDQ1RjM5RjZDQjlFQkNGNRKABDk3Q0I0QjlFMTNBMTFDQjVCRDU4QUE2MzNFRTMwQkRDNkRBQzAwNDQ3NUQ2Qzg5MTFFMDUzQTg0ODU2MTI5QjVCREMzQ0Y2MUVBQ0ZBMjY3MUYwRDBGM0I5MjM2Q0E2OTE1RkY4QTRFQUM5QUFERUNFNDI4QUI1NEJEQjUzM0I0QjM2QjNCNTkxMEI4OEIyMkU1NDY1RDk3OEFGMTZERjlDQ0M2MjI5MDUwNEUyRDgzNTMwNzNFNzVBNTg5QUYyMTFEMUQ2QTdFMDNCOTkxQkM5NzgwNDJFRTBGQUMxOTNGMEI5MzEzQUI2OTA5MEE3OThGNUUxRTI4Q0ExNDE3OTM5NTZFM0Y5QUI2QTM1MkI4NjVDNDM5MTY2NzYxRTAzNkExNDM3NzJGMDE1NTAxQ0I1RjY4QUQyNzNGQ0UzNEY4RDE0RDIxMzk3MjU0RUE0MDJFNjNGMTI3MjhCRkZGOUNFNDFDQUM2ODg1NEM5QUE0MDNBOEMwRDY3MDE2N0YzODkyMTQxQkJBNzlCNjgxRjI3Qzc3QTgxMEFEMjZDNkM3MjY1OUQ5MTQ1RDE5NUYzOTU1MUU1MkI0RDBFQ0MwOTA0M0Q5OTI1QUI2QUZGQTQyMTE5NzQ1RTA1Rjg0NUYyQjhGOUJCNUI3N0FGQkI2NEJENDVGMzlGNkNCOUVCQ0Y2So8BCkBBODQzMUY1MTE4QUUwRDQ4Q0VCRjVEQkMyRDEzNjU2MDhGNDdFQkNCMEE4RkVDRjU3RjIzRjA3RDFGQTlBRjlDEkBDQkIyMzU2QTkxQUI0NEI3OUZGMTgxQzQyQTI4RjlFNTMwQ0NCMTVFRDJFRjhCNEVEODE0OTdCOUJCQjhBQkJBGglzZWNwMjU2azFSgAQ5MTFENEYwOUY1Q0E0RkRBMTJEMjZCNkFBRjhGODVGNEJBN0RFOUVFNUNFRDZFQzIwM0ZDREEzRTQ4MjZGMkU3REVGRjkxRkNGNzQ5NTMyRkU2MkJGRTdFMjcyOTE2MUFFMzVCMERFMDFGODA1RkI5MURFQTY1NzlBNzQxRkM5OUNDNEVGNDVFQkQ5M0UyMzQyMUNFQjYzOUMwQzhCMzZDNTUxOENBQjczMjY0QjJEOTFFRkU1M0YxRTM2REU2MDZEMTI3OUM0Mjg3MzdCRDZEOENBMUE5QTY5MjU0QjMwQTY4MDAwNjAzOTQ1NjM4N0JBNjBFMTEyMEM5RUMzRjBGOUE3NUQzODQ4Nzc3OTNBNkIyMkUzODlCMzkyOEQzQUExMEFBM0Q1MTEzMTRDRDhCMzNCMzE0ODNEQUJCN0VENjBBNkU3MDQ2QTY3NTQ0RUJCMUUyMTkyNjc2MzVCQjY0Q0JEQkI3NTU0MDQwNDlCQzRCREE3QTJDQjc4RjBDRENDMTE2MUUwRjY4NjQ5MTlCNzUwMEFEMzhCMUZBMjYxNzRERDgyRDFEMTFGNTkxQjc2Njg3NjM0QzE3MkU4RUZCREQ2Q0ZFQzA4NUM2NkRBOTc5NjI1NkIwM0RDOEMwQjZDQjI3MkYxOTY3NEIzNDAyNTU1MEFCMjBBNzI1RTY4NWqABDM5QkNCMDJBMTQzREM4OTlCQTBEREVGNUQ1NDIwMzUzNTE0MTEwRDVFREM3MTU1NTI4RENCOEFGODE5MjNFNDJBN0M1QTQxMDg0Rjk0MTcwREUxMjU0NkM5QUMzMDY3QkJCNDVBNEQ2NUFFQzUwQkMyMzhCNDcxMjlEREJDMjQxM0U5N0I3QzMzRkE3ODc0NkFBRUQ1NkM2Q0MyNDU4NzI3RjBCNUM0NkQ5Q0JDNjZBMjJBODA3MjI4QTFDQkM5MkNFRjUwQ0Q1NDA0NUQxRjhEMzdGQzRFNjlENzFGQzA1OUJDQkI4QzBEMENBNjkyOTFGMjU3RTdFQTY2MTQzMUJDNzkyOUY1QjkwNEM5QkQzNjNGQ0U0QTNBMzE5Qzc2NzIyRkRGNzA3NThCNkQwMDhCODkxNzM1NkQ1NDhEODFDMjczN0FBRTY1Qzg1RDhCNDNGRDBENjYzQjFBMjJEMjE3RDIzQzhCMzk5RjhBMzQ5NTE1RTdFRDA3MDlENUI0QTYwNkZGRkVGRUNFRjFGRjczNTZGMzVGOTg5NzYyRUZDOTY5MTU2QkJBRjI1MEM3MzlENjc3NjJFNDQxOEY3M0Q4OUVFMEU2NDYzQzE5Njc2MjQwOTBGMzgyRkI4REMyRjRCQjMxOEJBMEVFREMyMEM5MUZFMjEwM0QwMkZDQzI1coAENTk5MjBGN0RDMkM1RjVBOEY0MkY4MkY2RENBRTkxNDkxQjRENzlFNzJBOUNGRUYxMTc3OUZEQzhGODM1RjkxQjQxODlDQzJCMkNGQzJDOEFCNzQ0N0ZFRjQzQjBGMzY1QjlBRUY1OTI4Q0EyNzcwRUQwQkVCRTAzQUJEMkEwNTg4OTg0OEQ0QTcxRjFCRTkzRjBGNEY1QzkwNjQ3NTQ4NkI1NjQ5NDBEMzRGNjMzQTlFNURDRUJCRDcwRDVGMzQyMTU4NUFDOEQ0MDgzRTJFODgxNDIyODkzMkNBMEY2NTkwNzM1M0QxQjQ2QkM2NEQ3NTUzRjFCODRGQkRFMUE3OEQ4ODlDQjE5OUNGOEZFNEY4QzU1MjI0NDhGQzJGMzgzRkM1QTdFMEQzQUI4MTI5ODU5RDc0RUU1MkJCNzlGQzQ1MEE1QkJBQzA0QUMwMDcwNkQ4MTk3NDJBOEZDNUJFREYzM0EzQUUwODQwRUEyOUM2NDRFMUU2NzE4M0I3MDk2MkEyRkI5QzU1NkFFODlEMEQwQkY3MUVDNUIzQkM1OENFODhFRUYzOTI0OUVCMzAzMUNCMzc5NENGNUQxNTAyMEI5MTA2MjM0NDk1QjUzQzZCQTFGRjE1NDk0NTJGNjFGQUFDMzIzQjkyQjhEQTJEQTlEMzE3QThDMjcyQzEzQkEytBUKCmNvX3NpZ25lcjMaAjAzOoYICoAERDBEN0FEODQ5NjJFOTVEQjEwQ0VGNDI0NEYxQ0I2MjRCQzZBODk3OURBN0ZDM0Y5QTdFMkVDRTIyRjU0QUVGMTBFMzY5RDYwMjUyNUFGQUZFNzM5MDJFQjhFMzBERDc2RjA2MjdCQUI1MDhGRkE1Rjg1NDhEMEYzOURFNjU1MkQ3RjUyNTU3Qjc3QUQ1MjkyRjI3RkY5RTNFMzBEMTExMDg4MTJGNkYyRUVGM0JBMDY4RkU0Rjg1ODUzMTIxRjM3NTRERkQ3ODNDNkVDM0YyM0QzOThCNTgyQ0I5NkQyQ0ZBOEYzRTMyMUE4ODgyRDVGOTlFRjMyQ0U4RENEQjI0RkE2M0E2M0Y2MTY3NkI0RTA2QzdBMTBCNkUxQUIyNzhDRDRBMTc5OURFRTBDOTJDQ0QxNjI3NEM1MDZFMUMzMTM4MUFGNjAyOUZGOTBCMkI2M0EzNDY4ODFDREZGMEE1Q0YwRDNFMzhEM0E2QzczQkUzQzY5MkM4RkE2N0VBMzQxODJERTRBRUE3MkRENDI3ODc4RDkwMkFGQ0IxNEJDMjBCQzBBRkE4MzYwRTY4OUFCQzc5QzBDNEM2NkZDOTU2RUFBMEYxMUNFOTBERjZGNTA3QzlCREREQzg0Qzg3ODZDMzk4MjgwQjJGMjFFQTA1ODFCMkU3RTA2MTk3QzE3MzESgAREMEQ3QUQ4NDk2MkU5NURCMTBDRUY0MjQ0RjFDQjYyNEJDNkE4OTc5REE3RkMzRjlBN0UyRUNFMjJGNTRBRUYxMEUzNjlENjAyNTI1QUZBRkU3MzkwMkVCOEUzMERENzZGMDYyN0JBQjUwOEZGQTVGODU0OEQwRjM5REU2NTUyRDdGNTI1NTdCNzdBRDUyOTJGMjdGRjlFM0UzMEQxMTEwODgxMkY2RjJFRUYzQkEwNjhGRTRGODU4NTMxMjFGMzc1NERGRDc4M0M2RUMzRjIzRDM5OEI1ODJDQjk2RDJDRkE4RjNFMzIxQTg4ODJENUY5OUVGMzJDRThEQ0RCMjRGQTYzQTYzRjYxNjc2QjRFMDZDN0ExMEI2RTFBQjI3OENENEExNzk5REVFMEM5MkNDRDE2Mjc0QzUwNkUxQzMxMzgxQUY2MDI5RkY5MEIyQjYzQTM0Njg4MUNERkYwQTVDRjBEM0UzOEQzQTZDNzNCRTNDNjkyQzhGQTY3RUEzNDE4MkRFNEFFQTcyREQ0Mjc4NzhEOTAyQUZDQjE0QkMyMEJDMEFGQTgzNjBFNjg5QUJDNzlDMEM0QzY2RkM5NTZFQUEwRjExQ0U5MERGNkY1MDdDOUJERERDODRDODc4NkMzOTgyODBCMkYyMUVBMDU4MUIyRTdFMDYxOTdDMTczMkqPAQpARTlDMUZBRjVGRjkyNDgwRDlGRjU4RTRFOTc4MDUwOTU5RUIzNjdBRDc4RkNFOEE2QjQzQUNCODcyRTIxNDEzRhJAOUY1RTVBNTZCM0REMTU2QjQ2QUNFNzQ3NEExQzY5QkVBMjNFRUIzNkM5MzZCMjg5MjAwQzJGQzM1QzVERDhDNRoJc2VjcDI1NmsxUoAEREE4NTAyMzAxQjk5ODVBMUJFNEFFNkQyNTlFRDM1NjJFRDE0NjI2RkJEMjQ3MTNBQzlEQzU4MkE3NkQ1ODUzMkY2QkJBMUVGRDA0OTA5RkQ0RDM1MzQ3MzA0RkFDNzcxNTYxOTQ2MEZFQjI2NDQ1MTYwMjI1NzFDOEYzNDA4RjNGRjI1RUFGNzg2QjkwOTY3RTgyQ0I0MTdCM0RBNEM3N0RBRThEMEJFQkVCNTdGMDUxMkFFMDZCMUYzMENENzRBNTYwMDVBOUNDRkU0NjIwNTgwMTc3NTM2MTNERjhEOENCNkZGODkyMzY3MTk3RTI1NkQ5ODQwREE5RTQzOUZCQThDMzEyMzQwRkNDMjg1QkEwMEQ3QTlGQ0M5MzA5MEZCRjlENzE4MTY5QzNCNjE0NEMxMjNCN0Q5QkNBQTU4ODI4M0I3NDUwQTkyRkY4MDFFQ0U2RUUwMEYyN0I0MjQ1QjE5NDRERjg5QjNDM0IyNkYzRkMzNjQxMTlDRTE3MEE3NUFGODA4MzgzNTk4RDFCQzhFNTIzNTkwQ0JFMTVGN0FGMDFFNkJFRTgzOTMwRkYzMDEzMDEzOEE4NzZDNURGODI2MURBNjg5MUYwN0ZENzQxNjYzMEQ1RDlGOEU4REIyNTc0RUJGRkRBRjk5QTIyRDU3QzgzQzIwNkU2NDYzQkRqgAQ0Mjg0MTU3NjA3QUI3MkFDNDMwMDlERTNGNDg2RDVCMDU3MTMzMEQ0RTk4OTY5NUY1Mzc0ODE4ODgwOEZDMEVBRDcyRDJFODM1NjU2NUM3QjFGNEM0NEE2N0U3OTE2MTA5RDg0OTcyNzU2NEM5MTY5ODY5MThFQUJFNjBDOTA0QTFBNDIxOTI0QzRCMjlERjQ4NjAxMkNEQTUwNjgzM0I5MDRCMTREQzdCMjhGMjMwMzEwRTI4RDJCNEQ5OEMzQzQ0RkZBRjBFQzU5OUEwRTk2M0UwM0FDRDIzMTYzNUIwNDM4NjdDNjZCMTY2Qjc5QkE5MDk0MkI4Nzk2NjZGMjc2RDE4NjlDMDc3OEU3NzQ5N0M0NjEyNDAyMEVDRjAwRTNFMjRFMzY3QTRGQzk4MUM1MURDRDk1NTIwNzY4NjBFMUY4NDdFRkMyMTE3MzQzQkExOTYxMzA3MUZCRkQ5OUJGQ0Y2MkJBODkyQUYzNUM5MDE1QzM5Q0JFQ0NCNDZCOUNCREM1ODI2OEI3MzYwRUZFNUQ2MEZBMzkwQzMyMTU4M0VGMDlENjYxNjg0ODgyMzJDODBGOTdDRTc5QjBFMTVGQ0Y1NTAwQzYzNTFDNkM1OUE2QjJCMTk0REY3Rjg5QTFBRUUzQTVBMEM2QzA0QzE5RUMyNkU0MjI0M0Y1NjkwQ3KABDg4MDQ1NzhCNjRBQTQ2MzQ5NEE2NkZGRUYxNzk2RUUzNTJEQUQ0ODAwQkZEREMzM0M3NTZCMzI4OTdBODk3MDFCN0E5NkRCRjkxQUE4Q0QxMUQ0Mzg4ODFDNjUzMzU5QTMzMUEyQTcwRDBBMUIwMzRBMDRDODA3MUI2QUJENThCNUMxMzQ5RUYyNjNCQjIyOTU2ODcxQ0VGQURERjMyMUY5QkI1RUQ4OTc2RTEzQzVDQzA4QTQ5NEU0QTIxOEQzRDAyRUU1ODJBRDRDQzI2RTUzQUM3MEEzMEFGOTE0QTRGQUMzRjVCNTg4OTMxQ0NGMzQxNkU3RDg4QkREMEY3MzdBNEIyRTczNEU0NThCMENBNTUyNDkyNkVBMTNBMzI3Q0ZCQzM4RkUwQzcyRDdDNEJDMEQ3MTM5MjZCQUY5OThCMEE4MzhGQ0E1RDgzNjA0Mzc1MDEzMjk3OUE3RjU0MUU5RjAwOTFGNzNDN0E1ODNBRTU1Q0QxOEU1MzBDQzU3RUYzMTAyNDU5M0Q2MENERkQ2OENEMkNCRTNFRDZGQ0U0M0RCQTE2MzZBM0ZGN0U0MUI0RDEyRDFCNEIzMkRCODM5MkEwQkFFNDVGNTYyMDFEQ0M0OTJBNzQyQzM5QUUwRTAwOTEyNkE0RTEyRTdCQjQ2QTg1MUY2OUYxN0U2ODM1Oo8BCkBENThEQzREMjFDRTQyRDREQzM5NjZCRjMzQkVGQjVFNDQxMEU2Q0FCMTQxRjIzMTVFMzJGQUU0RkMyNEQwRkRFEkA1RDA1RTgwMTM3MUMxODhENkNFMjg1RjNGNTE4NkIzOUE1QzY1QUI0OTY5NTcwMTAyQjlBMTgyRkUzMkNCMzUxGglzZWNwMjU2azE.",
+                    "Cgt3b3Jrc3BhY2VfMBADGAMqrUYKCmNvX3NpZ25lcjIaAjAyMqckCoAEOTdDQjRCOUUxM0ExMUNCNUJENThBQTYzM0VFMzBCREM2REFDMDA0NDc1RDZDODkxMUUwNTNBODQ4NTYxMjlCNUJEQzNDRjYxRUFDRkEyNjcxRjBEMEYzQjkyMzZDQTY5MTVGRjhBNEVBQzlBQURFQ0U0MjhBQjU0QkRCNTMzQjRCMzZCM0I1OTEwQjg4QjIyRTU0NjVEOTc4QUYxNkRGOUNDQzYyMjkwNTA0RTJEODM1MzA3M0U3NUE1ODlBRjIxMUQxRDZBN0UwM0I5OTFCQzk3ODA0MkVFMEZBQzE5M0YwQjkzMTNBQjY5MDkwQTc5OEY1RTFFMjhDQTE0MTc5Mzk1NkUzRjlBQjZBMzUyQjg2NUM0MzkxNjY3NjFFMDM2QTE0Mzc3MkYwMTU1MDFDQjVGNjhBRDI3M0ZDRTM0RjhEMTREMjEzOTcyNTRFQTQwMkU2M0YxMjcyOEJGRkY5Q0U0MUNBQzY4ODU0QzlBQTQwM0E4QzBENjcwMTY3RjM4OTIxNDFCQkE3OUI2ODFGMjdDNzdBODEwQUQyNkM2QzcyNjU5RDkxNDVEMTk1RjM5NTUxRTUyQjREMEVDQzA5MDQzRDk5MjVBQjZBRkZBNDIxMTk3NDVFMDVGODQ1RjJCOEY5QkI1Qjc3QUZCQjY0QkQ0NUYzOUY2Q0I5RUJDRjUSgAQ5N0NCNEI5RTEzQTExQ0I1QkQ1OEFBNjMzRUUzMEJEQzZEQUMwMDQ0NzVENkM4OTExRTA1M0E4NDg1NjEyOUI1QkRDM0NGNjFFQUNGQTI2NzFGMEQwRjNCOTIzNkNBNjkxNUZGOEE0RUFDOUFBREVDRTQyOEFCNTRCREI1MzNCNEIzNkIzQjU5MTBCODhCMjJFNTQ2NUQ5NzhBRjE2REY5Q0NDNjIyOTA1MDRFMkQ4MzUzMDczRTc1QTU4OUFGMjExRDFENkE3RTAzQjk5MUJDOTc4MDQyRUUwRkFDMTkzRjBCOTMxM0FCNjkwOTBBNzk4RjVFMUUyOENBMTQxNzkyMEIxM0JCMDM0OUFCNzhGREEyNEQ3QjM2QjY0QTk1NzEzMzAxRUM3RDlFMDgwREYwODIxQzQxODU5QjY2MTgyOTFBOUQzMDM2ODg1MzE5Mzg3M0Y4MkFFM0NBNzFCN0MzQjc0MjFBREYzODYzNTdDQzNCRDlDRUJDMDUyMThGRUEzNzFGNjQ4NDBBNDg1RTk3NUIzQ0FGN0I2NkNCRThBODY2NDUyRTRERjMwRThBRjUwMjUzRThFMjQyNzJFQjUzQ0I5MzJCMEI1NkZENTdEMEY1MEM2MThBNzQ2Njg4RkNEN0FEQzczREVCNjc1NUY2NTQ2QzNDQkRGMDJDNkFBQxqABDg0QUEyNjVFM0RBQkUwNkJCODZCNkUyNUU5MTg3NjNCRkI2MUEzREIzMkY0RERFNURENzFERTZENTczNDcyMEQ5NjZCMjIxMjIxNzMwNkY3MTgyNzc5MDk1NzkwODlBNTM0Mjk4NUExN0Y4ODdEQkE4RUJEN0M3MkJBMkZDQkQ1MzcxMTY2MDE0NEFEMkNGRDE5OEQzMkNGM0U3NTEwMjE0NjYyQjJDREEzNzIxNjBCNjlFQ0I0NEU3QzAwN0EzMDI1NkJEOEY0QTJBRjE3RjU4QzgyNjZBMDg4NjAxRTk0MjI4RTQ0Nzc3MTEzOUZFQTJCRkY0MTFBNzZBRDAxQ0EyM0M3M0E1QzBENEU0RkU2NzFGQjA0RTQwNjVFQTIzRjBFMjc0NUQxNDFBMUE1NDU0QzM4REE4QUE5OTc3QkJENjVEMUMxMjBGMkQwMjA4QzkwMzgzRDI5MjE3NEY5NTFGNzUwOUZDQjAxNjI4NERCMjkyRUUxQkVDREY5NEZGREMxMERCQTJFOEE1RDFBMTFEQzJFNjdDOEI1OUExQUMxMTlFQ0ExNzIwRUI0NEExNjVGMjg3MjFEQTIzODdGQTdCOUE0RjhFQ0Y1NzIwM0Y0NkRFOEM3MkQ3QUYzN0E3REIyREIwMzdDMzA4QzkwM0Q5NjkxODVENTVGNkExNzJDIoACQzk5NDk4Q0VDMTAwMTk2MzY5RDI4RUZFMUYxQkE5MDY5REJCMjY4NjY0OTJDM0I2MUEyMjcxN0UyOUJFOTc3QUE3NUQwNkRERTRCMzFCRUQwM0VBOUU4MzBCNDM0QzU2QUIxQzQ4M0NBNkRFRjExNzAxOEI5NUM4NjNBQTNFRTZFQkE1QTY0RDI4RDkzMzJENEMzMDIwMkE5MDI3MDE5RjZEMkMwRUU5MjE4ODA5RUYyMjFBMjlGRDY0MUNEMjQyRjc0QTU2NUJCQzU5QzIxMEIzMzcxRjI0NUU2RjdEOEIyQTBCRTBDQjI3NURCQkE4NUQzRUY5OTVBMzc4QTdBRiqAAkMwQzVFQkM4QUJGN0MwNTc1OUE0MkVFMTkxRkJBMUJFRDA4NjY0MkFGRUJBMzAyNEMzMjlGQTIzN0FBOTg1NTUwRjUyRUEyNTA1NEVCNTFBQjY4MTI3QzA1MzBBRkI4MjgxQkU0OTRDQTYwQTUxQzBDNjQzNUM1MjA3NEFCMDY3NkY0RjEwRTk0Njk0RjAyREQ1MEFEODZBQjYzM0RDN0Y1MkU4OUJERDQ4ODJDQTU1MzBCMDNGRDUyQTVEMDJGOTgwRkMxMEYzQTM1OEUwNjA2OTUzQzUzMThDQUU1OEEzOERFMjBEQUU2ODM2QTRBRDIyQjQwM0EzMzdGOUFBOUIygAQ5RUJBQUUzNUI1NTc3QzI2QzJFRjBGRjBBMzZENUEzNDBDMDA3QUNFN0FDRjJGOEVCRThCOUY4NDE3MTQyQUMwRDcxMzcwMTg2RkVBMzVENDUyMENENkUxNEIyNDhCREQyOTYyOEVEMUFEMjI4ODlCN0QzREU1Mjg3M0M3OTVENjM4N0QzNEMxMkRCQ0UyMTRFNUEzNDQ3MDEyQjI2RUZFRDU2ODY4MDI5MTQ2OEM2Njc0NUZFMTNDQjhGRUFGODY4QzkzMjk2OERGRjJENTQzRUFGOEEzMDM1ODk1QkM5QjM0Qzk4QkZGNjBEQ0Q3MEZCNzA0NkI1QkIwNUZEQzU1MDc3MkYzRUQ0MjgyRjczRDY4MzZDMjZEQ0ZEMkYxNTM3MkQzNDc5MTE2NEMyRDcwMDJCN0E1RDIzMEVCRjQyRDM2NDUyODc0NThERUQyMzkwQzU2NTNGNkU5MUFFQ0YxMkE0MTkxNzI4NjM5MjZDMUI1MzI0NTcyRkRDQzA0NDZBNUYzNEIyM0RDREVFNDk4QkFDMDNDNzhCMzdERDZFNjIxOUJEMUU4MkEzQzBBQkRCRTk0Nzg2OUJENkRBNUZDOUNERUI5OEI1MTQzMzM2QkVCRDlCMjIxMTdGQUE5OTNBRjlDQkE1ODhCMTEwNzZFQzdDQzdFMUM3QkU1QzlBMTqABDkxMjk3QUIxQkRGNjU0RDcwRUE4MEVDQjZCOTJGODE1NjAzMzM5RTlEQkIwQjM1NTY4QTk2RjNDNzJFMUE5MUJBQjM5QzhERjJFRENFMTZGOEIzRTc2ODlBOUNCMEJGMDFGQjdBNjM2NkZFMzc3OUE2OEM5NDNFRTAzN0U2NTg5OTI4NDZFRkMyOTJBQkQyNzYwOEM4RTkwODNFNDMzNjNEMDQyRUFFNENGRjcwRDg4RTE3RUNFNzNCRTEwMTE2MjFDMkIxMTlFNDZBNEJEQTcwREVCMDQ3QTVDQzFDMEFCQTU2NjlBODk5OTgxRkRGREY1MkUwNTk5QTNCMUU1REE4RjFGQ0IzMEVCRjZGNTJBNTdDNzE4MTc3NDExQ0ZEN0NGNDAxRUU3NUE4OTU2QzNDQkI5NzU3OEZGRkYxNkZFQUY3NzVGNDZDRjFFNUMxRkQ2RUUzN0NBRDQ0QjY1MURGQTBGM0VEMTA1QkM4NjBBMjdGMTQzNTgyNjhEMDQzMDkzNUZDMjYyMzU1REJFOTI1REFFN0RCQTMxRDY4QzMxREQ3ODQ0Q0YyMDIxNzJCQkU4QTVGNUFEODMzRTE5NzU0RjY3NDNCRkYwMzcxMzA3QkFENzUzRDg5QzA0NjIyNjIxNjQ3QTgzRUJERDcxNDc0NDI0MUUyREVEMzgzOUQ5QoACQzk5NDk4Q0VDMTAwMTk2MzY5RDI4RUZFMUYxQkE5MDY5REJCMjY4NjY0OTJDM0I2MUEyMjcxN0UyOUJFOTc3QUE3NUQwNkRERTRCMzFCRUQwM0VBOUU4MzBCNDM0QzU2QUIxQzQ4M0NBNkRFRjExNzAxOEI5NUM4NjNBQTNFRTZFQkE1QTY0RDI4RDkzMzJENEMzMDIwMkE5MDI3MDE5RjZEMkMwRUU5MjE4ODA5RUYyMjFBMjlGRDY0MUNEMjQyRjc0QTU2NUJCQzU5QzIxMEIzMzcxRjI0NUU2RjdEOEIyQTBCRTBDQjI3NURCQkE4NUQzRUY5OTVBMzc4QTdBRUqAAkMwQzVFQkM4QUJGN0MwNTc1OUE0MkVFMTkxRkJBMUJFRDA4NjY0MkFGRUJBMzAyNEMzMjlGQTIzN0FBOTg1NTUwRjUyRUEyNTA1NEVCNTFBQjY4MTI3QzA1MzBBRkI4MjgxQkU0OTRDQTYwQTUxQzBDNjQzNUM1MjA3NEFCMDY3NkY0RjEwRTk0Njk0RjAyREQ1MEFEODZBQjYzM0RDN0Y1MkU4OUJERDQ4ODJDQTU1MzBCMDNGRDUyQTVEMDJGOTgwRkMxMEYzQTM1OEUwNjA2OTUzQzUzMThDQUU1OEEzOERFMjBEQUU2ODM2QTRBRDIyQjQwM0EzMzdGOUFBOUFSgAI3NTkxMTZGMjFFMUI5MjRGMjBFOTBEMzBEOTgxODEwRDQ0MTM5RTUxRkFBNTg1RDdDNDE5NTVGMUZGQzY3NTI3Njc2NUM5QTMxRDE0NUY2NDFFQkM0OTM2Q0M2QTlENTVFMTgyN0Q0RjY0Qzg0RTMxRkU2MUQyQkUyRDU0QkM1QzU5NDMxNkUwMDdEQTM2MDNENkJCMDFGNEU4Q0U3MUM3OUUxOTE3MDk3QkRBQUM4OEVFMEFDMTM4M0JCQkZGQjM4QjQ3QTk5NDNCNjBGMjNDOTYwRjc4QkRCMDc0NDIxMDBEMzQxODJDQzg3MTdDREE5MjczN0I2RDQxRTY4QTczWoACNTA1N0QwOEU4MDdGRTk1NjNGNjREQzc2MkVCQTJBMDQ2Mjc0QkQ5MjRDQUVCQjU5MjNBRjI5RTNCNDRDODNBRTAxRDNFQ0IwQTk1MDY2NENERUIyODQ2MzJGNzg3MzU1REY5MUI4QzRBREEwNDQwRUExNDI4RDdCMTcwNDM1QUI1NzhDRERERjcwNThGMDlFOUJDOUY0MkI3MDZGOUI4MDVEMjBDOTVCNUI1M0Q2QTZCNTZGNTJBNERCQ0VCOUMzQTM1MTQ0QzM4M0QyNTIwOTE5MEI0MDA0Mjc0MkFEQTA5RDhFODQ5N0Y0NTlFMDRFMkYyNEE5NENDREY0REI5RGKAAjU0MDM4MURDQTJFNDg3MTQ0OEU5ODFDRDQ1OUEyN0Y5NTlBNzg4MzQ2OUVEM0RERTU2MDkxQjhDMjlGODIyNTMzRkY3M0QzQUM3OUVCQzg4RTUyRTU1NEMzRUQ4QUYwMEM5OTlDQUVENDIxNkEyRTUwMzI5QzMwQTM2NTU4MjhBOTI2MjhGNkQyMEZFRkQyOTc1NzUxRTM1QTc1ODhGRDdDRjEyRjdERkE1QUQ1RDY2MzQwRjY4QzUyODYwRDI4RjZDMDJBQ0M3ODBGOENGRDQxRDI3QTY2NkFERkIzQjdCMUNEN0M4OUU1RUVDM0VDRENBQ0I3RTI4NjE5MjFEM0NqgAI3MDZFMUIzQTJCNzdENzAxMUEzRjUyNkI2MzQxNzdCQTZFMTFBNjk4QjIwQjc0Q0I5RjdBRDAzRkM2NUQwMUE3MEQ3RUZENzQ1QkZFNEVDREQ3Q0VBMzVEMjM5Mjg4MkNBMjJDOTA4N0Y4NkEwREIyMjUwMENFRDZGMDQ2N0FCQzE3QzIzMzA5RDYzQkZGOEYzOTQwRTQzRjQ1QzQ0MEZFRjVDN0QyODFFRDJFRjNBRTdCNDBFRDMwNEU4RTQ5MzVEREFBQ0MzMDFGODY4RTU3NTA0ODg1MkQ2NTZCQUIwMkYwNTM4OTE2NzNEQ0M0NUVGMzhGNUE1NjZBMDRDRUZFOoYICoAEOTdDQjRCOUUxM0ExMUNCNUJENThBQTYzM0VFMzBCREM2REFDMDA0NDc1RDZDODkxMUUwNTNBODQ4NTYxMjlCNUJEQzNDRjYxRUFDRkEyNjcxRjBEMEYzQjkyMzZDQTY5MTVGRjhBNEVBQzlBQURFQ0U0MjhBQjU0QkRCNTMzQjRCMzZCM0I1OTEwQjg4QjIyRTU0NjVEOTc4QUYxNkRGOUNDQzYyMjkwNTA0RTJEODM1MzA3M0U3NUE1ODlBRjIxMUQxRDZBN0UwM0I5OTFCQzk3ODA0MkVFMEZBQzE5M0YwQjkzMTNBQjY5MDkwQTc5OEY1RTFFMjhDQTE0MTc5Mzk1NkUzRjlBQjZBMzUyQjg2NUM0MzkxNjY3NjFFMDM2QTE0Mzc3MkYwMTU1MDFDQjVGNjhBRDI3M0ZDRTM0RjhEMTREMjEzOTcyNTRFQTQwMkU2M0YxMjcyOEJGRkY5Q0U0MUNBQzY4ODU0QzlBQTQwM0E4QzBENjcwMTY3RjM4OTIxNDFCQkE3OUI2ODFGMjdDNzdBODEwQUQyNkM2QzcyNjU5RDkxNDVEMTk1RjM5NTUxRTUyQjREMEVDQzA5MDQzRDk5MjVBQjZBRkZBNDIxMTk3NDVFMDVGODQ1RjJCOEY5QkI1Qjc3QUZCQjY0QkQ0NUYzOUY2Q0I5RUJDRjUSgAQ5N0NCNEI5RTEzQTExQ0I1QkQ1OEFBNjMzRUUzMEJEQzZEQUMwMDQ0NzVENkM4OTExRTA1M0E4NDg1NjEyOUI1QkRDM0NGNjFFQUNGQTI2NzFGMEQwRjNCOTIzNkNBNjkxNUZGOEE0RUFDOUFBREVDRTQyOEFCNTRCREI1MzNCNEIzNkIzQjU5MTBCODhCMjJFNTQ2NUQ5NzhBRjE2REY5Q0NDNjIyOTA1MDRFMkQ4MzUzMDczRTc1QTU4OUFGMjExRDFENkE3RTAzQjk5MUJDOTc4MDQyRUUwRkFDMTkzRjBCOTMxM0FCNjkwOTBBNzk4RjVFMUUyOENBMTQxNzkzOTU2RTNGOUFCNkEzNTJCODY1QzQzOTE2Njc2MUUwMzZBMTQzNzcyRjAxNTUwMUNCNUY2OEFEMjczRkNFMzRGOEQxNEQyMTM5NzI1NEVBNDAyRTYzRjEyNzI4QkZGRjlDRTQxQ0FDNjg4NTRDOUFBNDAzQThDMEQ2NzAxNjdGMzg5MjE0MUJCQTc5QjY4MUYyN0M3N0E4MTBBRDI2QzZDNzI2NTlEOTE0NUQxOTVGMzk1NTFFNTJCNEQwRUNDMDkwNDNEOTkyNUFCNkFGRkE0MjExOTc0NUUwNUY4NDVGMkI4RjlCQjVCNzdBRkJCNjRCRDQ1RjM5RjZDQjlFQkNGNkJAMkM0NzgzMTYzNjNDQkRERkI2RDA2Mzk4QzZFMDUyNUNBMTk1N0I1MjhCQ0Q4NEI1M0NCNkNDRTk0NzVBN0YyNkqPAQpAQTg0MzFGNTExOEFFMEQ0OENFQkY1REJDMkQxMzY1NjA4RjQ3RUJDQjBBOEZFQ0Y1N0YyM0YwN0QxRkE5QUY5QxJAQ0JCMjM1NkE5MUFCNDRCNzlGRjE4MUM0MkEyOEY5RTUzMENDQjE1RUQyRUY4QjRFRDgxNDk3QjlCQkI4QUJCQRoJc2VjcDI1NmsxUoAEOTExRDRGMDlGNUNBNEZEQTEyRDI2QjZBQUY4Rjg1RjRCQTdERTlFRTVDRUQ2RUMyMDNGQ0RBM0U0ODI2RjJFN0RFRkY5MUZDRjc0OTUzMkZFNjJCRkU3RTI3MjkxNjFBRTM1QjBERTAxRjgwNUZCOTFERUE2NTc5QTc0MUZDOTlDQzRFRjQ1RUJEOTNFMjM0MjFDRUI2MzlDMEM4QjM2QzU1MThDQUI3MzI2NEIyRDkxRUZFNTNGMUUzNkRFNjA2RDEyNzlDNDI4NzM3QkQ2RDhDQTFBOUE2OTI1NEIzMEE2ODAwMDYwMzk0NTYzODdCQTYwRTExMjBDOUVDM0YwRjlBNzVEMzg0ODc3NzkzQTZCMjJFMzg5QjM5MjhEM0FBMTBBQTNENTExMzE0Q0Q4QjMzQjMxNDgzREFCQjdFRDYwQTZFNzA0NkE2NzU0NEVCQjFFMjE5MjY3NjM1QkI2NENCREJCNzU1NDA0MDQ5QkM0QkRBN0EyQ0I3OEYwQ0RDQzExNjFFMEY2ODY0OTE5Qjc1MDBBRDM4QjFGQTI2MTc0REQ4MkQxRDExRjU5MUI3NjY4NzYzNEMxNzJFOEVGQkRENkNGRUMwODVDNjZEQTk3OTYyNTZCMDNEQzhDMEI2Q0IyNzJGMTk2NzRCMzQwMjU1NTBBQjIwQTcyNUU2ODVagAI2MDJGOTcwQzI1ODNFOEY1NEVEMDg4M0M0NzU5Q0M5NTRENDA4Rjc4NzRGMEU0RDRFMEYxODQ1RjhEQUZERjQ3NzRBREMxRUY4NkE3MjVBNzg0REJBNjA1QkE0QjVBNUREQTFENzVDNDE3OUY1RTJGRUQwNjUwRkVCNEIwRkQ4MTkxMDcyQkM0RkFDQkRFRDlDMDg4OTU1NDIyODdDOTQzQ0YyRDY1NkU4NzJDNDM0MTg2OEEwQzEzNjIwRDA3N0VBRUEwQjUwNkIyNTM4NjlBRDUxNDc0MEY3QzVBNUVEMjQ5OEUyMEYzRjYzNkJBMjRCRTM0NDU3Mjg3QzIxNkZEYoACNjA4RTU3MTUzQkExRENDNDJFQkU4M0Q4QTM5MTdCNTRGRkYyODg1MTQ2OUIzQzNGNThENkNEQ0ZCMzdFRDdEN0JEOTA5NDY3MjRBQUFDNUVCMEQ2RjQzNzJGOTdGRTQ3MjJFNzFENEQxNUMwODdGQTQ5RjdFMDZFNDI3M0U4OTA5QTc4N0NCODFFOTcwQ0RFMkJFMUExN0VGRUJFMDNDRDI2OEU0ODAzNjk1Njg1NkJEQTdBNzM3RDc0MDJFNzZENDc1RDg4MDU1MjkzNTEyQTlBNzJCRjc2MTRFQzI0MkY0NEU2RkY0NTI3OTAzNDcxMDFFOTA5QTQ5QzM4NEFCRmqABDM5QkNCMDJBMTQzREM4OTlCQTBEREVGNUQ1NDIwMzUzNTE0MTEwRDVFREM3MTU1NTI4RENCOEFGODE5MjNFNDJBN0M1QTQxMDg0Rjk0MTcwREUxMjU0NkM5QUMzMDY3QkJCNDVBNEQ2NUFFQzUwQkMyMzhCNDcxMjlEREJDMjQxM0U5N0I3QzMzRkE3ODc0NkFBRUQ1NkM2Q0MyNDU4NzI3RjBCNUM0NkQ5Q0JDNjZBMjJBODA3MjI4QTFDQkM5MkNFRjUwQ0Q1NDA0NUQxRjhEMzdGQzRFNjlENzFGQzA1OUJDQkI4QzBEMENBNjkyOTFGMjU3RTdFQTY2MTQzMUJDNzkyOUY1QjkwNEM5QkQzNjNGQ0U0QTNBMzE5Qzc2NzIyRkRGNzA3NThCNkQwMDhCODkxNzM1NkQ1NDhEODFDMjczN0FBRTY1Qzg1RDhCNDNGRDBENjYzQjFBMjJEMjE3RDIzQzhCMzk5RjhBMzQ5NTE1RTdFRDA3MDlENUI0QTYwNkZGRkVGRUNFRjFGRjczNTZGMzVGOTg5NzYyRUZDOTY5MTU2QkJBRjI1MEM3MzlENjc3NjJFNDQxOEY3M0Q4OUVFMEU2NDYzQzE5Njc2MjQwOTBGMzgyRkI4REMyRjRCQjMxOEJBMEVFREMyMEM5MUZFMjEwM0QwMkZDQzI1coAENTk5MjBGN0RDMkM1RjVBOEY0MkY4MkY2RENBRTkxNDkxQjRENzlFNzJBOUNGRUYxMTc3OUZEQzhGODM1RjkxQjQxODlDQzJCMkNGQzJDOEFCNzQ0N0ZFRjQzQjBGMzY1QjlBRUY1OTI4Q0EyNzcwRUQwQkVCRTAzQUJEMkEwNTg4OTg0OEQ0QTcxRjFCRTkzRjBGNEY1QzkwNjQ3NTQ4NkI1NjQ5NDBEMzRGNjMzQTlFNURDRUJCRDcwRDVGMzQyMTU4NUFDOEQ0MDgzRTJFODgxNDIyODkzMkNBMEY2NTkwNzM1M0QxQjQ2QkM2NEQ3NTUzRjFCODRGQkRFMUE3OEQ4ODlDQjE5OUNGOEZFNEY4QzU1MjI0NDhGQzJGMzgzRkM1QTdFMEQzQUI4MTI5ODU5RDc0RUU1MkJCNzlGQzQ1MEE1QkJBQzA0QUMwMDcwNkQ4MTk3NDJBOEZDNUJFREYzM0EzQUUwODQwRUEyOUM2NDRFMUU2NzE4M0I3MDk2MkEyRkI5QzU1NkFFODlEMEQwQkY3MUVDNUIzQkM1OENFODhFRUYzOTI0OUVCMzAzMUNCMzc5NENGNUQxNTAyMEI5MTA2MjM0NDk1QjUzQzZCQTFGRjE1NDk0NTJGNjFGQUFDMzIzQjkyQjhEQTJEQTlEMzE3QThDMjcyQzEzQkF6gAQxRjY1RDQ1MEE3QUQwMEEzMjhGMjRGRjA3RTU2NEQxMjU2N0Q1NTJDREMxRTREQzYxMzM2Mzg0NTVFMjk3MEMzNEU5MkY0OTdENkZDOTEwOEMwMDM1Q0Y3QjQzQjk1RjQ2MzMxQ0ZBRDA4QjlDRTdDQUQ0NzYzQzM2Q0JGNjYxMTkyRDE0RjY1NDIyQzcxNDUyQTIyMjc1NTNEREY2RTcxNjMwNUYzQTBFQzg3NDlFMkIzRDg5QjZDM0VBMEVCMzVBOTQwQzk3Qjk1NTQ1MzY3NkZBMEExRUVFQjU4RDBCQTRFNDFCRkFBM0MyRDkzNEY3NTY1ODc3RTRCM0VCRUU1QTJDRjJDRjUyQTA3OUM1RDNGOTY3MzA2Rjg4Q0NGQzM0MUJENjIyOEE5QkY3OTQyNjhFRjUwRUI1MUREMDVEQTk0NjMzQjAxQkRCRDA2NDdFRjI1Rjk0RTU5MUY4RDdGNzJGQkI0NDY1RjkwRUIzNTRGNzVCMTlGM0RBMDg1MkM5QTYzMzExQTU2MjFDOUJGNzE1NDk0OEVGNUM3REVEMTA3MzhFN0VBNzU4NkZFRUU3RkFFRkM0OEU1NDMzRTc4NTE5OTM1NTM3MTIwQUJEQTdFQzA0MkZFNUJBRUQ1QzRGQkE1MkQ2NjJBNjg3QzBFMkMxRDI2MjNFMEYwRDUwNYIBgAQwREI2NDI5MkZBNUVCOEY0MUM5QUM4OTRGMTlENzIwQzgzOEIyQkJDRTYzRDYxNzA0QjA5NjczMUQ3RUQ3QjY2RTJCODdFMDA5QURBN0JCOUNDNDk0MjVDM0IzN0I5OEQwMDc4MTlDMkU0NzBDRUEyODYzQUQ2Mzc3NjJCQTQ5MkQ0Q0U2NDFGRThDMDQzMTUyRjAwREQ5OTU1ODA2MjVDQTk4QjVDRkU5NDdFNEE2NjFFQ0YxRURGOUY5OTE4Rjk5MjlBRDA1MDZGMkQ3Qzk5OUJGNzA2M0M2MjZCNkNGODNBM0I2N0M2N0EwMTBEM0M2NjdDNDlERTgwMkI4NUU0NDdBMkREQzg0MUIyNDdEN0I1MkQ1Q0M2NUY1MzkwRkUzQ0E5MzdFRDIwNTBFNzdCQTQxMkU3ODc4OTZCMkM5QzBFQUQ1NTc2RTI1QjZDMTM4NDQxMUQzMkU2RjRDRUMxNjNCMjI5MTZERURBOTk5NDA4MEM1QUIxMTUyNzVGNzAzRTkxNTlEMDFDMDU4Nzk3ODMyQjNFRDQyMzE1RThCQzRDMjRGNDdBOEZBRjkxRDhGRDVEMTE1Q0Y2RUZFN0UzOEFGRTU5RTc5RjE4MjM5RTJFNkM5NDY0M0E5RUMxOUFENzY3RjYzOEZERTUyRjhFODU5NDMwREFBMUZDQTYwNDK0FQoKY29fc2lnbmVyMRoCMDE6hggKgARDNTRFMTdBMkI3ODI1RDRBQzM3MDQxREEyQ0YzN0JEQTMxMDcwNjZCMkQ0OUFDQUNCRkZEQ0E1NjQ1QzRBQjc3QjhDNUY3MTE1RjlEMkREQzhEQzcyNjY2QkI2MTM2QkQzOTE1OUM5QjkyQzEwNkQ2ODA1MDkxMzgxOTk5QjlFOURERDM2MzFDMDBEQTgyRDE4Qzk4RTBDQTYwNkYwRTNCQkE2M0QxMjBEODYyM0I5OTExMEVBMzA5OERGNkI2ODJBMThFNkY4QTNGNjVFQUNCNTE3RUZFNTlBMEIxMzczMjEzMzRBQzEzRjdDNEIyRjEwQTY3RUU4M0MwODJGODk4MDA1RDFEN0JCQUZCOEFGNDRDNzJEQ0EwRTIyRjhFMzE0NjE4NTBCRDQ0NjEzRTQxNEZCMUQwRUI2NkEwMTdBNDFBQ0M2NURDMTUyMTUwREFCMTI5MzFEMTVGQ0U0NDRBMkYyNzY1MjFCQkYyMjVDMjhGQzkwNkJFNUIxOTI3MzZBNTY1NEY1MTIyQUY1NUY2N0I0RjY3N0IwNDFBM0ZEMUE1OTE2MEE3NTVBODE2RkFGNEVCOTcxMjYxOTI2NjFFMjIyREYxRTQ4MjZDMDMzODIyRjQ0RkI5QkZCMzE0QzI5Qzc1NUYwRUY4QTVFQTlCQzhERDlBRjU5NzdGNTQ5ORKABEM1NEUxN0EyQjc4MjVENEFDMzcwNDFEQTJDRjM3QkRBMzEwNzA2NkIyRDQ5QUNBQ0JGRkRDQTU2NDVDNEFCNzdCOEM1RjcxMTVGOUQyRERDOERDNzI2NjZCQjYxMzZCRDM5MTU5QzlCOTJDMTA2RDY4MDUwOTEzODE5OTlCOUU5REREMzYzMUMwMERBODJEMThDOThFMENBNjA2RjBFM0JCQTYzRDEyMEQ4NjIzQjk5MTEwRUEzMDk4REY2QjY4MkExOEU2RjhBM0Y2NUVBQ0I1MTdFRkU1OUEwQjEzNzMyMTMzNEFDMTNGN0M0QjJGMTBBNjdFRTgzQzA4MkY4OTgwMDVEMUQ3QkJBRkI4QUY0NEM3MkRDQTBFMjJGOEUzMTQ2MTg1MEJENDQ2MTNFNDE0RkIxRDBFQjY2QTAxN0E0MUFDQzY1REMxNTIxNTBEQUIxMjkzMUQxNUZDRTQ0NEEyRjI3NjUyMUJCRjIyNUMyOEZDOTA2QkU1QjE5MjczNkE1NjU0RjUxMjJBRjU1RjY3QjRGNjc3QjA0MUEzRkQxQTU5MTYwQTc1NUE4MTZGQUY0RUI5NzEyNjE5MjY2MUUyMjJERjFFNDgyNkMwMzM4MjJGNDRGQjlCRkIzMTRDMjlDNzU1RjBFRjhBNUVBOUJDOEREOUFGNTk3N0Y1NDlBSo8BCkA2QThCNjA5QTdEMDJCQjhFOEU3MTY0Q0EyRDI0MDFBRkYwRDdBNkM1N0Q5ODM5OTMzNTNDMTNFMkY0MDI1NTQwEkBCMUZCMUU5QzlCMEZENjA2MEIzODA5Q0FFOERDMTg4QzlBNURDQjZGMjk0RkFENkMwRTk0Q0Q1QzlEODFDQzgwGglzZWNwMjU2azFSgARDQTJFOEJCNjEzQUQ0NjIzOThBQzA0RTRDQkJFQUUwNjE3NThFNkMxOTMwOTQ1NUJCNzBDNUI4QzcxQjk4QTBGMTlEQThERDNDMTdBNkQ2MThGRTJFODVFQUFEMzIyNkYzQTAyOUIzQjVEOEM3NTU5NEQ5RjEzOTA2M0ZEODUyNjY0OERGNUEzNUNFOTI1MDg4NTI3RDg4NTVGREFGN0NFRjU4RUZDMThEQURDNjFDNTQwMzA3M0E3OTAzNjczRTUzRkZGM0Q1RjhCRkRDNUE1MTBFRkQ3QUZBQkJGRjM2M0ZFMDRGNzlDMEJCRkZBNkEwRjcxNjc4OEIwMDk3Rjk1REUwMDMyMEE4RDFEMjA0NThERDVDRjI4MzVGRTE0OUE3NkI1QTJDNDRCRDI2Q0NDMDRFOTJFRTg1QThGRkJENTNGMTYyODQ4RjhDMjJCNUU1QkIxQ0NFOEQxQTQyOTU3M0VBNjdGOTVCRTdGNUM4QTJFQkRCQjVDRDBDMTU0NkVGQ0Y4QjE1REY0RkQ0Qzc5MUJDRjBEQTg0Q0U0QTkwQjM5RkE3QkQ3Q0FCNjI1QjgyMDFCQjNFMTNCQ0IzMzc2OENDRTIzQ0U1QTRGRDc0OEVGRDQ3MUYwODc3M0RFODEzN0UyNDM2NTM2NUZGQTRGNUQ2QzFFNjNFNkREMUFENWqABDFBNUQ4MThGNTExMTg4Rjc5MDMyODRCNEU3MDAxREE1MTBBRjEyMDFEMjJBNTFCNTA4QzYyODBBRjFBQ0U3OENCNjExMjk2NzRBODAwN0U2RDhGMzUzQTM3REYyRUJCMzk5OTdCNEM3RUEyMDhENTI2Mjk0QURBMEQwRTlCOUQ0QkVEODIzQTRDQjU0NjhEMEJEMDhCNDVEMjFBQjExRTE5RjQ0REU2Njg5QUEyREI5QTI0NUZGRkQ1NTdBNEJGREE5QTAxQ0JEOUFGQTMwNTdGQkZBMEQ0QkQ3MEEwOTQ4OUVCQTEwRkJFMzhGNjZEQzQ0RjZDMzZDMDgyQ0RGRTg3M0ZGMjQxQUYyOTM0QTc0OTdGQ0U3MUNGMzg5MzA4NjgwQzI1MjY5QjNBODMzQzZCODNDOEM3M0QyMDQ4REM5MUQ2RkFGMzdERjIyQzI2OUMwNEE2N0U0OEI1QjA2RTdBRDBDREI0NDU5ODhFRUVFQkNDNDhBMDU2QTI3MTNDMzc1NkQxODE5RUZBMTFGMENCQUY1QkI3QkZBNDlEMjZEODM0NTgwOERDMEU1MDBCQkI3ODZEN0QyODk0QzA1NzcyNzhBQzQ0MkYwNDM1Qjg4QjFGMkU0RkNDMDlDQUZBN0I2MEY5RjVDQUJFOEVCMTgyQkVCQkNBMEY2QjZDRjM3coAEQUMwNTM3MEE5OEMwQTk2RTAxRUYzQTdEODVCMjkzNkEwMEU5Q0M5MzNBMjBENUI2MTM3Q0VBMzRGRUM5MDZBNzJDNUIwQTMyNDZBMkRGOThFNjdGMUQ3OEQzNjg2MzQ0ODU2QjFGMDEzQTZERjU0ODY4NTJFNjcxN0M3MzFCNTlGOTZFMzQyQ0Q5QzYxOUZCOTkzNkEwNURFMTZDNEUyQ0U3ODIwQ0QxNTVGQURBNTExNzIxMjBBNEM2OEYxREE3MEZDM0Y2MEQwRTI4OEUyRENDOUU3MjAyNEZGRUZCNzYzMzUzNjA2RjBGQThGM0U5QUU5NDcyN0QxNUNGM0U2MkU4QTlGOEYyN0Q4NzFGRUI4MzYzNDFCQ0QxM0EzOTM0NEM3QTk0ODA0MEI5MzUyNzZEOUY4NzdFQkQ1QTFDNjBENjAyREExQUY4NThEQTg3RTg3RENBMjgxQTczMkY3MTQyQjJDNzM1MUE2MjExQ0Y0MUVDM0RCRUFERDEzRDc2NjI1MjYwMEU3OERGMEU0M0M4MkM3OTcyRDQ3NTg3RkMwOUVDNjQwNENCRTNCRUM4Q0E2MUIwNzFCOUQyMzE4RkVBRjE5QTdEMDI2RTQwQkU4NTBDRUEwNTk2Q0Q2NEQzRDJCNUE2MjRBOUEyOTI1N0U0NDdEMEJGQkNGMDUxOUYytBUKCmNvX3NpZ25lcjMaAjAzOoYICoAERDBEN0FEODQ5NjJFOTVEQjEwQ0VGNDI0NEYxQ0I2MjRCQzZBODk3OURBN0ZDM0Y5QTdFMkVDRTIyRjU0QUVGMTBFMzY5RDYwMjUyNUFGQUZFNzM5MDJFQjhFMzBERDc2RjA2MjdCQUI1MDhGRkE1Rjg1NDhEMEYzOURFNjU1MkQ3RjUyNTU3Qjc3QUQ1MjkyRjI3RkY5RTNFMzBEMTExMDg4MTJGNkYyRUVGM0JBMDY4RkU0Rjg1ODUzMTIxRjM3NTRERkQ3ODNDNkVDM0YyM0QzOThCNTgyQ0I5NkQyQ0ZBOEYzRTMyMUE4ODgyRDVGOTlFRjMyQ0U4RENEQjI0RkE2M0E2M0Y2MTY3NkI0RTA2QzdBMTBCNkUxQUIyNzhDRDRBMTc5OURFRTBDOTJDQ0QxNjI3NEM1MDZFMUMzMTM4MUFGNjAyOUZGOTBCMkI2M0EzNDY4ODFDREZGMEE1Q0YwRDNFMzhEM0E2QzczQkUzQzY5MkM4RkE2N0VBMzQxODJERTRBRUE3MkRENDI3ODc4RDkwMkFGQ0IxNEJDMjBCQzBBRkE4MzYwRTY4OUFCQzc5QzBDNEM2NkZDOTU2RUFBMEYxMUNFOTBERjZGNTA3QzlCREREQzg0Qzg3ODZDMzk4MjgwQjJGMjFFQTA1ODFCMkU3RTA2MTk3QzE3MzESgAREMEQ3QUQ4NDk2MkU5NURCMTBDRUY0MjQ0RjFDQjYyNEJDNkE4OTc5REE3RkMzRjlBN0UyRUNFMjJGNTRBRUYxMEUzNjlENjAyNTI1QUZBRkU3MzkwMkVCOEUzMERENzZGMDYyN0JBQjUwOEZGQTVGODU0OEQwRjM5REU2NTUyRDdGNTI1NTdCNzdBRDUyOTJGMjdGRjlFM0UzMEQxMTEwODgxMkY2RjJFRUYzQkEwNjhGRTRGODU4NTMxMjFGMzc1NERGRDc4M0M2RUMzRjIzRDM5OEI1ODJDQjk2RDJDRkE4RjNFMzIxQTg4ODJENUY5OUVGMzJDRThEQ0RCMjRGQTYzQTYzRjYxNjc2QjRFMDZDN0ExMEI2RTFBQjI3OENENEExNzk5REVFMEM5MkNDRDE2Mjc0QzUwNkUxQzMxMzgxQUY2MDI5RkY5MEIyQjYzQTM0Njg4MUNERkYwQTVDRjBEM0UzOEQzQTZDNzNCRTNDNjkyQzhGQTY3RUEzNDE4MkRFNEFFQTcyREQ0Mjc4NzhEOTAyQUZDQjE0QkMyMEJDMEFGQTgzNjBFNjg5QUJDNzlDMEM0QzY2RkM5NTZFQUEwRjExQ0U5MERGNkY1MDdDOUJERERDODRDODc4NkMzOTgyODBCMkYyMUVBMDU4MUIyRTdFMDYxOTdDMTczMkqPAQpARTlDMUZBRjVGRjkyNDgwRDlGRjU4RTRFOTc4MDUwOTU5RUIzNjdBRDc4RkNFOEE2QjQzQUNCODcyRTIxNDEzRhJAOUY1RTVBNTZCM0REMTU2QjQ2QUNFNzQ3NEExQzY5QkVBMjNFRUIzNkM5MzZCMjg5MjAwQzJGQzM1QzVERDhDNRoJc2VjcDI1NmsxUoAEREE4NTAyMzAxQjk5ODVBMUJFNEFFNkQyNTlFRDM1NjJFRDE0NjI2RkJEMjQ3MTNBQzlEQzU4MkE3NkQ1ODUzMkY2QkJBMUVGRDA0OTA5RkQ0RDM1MzQ3MzA0RkFDNzcxNTYxOTQ2MEZFQjI2NDQ1MTYwMjI1NzFDOEYzNDA4RjNGRjI1RUFGNzg2QjkwOTY3RTgyQ0I0MTdCM0RBNEM3N0RBRThEMEJFQkVCNTdGMDUxMkFFMDZCMUYzMENENzRBNTYwMDVBOUNDRkU0NjIwNTgwMTc3NTM2MTNERjhEOENCNkZGODkyMzY3MTk3RTI1NkQ5ODQwREE5RTQzOUZCQThDMzEyMzQwRkNDMjg1QkEwMEQ3QTlGQ0M5MzA5MEZCRjlENzE4MTY5QzNCNjE0NEMxMjNCN0Q5QkNBQTU4ODI4M0I3NDUwQTkyRkY4MDFFQ0U2RUUwMEYyN0I0MjQ1QjE5NDRERjg5QjNDM0IyNkYzRkMzNjQxMTlDRTE3MEE3NUFGODA4MzgzNTk4RDFCQzhFNTIzNTkwQ0JFMTVGN0FGMDFFNkJFRTgzOTMwRkYzMDEzMDEzOEE4NzZDNURGODI2MURBNjg5MUYwN0ZENzQxNjYzMEQ1RDlGOEU4REIyNTc0RUJGRkRBRjk5QTIyRDU3QzgzQzIwNkU2NDYzQkRqgAQ0Mjg0MTU3NjA3QUI3MkFDNDMwMDlERTNGNDg2RDVCMDU3MTMzMEQ0RTk4OTY5NUY1Mzc0ODE4ODgwOEZDMEVBRDcyRDJFODM1NjU2NUM3QjFGNEM0NEE2N0U3OTE2MTA5RDg0OTcyNzU2NEM5MTY5ODY5MThFQUJFNjBDOTA0QTFBNDIxOTI0QzRCMjlERjQ4NjAxMkNEQTUwNjgzM0I5MDRCMTREQzdCMjhGMjMwMzEwRTI4RDJCNEQ5OEMzQzQ0RkZBRjBFQzU5OUEwRTk2M0UwM0FDRDIzMTYzNUIwNDM4NjdDNjZCMTY2Qjc5QkE5MDk0MkI4Nzk2NjZGMjc2RDE4NjlDMDc3OEU3NzQ5N0M0NjEyNDAyMEVDRjAwRTNFMjRFMzY3QTRGQzk4MUM1MURDRDk1NTIwNzY4NjBFMUY4NDdFRkMyMTE3MzQzQkExOTYxMzA3MUZCRkQ5OUJGQ0Y2MkJBODkyQUYzNUM5MDE1QzM5Q0JFQ0NCNDZCOUNCREM1ODI2OEI3MzYwRUZFNUQ2MEZBMzkwQzMyMTU4M0VGMDlENjYxNjg0ODgyMzJDODBGOTdDRTc5QjBFMTVGQ0Y1NTAwQzYzNTFDNkM1OUE2QjJCMTk0REY3Rjg5QTFBRUUzQTVBMEM2QzA0QzE5RUMyNkU0MjI0M0Y1NjkwQ3KABDg4MDQ1NzhCNjRBQTQ2MzQ5NEE2NkZGRUYxNzk2RUUzNTJEQUQ0ODAwQkZEREMzM0M3NTZCMzI4OTdBODk3MDFCN0E5NkRCRjkxQUE4Q0QxMUQ0Mzg4ODFDNjUzMzU5QTMzMUEyQTcwRDBBMUIwMzRBMDRDODA3MUI2QUJENThCNUMxMzQ5RUYyNjNCQjIyOTU2ODcxQ0VGQURERjMyMUY5QkI1RUQ4OTc2RTEzQzVDQzA4QTQ5NEU0QTIxOEQzRDAyRUU1ODJBRDRDQzI2RTUzQUM3MEEzMEFGOTE0QTRGQUMzRjVCNTg4OTMxQ0NGMzQxNkU3RDg4QkREMEY3MzdBNEIyRTczNEU0NThCMENBNTUyNDkyNkVBMTNBMzI3Q0ZCQzM4RkUwQzcyRDdDNEJDMEQ3MTM5MjZCQUY5OThCMEE4MzhGQ0E1RDgzNjA0Mzc1MDEzMjk3OUE3RjU0MUU5RjAwOTFGNzNDN0E1ODNBRTU1Q0QxOEU1MzBDQzU3RUYzMTAyNDU5M0Q2MENERkQ2OENEMkNCRTNFRDZGQ0U0M0RCQTE2MzZBM0ZGN0U0MUI0RDEyRDFCNEIzMkRCODM5MkEwQkFFNDVGNTYyMDFEQ0M0OTJBNzQyQzM5QUUwRTAwOTEyNkE0RTEyRTdCQjQ2QTg1MUY2OUYxN0U2ODM1Oo8BCkBENThEQzREMjFDRTQyRDREQzM5NjZCRjMzQkVGQjVFNDQxMEU2Q0FCMTQxRjIzMTVFMzJGQUU0RkMyNEQwRkRFEkA1RDA1RTgwMTM3MUMxODhENkNFMjg1RjNGNTE4NkIzOUE1QzY1QUI0OTY5NTcwMTAyQjlBMTgyRkUzMkNCMzUxGglzZWNwMjU2azE.",
+                    "Cgt3b3Jrc3BhY2VfMBADGAMqrUYKCmNvX3NpZ25lcjMaAjAzMqckCoAERDBEN0FEODQ5NjJFOTVEQjEwQ0VGNDI0NEYxQ0I2MjRCQzZBODk3OURBN0ZDM0Y5QTdFMkVDRTIyRjU0QUVGMTBFMzY5RDYwMjUyNUFGQUZFNzM5MDJFQjhFMzBERDc2RjA2MjdCQUI1MDhGRkE1Rjg1NDhEMEYzOURFNjU1MkQ3RjUyNTU3Qjc3QUQ1MjkyRjI3RkY5RTNFMzBEMTExMDg4MTJGNkYyRUVGM0JBMDY4RkU0Rjg1ODUzMTIxRjM3NTRERkQ3ODNDNkVDM0YyM0QzOThCNTgyQ0I5NkQyQ0ZBOEYzRTMyMUE4ODgyRDVGOTlFRjMyQ0U4RENEQjI0RkE2M0E2M0Y2MTY3NkI0RTA2QzdBMTBCNkUxQUIyNzhDRDRBMTc5OURFRTBDOTJDQ0QxNjI3NEM1MDZFMUMzMTM4MUFGNjAyOUZGOTBCMkI2M0EzNDY4ODFDREZGMEE1Q0YwRDNFMzhEM0E2QzczQkUzQzY5MkM4RkE2N0VBMzQxODJERTRBRUE3MkRENDI3ODc4RDkwMkFGQ0IxNEJDMjBCQzBBRkE4MzYwRTY4OUFCQzc5QzBDNEM2NkZDOTU2RUFBMEYxMUNFOTBERjZGNTA3QzlCREREQzg0Qzg3ODZDMzk4MjgwQjJGMjFFQTA1ODFCMkU3RTA2MTk3QzE3MzESgAREMEQ3QUQ4NDk2MkU5NURCMTBDRUY0MjQ0RjFDQjYyNEJDNkE4OTc5REE3RkMzRjlBN0UyRUNFMjJGNTRBRUYxMEUzNjlENjAyNTI1QUZBRkU3MzkwMkVCOEUzMERENzZGMDYyN0JBQjUwOEZGQTVGODU0OEQwRjM5REU2NTUyRDdGNTI1NTdCNzdBRDUyOTJGMjdGRjlFM0UzMEQxMTEwODgxMkY2RjJFRUYzQkEwNjhGRTRGODU4NTMxMjFGMzc1NERGRDc4M0M2RUMzRjIzRDM5OEI1ODJDQjk2RDJDRkE4RjNFMzIxQTg4ODJENUY5OUVGMzJDRThEQ0RCMjRERDdCMDEwNTYwQjhGREVFMDdEMTkwMzNCQjU3NjhFNzIwMDYyNTMzNkIyMkVDNTQzMTQwMDI1RDg0N0Q4QzUxMUJCN0E5QUI2QzUwNDcxN0Q5QURGRTA5ODNBOEQ1OUQxN0U2MzBENTQzQjk5NzQxRTI1NTI4MkZDNkU4RDUxOEQ0ODIzRkE1M0Y1Qzg4RjlBODU5REVFNjBGRUZCNTQwQUVCQTcyM0E2NjFGQjY5MzYxMjREQzREOUQ0NTYwM0Q4Qzk1NDNBMDE1Mjk4RDYyMUY1RTkxRTQwMDBDNTUzMEFDNzU4MjU5M0M5ODlBNDgwMkYzQTM5RkU0MUJENEYyNBqABEE1NkE5MTgwMDdFQTVCNUFCN0Q2QjdEQ0NCODVGRkY0NEE0RjJFNDQzMUU2Q0QwQkQ4Q0EwMEIxRkJFNkJGMDVERDBCNENFRkQxRjJDNDJBNzhGRERGRDdFNUM5RDI0NDZDN0IzMzNGMEJCOTc4RjUxMUFDQTIwOTgxRkQ5MjVCRUM3RkIzOEVBMkNCOTkyNERBNTlCRTRCQzMzQTJFQkU0MkI1MUNCQ0M0Mjg2MDg2QUM2NUM4MTYxN0M3MjZGRDQ0RDg3MkY0RDQwMURFNUEzQTA2RkEzRjkzNkNDMTkwOTczMDlFMzkwODU4NDczN0RDRDk0QjFBQTMzNTgzOTVDNjlDMjJEODZGNTlCRUVERUE5ODgxNEU5MUUyRkJDNkM2Mjk5QUMwRTVDRDU3MjFGNEYwMkE0NDIwQkMyODJCRDdFQjBENTE5NTQyRkMwNTJGMkNEQkNEQTZEODVGN0U2OUNEMkJDOUQ3QUYzQkJDODlGQ0MyQUVBRkM3M0MzMTRGNzY0Rjc0MDFGQUZBNTZCNTJEM0ZCM0MzQUMzOTE5QjU4RUQyNDEyQTJDQUE0NjZFMDAzRTI3RDAxQkNEMTQzQTEwNkM0RjNDNTk1MDM3RUJEOTdEMTAyOTVCMTRBRkU0N0E4NzYyNjVFOEYyQzI4NDRDNjkzRUFBQURCQjRFIoACRUJGQkI4MEIzM0RCNTU2QjkwMTQyNTY3QTkwRkZDQTVGOEE0RkE2OTkyREJCN0YwRkNBMUM3RTM3MDAzQUEwQjcwNTI0ODFCQ0E3Rjg2RkMyNzZDMEQyRDQwNUJERTlDNEM4QjRCMTQ2OTE1MkEyODFDNDdDRjk3ODY3MDUyMzNBRkI0M0I4MTk3ODkyQkQ2MDdBMUU0RkUzOUU3MEY5MjM5MkFGQzEyNTc1RkMxMzBGNzg3MDU0NzAyRTYxOEI5QTUxMTZBMzYwRUUyRkY2NkEyMkREQjAwRTE4OTZCNjI0NUVGOEY1NEE3NEU4RDY1NzkwNTMyRTY4QTFDNTBGNyqAAkUyOEU5Qjk0RDcwQjgwOTQ1RjRDRTgxMzgzMjQ5Qzc0REI5QTJCRkRBOTAyMTU5OEMwQzA4NzA5NEYwNTUzRjY1NUUyN0Q1NzcwMENCQTNDNzdFODdBQkM1MzE1RDFFRjI1RTU4QjI0OTVCREQ1NzdGQUNFRDlGQkIxODBGRjgwOEIwNjE1MTRFNThCODcwN0VCOTkyRjUwOTIzMjU4ODM5NzM4REFDQUE3OEI1RjQ0QkRDNzQyMkI4RkMwNzhEQzNCQTk2RDk3MkY2Mzk5QzdFNDg0RTQ5QkEyNzlCOUZGMkMzQUNCQ0E4MTQ2NkU3MjcyRUYxMTIxNERBMjc3MTcygAREOTg4MUI2NkZCN0M3OUY1QzU5NjlBN0QxRjFBM0Q2MDE1RkYyOThDMzZEMkJFMzVDRTM4QkE5Mzk1OUI0NzU4MUM2QUM3MjEwOEJCNDc3NzVGOTc3ODczNkYwNjg0MTU0REQyNDcwQjVCRkM4N0Q2OTM2NEM0OEEzQzExMTg1QjkzRkQxMzAwRUNFMUMzNDc0RkUzRDRFMEZCRjEyQkE0REFBMjc3NUYzNkVBQTNCRDUyRDM2QzUzRkJFMzI1NEJCOThCMzI4RTAyODZFMDc0QTU1MTNERkEzQjgyODc5NjI4MzYzODc1RTBBOTcyN0UxQTQ2QTBCODU3QTJBNEQwM0M1NDFGNUE3NDNBOUU3RUFFMjgyREEzQUI5RUE1NjVDODgyQzI4RDQwQkFDOTI2ODlFODNDMDFFNzhFQTY0NDhCNzdCQTFFNzA5NTk3NUNFRDUyODcwNDA3MUQ5RjdDQUIwRjI4NEYzOTg0NzBCOTBGNjA3OUQ2OUM2NEJFMjVCMTcyNzAyQjVFMkI3RjI0ODNFRUJGQTE1QTM0QkE2NkMxN0Y2RjAyNDUzMjEwRDczQzQwMEE1MDYzODNGNkQxNUY0QUU1RjMwQjE1OTczRUYwRkE2NDFCQTZCRTA4NTJENjRBMzc0MEI5QkIwMDFBMkNBQTgyNDAxQkEzNEU1MTqABEM4ODAxQTIzQzM1QzcyQjlFNDgyMkM4NkMwOEUyQkYxRDE5OTA2QkU1QTU3MzU0QzQwRDg5N0I4OTJDNjgzRjUzOTI4RjdFNjY1RTdCMUNDMzIwM0VDOTUyREQ0NzAwMzREMDI2QzdCQ0NBRkVGRTk0MzYxNzNDMjBGMEI2QkY1QTAxMDM3RkExNTUxOTY1RkU3RkNGOEQxQjAzMUMwOEVBRTU3MEVGMTVENkQ2MTQwQjQzNTAwM0Y5QjE5RTE4Qzk4MjBDQjZBOTMzMzFEMTIyRjVFMTM0REQ2QjQzQjlDOTVBNTI5MjkyRUNBMTBDQzY3REE5QjY4MUYwNUQ0N0FBRTdBQkFENUFDNkVEQjM4Q0QzNEU1REY4ODhDMkNGMTMyOUE4QzZFOUZGOTM4OUEwN0FDMTRBRjNENDg1NDM1MjNGMDkwQUNGRjQwMDAwMkUyN0IzNjBCMzY1MjY2QUZCMDA2REFDMTNGNzkxREI0MjE4N0REOTBCQTI1QUUxMkI5RTRBMkU0MjcxMjExRjlCOUJCQ0RFOUVBNjMyMTdFRTgyOEI3NzBBQ0ZDNjlCMEVCNzc0RTAxNEJBMEFENzg4NEZDNzdBNkExNjI2NEVENjA0RTkyODBEM0QxQjVGRUZENjA0NjBEQjgxNkVDOEI4ODMwRTRBQ0M2ODI2NDExQoACRUJGQkI4MEIzM0RCNTU2QjkwMTQyNTY3QTkwRkZDQTVGOEE0RkE2OTkyREJCN0YwRkNBMUM3RTM3MDAzQUEwQjcwNTI0ODFCQ0E3Rjg2RkMyNzZDMEQyRDQwNUJERTlDNEM4QjRCMTQ2OTE1MkEyODFDNDdDRjk3ODY3MDUyMzNBRkI0M0I4MTk3ODkyQkQ2MDdBMUU0RkUzOUU3MEY5MjM5MkFGQzEyNTc1RkMxMzBGNzg3MDU0NzAyRTYxOEI5QTUxMTZBMzYwRUUyRkY2NkEyMkREQjAwRTE4OTZCNjI0NUVGOEY1NEE3NEU4RDY1NzkwNTMyRTY4QTFDNTBGNkqAAkUyOEU5Qjk0RDcwQjgwOTQ1RjRDRTgxMzgzMjQ5Qzc0REI5QTJCRkRBOTAyMTU5OEMwQzA4NzA5NEYwNTUzRjY1NUUyN0Q1NzcwMENCQTNDNzdFODdBQkM1MzE1RDFFRjI1RTU4QjI0OTVCREQ1NzdGQUNFRDlGQkIxODBGRjgwOEIwNjE1MTRFNThCODcwN0VCOTkyRjUwOTIzMjU4ODM5NzM4REFDQUE3OEI1RjQ0QkRDNzQyMkI4RkMwNzhEQzNCQTk2RDk3MkY2Mzk5QzdFNDg0RTQ5QkEyNzlCOUZGMkMzQUNCQ0E4MTQ2NkU3MjcyRUYxMTIxNERBMjc3MTZSgAIyMTdCQUQzRDBCMTdGNTZCOTM5NDUyREQwMDNDQjYyN0FFRUVCOTE5QTM0RkU1NjlEOTU0MTUyREQ1MzQ5NDY3MjYxRjgyRkZENjRCN0NBRUY4MEZGNjEwRDNDMjNENjg2MjUzMEQ5RDUzQzg2NTU5N0E0RDU1QzgxNEZFOTJGMzM2MjcwQTQwRThDMzIxNTIwMzY2NUMyQkY1QURBRjkzNDRBMUE3NDY1MEYzNzkzOTA1ODc5RDMzQzYwNjZGMUI4NUYzMjFGRDZEMDdGNjg2MUIzMkQ4N0NFNTk3NzI0QTM4NjNERTRCMDY4Q0M2QzhGRUJERkI1RDI4NDNDM0FGWoACQzI2OTUyNUFCRTkyQUEyRjUyM0I3RTJEMDQwNUEzREE1MTRCNTNBOUJEQ0YxRDNGOTZENDVFOUNENDhERjdGNkFFQUIzODk2M0VGODBFMEE2OTk3QjdGNkYwMEQzM0Y2MDcyREFFNjM2ODc5QUYyRjgwMUVCOUM2M0NGQzRCODcxNjZGOTBFRTBBRTkxQkREMTEyMjExNjM3Q0IyNzc5OUNGRjJCMzk5REFCNzQ4RTNCMDhGNEQ1NURFNUFBREJCNjEwNkJDODI2Qzg4QjhCMkYyMENBQjBGQzBGMTlGMUEwMkY1OTY2N0ExNEUwOEM2REUyRjEzQ0RFNEVDNEI4MWKAAkNBODAwQUNFMjhDMzVGRkZGQzdGRDI4QUE4RDM0NjdFNDlCNjQxNEZFRjhCRDI4NzIzNERCMkI1OUFDRjE1QTQ0QTMyQzUxQkY0MzQwQTREMkY1QzE3MUM2Qzk5QTEzM0VBMzgzRDc3MTU0Q0M0Q0VBMUZBNzlDRjcxNzFCRjQwNzk4RDMxNDBBRUM2MEE4NDA0M0I4OEQyNDQzOTVGRkVGNDg5NTRDQzA2NkM0N0Y3RjFGRjY4MTMzQ0RGQTk5RTFGMUU0ODM4QTFEQjA4RTA4NkZCMDI4M0ZCRjFGOTE4MEQ4QkIxMDlBMEMxQzY5QzdBNDczNzg5NjFEODhENDhqgAIyMDI1NDkzQTE4NzhENjY1MEQxMTY5RTY3RjFFRjg5QThBNEVEODUzRUIzMkY4NTkyOUVDMjg2QzdBNzc1QkZGQTczNzQ0QzEzMTE0QUMzMjBFNTBDMkM1NjMwODlERjkxRUI3RENDMTJENDQyNjQ4N0FCMDIwMzU3NDg0QjNGOTc0OTY4NDI2REFBMjZCMkFEQTc3MURFRDE1N0ZFMEU5Qzc0NjI3MzBDQ0Q0MTY2MTBEMzdGNEQ1QjE2NUNCMjBEQUEyQjExNEMyREFFMTE0RjI3ODM5OEJFMTg4MUFFNTI5NDUzNTYyREZGODY1QUI5NEJGRkQ1MzY4QjYyQjk2OoYICoAERDBEN0FEODQ5NjJFOTVEQjEwQ0VGNDI0NEYxQ0I2MjRCQzZBODk3OURBN0ZDM0Y5QTdFMkVDRTIyRjU0QUVGMTBFMzY5RDYwMjUyNUFGQUZFNzM5MDJFQjhFMzBERDc2RjA2MjdCQUI1MDhGRkE1Rjg1NDhEMEYzOURFNjU1MkQ3RjUyNTU3Qjc3QUQ1MjkyRjI3RkY5RTNFMzBEMTExMDg4MTJGNkYyRUVGM0JBMDY4RkU0Rjg1ODUzMTIxRjM3NTRERkQ3ODNDNkVDM0YyM0QzOThCNTgyQ0I5NkQyQ0ZBOEYzRTMyMUE4ODgyRDVGOTlFRjMyQ0U4RENEQjI0RkE2M0E2M0Y2MTY3NkI0RTA2QzdBMTBCNkUxQUIyNzhDRDRBMTc5OURFRTBDOTJDQ0QxNjI3NEM1MDZFMUMzMTM4MUFGNjAyOUZGOTBCMkI2M0EzNDY4ODFDREZGMEE1Q0YwRDNFMzhEM0E2QzczQkUzQzY5MkM4RkE2N0VBMzQxODJERTRBRUE3MkRENDI3ODc4RDkwMkFGQ0IxNEJDMjBCQzBBRkE4MzYwRTY4OUFCQzc5QzBDNEM2NkZDOTU2RUFBMEYxMUNFOTBERjZGNTA3QzlCREREQzg0Qzg3ODZDMzk4MjgwQjJGMjFFQTA1ODFCMkU3RTA2MTk3QzE3MzESgAREMEQ3QUQ4NDk2MkU5NURCMTBDRUY0MjQ0RjFDQjYyNEJDNkE4OTc5REE3RkMzRjlBN0UyRUNFMjJGNTRBRUYxMEUzNjlENjAyNTI1QUZBRkU3MzkwMkVCOEUzMERENzZGMDYyN0JBQjUwOEZGQTVGODU0OEQwRjM5REU2NTUyRDdGNTI1NTdCNzdBRDUyOTJGMjdGRjlFM0UzMEQxMTEwODgxMkY2RjJFRUYzQkEwNjhGRTRGODU4NTMxMjFGMzc1NERGRDc4M0M2RUMzRjIzRDM5OEI1ODJDQjk2RDJDRkE4RjNFMzIxQTg4ODJENUY5OUVGMzJDRThEQ0RCMjRGQTYzQTYzRjYxNjc2QjRFMDZDN0ExMEI2RTFBQjI3OENENEExNzk5REVFMEM5MkNDRDE2Mjc0QzUwNkUxQzMxMzgxQUY2MDI5RkY5MEIyQjYzQTM0Njg4MUNERkYwQTVDRjBEM0UzOEQzQTZDNzNCRTNDNjkyQzhGQTY3RUEzNDE4MkRFNEFFQTcyREQ0Mjc4NzhEOTAyQUZDQjE0QkMyMEJDMEFGQTgzNjBFNjg5QUJDNzlDMEM0QzY2RkM5NTZFQUEwRjExQ0U5MERGNkY1MDdDOUJERERDODRDODc4NkMzOTgyODBCMkYyMUVBMDU4MUIyRTdFMDYxOTdDMTczMkJARjYxQzQzMDc2MEFCODIyM0YyOTIyMjhCMjhEQjk5NzdGOERGMzlDQzg3N0U4M0NGODJFM0RBMUY3MTFBQTY5Q0qPAQpARTlDMUZBRjVGRjkyNDgwRDlGRjU4RTRFOTc4MDUwOTU5RUIzNjdBRDc4RkNFOEE2QjQzQUNCODcyRTIxNDEzRhJAOUY1RTVBNTZCM0REMTU2QjQ2QUNFNzQ3NEExQzY5QkVBMjNFRUIzNkM5MzZCMjg5MjAwQzJGQzM1QzVERDhDNRoJc2VjcDI1NmsxUoAEREE4NTAyMzAxQjk5ODVBMUJFNEFFNkQyNTlFRDM1NjJFRDE0NjI2RkJEMjQ3MTNBQzlEQzU4MkE3NkQ1ODUzMkY2QkJBMUVGRDA0OTA5RkQ0RDM1MzQ3MzA0RkFDNzcxNTYxOTQ2MEZFQjI2NDQ1MTYwMjI1NzFDOEYzNDA4RjNGRjI1RUFGNzg2QjkwOTY3RTgyQ0I0MTdCM0RBNEM3N0RBRThEMEJFQkVCNTdGMDUxMkFFMDZCMUYzMENENzRBNTYwMDVBOUNDRkU0NjIwNTgwMTc3NTM2MTNERjhEOENCNkZGODkyMzY3MTk3RTI1NkQ5ODQwREE5RTQzOUZCQThDMzEyMzQwRkNDMjg1QkEwMEQ3QTlGQ0M5MzA5MEZCRjlENzE4MTY5QzNCNjE0NEMxMjNCN0Q5QkNBQTU4ODI4M0I3NDUwQTkyRkY4MDFFQ0U2RUUwMEYyN0I0MjQ1QjE5NDRERjg5QjNDM0IyNkYzRkMzNjQxMTlDRTE3MEE3NUFGODA4MzgzNTk4RDFCQzhFNTIzNTkwQ0JFMTVGN0FGMDFFNkJFRTgzOTMwRkYzMDEzMDEzOEE4NzZDNURGODI2MURBNjg5MUYwN0ZENzQxNjYzMEQ1RDlGOEU4REIyNTc0RUJGRkRBRjk5QTIyRDU3QzgzQzIwNkU2NDYzQkRagAI3RjNFRjNBNTI0RTEwNjFDNUNEMEFDRDZEMTczODJBQzY5OTA4MjUwMkMzMEI5OERFOTg0MzZENTY0Q0E4RTMxQjNCOURBQkMwMTIxMkMxMTY4OEVCNDQ1NzA4MzQxMkVBNTg5QkY1NjJEN0EzMTZFODVFNEJFQ0YyOTIyRTVGODU1MzAwNUQ2RDU1NEZFNDFDOUUxN0JFNjUyMzE3RjU3RjNBRUE1REI2MDU1NDIyMzQwMDQyN0YwNTExQUZGQ0YwNUQ2OUIwNzEwQjY0OTJDRkIwMUY1Mzk5Mzk2NTdFQkUxM0M3M0IyN0NBREU3MEZCOTYyOTA2MTc5OUFDRDQ1YoACNkRFODQzRUEzRUQzMzEwQ0NBMEU2NTQ4MjQ2RjIwQTJBMzFBQ0MyMzFBNTgxRDA4NzRFQUVENDc5M0U2ODBEQkYzNjdGRkNBRDcwNTQyOUIzNTk3RUZERDA2MDlERjA1ODg5Njc5MUYwMzk0MzgwNzlCNkRGRUVDRTg1MDFFRTVFOUZFMkY1NTg2NjAzNTNEMjZGMjUyMjY3QTFEOEM5Q0IwNEUzQTcyMDExRTkxNjIyNzExMjI3Mjc3MzY3NDVBQzVDOTMwMTRCNzAzQjI4QzUxQkQzMDE1RjRENUQwNjVEN0JBNjFFNjM5RDE4N0NCNzQ1QkZDQzRBODYzNzVFQmqABDQyODQxNTc2MDdBQjcyQUM0MzAwOURFM0Y0ODZENUIwNTcxMzMwRDRFOTg5Njk1RjUzNzQ4MTg4ODA4RkMwRUFENzJEMkU4MzU2NTY1QzdCMUY0QzQ0QTY3RTc5MTYxMDlEODQ5NzI3NTY0QzkxNjk4NjkxOEVBQkU2MEM5MDRBMUE0MjE5MjRDNEIyOURGNDg2MDEyQ0RBNTA2ODMzQjkwNEIxNERDN0IyOEYyMzAzMTBFMjhEMkI0RDk4QzNDNDRGRkFGMEVDNTk5QTBFOTYzRTAzQUNEMjMxNjM1QjA0Mzg2N0M2NkIxNjZCNzlCQTkwOTQyQjg3OTY2NkYyNzZEMTg2OUMwNzc4RTc3NDk3QzQ2MTI0MDIwRUNGMDBFM0UyNEUzNjdBNEZDOTgxQzUxRENEOTU1MjA3Njg2MEUxRjg0N0VGQzIxMTczNDNCQTE5NjEzMDcxRkJGRDk5QkZDRjYyQkE4OTJBRjM1QzkwMTVDMzlDQkVDQ0I0NkI5Q0JEQzU4MjY4QjczNjBFRkU1RDYwRkEzOTBDMzIxNTgzRUYwOUQ2NjE2ODQ4ODIzMkM4MEY5N0NFNzlCMEUxNUZDRjU1MDBDNjM1MUM2QzU5QTZCMkIxOTRERjdGODlBMUFFRTNBNUEwQzZDMDRDMTlFQzI2RTQyMjQzRjU2OTBDcoAEODgwNDU3OEI2NEFBNDYzNDk0QTY2RkZFRjE3OTZFRTM1MkRBRDQ4MDBCRkREQzMzQzc1NkIzMjg5N0E4OTcwMUI3QTk2REJGOTFBQThDRDExRDQzODg4MUM2NTMzNTlBMzMxQTJBNzBEMEExQjAzNEEwNEM4MDcxQjZBQkQ1OEI1QzEzNDlFRjI2M0JCMjI5NTY4NzFDRUZBRERGMzIxRjlCQjVFRDg5NzZFMTNDNUNDMDhBNDk0RTRBMjE4RDNEMDJFRTU4MkFENENDMjZFNTNBQzcwQTMwQUY5MTRBNEZBQzNGNUI1ODg5MzFDQ0YzNDE2RTdEODhCREQwRjczN0E0QjJFNzM0RTQ1OEIwQ0E1NTI0OTI2RUExM0EzMjdDRkJDMzhGRTBDNzJEN0M0QkMwRDcxMzkyNkJBRjk5OEIwQTgzOEZDQTVEODM2MDQzNzUwMTMyOTc5QTdGNTQxRTlGMDA5MUY3M0M3QTU4M0FFNTVDRDE4RTUzMENDNTdFRjMxMDI0NTkzRDYwQ0RGRDY4Q0QyQ0JFM0VENkZDRTQzREJBMTYzNkEzRkY3RTQxQjREMTJEMUI0QjMyREI4MzkyQTBCQUU0NUY1NjIwMURDQzQ5MkE3NDJDMzlBRTBFMDA5MTI2QTRFMTJFN0JCNDZBODUxRjY5RjE3RTY4MzV6gAQwOEMwMzNEMEJENTBFQzczMzU3Rjc2RUMxRDg3OTIwMTUyMjhDOTAwQ0RGOTk0QTIyODU0OTVFMDlGRTg5NDU4MjI1MERGQTg4OTgwMTEyQThGMTQ3Q0Y1Q0Y2RDMzQTYzNUI5QjEwNjg1QUY0OUU4MEM0MUY3NzU1NUY1NkMyMTg3RUVFQTNEN0Q5RTI2NzAwMUJGRkNBRjhCOUU0MTc4ODk1QzkzNDU0Q0MyNzYwNTZCREMyQkYyQTFDRDZFMDE3MEI4NUYwOURCMjU0RDE1MjMwRTFCOTZDMUJFOTMyNDg3OEQ5NTJBNDMxN0VENUQ0MjU4ODZDODJDRkMwQkJGQzk0MjNFOTUyMjc2NUQ1MzVBNkM0OEQ5RTE0REJEMjZDOURFQ0M4MjRDQUFGQ0M3OEY0MkZFRjY4RjU2MEMzNEVGRUM2OTBCMEVCRDIwNDkzMDYwODBEQTgxNkJFOTE3NkI2MERBMjgwRjZBM0RFMDdBMzk5NjBCOEJGOUJBNjI1RTJBQ0RBNzVFRDQ2QjZFNzZDMEUxNkNCRTlFOTU3NzI4QzJFNzVGRTQxRjQxMzlENTJFNDAxRTIwQjhBRjY2RjE4QTNFOUYyRkFBNTAwNzJCNjFERDQyNzA0NDZDOTIwNjI0MzQ5MDY1NTg2MzQ0N0M3NTRGRjU4N0FDQUVCRYIBgAQxRkNCQjJCODdEQkFCQUJEQTI2QUVGMDY0NUYxQjFFQzY1MEY2NDE1MkM1NTNGRTczQjdGQzhEMDQ0Mjc4Qjg5Rjc4MkY5MTQ4NUQ3QzgxMDM2RTdEOTdCMjExQjhGMzdDRDY4NzZDNDg2MjNCRjk2QjM1MTk1RjUwRDlBRUMyRTQ0NjI1RjExMzMxMTdGNDBDMzdGNTUyNjlDMjdDODg3OThBNUY0Q0VBQkI2NkU0NjUwQjc4ODRDODY5QjM0NjlCRTE3NzlFMDZFQkU5OUM5MUJFMDdENkEyNjhGQzk4OUQ2QjUzRjNCMjExNDk2OEFDQzE2ODhGOEUwREY2Qzg5NTc2REJDNkMzOEI3NjcyOTZENjlCMDU1QjBFMjEwRDdDQzgxQzBBNzNDQTVGNzVDREJCNUU3NUNFNUVCRDkyNTM1Q0M3NEUyOTE3MjM0QkI0NDVDQzdCOEIyMzE3MThCQzU3QUExNjgzNjlCNjM3MjRCREQxNkE3OUI3OEJFRTE5RDhCRkY2NDFFNzY3MzA2OEFCNEMxQzI4NERGMzE3QjA3OTZFODI1MDVBNTUxRUUyQjVFNTFFNDEyQzA5MUUwNzY0OUQ5ODlBMUU1OTFFNDAzNTJFMDJBRTUxRTU0QzI5RTJCQ0Q3QzcyMzEzRkUzOTdDQjlDN0MzRjE0NUJCMTK0FQoKY29fc2lnbmVyMRoCMDE6hggKgARDNTRFMTdBMkI3ODI1RDRBQzM3MDQxREEyQ0YzN0JEQTMxMDcwNjZCMkQ0OUFDQUNCRkZEQ0E1NjQ1QzRBQjc3QjhDNUY3MTE1RjlEMkREQzhEQzcyNjY2QkI2MTM2QkQzOTE1OUM5QjkyQzEwNkQ2ODA1MDkxMzgxOTk5QjlFOURERDM2MzFDMDBEQTgyRDE4Qzk4RTBDQTYwNkYwRTNCQkE2M0QxMjBEODYyM0I5OTExMEVBMzA5OERGNkI2ODJBMThFNkY4QTNGNjVFQUNCNTE3RUZFNTlBMEIxMzczMjEzMzRBQzEzRjdDNEIyRjEwQTY3RUU4M0MwODJGODk4MDA1RDFEN0JCQUZCOEFGNDRDNzJEQ0EwRTIyRjhFMzE0NjE4NTBCRDQ0NjEzRTQxNEZCMUQwRUI2NkEwMTdBNDFBQ0M2NURDMTUyMTUwREFCMTI5MzFEMTVGQ0U0NDRBMkYyNzY1MjFCQkYyMjVDMjhGQzkwNkJFNUIxOTI3MzZBNTY1NEY1MTIyQUY1NUY2N0I0RjY3N0IwNDFBM0ZEMUE1OTE2MEE3NTVBODE2RkFGNEVCOTcxMjYxOTI2NjFFMjIyREYxRTQ4MjZDMDMzODIyRjQ0RkI5QkZCMzE0QzI5Qzc1NUYwRUY4QTVFQTlCQzhERDlBRjU5NzdGNTQ5ORKABEM1NEUxN0EyQjc4MjVENEFDMzcwNDFEQTJDRjM3QkRBMzEwNzA2NkIyRDQ5QUNBQ0JGRkRDQTU2NDVDNEFCNzdCOEM1RjcxMTVGOUQyRERDOERDNzI2NjZCQjYxMzZCRDM5MTU5QzlCOTJDMTA2RDY4MDUwOTEzODE5OTlCOUU5REREMzYzMUMwMERBODJEMThDOThFMENBNjA2RjBFM0JCQTYzRDEyMEQ4NjIzQjk5MTEwRUEzMDk4REY2QjY4MkExOEU2RjhBM0Y2NUVBQ0I1MTdFRkU1OUEwQjEzNzMyMTMzNEFDMTNGN0M0QjJGMTBBNjdFRTgzQzA4MkY4OTgwMDVEMUQ3QkJBRkI4QUY0NEM3MkRDQTBFMjJGOEUzMTQ2MTg1MEJENDQ2MTNFNDE0RkIxRDBFQjY2QTAxN0E0MUFDQzY1REMxNTIxNTBEQUIxMjkzMUQxNUZDRTQ0NEEyRjI3NjUyMUJCRjIyNUMyOEZDOTA2QkU1QjE5MjczNkE1NjU0RjUxMjJBRjU1RjY3QjRGNjc3QjA0MUEzRkQxQTU5MTYwQTc1NUE4MTZGQUY0RUI5NzEyNjE5MjY2MUUyMjJERjFFNDgyNkMwMzM4MjJGNDRGQjlCRkIzMTRDMjlDNzU1RjBFRjhBNUVBOUJDOEREOUFGNTk3N0Y1NDlBSo8BCkA2QThCNjA5QTdEMDJCQjhFOEU3MTY0Q0EyRDI0MDFBRkYwRDdBNkM1N0Q5ODM5OTMzNTNDMTNFMkY0MDI1NTQwEkBCMUZCMUU5QzlCMEZENjA2MEIzODA5Q0FFOERDMTg4QzlBNURDQjZGMjk0RkFENkMwRTk0Q0Q1QzlEODFDQzgwGglzZWNwMjU2azFSgARDQTJFOEJCNjEzQUQ0NjIzOThBQzA0RTRDQkJFQUUwNjE3NThFNkMxOTMwOTQ1NUJCNzBDNUI4QzcxQjk4QTBGMTlEQThERDNDMTdBNkQ2MThGRTJFODVFQUFEMzIyNkYzQTAyOUIzQjVEOEM3NTU5NEQ5RjEzOTA2M0ZEODUyNjY0OERGNUEzNUNFOTI1MDg4NTI3RDg4NTVGREFGN0NFRjU4RUZDMThEQURDNjFDNTQwMzA3M0E3OTAzNjczRTUzRkZGM0Q1RjhCRkRDNUE1MTBFRkQ3QUZBQkJGRjM2M0ZFMDRGNzlDMEJCRkZBNkEwRjcxNjc4OEIwMDk3Rjk1REUwMDMyMEE4RDFEMjA0NThERDVDRjI4MzVGRTE0OUE3NkI1QTJDNDRCRDI2Q0NDMDRFOTJFRTg1QThGRkJENTNGMTYyODQ4RjhDMjJCNUU1QkIxQ0NFOEQxQTQyOTU3M0VBNjdGOTVCRTdGNUM4QTJFQkRCQjVDRDBDMTU0NkVGQ0Y4QjE1REY0RkQ0Qzc5MUJDRjBEQTg0Q0U0QTkwQjM5RkE3QkQ3Q0FCNjI1QjgyMDFCQjNFMTNCQ0IzMzc2OENDRTIzQ0U1QTRGRDc0OEVGRDQ3MUYwODc3M0RFODEzN0UyNDM2NTM2NUZGQTRGNUQ2QzFFNjNFNkREMUFENWqABDFBNUQ4MThGNTExMTg4Rjc5MDMyODRCNEU3MDAxREE1MTBBRjEyMDFEMjJBNTFCNTA4QzYyODBBRjFBQ0U3OENCNjExMjk2NzRBODAwN0U2RDhGMzUzQTM3REYyRUJCMzk5OTdCNEM3RUEyMDhENTI2Mjk0QURBMEQwRTlCOUQ0QkVEODIzQTRDQjU0NjhEMEJEMDhCNDVEMjFBQjExRTE5RjQ0REU2Njg5QUEyREI5QTI0NUZGRkQ1NTdBNEJGREE5QTAxQ0JEOUFGQTMwNTdGQkZBMEQ0QkQ3MEEwOTQ4OUVCQTEwRkJFMzhGNjZEQzQ0RjZDMzZDMDgyQ0RGRTg3M0ZGMjQxQUYyOTM0QTc0OTdGQ0U3MUNGMzg5MzA4NjgwQzI1MjY5QjNBODMzQzZCODNDOEM3M0QyMDQ4REM5MUQ2RkFGMzdERjIyQzI2OUMwNEE2N0U0OEI1QjA2RTdBRDBDREI0NDU5ODhFRUVFQkNDNDhBMDU2QTI3MTNDMzc1NkQxODE5RUZBMTFGMENCQUY1QkI3QkZBNDlEMjZEODM0NTgwOERDMEU1MDBCQkI3ODZEN0QyODk0QzA1NzcyNzhBQzQ0MkYwNDM1Qjg4QjFGMkU0RkNDMDlDQUZBN0I2MEY5RjVDQUJFOEVCMTgyQkVCQkNBMEY2QjZDRjM3coAEQUMwNTM3MEE5OEMwQTk2RTAxRUYzQTdEODVCMjkzNkEwMEU5Q0M5MzNBMjBENUI2MTM3Q0VBMzRGRUM5MDZBNzJDNUIwQTMyNDZBMkRGOThFNjdGMUQ3OEQzNjg2MzQ0ODU2QjFGMDEzQTZERjU0ODY4NTJFNjcxN0M3MzFCNTlGOTZFMzQyQ0Q5QzYxOUZCOTkzNkEwNURFMTZDNEUyQ0U3ODIwQ0QxNTVGQURBNTExNzIxMjBBNEM2OEYxREE3MEZDM0Y2MEQwRTI4OEUyRENDOUU3MjAyNEZGRUZCNzYzMzUzNjA2RjBGQThGM0U5QUU5NDcyN0QxNUNGM0U2MkU4QTlGOEYyN0Q4NzFGRUI4MzYzNDFCQ0QxM0EzOTM0NEM3QTk0ODA0MEI5MzUyNzZEOUY4NzdFQkQ1QTFDNjBENjAyREExQUY4NThEQTg3RTg3RENBMjgxQTczMkY3MTQyQjJDNzM1MUE2MjExQ0Y0MUVDM0RCRUFERDEzRDc2NjI1MjYwMEU3OERGMEU0M0M4MkM3OTcyRDQ3NTg3RkMwOUVDNjQwNENCRTNCRUM4Q0E2MUIwNzFCOUQyMzE4RkVBRjE5QTdEMDI2RTQwQkU4NTBDRUEwNTk2Q0Q2NEQzRDJCNUE2MjRBOUEyOTI1N0U0NDdEMEJGQkNGMDUxOUYytBUKCmNvX3NpZ25lcjIaAjAyOoYICoAEOTdDQjRCOUUxM0ExMUNCNUJENThBQTYzM0VFMzBCREM2REFDMDA0NDc1RDZDODkxMUUwNTNBODQ4NTYxMjlCNUJEQzNDRjYxRUFDRkEyNjcxRjBEMEYzQjkyMzZDQTY5MTVGRjhBNEVBQzlBQURFQ0U0MjhBQjU0QkRCNTMzQjRCMzZCM0I1OTEwQjg4QjIyRTU0NjVEOTc4QUYxNkRGOUNDQzYyMjkwNTA0RTJEODM1MzA3M0U3NUE1ODlBRjIxMUQxRDZBN0UwM0I5OTFCQzk3ODA0MkVFMEZBQzE5M0YwQjkzMTNBQjY5MDkwQTc5OEY1RTFFMjhDQTE0MTc5Mzk1NkUzRjlBQjZBMzUyQjg2NUM0MzkxNjY3NjFFMDM2QTE0Mzc3MkYwMTU1MDFDQjVGNjhBRDI3M0ZDRTM0RjhEMTREMjEzOTcyNTRFQTQwMkU2M0YxMjcyOEJGRkY5Q0U0MUNBQzY4ODU0QzlBQTQwM0E4QzBENjcwMTY3RjM4OTIxNDFCQkE3OUI2ODFGMjdDNzdBODEwQUQyNkM2QzcyNjU5RDkxNDVEMTk1RjM5NTUxRTUyQjREMEVDQzA5MDQzRDk5MjVBQjZBRkZBNDIxMTk3NDVFMDVGODQ1RjJCOEY5QkI1Qjc3QUZCQjY0QkQ0NUYzOUY2Q0I5RUJDRjUSgAQ5N0NCNEI5RTEzQTExQ0I1QkQ1OEFBNjMzRUUzMEJEQzZEQUMwMDQ0NzVENkM4OTExRTA1M0E4NDg1NjEyOUI1QkRDM0NGNjFFQUNGQTI2NzFGMEQwRjNCOTIzNkNBNjkxNUZGOEE0RUFDOUFBREVDRTQyOEFCNTRCREI1MzNCNEIzNkIzQjU5MTBCODhCMjJFNTQ2NUQ5NzhBRjE2REY5Q0NDNjIyOTA1MDRFMkQ4MzUzMDczRTc1QTU4OUFGMjExRDFENkE3RTAzQjk5MUJDOTc4MDQyRUUwRkFDMTkzRjBCOTMxM0FCNjkwOTBBNzk4RjVFMUUyOENBMTQxNzkzOTU2RTNGOUFCNkEzNTJCODY1QzQzOTE2Njc2MUUwMzZBMTQzNzcyRjAxNTUwMUNCNUY2OEFEMjczRkNFMzRGOEQxNEQyMTM5NzI1NEVBNDAyRTYzRjEyNzI4QkZGRjlDRTQxQ0FDNjg4NTRDOUFBNDAzQThDMEQ2NzAxNjdGMzg5MjE0MUJCQTc5QjY4MUYyN0M3N0E4MTBBRDI2QzZDNzI2NTlEOTE0NUQxOTVGMzk1NTFFNTJCNEQwRUNDMDkwNDNEOTkyNUFCNkFGRkE0MjExOTc0NUUwNUY4NDVGMkI4RjlCQjVCNzdBRkJCNjRCRDQ1RjM5RjZDQjlFQkNGNkqPAQpAQTg0MzFGNTExOEFFMEQ0OENFQkY1REJDMkQxMzY1NjA4RjQ3RUJDQjBBOEZFQ0Y1N0YyM0YwN0QxRkE5QUY5QxJAQ0JCMjM1NkE5MUFCNDRCNzlGRjE4MUM0MkEyOEY5RTUzMENDQjE1RUQyRUY4QjRFRDgxNDk3QjlCQkI4QUJCQRoJc2VjcDI1NmsxUoAEOTExRDRGMDlGNUNBNEZEQTEyRDI2QjZBQUY4Rjg1RjRCQTdERTlFRTVDRUQ2RUMyMDNGQ0RBM0U0ODI2RjJFN0RFRkY5MUZDRjc0OTUzMkZFNjJCRkU3RTI3MjkxNjFBRTM1QjBERTAxRjgwNUZCOTFERUE2NTc5QTc0MUZDOTlDQzRFRjQ1RUJEOTNFMjM0MjFDRUI2MzlDMEM4QjM2QzU1MThDQUI3MzI2NEIyRDkxRUZFNTNGMUUzNkRFNjA2RDEyNzlDNDI4NzM3QkQ2RDhDQTFBOUE2OTI1NEIzMEE2ODAwMDYwMzk0NTYzODdCQTYwRTExMjBDOUVDM0YwRjlBNzVEMzg0ODc3NzkzQTZCMjJFMzg5QjM5MjhEM0FBMTBBQTNENTExMzE0Q0Q4QjMzQjMxNDgzREFCQjdFRDYwQTZFNzA0NkE2NzU0NEVCQjFFMjE5MjY3NjM1QkI2NENCREJCNzU1NDA0MDQ5QkM0QkRBN0EyQ0I3OEYwQ0RDQzExNjFFMEY2ODY0OTE5Qjc1MDBBRDM4QjFGQTI2MTc0REQ4MkQxRDExRjU5MUI3NjY4NzYzNEMxNzJFOEVGQkRENkNGRUMwODVDNjZEQTk3OTYyNTZCMDNEQzhDMEI2Q0IyNzJGMTk2NzRCMzQwMjU1NTBBQjIwQTcyNUU2ODVqgAQzOUJDQjAyQTE0M0RDODk5QkEwRERFRjVENTQyMDM1MzUxNDExMEQ1RURDNzE1NTUyOERDQjhBRjgxOTIzRTQyQTdDNUE0MTA4NEY5NDE3MERFMTI1NDZDOUFDMzA2N0JCQjQ1QTRENjVBRUM1MEJDMjM4QjQ3MTI5RERCQzI0MTNFOTdCN0MzM0ZBNzg3NDZBQUVENTZDNkNDMjQ1ODcyN0YwQjVDNDZEOUNCQzY2QTIyQTgwNzIyOEExQ0JDOTJDRUY1MENENTQwNDVEMUY4RDM3RkM0RTY5RDcxRkMwNTlCQ0JCOEMwRDBDQTY5MjkxRjI1N0U3RUE2NjE0MzFCQzc5MjlGNUI5MDRDOUJEMzYzRkNFNEEzQTMxOUM3NjcyMkZERjcwNzU4QjZEMDA4Qjg5MTczNTZENTQ4RDgxQzI3MzdBQUU2NUM4NUQ4QjQzRkQwRDY2M0IxQTIyRDIxN0QyM0M4QjM5OUY4QTM0OTUxNUU3RUQwNzA5RDVCNEE2MDZGRkZFRkVDRUYxRkY3MzU2RjM1Rjk4OTc2MkVGQzk2OTE1NkJCQUYyNTBDNzM5RDY3NzYyRTQ0MThGNzNEODlFRTBFNjQ2M0MxOTY3NjI0MDkwRjM4MkZCOERDMkY0QkIzMThCQTBFRURDMjBDOTFGRTIxMDNEMDJGQ0MyNXKABDU5OTIwRjdEQzJDNUY1QThGNDJGODJGNkRDQUU5MTQ5MUI0RDc5RTcyQTlDRkVGMTE3NzlGREM4RjgzNUY5MUI0MTg5Q0MyQjJDRkMyQzhBQjc0NDdGRUY0M0IwRjM2NUI5QUVGNTkyOENBMjc3MEVEMEJFQkUwM0FCRDJBMDU4ODk4NDhENEE3MUYxQkU5M0YwRjRGNUM5MDY0NzU0ODZCNTY0OTQwRDM0RjYzM0E5RTVEQ0VCQkQ3MEQ1RjM0MjE1ODVBQzhENDA4M0UyRTg4MTQyMjg5MzJDQTBGNjU5MDczNTNEMUI0NkJDNjRENzU1M0YxQjg0RkJERTFBNzhEODg5Q0IxOTlDRjhGRTRGOEM1NTIyNDQ4RkMyRjM4M0ZDNUE3RTBEM0FCODEyOTg1OUQ3NEVFNTJCQjc5RkM0NTBBNUJCQUMwNEFDMDA3MDZEODE5NzQyQThGQzVCRURGMzNBM0FFMDg0MEVBMjlDNjQ0RTFFNjcxODNCNzA5NjJBMkZCOUM1NTZBRTg5RDBEMEJGNzFFQzVCM0JDNThDRTg4RUVGMzkyNDlFQjMwMzFDQjM3OTRDRjVEMTUwMjBCOTEwNjIzNDQ5NUI1M0M2QkExRkYxNTQ5NDUyRjYxRkFBQzMyM0I5MkI4REEyREE5RDMxN0E4QzI3MkMxM0JBOo8BCkBENThEQzREMjFDRTQyRDREQzM5NjZCRjMzQkVGQjVFNDQxMEU2Q0FCMTQxRjIzMTVFMzJGQUU0RkMyNEQwRkRFEkA1RDA1RTgwMTM3MUMxODhENkNFMjg1RjNGNTE4NkIzOUE1QzY1QUI0OTY5NTcwMTAyQjlBMTgyRkUzMkNCMzUxGglzZWNwMjU2azE."
+            },
+            //P256 sign key
+            {
+                    "Cgt3b3Jrc3BhY2VfMBADGAMqpkYKCmNvX3NpZ25lcjEaAjAxMqckCoAEOUNFRDIxODk4M0Y0RTBFQ0IzNDU5NDI1QjcyRTQwRTNDMjk0NTk4MDQ0Q0JGQjJENDA4MUY1QzE3NjU5NTgxQTU4RjEyNTI1MUI5MTlCRDI4RTM5NDlDNDAwNzg1REY1MUQ0QTI0MDI3NzkwQkFFRURENDJCOUYyMUJGMzExRTE1MkU2QjNCMjg5RDA5NTZEQzM0NzJBNzE5ODAzRjYyRTdFNDcxOTI4MTE3NTU1RTEyQTc0OUQzQjZCRjg1QTczOTNDQjlBNDFGMDFENzgzQTMzMTE4MzUxMEM4MDYzQjJDQTQ5MkQ0RTQzMkE1QTNEOThDQjc2NjU3QTIyREJGRjEwRjRFNTBDNjkwOTBCM0M1MUU3Mzk3M0QwNzgxOUI3NjI0RThFN0FBQkM5RjVGNTY3RTBDNzBEQzVEQThENDM4NUREODhFNDY3QTdFQzU0RjA1NjI0NjZFN0QxMTE0REM0QjIwOTY3NTVBMEY4NzVGOTBCQUEyNkY4QTdBOUU3MEJDNkUwNTYxOTkyNEM3NkI0QTNENzU5MDlGRkFCRUYyMTZCQ0FFQTY3QTMxOEE5QjRCNUU0OTcyMjlCQ0ZBRDA4NzUxNkQ0ODU1Q0IzRTg0QkU0QUM4Q0YyNTI0MDA5NkNBNkQwNkE4NjM4Nzk2QTcwMUY5QzZERDE0MDA0M0QSgAQ5Q0VEMjE4OTgzRjRFMEVDQjM0NTk0MjVCNzJFNDBFM0MyOTQ1OTgwNDRDQkZCMkQ0MDgxRjVDMTc2NTk1ODFBNThGMTI1MjUxQjkxOUJEMjhFMzk0OUM0MDA3ODVERjUxRDRBMjQwMjc3OTBCQUVFREQ0MkI5RjIxQkYzMTFFMTUyRTZCM0IyODlEMDk1NkRDMzQ3MkE3MTk4MDNGNjJFN0U0NzE5MjgxMTc1NTVFMTJBNzQ5RDNCNkJGODVBNzM5M0NCOUE0MUYwMUQ3ODNBMzMxMTgzNTEwQzgwNjNCMkNBNDkyRDRFNDMyQTVBM0Q5OENCNzY2NTdBMjJEQkZEODAwOTNCN0Y2MzAxQ0JBRDQ1MTU1RTI3NkQzNDkwMDQ5QjlDQjY1NUY0MUUyQUNEQzFGNENEQTEyQzM5NzVCOTcyMjg0MThGQjA1MjAxQTk1MzdGMzgyNkM5QzVFMUQwRThFNjM5QkVDQTI5NzI4MjM3MTUxMUZDNTEyMzA1MDc3QUJEMzI2RjE0QkU2QzI1QjJDNENGNzNGQzc0NUE5NzFFQ0I5OEREMjI1MDNBQ0FFMzBGQTlDNDU2NjQ4REFFQUYwQTgzN0EzNEU5MDI4OUY3NkJCRkQxM0VDNkJFQkJBNzBEMDU1NjZCRUZFQUM2RDVFQTQ5MTI1OTk5OURCQxqABDY0MjMwMkNDMEJENDdBODY0MTkwQkJDQjI0MzY5MDQ2NUE1ODAxQzZEQkU2NDE2QzNDN0NDM0E3REZCQjJBNTU0NDNCODRFOTU1RjMyMDlENjQ2MTk1QjAzQUEwQkMyNjg3RDQ1MTNBNDdFQjU3QTU5REQ2RkUzQUVBN0E2MTEzOTEwODkwODdFNUQ5NDc3MkNGMTNEQzUzQUVBQTU1NzFEQzU5N0QzMzQ0OTRFMUVCNzBBQzg2RTI3RENBNTc4MUQ1OTJENzAyMEREOEVGOEUzMjM0M0YyQkMxNUUzMjc4NzAwOUQ5NDdCM0ZDNDREQUU1MTc5QUUyRTE1QUQyQTIwMkMxMTZFNDE5RjkzOENCMjA1REI5MDgzOTQ4MUUyRDUyMDNDNzQzRjlFREFCNkYyMDdEMzU4REIwNzBCODYyMDUwOUY5N0JCRTdCOTZGMjRCNTdFRTZDRjIwRjExODI0RDVGMURCMzUwNUM4NzA0RDFGODNDQUIzRTY4MEREQ0RCRDhGNjZDRERDODQyNjQwRTcxMUU1MUFCNzY5ODE5NUVFRjc3QjBCQkY1QjQwMERCNTVGRTFERjgyNDQ3MTc2OTAwNDBGMDBBM0U2NDhFNDc4MUIwOERFRUY4RTdENjcyMTg4NkI3NDExNTMxNjUxMThEMTc2N0UxNkYwODQ2IoACQ0JDRTQ0MjAwNjdBRTZBNTgxRkY4RDZERTBFRDBGMDNBRDk5NDMwQUI5MEM3MUE0MjI4MUVDMjQ3QTUwQzMzMjJCNUFBRTg0MzVEN0Y2MkJCMzg4OTA3QzNDQjE2NzNFQ0NCOEM3Q0M1ODE5RkU0QzNBM0NGQkQwMkVGN0FGNUE5NUJGNUYzMzMxQjgxNTg2QzNDOEE3MDMwNDIxOTM2RUQ4NjI0MDQ1MDdBMzQxQzhBNjczNDY0QkRDMjFENUY1NDc2QTAyRDc5MjYxQzEyQUIzRTVCOUZDOENFQTNDMjJFMzU2NUJFOUY3QzZEOEQ3N0U3NUU3NkY5RDE5Nzk5MyqAAkM1MUQ2NTZDRkY4QzU4RTk4QUQyNERERTgyNTY3QUFGMTkxODk1MTlGRTlGNTk4MzgzNkEwRDQ4MUY1MDU0NTdFODVBOThEMDgxN0RGNDdGRTk0RTVCQzNFMTU5QzgzRTBGMTMwN0RDMzM1RDg3QTc4N0I5OUM1QTc4OENGNTg0RkI0QTRFQjNEMzFCQ0FDQTNFMTY2MEUyMDk2OUJERTkyQTNERjFDODNEQUY5QzE2MkIzMkY0ODZGMDE1NkMwOTEyMDA5MDgyQkUxMUYwMzNBMDkzMzJCRjI2QTE0NTJBRTI0MzZGMkEyMjgxQjVDQzFCQkY2QkVCREE4Q0VDRUYygARBMjQwQzYzQzdGRjI1RjA4OTdGNDE1RDQ4QTM5NjExNjI1NTBGMjM3RTg5NUQ3NzdCNTlBQUY4OEI2QTBFOUVCNjYxNjVBMDk5NzU2N0JCNUREQTNCRDUwQzBFQjU2OUU5RjVGM0U4NTBCMzFCOUQ0NTk4RDY5QzA4OTQ0OEM3RjgxQTRCQkMwQThDODVBOEVEQ0Y3ODQyQTQ4MTM1QjMyNDlBQTBDQTREOEI1RUI3MURFNjQ3NjU3QUM1REUzQ0M3RThFMDZEQzIwRDEzMTQ4NzYwQTUwNUYyMkM3MjY1NUM5MzI0QjZCMTkyQjEwMzIyRDIwQzhBMkIxODE4MkYxNDhFQjBCNDMzM0JCODU0MkE2MTc0OTFDOTExNjcwQTQyQzdGMTY4MUVGQ0ZEMDRDNzUyNzNGRkUxQjQxMDNEQjIxQUU4NzZDNDM0QzMzNDk3NDY2QkVCQ0I5MzdGNTUwMTIwNzAyNzNEQjJBMkY5NEE1MEJCQUQ2NTI1QUNGNUIwRjMxQjAzMDNENkI4NzBDOTVCMTJCQTJEOTU2MUI5MDJBNjdCMjcxNDlCQkEyRUZGQkUxMzM3NDU0NzM1NDAwOERCRjI1MUYzOTY5MzlGNTY3ODdGNkY0MjQ0QTBFNjg3NjZGNTg0QkQzM0I5MDBENkE0NEY5MjE0NjcyNEE2OTqABDk3QzY0MTc5RTQyRjE2QjBGMDNENTIyN0NDQzYxOEE0ODRCQTJBRjFEMkIyMEU5NTFBOEQ0MUNBRjkyQTJCOTdGRDM2NEQxMzAzNDU4MzEzMEVEQURBMThDRDBERjNGNjk4QUE1MzIzRUY1NTY4MjZDMzM3RDRERThBNzVFQ0UxQjcyQzUyMkIzMzZGMzNFMjA0QjQ1NkZDQUJBNTQ4RTVDMTI2MzhEREU1QzY1QjE4Q0NDMUU2NDU5NkY5NEMyOTJCNjgyQjU4MjA5QzA0QTYwRUI5Q0EwQkZCQzgyOUExMjAzOTM4QkRERDYwQzEzQUE2RjlGMTQ2RDI2RURDMDlDRTIzMDdBODVGQjlDMjU0QTFFNDJCQjFDMDI2QkZENEEwQTM1QkFCNTExQUREN0YwOUUxQzY2OEM3NjkwNUUyOEEyODY2NkUxNDMyRDdBQ0EzM0YyNzk1MTBCNzMwQkI4NjhFNjMzODVGMENEMjkxQ0M4QTAzNTUxQTQwOUUxMEYxNzMwMUJFMTBDN0Y4RjlDMTNGNzM3MzA1MUNCQUJGQjk3MjYyM0I1NzM1OThCOUYxNjQ0OUI5MjVDRUU4MEE0Q0Y3NTRBMkMyQzRFNzA3NzA4QTBGMzk5QzdDQ0VGRTQxNDAyNDM3RDQwQTZEMjhCRTAxMTlFNTBDQjE4NzIxQoACQ0JDRTQ0MjAwNjdBRTZBNTgxRkY4RDZERTBFRDBGMDNBRDk5NDMwQUI5MEM3MUE0MjI4MUVDMjQ3QTUwQzMzMjJCNUFBRTg0MzVEN0Y2MkJCMzg4OTA3QzNDQjE2NzNFQ0NCOEM3Q0M1ODE5RkU0QzNBM0NGQkQwMkVGN0FGNUE5NUJGNUYzMzMxQjgxNTg2QzNDOEE3MDMwNDIxOTM2RUQ4NjI0MDQ1MDdBMzQxQzhBNjczNDY0QkRDMjFENUY1NDc2QTAyRDc5MjYxQzEyQUIzRTVCOUZDOENFQTNDMjJFMzU2NUJFOUY3QzZEOEQ3N0U3NUU3NkY5RDE5Nzk5MkqAAkM1MUQ2NTZDRkY4QzU4RTk4QUQyNERERTgyNTY3QUFGMTkxODk1MTlGRTlGNTk4MzgzNkEwRDQ4MUY1MDU0NTdFODVBOThEMDgxN0RGNDdGRTk0RTVCQzNFMTU5QzgzRTBGMTMwN0RDMzM1RDg3QTc4N0I5OUM1QTc4OENGNTg0RkI0QTRFQjNEMzFCQ0FDQTNFMTY2MEUyMDk2OUJERTkyQTNERjFDODNEQUY5QzE2MkIzMkY0ODZGMDE1NkMwOTEyMDA5MDgyQkUxMUYwMzNBMDkzMzJCRjI2QTE0NTJBRTI0MzZGMkEyMjgxQjVDQzFCQkY2QkVCREE4Q0VDRUVSgAIwQTEwQ0Y1NzQ4RDY5RjE4MTU3NEY3Njk4NUVGODhBNTg5NTY5MjQwQUM2RkZCNzM3MjBGRTQ0QzI4N0M1MDE1NkM3REE2NDREODk1NEYwOTJBOTNFMUNFMTVCNzVDOUM2MjBBNEM2N0YzRThFQzg3NjVFRDYwOTc5QzcyNzVBQTM1NkEyMjJBNTM4RDdBQjRBMjQwNEY3NEU1MjFGNkM1MUY5MTdCOEIwNUQ0MkZERTQyQzFGQjhBNTM2QzdCMkIwMzA0RjA4NTlFREIwNjI0NjFFNTAyRTQ0RTJFMTNBRkEzOEIxNEZGMDRDRjQyRTM4MTFFNzI5RTNGOEVENDAwWoACQkI2MTJFQjBCMjkwODYyMEJDMzMzMzA4QzhFMTAzRUE1REZFMkREN0NCNjVBOTZDRDRCNDM5MjIzMTc2Q0FCN0ZCRjEwNTRFNENDNjlCMjEyMTYzRkZGN0RBQkZERTYwN0I0MkJCNEVEQjg4Q0ExRUUzOUQ4MjQ0MkVEMjM4N0MyMzU5NkEyNkJBRTA4RjU4MzIzRUY2QTRFQ0UxMTc3OUJCRkE1QkVFRDYxNTNGOUU2NTcxOEZBNjIyNUFFMkMwRUQ3Rjc3NDczQUVBMEIxMTcyRUI3RTVFNkY5QTJGNDlFN0U1Q0JCN0FBMDM3MjUyRkMwOUU3MjBFMjgzN0M1NGKAAkMxQkQ3NEM4QkRBNDQ3OEQ2QzhBOTYwNDVBRkQ4NjVFMjQ0MkIwQ0EwQzlDNzYzMEIwNzIwN0Q4NTFENDczMUNCRUREMDgzRjVENDJBNzIyODhGNEFFQUUyNkZBMEFBMjZBQUU3QjY0NjQzMTExQzRENDRGOUIzODkyODUzOUIwNjA1NTNEMDhERTJBOUFEMjIxODg1NzhFMUVGRjlDQTlCOEQwQzRCQTAxQ0YxMUVBNjNCMTRBQzE4OEI1NUFDQTQ0NjUxMjUxRjM4NkJCMDY1MjAwQjcxODNFQkMyODczM0ZDQjQ2RUFGMkY3OTVGM0ZENTc3NEQxNUQ4QUE1OTNqgAIwOUJDMzZCQzRDRkJEMkM4Q0U5RjFBRDVCOTc1NzZDNEJCMUE2NzQyMzMzOUIwMTZBRUI1RDQyNUVERDk4OTlGRUM2OTkzODIzNEI3NTk1RUM3RUE1QkNDMDY5OUU5REQ5M0QwNEM4RDU3RDRCRDg4QTQxQzFBMTY0OUJBQkQwOEQ3RjBFNDhEMTgzQjNCNzIwQkQ3NkEzRDFDODhBNjZGNkU0Mzk1RDk2NzlBNUM3N0M1QzE2NEUwQ0RCQTg5NDgyNDgxMTkzQjgzMjdFNTIyMkRBN0I0NjBCNzA3MTVFMEZBNURBMzcyNzg3RTQzNzkxRkI1ODRDQUY4MDk3MDlCOoYICoAEOUNFRDIxODk4M0Y0RTBFQ0IzNDU5NDI1QjcyRTQwRTNDMjk0NTk4MDQ0Q0JGQjJENDA4MUY1QzE3NjU5NTgxQTU4RjEyNTI1MUI5MTlCRDI4RTM5NDlDNDAwNzg1REY1MUQ0QTI0MDI3NzkwQkFFRURENDJCOUYyMUJGMzExRTE1MkU2QjNCMjg5RDA5NTZEQzM0NzJBNzE5ODAzRjYyRTdFNDcxOTI4MTE3NTU1RTEyQTc0OUQzQjZCRjg1QTczOTNDQjlBNDFGMDFENzgzQTMzMTE4MzUxMEM4MDYzQjJDQTQ5MkQ0RTQzMkE1QTNEOThDQjc2NjU3QTIyREJGRjEwRjRFNTBDNjkwOTBCM0M1MUU3Mzk3M0QwNzgxOUI3NjI0RThFN0FBQkM5RjVGNTY3RTBDNzBEQzVEQThENDM4NUREODhFNDY3QTdFQzU0RjA1NjI0NjZFN0QxMTE0REM0QjIwOTY3NTVBMEY4NzVGOTBCQUEyNkY4QTdBOUU3MEJDNkUwNTYxOTkyNEM3NkI0QTNENzU5MDlGRkFCRUYyMTZCQ0FFQTY3QTMxOEE5QjRCNUU0OTcyMjlCQ0ZBRDA4NzUxNkQ0ODU1Q0IzRTg0QkU0QUM4Q0YyNTI0MDA5NkNBNkQwNkE4NjM4Nzk2QTcwMUY5QzZERDE0MDA0M0QSgAQ5Q0VEMjE4OTgzRjRFMEVDQjM0NTk0MjVCNzJFNDBFM0MyOTQ1OTgwNDRDQkZCMkQ0MDgxRjVDMTc2NTk1ODFBNThGMTI1MjUxQjkxOUJEMjhFMzk0OUM0MDA3ODVERjUxRDRBMjQwMjc3OTBCQUVFREQ0MkI5RjIxQkYzMTFFMTUyRTZCM0IyODlEMDk1NkRDMzQ3MkE3MTk4MDNGNjJFN0U0NzE5MjgxMTc1NTVFMTJBNzQ5RDNCNkJGODVBNzM5M0NCOUE0MUYwMUQ3ODNBMzMxMTgzNTEwQzgwNjNCMkNBNDkyRDRFNDMyQTVBM0Q5OENCNzY2NTdBMjJEQkZGMTBGNEU1MEM2OTA5MEIzQzUxRTczOTczRDA3ODE5Qjc2MjRFOEU3QUFCQzlGNUY1NjdFMEM3MERDNURBOEQ0Mzg1REQ4OEU0NjdBN0VDNTRGMDU2MjQ2NkU3RDExMTREQzRCMjA5Njc1NUEwRjg3NUY5MEJBQTI2RjhBN0E5RTcwQkM2RTA1NjE5OTI0Qzc2QjRBM0Q3NTkwOUZGQUJFRjIxNkJDQUVBNjdBMzE4QTlCNEI1RTQ5NzIyOUJDRkFEMDg3NTE2RDQ4NTVDQjNFODRCRTRBQzhDRjI1MjQwMDk2Q0E2RDA2QTg2Mzg3OTZBNzAxRjlDNkREMTQwMDQzRUJAMEQzNEVBRDJEOUU3QzBFQkU0QzFFQUQyN0U3OUI5OTAyOUVGMEQxQjZDQzlGNzM1NzQ4NjJDMzY2QkQyMzVCNkqKAQpANDg5QUExNTc5Q0VDNTRCMEYzMzI5RkIzQjhGMERBQTZGMjQ1QzQwMjlGMUY0NTc5OTNBRDU4Q0FEMzAyRjRDOBJANzU1NjJDRjFFRUNGMDk5ODgxRkY3QzY0NTVDODUyRkNFOTMwQzc5QUEyNTk5MEJEOUQyNzI0NDQ4NTZGOTAwNxoEcDI1NlKABDlGQ0JBODY4OThDNUJCOUVDODJFQ0JDMkFENDFCRkY3RjFBNkEwQUU5OTIyNzQ5Q0JCQ0RFNjk0NDQ0RENENkUzQzgzMkNBQzA0OEFGMkYyQ0JEMUVBNjJFRjNCODJDODc2MkM4MUJERTdDOTQ5OTQzMzI0REIzQ0FCQkI5NzM4MkVCOTExMThBRTY0OTMxMEM3NjM3OTQ3MzA0QzcyN0I1ODRBOTE5M0QzQTNGMUEzNzk2MUY1NzI1RDVBRTVDRDUyOTk1RTQxNTAyRkI5MDFGOEI4MzczQzE4MzU0MDE0RTJBMzA5OEQyRUUwQTI4NzQyODQ0OTg4QTQwMDkxNDQ3NEZDMzIyRjREMDMwRDNFREM5Q0I0RTM0Q0E4NEM4NTVCNzBBM0Y2QzNBNEUzM0Y1MDAzQTlDMUY5QzZBNzQwNEY2OEZDMzhBN0E4QTUyRDk1MkM0NTdENkQzRjNFNENEQkMwMjAwOTE1NjlFRjZENzRCODZGMEUzQjI2MUY2NDkyRUQ5NThFNDFBMDZCRUUwRjc3MThBQUY5MzE3REJBNzYyQzEzMzNEMzlBQzFDRDEwQTQ5Qzc3M0VCQzU4RjFBQzI3RDRFMDhFMzg4QjJBNzc0MDdCRTNFQjM2OTJBRTFENjRCMjk1NUQxOEU3OEQxNzRGQTkzNjBCQTc3NkI5WoACNjQxMThEMzRENzc4NDJFQkNCODlDNDUyNzhDM0E0RTdCQzA3NzYzQjBDMTg5REZFMDJFRkY4NUFEOTE0OTQ1M0FFQ0U0NEVFOEY2MTRDNjdGOEM0MEYzQjYxNjE1NkY0RDAwOTU4NUY0MTdBN0M0M0RENERGQzg5ODFDQUY5ODMwMUMzNEEwN0Y1QTZDNUM0NkJERUQ1MTA4QkM3NTAzMUM5REY4NzU0OUM5NEJFMzkwRjQ4MTMxMzdGMUVEQzVEMjZBNDlCQkE3NUFBODM5OUI5MTBGNTVBQTM2MzZCNzVGQjM3QkM1MjlBQTBGRjZBQTE2MjNCNUZCRkZFNDdCM2KAAjY2MzJGNkE1NjNEMTY4MjIzRkJCQjg1OTFDNDI4Nzc1MDFCNzUzN0M3MUJEMURGMzlBQTBCMkY5Mjg3NEY5RUJBNTI2QkUyQ0RDNzcxRkEyMTZDNEI1NzI0RUFFMTUzOTNGMEFCODM5NDA3OEU1QkEyNDgzNkEwQzA3RDIxMTk0NTA1MzlGRDI5MjNDRDMyMDQ0QUE5ODJFN0U3NjcwRDdCRUYwREI2QTlEOTczMEIzMzNGNjkwNDY1OTI3NjkwOEYyQTZCODk1RUM3Q0M4RkI0Qjc4MUNDRjU2MDU4QTg0MDU5REU4RkIzMEMzQzQ4MjVBRjc2RDJBQjBGNENBNkZqgAQ2OTk3REZFRUI2MTJBQkVBNDJFNTI1RjgwRjI3M0QzQzkxRTg2RTI0NjBCMTYzMDBCQ0U4OUM0MDgxQTM4MjAzREFDNjA0MTNFQkU1QjI4MjFFNjIzNDc4REUxN0M3MUYwNjYxMTQxNjg3NzlFQkMxM0EyRDVERjEyQkE5Mjk0QkUwMURCOEJBMkRFNkVDNDJBMzg4RDgxQUQ1RUMyNjQ4OTM2QTIzMTVBQ0M3NUVFRDdGQUEwQjc4MUY1NDhGMDQ1NERDRTREODc5REJFNTQyMjZENzhCNDlGMEFFRkM3MzNENDJEN0M3M0E0RjM4Q0RFMTBFQzVGOTkwNzE1RTZCMjIyRkVGNUU0QUQzN0ZEMEYzNUI2NjQ2OTNFNzM0OTZFMDM2OUYwOEI0N0Q3NTc0Njk3NkIwNkY1RUVERDdCOTkxOUM3QTgxNDFCOTVBRDMwRDU5N0VCREQ2RjNBNzFFRTZDQjZGQUQ2NDA2MzAyRUFEOTc1ODIzNTlCNjc3M0MxNzcxNkE5QzQ4QkIwRUM4RDAyMjY0RjA4NTZBQTRCREMwNzdCNzFBMjIwMkQ3MTE0NjY3NzEyOTlBNTMzMEVBNzgyNjY0NDQ1MEFCMzIxRjI0QjJDNDZBMzhGRTFFOUJGNTVBREFCRDU2OEUyMUY2RTA0MUY1MjlEMkE2REZDQnKABDMwNjYxRjBCMjg0NURDODFEODE2NzlFNjVGNkZFOUJCQzBFNEY4QkJEQ0JCQzRDQUI1RUJEQ0I4MUY3MUQ0NTYwODkxQjFDRDgyNkIzMEExNDYwRTYwRjkxQzlBOUI0OTQ1RDYwODdDMzQyMDZENzE4NzlBM0U5RTZGMDkxMjZBRkFCOTE1QzA4ODlDMUU2QzBDQ0I1Mzk3MzI0RDdBRDgwQjAwMTUxMDM5NzFDNDIxMDM3OTk5RTk2MkE3Q0FGQjhBQkExNjQwREJEQTgwQUUxQkMwQzExMkRDQUFEOTMwOEMxQTFFOEYxRDY0REVFMjc0RjI0RjMxMzNEMkIyNjNGMzI3MDc4RTcwQjQxMUJCMkQ2NTAxQkVEODA1QTUwNTlGMzU0RkYxMjE1N0JGRTA1MTAxRTMxMDFDQzI2MEQzMkJCMDQ2RDk1MERFNzY0MTJEMjJFRTRGMUMwOTVFQzQ1QTc2REY4MjI0QkE1NjhBNUI2MkVBMDUxN0JDMDk5MTdCMkJEOTFFNjMzQ0EzQzIwMzk1QjY4QUIwMjg1M0M0QTVFMzhCNTgzRUE4NTg0RDlDNzJCQzY2Mzg0QTEwODlBQ0MxQTFEQjNEODdERDhENDRDMkY0Nzg4RDFERkZBOUVEQzAzQkI3QzkwMjU5MjJFQkY2Q0MxNERDMUFEQzVGeoAEMENDOTFCQjhBMzA5MjBFOEFCNzI2MTU3NTBGQ0FDRTYwRDhGNkFFODc0QTgzQ0RDNTc0RUNEQ0REQTkzQTIzRTZGN0MwMEFEMEU5M0RBQjM4OTQ0MDExRDgxMUE4MjAyRTBCQkMxMEYxQzE0Q0QwQkFGMkM4QzU4NTA2RTM4MTgwQjU5OUE2MzU2Q0U4QzdDNUQ4NjJCMURFMzVGNDcwOUI5Q0ZEQUZCOEVDN0IzRDNFQ0EyNzRFRjVGRDExMERDMDBBQUVBQkMxQTcwRDA0NTczOTdDOUUwMzE2RTJBNDM0MUE2QjdGMUE2NjFERTNFMzExQUJFMjc1NzdCNDRCQzlGNjNGRENCMTYwMUJEOTUyNDg1ODEyNDMzNzVBNzg4NjVENUNEMjU5NjlGRkNBMDhGQkFEOTQzQTBCRTA4N0QxMTYwM0VBNjNCNzIxMkY5Q0FBMEQzNTM4NEQ4N0Y5NDUxMEU5OEQyQjMyQjFCRkJFRTgxMjk0NDg5ODg5MzAxQ0E3MkQ4RjUwM0U0NzcwRkJCMDhEOEIxNzMxMTI4OUIyNUM1NDU2MkE5RTZDNjYxM0ZCMzcwQ0IwMTM2Mzc5NzlCNDRDODQ4MkM2N0YwQ0EwNTRBRThCNzA2NEYxQTg4MzRGRUUwRjY2ODg5MkQ1QTJGMTlFRjg0Q0NCMDYzMUOCAf4DMzhEMkE2Q0IzNjk2NUNGMUY0MjdFMUEwRDExMTA1OTEzREM0MDZBNTIwODQxNjIxMUE4QjNENUYzNzQ5Qjg3QTA1ODExNTRFMDRCMERCMjQzMDY2QjJDRjY5M0IyODgxOUMzQUQ2QzA2OEU0MjlDMEMxRTMzOTY1OTMxRjQwODU4RTIxQUY5OUJCRkJCQzYzQjg0NkVCMkU4Q0E1ODM2NTdCN0FGOUJFOEVBQTExM0E5N0Q5Mjg1OTc1MzFFNzE0RTg2NDg1ODBCMDk2NzE2QUNBMTJFMzdCMjY0NDZDNDA3NzZBRDNGMEMyRUM1RTExMzYyOTYwRUZDRDI2ODg4REI5NjFDQTU2NDE1RDFDNURBMzc3MDI1RkZFMTMxQTQ4OERBRkUzNDUwOUFFNEQ0OTRERUZCMTI1REU3QzM1NTY4OTVGNEM4Nzc4MUNEQzY0Q0U3QTFFRkIyMDAyOTNDNzRDNjcwREMxNzEzOUZCOUE4NDJBMkM5NzYzM0MxNjU2Qjk4RDUxNzZDMzlFNDQ0N0I1QzU0RkEzOTA0MjE5RTkwNTE3NjY4RDU1QUU5Njc2Qjk5RkExQjc3ODUwQzc2NkQ3MzQ3MUQwRjZEREZEMTQzQTVBQjBFNUZENjQwRUY1MUZDRjRFMUVCMzZEQzJEQUI0NEZCNUIwRkI2RkIzMq8VCgpjb19zaWduZXIyGgIwMjqGCAqABEEzRERDM0QxMTc3MUE1NDVFOTA0NzhBNUJDRkNBNkNGREE4QzFCNEY0QjRFQjFERjdCRjY3QTVDMTgyNEI0ODUyQkY1Qzg5Nzk3Q0NEMUQyNTMzNDdGNDJBNTRDRkFGQUE4MjYzODhDMjRGNTM0QTA0QUFEMjBDMUVCNDUyODBDQTQwNTg3M0ZDQTMyRUM1NEZFREEyRkZGN0JCMTM0MDRDNjA1OUVFRTk5NUMxMDdGOURDM0FGODcxODI3MTdCOUFFMkM5RDEwQzU4QkVGNjExN0JCQzAwRDM4NUY1REYyRTI1MTk2MzYxOUEwQzU1MDU1MzQ1MUE2NDBDQTQ1NTFCODk1NDhGRjdCMzNEMURCQTU0OUQzMkY2NEIxQjU3RUFDQ0RCNThBREFDNzQ4QzhBMDM4NzkxQkRFOTBFRTU3RjQ1MDBDOThDREYzRTNDNkYzMUEwMkEwMThGMEZEODYzMEIwRkJFMTY3MEJENEY4OTIyQjFEMDk3OUNEMkJGNTVGRTg4MzZCMzFDRDMxQjVCOTZGMEYwNUE3REQ4QzUyM0ZCMkZBODQ1NERDRTg3RDM1NjFDMjk3OENGRUM4NDMwQzlBRkFDMzUxODRCODQwQUZDNjk5QTI1OENDQ0VENTFFQzYyMUNCRDIwRDVDQ0UzOUUwNDY5QzI3RkM5Q0I5EoAEQTNEREMzRDExNzcxQTU0NUU5MDQ3OEE1QkNGQ0E2Q0ZEQThDMUI0RjRCNEVCMURGN0JGNjdBNUMxODI0QjQ4NTJCRjVDODk3OTdDQ0QxRDI1MzM0N0Y0MkE1NENGQUZBQTgyNjM4OEMyNEY1MzRBMDRBQUQyMEMxRUI0NTI4MENBNDA1ODczRkNBMzJFQzU0RkVEQTJGRkY3QkIxMzQwNEM2MDU5RUVFOTk1QzEwN0Y5REMzQUY4NzE4MjcxN0I5QUUyQzlEMTBDNThCRUY2MTE3QkJDMDBEMzg1RjVERjJFMjUxOTYzNjE5QTBDNTUwNTUzNDUxQTY0MENBNDU1MUI4OTU0OEZGN0IzM0QxREJBNTQ5RDMyRjY0QjFCNTdFQUNDREI1OEFEQUM3NDhDOEEwMzg3OTFCREU5MEVFNTdGNDUwMEM5OENERjNFM0M2RjMxQTAyQTAxOEYwRkQ4NjMwQjBGQkUxNjcwQkQ0Rjg5MjJCMUQwOTc5Q0QyQkY1NUZFODgzNkIzMUNEMzFCNUI5NkYwRjA1QTdERDhDNTIzRkIyRkE4NDU0RENFODdEMzU2MUMyOTc4Q0ZFQzg0MzBDOUFGQUMzNTE4NEI4NDBBRkM2OTlBMjU4Q0NDRUQ1MUVDNjIxQ0JEMjBENUNDRTM5RTA0NjlDMjdGQzlDQkFKigEKQDg1QUIzQkY2RkM2QjVBMDJDM0E5ODVDQjkwQjMwNzNFRDQyMjVENzIyRTkzMEFGQjM3NzdERDk0NkNCRDU0RDISQDVEMUVCMUE4QjVCNzQ3NTg4OUI1ODZCODRCOTFCRDcwMTBDRjdBODZFRTE0OEIyREVCMDQ1NjE0RTJEQURGMEUaBHAyNTZSgARCMTRCN0U3RTlGNTRFNTYyODcwM0Y3MjI1MUZGQjA4REY0RDdFRTFBMzgyMTc4NDZFMzUzM0I5NEM0QzJCMDFGNURERjJFOEY5ODQ2QjI0NEFGRjNCMDJDN0ZDNjlBNkQ0NTg3M0U4MjQ5M0I3RjE5RTQ3MjAxQTFBRUQwMjcxRUYxRDgxMkI4N0MzMjUyN0QyQUVFNTVBRkY3OUNDRjA2MjMzRUUxOTA0NUQ0OUQxNUI1OUZERTI1RkY4RjUzNzY5QTNCNEUyQTFBNzI0QjVCNjJGM0NBRDA3NzUyNkIwNUVDOTU1QzlEMTkyMjlDOUE3MTk5NTY2OEUxMTZEQjdFNTM5OUM1QjAxRkMwNTFERjFFMTMyREM0NjU1RTdEMkIyMjgwNEM2NDIxNTUwRDM0MTlCOTZFODhEQUQwMTZGQkEzRkRFMTMxRjc5MjAyQTVFNjk5OTQ0MUMyMzMyMTA2MUU3NEREOTAxNDNBNjczNzc4NENDRTUxMUEwNENGQzhFNjQ2OENFOUI0MEVDMjU4ODU1ODUzNTIwNTQ1NjBCNjkwQTk4RjNGNzUzMDU5OTE3RUZEODQ0MDA1RUY1NDYyOTI1RDM0QjdEMkUxRUMyQkNBQkI1OEJFMDdBMzAyNEJEMTQxQjQ2Nzk2NTJEOUQ3MjM3MzEzRDFFRTZGQUQxMWqABDA0MzFCQTQ0MjdGNjU3MjJEMjg0N0VEM0I1Mjk1OTMyNTIxNDJBRUI3NjQ0MkVFRTM0MzRDODZERUMzQTA1QjFDNjMxOUEwOTZFMjdERTA3ODFBOTQyRTZGOEZGQ0E4QkFBQjZDNjZDRkU1MDJDMjI0OEJGMUFERjNGRjI5OTk4QzlDODIxNzgyNkZEMkUxN0Q0RDhDNjcwRDEwQjZBNDI2NjE1NzE4QjhCN0JBQTFEMDc5OTgzQTJGOEY5MzRGRUMxMzNBQUI2RUFDNDVCOTcyMjJEQjAyNEM0MUEzMkYwNUE3NTQwMDhDMERCMUIyM0IzQUE3NUUzOUQzRjZDQ0U3MTZDNEUxMjYzQTBGMTk2NjQ5MTRDN0Y1QjNBMjM3NjkyRUM3MDg1QjI3MDY4ODAyRTUwQzQyMDJEQUJFQUFFNjJDNkY5NjI1RTJENzE0QjcxNjJFNUU0OURBNDQzNTQzQ0Y5Q0RENTEzNUY4Mzk1NjYzMkZCREMxQ0M4Njk1MzJCMzMwMzE0QkY2NjJFNjM5MjQwQkQ2OEU2NkY2NERFMDFGMEVGQzNFQTQ0NDM4QThFMEZCNjVCOUExRkJGRDY1QUU5RkUyQzhDMjJFRjkyNTk1RjFGNUEzNUIyNjJCRjQwQTBENUQxRjExQTM2MEY2MUExMjE1Q0FFMjg1RDkzcoAENkFBREVEOUQ2NjUxOTVCQTJENzEwRTUyRUI4ODk4RDdENEJBNTkzNUY0QkIyNTFGREZDMjAzNDhDOEQzNzVDNjQ1Qzg3OEIxMTQ3QUJCREFDQjgwMDM2ODk0QjU0OTI5NDAxMzk5Qzk2NTkyM0VBMDNGRDdBNzhERDUxMTZGQkFGMTlBQzMxMzQwQjA5MTZBRTI0MjVEMENDRTUxRkFBNzcwOUUyNzlERTRFQjVCRjc5NkM5QzI5NzkxRTIyMEJCOUFDQUEwQTk2RjZCN0NBQkFDNzRCQUNCNTkxNTdERkVEOUQzNDkwMzNFMDg3MUUwMDEzRDIzQzg3OTRDNzVEMUEyMUZBRjY4MjBEOEM3OTJEODQ1RDk1QjlEOEM1MjAxOEYzMTExNEVGODNFNzFCM0QxODZEMkFDODI5NjNDNkJGNDgyQjI4QjY0NDI4QzAzMTNCNDJFQ0IyN0U4NjFENzFFMzQ3MkE4OTUwMTczODZERUFEOTNFREUyQTMyOTgwNUI4NjBFQTgxRDRDOUEyMjA1NEM5NkY5NjUzRjM1QUExQjkxRDZCNkZCMzRGNUQxRDA0MzU4NTg0NEQ5QUQxQTQ3QUEzMzBGQTU5RTk1ODIzM0M0NDYwNjAzQ0M4QjdDQTA4RUU5QjhGREJBNzY3NDkwQTUwMjg4NUM1Mjg2N0EyrxUKCmNvX3NpZ25lcjMaAjAzOoYICoAEQ0QxRjU5REJFMDBDRjhEMDk0RDI5RTBGNzE1MUU3MkZGM0IxMzdERDUwMDM4N0NDRTkzRjdFQkRGNzJCRDc4Mzk1RUFCNDkxNEYzNkJGQTQ0MkZCMEIyNUUzREUyMTczN0FCMDU4OEIzRTFFNTAzREM1MDZEN0M3MDQ2MzcxNzFEMkUzNDM2MkQwRTU0N0U2OUFFM0NFNUIyRTU1RjdDMjVCNDJFNkYyODc0QkVBREY5ODc4REVEQjVFMUYxNDRFRTQxMkRCRTI1RTQxOTMxMzAyMzM2NUExQ0U4Qjc3OUUzMDdDRDA2RjU3NTYzNkEzQzhCMjZFOUUzMzQxMkVDREZENDYzREY0ODA1RDcxMzdCMjI5QjgwQkVCNDg5RkIxNjJDQ0QzMjEzMUNCMEE5QkI1MUZFQzhBMTlDMDE1QjFGQkYyMzg1MUZFMTdGMTMwMjg1MUE1REQ0N0M2QUJEMzdCNDBCMEEwMUQ0NEEwQkZFRTUzODA2MTUzNTFBQ0NGMTc0MkY2MjNDN0Y5ODFEOTUwMkM5NDc4NDg0MUJDQjczNUVFNEUwMjMwNkExNTZCMDkzOEQ3RTlEQjkzQzAyRjkwNjdDMTQ4RjlCRkI4QzQ4M0JDM0UzNkE5RjBBRTFDRDcxNzFGODNDNUI5ODM3RDk4ODhDOUI1Q0JCRjdBQjESgARDRDFGNTlEQkUwMENGOEQwOTREMjlFMEY3MTUxRTcyRkYzQjEzN0RENTAwMzg3Q0NFOTNGN0VCREY3MkJENzgzOTVFQUI0OTE0RjM2QkZBNDQyRkIwQjI1RTNERTIxNzM3QUIwNTg4QjNFMUU1MDNEQzUwNkQ3QzcwNDYzNzE3MUQyRTM0MzYyRDBFNTQ3RTY5QUUzQ0U1QjJFNTVGN0MyNUI0MkU2RjI4NzRCRUFERjk4NzhERURCNUUxRjE0NEVFNDEyREJFMjVFNDE5MzEzMDIzMzY1QTFDRThCNzc5RTMwN0NEMDZGNTc1NjM2QTNDOEIyNkU5RTMzNDEyRUNERkQ0NjNERjQ4MDVENzEzN0IyMjlCODBCRUI0ODlGQjE2MkNDRDMyMTMxQ0IwQTlCQjUxRkVDOEExOUMwMTVCMUZCRjIzODUxRkUxN0YxMzAyODUxQTVERDQ3QzZBQkQzN0I0MEIwQTAxRDQ0QTBCRkVFNTM4MDYxNTM1MUFDQ0YxNzQyRjYyM0M3Rjk4MUQ5NTAyQzk0Nzg0ODQxQkNCNzM1RUU0RTAyMzA2QTE1NkIwOTM4RDdFOURCOTNDMDJGOTA2N0MxNDhGOUJGQjhDNDgzQkMzRTM2QTlGMEFFMUNENzE3MUY4M0M1Qjk4MzdEOTg4OEM5QjVDQkJGN0FCMkqKAQpAOUU4OTk5MjMxRTMwMTY4RTNFMTZCMTA5RjMyQUYzQzEwMTQ3NThBRUZBRTRGRUEyRDZBOEExQjdFRUNDMzc5NhJANTg2QTM2QkRCQUM4NzFBM0ZEQzdFNjk1NDcyM0E4MUNCQzM0MzBERkFENDdDQzkxQUI1Q0VBNkEwOEI0REFCMBoEcDI1NlKABEREOUJCQzBBMUQwOTRFMTk1QTgwMDRDMkY5NTBBRDgzMkY1MzkwMjFDRkJGOUZGRTIyNEJFMjZFM0FEQTVFRkM1QzhEOTAwMDBDMjExOTlBQTFFODM2QzlCNjYzNjA3MDI3MDBDODM0MjFCOTk4Q0ExNTcxMDcxQUQ3NDY5OEIyQTA2NjI4QTc4NkM1NEJGNjY4OTU1Q0UxNjBCRTFDNzVENDg5ODhGRjNCRkI5MEIxMkVGMEM2QTM2OUMyRDdDODMwOEQ3RkM3NTM5RENCRDU1RjAzRjU4Q0UwMzlGMEQ0OTg5Q0VGMjRDM0U2M0U0MUU1NzRGNjg2NUE1NjAzMDc3QTExOTgzQjgyMDY3QzlBMEM3NEZEREQ3MzA5RjQxMjNFNTZEMUM0RTdDRTE0MTg2MDdGQUU3Qjk1NDhENjI5MDM0RTgzQkFFMkQ2N0U3MjlDNEZEREZEMjUyRUQ1Q0VBNkJDRDAwQTM5Q0JFRTEzQjgyRDg5MUNFODI5N0M0QkFCNjhBOTYwNDNDMDhGRkUyNDI0MEE2MDkxQTJDRTI5ODgyNEFEREMwN0QzMjA5MkVGM0FDMEVFQ0I5RENEQkE2NkM1RDA0Q0FDMzREMkE1QTEwRkZCREUwQUI4MTNCMTAzQ0MyQTQ1NUY3NkFGRDJGRUM2MUY3MjcyRjNFOEREaoAENjA2M0FDM0E0MERGMTQzQzU1Q0MwRTlGMTBEM0QyQjE1NDhEN0Q3Mjg5Q0M3MDQyMjM4REQ2QTNBRDA2QjFFOTZCQjk5NDYyNDYyOTMwOEVFRDAyNTUwQjM5NkZGRjUxREQ0QkIzNkREMTVCNkMzN0ZFNDYzNEMyNTg5NzdBNTNCRTExNUU5QzNGRUE2QjA2RTM2RjczODJBMjE4NjA0MzlBN0EyQTU4OTgwM0JFNEY2RDgzQkMwQUVEOUMwMUM0QjIyRUFFQzBGOURBNDgyNkUxMkEwMjZFNzdBNDAwMTE3OUUyMjNBN0VGRjA3OEFENjhBMkNCRkMzN0VBMDM0OEI2MkNDNTk5REVBMzFBNDY4Q0M4Njk5MTE5RjVFNkY3NjFFMkZDNzJERDM5RjNEOEFCNzlCNjY1NjNEQUIzRDQyRURBRUQxMDFCOUFCRjQzMTlFNzM1RUVENzUwNzk3MENGQkIzNzE2RTk0NzFGRjQ0Q0VBREM3NUVEMTA4MzZCNURDODA0QkRERjBGMEIzREYyMTRCOEI0OTI4MENDNzE4NDlFNUNEMEIxRDQ1ODM0MTJEMTkzMTVDRkUzMzM3QzdEMjAzMTFCQjlFQjM5OTgyMTEzRjRDMjg5NkI2NTZCNDIxRUY5N0M5QzU0MTRGNDJGMTg3RUNCMUQxNDlFNDlygAQzNDAzMzc1Rjk2REY0RUQ0MUU1MDFERjk1MzdGMUMzQjg2NzkyNEJDMUNDQ0I5RUMxRDlFMEE3MkQ2NTVDNjlCNDFFNkNCRkQ1QUVFQjEzRjJDQkFCQzI4NEYxMjExMDRGMENEMTgwQzkwQkJBNkJCNTk3QkYzRTg2Q0RGMkNFNTY0MDExMEE4OEJFNzJBNDlGNTc4QjE5MDhBNTNDQzQ0MjEwMjFBMjM4NEU3MTU2OTFBOUYwNzM3ODFGNUZGQUNGMDA5RTUzQzJEMEVBMDE4RkFGOTc0NTk1NjM0MjY3NDlBNzgyODlDMDMwNzQ3MTAyMjFBOUIyQTQ0MEU0NzFFN0YzNDgzMDY3MURBMTYzQzc3QjAxNjQ3QzAyQUIzMEU1MDM5MjYzMDYxMUQ1QTExMUJBQTM2RTM5MTIwRURCQkQwQUNFQTExMEVENjBBNUZFNDIxOEM3QkFCRURFNjFBM0JDRDA5MUNDRUI0RDY2OTlDNUVCMjlFQUZFQjAxM0FBNzY3NDNFNUVDNkY1Mjk0NDMxQUNFNDgyRjM3NEZDNEM3MjdFRjZDN0Y4OTM2NzgyOEQzQjMyMkMyODczN0REMUEzOEYwRDY2QUNCOERGRTQxNkQxRjdEMjg4N0UzQUFBNzRBMUJFQ0NEMzkyRkZENTFEQTRDQjA5Qzc4MjYxRjqKAQpAQ0RBM0E3M0JEQkI2Njk4MjczRUIwQzNCQzQwRDFCNTRGMzlBOEQ3MzIyRjlDRTZGODg1QkU2NDI5N0VENDJDNBJANTM3MUI0QjFGNzk5RTcwNzFGMTkwMTVCN0NGM0ZBNTk5MkEzQkU5N0QwMDFEMzRGNjExNUUyRkE1ODY2QTI2MxoEcDI1Ng..",
+                    "Cgt3b3Jrc3BhY2VfMBADGAMqqEYKCmNvX3NpZ25lcjIaAjAyMqckCoAEQTNEREMzRDExNzcxQTU0NUU5MDQ3OEE1QkNGQ0E2Q0ZEQThDMUI0RjRCNEVCMURGN0JGNjdBNUMxODI0QjQ4NTJCRjVDODk3OTdDQ0QxRDI1MzM0N0Y0MkE1NENGQUZBQTgyNjM4OEMyNEY1MzRBMDRBQUQyMEMxRUI0NTI4MENBNDA1ODczRkNBMzJFQzU0RkVEQTJGRkY3QkIxMzQwNEM2MDU5RUVFOTk1QzEwN0Y5REMzQUY4NzE4MjcxN0I5QUUyQzlEMTBDNThCRUY2MTE3QkJDMDBEMzg1RjVERjJFMjUxOTYzNjE5QTBDNTUwNTUzNDUxQTY0MENBNDU1MUI4OTU0OEZGN0IzM0QxREJBNTQ5RDMyRjY0QjFCNTdFQUNDREI1OEFEQUM3NDhDOEEwMzg3OTFCREU5MEVFNTdGNDUwMEM5OENERjNFM0M2RjMxQTAyQTAxOEYwRkQ4NjMwQjBGQkUxNjcwQkQ0Rjg5MjJCMUQwOTc5Q0QyQkY1NUZFODgzNkIzMUNEMzFCNUI5NkYwRjA1QTdERDhDNTIzRkIyRkE4NDU0RENFODdEMzU2MUMyOTc4Q0ZFQzg0MzBDOUFGQUMzNTE4NEI4NDBBRkM2OTlBMjU4Q0NDRUQ1MUVDNjIxQ0JEMjBENUNDRTM5RTA0NjlDMjdGQzlDQjkSgARBM0REQzNEMTE3NzFBNTQ1RTkwNDc4QTVCQ0ZDQTZDRkRBOEMxQjRGNEI0RUIxREY3QkY2N0E1QzE4MjRCNDg1MkJGNUM4OTc5N0NDRDFEMjUzMzQ3RjQyQTU0Q0ZBRkFBODI2Mzg4QzI0RjUzNEEwNEFBRDIwQzFFQjQ1MjgwQ0E0MDU4NzNGQ0EzMkVDNTRGRURBMkZGRjdCQjEzNDA0QzYwNTlFRUU5OTVDMTA3RjlEQzNBRjg3MTgyNzE3QjlBRTJDOUQxMEM1OEJFRjYxMTdCQkMwMEQzODVGNURGMkUyNTE5NjM2MTlBMEM1NTA1NTM0NTFBNjQwQ0E0NTUwMUVEODhDRkM5NDZGMkMwMkEwMjkwRjgyNTAwNTc2NDg2ODlDOEQyODAwOTI2OEVDQkY1RDg1QTEwNzUwQkNFOEQyQzdGOTM5NjZGRjQxOUExRDZFNDQ1MzdFNTk4MzEzRThGNDgyOTBEMDVDNDk1Q0I2MEE4QTA3MzVDMTI4MUFDQUQwMTI1RDlGMjQ3RTlCNENCNTYwNzQ4NjU1MkZBQ0IyNDYwMjg4MUIxODg2MDBENkZCRDZENjYzNjY2MjZBQTREMzU0NTQ5NEQzRTRDOTA1OTYyMjRGQUQwOTI2MzUyMkU4MjQ3NTI0NzU0RkY2RjU1ODBEQ0VGRDAwOUZFNBqABDA4NUIwRDhFMzJBNkEzRTk1ODYzODExMTMwODQ1QzVCQTlDODdDQTVFMkEwMjg1QTVCOTQ2MDEzQjE5MkQ1NTBFQjc0NjdGQTE0RjBEMEM0NUQzRDMwMjI2QzcxQjg2NjMxNjI3M0E2NEZFNEZGOEZCM0MzOTdGN0QxMTkyMjE5RUU2MUVENDMzQzU0NUEwMDRCQjU1NEU1RTc3MTE0MTQ1RDYzNzU3QTZBM0E2MTBEQzNCMkJFMDQ1QkY3NDRBRTY4MzE2NjNFNDNBQkRGQjk5RUNCMTE3MTgxNkU1OEVDMzFEOEQ3QUEwRjU0RDQ5NzA0RkQwNzcxOURBODZBOUQ4MUM2MkQxNEEwOEFBRDFFNDI4OEU1MjAyMjlDMzI1NDJBMTM3RjE5NTA2QTIxQTVCNTk5MjY1MzUyQzU1MTE3RjVEOEE2OUI1OTA1Q0I5RjAzNEEzQTlGNzUzOENGMzA2NTFFMkFFNTYyMUU2QjE1MzY4NTZGN0QwQkU5NEZCNzZGQkRCQzMzQ0FFNTU4MjdCMDE0N0IxMjlEQkQyOUExQzhERjc4MEMwNjlCQkM5QUUzNDNDRTYyOTAxMURFRTFGM0I3ODczREU4NENFRkYzOTc5NDAwMzg1N0Y0MTdENTZBRTFEMDI5QTQ3NTg0NEE3NTcyRjc1RTVGMzA3MjRFIoACRDE3RTQ2QjIzRjI4OUZBMEUyMjY0MUVFQzVEMDczQkM4OUZBQ0I5M0JFMjM5N0NERTRCQkNFN0IwOTUwM0VENUNENEIyMzNGNUY3Qzk1QzIyMTcwMkY2RTVCQUE5NTQ4NjQwRTc4NTRGRDA0OTkyODY3QjdFMDlGOEE2QkNEM0Y2NDIzMDRCNjZDRDQ1QUUwMTlCMjQ0QTE0RUZGRTgwNTZBMUY3QjRGMzQ5NjUwMkJGNzc1NkIwNjQ3RThDREJCN0EyQzI0MURFMzc0NDI4NDIwQUVDNjcyMUI4RjkxOEM4OEVCRjc5RTQ3QzNBODkyOTI0NTc3MkU1RUUyMUZDQiqAAkM4M0U3NTUwQTc5QzA2MzgyMkZBODFCRTRFREJDQjc5QkEzNjVDQ0YxQzExNDgwREZDMUYyNEZGQ0RFRkYyOTk1NDNDRjAyMDA3NzgwQzZBQjQzQjhFREUzRUVDRTUyOUUzQUUwMEZCOTlBQUYyNzM3NDY4QjI2MkI5QTAzNjlCMzBGNTZDNTcyNUQ0NTgzQTUzMDc2OUVGRDI4ODc0QTAyMzREN0NBRDA1MkUxMjUwNjZGMDgwQkFFMUFGOTgxQ0VEOUI4MjUwRDkzQzkwRjM4OTgxQjBFMDkwMzQxNzEzNzJGMjA1Qjg2NUQ0NjQ0NEIyNDJDMTlFQ0MxOUREMEIygARBQjZGNkRCOEI2MUM3NzQ3RUYwMDExQkJBNDZBMThEM0Y5OEE2MTU5MEU0ODgxNUY1OTlCQTQ4NTQyQkEwNzIyQzI3RTlFQUI1NDg4RkU5MDdERDU2NjZBNUIxRUVGQkM1RkU4MjFFRDlERTM3MEIzRkZGRjE5RUUzQjQ0ODBBRTMxMzkwMEQ0RjlCMzJBM0U2MEIxN0JDNTc3MjA5NjA0NzIxMTI0MDc4MjMxQ0I1NEVDMDJGNjRCNTQ2MTAyQ0EzNDQ3RkE2NkJGRDNEMTg2NDQyNUY0OTdCOEJDNzQxOTI3MThGOUMyQTBDNzlFMjk1MDA3NUQxMTcyOUM2MUY3RUNCRkY3M0U2OERBNTlCRDA1ODYxMTQwODA5NzEyMTYxQkJGMUY4NTU0MzFCRjNFRDRFRUMzMTkyQUNCQzNDOTRFRDU5QjMyREZBMzQ2QjQwREI3M0FERDRFNDMyMUNBRTYxMzM0QTMzM0Y4NzMyRjg4RjA4MjEzM0FDODRFRUU3MENDODdEMEFBRTFCMTk0MUFBMTYwQzdGQUY4OTU4OUMzOUE3Rjg3MjdCRTlCQTk3QzQ5OUJFMTI0QjQwMEUyMjdGNjU0M0FCMjczQzgyRDRFQzQ0Q0I4N0YzQkRCMjEyN0FEMEVFQTY3OURFQTUxMjU2QUZFMDkzQTVFQ0FGOTqABDlDQTFBNjhCMEVCN0NCRTg4NkM4N0U1M0RDQzJDRkYyNkU4RkExODg3NDYyNDNBOUQ3NUYzMEZBM0I4RDlBRjIwNTczOERCRjk3QjNEM0YzQ0YzRTgwMjE5REJEM0I5NUY2REI1NUVCRkVCOUVDRUI1M0Y0NjM5NkJERERBMDExOTZCQTVCRUFCQkJEOTQzMUIzQjVCRTdEQ0MwRTdGOTFFRTdEQzYwQUYxQTQ3M0ZGMzEzRjU1NUQ2NzVERjIxMDBCOTIyRjg1QzRCMDY4MjVBRkMxNDkwQzI0MDZGMDRCNjg4QzVCREM4NzE4N0IyQzM4Q0VGQ0RCOEZBMDg3MzQ0Q0QyMTcyNzIyNEMxNENCRTcxNzYyMDdDMUZBNzU4MUY3M0FBMTFFRTk5M0U2NzY4MDEyMDlDOUEzNEU3NTNDMEVGMDQ3QTMyREM1RUVEMEI3MkQ1MjYwQzgyNjk0MTJGMDc0MzhGNTRCMzM1NzQ3NUM4NDlDQjlENEUzQTg1RkZDNjc2RUI0NzhCRDU5ODIzQkY0QjBDM0Q0QUYyOEU5RUQ3NTlERDkwMUExQTQwREU5MzI0RDJDQTVCNDE5MDFCMjlBRDU1MDAzRTlCOEU0QTE3QkQwNUZFNTQzRTRBRjZGODY3MzhBQTZDQzBDRDBENzlDQUE3QTczMDFGRTc5QoACRDE3RTQ2QjIzRjI4OUZBMEUyMjY0MUVFQzVEMDczQkM4OUZBQ0I5M0JFMjM5N0NERTRCQkNFN0IwOTUwM0VENUNENEIyMzNGNUY3Qzk1QzIyMTcwMkY2RTVCQUE5NTQ4NjQwRTc4NTRGRDA0OTkyODY3QjdFMDlGOEE2QkNEM0Y2NDIzMDRCNjZDRDQ1QUUwMTlCMjQ0QTE0RUZGRTgwNTZBMUY3QjRGMzQ5NjUwMkJGNzc1NkIwNjQ3RThDREJCN0EyQzI0MURFMzc0NDI4NDIwQUVDNjcyMUI4RjkxOEM4OEVCRjc5RTQ3QzNBODkyOTI0NTc3MkU1RUUyMUZDQUqAAkM4M0U3NTUwQTc5QzA2MzgyMkZBODFCRTRFREJDQjc5QkEzNjVDQ0YxQzExNDgwREZDMUYyNEZGQ0RFRkYyOTk1NDNDRjAyMDA3NzgwQzZBQjQzQjhFREUzRUVDRTUyOUUzQUUwMEZCOTlBQUYyNzM3NDY4QjI2MkI5QTAzNjlCMzBGNTZDNTcyNUQ0NTgzQTUzMDc2OUVGRDI4ODc0QTAyMzREN0NBRDA1MkUxMjUwNjZGMDgwQkFFMUFGOTgxQ0VEOUI4MjUwRDkzQzkwRjM4OTgxQjBFMDkwMzQxNzEzNzJGMjA1Qjg2NUQ0NjQ0NEIyNDJDMTlFQ0MxOUREMEFSgAI4OUM4NjA5RjM2Q0E0QTQ5RjdBN0FBRjBEQ0Q0N0YwNUZGRkY2ODREMjU3MDJERUZGQ0NGQjdCRDIyRDJDMjRFRjRENjFCMTIyQUY4RkNGNUJCNDgyRjBGNTcyNzAxQ0Y0MzA5MTc4MkJBNkE0QkJEQkUxNjQxRDZEQkZCNDQ5OTdDMkU4NzA5MTg3NDZCMjlFQTNDMUVCMzUzMjdDRkMyNTlBNTk4NDM4RTQ1NzFDRkZBNDc0NkI1NTY1QTA3QUUzRTVFOTRCMDlCODBDRUEzRkQ4NDc3RTQ2OTY4NjM1MzIzMDBDNEMyN0M5MzBCNUNCOEUzQjhBNENGRUFCRjE0WoACNDQ4QjYyMjYyRTE5RTMxNkNGQTEyOTMxRDlDOTRCNkM5QjdCNzkwM0VCQTA3Mzg4RDI3NkJEMUQzMUY2NjE3ODAwRDVGNkM4Qjg1OEIzN0I2MTQ5MDgyQTg3QkRBNkY2NTNFMUNENzYxN0RENUY5NzRCQ0U5NDg2M0FBQkNBNTI0NUVERDZGQUQ0NkUyRTg1M0Y1MEE5OUQwN0FDNjNBQkMzNUQ5NkQzMUIzRjFFMzNGM0Y0N0Q0ODVGMjNBQ0M1ODVDRjczMUI1QjQxQzYzQzJDMzI2RDJBMTRBQUUxOUZFNkM3OTU4NjZERjg1NkMyQUI2RjVDRTRDMTI4MTUxNGKAAjQ3QjVFNjEzMDg1RTU1NTZFQTdFOTZGREU4RkJGNEI2ODlGQjYzNDY5OEIzNjlEREU3RUMxNkJERTY3RDdDODZEODc1MDgyRDM0ODM5OENDNjYyODAwNUYwNDgzOTM3OTIxMDU2MEQyNDI5QTRENkFBOUExOUVDOEFFNzA4OEE1RTdGNDdEQUQ1NDVGRUZCNjJGNzYyNUVERkJEODE4NDMxMDc5RTMwQkE2NTBERTVCRkQyRTI0NTBGMThFQzYwRDNCQ0Q4RjZENDdGMzczRTAyMzJBNEU4REIyMjcyRTM5NjVFQjMyREJDQjMwOUQzNUQ5NjFCRTg5OEVGNzYwQjdqgAI4M0IzMTMyQTc5ODIyMzIxNTM1OTU4OEM3NTEyODAwRDFFQkFFM0NCMzA3MEQ0ODUyOUE4NjdFMjlCRjk5MTIxNTM2NkY5NTc0RjFGNThFRjUyRjI4NkIzQjcyRjNFMzM4RkNDMzM4NTgxQ0Q5MkRDMjg5QTFEREM3RUY0NkM0OEVCMDc5NTVDNTE2NjI5QjUxM0I2QzA1MkNBREMxMEY0NUZFRkU1RDlFOUVFRjQxQzcyRkMwMzcyODI4QkVCNTc2N0NDMEYzNTdERkFDQUI3NUQ0RjQzQjY3Qjg5MzU3MzhDMkE3MDMxRjdEQzBEODIwNkQzNjRCQTBBRjFDN0Y3OoYICoAEQTNEREMzRDExNzcxQTU0NUU5MDQ3OEE1QkNGQ0E2Q0ZEQThDMUI0RjRCNEVCMURGN0JGNjdBNUMxODI0QjQ4NTJCRjVDODk3OTdDQ0QxRDI1MzM0N0Y0MkE1NENGQUZBQTgyNjM4OEMyNEY1MzRBMDRBQUQyMEMxRUI0NTI4MENBNDA1ODczRkNBMzJFQzU0RkVEQTJGRkY3QkIxMzQwNEM2MDU5RUVFOTk1QzEwN0Y5REMzQUY4NzE4MjcxN0I5QUUyQzlEMTBDNThCRUY2MTE3QkJDMDBEMzg1RjVERjJFMjUxOTYzNjE5QTBDNTUwNTUzNDUxQTY0MENBNDU1MUI4OTU0OEZGN0IzM0QxREJBNTQ5RDMyRjY0QjFCNTdFQUNDREI1OEFEQUM3NDhDOEEwMzg3OTFCREU5MEVFNTdGNDUwMEM5OENERjNFM0M2RjMxQTAyQTAxOEYwRkQ4NjMwQjBGQkUxNjcwQkQ0Rjg5MjJCMUQwOTc5Q0QyQkY1NUZFODgzNkIzMUNEMzFCNUI5NkYwRjA1QTdERDhDNTIzRkIyRkE4NDU0RENFODdEMzU2MUMyOTc4Q0ZFQzg0MzBDOUFGQUMzNTE4NEI4NDBBRkM2OTlBMjU4Q0NDRUQ1MUVDNjIxQ0JEMjBENUNDRTM5RTA0NjlDMjdGQzlDQjkSgARBM0REQzNEMTE3NzFBNTQ1RTkwNDc4QTVCQ0ZDQTZDRkRBOEMxQjRGNEI0RUIxREY3QkY2N0E1QzE4MjRCNDg1MkJGNUM4OTc5N0NDRDFEMjUzMzQ3RjQyQTU0Q0ZBRkFBODI2Mzg4QzI0RjUzNEEwNEFBRDIwQzFFQjQ1MjgwQ0E0MDU4NzNGQ0EzMkVDNTRGRURBMkZGRjdCQjEzNDA0QzYwNTlFRUU5OTVDMTA3RjlEQzNBRjg3MTgyNzE3QjlBRTJDOUQxMEM1OEJFRjYxMTdCQkMwMEQzODVGNURGMkUyNTE5NjM2MTlBMEM1NTA1NTM0NTFBNjQwQ0E0NTUxQjg5NTQ4RkY3QjMzRDFEQkE1NDlEMzJGNjRCMUI1N0VBQ0NEQjU4QURBQzc0OEM4QTAzODc5MUJERTkwRUU1N0Y0NTAwQzk4Q0RGM0UzQzZGMzFBMDJBMDE4RjBGRDg2MzBCMEZCRTE2NzBCRDRGODkyMkIxRDA5NzlDRDJCRjU1RkU4ODM2QjMxQ0QzMUI1Qjk2RjBGMDVBN0REOEM1MjNGQjJGQTg0NTREQ0U4N0QzNTYxQzI5NzhDRkVDODQzMEM5QUZBQzM1MTg0Qjg0MEFGQzY5OUEyNThDQ0NFRDUxRUM2MjFDQkQyMEQ1Q0NFMzlFMDQ2OUMyN0ZDOUNCQUJAQkU2M0FGREE2OUQwN0M3NEVEMjI0NjA3ODMwMDYyQjQ3RTA1RDJBRTI4MUVEQjE1NzhGOUFGQ0FCODlDQ0YyNkqKAQpAODVBQjNCRjZGQzZCNUEwMkMzQTk4NUNCOTBCMzA3M0VENDIyNUQ3MjJFOTMwQUZCMzc3N0REOTQ2Q0JENTREMhJANUQxRUIxQThCNUI3NDc1ODg5QjU4NkI4NEI5MUJENzAxMENGN0E4NkVFMTQ4QjJERUIwNDU2MTRFMkRBREYwRRoEcDI1NlKABEIxNEI3RTdFOUY1NEU1NjI4NzAzRjcyMjUxRkZCMDhERjREN0VFMUEzODIxNzg0NkUzNTMzQjk0QzRDMkIwMUY1RERGMkU4Rjk4NDZCMjQ0QUZGM0IwMkM3RkM2OUE2RDQ1ODczRTgyNDkzQjdGMTlFNDcyMDFBMUFFRDAyNzFFRjFEODEyQjg3QzMyNTI3RDJBRUU1NUFGRjc5Q0NGMDYyMzNFRTE5MDQ1RDQ5RDE1QjU5RkRFMjVGRjhGNTM3NjlBM0I0RTJBMUE3MjRCNUI2MkYzQ0FEMDc3NTI2QjA1RUM5NTVDOUQxOTIyOUM5QTcxOTk1NjY4RTExNkRCN0U1Mzk5QzVCMDFGQzA1MURGMUUxMzJEQzQ2NTVFN0QyQjIyODA0QzY0MjE1NTBEMzQxOUI5NkU4OERBRDAxNkZCQTNGREUxMzFGNzkyMDJBNUU2OTk5NDQxQzIzMzIxMDYxRTc0REQ5MDE0M0E2NzM3Nzg0Q0NFNTExQTA0Q0ZDOEU2NDY4Q0U5QjQwRUMyNTg4NTU4NTM1MjA1NDU2MEI2OTBBOThGM0Y3NTMwNTk5MTdFRkQ4NDQwMDVFRjU0NjI5MjVEMzRCN0QyRTFFQzJCQ0FCQjU4QkUwN0EzMDI0QkQxNDFCNDY3OTY1MkQ5RDcyMzczMTNEMUVFNkZBRDExWoACNjQ1QTkxRTc0MjA2MjhEMTE4NkI3QkI1RTlENjU1NkNEQzU2MDhDMzY2RjM2NDg4OTAwOEI4MTkyOEJENjI1NjQyMDE4Q0E2NjUyQjcwOUEyOEFFQUQ2Mzg4Rjk4QkRCOTU4RUQwRTk4MERCMkIwNDNCODYxREFERURFQkYwNDJBNDM4MDgzNEJENjI2QjUwRUZBNTdFQzk4NjA5RjYyNDYyNkExQ0ZGMkExRDQ1NERCOTU2RThGMkM4RDIwNzlEQTNEQTE1OTMyNDY4RDU3N0Q3QzlGNkIwQjhDNjFGMzMwQjg5REU1NTJFMjk3ODM2RkIxQ0YwNEU2MkQzRDQ2QmKAAjcxMTE5NzA4RDc2OEQyNDAyMTY3M0FFQjAxQTRGMkIzNzg0RDkzQ0ZDMDJEQzdEQTk3OERENEQwQkVDQjgxRDgzREFCQ0VBQkVDRTIzQTI5MDNEOEI1MUEwQkRFODBFRUM4OERENThBMTZENzdDODY2NEM2RTg2QzY1QUIxRDBERTlCOEZDMUI3ODBEQjFCNkEwNEVERTQ3NEM3MDQ5OENEN0JFQjE2MDEwNkY0RUE5MTg1NDFEMUZDQjNBN0ZGMzhFN0QzNTNCODQ4MDRCRkZBNDNEQzY5OEY0NDQyODE2OEFEQkI1NTYzQjYyQjkwQ0Q2NEUzNjg0QTRFN0NBMkJqgAQwNDMxQkE0NDI3RjY1NzIyRDI4NDdFRDNCNTI5NTkzMjUyMTQyQUVCNzY0NDJFRUUzNDM0Qzg2REVDM0EwNUIxQzYzMTlBMDk2RTI3REUwNzgxQTk0MkU2RjhGRkNBOEJBQUI2QzY2Q0ZFNTAyQzIyNDhCRjFBREYzRkYyOTk5OEM5QzgyMTc4MjZGRDJFMTdENEQ4QzY3MEQxMEI2QTQyNjYxNTcxOEI4QjdCQUExRDA3OTk4M0EyRjhGOTM0RkVDMTMzQUFCNkVBQzQ1Qjk3MjIyREIwMjRDNDFBMzJGMDVBNzU0MDA4QzBEQjFCMjNCM0FBNzVFMzlEM0Y2Q0NFNzE2QzRFMTI2M0EwRjE5NjY0OTE0QzdGNUIzQTIzNzY5MkVDNzA4NUIyNzA2ODgwMkU1MEM0MjAyREFCRUFBRTYyQzZGOTYyNUUyRDcxNEI3MTYyRTVFNDlEQTQ0MzU0M0NGOUNERDUxMzVGODM5NTY2MzJGQkRDMUNDODY5NTMyQjMzMDMxNEJGNjYyRTYzOTI0MEJENjhFNjZGNjRERTAxRjBFRkMzRUE0NDQzOEE4RTBGQjY1QjlBMUZCRkQ2NUFFOUZFMkM4QzIyRUY5MjU5NUYxRjVBMzVCMjYyQkY0MEEwRDVEMUYxMUEzNjBGNjFBMTIxNUNBRTI4NUQ5M3KABDZBQURFRDlENjY1MTk1QkEyRDcxMEU1MkVCODg5OEQ3RDRCQTU5MzVGNEJCMjUxRkRGQzIwMzQ4QzhEMzc1QzY0NUM4NzhCMTE0N0FCQkRBQ0I4MDAzNjg5NEI1NDkyOTQwMTM5OUM5NjU5MjNFQTAzRkQ3QTc4REQ1MTE2RkJBRjE5QUMzMTM0MEIwOTE2QUUyNDI1RDBDQ0U1MUZBQTc3MDlFMjc5REU0RUI1QkY3OTZDOUMyOTc5MUUyMjBCQjlBQ0FBMEE5NkY2QjdDQUJBQzc0QkFDQjU5MTU3REZFRDlEMzQ5MDMzRTA4NzFFMDAxM0QyM0M4Nzk0Qzc1RDFBMjFGQUY2ODIwRDhDNzkyRDg0NUQ5NUI5RDhDNTIwMThGMzExMTRFRjgzRTcxQjNEMTg2RDJBQzgyOTYzQzZCRjQ4MkIyOEI2NDQyOEMwMzEzQjQyRUNCMjdFODYxRDcxRTM0NzJBODk1MDE3Mzg2REVBRDkzRURFMkEzMjk4MDVCODYwRUE4MUQ0QzlBMjIwNTRDOTZGOTY1M0YzNUFBMUI5MUQ2QjZGQjM0RjVEMUQwNDM1ODU4NDREOUFEMUE0N0FBMzMwRkE1OUU5NTgyMzNDNDQ2MDYwM0NDOEI3Q0EwOEVFOUI4RkRCQTc2NzQ5MEE1MDI4ODVDNTI4NjdBeoAENEJFQTc0OTQxREY2QjFFNkJDQjZEOEY0NTY5QzE0REI1QkZFQkQ4RTZEQ0UwMkU2MDVCMTA4QTc3RDQ4MUYyQTI1RkZBMUREREUyRDI5MUY5ODAxNEEyNTAwOEVEREY3ODBGMEJFNTg2MjBBNzhDMDc0QkQxMUQ3Mzk1MDNFNjdGNENDMzI3NzgzNTNFQjcxQjY3REM3NDNDODgzNkFFMjI4MkFCQkJFNkREOEZEMDAwNTZGMDk1RTVENzU3QjU4NzBDRTI5QUVBRjRGNjY0M0E1MkJENkI0OTdDQjAxNUY1NkU1QTczODNGN0E2QjkwQUY5MzQyOUVEMDY2RTVFNTRGMjAwMzgyMEQ5NjI2NDRERjUyRUI3NTJDNUEwRTU5Mjc3RDY1MjE2MjgyQkZFMzkwMDhCRkRBQ0NBNkE3MTY1RUQ4NDE5QUFEMEM4MUU3NzcyQkY3NDQzQjYyOUEwRUYyRkY1RTU3MDQzMzI3Mzk4MEVENjg5RDMyNUE5QUY3QzE2NDVCRTM1REE1MUFGOUExNzA3ODUzMTBFMDA1RkJCRDRFMEQxQTJGQkIxQkY1QjQyRjlBNjlCNjM0QkFFMUVGQTEyOEMyRkJDOEMwOEQ2NTBDRDhEQUU3OERCNTk5OEY1QzI3RkJGMjE5NTVEMUEyODFGOEJDMUY1NjNBN0WCAYAEMEYzMDI3QzIyNjVCOTg0RURDNzQ4OUQ3NDY5QTIyNkM5RTQ5RjU4ODY1NERDQzgwMkRBMURDQzlBQ0I4NEU4NTVFMUQyQ0NFQzFBQzVCOTZGNzMyQUY3Njc2MTQ0NDUyRDQ5QjNCOTQ1RjVEMEUwN0Q3QUE4MTdEQ0RBNjdBQTI2RDE2NDhCNjE0NTc3ODMwNEM3RUE3QTAyMjExMzhERDkxRUE0ODk4Mjc1NzJFRUQzNEIyNkU5RUE3OUU4QTM3NEFBRkU2QUYyMTMyREYwMjRBQTMxOEMxOEVFQTdFQTY3NDJFMjUyNzk0OUI5OUMzNzQ2QjU2MjBFNzQ5RUIxNEQwOUFCNDZGRjgyNzg4QTZENzc0M0JGQkY0MkFCQTUxRDAwNUU4RkNCOEExRkNFM0E2QzYwMDE5MzY0NDUyMjcyRUQ3NkI3MkEwMEE2NUIyQjhDNUI1NkIwMDJEOTVFRTA1NzE4MkVBNTYwMUQwMTg0RENDOTlBNTdGMjYyNTU3NjNBOTFGRTM3QTY5NTY2Q0Q3QUUwRTY5QjAyQzNBRkUyMDA2OTM3MEZDMUQ2QzQyMEE3Q0U0NkYxNjg5REFBMzYxMTM2Q0NDMjA4ODY4MkQzQkM5MjVCOURENzZFNzRDNkVGNzg3QUExMEJBODA3RDM1RTA0QTlFNDMwOEZDQzMyrxUKCmNvX3NpZ25lcjEaAjAxOoYICoAEOUNFRDIxODk4M0Y0RTBFQ0IzNDU5NDI1QjcyRTQwRTNDMjk0NTk4MDQ0Q0JGQjJENDA4MUY1QzE3NjU5NTgxQTU4RjEyNTI1MUI5MTlCRDI4RTM5NDlDNDAwNzg1REY1MUQ0QTI0MDI3NzkwQkFFRURENDJCOUYyMUJGMzExRTE1MkU2QjNCMjg5RDA5NTZEQzM0NzJBNzE5ODAzRjYyRTdFNDcxOTI4MTE3NTU1RTEyQTc0OUQzQjZCRjg1QTczOTNDQjlBNDFGMDFENzgzQTMzMTE4MzUxMEM4MDYzQjJDQTQ5MkQ0RTQzMkE1QTNEOThDQjc2NjU3QTIyREJGRjEwRjRFNTBDNjkwOTBCM0M1MUU3Mzk3M0QwNzgxOUI3NjI0RThFN0FBQkM5RjVGNTY3RTBDNzBEQzVEQThENDM4NUREODhFNDY3QTdFQzU0RjA1NjI0NjZFN0QxMTE0REM0QjIwOTY3NTVBMEY4NzVGOTBCQUEyNkY4QTdBOUU3MEJDNkUwNTYxOTkyNEM3NkI0QTNENzU5MDlGRkFCRUYyMTZCQ0FFQTY3QTMxOEE5QjRCNUU0OTcyMjlCQ0ZBRDA4NzUxNkQ0ODU1Q0IzRTg0QkU0QUM4Q0YyNTI0MDA5NkNBNkQwNkE4NjM4Nzk2QTcwMUY5QzZERDE0MDA0M0QSgAQ5Q0VEMjE4OTgzRjRFMEVDQjM0NTk0MjVCNzJFNDBFM0MyOTQ1OTgwNDRDQkZCMkQ0MDgxRjVDMTc2NTk1ODFBNThGMTI1MjUxQjkxOUJEMjhFMzk0OUM0MDA3ODVERjUxRDRBMjQwMjc3OTBCQUVFREQ0MkI5RjIxQkYzMTFFMTUyRTZCM0IyODlEMDk1NkRDMzQ3MkE3MTk4MDNGNjJFN0U0NzE5MjgxMTc1NTVFMTJBNzQ5RDNCNkJGODVBNzM5M0NCOUE0MUYwMUQ3ODNBMzMxMTgzNTEwQzgwNjNCMkNBNDkyRDRFNDMyQTVBM0Q5OENCNzY2NTdBMjJEQkZGMTBGNEU1MEM2OTA5MEIzQzUxRTczOTczRDA3ODE5Qjc2MjRFOEU3QUFCQzlGNUY1NjdFMEM3MERDNURBOEQ0Mzg1REQ4OEU0NjdBN0VDNTRGMDU2MjQ2NkU3RDExMTREQzRCMjA5Njc1NUEwRjg3NUY5MEJBQTI2RjhBN0E5RTcwQkM2RTA1NjE5OTI0Qzc2QjRBM0Q3NTkwOUZGQUJFRjIxNkJDQUVBNjdBMzE4QTlCNEI1RTQ5NzIyOUJDRkFEMDg3NTE2RDQ4NTVDQjNFODRCRTRBQzhDRjI1MjQwMDk2Q0E2RDA2QTg2Mzg3OTZBNzAxRjlDNkREMTQwMDQzRUqKAQpANDg5QUExNTc5Q0VDNTRCMEYzMzI5RkIzQjhGMERBQTZGMjQ1QzQwMjlGMUY0NTc5OTNBRDU4Q0FEMzAyRjRDOBJANzU1NjJDRjFFRUNGMDk5ODgxRkY3QzY0NTVDODUyRkNFOTMwQzc5QUEyNTk5MEJEOUQyNzI0NDQ4NTZGOTAwNxoEcDI1NlKABDlGQ0JBODY4OThDNUJCOUVDODJFQ0JDMkFENDFCRkY3RjFBNkEwQUU5OTIyNzQ5Q0JCQ0RFNjk0NDQ0RENENkUzQzgzMkNBQzA0OEFGMkYyQ0JEMUVBNjJFRjNCODJDODc2MkM4MUJERTdDOTQ5OTQzMzI0REIzQ0FCQkI5NzM4MkVCOTExMThBRTY0OTMxMEM3NjM3OTQ3MzA0QzcyN0I1ODRBOTE5M0QzQTNGMUEzNzk2MUY1NzI1RDVBRTVDRDUyOTk1RTQxNTAyRkI5MDFGOEI4MzczQzE4MzU0MDE0RTJBMzA5OEQyRUUwQTI4NzQyODQ0OTg4QTQwMDkxNDQ3NEZDMzIyRjREMDMwRDNFREM5Q0I0RTM0Q0E4NEM4NTVCNzBBM0Y2QzNBNEUzM0Y1MDAzQTlDMUY5QzZBNzQwNEY2OEZDMzhBN0E4QTUyRDk1MkM0NTdENkQzRjNFNENEQkMwMjAwOTE1NjlFRjZENzRCODZGMEUzQjI2MUY2NDkyRUQ5NThFNDFBMDZCRUUwRjc3MThBQUY5MzE3REJBNzYyQzEzMzNEMzlBQzFDRDEwQTQ5Qzc3M0VCQzU4RjFBQzI3RDRFMDhFMzg4QjJBNzc0MDdCRTNFQjM2OTJBRTFENjRCMjk1NUQxOEU3OEQxNzRGQTkzNjBCQTc3NkI5aoAENjk5N0RGRUVCNjEyQUJFQTQyRTUyNUY4MEYyNzNEM0M5MUU4NkUyNDYwQjE2MzAwQkNFODlDNDA4MUEzODIwM0RBQzYwNDEzRUJFNUIyODIxRTYyMzQ3OERFMTdDNzFGMDY2MTE0MTY4Nzc5RUJDMTNBMkQ1REYxMkJBOTI5NEJFMDFEQjhCQTJERTZFQzQyQTM4OEQ4MUFENUVDMjY0ODkzNkEyMzE1QUNDNzVFRUQ3RkFBMEI3ODFGNTQ4RjA0NTREQ0U0RDg3OURCRTU0MjI2RDc4QjQ5RjBBRUZDNzMzRDQyRDdDNzNBNEYzOENERTEwRUM1Rjk5MDcxNUU2QjIyMkZFRjVFNEFEMzdGRDBGMzVCNjY0NjkzRTczNDk2RTAzNjlGMDhCNDdENzU3NDY5NzZCMDZGNUVFREQ3Qjk5MTlDN0E4MTQxQjk1QUQzMEQ1OTdFQkRENkYzQTcxRUU2Q0I2RkFENjQwNjMwMkVBRDk3NTgyMzU5QjY3NzNDMTc3MTZBOUM0OEJCMEVDOEQwMjI2NEYwODU2QUE0QkRDMDc3QjcxQTIyMDJENzExNDY2NzcxMjk5QTUzMzBFQTc4MjY2NDQ0NTBBQjMyMUYyNEIyQzQ2QTM4RkUxRTlCRjU1QURBQkQ1NjhFMjFGNkUwNDFGNTI5RDJBNkRGQ0JygAQzMDY2MUYwQjI4NDVEQzgxRDgxNjc5RTY1RjZGRTlCQkMwRTRGOEJCRENCQkM0Q0FCNUVCRENCODFGNzFENDU2MDg5MUIxQ0Q4MjZCMzBBMTQ2MEU2MEY5MUM5QTlCNDk0NUQ2MDg3QzM0MjA2RDcxODc5QTNFOUU2RjA5MTI2QUZBQjkxNUMwODg5QzFFNkMwQ0NCNTM5NzMyNEQ3QUQ4MEIwMDE1MTAzOTcxQzQyMTAzNzk5OUU5NjJBN0NBRkI4QUJBMTY0MERCREE4MEFFMUJDMEMxMTJEQ0FBRDkzMDhDMUExRThGMUQ2NERFRTI3NEYyNEYzMTMzRDJCMjYzRjMyNzA3OEU3MEI0MTFCQjJENjUwMUJFRDgwNUE1MDU5RjM1NEZGMTIxNTdCRkUwNTEwMUUzMTAxQ0MyNjBEMzJCQjA0NkQ5NTBERTc2NDEyRDIyRUU0RjFDMDk1RUM0NUE3NkRGODIyNEJBNTY4QTVCNjJFQTA1MTdCQzA5OTE3QjJCRDkxRTYzM0NBM0MyMDM5NUI2OEFCMDI4NTNDNEE1RTM4QjU4M0VBODU4NEQ5QzcyQkM2NjM4NEExMDg5QUNDMUExREIzRDg3REQ4RDQ0QzJGNDc4OEQxREZGQTlFREMwM0JCN0M5MDI1OTIyRUJGNkNDMTREQzFBREM1RjKvFQoKY29fc2lnbmVyMxoCMDM6hggKgARDRDFGNTlEQkUwMENGOEQwOTREMjlFMEY3MTUxRTcyRkYzQjEzN0RENTAwMzg3Q0NFOTNGN0VCREY3MkJENzgzOTVFQUI0OTE0RjM2QkZBNDQyRkIwQjI1RTNERTIxNzM3QUIwNTg4QjNFMUU1MDNEQzUwNkQ3QzcwNDYzNzE3MUQyRTM0MzYyRDBFNTQ3RTY5QUUzQ0U1QjJFNTVGN0MyNUI0MkU2RjI4NzRCRUFERjk4NzhERURCNUUxRjE0NEVFNDEyREJFMjVFNDE5MzEzMDIzMzY1QTFDRThCNzc5RTMwN0NEMDZGNTc1NjM2QTNDOEIyNkU5RTMzNDEyRUNERkQ0NjNERjQ4MDVENzEzN0IyMjlCODBCRUI0ODlGQjE2MkNDRDMyMTMxQ0IwQTlCQjUxRkVDOEExOUMwMTVCMUZCRjIzODUxRkUxN0YxMzAyODUxQTVERDQ3QzZBQkQzN0I0MEIwQTAxRDQ0QTBCRkVFNTM4MDYxNTM1MUFDQ0YxNzQyRjYyM0M3Rjk4MUQ5NTAyQzk0Nzg0ODQxQkNCNzM1RUU0RTAyMzA2QTE1NkIwOTM4RDdFOURCOTNDMDJGOTA2N0MxNDhGOUJGQjhDNDgzQkMzRTM2QTlGMEFFMUNENzE3MUY4M0M1Qjk4MzdEOTg4OEM5QjVDQkJGN0FCMRKABENEMUY1OURCRTAwQ0Y4RDA5NEQyOUUwRjcxNTFFNzJGRjNCMTM3REQ1MDAzODdDQ0U5M0Y3RUJERjcyQkQ3ODM5NUVBQjQ5MTRGMzZCRkE0NDJGQjBCMjVFM0RFMjE3MzdBQjA1ODhCM0UxRTUwM0RDNTA2RDdDNzA0NjM3MTcxRDJFMzQzNjJEMEU1NDdFNjlBRTNDRTVCMkU1NUY3QzI1QjQyRTZGMjg3NEJFQURGOTg3OERFREI1RTFGMTQ0RUU0MTJEQkUyNUU0MTkzMTMwMjMzNjVBMUNFOEI3NzlFMzA3Q0QwNkY1NzU2MzZBM0M4QjI2RTlFMzM0MTJFQ0RGRDQ2M0RGNDgwNUQ3MTM3QjIyOUI4MEJFQjQ4OUZCMTYyQ0NEMzIxMzFDQjBBOUJCNTFGRUM4QTE5QzAxNUIxRkJGMjM4NTFGRTE3RjEzMDI4NTFBNURENDdDNkFCRDM3QjQwQjBBMDFENDRBMEJGRUU1MzgwNjE1MzUxQUNDRjE3NDJGNjIzQzdGOTgxRDk1MDJDOTQ3ODQ4NDFCQ0I3MzVFRTRFMDIzMDZBMTU2QjA5MzhEN0U5REI5M0MwMkY5MDY3QzE0OEY5QkZCOEM0ODNCQzNFMzZBOUYwQUUxQ0Q3MTcxRjgzQzVCOTgzN0Q5ODg4QzlCNUNCQkY3QUIySooBCkA5RTg5OTkyMzFFMzAxNjhFM0UxNkIxMDlGMzJBRjNDMTAxNDc1OEFFRkFFNEZFQTJENkE4QTFCN0VFQ0MzNzk2EkA1ODZBMzZCREJBQzg3MUEzRkRDN0U2OTU0NzIzQTgxQ0JDMzQzMERGQUQ0N0NDOTFBQjVDRUE2QTA4QjREQUIwGgRwMjU2UoAEREQ5QkJDMEExRDA5NEUxOTVBODAwNEMyRjk1MEFEODMyRjUzOTAyMUNGQkY5RkZFMjI0QkUyNkUzQURBNUVGQzVDOEQ5MDAwMEMyMTE5OUFBMUU4MzZDOUI2NjM2MDcwMjcwMEM4MzQyMUI5OThDQTE1NzEwNzFBRDc0Njk4QjJBMDY2MjhBNzg2QzU0QkY2Njg5NTVDRTE2MEJFMUM3NUQ0ODk4OEZGM0JGQjkwQjEyRUYwQzZBMzY5QzJEN0M4MzA4RDdGQzc1MzlEQ0JENTVGMDNGNThDRTAzOUYwRDQ5ODlDRUYyNEMzRTYzRTQxRTU3NEY2ODY1QTU2MDMwNzdBMTE5ODNCODIwNjdDOUEwQzc0RkRERDczMDlGNDEyM0U1NkQxQzRFN0NFMTQxODYwN0ZBRTdCOTU0OEQ2MjkwMzRFODNCQUUyRDY3RTcyOUM0RkRERkQyNTJFRDVDRUE2QkNEMDBBMzlDQkVFMTNCODJEODkxQ0U4Mjk3QzRCQUI2OEE5NjA0M0MwOEZGRTI0MjQwQTYwOTFBMkNFMjk4ODI0QUREQzA3RDMyMDkyRUYzQUMwRUVDQjlEQ0RCQTY2QzVEMDRDQUMzNEQyQTVBMTBGRkJERTBBQjgxM0IxMDNDQzJBNDU1Rjc2QUZEMkZFQzYxRjcyNzJGM0U4RERqgAQ2MDYzQUMzQTQwREYxNDNDNTVDQzBFOUYxMEQzRDJCMTU0OEQ3RDcyODlDQzcwNDIyMzhERDZBM0FEMDZCMUU5NkJCOTk0NjI0NjI5MzA4RUVEMDI1NTBCMzk2RkZGNTFERDRCQjM2REQxNUI2QzM3RkU0NjM0QzI1ODk3N0E1M0JFMTE1RTlDM0ZFQTZCMDZFMzZGNzM4MkEyMTg2MDQzOUE3QTJBNTg5ODAzQkU0RjZEODNCQzBBRUQ5QzAxQzRCMjJFQUVDMEY5REE0ODI2RTEyQTAyNkU3N0E0MDAxMTc5RTIyM0E3RUZGMDc4QUQ2OEEyQ0JGQzM3RUEwMzQ4QjYyQ0M1OTlERUEzMUE0NjhDQzg2OTkxMTlGNUU2Rjc2MUUyRkM3MkREMzlGM0Q4QUI3OUI2NjU2M0RBQjNENDJFREFFRDEwMUI5QUJGNDMxOUU3MzVFRUQ3NTA3OTcwQ0ZCQjM3MTZFOTQ3MUZGNDRDRUFEQzc1RUQxMDgzNkI1REM4MDRCRERGMEYwQjNERjIxNEI4QjQ5MjgwQ0M3MTg0OUU1Q0QwQjFENDU4MzQxMkQxOTMxNUNGRTMzMzdDN0QyMDMxMUJCOUVCMzk5ODIxMTNGNEMyODk2QjY1NkI0MjFFRjk3QzlDNTQxNEY0MkYxODdFQ0IxRDE0OUU0OXKABDM0MDMzNzVGOTZERjRFRDQxRTUwMURGOTUzN0YxQzNCODY3OTI0QkMxQ0NDQjlFQzFEOUUwQTcyRDY1NUM2OUI0MUU2Q0JGRDVBRUVCMTNGMkNCQUJDMjg0RjEyMTEwNEYwQ0QxODBDOTBCQkE2QkI1OTdCRjNFODZDREYyQ0U1NjQwMTEwQTg4QkU3MkE0OUY1NzhCMTkwOEE1M0NDNDQyMTAyMUEyMzg0RTcxNTY5MUE5RjA3Mzc4MUY1RkZBQ0YwMDlFNTNDMkQwRUEwMThGQUY5NzQ1OTU2MzQyNjc0OUE3ODI4OUMwMzA3NDcxMDIyMUE5QjJBNDQwRTQ3MUU3RjM0ODMwNjcxREExNjNDNzdCMDE2NDdDMDJBQjMwRTUwMzkyNjMwNjExRDVBMTExQkFBMzZFMzkxMjBFREJCRDBBQ0VBMTEwRUQ2MEE1RkU0MjE4QzdCQUJFREU2MUEzQkNEMDkxQ0NFQjRENjY5OUM1RUIyOUVBRkVCMDEzQUE3Njc0M0U1RUM2RjUyOTQ0MzFBQ0U0ODJGMzc0RkM0QzcyN0VGNkM3Rjg5MzY3ODI4RDNCMzIyQzI4NzM3REQxQTM4RjBENjZBQ0I4REZFNDE2RDFGN0QyODg3RTNBQUE3NEExQkVDQ0QzOTJGRkQ1MURBNENCMDlDNzgyNjFGOooBCkBDREEzQTczQkRCQjY2OTgyNzNFQjBDM0JDNDBEMUI1NEYzOUE4RDczMjJGOUNFNkY4ODVCRTY0Mjk3RUQ0MkM0EkA1MzcxQjRCMUY3OTlFNzA3MUYxOTAxNUI3Q0YzRkE1OTkyQTNCRTk3RDAwMUQzNEY2MTE1RTJGQTU4NjZBMjYzGgRwMjU2",
+                    "Cgt3b3Jrc3BhY2VfMBADGAMqqEYKCmNvX3NpZ25lcjMaAjAzMqckCoAEQ0QxRjU5REJFMDBDRjhEMDk0RDI5RTBGNzE1MUU3MkZGM0IxMzdERDUwMDM4N0NDRTkzRjdFQkRGNzJCRDc4Mzk1RUFCNDkxNEYzNkJGQTQ0MkZCMEIyNUUzREUyMTczN0FCMDU4OEIzRTFFNTAzREM1MDZEN0M3MDQ2MzcxNzFEMkUzNDM2MkQwRTU0N0U2OUFFM0NFNUIyRTU1RjdDMjVCNDJFNkYyODc0QkVBREY5ODc4REVEQjVFMUYxNDRFRTQxMkRCRTI1RTQxOTMxMzAyMzM2NUExQ0U4Qjc3OUUzMDdDRDA2RjU3NTYzNkEzQzhCMjZFOUUzMzQxMkVDREZENDYzREY0ODA1RDcxMzdCMjI5QjgwQkVCNDg5RkIxNjJDQ0QzMjEzMUNCMEE5QkI1MUZFQzhBMTlDMDE1QjFGQkYyMzg1MUZFMTdGMTMwMjg1MUE1REQ0N0M2QUJEMzdCNDBCMEEwMUQ0NEEwQkZFRTUzODA2MTUzNTFBQ0NGMTc0MkY2MjNDN0Y5ODFEOTUwMkM5NDc4NDg0MUJDQjczNUVFNEUwMjMwNkExNTZCMDkzOEQ3RTlEQjkzQzAyRjkwNjdDMTQ4RjlCRkI4QzQ4M0JDM0UzNkE5RjBBRTFDRDcxNzFGODNDNUI5ODM3RDk4ODhDOUI1Q0JCRjdBQjESgARDRDFGNTlEQkUwMENGOEQwOTREMjlFMEY3MTUxRTcyRkYzQjEzN0RENTAwMzg3Q0NFOTNGN0VCREY3MkJENzgzOTVFQUI0OTE0RjM2QkZBNDQyRkIwQjI1RTNERTIxNzM3QUIwNTg4QjNFMUU1MDNEQzUwNkQ3QzcwNDYzNzE3MUQyRTM0MzYyRDBFNTQ3RTY5QUUzQ0U1QjJFNTVGN0MyNUI0MkU2RjI4NzRCRUFERjk4NzhERURCNUUxRjE0NEVFNDEyREJFMjVFNDE5MzEzMDIzMzY1QTFDRThCNzc5RTMwN0NEMDZGNTc1NjM2QTNDOEIyNkU5RTMzNDEyRUNDMzEwODAyRkU4QkM2NTYxNTQ0NDE1RDQ5RTNFRjQxOURCNTYwOEQ2QzIyOEIzM0RDQkFGNDFDREY1QThCMDdCQkM5OUZDM0MxM0VDOTIxNjFGMjNDREM1Q0JGMTc2OUM4QjI0NkZCNTJCQjY3RjJFNjlFNEU0QjQ3RDExRUQ0QTczN0ZBNEVENTA2QkI4OTA3QjIxQjg1OUY0MzI0OTY4OUNEQUI0REExOTc1MDFBNUZCQjYzNEI5MjA4RjM5RTc2Mzk2REExOTMyNDM0RjlGRTJBQjVFNzkwRUQ1RDE3QUQ1M0U3RjZCRjNGQ0IwNzNFRUM3MzY1Nzk3OTRCOTkyNBqABDgyQzFDMjkyODYzRjhFREU0NUEwRTY2QzVCNzAzMEFEQTA0MjMzRDJCNUY5MDIwRjQ0MTc4RTg2QkMzNDMwRERFQjlDNDc3RUNFMTdFMkJGQzVBQzBBMTI3MjI3QTMwNkRGRUUzOTM1MTUyMzBCOTIwQjg4RUM5MjVEOTgzQkY4Rjk3OUZDMjVCNTVGMzJCMzQ2ODZBQUFCMjM0ODNGQzM2RUZEODc3REIxNDg5RTNCNUI0MzA4OUI2MENENzY3QkUzMzY1MzlFRTdBQUIwMzJFRjhFQTIxOTQxNTdBNkNCNDI5MDU5QkFCODI3NjkyRjZDQjJCOTQ0QTY4OTU3OUQyNzJGNTgxQkJDQzMyNzJFMDAzQUYyQTM3MkE0OTM4MDlBOUU4OEI3NzY1NzI5REM5NDkwRkIwQUQ4NEZBRUVBMkM2MTA3OTUxRTIxRjcyRTk1NzNGQzhBMTFDOUFBQzQxMjIwOEY0NjdFMzI4MjYyRTc0QzkyMTQ0NUI4RUU1Mjk1NTFFNTMzQzAxNTYzQUVBQUIwQzE1NUQ0MDI3QTAyRDU2Njk4REQ3MDk5NDFGQjUzNjk0MkREQjBFRjI1QzlEQTE3MUZBQUQ3M0I1NzdGMDFGRjcxNUI0RjJCMUU0MjEyMEFFODU5Rjg1RUFEREE1OUQyMkZEOTRGNzMwRkQ0IoACRkIzNERBQkJFRkZEOTRCMjg2QjA0MzI3Q0EwRkE2NjIzM0YyNUM1NEEzNUYyQjJBQTNERjcxMjhFRkVFN0U1N0I5RDI2MUIyM0M3NDhGRUZDMjVBQUVDNDc5NzEzQTEyRERBMzA4QUY3RDMzMzM5NDdDQjczQTFDMUYwQjI1M0NDRjM2OThEQjA5RUI3QzE3MzU1NzkxRDhFMzEyRDgxRTBCRjRCQzM5MERDOEJERUIzNjY1M0U2ODEyRTVDMUZBNzFGMDEyM0M0QTI0MTQ3QUU3NERGNkEzMDc1RENDRDYzODVGMzQwQTdFNjIxQUQyNjhENkFGRTQyRTlEMzU0NyqAAkQxMDk2MDNBMDQ5OTg2NkZFNzM4MTc5QTNENDlCN0IxNzk3OUU5NjA2QkUwQUI5NDU2NEM1RTgxQ0Y0NjhGOUU3ODgwMTJERTgyREEzRkRFNzNCQTFBQkMwRjNFMDdGN0VCNTZBQzlERTRBOTdBNDREMzRERkFGRDYzMjdCMkVCMTAxMjBFNzNCNzUyN0NCQTY4Qjk3RDAwMjIwQTRFMEY1QzRFNDQyNzhCNTEzRDIwMTc3MDRERUZCRkJBNUZCRUU1MEEwRDc5OEI2NkFBNEI3MUI4NjAwMkI1MzVDOTk5NEFDRkY0QkEwNzhDNjE2QzQzM0VCNDU4MjNENkFDNDcygARGNjgwQUZENjFGRDk1RjRFREI1NzFDNTRERDAwRTRFODZEOERBRkFGODUyQzNBRUJFMDFCM0JFQTg0MDE2NTRBODE3NTNCRkM4NjcyMENDODQzODUwNEM1NTc4RTgzRkM3RjRFRjUyNUY5NEIxRjI1MTZDMjI1MThGM0FDNTAzNzhERDREQjkxMDlGOTY2ODhDRDRBQThDQTI2OEUxOTkxOUUyNzNENzNCQ0JCNzdERkFDQUQ4OEM0N0QzRTc3Mjc4MDA1QURFRTJBQUI0QUMyNjAxREMzODlGRDk4RTFDMDczMTZEN0REMkY4MDhGMkYzODAyNTdBNTFCRERFQzRDREY5MDYwNEFDMzBBQTNBM0UyRjI3NzE3NDY1OUQxODZBQjU5MTk2N0UxQTkzMDFBNDcxQjc1QkZCQThFNzZCQTYzMTExNzdCMzc0RkZFOUE3QTU0RjkwREQ3QkI4QjVFREI5MzdCODE0RDU4QUIzODVGNDZDOTE3REQ1MEJERDg0MTQzRTEwQzNDRDM5MURDNjBEOEMwMDkxNzg2MzBCODEyQ0Q4RjE3MDczQjEyRjIxRTg1MTQ1MjFDODVBQkM3MjREQTAyRjVBM0ZEM0I1NzUxRTA4NkE2ODY2OTBGMzMyQzE3ODEyMzA3NTE0MUI4QzIwRUQ4MjdFODJDNzlCMTqABEFBQjA0Rjc2QTNDMjkwRTc2NUUxRDhERkNGOUU4NUJCRDY3N0I3RDA3MzlGODY1ODQ5QkI1MkI2N0JFOEYxQkVGQTcxQTI3NzM5ODY3RkIwNjk2NTlDOEQ3NDgwRDVDREIwMjRGNUVEMTNENDdEQkFDQTk4RkQ2RkNFMTg1NUQyOUNDNTc1NjU1MjVBNzM5NEY2RUQxRDAyODMyNjkyMTREQzc2MDMzNzRCM0JFQTRGRTQ3QjRBMkRFQjU4NkNDRUU5QjE3RjVGREVFNDFFNjZFQzAxMjk5Qjg0NkJENDlFNTM1NzM1OEQ4MEY2MzFCQjdEMzlGMkU0RTMyMDBFRjE3RENDQjA3NkUxRTE3MTQ1REUyMDZDMDE3MTNGMjQ5QUJEMTFFNjc1RjdCOUJDNzRFQkUxNjFGMTI1OUQyNzVGMzU2NDE0QjdEMUU0OTMxOUZEQUNGOEE1QjFBRkZDOTlDMEQ4NTRFNjkwQ0FCQUMwODc1RTM5RTdFRjgyQkVFRDQ3OTZFNTE2QjVBQ0ExRjQ0QzA3RTlDN0Y5RjczQzcyNDQxOTAwRDNERTJGRkI0ODBDNzdCNjQ5OUMxRTgxQjJDMDE0NjI3RkMxOUFBRDcwQzFENDNDQjgyNUQ5QzMzNzU4QzU3NkFEMzdENkY0Q0YyNzQyQUZFRkU0QTM3QkIxQoACRkIzNERBQkJFRkZEOTRCMjg2QjA0MzI3Q0EwRkE2NjIzM0YyNUM1NEEzNUYyQjJBQTNERjcxMjhFRkVFN0U1N0I5RDI2MUIyM0M3NDhGRUZDMjVBQUVDNDc5NzEzQTEyRERBMzA4QUY3RDMzMzM5NDdDQjczQTFDMUYwQjI1M0NDRjM2OThEQjA5RUI3QzE3MzU1NzkxRDhFMzEyRDgxRTBCRjRCQzM5MERDOEJERUIzNjY1M0U2ODEyRTVDMUZBNzFGMDEyM0M0QTI0MTQ3QUU3NERGNkEzMDc1RENDRDYzODVGMzQwQTdFNjIxQUQyNjhENkFGRTQyRTlEMzU0NkqAAkQxMDk2MDNBMDQ5OTg2NkZFNzM4MTc5QTNENDlCN0IxNzk3OUU5NjA2QkUwQUI5NDU2NEM1RTgxQ0Y0NjhGOUU3ODgwMTJERTgyREEzRkRFNzNCQTFBQkMwRjNFMDdGN0VCNTZBQzlERTRBOTdBNDREMzRERkFGRDYzMjdCMkVCMTAxMjBFNzNCNzUyN0NCQTY4Qjk3RDAwMjIwQTRFMEY1QzRFNDQyNzhCNTEzRDIwMTc3MDRERUZCRkJBNUZCRUU1MEEwRDc5OEI2NkFBNEI3MUI4NjAwMkI1MzVDOTk5NEFDRkY0QkEwNzhDNjE2QzQzM0VCNDU4MjNENkFDNDZSgAJDNDMxMjRBNDIzNUU0NUVERTU3NzVGMjE5NUFEOEM2Qzk0Q0JFNTcwQ0ZBMDUwMDAzMENGMkQ3M0EyREM5NDc1NTBEMzgxM0REMTUxRTFBNEY1MkYwRTMzMEEyODVFQkM4REQ3QTc4ODNDRjU3REEwRTcxNkZDNDY0N0UwRjY3QkYyODNGMTEyNjVCRTg5QkUzRDREMkYyMENBRTIxRTEzODE0MzM2NTk3NkMzMUZCNkY0MjhGOURDOEY4NDE4MUI3NjEwRTg2RjEyREYxREZEMUYwQjMwMDAwQzQ1N0JFMTgyMDY0QTdGQTc2MkFDMDhCQUMzMDg2NTc2M0RCRTVDWoACMkRDNzdENDgyQURDODZFODJENjVDOUE2RDYwNTZBMDcxNDRENDg1MjAxQUI3QjAyNTFDMzVDRUFBREVGRUU4QjJCQTZCMzkwMUI0Qjg0NzBBMURENjM0MzlGRTA2NDc0MzM3MEI1NzYwMUY2Q0E1QTdCRTA2RUYxNzhFNDUyMDI4N0E3QzYyM0VDMUYzMzQ4NTVBREE3NkY0MTFENjAyQ0M5NjZCQzNFRDhBODdBMTgwQzdFM0MwNzJCMUI4RjcwMjFDMkYzMjg4NzIyRDc3NjE3RTJBRjYzREE0NzhBMjlBMzhGRjFFN0IwQThBMkZERjFDREIzRDI3NTI1RUQ3NGKAAjM3MDNCNjE3Q0M5RjRFQzRBMTM4RTQwNjM0NjIxOUY1OUYyNjc2RTNEM0JFREIyQTczMTA0M0I1NEQxMUU5RTI2OEZFRTA3NDZCMjJBRTRBQ0QyQkEwOTE2RjQ4REI1NjRGQ0I2MTI3NDAzREI1RjM5NUEwM0RENUQ3MkEyRUMwRENCMkE3QzhBNDJDRjI1OEY4MEE2MkI4MTgzMEJBMEE4QUIxODVERjk3MDU5RTM0NDIzQzQ0OEI4MzYxQTlERUZCREYyOUNEMzc0NEY2N0RDODQyQzZBMkZCMTg1MEY0QjY1OEU5OEFENkZGNkVDOUFFMTNBNzdFQjg1Rjc2RUJqgAJBMzQxRTJGMUQ5QkNGRjg3QjlEMjRERjM2NzQ0NERBQTY1MkNBMTBFNkEzNTMwOTIwNDg5MDE5NzIxNTZBMTEzNENEOTVGNEU2NzhFQkI2REQxRENCNzc4NkY1REEzODNCN0U1RjcyN0UyQjJBRkVBNTc2RDhDMEJFQTQzNjBFODg4NkE0ODRGQ0IzMzQ5NzIxMzBCRDU5MEUwRUNFREUyOTJFNzg3RThCMkE4QzMwODBBRjIxMUU4OTQ5RUQwNEVDMzQ3MUE1MTA0NDNEMkQ1NTlENUIwOUVEQUVFM0Y2RkE3NDAwMkQyNTZFM0JFNkU1MTcxMDA4NUFFQjBCRUQzOoYICoAEQ0QxRjU5REJFMDBDRjhEMDk0RDI5RTBGNzE1MUU3MkZGM0IxMzdERDUwMDM4N0NDRTkzRjdFQkRGNzJCRDc4Mzk1RUFCNDkxNEYzNkJGQTQ0MkZCMEIyNUUzREUyMTczN0FCMDU4OEIzRTFFNTAzREM1MDZEN0M3MDQ2MzcxNzFEMkUzNDM2MkQwRTU0N0U2OUFFM0NFNUIyRTU1RjdDMjVCNDJFNkYyODc0QkVBREY5ODc4REVEQjVFMUYxNDRFRTQxMkRCRTI1RTQxOTMxMzAyMzM2NUExQ0U4Qjc3OUUzMDdDRDA2RjU3NTYzNkEzQzhCMjZFOUUzMzQxMkVDREZENDYzREY0ODA1RDcxMzdCMjI5QjgwQkVCNDg5RkIxNjJDQ0QzMjEzMUNCMEE5QkI1MUZFQzhBMTlDMDE1QjFGQkYyMzg1MUZFMTdGMTMwMjg1MUE1REQ0N0M2QUJEMzdCNDBCMEEwMUQ0NEEwQkZFRTUzODA2MTUzNTFBQ0NGMTc0MkY2MjNDN0Y5ODFEOTUwMkM5NDc4NDg0MUJDQjczNUVFNEUwMjMwNkExNTZCMDkzOEQ3RTlEQjkzQzAyRjkwNjdDMTQ4RjlCRkI4QzQ4M0JDM0UzNkE5RjBBRTFDRDcxNzFGODNDNUI5ODM3RDk4ODhDOUI1Q0JCRjdBQjESgARDRDFGNTlEQkUwMENGOEQwOTREMjlFMEY3MTUxRTcyRkYzQjEzN0RENTAwMzg3Q0NFOTNGN0VCREY3MkJENzgzOTVFQUI0OTE0RjM2QkZBNDQyRkIwQjI1RTNERTIxNzM3QUIwNTg4QjNFMUU1MDNEQzUwNkQ3QzcwNDYzNzE3MUQyRTM0MzYyRDBFNTQ3RTY5QUUzQ0U1QjJFNTVGN0MyNUI0MkU2RjI4NzRCRUFERjk4NzhERURCNUUxRjE0NEVFNDEyREJFMjVFNDE5MzEzMDIzMzY1QTFDRThCNzc5RTMwN0NEMDZGNTc1NjM2QTNDOEIyNkU5RTMzNDEyRUNERkQ0NjNERjQ4MDVENzEzN0IyMjlCODBCRUI0ODlGQjE2MkNDRDMyMTMxQ0IwQTlCQjUxRkVDOEExOUMwMTVCMUZCRjIzODUxRkUxN0YxMzAyODUxQTVERDQ3QzZBQkQzN0I0MEIwQTAxRDQ0QTBCRkVFNTM4MDYxNTM1MUFDQ0YxNzQyRjYyM0M3Rjk4MUQ5NTAyQzk0Nzg0ODQxQkNCNzM1RUU0RTAyMzA2QTE1NkIwOTM4RDdFOURCOTNDMDJGOTA2N0MxNDhGOUJGQjhDNDgzQkMzRTM2QTlGMEFFMUNENzE3MUY4M0M1Qjk4MzdEOTg4OEM5QjVDQkJGN0FCMkJAMTI0MENFNjJGRUM3NURDQTRBRDlFRjBCNTJBMjcxOThFQzg2RUMxNzY2RjZBNjMwRENEQzEzNzY1NTMzQjg2NkqKAQpAOUU4OTk5MjMxRTMwMTY4RTNFMTZCMTA5RjMyQUYzQzEwMTQ3NThBRUZBRTRGRUEyRDZBOEExQjdFRUNDMzc5NhJANTg2QTM2QkRCQUM4NzFBM0ZEQzdFNjk1NDcyM0E4MUNCQzM0MzBERkFENDdDQzkxQUI1Q0VBNkEwOEI0REFCMBoEcDI1NlKABEREOUJCQzBBMUQwOTRFMTk1QTgwMDRDMkY5NTBBRDgzMkY1MzkwMjFDRkJGOUZGRTIyNEJFMjZFM0FEQTVFRkM1QzhEOTAwMDBDMjExOTlBQTFFODM2QzlCNjYzNjA3MDI3MDBDODM0MjFCOTk4Q0ExNTcxMDcxQUQ3NDY5OEIyQTA2NjI4QTc4NkM1NEJGNjY4OTU1Q0UxNjBCRTFDNzVENDg5ODhGRjNCRkI5MEIxMkVGMEM2QTM2OUMyRDdDODMwOEQ3RkM3NTM5RENCRDU1RjAzRjU4Q0UwMzlGMEQ0OTg5Q0VGMjRDM0U2M0U0MUU1NzRGNjg2NUE1NjAzMDc3QTExOTgzQjgyMDY3QzlBMEM3NEZEREQ3MzA5RjQxMjNFNTZEMUM0RTdDRTE0MTg2MDdGQUU3Qjk1NDhENjI5MDM0RTgzQkFFMkQ2N0U3MjlDNEZEREZEMjUyRUQ1Q0VBNkJDRDAwQTM5Q0JFRTEzQjgyRDg5MUNFODI5N0M0QkFCNjhBOTYwNDNDMDhGRkUyNDI0MEE2MDkxQTJDRTI5ODgyNEFEREMwN0QzMjA5MkVGM0FDMEVFQ0I5RENEQkE2NkM1RDA0Q0FDMzREMkE1QTEwRkZCREUwQUI4MTNCMTAzQ0MyQTQ1NUY3NkFGRDJGRUM2MUY3MjcyRjNFOEREWoACNzIwODAxNTc0OTMzQThDM0NCMjg4ODhERTgxODdBNTc2RkY5OUZBRDdBRTg2RDA0QTdEMUJFNjZFQUFDRTM2RDA1RjBCMkEyRDlENkFEQzZENDhERDM3RDlBREEwQjVDQjQ4MjI2OEI5RDZDNTQ2QjVDMTU5MzEzODNBNTBEM0NDMUEzMUFBODhGQTA1OTMwRjFEN0YyMDBCQ0IyM0ZFOTE5RTNCQjUwQjA4MTQ3RjlDRDY4NUExMTVCMUVDNTBDQkUzRjgzN0Y4MUE2RERFQ0RCQUJBQzY5MEQ0Q0JENzBGQTBCRUQxMUM4RUZENjBDM0UyNjY4QjJBRjMyNjI4RGKAAjdDNjBBOTJERUZCNzAzRjY0Nzg3MTlEMTVBMzBCNDY3OTU2NURGNjcxOTlGRTVEMDZDNEM4M0ZFOEU5RDREQjE5OENEMUFCNTRFQzNCMEE3QjZCRDM1OEU1MjFERjVENzlCNkNBNEFCMzFENEVBQjZCMTI3MzgyODMxODdFRDg2MzE5M0VCN0Y3OTFEQzBBNjMxRkUyNUI2ODFBODU5OUYwRTMxRTE3MjM4NUZGQjY0QURDRTI3NjlEM0FGM0U0NDQwRjcwMTI4NUMyMUYwMUE0N0FEQ0IyMzMxQUFFQTE3RUEzRjg5QkNDMTNFOEZBQTg2OTg5NjVDQTE1MTQwQjNqgAQ2MDYzQUMzQTQwREYxNDNDNTVDQzBFOUYxMEQzRDJCMTU0OEQ3RDcyODlDQzcwNDIyMzhERDZBM0FEMDZCMUU5NkJCOTk0NjI0NjI5MzA4RUVEMDI1NTBCMzk2RkZGNTFERDRCQjM2REQxNUI2QzM3RkU0NjM0QzI1ODk3N0E1M0JFMTE1RTlDM0ZFQTZCMDZFMzZGNzM4MkEyMTg2MDQzOUE3QTJBNTg5ODAzQkU0RjZEODNCQzBBRUQ5QzAxQzRCMjJFQUVDMEY5REE0ODI2RTEyQTAyNkU3N0E0MDAxMTc5RTIyM0E3RUZGMDc4QUQ2OEEyQ0JGQzM3RUEwMzQ4QjYyQ0M1OTlERUEzMUE0NjhDQzg2OTkxMTlGNUU2Rjc2MUUyRkM3MkREMzlGM0Q4QUI3OUI2NjU2M0RBQjNENDJFREFFRDEwMUI5QUJGNDMxOUU3MzVFRUQ3NTA3OTcwQ0ZCQjM3MTZFOTQ3MUZGNDRDRUFEQzc1RUQxMDgzNkI1REM4MDRCRERGMEYwQjNERjIxNEI4QjQ5MjgwQ0M3MTg0OUU1Q0QwQjFENDU4MzQxMkQxOTMxNUNGRTMzMzdDN0QyMDMxMUJCOUVCMzk5ODIxMTNGNEMyODk2QjY1NkI0MjFFRjk3QzlDNTQxNEY0MkYxODdFQ0IxRDE0OUU0OXKABDM0MDMzNzVGOTZERjRFRDQxRTUwMURGOTUzN0YxQzNCODY3OTI0QkMxQ0NDQjlFQzFEOUUwQTcyRDY1NUM2OUI0MUU2Q0JGRDVBRUVCMTNGMkNCQUJDMjg0RjEyMTEwNEYwQ0QxODBDOTBCQkE2QkI1OTdCRjNFODZDREYyQ0U1NjQwMTEwQTg4QkU3MkE0OUY1NzhCMTkwOEE1M0NDNDQyMTAyMUEyMzg0RTcxNTY5MUE5RjA3Mzc4MUY1RkZBQ0YwMDlFNTNDMkQwRUEwMThGQUY5NzQ1OTU2MzQyNjc0OUE3ODI4OUMwMzA3NDcxMDIyMUE5QjJBNDQwRTQ3MUU3RjM0ODMwNjcxREExNjNDNzdCMDE2NDdDMDJBQjMwRTUwMzkyNjMwNjExRDVBMTExQkFBMzZFMzkxMjBFREJCRDBBQ0VBMTEwRUQ2MEE1RkU0MjE4QzdCQUJFREU2MUEzQkNEMDkxQ0NFQjRENjY5OUM1RUIyOUVBRkVCMDEzQUE3Njc0M0U1RUM2RjUyOTQ0MzFBQ0U0ODJGMzc0RkM0QzcyN0VGNkM3Rjg5MzY3ODI4RDNCMzIyQzI4NzM3REQxQTM4RjBENjZBQ0I4REZFNDE2RDFGN0QyODg3RTNBQUE3NEExQkVDQ0QzOTJGRkQ1MURBNENCMDlDNzgyNjFGeoAENDNDNjU4NDgyNjg5RjEyMDY2OTg5NDcxQTI4MkI4QjNFRjhENTZDMjFDMzJBQ0U3QjFDMkEwNUY1NkM0MDMxRTM1QUQ2OTk2QkNBNEYyNTYyNjJBOTUzQjNFMDEwNzE4NjhGMDQ0QUM0Nzk5NkQ2OUEwMDE3NUM5NEU4MjczNTY0M0NEREM1MDYxRTg2NTQyQjJBNzU3MDFBRDRDM0Q0MTc5RkM2Q0MxNkQ3MTczQzFBMEJCRDlGRDY4NTQyQ0U3MjlERkZGRkUzNDI5RjgwMTQ2MTNGQjlGRUFCODI1QkQzM0Y3RTIyRkEwMTE4ODFGMkYwOThGMTEzQkJGQjQzRkQ2RDYwOTU3NDYwMThCRUEyNjdFNkQzODkyQTQ1MkJBQzZFQkVFOEUxMTRERjFBMDk1QUQ5QjNENEU2NkMwRTE5Q0NCRjM0NDc0OEE5QkJCMEY5Njk0NDg4QTU5OTY3MTc3RTk5OEQ4OTdBOUJCNUZCRDdCQzFBQzgwNUU3MjBCMEM2NTY5NDVGRkYzMUI4ODMxRDg5RDFBOEFCQ0QwODU4NUE0NzAyNTg3RjA5ODYxMzg3MzAwOUJDOTA2MTVBMUVDRkFCRDc2MTYzMkU3RDMyNjY3MTk2QTIyNUI3NTVFRDlDMUM5MDNGQTZERkYxMzMwMTNFNjNDRjBBQjNGMkGCAYAEMkVEQUU2NEI4OUVGQjc0QzU4MDRERTI5NkY5NTdEMjI2RjQ0OTlBOTVERkI3RjFFNTE3QkJEQkIwOEVDNEM4MEY4QjIxOTc2MjQ2QTg3NTc1MzM5MUI3MUM3MDk0MDdEMjFDQjU1MUZEQUM0NkU1MTM0RjgyNjBFMTZCRjg4MjMxQ0QxM0M1MUM5NEJBOTM3QkVDRjdGNEYzRDEzMkI4OTc0NDRFMzE5QTEyNTk4MEIyN0I2QzRGMzk0RjA4QkVGOEIyNEZFRDRFN0YxODVBOUEyMjFBQURFQTIzOTcxMkM5QUNCQzFBOUQ0N0U0MzNBRThDQjYxRkZFOUIyMTIxNDYzRENGN0U3QkRDMDZGNTRFQjE5RDRDNEFCOTJGMDgzRDIzQjc5MDhFQzg1RDBCMTFBNzUyREU4N0FFNEM2OTJDQTUyQjJGNjk1RDVCQjFFMjVFQ0QzNkJDNDNBMTcyQ0IxNkFBQzk0RDhGMEY4MDY2OTI3Q0MyODFDRjYwQzM4QTY2RDIzQUE3M0I4NDI4MEU2M0E5REQyQjg5MTQ5RTg4NDI2ODcyQjAyRjUzMkFBRTEwNjk2QzA0QjQ2NzA0REM3QjNBNDk4NDA5REUyNkQ4NTU3N0Q1NDdCREE3QkRGREJBM0Q2NDAxRTJCQUM3OUYzRDJCQjY0NzU2RENGMTgyrxUKCmNvX3NpZ25lcjEaAjAxOoYICoAEOUNFRDIxODk4M0Y0RTBFQ0IzNDU5NDI1QjcyRTQwRTNDMjk0NTk4MDQ0Q0JGQjJENDA4MUY1QzE3NjU5NTgxQTU4RjEyNTI1MUI5MTlCRDI4RTM5NDlDNDAwNzg1REY1MUQ0QTI0MDI3NzkwQkFFRURENDJCOUYyMUJGMzExRTE1MkU2QjNCMjg5RDA5NTZEQzM0NzJBNzE5ODAzRjYyRTdFNDcxOTI4MTE3NTU1RTEyQTc0OUQzQjZCRjg1QTczOTNDQjlBNDFGMDFENzgzQTMzMTE4MzUxMEM4MDYzQjJDQTQ5MkQ0RTQzMkE1QTNEOThDQjc2NjU3QTIyREJGRjEwRjRFNTBDNjkwOTBCM0M1MUU3Mzk3M0QwNzgxOUI3NjI0RThFN0FBQkM5RjVGNTY3RTBDNzBEQzVEQThENDM4NUREODhFNDY3QTdFQzU0RjA1NjI0NjZFN0QxMTE0REM0QjIwOTY3NTVBMEY4NzVGOTBCQUEyNkY4QTdBOUU3MEJDNkUwNTYxOTkyNEM3NkI0QTNENzU5MDlGRkFCRUYyMTZCQ0FFQTY3QTMxOEE5QjRCNUU0OTcyMjlCQ0ZBRDA4NzUxNkQ0ODU1Q0IzRTg0QkU0QUM4Q0YyNTI0MDA5NkNBNkQwNkE4NjM4Nzk2QTcwMUY5QzZERDE0MDA0M0QSgAQ5Q0VEMjE4OTgzRjRFMEVDQjM0NTk0MjVCNzJFNDBFM0MyOTQ1OTgwNDRDQkZCMkQ0MDgxRjVDMTc2NTk1ODFBNThGMTI1MjUxQjkxOUJEMjhFMzk0OUM0MDA3ODVERjUxRDRBMjQwMjc3OTBCQUVFREQ0MkI5RjIxQkYzMTFFMTUyRTZCM0IyODlEMDk1NkRDMzQ3MkE3MTk4MDNGNjJFN0U0NzE5MjgxMTc1NTVFMTJBNzQ5RDNCNkJGODVBNzM5M0NCOUE0MUYwMUQ3ODNBMzMxMTgzNTEwQzgwNjNCMkNBNDkyRDRFNDMyQTVBM0Q5OENCNzY2NTdBMjJEQkZGMTBGNEU1MEM2OTA5MEIzQzUxRTczOTczRDA3ODE5Qjc2MjRFOEU3QUFCQzlGNUY1NjdFMEM3MERDNURBOEQ0Mzg1REQ4OEU0NjdBN0VDNTRGMDU2MjQ2NkU3RDExMTREQzRCMjA5Njc1NUEwRjg3NUY5MEJBQTI2RjhBN0E5RTcwQkM2RTA1NjE5OTI0Qzc2QjRBM0Q3NTkwOUZGQUJFRjIxNkJDQUVBNjdBMzE4QTlCNEI1RTQ5NzIyOUJDRkFEMDg3NTE2RDQ4NTVDQjNFODRCRTRBQzhDRjI1MjQwMDk2Q0E2RDA2QTg2Mzg3OTZBNzAxRjlDNkREMTQwMDQzRUqKAQpANDg5QUExNTc5Q0VDNTRCMEYzMzI5RkIzQjhGMERBQTZGMjQ1QzQwMjlGMUY0NTc5OTNBRDU4Q0FEMzAyRjRDOBJANzU1NjJDRjFFRUNGMDk5ODgxRkY3QzY0NTVDODUyRkNFOTMwQzc5QUEyNTk5MEJEOUQyNzI0NDQ4NTZGOTAwNxoEcDI1NlKABDlGQ0JBODY4OThDNUJCOUVDODJFQ0JDMkFENDFCRkY3RjFBNkEwQUU5OTIyNzQ5Q0JCQ0RFNjk0NDQ0RENENkUzQzgzMkNBQzA0OEFGMkYyQ0JEMUVBNjJFRjNCODJDODc2MkM4MUJERTdDOTQ5OTQzMzI0REIzQ0FCQkI5NzM4MkVCOTExMThBRTY0OTMxMEM3NjM3OTQ3MzA0QzcyN0I1ODRBOTE5M0QzQTNGMUEzNzk2MUY1NzI1RDVBRTVDRDUyOTk1RTQxNTAyRkI5MDFGOEI4MzczQzE4MzU0MDE0RTJBMzA5OEQyRUUwQTI4NzQyODQ0OTg4QTQwMDkxNDQ3NEZDMzIyRjREMDMwRDNFREM5Q0I0RTM0Q0E4NEM4NTVCNzBBM0Y2QzNBNEUzM0Y1MDAzQTlDMUY5QzZBNzQwNEY2OEZDMzhBN0E4QTUyRDk1MkM0NTdENkQzRjNFNENEQkMwMjAwOTE1NjlFRjZENzRCODZGMEUzQjI2MUY2NDkyRUQ5NThFNDFBMDZCRUUwRjc3MThBQUY5MzE3REJBNzYyQzEzMzNEMzlBQzFDRDEwQTQ5Qzc3M0VCQzU4RjFBQzI3RDRFMDhFMzg4QjJBNzc0MDdCRTNFQjM2OTJBRTFENjRCMjk1NUQxOEU3OEQxNzRGQTkzNjBCQTc3NkI5aoAENjk5N0RGRUVCNjEyQUJFQTQyRTUyNUY4MEYyNzNEM0M5MUU4NkUyNDYwQjE2MzAwQkNFODlDNDA4MUEzODIwM0RBQzYwNDEzRUJFNUIyODIxRTYyMzQ3OERFMTdDNzFGMDY2MTE0MTY4Nzc5RUJDMTNBMkQ1REYxMkJBOTI5NEJFMDFEQjhCQTJERTZFQzQyQTM4OEQ4MUFENUVDMjY0ODkzNkEyMzE1QUNDNzVFRUQ3RkFBMEI3ODFGNTQ4RjA0NTREQ0U0RDg3OURCRTU0MjI2RDc4QjQ5RjBBRUZDNzMzRDQyRDdDNzNBNEYzOENERTEwRUM1Rjk5MDcxNUU2QjIyMkZFRjVFNEFEMzdGRDBGMzVCNjY0NjkzRTczNDk2RTAzNjlGMDhCNDdENzU3NDY5NzZCMDZGNUVFREQ3Qjk5MTlDN0E4MTQxQjk1QUQzMEQ1OTdFQkRENkYzQTcxRUU2Q0I2RkFENjQwNjMwMkVBRDk3NTgyMzU5QjY3NzNDMTc3MTZBOUM0OEJCMEVDOEQwMjI2NEYwODU2QUE0QkRDMDc3QjcxQTIyMDJENzExNDY2NzcxMjk5QTUzMzBFQTc4MjY2NDQ0NTBBQjMyMUYyNEIyQzQ2QTM4RkUxRTlCRjU1QURBQkQ1NjhFMjFGNkUwNDFGNTI5RDJBNkRGQ0JygAQzMDY2MUYwQjI4NDVEQzgxRDgxNjc5RTY1RjZGRTlCQkMwRTRGOEJCRENCQkM0Q0FCNUVCRENCODFGNzFENDU2MDg5MUIxQ0Q4MjZCMzBBMTQ2MEU2MEY5MUM5QTlCNDk0NUQ2MDg3QzM0MjA2RDcxODc5QTNFOUU2RjA5MTI2QUZBQjkxNUMwODg5QzFFNkMwQ0NCNTM5NzMyNEQ3QUQ4MEIwMDE1MTAzOTcxQzQyMTAzNzk5OUU5NjJBN0NBRkI4QUJBMTY0MERCREE4MEFFMUJDMEMxMTJEQ0FBRDkzMDhDMUExRThGMUQ2NERFRTI3NEYyNEYzMTMzRDJCMjYzRjMyNzA3OEU3MEI0MTFCQjJENjUwMUJFRDgwNUE1MDU5RjM1NEZGMTIxNTdCRkUwNTEwMUUzMTAxQ0MyNjBEMzJCQjA0NkQ5NTBERTc2NDEyRDIyRUU0RjFDMDk1RUM0NUE3NkRGODIyNEJBNTY4QTVCNjJFQTA1MTdCQzA5OTE3QjJCRDkxRTYzM0NBM0MyMDM5NUI2OEFCMDI4NTNDNEE1RTM4QjU4M0VBODU4NEQ5QzcyQkM2NjM4NEExMDg5QUNDMUExREIzRDg3REQ4RDQ0QzJGNDc4OEQxREZGQTlFREMwM0JCN0M5MDI1OTIyRUJGNkNDMTREQzFBREM1RjKvFQoKY29fc2lnbmVyMhoCMDI6hggKgARBM0REQzNEMTE3NzFBNTQ1RTkwNDc4QTVCQ0ZDQTZDRkRBOEMxQjRGNEI0RUIxREY3QkY2N0E1QzE4MjRCNDg1MkJGNUM4OTc5N0NDRDFEMjUzMzQ3RjQyQTU0Q0ZBRkFBODI2Mzg4QzI0RjUzNEEwNEFBRDIwQzFFQjQ1MjgwQ0E0MDU4NzNGQ0EzMkVDNTRGRURBMkZGRjdCQjEzNDA0QzYwNTlFRUU5OTVDMTA3RjlEQzNBRjg3MTgyNzE3QjlBRTJDOUQxMEM1OEJFRjYxMTdCQkMwMEQzODVGNURGMkUyNTE5NjM2MTlBMEM1NTA1NTM0NTFBNjQwQ0E0NTUxQjg5NTQ4RkY3QjMzRDFEQkE1NDlEMzJGNjRCMUI1N0VBQ0NEQjU4QURBQzc0OEM4QTAzODc5MUJERTkwRUU1N0Y0NTAwQzk4Q0RGM0UzQzZGMzFBMDJBMDE4RjBGRDg2MzBCMEZCRTE2NzBCRDRGODkyMkIxRDA5NzlDRDJCRjU1RkU4ODM2QjMxQ0QzMUI1Qjk2RjBGMDVBN0REOEM1MjNGQjJGQTg0NTREQ0U4N0QzNTYxQzI5NzhDRkVDODQzMEM5QUZBQzM1MTg0Qjg0MEFGQzY5OUEyNThDQ0NFRDUxRUM2MjFDQkQyMEQ1Q0NFMzlFMDQ2OUMyN0ZDOUNCORKABEEzRERDM0QxMTc3MUE1NDVFOTA0NzhBNUJDRkNBNkNGREE4QzFCNEY0QjRFQjFERjdCRjY3QTVDMTgyNEI0ODUyQkY1Qzg5Nzk3Q0NEMUQyNTMzNDdGNDJBNTRDRkFGQUE4MjYzODhDMjRGNTM0QTA0QUFEMjBDMUVCNDUyODBDQTQwNTg3M0ZDQTMyRUM1NEZFREEyRkZGN0JCMTM0MDRDNjA1OUVFRTk5NUMxMDdGOURDM0FGODcxODI3MTdCOUFFMkM5RDEwQzU4QkVGNjExN0JCQzAwRDM4NUY1REYyRTI1MTk2MzYxOUEwQzU1MDU1MzQ1MUE2NDBDQTQ1NTFCODk1NDhGRjdCMzNEMURCQTU0OUQzMkY2NEIxQjU3RUFDQ0RCNThBREFDNzQ4QzhBMDM4NzkxQkRFOTBFRTU3RjQ1MDBDOThDREYzRTNDNkYzMUEwMkEwMThGMEZEODYzMEIwRkJFMTY3MEJENEY4OTIyQjFEMDk3OUNEMkJGNTVGRTg4MzZCMzFDRDMxQjVCOTZGMEYwNUE3REQ4QzUyM0ZCMkZBODQ1NERDRTg3RDM1NjFDMjk3OENGRUM4NDMwQzlBRkFDMzUxODRCODQwQUZDNjk5QTI1OENDQ0VENTFFQzYyMUNCRDIwRDVDQ0UzOUUwNDY5QzI3RkM5Q0JBSooBCkA4NUFCM0JGNkZDNkI1QTAyQzNBOTg1Q0I5MEIzMDczRUQ0MjI1RDcyMkU5MzBBRkIzNzc3REQ5NDZDQkQ1NEQyEkA1RDFFQjFBOEI1Qjc0NzU4ODlCNTg2Qjg0QjkxQkQ3MDEwQ0Y3QTg2RUUxNDhCMkRFQjA0NTYxNEUyREFERjBFGgRwMjU2UoAEQjE0QjdFN0U5RjU0RTU2Mjg3MDNGNzIyNTFGRkIwOERGNEQ3RUUxQTM4MjE3ODQ2RTM1MzNCOTRDNEMyQjAxRjVEREYyRThGOTg0NkIyNDRBRkYzQjAyQzdGQzY5QTZENDU4NzNFODI0OTNCN0YxOUU0NzIwMUExQUVEMDI3MUVGMUQ4MTJCODdDMzI1MjdEMkFFRTU1QUZGNzlDQ0YwNjIzM0VFMTkwNDVENDlEMTVCNTlGREUyNUZGOEY1Mzc2OUEzQjRFMkExQTcyNEI1QjYyRjNDQUQwNzc1MjZCMDVFQzk1NUM5RDE5MjI5QzlBNzE5OTU2NjhFMTE2REI3RTUzOTlDNUIwMUZDMDUxREYxRTEzMkRDNDY1NUU3RDJCMjI4MDRDNjQyMTU1MEQzNDE5Qjk2RTg4REFEMDE2RkJBM0ZERTEzMUY3OTIwMkE1RTY5OTk0NDFDMjMzMjEwNjFFNzRERDkwMTQzQTY3Mzc3ODRDQ0U1MTFBMDRDRkM4RTY0NjhDRTlCNDBFQzI1ODg1NTg1MzUyMDU0NTYwQjY5MEE5OEYzRjc1MzA1OTkxN0VGRDg0NDAwNUVGNTQ2MjkyNUQzNEI3RDJFMUVDMkJDQUJCNThCRTA3QTMwMjRCRDE0MUI0Njc5NjUyRDlENzIzNzMxM0QxRUU2RkFEMTFqgAQwNDMxQkE0NDI3RjY1NzIyRDI4NDdFRDNCNTI5NTkzMjUyMTQyQUVCNzY0NDJFRUUzNDM0Qzg2REVDM0EwNUIxQzYzMTlBMDk2RTI3REUwNzgxQTk0MkU2RjhGRkNBOEJBQUI2QzY2Q0ZFNTAyQzIyNDhCRjFBREYzRkYyOTk5OEM5QzgyMTc4MjZGRDJFMTdENEQ4QzY3MEQxMEI2QTQyNjYxNTcxOEI4QjdCQUExRDA3OTk4M0EyRjhGOTM0RkVDMTMzQUFCNkVBQzQ1Qjk3MjIyREIwMjRDNDFBMzJGMDVBNzU0MDA4QzBEQjFCMjNCM0FBNzVFMzlEM0Y2Q0NFNzE2QzRFMTI2M0EwRjE5NjY0OTE0QzdGNUIzQTIzNzY5MkVDNzA4NUIyNzA2ODgwMkU1MEM0MjAyREFCRUFBRTYyQzZGOTYyNUUyRDcxNEI3MTYyRTVFNDlEQTQ0MzU0M0NGOUNERDUxMzVGODM5NTY2MzJGQkRDMUNDODY5NTMyQjMzMDMxNEJGNjYyRTYzOTI0MEJENjhFNjZGNjRERTAxRjBFRkMzRUE0NDQzOEE4RTBGQjY1QjlBMUZCRkQ2NUFFOUZFMkM4QzIyRUY5MjU5NUYxRjVBMzVCMjYyQkY0MEEwRDVEMUYxMUEzNjBGNjFBMTIxNUNBRTI4NUQ5M3KABDZBQURFRDlENjY1MTk1QkEyRDcxMEU1MkVCODg5OEQ3RDRCQTU5MzVGNEJCMjUxRkRGQzIwMzQ4QzhEMzc1QzY0NUM4NzhCMTE0N0FCQkRBQ0I4MDAzNjg5NEI1NDkyOTQwMTM5OUM5NjU5MjNFQTAzRkQ3QTc4REQ1MTE2RkJBRjE5QUMzMTM0MEIwOTE2QUUyNDI1RDBDQ0U1MUZBQTc3MDlFMjc5REU0RUI1QkY3OTZDOUMyOTc5MUUyMjBCQjlBQ0FBMEE5NkY2QjdDQUJBQzc0QkFDQjU5MTU3REZFRDlEMzQ5MDMzRTA4NzFFMDAxM0QyM0M4Nzk0Qzc1RDFBMjFGQUY2ODIwRDhDNzkyRDg0NUQ5NUI5RDhDNTIwMThGMzExMTRFRjgzRTcxQjNEMTg2RDJBQzgyOTYzQzZCRjQ4MkIyOEI2NDQyOEMwMzEzQjQyRUNCMjdFODYxRDcxRTM0NzJBODk1MDE3Mzg2REVBRDkzRURFMkEzMjk4MDVCODYwRUE4MUQ0QzlBMjIwNTRDOTZGOTY1M0YzNUFBMUI5MUQ2QjZGQjM0RjVEMUQwNDM1ODU4NDREOUFEMUE0N0FBMzMwRkE1OUU5NTgyMzNDNDQ2MDYwM0NDOEI3Q0EwOEVFOUI4RkRCQTc2NzQ5MEE1MDI4ODVDNTI4NjdBOooBCkBDREEzQTczQkRCQjY2OTgyNzNFQjBDM0JDNDBEMUI1NEYzOUE4RDczMjJGOUNFNkY4ODVCRTY0Mjk3RUQ0MkM0EkA1MzcxQjRCMUY3OTlFNzA3MUYxOTAxNUI3Q0YzRkE1OTkyQTNCRTk3RDAwMUQzNEY2MTE1RTJGQTU4NjZBMjYzGgRwMjU2"
+            },
+    };
+#ifdef TEST_STARK_CURVE
+    //STARK sign key
+    wallet_key_arr.push_back({
+            "Cgt3b3Jrc3BhY2VfMBADGAMqqUYKCmNvX3NpZ25lcjEaAjAxMqckCoAEQzE1MDA0QzkwOTg5QTY0N0I2NUE0MzM2NTEyNkEwMDdCODNFMjdFM0IzNTJEMDNCNUFGRDg2ODhCNTQ4RUI5MUU4NERGRTRBQjkwMjc4MjQzMTE3OUU4MjQ4M0EwQjNFNUFBRUFBNEYzOTFFMUQyNEMxMEQ0QjNENUU2RDY3Q0I1QTdDNkJDQzU2MEZGM0U2NTY3NDRGRkE4NjY1OEZBRkEzQjM2NzM3ODMwOTQzQzg1QTFDNDNDNjdEMDg2MzZBRjVFMjU1MjU5MzMzQUIzNkFCM0U2MUI1OUVCMzQ0MThENDgyNEJFQjdCMjdBQzMxMDg0QzQ0RUJGQkVERjIzOTAyOTVCQkI2RDREMDM1MUZENkJFNzFFQzlFMDlDQzM3MDJBRjBBQTI3NzY4QTlGMDU2MTgwQ0I3OEQwQkRCRDNFREI4MDNBMjE1REIxRjM3OEE1NkU5NkMxRDMzMzJEMDE5MTM4RDA3N0U1MUJGMjgyQTVGMTgxMTFFMTgwNEY5OUNGQTc5ODdGQzExMzlBRkIwN0NDQjkzNkIxRUJFQjFFODlCRTA4M0I5MzIyMzU4MjhGQ0NBMjQ4NUVGNzdEODMyMjdGRTY1NEY1RDJBRjlFRjNDQjQ5MTc1MTQwNDgxQzBGMzFCQjlFRDNCNThFNTVDM0UwMUEzNzMyNEVENUQSgARDMTUwMDRDOTA5ODlBNjQ3QjY1QTQzMzY1MTI2QTAwN0I4M0UyN0UzQjM1MkQwM0I1QUZEODY4OEI1NDhFQjkxRTg0REZFNEFCOTAyNzgyNDMxMTc5RTgyNDgzQTBCM0U1QUFFQUE0RjM5MUUxRDI0QzEwRDRCM0Q1RTZENjdDQjVBN0M2QkNDNTYwRkYzRTY1Njc0NEZGQTg2NjU4RkFGQTNCMzY3Mzc4MzA5NDNDODVBMUM0M0M2N0QwODYzNkFGNUUyNTUyNTkzMzNBQjM2QUIzRTYxQjU5RUIzNDQxOEQ0ODI0QkVCN0IyN0FDMzEwODRDNDRFQkZCRURGMjM3NDU0Q0U3QUY0MzkwRjIyMzlBRjhEMEE0MjRBRDk4NzZCNDVDRUI5MEIzQzY0Qzc0NTEwMDJEOTg4N0VBRUU0OTJFMjQ2MDZBQjcwMTkyQjFDRTg3MjI0QjM4N0U4RDdDNzk3RUM3MjVDQUY0ODRFQTlBMzRCRTY1NjQyNjc3ODFCQ0MxMzA0RTVDOUI3OTc1QTg5QTk4Q0UwNjc5ODJCNzk5M0RCQTMwMDY5RjFEQ0Q0RTVGRjEzRkIzQThFQUM1NUI0NDZFMTQ0MTIwNzA4Qzg5OEJBNjZBNDU2NTA3Q0M5ODhGNjcyOEZDNTYwNUE1RUFDRkJCNTBBRTE3RURCQxqABDA5QzA4N0RERkFBQjY3RTA3NkY0NkNCMjA3REY4NzYzM0U2RDNGMTg2QTg3RTA2MjE2MDdBRjk1RUE2RTMxNjMwRUUzOURENzk0MTEyQjdCOTI1ODBGMjEyNjc0RkQ0NzZBNzgzRTdFNzMzOEIwODg5Mzc1NEJCMjNEODU0M0FBMjI3OEVEOTE4MTM4NDAwQTJDQ0YwRDI5QzA5NEUyODhEMkUyMTdGNzRDODIzNUYxODY5MjYxQjc3NEE0RjMyODIwOTQ3MzU1RjBGRDMzM0ExMkY0OTk3QUM0MTRBMEFFOEQ2ODc1NTZCRjhERkNBMUIyMjdCRUE4OEU1MUIxNzBGMjUyNzdGN0VDQjNDMEJEMkQwN0U2MkMyMUZBM0MwQzlDNDVBQjJCQzM2QzBDRTFBNzU3ODQzOEYxRTEyMTk1REU4OTYyNDIxOUFGNEJCQjIwODkxMDI5RENBNDYxQkY2MDZBRTM4MUMxOTREMjFCQjZGQzdGQUZEMzBCQ0MxNEVFMjM5MEQ5RUU2OTEyMjJFNkI2QzREOTU5MkNDOTk0RUExRUQ5NEU3QjZFQjE5MjExQTNEMTQyNEFCREFFQjE1M0I2RjhDQkM2RDBBNTgyMTI5QjU5ODJCQUU5RTkzQ0YzOTI0ODY2RkZGMEI1N0RDMDcyQzQwRUM4QUMzMTk0IoACRTdBQzM3NjI2ODgyQjBCOTMzQ0VFMDc5OTlCQTNFQ0M4OTYxNUJCRURFMDc4RjA4QkI4NTYxQjQzODQyRDVDN0M0OERDNTUwMjYwNDhDNkIwNDQ2RjIzQUEzOTUyMUMxRjlDODFEOTdEMzczODE3OTQ5RUYxRjMyOEM1NDU1ODQ4NzkwOTk3QzE2RUI0MEFGQ0JFRjk2RkIwQjRBQjQ5MDcxQ0M3NTdDNjBENzQwQTY2QTc4Q0ZFRjQ2MTJDN0JFMTY2MDE1RjlDNzAwNzk4MEQ0QTZEQkQ5MzFFMjE1OTAyNjJGMkMxQUU4ODk5QUNERUU1MzdCMEYzRURGRTI2MyqAAkQ1OUM5Q0E1MjhCQzkyNDMwN0Y2QzBDRURGQTFGNEYzQzRGMEMzNTJFNTlBQ0U3MzQ5OTI3RDZBQ0NERTE3QzJGQjA1RERFNzM4RDUwMDFBQjc4OEQ0RTY0MTFGODM5MUE1Q0NBODQ5REZFOUI4QzQ0NjNCM0E3OTJEOUQzN0YzNThBOEFGQkQ4ODhBN0Y4QTNCRjI5QkNBNTk1QTg3NjlERDkxQjBENzUxQkJDNEU0NzAyNDA4RjU4QzMzQzU1NEMwODM3QTU3NDczQzQwRUM5MTBBMzI0REZEQ0NFNzI1MDIzNDg4NzYwODVCQjg3MTgzMUFDQjQzODYyRDFEM0YygAREMUE4M0ZDRTEwRDNCOTQ4MEIwNjRCNzYxNURDQUU3ODY0RTU3MUYzNzlDRDg1NEYwRUIxRkI2RUQxQjJEMjUyNTA1QjEwNTQ0RjlGRTg2NzgyQzg5RTA3MThEN0IwNzMyNEQxQzY1NkFGOTYxNjg5NUEzRkZEQTM2QTlCQzZFM0Y0ODdBMjBERkE0MDExRTY4NDE2RTEwRDU3REUzOURENTNDODYxRTQ4RkJDQjNEN0JENjE1OUQwMENCMkQwNUE5QUMzRjNFNDg4RUQyOENBMUJCRDMyQkJDNUZFNTMxNzIyMjE4QTU0NUVDNjlFQ0VBRTM3MDc4NzhBRDZDODkxNTA1MTkzMjkzODZBMDE0Q0JGQzFCREQwMDE1MUZENjg0MDFDMEMyRTAzNEJDRUE3NEUzQUVDQ0YwQzA3QTYwNEQ0Q0NEMUI2RkQxNkM4NUYzQjdBNEU5QjU5NTE4NTI1MEYxNEJGMUFFNzI1OTFERjM5MDk2ODFBRTk3NzJEMTJGNTYwM0YxMDJCOTAxRkJGNzY2M0U2OEFGOTAwQjIzRERDNEUzOEVFN0Y2MEU0Q0QwREFGMUQzQ0Q5RUI3QTM5MkNGMTlFOURCMTZCMzgzRjc5MjExMEMwMzM1MTg0NDk5NzhEREMyOTJDRDg2M0ZFNzE2QURGMEUyNEFDRjI0OTqABEIyM0RGQzdBMUVFRDI1NjkyOEM0MDY0QzUzRDYwRjg4NEQyRUU2RTM3ODRDQTExNDREMUY5MTA2QjAwOUFGN0FCMkQzMzYyODlGOTEzREE0RkE5RTNENDk0MDA2RTgwNUM3QzM4QUE1RjM1RDFEOEJGQTc5OTg0NDdFREIzRDcyOTA3MjgxODAzRUVFQzlFNTcyNjhFRjA5M0Q1RDdBQTU4NURBOTI3QUY5QjA1MDUxNkI0QTE2QzJBMEUwMUIwQjNBMThGOEI1NEY2MkQ1MEYxQTc5NkY5RjJGRjQ3QkQzODZGRjg1NjdDMzQ1RTRDODRBQ0YzN0FCRDg3NEJFNzYwQkZDQTkyNDczQjAyMjc2NjI2MTExRTYwNUM2MkI0NzcxMzhFMkE4MjNCODc2RURGNEM1QjQ5NzI5N0M4QzI5OTdGNEI4QTlFOTZEMjRDRTYwNzA0NTcxNjI3M0E0QTQ5MkRGRUZCQTU5NDFBREQ4REU3Rjg4NUE3NzkyM0JFNjQ2N0ZEODdFMzY1MzI1MTY1MUQyNDJFNkFGOTIwMjhEQ0U4MzczN0RCNEM3MTQ4N0IyOEYzMzk3NDRGMEI2Nzc5MEQ4MzI3QzIyNUUzMTJCODVEODAzQUEwQTM0QkU1QUJEQTMwRDREMEYxNUY3NTE3OTFFN0I4QjNGN0Q1NTgxQoACRTdBQzM3NjI2ODgyQjBCOTMzQ0VFMDc5OTlCQTNFQ0M4OTYxNUJCRURFMDc4RjA4QkI4NTYxQjQzODQyRDVDN0M0OERDNTUwMjYwNDhDNkIwNDQ2RjIzQUEzOTUyMUMxRjlDODFEOTdEMzczODE3OTQ5RUYxRjMyOEM1NDU1ODQ4NzkwOTk3QzE2RUI0MEFGQ0JFRjk2RkIwQjRBQjQ5MDcxQ0M3NTdDNjBENzQwQTY2QTc4Q0ZFRjQ2MTJDN0JFMTY2MDE1RjlDNzAwNzk4MEQ0QTZEQkQ5MzFFMjE1OTAyNjJGMkMxQUU4ODk5QUNERUU1MzdCMEYzRURGRTI2MkqAAkQ1OUM5Q0E1MjhCQzkyNDMwN0Y2QzBDRURGQTFGNEYzQzRGMEMzNTJFNTlBQ0U3MzQ5OTI3RDZBQ0NERTE3QzJGQjA1RERFNzM4RDUwMDFBQjc4OEQ0RTY0MTFGODM5MUE1Q0NBODQ5REZFOUI4QzQ0NjNCM0E3OTJEOUQzN0YzNThBOEFGQkQ4ODhBN0Y4QTNCRjI5QkNBNTk1QTg3NjlERDkxQjBENzUxQkJDNEU0NzAyNDA4RjU4QzMzQzU1NEMwODM3QTU3NDczQzQwRUM5MTBBMzI0REZEQ0NFNzI1MDIzNDg4NzYwODVCQjg3MTgzMUFDQjQzODYyRDFEM0VSgAI0QjczMjZGMDRDOUE0NTNDQjg4NDRCMDk4ODg1NzVEODg2QjQ0MEU5QkQzMjdDOEZFRjM3QUEwMzIwMzk0REI2QkIwMjgxQjlBMTA0QjBGMUU0OTU3RkE3ODVGMjlGNzlEQjRBRUNGMDc0MkZCMzc3NENENDZGRjZGRDAwQUQ4MjA5QTIzOUFDREEwOUM1ODcyRTE0QTAxQ0JBM0U0MjI3NzdFMzIzNjVDRkEwNzRENDUxM0Q0QjIwOTU4RUIxQjcyMzIyMUQ3MjhFM0JCQ0JBMThBMjc4NjRGMDA3QTU0MEZDNDQwQ0I4NUQ4RjZFNTA3MUYwMDlDMDREQUU4MzVCWoACOTAwQjNGODg1RTNDNUU5RTQ4RUFBOThCNDczODY5MzNGMTNGREExNjM4MTg5QkRBQzFGMkExRjQyM0M5MDcxRERBMzY4RTI1RUNFMDAzN0M5RUM2MUMyOTlEQjlGNEVBRkUxMkNDQkVFQjZDQUQyMUFFMjgyRDE5MEU3QThENkM0RjQ5RDc5MzUxODRFMkVDMDA3RTZFRDIwNTNEOUFDMEI4MEE2OUZFNjJCQ0QxN0VEMDA0REFCN0NGQkRCOEQzNzBEODE3RkUzRkUzRUYzRDU4MjU0OUJBNkI0ODUzNjAwQTQ0QkFBNzBFMjlFNzMzRTZGMjI2M0UwNDA1Q0Y1RGKAAjlDMzkxMDcyMUJFODZCN0M3QjRBOTU3MDExMzRDOEY0MDJBRDFBRDUyMEQ1MTI3OENDNERCN0IxMTgwOTg4MTEwOThCNDM5Njg0RkZEQjc5MUZCMTcyOTMxREEyODI0ODFFN0QzMEE3NUY0M0NFMDFGRDFBQUYzQjhGNTNBODAyN0RFRTVGQ0YzQ0UxN0IyODlEREFGNkRFNTEwQzcyNjhGOUU5NTIxNjkxMzZDQkQyMTkzQjg0Q0VCMDg0MTYwNkYzM0RGODg3MzhDNEJDQzZCQzA0NjM3NDQxREE3MDRGMjlFQjFGNjI4QUZBMkM3RDdDNjM3MTRFRjEzMTVGMDhqgAI0NTkxNUQxQ0NBODAzM0E0QkYwQzE3NDM5ODY5OEJCRkQzQjBFOTNDQUQ4MjMyOTg4NzlGREI3NkE5MTUxMEE1MjBDRjRGQzE0QkY0RkM5RTE4QzJCOEJDQTM2NThFQTZBN0I5REI4QUY0N0QwQkEyOTgxMzBENjAxRjIyQUE4NzA5NUVEODJBMzcwNTlDOUUzQjc0MkNGODU0MUNFQ0E5MjU4NzQ2RDhFRUZFRjM2NUEwMUYyRTNEQkM3NjBDODE0RkFCNjI1OTA3NTg1MUFGMzhFNEU4OTM5Mjg0OTNDNEY3RUZDRENFRkEzMUQxM0Q5QzI4QTUwNTgyMjc0REUyOoYICoAEQzE1MDA0QzkwOTg5QTY0N0I2NUE0MzM2NTEyNkEwMDdCODNFMjdFM0IzNTJEMDNCNUFGRDg2ODhCNTQ4RUI5MUU4NERGRTRBQjkwMjc4MjQzMTE3OUU4MjQ4M0EwQjNFNUFBRUFBNEYzOTFFMUQyNEMxMEQ0QjNENUU2RDY3Q0I1QTdDNkJDQzU2MEZGM0U2NTY3NDRGRkE4NjY1OEZBRkEzQjM2NzM3ODMwOTQzQzg1QTFDNDNDNjdEMDg2MzZBRjVFMjU1MjU5MzMzQUIzNkFCM0U2MUI1OUVCMzQ0MThENDgyNEJFQjdCMjdBQzMxMDg0QzQ0RUJGQkVERjIzOTAyOTVCQkI2RDREMDM1MUZENkJFNzFFQzlFMDlDQzM3MDJBRjBBQTI3NzY4QTlGMDU2MTgwQ0I3OEQwQkRCRDNFREI4MDNBMjE1REIxRjM3OEE1NkU5NkMxRDMzMzJEMDE5MTM4RDA3N0U1MUJGMjgyQTVGMTgxMTFFMTgwNEY5OUNGQTc5ODdGQzExMzlBRkIwN0NDQjkzNkIxRUJFQjFFODlCRTA4M0I5MzIyMzU4MjhGQ0NBMjQ4NUVGNzdEODMyMjdGRTY1NEY1RDJBRjlFRjNDQjQ5MTc1MTQwNDgxQzBGMzFCQjlFRDNCNThFNTVDM0UwMUEzNzMyNEVENUQSgARDMTUwMDRDOTA5ODlBNjQ3QjY1QTQzMzY1MTI2QTAwN0I4M0UyN0UzQjM1MkQwM0I1QUZEODY4OEI1NDhFQjkxRTg0REZFNEFCOTAyNzgyNDMxMTc5RTgyNDgzQTBCM0U1QUFFQUE0RjM5MUUxRDI0QzEwRDRCM0Q1RTZENjdDQjVBN0M2QkNDNTYwRkYzRTY1Njc0NEZGQTg2NjU4RkFGQTNCMzY3Mzc4MzA5NDNDODVBMUM0M0M2N0QwODYzNkFGNUUyNTUyNTkzMzNBQjM2QUIzRTYxQjU5RUIzNDQxOEQ0ODI0QkVCN0IyN0FDMzEwODRDNDRFQkZCRURGMjM5MDI5NUJCQjZENEQwMzUxRkQ2QkU3MUVDOUUwOUNDMzcwMkFGMEFBMjc3NjhBOUYwNTYxODBDQjc4RDBCREJEM0VEQjgwM0EyMTVEQjFGMzc4QTU2RTk2QzFEMzMzMkQwMTkxMzhEMDc3RTUxQkYyODJBNUYxODExMUUxODA0Rjk5Q0ZBNzk4N0ZDMTEzOUFGQjA3Q0NCOTM2QjFFQkVCMUU4OUJFMDgzQjkzMjIzNTgyOEZDQ0EyNDg1RUY3N0Q4MzIyN0ZFNjU0RjVEMkFGOUVGM0NCNDkxNzUxNDA0ODFDMEYzMUJCOUVEM0I1OEU1NUMzRTAxQTM3MzI0RUQ1RUJAMDE3M0E2NjgwODE4M0QyN0Y1NEI1QTRFQzU0MUZFRjk5MzQwMDQzRkNFODVGRTM1RkRFODlCMTYzQTcwRDdGM0qLAQpAMDQyMjNCNkU4RUFBMzBCRDAzQjlBNTNDNzFDMUMzNUU0NzM3RDE0NEQ4OEY1RDdCMUM2QzdBRTJGNEQ1QjE2QxJAMDNDM0UwNTUyMUM5RkM2RkM1NzRBOTFEMDMxQTYzRURBNDRFMzc2OTYwMDVEOTM4Q0M0Njk2Mzk5QTI2QjI4QxoFc3RhcmtSgAQ5Nzk1MDU3RjY5MDAwRjUzNTU5OTE5OUM1RjU5NkNBODcwOTMwNEYzQkZBRUQ5MTBENDc2RkRGQkIxQ0EyQ0JFMTk2MTk2OUI1MEEwOTA3NTIxMTkyOTRBOEQyNDA3NTc5OEMyRTg5MDZERjI2REM4NUVFNzI3QkQzNThCRDgzOEVCOEQ2QUYxNjY2MkEyNzg2M0YzRENERTBEMzAxRjU3N0M0RURBRkRBOUVEQzY4MkJGMzcwNzY0OTc3OTYyOUQ3RUI1QUFFQzg2MzFEMzZGMjY4RTQzOTkxRTA0NzZGN0E1RUMyQjU1MjkxNjQ5RDY4NDhFN0ZCN0QwNjUwMDcxMTVCMEY1RkQ3M0I2Mzc2Njc0QTE3RjA5QjNCNDdGQkIyRTExMEFCRUU1Mzc2OURGQzkzMjgyQjc1QkFENDBFNDFDMzg5NTRGOTVEMEUwOTg1RTY3MDA4ODFDNzA4MzMxMzA2RkYwQ0JDOEZFMUQwRTRCMzYwRDNFQzc2N0QyNjNGNDA4NURGREY1QUY5MjEyOUU0RTM2QzdGMDc5ODU2REI4NTUyQjBEM0RFRkNDNzFCMTM5MDAxQkFCMEEwQUM1Q0NGQzVCQjU4RDYxMkNDRUI3NTc5NEZDQTg5QUJGQTU5ODdDMjBFRDVCNUNCNUVDQkNCMDFFQTJBOTVDNjQ4NVqAAjYzQjQ0OUM2MjVGQjg2NzYyNTFCOTE2QkNFMTRDMTIzNTc5MkE1MDA3MkRDQzM4RTM0QUU3NjE3RkE4RUQ0NzZBMzFFQTlFQkQxOTZDM0IxMEZCNDQyQjg2N0Q4RUYxMjgyRjIyN0RDNURFRTg2MUIwRTM4Q0Y3OTUwMjFGNENCRTY3RDlFQ0E3Nzg2RDU4QzFDMERENzkwREZBQUMxQzgwOUJDMjYwRjI5QjREQjA4NDk4Q0Q3QTBCRjIyMEYwOEU2QjBCODVERjFCMTk4QkFBRTFDRjZGOEYxNDhDMkY3NzQ3QkQ2RTAyMzJBMUNFOTQ4NDQ5QkE3NkZCRTMwREJigAI2MTRDRTFBRkE5NTQ0QkM4RkZCNDcxQTRDNEY2QzQ5Mjk5MkU5M0YyQ0U4NThGMTM3NTYzNjkzMkY5RUEzMjg5OEQ0NENDODIwMjY0Qjc0OTNENEM1MEY2MUM1NTkxMjg3MUFBNDBCQzMwNTkyRDY1QzhCNjZGNUE1RDlBRUYyN0U2RTI2REMxNkNDQzFFN0VDNDlCOUEzN0IzNjI3MDg3RUYzQ0YyRUYyNzdDNEZENTA5OEI1MTZBRUJFMjkzMzg3QjA0Rjc1Qjk0OTI4OTBBQTk2QTRFMzQzODdCRTRERUExMzEwNjU3QTA0NzQ5MzBEQTI0QTVENTZGNDE5REQxaoAENzBCRUM4NjI3OTFBOTgzOTkyNDFGREREQkI3MkYzMjQ5NEIzQkRENUFBNzA3NDdFQ0U5MUMzRjdGMjRENkE5RDU2MDE5QTRCMUIxOUYzRUVENDk1OUM5RTVCNTJDQzNFRDcxMDIyRTI2MjcxQTIyMTMwMzM1RkRDQzFGRDU4NEVBNkVFMjc2RTU5RjU1QTdFNEYxRUI2OUFFRUZERDkzMTRCREZFODAxMjhENTIxMkQ1NTg5RDA3NEVEOEQ4RkJEODgxQjNDQkI3QUM0MTI2N0VBNTRCMzU4NzJGNEEyNzczREExMTAwMjk4MjJFQTk5NzZCRDlFQzRBMUUwNjk5MTAxNzY4MEIzQzk4RDA4MkJGQTdGQjcwMzlCOTc5OTRFMkEyNzM5RjBFM0VDNDgwNEI0NTVENUVFMjM3MTFFNjRBMzUzN0VGMTAzQjdEMjdEN0Y3NkFCMUM5MDQ3NzVEQjIyNjAzNjk0QTEzOEI3MjRFMDYxMjdEOUJBREJGNEFGRTU5M0M5OUQxM0M1N0VEOTMwN0UyRjVEREY1MEQ4QTA0MjQxRjIxQjMzMEJBQTg5NkNCRDM1NjE3NkIwNTU4MzFEQTU2OTU3NEM1OTRBMEVDNjI3QzMzNEJGMjNGNzk2REEyODYzMEZEN0NFRDA2MDc4NDQ0QTgyMTU1RUM3N0VygAQ1MTFDRDNEMUNCQTE5REJGRjY2ODk0OUZCNzgyQjcyQTVBRUVFQTYyMzVDMTg5NEJGNUY1M0QyODk3RDE4NjgzMzk1NzFCODgxQ0NCMjNENThCNDJDMDRENzlERTMyRDJBRENDNjZGMEE5QzQxMDkyMkEwMDZCMjAwMUQ4RTU3N0EwMTc5NkJGNkM0RTlBN0E5ODlGOTZEMjgxMUYzNkNCMDA3MTlCOEU2RThDQTg0Q0U4OTI3MkU5NTU0Q0UzQzQ4OUU4QjQ0NTVBQzYyRjcwNEUyMjVGRDcyMEJBRjM2OTNCMTU1QzMxM0NCRkJBMThFNjc5MEQxRUY4QUFEMzkwQTUyODJDRkFGQjc4REY2QUE4NUMxQjNGNTk5RTQyNTE1QjAyRjVEOEE3RTlEMUQ5Mzc2MjVDQUMyMDY3NzE4QjQzQzZDNDZBRjZCMDA0Mzc4MUU5ODQ4Q0FCRTAwNzc4OTNCNUM4OTQ0OUNEOTMyNUE2OTJGRTVFODlFNzEwQ0JEQUQ5NkU4QjZFREI4MkI4NDk1Mjg3ODczQjBCMkUyMzg5RDY3OEQ5NjlDREZCQTNENEIyMEIwRjkwN0VBMDU1MkEwMENGMENBRTcyNkVFN0EzQUE4QUFBMDBDNTYyNjI3Q0QzQjlENkJGN0Y5MzNEMURDQkU2MzMwQTk1MzJCQXqABDUxODRFQUUzNUU1OTkyMEEwODU5MjkzQUZFNEUxQkExODA0MkNEQjNFMjUxMzc5OTlFMEExMEYxMTUwQzFGMjI1MkQ2MzFDQkM5RkFCNkE4MjJFMzU0NjlDQTgyNDZFQ0YzOTg3RUM3QTM0QTc4NjRBMTdBMkU0QzEwRjc5QzM4RTRFRjVDRkM4MERCQ0NCRUIwRUI0NDE2MjI3MzNGMUMwRUY3QjUwMkEyRDY1NEZERTU2QTIyMUQ4QjU4MzRDN0M0QzA1RkFEODQ1NzIxN0M3QUMzNUNCMzdBN0YxRTBFRDZFNzlCNzIwOEVGNEI0OTZFNjgyMDlCMzBEM0M1OTA4M0MzNERGNTIzM0RFMDU0RDdDNDRBMjhFMkQ1MkVDRDQ2NjZGNTRDREZFQTMyMjIzNEJBMTU0QTEyMTdCMzY5REExM0M4RkI4OEZCMUJENDdCODdBQjlCMDNGMERBQUVCREJBNUI2RDI1MzEzOUNBN0M0NkMxRTZEMEFGQTJENzA2MTIyMkUzNUVFNjE0RkQ0OEM4NjUwNUYyRjVFNDM4NEZFODc2N0JGRDY1MzI5QjJCQ0RBN0I0NTYxMTRBODhEMzk1MEUwQjUyMDJFMzE5M0MwNjZCQzM5MEQ1OTAxQ0U3MDFDOTgwQTUwQjU4NTlERjg0RUFBQ0NEMjFFODNGggGABDAzMDc5QzM4RTZGOTZCNUY2MDE4MkFCMzM3ODE3MDE0MDU1QTdBRDI4QURCQ0Y1RkMyM0NDRkRDMzUzQTc1RDRCRkQwMUEzRDk2MTY5NDUyMjI2QjExMDM5MDc1QkM4MjUxREVGNzMxODhFREY0OUUyNTI3MjUyOTdCM0RDQUJGQUE5NkJGNUU0MUIxMTlDNDYyODc3OEM2RjAyQTRDOUUxQzhFMzAwOUE0OUNDQkVFN0I1NjBDNDNFNzdENjMzMzIxNjIwQjQyNUE0MjhDQTA2MjU0NjAwRkFENTVDOEFDMTY3RTVERjk5Rjk4NUEzNzExNjFDM0NFMjFBMENBQjE0QjE3NzMwRDg0MDI2NUNEQkFBRDU2M0NBNEZENkY4NUIyMjgyMkM5MzVERjhFMEZFOTNBNzNFOTk3QjMwMkE3QUExMDIxODBENkU4QTA1QzE4RUMwMEZEN0QyMjhFRERGNjgxMkU2NjFBQzE1MDdGMjMwNUI4RjUxM0M3ODE4RjgwNjA5OUFBRDVDNDc5MUE2NjUyNkZBNDUzNzM4NUNBMTZFNDA3NUNDQTcwMjIyRkVBQkVCRTAyNUE1QzYwRkI0NTRBQUIzMjIxRTdCMEM5Mzc1Nzg1QjM0OEM2QUEwMzQ1Rjc0NjQ0RjYzNEE1MTYyMzlDNzk0NkQwOEFGOEYwMrAVCgpjb19zaWduZXIyGgIwMjqGCAqABEVCNDgxRDY2OUMyRTg2QTFCN0I4NkUzOUIwODBDMDI2Q0M2RDVCMTc2N0FGNzUyQjQxMDg2N0ExMTNFNzE1NkRDOUEyRjE4MkFDMkYyODI3RDA2OTIxQzg2RjFDM0VBNUMyNzY5OERFMTUyOTQ0OTMzN0FEMDUzQkUyMkRBQzY2RTQ2MDNFNERCMkU2MDE0N0M2RThDOTZBNUEyRTk1RDQxMUJDOUQ1OTNGNDlDOTgzRTI0MEMzREY1MTMzMUQwNUY5Mzg1RDc1QTI5MDI1ODM2RUM4NjY1QTRDMDczNEVBQUEzRUU2ODhBQTMxNzQ0RDZFMTAzQkQ0QjkxODMxOTM1NjMwNzY4M0ZGMEQ2NkRBNjkwOTkyMDc0RjdBRTEyN0VGOUM3NEM3Q0QyOEZDRTY2MkFCM0UwNUQwN0E1MTNBODEwRjVCRDM2MzlDQjIyOUJGQzMzRDNENzMwNTI2NjM1MURGOEZDRTZENTFCRjlENzU5RkRENkVCQjQyODcxODA5ODdFRjM4RDFDNUQ2RTAxOTFBMDdBNkQzNEZEMDY4NjUyQjY2NTcxRjJCNzNGRTI0ODBCRjExNjcwQjhFQUY0NEFEOThEQ0ZEMjQzN0M4NTYyNTMxM0E0MDg3M0VDQkU2NDBDOTQzQ0JCOTQ0MTQzN0RCMURBQURCODBEQjE1EoAERUI0ODFENjY5QzJFODZBMUI3Qjg2RTM5QjA4MEMwMjZDQzZENUIxNzY3QUY3NTJCNDEwODY3QTExM0U3MTU2REM5QTJGMTgyQUMyRjI4MjdEMDY5MjFDODZGMUMzRUE1QzI3Njk4REUxNTI5NDQ5MzM3QUQwNTNCRTIyREFDNjZFNDYwM0U0REIyRTYwMTQ3QzZFOEM5NkE1QTJFOTVENDExQkM5RDU5M0Y0OUM5ODNFMjQwQzNERjUxMzMxRDA1RjkzODVENzVBMjkwMjU4MzZFQzg2NjVBNEMwNzM0RUFBQTNFRTY4OEFBMzE3NDRENkUxMDNCRDRCOTE4MzE5MzU2MzA3NjgzRkYwRDY2REE2OTA5OTIwNzRGN0FFMTI3RUY5Qzc0QzdDRDI4RkNFNjYyQUIzRTA1RDA3QTUxM0E4MTBGNUJEMzYzOUNCMjI5QkZDMzNEM0Q3MzA1MjY2MzUxREY4RkNFNkQ1MUJGOUQ3NTlGREQ2RUJCNDI4NzE4MDk4N0VGMzhEMUM1RDZFMDE5MUEwN0E2RDM0RkQwNjg2NTJCNjY1NzFGMkI3M0ZFMjQ4MEJGMTE2NzBCOEVBRjQ0QUQ5OERDRkQyNDM3Qzg1NjI1MzEzQTQwODczRUNCRTY0MEM5NDNDQkI5NDQxNDM3REIxREFBREI4MERCMTZKiwEKQDA1MEY5QkU1MUY1OEI4QkY1OTQyMEU1NUZGRTA1MTAxMUY3RjA4QjRFQkNENjlDQTYxQzRDMERBOEJGRDQzQzkSQDA1NDYzNEE0Qzg3NTI4M0M0QzBDQTNBNEI0NzE2RTA4QTAyREFGMEY5ODAxOEUxRDhCRDcwRTdGMUFBQUE3RTUaBXN0YXJrUoAEQzU5MDJEQkZFODE1NzhDQjBENzkzNzQzQUIzOEQ1OEI4NTFGRjJDQTM1M0JEMzc4QkZCRkI1NTRGQzA0NzIwMjkyQjE5OTVGNkZDNEVDQjI0NEM2QTgwRTI5NTc5NTQwOTAxRURBNjBERTY3RjRFRDM0RjgzOTAxRjFDOThERjFDRTFCNENEQjZFMjQ1MzYxN0M0MzJFRDQ2NjFFRkZGMjAyRUIzNDZBOTgwRTIwODk3NTMyNDU2MzFDNEMzQTgwNUFFQzEyNkU4MjM1NTVDRjRERDEzNjFGMUI1NjU0Mjg2RUE0MEU1RjNBMURFQzQ0NjRCRUU5MzcxQzFEN0UwNDA1RkQyOTE3NzA2QkIyQUIyQkUyMTZENjVFRkFBRTA5RUM4M0MwMTUzNjQwRDE1RTgxODZDMEFFNkUwRUU2QjExMjZCOUQ3QTExRkEwNEY5MDA0MjYxOEFDRDgzQzdCMzM0QzhGNjJGMjgwNTlDRTBEOUNFMzlCRjQwNEU3RjBCMTk5MTBBQUM1MEIxMTgxNzI2NjJBRERDNkZERUYxMkYwRTJGNTE2N0QxREY2REYwOTEwNzg4MDVFOTlGNURBRTE4NUM1NjBCQUY3RTNFRTk5NEYwODY2QkI0MUNERUE4ODBERTYxRTA0Nzk4RDRFQkM5ODcxMUNDQkExQzlGODFqgAQ1QzI4RENEQTgyODJERjM1MjJCQTY5MjUwQUIyMkNFMjlCRjk4OTM5QTRCMDBDM0QwMkFGRUU3MTRCOTkwOTlGMTFCNkY0MTBGQTk4Qzc4NTc2NzJDRjgzQ0Y0NEQ2QzM2RUFFNzNDMkRFM0I5NjQyQjE0NUM1MjA0QkY2MzBBMUQ5QjEwMDVDOTRFMzJBMDVCMzA3RjRENEI5RDFENkI4MkUxMDVFOUYxREUwOTVDQThDRjg0QUVEMjMwRjk1RjQzQjVFNTFEQ0NFQ0E4RDA4NkZDQjQyRTY5NUYyMDBFRTFGRjZBQUY2NDA1NDdFMDlDODg5QzM3RjVDRENGNjM5RUFBQkU4QjQ4RTE3N0Y2NTFBOEI0RTIwMDdDMjcyMTk1NERBN0I3MTg3QUExQUFDQzMzNUVDNzlFRDM3QTJFQjg2N0IyOTNDQjczQjZFMjk5NDM4MUIyQkZBQjlBNUFFODdGQkQ0NTg2RDhGMTk3QjFFRUNFMUM1Q0RCODZFNUNCOTJGNDRENUM4MDcyMEI0ODlEQjUxNzIzNzU3Nzc1Njk4NEVDREVBRUI0QzAxNUM4REY5M0QyREE1MzFBMkYyRDRCRThCNDE4N0YzMTUzNTc2NjYxOTU3QTZCQUVGNjMxRjIxQUYyRDgxMzVDODZGNTFFNjg4RjdBRDFFQUJGNnKABDUyRTQwNTNFNjYzQ0U0QjA1MjVCQkVGNUMzQ0FGNTRBNDY3MTA4NkMzQzczMzdGNTg4NTRCNUVDMzZFQUJCQjA3QTUyN0VEREVBOUUzRkU5ODNFRTIyNTYzNUY1N0Q4RUFDMTg3MDg0MzY1MjEyREFCOEU2NjFEQkVCNDhGMUJDNUY3Q0NBMUEzMDIxMDBCOUNFNDIxN0U3RjhFMDVBOThBNjU1NTNCRkQ0OTI3NEYyQUQwQ0VDMEU0Q0ZDOTMwRDJDQjFEN0M1NUZCQTQ4MDA5NDUwQkIzODY3QkE5OUUyMEE1Qjc5QjFFQUQwQzM4MEQ4MEUwNkVENTQyNkYyRUUxOEUzNkREQTA0RDM2MDk3M0QyQ0U5NzUxRTZGOUZBQUI4NzRBNzQ3Njg5MTdCMTEyQzU5MjI2RTBBRDIwOEVFMzEzMzUzQ0YzRTIxQkUzRTRFNDkwMDhDMzVCOTRGOTkxQUZFODA1OUEyMTMyOTNCMDEwNUY4RjYxNkJDMTgyOThBRkU0MEFBOTI1MEU2MzAzMUQ3MjlFQjA2MDY4OTIzOTE5RkUzMDFEMDVDNzA0NjhCN0RFOTdEOUJENTI1OTdCQTA3QUZCODlCRUIwOTk3NUY2NkNCODA4Rjc0QTBEQzlERkI5NUEyRDlDMjA5NTMzOUE1RTk5RjM4Mjc1M0YyMrAVCgpjb19zaWduZXIzGgIwMzqGCAqABEMwNDI0MDlCMEQ2NzI5QkY4NkJGMzgxRUYyQ0JEMzUzOEE4RDVDN0I2ODc5OEU0RDJFQTE0NjQxRDgyMEFCNzM3MzgzRjE4NDczNTkzMjE2NTkwMEE1OUM4NkY3ODc0RkY0RDMzNTQwNjhDMEMzNUZCNEQ1MkM3OTE2RjZCRTVGN0IzOUE3RkZBOURGQThGOUNCRjAzNDFFMjQ0QUM1QzlFNDM1NDEwRTcyNjM3RTU4OTBFQ0I5MUM1NkUyOUFBMDM0OENGNEE0QTUzNTY5M0QyN0U5OEYwNzJDN0Y5MzE4RjlDRjM4QjBGQzAwQTNFMkQ3MzE0MEUyQzRCNzQ4NjBDRjQxNDM5RUJFQjcyOTRGQkQzNjBDMjZEMjBBMjU5QkU0Q0I5MkU3N0QyNzEyNEEwQ0JEOTFFMTlBQ0Q1RkNENEM5QTI0MTUwMDhERDUwOTE0RjI3MjA0Q0ZCMDREQTZDQTlEMTBCMkRCQTdGRTk1NEZCQkM2REMxNzBGQjY4NTBCRDhCOTYyNDcxNDYzRDUzMUZDRTVEQkY1MUMwQzE5NDg2NUYxOUEyODc2MEZDOTUyMjk5NDA3OTQzMUUzNjgzMDI2NUFBMzc3QjQ3MjJEMTgyMjJGNDY4RDE5QUEzQ0NCNDU1NjYzMjM3NTA2MkU3NjQwMzRGMTg2RDdCNDA5EoAEQzA0MjQwOUIwRDY3MjlCRjg2QkYzODFFRjJDQkQzNTM4QThENUM3QjY4Nzk4RTREMkVBMTQ2NDFEODIwQUI3MzczODNGMTg0NzM1OTMyMTY1OTAwQTU5Qzg2Rjc4NzRGRjREMzM1NDA2OEMwQzM1RkI0RDUyQzc5MTZGNkJFNUY3QjM5QTdGRkE5REZBOEY5Q0JGMDM0MUUyNDRBQzVDOUU0MzU0MTBFNzI2MzdFNTg5MEVDQjkxQzU2RTI5QUEwMzQ4Q0Y0QTRBNTM1NjkzRDI3RTk4RjA3MkM3RjkzMThGOUNGMzhCMEZDMDBBM0UyRDczMTQwRTJDNEI3NDg2MENGNDE0MzlFQkVCNzI5NEZCRDM2MEMyNkQyMEEyNTlCRTRDQjkyRTc3RDI3MTI0QTBDQkQ5MUUxOUFDRDVGQ0Q0QzlBMjQxNTAwOERENTA5MTRGMjcyMDRDRkIwNERBNkNBOUQxMEIyREJBN0ZFOTU0RkJCQzZEQzE3MEZCNjg1MEJEOEI5NjI0NzE0NjNENTMxRkNFNURCRjUxQzBDMTk0ODY1RjE5QTI4NzYwRkM5NTIyOTk0MDc5NDMxRTM2ODMwMjY1QUEzNzdCNDcyMkQxODIyMkY0NjhEMTlBQTNDQ0I0NTU2NjMyMzc1MDYyRTc2NDAzNEYxODZEN0I0MEFKiwEKQDA1RUFBMzdGMjc0OUM5MUJBMjk4M0Q5MTVEMTA2MEE5OUUyNzI2Q0U0OTk4REUwNzVBMDYwMDBDRDJGQ0NFQUQSQDA0RjE4RjU2Q0FCMTI0OTIyNDA4MzkyOUNFQjc2OTU3RjRGM0E3REIwOTNERDAwQjYxQ0Y4OUIxODIxNzczMjkaBXN0YXJrUoAEREQwOEM1NkRFNkJDREM4MERGNTlFRTYyMUExMTI4NzNDQkZGRTk0NUZFQUNGQzBGMTkxNUMxMkZGRkQxRjc0NDZGNkI5RkUxMDU5NTc1N0ZENjNGQjlCMDk2MEJDQTgxMDdCNTk2QkUyMjg0RTVCMUJDM0NENURCRkYzRTg2QkRDNzgwMDQ4ODlEOTEyOTcxODYzNjcxOTk2QTVFNUUyMThDRjNDMjhBQUQyMkU1OEM4MkIzQzQxNzEwMUFFNTAxMDdFMzZDRDRDMzZERjcyOTZFRjFDMjdEMzM1RUExNERCNUI3MDVBQkM2QkE1MjBDQTk0Rjk1QTk5MEQ4NUFDNzVCNzIzMTRBREQ3NzdFMUEzNzNGQjRFNjU2ODBBMTg2RkQ1RDUyQkUzRTM0QjM3RjAxMDJCMUI5M0NENEJBRkQxQTY2MjU1MjJDMzIzM0Q0NjQyMjQ4NkU1QTNENDg1RkFFNTM0RDhFRDg1OUM1QUYxQTcwRDkyODdENjlFNkJENkY5QjVEMDg4NkI1RkIyOTc0QkEyNzY2MDA1QTE1QTc1NzUzQjE3RjgyNTIxNDBGRjFCNTI3RjUxQjdDMTBCNThEOEQwMUY1MDdFQ0M4ODkyQjVFOEIyNjkwQjIwODkwMkQ3QjczMzcxNjI0RTJDM0NCRTgzNjc5MUIwN0IxMkRqgARBREQ5MzM0RkQ3MzNEQUE5NzIzMzU5RDgxREMyM0NBOUE2NzNERjYxMDU5QTdBOTc2QzQ4ODEyQzUyREVEMTczNUZFN0EyMDdCQjAxMTk2N0FGRjdCNDExRjM1MjMxMUIzNDBDRTgxRkVCQkY3MDZDRjEzRjU4OEM1N0QyMjNEMjg4RDRGQzVFOTRDRTFFMzk2MDdGMjY3MDc3OEE4NzVCMzA4QUZCQkJGNDA4RUU4MEE1MEM3N0ZFMjBBNEVENjY4Q0I2ODM4NjhGQUNGQUI1NTBCQUI1MTE3QjcwQTcwMDNGNzNBM0M4OERBMjM4Mzk5NDUxNkU0RkZDNjU4QkQwQkNERTM1OEI0RTZCMjI1NzQ3RjU5ODFDRTNENTdGRjdENDg1NkY3NDI0MkE2RTZFNTRDOURGRTc2Mjg1RTY3QjA5REMwNjQ0Qjk4M0ZGNzU1ODdDQzY1N0FCRkIzODcyQUNEODdFMEVEOUQ0NkRDRUJCNjUxMUY3M0VFRDUxQzBBMkRBMENBN0RGRUIyQkYxMzVEQ0Y2RTRDMEUwQ0M3REFENDI2NUY5REZBRjRBQzg3QUM2MjlGQ0QxNkE3MEM1QTBFODA2RTk3N0RCRTU4OUNENTI5NjIwMzAxRUY4MTAxMERDOUE0NjA1MURBNTMyOTcwQ0UwMDZDNjNFRDY2QXKABENFN0MwMDQ4QTREODRFQTdBRjg1QTkzOEM2MDI2QjQ4MkNGNUNCQTVDMUE1NThEQjYyOEY3RkQ2OEYwQzg0RjVGMDk0OTYyRDM5NEVENTQyRjFBNzdEOTdERjI0REEyMzc3QzFENkExNTI4OUVBQjk5OEEyNDY4RjFBQzJBNEQ2RjdCNjAyRjQ4NTc2RTRBQTg2RDdBRTcwMzRCMjQxM0MwNkJDQTQzMjg3NzY5NkQ0RUQ0ODZDQkY3QzgxMUQ3RkRBNENDMTBENTEzMDc1MzRGMTNBNkIzMEExNjc3Njc4NUI3OTgxMEIxQTU4MzBGNzAwNTQxOUI3NkFBQzRGMzcyRkY5ODlBNjFERTc2RjE3Mzk0RjI3OUNFMzhERDg1NjVCNzU1MjVEQUQ2QjI2ODcyNEQzNzgwRjM5RTY2MzQ2RDNBQjRCODY1ODUzRTI5REMzRjcyMUFGNUNGM0FERDY0QTMwMzFGOTY1REI0MEVFNjc3REU0QzU0NkVGOUNEODQ3RENCRjc4RUNGN0RDQTk1MTU3Q0ZBNUFENjlGRjBCNzgwRTE4RTU5Q0Q5RDU2NThFODY3MTlBQ0M4RTI1OTJFRTAyNUE0OTM5NEVBNUQyMkRFODEzQkRGMDE5NzZBRUQ2QjU2QkVFRUY2QjYzNUI0Q0IyNzMwRUJDMEQ1QTQwOokBCkAwMTgyRENFQThFRDlDQzA2QzEwMjFDNDM2MTk4MTcxNEVEMTg3OUUxQkE5ODM0RUY4M0ZCQzJGN0JGMTAwRjRBEj41QkJGRjRBMDE4MkZGQzYwRjZGODhEQUI3MkNFQ0NBNkZFNjgyQkRBNzFBQ0FCQjE2MTI0QTYzNzg1MTBGMBoFc3Rhcms.",
+            "Cgt3b3Jrc3BhY2VfMBADGAMqp0YKCmNvX3NpZ25lcjIaAjAyMqckCoAERUI0ODFENjY5QzJFODZBMUI3Qjg2RTM5QjA4MEMwMjZDQzZENUIxNzY3QUY3NTJCNDEwODY3QTExM0U3MTU2REM5QTJGMTgyQUMyRjI4MjdEMDY5MjFDODZGMUMzRUE1QzI3Njk4REUxNTI5NDQ5MzM3QUQwNTNCRTIyREFDNjZFNDYwM0U0REIyRTYwMTQ3QzZFOEM5NkE1QTJFOTVENDExQkM5RDU5M0Y0OUM5ODNFMjQwQzNERjUxMzMxRDA1RjkzODVENzVBMjkwMjU4MzZFQzg2NjVBNEMwNzM0RUFBQTNFRTY4OEFBMzE3NDRENkUxMDNCRDRCOTE4MzE5MzU2MzA3NjgzRkYwRDY2REE2OTA5OTIwNzRGN0FFMTI3RUY5Qzc0QzdDRDI4RkNFNjYyQUIzRTA1RDA3QTUxM0E4MTBGNUJEMzYzOUNCMjI5QkZDMzNEM0Q3MzA1MjY2MzUxREY4RkNFNkQ1MUJGOUQ3NTlGREQ2RUJCNDI4NzE4MDk4N0VGMzhEMUM1RDZFMDE5MUEwN0E2RDM0RkQwNjg2NTJCNjY1NzFGMkI3M0ZFMjQ4MEJGMTE2NzBCOEVBRjQ0QUQ5OERDRkQyNDM3Qzg1NjI1MzEzQTQwODczRUNCRTY0MEM5NDNDQkI5NDQxNDM3REIxREFBREI4MERCMTUSgARFQjQ4MUQ2NjlDMkU4NkExQjdCODZFMzlCMDgwQzAyNkNDNkQ1QjE3NjdBRjc1MkI0MTA4NjdBMTEzRTcxNTZEQzlBMkYxODJBQzJGMjgyN0QwNjkyMUM4NkYxQzNFQTVDMjc2OThERTE1Mjk0NDkzMzdBRDA1M0JFMjJEQUM2NkU0NjAzRTREQjJFNjAxNDdDNkU4Qzk2QTVBMkU5NUQ0MTFCQzlENTkzRjQ5Qzk4M0UyNDBDM0RGNTEzMzFEMDVGOTM4NUQ3NUEyOTAyNTgzNkVDODY2NUE0QzA3MzRFQUFBM0VFNjg4QUEzMTc0NEQ2RTEwM0JENEI5MTgzMTkxNkI1MTBERUEyM0M0MjZBNDRCMDYxNkRDMDJBNENBODU3MDU3RjRGQzhBMDA0MzdDQkI2RjA0OTU5RjhCNzJENzE5NzlCMEFFMkMxNjk4MkFBMTk0OTdEODk4NjlBM0IzREVBNUMxNDVEREVDOERFREMyNzFCNDY1N0UxQ0E5QTBFM0ZDQjhFMzU3QTA4NDY4RDdGQjYxM0JGRDc3MTY5NkRCNzI2RjlCNzVERkU0QTRFMDVFN0U0NzA3QzM1QTgzQTc1NzRGNDZFQjZBMTNFMUQyQURCMkU5MzY2REM0RDY3OEUyQzgxN0JBMkYyMjc1QzNCOEM4NUMwN0FGREJFQxqABEU4MTlBNzVBMzQzRTlDREM0MDBDMTg2NDJGMDg2RTZCODgzM0U3NDg4MDYxRjVEQUQyNThFMEQ0QkI3NDRGNzM4Qzk1MzE4QjE4ODVBMjgxM0YzRTcxMDA0RkVEN0JENjVGMjEwQjVBQUQwOTE0NEE5NERDNUJGRUUyQkY2RkQyOTc1NDQ4MjU2MTZCNEUxRkQxNTU3RkVEMzY0M0Q3MzM0MUEyRTYzNERBQkRBM0I3OUQ3NEE3QUMxMjYzMkU0MDdBM0JCQUQxRkVDN0IyOUJCOTE3NDgwM0M0RDNCMTdBRjBBOTJDNDAxQ0Y5NjYxNzkzMEM1QkEyQTEyRTM1NTg0QjNBRkRGNUUxOUQwOEIyMzFDMDVDNjg0QTZDRUJCRDc0OEI3NTdFRkY2NDU5MzE2MUQ2MTY2N0EyNkYzRDM2NDVBMkVDRTdCOUJDOUEwQkE1MTBCMzIwRDIyRkMyOUNFNDVGMTlEODJBMzU1RjhGODZBMDlFODZDMjkzNzJEQjdFNzExRDc5MkY3RTQ1RDcyQUQwRjVCODYxMjQ5MDlFOEY4Q0I5Q0NDNUMxODY4MUFCN0QzQkI5MzI4RjczODJEOTg2NjYyMTNFNzFBM0NCN0MwOUZBMzFDRjRGQUYzRjIxMjc3MEU0NjgxRkEzOThFMzJDREU2QzdGNjNBMjlCIoACRjgwRjY4OTExRDIzMTYzRDVEQjU5QjRERDQyOTdBRkQ3M0REQUZGRjIzREIwRDk1NDc0NEExRDQxODU1N0NEMUZDQkQzMTI5ODFEQjhBMjczNUI5OUE0QjU0OTcwQkYyNTc4MENEN0NFNDFENDMyRTFEOEIzN0U3QjkzRUVFMDg0NDdEMzM3ODhCNTBCMjBEQzhEMjkyNDc3OUMxMzkzQzAxM0U5NjhDNDk5MTdDOTg1OTlFNzY3RjRDMjcyODQ4OEM1OTFDQjEyMjUzRDEyNzdGQzVGQTY3MzQxNzE4RDc1MDU4RDQ2OEYzMTQ4Q0E0MkFDRkZCNjFDNURDM0U2RiqAAkYyRDAwMDA4QkUyNjI5RjhDMDREREZERDc4QUM5QkE1MEI2NkNGQ0MxRjREQUJENDVGRjc5NzlDMTg5OTYxOTE2QUQ4NzlGQkI1QUE4RkQ3RTg3NTBCMTk4NjA0NzZCRDFCQjkwMTBCQUI0N0VFODE5NUEyRjEyMTgzRTZFRjZFRTEwRTAyRENFRUQ0QTA2OTc4NEMxNDIzNUMxNzgwOTU4ODdBNjAyRjVGQkExMkMwRUE4M0NBNEIxMzIxMEJFMzEwRkQyQ0U0RUY2NjUyQkYwM0IxODNFOUQ2MDI2MTFFMUQwNTJDQzMxRTc1OTRGQTQ5NTI1OUVEMERGNEMwQkIygARGMDVEREI4Njk0MkI5RjIyMDdFMkREQUZCMjA5QzU1Q0EwMDA5QUE5MjY2MERCRUU0NkQ3QjNERjc4NkFEMzFCODcyNUExODZFRkYxNjdBNzk2MEQyRTM2Rjk3MDY3MERENkNCOUExMUI4QkE1MDExRTU0MzYwQTc5MjNDRDY0QTUxOEEwMEI2QUE5OTM3RUQxRkFFMEZBMjQzMUJCREExQUNBOTVDNTMxMzk5OUM1NTUyOThERUU0MTZDQjEyMkFEREM5RUVDQzhEOTk3NUU5QzkwMTY1OEI4NTYwRUY5MzVDMzlDQzA5OTg3M0JGMEU0MEEyMDk5NjZFODA4NjNDMTFCNjExNjI3NUZCNTVCQTczNDBCODNGMzhGNDdGMzc0NDk2NDJFMjgxRTZGRjZCREM5Qjg2NzE5NjQ2NjFCMENDOEExOUU2NTZFNjA3ODFCQjhDRDUwNjM2NUE0QTAzM0IyOTVFNzVGMjg2RDNFNDk2OEQzOThFMUQ3NkM5MzYwQzQ5MEI4NEQxQkVDM0M4NjQzQjE4RTlGNEI0OEIyMTY5QjU3M0YzRjczOTVEOUU1RDYxQ0M3ODA4QjczMkI0Q0Y2N0Q3NDBERTQxQjRDOTIyODA0MEExMTQwMTBCREQxODI3ODg0Mzc1QjQ4NDM2Q0ZDM0FGQjAzNDAxRjQyMTqABEU2NERFOTEwOTVCNTI1QUFFRjZCMDU1NDNGMTZCQjUxQ0U3NjQxQzUzQjg0Mzk1RkU0QUNGQzhCODEwQjFBRDcwRTdGNkUwOEZDMzNBN0ZFNEFGQjI2RTFFNjFDMUMxQjNEOEMwMDg1QjdCNDExNEU4QTU4QUVDRjFGQjU1NjZGMDM4QUQ2Q0QyNkE5OUNGNjE3Q0E5MDM3OEUxQzEwNjI4MDg4MzQxQTIwNkVCQTVGQjZBQjNCNTBGNjdFMDkxRUFFMEFFNjI3NTY4NTZDMjEwMEQ0OENGRjI2N0FFQ0QwQjVGRUFEOEY2RDE4RjgzNjhDQkQxQTQzMUFGOTYwM0NDM0Y4QTg1NTFBNTFCQTY5Q0RBNDdBRDRDNDgyMDQyNUE3OTgxQjZBQjhEM0I3QTA2QjcyNTNENDlDNDVGRjc4QjU0OEY5QUVCRjgxRkFBMTExOEIzNDU1MkIwMzE0QjY5REU1OTFEMzA1NTVFNEVGNUM5NzJBMEY1Q0I0RUNCNDMxMzIzNzcyMUIxMzk0MUI3RDVGRTVEMUY3MjkyOUYwQ0REOTFCRTgyRjVDOTc3NkMwMjNFMTkwRjE4Rjg5NjkxMjAxRkY0MjA3MTE5RjMwNzgzMkExOTdDRENBMDhEMThFMzFEMEFGMkQzN0RCMjkyM0JEQTVEMEYzOTEwODk5QoACRjgwRjY4OTExRDIzMTYzRDVEQjU5QjRERDQyOTdBRkQ3M0REQUZGRjIzREIwRDk1NDc0NEExRDQxODU1N0NEMUZDQkQzMTI5ODFEQjhBMjczNUI5OUE0QjU0OTcwQkYyNTc4MENEN0NFNDFENDMyRTFEOEIzN0U3QjkzRUVFMDg0NDdEMzM3ODhCNTBCMjBEQzhEMjkyNDc3OUMxMzkzQzAxM0U5NjhDNDk5MTdDOTg1OTlFNzY3RjRDMjcyODQ4OEM1OTFDQjEyMjUzRDEyNzdGQzVGQTY3MzQxNzE4RDc1MDU4RDQ2OEYzMTQ4Q0E0MkFDRkZCNjFDNURDM0U2RUqAAkYyRDAwMDA4QkUyNjI5RjhDMDREREZERDc4QUM5QkE1MEI2NkNGQ0MxRjREQUJENDVGRjc5NzlDMTg5OTYxOTE2QUQ4NzlGQkI1QUE4RkQ3RTg3NTBCMTk4NjA0NzZCRDFCQjkwMTBCQUI0N0VFODE5NUEyRjEyMTgzRTZFRjZFRTEwRTAyRENFRUQ0QTA2OTc4NEMxNDIzNUMxNzgwOTU4ODdBNjAyRjVGQkExMkMwRUE4M0NBNEIxMzIxMEJFMzEwRkQyQ0U0RUY2NjUyQkYwM0IxODNFOUQ2MDI2MTFFMUQwNTJDQzMxRTc1OTRGQTQ5NTI1OUVEMERGNEMwQkFSgAJBMkRDNEIwMEVDNUI2QUVDMTM2RjRBMEVFMTkxQjA0NjFDQjcxMjVDNjFCNTlBMUM0MUU4MjlBOTZGODFCNTJDRjY3MkRBNDZFNjc2MjkxNkI5OTdEMjEyODkyMkFCMUU2NjgwREI5MTcwMTQwREQxNkE1OUU1NEUzREQyQzUxRTY0OEI2QjBFNTRCNDkxMjQ2Rjg1QkQ4QjBENzc5RTJGOEMyODQ4MTAzNENENzhBRDM2MkJDNzM3MzU2NzRBQ0ExMkI4QjM2RTE2MTE2OTQ2M0ExQ0MyNkE4QkY4OTI1NDhDRUNGNjZCQzI5QUUxRDFBNzQ4NUI0QzE4RjRDREQ1WoACNTM2NUI0MTdENjJGM0IzMzg2RkY3RkEwNkUxQzY1MzU1NjEzMzA0QTVENjI0NTVDMUJFRTYwNEVEODdGRDczRkIzQUFCQ0JBRUJFQzZFNTAwNjJERjE0NkRFMzhDQ0ExNjc2NDg3Q0QzNTE4NjMwQTFBMDkzOTg4Q0ZEOUYxMzcwMUE4OUE3RDgxMkREQTVCQUZDRkQ2Mjc0MDE1MjNERjZEREY4RDU4RDA5RUYyMUM4NkMxQjdDOEQwREEzOTVDM0U3NDI4NEIwMEIxNjJBQjdENDEwNDQ3QkYwNTAxMTlFMjUzQzA5QTAzNDNGMkVDMjRFNzhERTJBNUI2RTVEM2KAAjU1MzMxRDkwMzBDN0FCNTE0QTQ2NTEzRUYyOTdDQUI3NTcyNjlEQTJDMjI1NzM3OTA1NUM3ODJBQThEM0M3QTUwNjRBNTZFMjlCNjU2MTEwN0MyMUM4MzhDQjc0NjBEM0YwRkZGMUVCNzQwOTM1NUNCMzMxNTI5OTdCNkMyOEU5REZGMUM4NkEzNjlDMjBFOTU5NENENEJDNkM0OTlCMEM3NTE2NEU3QzE0QzQwM0VCMjM3MkFGNDgxNkJGREQ3RTc5QTA2OTQzMEM0MjY3RTE0NUE5MzdGQ0E4MUU4NjgyQzM2QkRERkQzMDc5QUFEMjgzODdBMDE1QUNFNzcwOUFqgAI5RjZBNEJGMEU3RjZFRUM1Mzk0RTYwM0QwQTkwMzY2RkI1NTM5RjgxQzFFQjY2Nzg0NDA5Mzc0RDQwMTk4QTUxQjcyREJENDBDOUJFMjE4N0UyNDcxOUQyQTdDQkFBMUJCNDU0NzkzRTc2MkY4Qjc3N0I5OUI3OThCNDBDRkUzN0RGNjU2ODVGNkRBNkM2MERDODdDM0RGQzFDMDI1Q0I2MUE5QUQyRDY4RjFCMjBBNDYzQzIxMjgyNDI0NkQyODZEMjg5MDQ5OUVFQjRGMDEzODY3MDdGQTIxNkZENjAwNDNBQjE2QzI5MUIzMUEyMEUyNDZBQ0MwQTY4M0REQUU4OoYICoAERUI0ODFENjY5QzJFODZBMUI3Qjg2RTM5QjA4MEMwMjZDQzZENUIxNzY3QUY3NTJCNDEwODY3QTExM0U3MTU2REM5QTJGMTgyQUMyRjI4MjdEMDY5MjFDODZGMUMzRUE1QzI3Njk4REUxNTI5NDQ5MzM3QUQwNTNCRTIyREFDNjZFNDYwM0U0REIyRTYwMTQ3QzZFOEM5NkE1QTJFOTVENDExQkM5RDU5M0Y0OUM5ODNFMjQwQzNERjUxMzMxRDA1RjkzODVENzVBMjkwMjU4MzZFQzg2NjVBNEMwNzM0RUFBQTNFRTY4OEFBMzE3NDRENkUxMDNCRDRCOTE4MzE5MzU2MzA3NjgzRkYwRDY2REE2OTA5OTIwNzRGN0FFMTI3RUY5Qzc0QzdDRDI4RkNFNjYyQUIzRTA1RDA3QTUxM0E4MTBGNUJEMzYzOUNCMjI5QkZDMzNEM0Q3MzA1MjY2MzUxREY4RkNFNkQ1MUJGOUQ3NTlGREQ2RUJCNDI4NzE4MDk4N0VGMzhEMUM1RDZFMDE5MUEwN0E2RDM0RkQwNjg2NTJCNjY1NzFGMkI3M0ZFMjQ4MEJGMTE2NzBCOEVBRjQ0QUQ5OERDRkQyNDM3Qzg1NjI1MzEzQTQwODczRUNCRTY0MEM5NDNDQkI5NDQxNDM3REIxREFBREI4MERCMTUSgARFQjQ4MUQ2NjlDMkU4NkExQjdCODZFMzlCMDgwQzAyNkNDNkQ1QjE3NjdBRjc1MkI0MTA4NjdBMTEzRTcxNTZEQzlBMkYxODJBQzJGMjgyN0QwNjkyMUM4NkYxQzNFQTVDMjc2OThERTE1Mjk0NDkzMzdBRDA1M0JFMjJEQUM2NkU0NjAzRTREQjJFNjAxNDdDNkU4Qzk2QTVBMkU5NUQ0MTFCQzlENTkzRjQ5Qzk4M0UyNDBDM0RGNTEzMzFEMDVGOTM4NUQ3NUEyOTAyNTgzNkVDODY2NUE0QzA3MzRFQUFBM0VFNjg4QUEzMTc0NEQ2RTEwM0JENEI5MTgzMTkzNTYzMDc2ODNGRjBENjZEQTY5MDk5MjA3NEY3QUUxMjdFRjlDNzRDN0NEMjhGQ0U2NjJBQjNFMDVEMDdBNTEzQTgxMEY1QkQzNjM5Q0IyMjlCRkMzM0QzRDczMDUyNjYzNTFERjhGQ0U2RDUxQkY5RDc1OUZERDZFQkI0Mjg3MTgwOTg3RUYzOEQxQzVENkUwMTkxQTA3QTZEMzRGRDA2ODY1MkI2NjU3MUYyQjczRkUyNDgwQkYxMTY3MEI4RUFGNDRBRDk4RENGRDI0MzdDODU2MjUzMTNBNDA4NzNFQ0JFNjQwQzk0M0NCQjk0NDE0MzdEQjFEQUFEQjgwREIxNkI-NzNCOTM0RkJCREZBM0E3ODIzMEUzMzlDOUE5RTlFNDY5QjU4NDZFNTg4QUU2ODFBQTk0NDdCQUE0M0VFNkJKiwEKQDA1MEY5QkU1MUY1OEI4QkY1OTQyMEU1NUZGRTA1MTAxMUY3RjA4QjRFQkNENjlDQTYxQzRDMERBOEJGRDQzQzkSQDA1NDYzNEE0Qzg3NTI4M0M0QzBDQTNBNEI0NzE2RTA4QTAyREFGMEY5ODAxOEUxRDhCRDcwRTdGMUFBQUE3RTUaBXN0YXJrUoAEQzU5MDJEQkZFODE1NzhDQjBENzkzNzQzQUIzOEQ1OEI4NTFGRjJDQTM1M0JEMzc4QkZCRkI1NTRGQzA0NzIwMjkyQjE5OTVGNkZDNEVDQjI0NEM2QTgwRTI5NTc5NTQwOTAxRURBNjBERTY3RjRFRDM0RjgzOTAxRjFDOThERjFDRTFCNENEQjZFMjQ1MzYxN0M0MzJFRDQ2NjFFRkZGMjAyRUIzNDZBOTgwRTIwODk3NTMyNDU2MzFDNEMzQTgwNUFFQzEyNkU4MjM1NTVDRjRERDEzNjFGMUI1NjU0Mjg2RUE0MEU1RjNBMURFQzQ0NjRCRUU5MzcxQzFEN0UwNDA1RkQyOTE3NzA2QkIyQUIyQkUyMTZENjVFRkFBRTA5RUM4M0MwMTUzNjQwRDE1RTgxODZDMEFFNkUwRUU2QjExMjZCOUQ3QTExRkEwNEY5MDA0MjYxOEFDRDgzQzdCMzM0QzhGNjJGMjgwNTlDRTBEOUNFMzlCRjQwNEU3RjBCMTk5MTBBQUM1MEIxMTgxNzI2NjJBRERDNkZERUYxMkYwRTJGNTE2N0QxREY2REYwOTEwNzg4MDVFOTlGNURBRTE4NUM1NjBCQUY3RTNFRTk5NEYwODY2QkI0MUNERUE4ODBERTYxRTA0Nzk4RDRFQkM5ODcxMUNDQkExQzlGODFagAI3REVCMTc0MzE0MjUyOEQwRDdDQTE1NEE2RUVCMzA2NjNBNDVCQUZDRkI2NTlDMDI0RjU5OThGQTM0QjZCMUQ3NzFEQjBCQkUwNkM5REYxRUUxMjM0NEQwRjUwNDhEMDRGODlFRTQwNENCNkI4MEJBNUVBQUFFQ0UyNkFFMzcwOEU0NUJGRTJBQkNBNTA3ODM1MEY2QTIwQUIzQTZBRDI2OEJEQzEzQ0VDNDdDRUEwRkY5RTM5MUQ5N0M5MjU0M0QxODJFQzZDMzU1MEZCMDYwNDUyODgwNkZBRUUyMUFGODlBODhBODYwNEY0NzIwQTdDODBBN0NBQzU2RkNGMDhEYoACNjQ2QTI2QTUyRDhBQkFCMDI3NUYxNzQzRURDNzcxQzVCMDJFOEIzRkRCOTgwOUVCMjQ3NEQ4Q0NGRDg2N0M4MjhBOUVEODYwMUZCRUVBMkYwMzJBRkEwNkVBNkQzMUMwMTA5MjdCMENCREYxNjM4MEFERUY5NTFFNUZCMUJGNzlEN0U1NDFFQjU1MDFGN0I4MjdERDkyOUUzNDFGOTA3NEVGRkQ0RURBQ0UxQzUzQkU5Q0MzQkE1M0Q2Qzc2RDdERUUzMDU4Nzg2MENDN0FFRDhGNkVFMkVEM0YzNDFFMkNFQTA3RjUxOEEwRUM2RDAxM0M2OTc0NjA1QUM5RjNDOWqABDVDMjhEQ0RBODI4MkRGMzUyMkJBNjkyNTBBQjIyQ0UyOUJGOTg5MzlBNEIwMEMzRDAyQUZFRTcxNEI5OTA5OUYxMUI2RjQxMEZBOThDNzg1NzY3MkNGODNDRjQ0RDZDMzZFQUU3M0MyREUzQjk2NDJCMTQ1QzUyMDRCRjYzMEExRDlCMTAwNUM5NEUzMkEwNUIzMDdGNEQ0QjlEMUQ2QjgyRTEwNUU5RjFERTA5NUNBOENGODRBRUQyMzBGOTVGNDNCNUU1MURDQ0VDQThEMDg2RkNCNDJFNjk1RjIwMEVFMUZGNkFBRjY0MDU0N0UwOUM4ODlDMzdGNUNEQ0Y2MzlFQUFCRThCNDhFMTc3RjY1MUE4QjRFMjAwN0MyNzIxOTU0REE3QjcxODdBQTFBQUNDMzM1RUM3OUVEMzdBMkVCODY3QjI5M0NCNzNCNkUyOTk0MzgxQjJCRkFCOUE1QUU4N0ZCRDQ1ODZEOEYxOTdCMUVFQ0UxQzVDREI4NkU1Q0I5MkY0NEQ1QzgwNzIwQjQ4OURCNTE3MjM3NTc3NzU2OTg0RUNERUFFQjRDMDE1QzhERjkzRDJEQTUzMUEyRjJENEJFOEI0MTg3RjMxNTM1NzY2NjE5NTdBNkJBRUY2MzFGMjFBRjJEODEzNUM4NkY1MUU2ODhGN0FEMUVBQkY2coAENTJFNDA1M0U2NjNDRTRCMDUyNUJCRUY1QzNDQUY1NEE0NjcxMDg2QzNDNzMzN0Y1ODg1NEI1RUMzNkVBQkJCMDdBNTI3RURERUE5RTNGRTk4M0VFMjI1NjM1RjU3RDhFQUMxODcwODQzNjUyMTJEQUI4RTY2MURCRUI0OEYxQkM1RjdDQ0ExQTMwMjEwMEI5Q0U0MjE3RTdGOEUwNUE5OEE2NTU1M0JGRDQ5Mjc0RjJBRDBDRUMwRTRDRkM5MzBEMkNCMUQ3QzU1RkJBNDgwMDk0NTBCQjM4NjdCQTk5RTIwQTVCNzlCMUVBRDBDMzgwRDgwRTA2RUQ1NDI2RjJFRTE4RTM2RERBMDREMzYwOTczRDJDRTk3NTFFNkY5RkFBQjg3NEE3NDc2ODkxN0IxMTJDNTkyMjZFMEFEMjA4RUUzMTMzNTNDRjNFMjFCRTNFNEU0OTAwOEMzNUI5NEY5OTFBRkU4MDU5QTIxMzI5M0IwMTA1RjhGNjE2QkMxODI5OEFGRTQwQUE5MjUwRTYzMDMxRDcyOUVCMDYwNjg5MjM5MTlGRTMwMUQwNUM3MDQ2OEI3REU5N0Q5QkQ1MjU5N0JBMDdBRkI4OUJFQjA5OTc1RjY2Q0I4MDhGNzRBMERDOURGQjk1QTJEOUMyMDk1MzM5QTVFOTlGMzgyNzUzRjJ6gAQ4QTBCM0U4RjI2MzFCQTM3NzEyQ0Y4OEJERjg5RTU2Rjk1NDNEREY4NkMzNEJERkU4N0NFMDdBNTUzOEJDRUY1NDBCMzhEMDkzRDFGQjFBODREQzg0OEQxNjg0RkVCRjgxNzVFNkM1RDkwRkUxOTVFMTY4NjIzQ0I2OTE4OTRGMTdEQjYwOTNDN0VBMDQ1MEY4OTBERkZBMzEyODM1RjNGNDAzRTYyRDY5NUFBREIxM0M2Qjc5RTM4OEJDQjdBMTM5MEFEQkFGM0U3QkI4RjlDQTczQjc1ODkwMzlCOTdBREYwMDFEODJGNUZBQ0Y2NTg0NEE4MDAwNzQ0NTJCQUZFQjYxQTM4Njc4QjlEOUI5ODM2Qzc1NTNCRjlFQTM2RTVBRUM3MzA1MUNDMDIzMUU1MzY0MjE0QUMxMzM1MjFCMzI1MzUzNjA2NjYxNDNDMkY3Rjc3Mjc2NEJCNzQ4ODFEQTUyRjAyRjQ2RTM0QzJFMkM5QUFEMjQxRDkzNDE0MDkwRTk3QkFGQUUzNjhFOTkyRUE1RUJGNEY2REM2Q0U4MzY5MjMzMjUyQjEwNkM2OEI5RkZEM0I2QTdBOEEwODVFRDE3MUM4RDY4RkZDOEI4NDhFNjFBQTZCMjg2QzA3OUI4NENCNUQ5Rjc0QzgzREJEOTFBODZERTE1NDNDNTVDMYIBgAQzMDQyN0M4NEUzNjc4MTk2RTkxQTQ0M0E0OUIxOEQ0RDEzOEEzREFERjI1QkJCRDZCMkNBQjc2MTBEQUFEOThFMzMxNjY3REJERjQzNzk0Mzc0QjIzNDc4RDBFRDM2QjJCN0ZFMEM0QjdDNDQxMzJCMjg0ODRBOEQwMzM3QzFBNENEQzRGODlDMDkwRkFEQUQ4RkYwOUFBQURFRjE1NkUyNzEzMDY2MDY3RDFGOEY2M0M1QTJFMDM1QjdGODdFQ0Q3Mjk1OTY3MDBDQzhFN0I5ODU3NzQ2OUI3MzY3QUVEMEU3RDYxRTBCRkE3MzNGMzFEMzdGNTUyNjdENURBQTEwNjc2QTQzNzM5NjAxNkU4RjIwNTI1RUJFNzAwNDA0MzhBRjEzNTBDREJBQTc2REJBODZFQTk0NEFDRUUyMkQ3ODk5NjZCQjRBODNCM0IxMzBCMUMyNzg5M0ZGOTE5MzJCQkM3OTdFMjI2NThBOTJDQTcwNDc5MDExNENDNTE4OTlCM0VFQTQ5OTNEQTgyOTFGQjI1MEMwMEJBRjEwMEZEOUUwNDI5RDY3QkMyRDNCMEI5RTEwQTA5ODQyNTExMTNBOUFERkUzNEVDRUNDMDJDQTU2RTAwQjM3MUQ1QTYzOUQyRTBCMDIyMkEwRUZGNjQ2Q0QwODY1MkY0RTQ2NkMyRjKwFQoKY29fc2lnbmVyMRoCMDE6hggKgARDMTUwMDRDOTA5ODlBNjQ3QjY1QTQzMzY1MTI2QTAwN0I4M0UyN0UzQjM1MkQwM0I1QUZEODY4OEI1NDhFQjkxRTg0REZFNEFCOTAyNzgyNDMxMTc5RTgyNDgzQTBCM0U1QUFFQUE0RjM5MUUxRDI0QzEwRDRCM0Q1RTZENjdDQjVBN0M2QkNDNTYwRkYzRTY1Njc0NEZGQTg2NjU4RkFGQTNCMzY3Mzc4MzA5NDNDODVBMUM0M0M2N0QwODYzNkFGNUUyNTUyNTkzMzNBQjM2QUIzRTYxQjU5RUIzNDQxOEQ0ODI0QkVCN0IyN0FDMzEwODRDNDRFQkZCRURGMjM5MDI5NUJCQjZENEQwMzUxRkQ2QkU3MUVDOUUwOUNDMzcwMkFGMEFBMjc3NjhBOUYwNTYxODBDQjc4RDBCREJEM0VEQjgwM0EyMTVEQjFGMzc4QTU2RTk2QzFEMzMzMkQwMTkxMzhEMDc3RTUxQkYyODJBNUYxODExMUUxODA0Rjk5Q0ZBNzk4N0ZDMTEzOUFGQjA3Q0NCOTM2QjFFQkVCMUU4OUJFMDgzQjkzMjIzNTgyOEZDQ0EyNDg1RUY3N0Q4MzIyN0ZFNjU0RjVEMkFGOUVGM0NCNDkxNzUxNDA0ODFDMEYzMUJCOUVEM0I1OEU1NUMzRTAxQTM3MzI0RUQ1RBKABEMxNTAwNEM5MDk4OUE2NDdCNjVBNDMzNjUxMjZBMDA3QjgzRTI3RTNCMzUyRDAzQjVBRkQ4Njg4QjU0OEVCOTFFODRERkU0QUI5MDI3ODI0MzExNzlFODI0ODNBMEIzRTVBQUVBQTRGMzkxRTFEMjRDMTBENEIzRDVFNkQ2N0NCNUE3QzZCQ0M1NjBGRjNFNjU2NzQ0RkZBODY2NThGQUZBM0IzNjczNzgzMDk0M0M4NUExQzQzQzY3RDA4NjM2QUY1RTI1NTI1OTMzM0FCMzZBQjNFNjFCNTlFQjM0NDE4RDQ4MjRCRUI3QjI3QUMzMTA4NEM0NEVCRkJFREYyMzkwMjk1QkJCNkQ0RDAzNTFGRDZCRTcxRUM5RTA5Q0MzNzAyQUYwQUEyNzc2OEE5RjA1NjE4MENCNzhEMEJEQkQzRURCODAzQTIxNURCMUYzNzhBNTZFOTZDMUQzMzMyRDAxOTEzOEQwNzdFNTFCRjI4MkE1RjE4MTExRTE4MDRGOTlDRkE3OTg3RkMxMTM5QUZCMDdDQ0I5MzZCMUVCRUIxRTg5QkUwODNCOTMyMjM1ODI4RkNDQTI0ODVFRjc3RDgzMjI3RkU2NTRGNUQyQUY5RUYzQ0I0OTE3NTE0MDQ4MUMwRjMxQkI5RUQzQjU4RTU1QzNFMDFBMzczMjRFRDVFSosBCkAwNDIyM0I2RThFQUEzMEJEMDNCOUE1M0M3MUMxQzM1RTQ3MzdEMTQ0RDg4RjVEN0IxQzZDN0FFMkY0RDVCMTZDEkAwM0MzRTA1NTIxQzlGQzZGQzU3NEE5MUQwMzFBNjNFREE0NEUzNzY5NjAwNUQ5MzhDQzQ2OTYzOTlBMjZCMjhDGgVzdGFya1KABDk3OTUwNTdGNjkwMDBGNTM1NTk5MTk5QzVGNTk2Q0E4NzA5MzA0RjNCRkFFRDkxMEQ0NzZGREZCQjFDQTJDQkUxOTYxOTY5QjUwQTA5MDc1MjExOTI5NEE4RDI0MDc1Nzk4QzJFODkwNkRGMjZEQzg1RUU3MjdCRDM1OEJEODM4RUI4RDZBRjE2NjYyQTI3ODYzRjNEQ0RFMEQzMDFGNTc3QzRFREFGREE5RURDNjgyQkYzNzA3NjQ5Nzc5NjI5RDdFQjVBQUVDODYzMUQzNkYyNjhFNDM5OTFFMDQ3NkY3QTVFQzJCNTUyOTE2NDlENjg0OEU3RkI3RDA2NTAwNzExNUIwRjVGRDczQjYzNzY2NzRBMTdGMDlCM0I0N0ZCQjJFMTEwQUJFRTUzNzY5REZDOTMyODJCNzVCQUQ0MEU0MUMzODk1NEY5NUQwRTA5ODVFNjcwMDg4MUM3MDgzMzEzMDZGRjBDQkM4RkUxRDBFNEIzNjBEM0VDNzY3RDI2M0Y0MDg1REZERjVBRjkyMTI5RTRFMzZDN0YwNzk4NTZEQjg1NTJCMEQzREVGQ0M3MUIxMzkwMDFCQUIwQTBBQzVDQ0ZDNUJCNThENjEyQ0NFQjc1Nzk0RkNBODlBQkZBNTk4N0MyMEVENUI1Q0I1RUNCQ0IwMUVBMkE5NUM2NDg1aoAENzBCRUM4NjI3OTFBOTgzOTkyNDFGREREQkI3MkYzMjQ5NEIzQkRENUFBNzA3NDdFQ0U5MUMzRjdGMjRENkE5RDU2MDE5QTRCMUIxOUYzRUVENDk1OUM5RTVCNTJDQzNFRDcxMDIyRTI2MjcxQTIyMTMwMzM1RkRDQzFGRDU4NEVBNkVFMjc2RTU5RjU1QTdFNEYxRUI2OUFFRUZERDkzMTRCREZFODAxMjhENTIxMkQ1NTg5RDA3NEVEOEQ4RkJEODgxQjNDQkI3QUM0MTI2N0VBNTRCMzU4NzJGNEEyNzczREExMTAwMjk4MjJFQTk5NzZCRDlFQzRBMUUwNjk5MTAxNzY4MEIzQzk4RDA4MkJGQTdGQjcwMzlCOTc5OTRFMkEyNzM5RjBFM0VDNDgwNEI0NTVENUVFMjM3MTFFNjRBMzUzN0VGMTAzQjdEMjdEN0Y3NkFCMUM5MDQ3NzVEQjIyNjAzNjk0QTEzOEI3MjRFMDYxMjdEOUJBREJGNEFGRTU5M0M5OUQxM0M1N0VEOTMwN0UyRjVEREY1MEQ4QTA0MjQxRjIxQjMzMEJBQTg5NkNCRDM1NjE3NkIwNTU4MzFEQTU2OTU3NEM1OTRBMEVDNjI3QzMzNEJGMjNGNzk2REEyODYzMEZEN0NFRDA2MDc4NDQ0QTgyMTU1RUM3N0VygAQ1MTFDRDNEMUNCQTE5REJGRjY2ODk0OUZCNzgyQjcyQTVBRUVFQTYyMzVDMTg5NEJGNUY1M0QyODk3RDE4NjgzMzk1NzFCODgxQ0NCMjNENThCNDJDMDRENzlERTMyRDJBRENDNjZGMEE5QzQxMDkyMkEwMDZCMjAwMUQ4RTU3N0EwMTc5NkJGNkM0RTlBN0E5ODlGOTZEMjgxMUYzNkNCMDA3MTlCOEU2RThDQTg0Q0U4OTI3MkU5NTU0Q0UzQzQ4OUU4QjQ0NTVBQzYyRjcwNEUyMjVGRDcyMEJBRjM2OTNCMTU1QzMxM0NCRkJBMThFNjc5MEQxRUY4QUFEMzkwQTUyODJDRkFGQjc4REY2QUE4NUMxQjNGNTk5RTQyNTE1QjAyRjVEOEE3RTlEMUQ5Mzc2MjVDQUMyMDY3NzE4QjQzQzZDNDZBRjZCMDA0Mzc4MUU5ODQ4Q0FCRTAwNzc4OTNCNUM4OTQ0OUNEOTMyNUE2OTJGRTVFODlFNzEwQ0JEQUQ5NkU4QjZFREI4MkI4NDk1Mjg3ODczQjBCMkUyMzg5RDY3OEQ5NjlDREZCQTNENEIyMEIwRjkwN0VBMDU1MkEwMENGMENBRTcyNkVFN0EzQUE4QUFBMDBDNTYyNjI3Q0QzQjlENkJGN0Y5MzNEMURDQkU2MzMwQTk1MzJCQTKwFQoKY29fc2lnbmVyMxoCMDM6hggKgARDMDQyNDA5QjBENjcyOUJGODZCRjM4MUVGMkNCRDM1MzhBOEQ1QzdCNjg3OThFNEQyRUExNDY0MUQ4MjBBQjczNzM4M0YxODQ3MzU5MzIxNjU5MDBBNTlDODZGNzg3NEZGNEQzMzU0MDY4QzBDMzVGQjRENTJDNzkxNkY2QkU1RjdCMzlBN0ZGQTlERkE4RjlDQkYwMzQxRTI0NEFDNUM5RTQzNTQxMEU3MjYzN0U1ODkwRUNCOTFDNTZFMjlBQTAzNDhDRjRBNEE1MzU2OTNEMjdFOThGMDcyQzdGOTMxOEY5Q0YzOEIwRkMwMEEzRTJENzMxNDBFMkM0Qjc0ODYwQ0Y0MTQzOUVCRUI3Mjk0RkJEMzYwQzI2RDIwQTI1OUJFNENCOTJFNzdEMjcxMjRBMENCRDkxRTE5QUNENUZDRDRDOUEyNDE1MDA4REQ1MDkxNEYyNzIwNENGQjA0REE2Q0E5RDEwQjJEQkE3RkU5NTRGQkJDNkRDMTcwRkI2ODUwQkQ4Qjk2MjQ3MTQ2M0Q1MzFGQ0U1REJGNTFDMEMxOTQ4NjVGMTlBMjg3NjBGQzk1MjI5OTQwNzk0MzFFMzY4MzAyNjVBQTM3N0I0NzIyRDE4MjIyRjQ2OEQxOUFBM0NDQjQ1NTY2MzIzNzUwNjJFNzY0MDM0RjE4NkQ3QjQwORKABEMwNDI0MDlCMEQ2NzI5QkY4NkJGMzgxRUYyQ0JEMzUzOEE4RDVDN0I2ODc5OEU0RDJFQTE0NjQxRDgyMEFCNzM3MzgzRjE4NDczNTkzMjE2NTkwMEE1OUM4NkY3ODc0RkY0RDMzNTQwNjhDMEMzNUZCNEQ1MkM3OTE2RjZCRTVGN0IzOUE3RkZBOURGQThGOUNCRjAzNDFFMjQ0QUM1QzlFNDM1NDEwRTcyNjM3RTU4OTBFQ0I5MUM1NkUyOUFBMDM0OENGNEE0QTUzNTY5M0QyN0U5OEYwNzJDN0Y5MzE4RjlDRjM4QjBGQzAwQTNFMkQ3MzE0MEUyQzRCNzQ4NjBDRjQxNDM5RUJFQjcyOTRGQkQzNjBDMjZEMjBBMjU5QkU0Q0I5MkU3N0QyNzEyNEEwQ0JEOTFFMTlBQ0Q1RkNENEM5QTI0MTUwMDhERDUwOTE0RjI3MjA0Q0ZCMDREQTZDQTlEMTBCMkRCQTdGRTk1NEZCQkM2REMxNzBGQjY4NTBCRDhCOTYyNDcxNDYzRDUzMUZDRTVEQkY1MUMwQzE5NDg2NUYxOUEyODc2MEZDOTUyMjk5NDA3OTQzMUUzNjgzMDI2NUFBMzc3QjQ3MjJEMTgyMjJGNDY4RDE5QUEzQ0NCNDU1NjYzMjM3NTA2MkU3NjQwMzRGMTg2RDdCNDBBSosBCkAwNUVBQTM3RjI3NDlDOTFCQTI5ODNEOTE1RDEwNjBBOTlFMjcyNkNFNDk5OERFMDc1QTA2MDAwQ0QyRkNDRUFEEkAwNEYxOEY1NkNBQjEyNDkyMjQwODM5MjlDRUI3Njk1N0Y0RjNBN0RCMDkzREQwMEI2MUNGODlCMTgyMTc3MzI5GgVzdGFya1KABEREMDhDNTZERTZCQ0RDODBERjU5RUU2MjFBMTEyODczQ0JGRkU5NDVGRUFDRkMwRjE5MTVDMTJGRkZEMUY3NDQ2RjZCOUZFMTA1OTU3NTdGRDYzRkI5QjA5NjBCQ0E4MTA3QjU5NkJFMjI4NEU1QjFCQzNDRDVEQkZGM0U4NkJEQzc4MDA0ODg5RDkxMjk3MTg2MzY3MTk5NkE1RTVFMjE4Q0YzQzI4QUFEMjJFNThDODJCM0M0MTcxMDFBRTUwMTA3RTM2Q0Q0QzM2REY3Mjk2RUYxQzI3RDMzNUVBMTREQjVCNzA1QUJDNkJBNTIwQ0E5NEY5NUE5OTBEODVBQzc1QjcyMzE0QURENzc3RTFBMzczRkI0RTY1NjgwQTE4NkZENUQ1MkJFM0UzNEIzN0YwMTAyQjFCOTNDRDRCQUZEMUE2NjI1NTIyQzMyMzNENDY0MjI0ODZFNUEzRDQ4NUZBRTUzNEQ4RUQ4NTlDNUFGMUE3MEQ5Mjg3RDY5RTZCRDZGOUI1RDA4ODZCNUZCMjk3NEJBMjc2NjAwNUExNUE3NTc1M0IxN0Y4MjUyMTQwRkYxQjUyN0Y1MUI3QzEwQjU4RDhEMDFGNTA3RUNDODg5MkI1RThCMjY5MEIyMDg5MDJEN0I3MzM3MTYyNEUyQzNDQkU4MzY3OTFCMDdCMTJEaoAEQUREOTMzNEZENzMzREFBOTcyMzM1OUQ4MURDMjNDQTlBNjczREY2MTA1OUE3QTk3NkM0ODgxMkM1MkRFRDE3MzVGRTdBMjA3QkIwMTE5NjdBRkY3QjQxMUYzNTIzMTFCMzQwQ0U4MUZFQkJGNzA2Q0YxM0Y1ODhDNTdEMjIzRDI4OEQ0RkM1RTk0Q0UxRTM5NjA3RjI2NzA3NzhBODc1QjMwOEFGQkJCRjQwOEVFODBBNTBDNzdGRTIwQTRFRDY2OENCNjgzODY4RkFDRkFCNTUwQkFCNTExN0I3MEE3MDAzRjczQTNDODhEQTIzODM5OTQ1MTZFNEZGQzY1OEJEMEJDREUzNThCNEU2QjIyNTc0N0Y1OTgxQ0UzRDU3RkY3RDQ4NTZGNzQyNDJBNkU2RTU0QzlERkU3NjI4NUU2N0IwOURDMDY0NEI5ODNGRjc1NTg3Q0M2NTdBQkZCMzg3MkFDRDg3RTBFRDlENDZEQ0VCQjY1MTFGNzNFRUQ1MUMwQTJEQTBDQTdERkVCMkJGMTM1RENGNkU0QzBFMENDN0RBRDQyNjVGOURGQUY0QUM4N0FDNjI5RkNEMTZBNzBDNUEwRTgwNkU5NzdEQkU1ODlDRDUyOTYyMDMwMUVGODEwMTBEQzlBNDYwNTFEQTUzMjk3MENFMDA2QzYzRUQ2NkFygARDRTdDMDA0OEE0RDg0RUE3QUY4NUE5MzhDNjAyNkI0ODJDRjVDQkE1QzFBNTU4REI2MjhGN0ZENjhGMEM4NEY1RjA5NDk2MkQzOTRFRDU0MkYxQTc3RDk3REYyNERBMjM3N0MxRDZBMTUyODlFQUI5OThBMjQ2OEYxQUMyQTRENkY3QjYwMkY0ODU3NkU0QUE4NkQ3QUU3MDM0QjI0MTNDMDZCQ0E0MzI4Nzc2OTZENEVENDg2Q0JGN0M4MTFEN0ZEQTRDQzEwRDUxMzA3NTM0RjEzQTZCMzBBMTY3NzY3ODVCNzk4MTBCMUE1ODMwRjcwMDU0MTlCNzZBQUM0RjM3MkZGOTg5QTYxREU3NkYxNzM5NEYyNzlDRTM4REQ4NTY1Qjc1NTI1REFENkIyNjg3MjREMzc4MEYzOUU2NjM0NkQzQUI0Qjg2NTg1M0UyOURDM0Y3MjFBRjVDRjNBREQ2NEEzMDMxRjk2NURCNDBFRTY3N0RFNEM1NDZFRjlDRDg0N0RDQkY3OEVDRjdEQ0E5NTE1N0NGQTVBRDY5RkYwQjc4MEUxOEU1OUNEOUQ1NjU4RTg2NzE5QUNDOEUyNTkyRUUwMjVBNDkzOTRFQTVEMjJERTgxM0JERjAxOTc2QUVENkI1NkJFRUVGNkI2MzVCNENCMjczMEVCQzBENUE0MDqJAQpAMDE4MkRDRUE4RUQ5Q0MwNkMxMDIxQzQzNjE5ODE3MTRFRDE4NzlFMUJBOTgzNEVGODNGQkMyRjdCRjEwMEY0QRI-NUJCRkY0QTAxODJGRkM2MEY2Rjg4REFCNzJDRUNDQTZGRTY4MkJEQTcxQUNBQkIxNjEyNEE2Mzc4NTEwRjAaBXN0YXJr",
+            "Cgt3b3Jrc3BhY2VfMBADGAMqpUYKCmNvX3NpZ25lcjMaAjAzMqckCoAEQzA0MjQwOUIwRDY3MjlCRjg2QkYzODFFRjJDQkQzNTM4QThENUM3QjY4Nzk4RTREMkVBMTQ2NDFEODIwQUI3MzczODNGMTg0NzM1OTMyMTY1OTAwQTU5Qzg2Rjc4NzRGRjREMzM1NDA2OEMwQzM1RkI0RDUyQzc5MTZGNkJFNUY3QjM5QTdGRkE5REZBOEY5Q0JGMDM0MUUyNDRBQzVDOUU0MzU0MTBFNzI2MzdFNTg5MEVDQjkxQzU2RTI5QUEwMzQ4Q0Y0QTRBNTM1NjkzRDI3RTk4RjA3MkM3RjkzMThGOUNGMzhCMEZDMDBBM0UyRDczMTQwRTJDNEI3NDg2MENGNDE0MzlFQkVCNzI5NEZCRDM2MEMyNkQyMEEyNTlCRTRDQjkyRTc3RDI3MTI0QTBDQkQ5MUUxOUFDRDVGQ0Q0QzlBMjQxNTAwOERENTA5MTRGMjcyMDRDRkIwNERBNkNBOUQxMEIyREJBN0ZFOTU0RkJCQzZEQzE3MEZCNjg1MEJEOEI5NjI0NzE0NjNENTMxRkNFNURCRjUxQzBDMTk0ODY1RjE5QTI4NzYwRkM5NTIyOTk0MDc5NDMxRTM2ODMwMjY1QUEzNzdCNDcyMkQxODIyMkY0NjhEMTlBQTNDQ0I0NTU2NjMyMzc1MDYyRTc2NDAzNEYxODZEN0I0MDkSgARDMDQyNDA5QjBENjcyOUJGODZCRjM4MUVGMkNCRDM1MzhBOEQ1QzdCNjg3OThFNEQyRUExNDY0MUQ4MjBBQjczNzM4M0YxODQ3MzU5MzIxNjU5MDBBNTlDODZGNzg3NEZGNEQzMzU0MDY4QzBDMzVGQjRENTJDNzkxNkY2QkU1RjdCMzlBN0ZGQTlERkE4RjlDQkYwMzQxRTI0NEFDNUM5RTQzNTQxMEU3MjYzN0U1ODkwRUNCOTFDNTZFMjlBQTAzNDhDRjRBNEE1MzU2OTNEMjdFOThGMDcyQzdGOTMxOEY5Q0YzOEIwRkMwMEEzRTJENzMxNDBFMkM0Qjc0ODVGMTM1M0Y5N0M2QjQzMTAwQkM3NEI1NEE5NUI2RDcwNTJDMDE3QUE5RTBCMzA1NjQxQTJCMTA4QUY0MTM2QkY2MzdGMTczNzRERkQwNzAxQkJGQTE3MDVDMDBCOUNERjdFNjg4OTc2MThFQzJGQjBEMzYwNDQxODFDMDIyQUI5RTgzQzQ0QTEzMjM5RkJDQ0JGRUZCQ0NBQ0QzOTEwN0NCOEU5NzhEQjgzNzc5Rjk4MzlBNkI5MjU5MzBCQjU4RjI2REMyRDk2QzdGMDIwRTdBQjcyOEEyOEEyM0Q1N0RDNTQ2ODk1MUJFRjZEMzA3RTk2NzE0Q0M0QjRFRUMwM0YxNBqABDM5MzNBQjBCRTlBQjk3MEU1OUI4NkI1RDQ4MzRFMDQ3NzUzOTk1NkZDNDc2NjFGOTg3QUVDNUU2ODcyMTBEQTE2RjQ2N0NCM0E5RTUwRDg4NjkyNzExMjI2QjIwMkRGOTBFMjNEQjAzQTFDMTcxRUI1M0Y3NkQzQkEyNzIxNDJGMzIwNzk5MUZFQTc4MEFCMkZBOEM5M0FGNzY3MTU4OUZFNzc4RTRBRUFBMEJFRjNCMEEyNTJGMjg3QjRGQUNCRENBN0VEODJGNUFCMEI5NkVEMUVCODgxMzUyRDlCMDExQTM3RjE0MEJGQTZGODJCM0U5QzRCOTZBOTQ0NkVDRkU2QzMzMTgwQUQxOTcwQjZBQzE4NjY4NUQwQkNEOTUxRUI5RjA3Mjk5MTQ0QzY3QkYwQTA4Q0M2MDc4NDg4MTIxNEFCMTU5NjExRDFEMjg3N0NFQkIyRTAzNzhFODY3OTgxRjZEQzc1OUFFN0Y0NzE0QkJBMjA1RDRDQ0JDRTM1MTA5NEMxQkJEQjA0RjUwNkQ3RDRCQ0I5RERDQjRFMjg2MThENkM4NDE3RjU1QjE5QjI1MzgzNEI3MkJDMjEzMTg5OEU3MDg0MTMxQkVEMEQ5ODVDN0E1QTlENDg4Mjk3RUEyNzQzODY5M0UzQzE0QzBDODkwMDQzNTc1RUVFMzI4IoACRTUwMDMxNDk2NjIwMUU3MzRERjA5MzhCRTE4RTU4NDE0NDg3NjdBNTk4NkJERTVEOTdEQzFCMEQ5NDc0NTAwRURERDBDOTJERjE1NTYwOUE4NDhCRjdBQjhCMDAzNzg1QUVFQzM5RjY0OTAwQ0E0NDM3QUYwMjBGQ0U2OTgxOUM2NDQwNDdEM0Y1NEFFM0NBQzE4NTVGODU4QzIzRjM3NEE2NEJDRDE5QzE4RTNDODc4ODFERjBBRDhCNzNEMkY1MDM0MjY2MkJDQTFEMTI1Q0RFM0YxMDQwRUJFMDU3Q0U0NjI5QTc0QjE1QzY2NTkxNjA3NzE0MDk1MTYxMjI1RiqAAkQ2RUQxOEQ4RUQ1M0ZBRDBBN0ZBMjNGMTk1MEU1RDA3RTAyQzgwQTNEOThBRERBQUQyMzA2RTI0QzUyMjUwNUFFRkIyMjM5OTEyMzE3MkIyOTY0Rjc0OTkzOTEzMzZBMkIzMjc2MEEzQTY3NzgzN0RCN0M4QUNCMDQ2N0I3QjAwNkI1M0QwNUMxN0NEQjM0QTgwQkFCQjg5MkZFNzlCRUJCOEExNDhGQ0VGNDgzQjA4MjM1MjdEQzZGRDA4ODE0QzUwQjY1REFGQkQ3Njc4MjRDNzU4RjY2MzYzRTE3NjFBMUM4NjkzMjhBMDdFMjIwNkE0N0M1QzMzNDZCNjUyOTcygARDQ0Q5NTgyRDVBMzJBNDlERkMyNzg1REM0RkM2QzdFRkMwQkI1NjJFNjQxNzk5MzdDNTY2QjBBQzMwNzgyRjFGMTBGNUFDNENFQzc0RkExNkVGNjk5OTE5NjRFQ0ZCMEVENERBOThBN0FCOUVDMkIyQUJCQ0YyRkYwNTM2MkZDMzgyM0I4MzM0REZCOEZCRjkwQzI0NzdFNkEzRkQ4MTNFMEUyRUI2NkQ2NEZCNTcyODcwQzNGNTc4NUQyRjRDMzJEMDJFNDJERTcyREM1OUNCQ0I4RTMyNjlGQkVDNEQwNjMwNDdCNUY3ODE2RDFGNkRFMDczRUZFNTU4QjA1NUVBM0YxMkZEQjhGNTgzRkUxNEZGRTRENDFEODYzM0VCRUI3Q0E3QUYzREM5QjgzNzNBQjZGNkZDRUNCN0VENDMwN0E2MzhDQzZCMkQzMTE0NDI3QkVDOTc3RTg5OTlFN0U0RURDMzJGQzI4NjE3QTZDMUUwRDQ5NTU1MDkxRjE2NkRBNTlDNkUxODQ0NkEwOTRGRUVFMjA0NDI0Mjg0NTcyRkExREU3RjQ4MDI3MkU2QTZBNDIyNDA4QzU2QzQzNzVCQzAwRDEzRkI5RDExRkVDMzg0ODdCRDc0MTI1N0MyOTg0NzAxN0FCRTM1NUZEQ0MxMzQ2M0RGNDkyRTlCNUY0MTqABEI0NzE0MTIxQjBEOTM5MjQ1N0YwMzJDQkJGNkEzOEE2MzQ5N0JGNUQ1OEUwRTREOTBCNTQ2QjE2QUYwNTEwN0MxQTBEQUEwQ0JDOTc3NzAzNDVERTI2MzcwNjdGRjkwN0U1RTlBRjMyMTUwMThDRDJBODM5MzM1RTY4MkM2RUExMDIyQTcyN0M4M0MxRDk1QkNCM0ZCQjg5RDlFQ0NFMUM2MTg4Q0I5OEVBMkU1QjQ0OTcxNjYwQUMzQzVFNTNDQzkzNTc2QjZDNDJCREI1RDQ5QzlEMDM2NDNCQTI2QjE3MkNFMjU3RDc5NkNCNzMwM0JDQjM5NzZGQjgwMkY0NkVDQzg2NjI5NDhBRTNGNEI3MDk0MkU3RDM0N0ExRjUwQzYyNjhDN0REM0NDRDA4NjVBOTY4MzI1MzlCMEIzNTNCMDRFQ0E4QzcwQjBEQjEyRUM0RjY4RUY1N0VBRURGNjk2MjExRUFCQTZBNEVFQjZEQzBDOTk2RDlERjcwN0IwRUJCMjg4M0IzQkE3ODM4RTg2NDdBQ0MwOUE0NDA0MjY1OUY2MzRDMkVBM0M0NjY0OEFENkY5MTlDNTgzNkI5QUNCRTA5NDQ3NjU4OTg1Q0VDRTRBRUY2QzYyRjJBQjg1RUZDQzYzRkEwRjA5QUZBOURDNUQxQTcyRTFENTkxNTExQoACRTUwMDMxNDk2NjIwMUU3MzRERjA5MzhCRTE4RTU4NDE0NDg3NjdBNTk4NkJERTVEOTdEQzFCMEQ5NDc0NTAwRURERDBDOTJERjE1NTYwOUE4NDhCRjdBQjhCMDAzNzg1QUVFQzM5RjY0OTAwQ0E0NDM3QUYwMjBGQ0U2OTgxOUM2NDQwNDdEM0Y1NEFFM0NBQzE4NTVGODU4QzIzRjM3NEE2NEJDRDE5QzE4RTNDODc4ODFERjBBRDhCNzNEMkY1MDM0MjY2MkJDQTFEMTI1Q0RFM0YxMDQwRUJFMDU3Q0U0NjI5QTc0QjE1QzY2NTkxNjA3NzE0MDk1MTYxMjI1RUqAAkQ2RUQxOEQ4RUQ1M0ZBRDBBN0ZBMjNGMTk1MEU1RDA3RTAyQzgwQTNEOThBRERBQUQyMzA2RTI0QzUyMjUwNUFFRkIyMjM5OTEyMzE3MkIyOTY0Rjc0OTkzOTEzMzZBMkIzMjc2MEEzQTY3NzgzN0RCN0M4QUNCMDQ2N0I3QjAwNkI1M0QwNUMxN0NEQjM0QTgwQkFCQjg5MkZFNzlCRUJCOEExNDhGQ0VGNDgzQjA4MjM1MjdEQzZGRDA4ODE0QzUwQjY1REFGQkQ3Njc4MjRDNzU4RjY2MzYzRTE3NjFBMUM4NjkzMjhBMDdFMjIwNkE0N0M1QzMzNDZCNjUyOTZSgAIyMUYxMjBCRUNEMTkyQUJDODgzRkY2Q0E0NTg0OEVENzBEMkQ5RTBBNzdGMDZDQTM3QzNFMkE3REEyRDEzNDdENzY5RkQ4NTJFRjJGNDAxNUU2RjQ4REY1RTYxMTg3RENFNjc2Rjg0MjBFNjIyQ0E2QzVFNEY0QkJDQ0M2ODczMEI0NDY5MjlBMDVBMTFDM0MzQTNEMjg0RkNCMkU5OUEzMzk5QUU5OUVCOEJDNjBENTI5MkI1NDU1NkVBM0ZDRjMwMjAyOUM0MzFBMTkwOTRBMjQ0MTlGM0JGOTBFRUU2NDE4QzlBRDJBNjg5RDVBMDgxNzZFNzhBMEQxMUI4MzEyWoACQjcxMjAyQzAzNTNGNTM2RjgzQTE3OEU2M0Y4QkM1MDdGQjg3MDA0NDUyRjI5RjA4MDMzQUNEQzFEMjE3OUI4MkEyNTdCRUI1OTM1RTI1MUJBQ0Y4NjAyNjlCOUQwQzhBOUQyQkFFNUMxOTQ4MTE4Qjk2NzE0RkJFRDc3M0FDMTYwQUQ1RDU3QzEwOTIyMDExRjdBN0EzNjk0RTNERENFREYyRjZDRUExN0EzNEFGMjRDNjFFOTM5QTk5QzFGNjc3QkU5NEI4MDIwRTkxMEE5NTQwNTE0MTM1QjdCRDdCQTZBNzAwNzJGRkY5RDFGQ0FGNDlCRjYwODAxNkE5M0JENmKAAkMzMEYxMDhBOTkwNkYzQjZDNUIwOUNDMTlDMDlDOTZBMzc1OUM5OUIyMDdCNzFCQTFCOURGMDhGRjFBMzFCOTE2NzMwRjBEQjAyMjYyMDg0OUQ5NzY5QjVBNEVFQUZBOEM4NzU0MUI0M0E5RTlEOUQ3MUNBMEQ1NDAxQTJGQTZCQUZGOUI1MzlFRkE5Qzc4RTg3NDgzNzM1QzBGNTU5RDE2Q0IwRTM3QjA4RDFEQkIyNUVGMjlDNTgxQ0NGRDYwMjAxM0ZDOUU4QjAwNDA5MTJCOUZENzEwNEYyRDE2OTZBMkQ1RkZBMjBBRDI5MEI4OTQ5MDg5QjY4ODA0NTlGNERqgAIxRkRCMTYxOEI4MTRBNzYxMjQ1OEFCMEI1NTgyOTdGRkU0QTU4MDVGODY5ODNFQTJDRUY1QTA2MkYzMEFCNEQ4NEQ1QTY0RTM3RUQzNEQ5NkU5NTcxNDcyOUQ3NjJBMTgxNUZCQjI0NzhEMkY3MUYyMjE1NzVDRjE2RjA3Q0VFQTYwN0RGQUUwMDczQjkzMzg4OTEzMTgxRkUxQTlCRUZEQzVBQTdBNUI3NTEzOEJFMzVEMzNFQTJDNjM0NjhBRDQ5MjIxQTVBREFFRTU2RDhGODcwN0I1MkRBQzIzRkE3Mzc1ODYyMDI4QTZBQzI1NTc1QUJDRkJCMzMwMEQxNkMxOoYICoAEQzA0MjQwOUIwRDY3MjlCRjg2QkYzODFFRjJDQkQzNTM4QThENUM3QjY4Nzk4RTREMkVBMTQ2NDFEODIwQUI3MzczODNGMTg0NzM1OTMyMTY1OTAwQTU5Qzg2Rjc4NzRGRjREMzM1NDA2OEMwQzM1RkI0RDUyQzc5MTZGNkJFNUY3QjM5QTdGRkE5REZBOEY5Q0JGMDM0MUUyNDRBQzVDOUU0MzU0MTBFNzI2MzdFNTg5MEVDQjkxQzU2RTI5QUEwMzQ4Q0Y0QTRBNTM1NjkzRDI3RTk4RjA3MkM3RjkzMThGOUNGMzhCMEZDMDBBM0UyRDczMTQwRTJDNEI3NDg2MENGNDE0MzlFQkVCNzI5NEZCRDM2MEMyNkQyMEEyNTlCRTRDQjkyRTc3RDI3MTI0QTBDQkQ5MUUxOUFDRDVGQ0Q0QzlBMjQxNTAwOERENTA5MTRGMjcyMDRDRkIwNERBNkNBOUQxMEIyREJBN0ZFOTU0RkJCQzZEQzE3MEZCNjg1MEJEOEI5NjI0NzE0NjNENTMxRkNFNURCRjUxQzBDMTk0ODY1RjE5QTI4NzYwRkM5NTIyOTk0MDc5NDMxRTM2ODMwMjY1QUEzNzdCNDcyMkQxODIyMkY0NjhEMTlBQTNDQ0I0NTU2NjMyMzc1MDYyRTc2NDAzNEYxODZEN0I0MDkSgARDMDQyNDA5QjBENjcyOUJGODZCRjM4MUVGMkNCRDM1MzhBOEQ1QzdCNjg3OThFNEQyRUExNDY0MUQ4MjBBQjczNzM4M0YxODQ3MzU5MzIxNjU5MDBBNTlDODZGNzg3NEZGNEQzMzU0MDY4QzBDMzVGQjRENTJDNzkxNkY2QkU1RjdCMzlBN0ZGQTlERkE4RjlDQkYwMzQxRTI0NEFDNUM5RTQzNTQxMEU3MjYzN0U1ODkwRUNCOTFDNTZFMjlBQTAzNDhDRjRBNEE1MzU2OTNEMjdFOThGMDcyQzdGOTMxOEY5Q0YzOEIwRkMwMEEzRTJENzMxNDBFMkM0Qjc0ODYwQ0Y0MTQzOUVCRUI3Mjk0RkJEMzYwQzI2RDIwQTI1OUJFNENCOTJFNzdEMjcxMjRBMENCRDkxRTE5QUNENUZDRDRDOUEyNDE1MDA4REQ1MDkxNEYyNzIwNENGQjA0REE2Q0E5RDEwQjJEQkE3RkU5NTRGQkJDNkRDMTcwRkI2ODUwQkQ4Qjk2MjQ3MTQ2M0Q1MzFGQ0U1REJGNTFDMEMxOTQ4NjVGMTlBMjg3NjBGQzk1MjI5OTQwNzk0MzFFMzY4MzAyNjVBQTM3N0I0NzIyRDE4MjIyRjQ2OEQxOUFBM0NDQjQ1NTY2MzIzNzUwNjJFNzY0MDM0RjE4NkQ3QjQwQUI-Q0VFNkJCMTkzNUQ2NDY5Nzc5NzM2NDc1QzI2QUEzOTE2MUVGMDhCODIzMTUxNEU4Mzk0NEEzOTI4MkI0RjZKiwEKQDA1RUFBMzdGMjc0OUM5MUJBMjk4M0Q5MTVEMTA2MEE5OUUyNzI2Q0U0OTk4REUwNzVBMDYwMDBDRDJGQ0NFQUQSQDA0RjE4RjU2Q0FCMTI0OTIyNDA4MzkyOUNFQjc2OTU3RjRGM0E3REIwOTNERDAwQjYxQ0Y4OUIxODIxNzczMjkaBXN0YXJrUoAEREQwOEM1NkRFNkJDREM4MERGNTlFRTYyMUExMTI4NzNDQkZGRTk0NUZFQUNGQzBGMTkxNUMxMkZGRkQxRjc0NDZGNkI5RkUxMDU5NTc1N0ZENjNGQjlCMDk2MEJDQTgxMDdCNTk2QkUyMjg0RTVCMUJDM0NENURCRkYzRTg2QkRDNzgwMDQ4ODlEOTEyOTcxODYzNjcxOTk2QTVFNUUyMThDRjNDMjhBQUQyMkU1OEM4MkIzQzQxNzEwMUFFNTAxMDdFMzZDRDRDMzZERjcyOTZFRjFDMjdEMzM1RUExNERCNUI3MDVBQkM2QkE1MjBDQTk0Rjk1QTk5MEQ4NUFDNzVCNzIzMTRBREQ3NzdFMUEzNzNGQjRFNjU2ODBBMTg2RkQ1RDUyQkUzRTM0QjM3RjAxMDJCMUI5M0NENEJBRkQxQTY2MjU1MjJDMzIzM0Q0NjQyMjQ4NkU1QTNENDg1RkFFNTM0RDhFRDg1OUM1QUYxQTcwRDkyODdENjlFNkJENkY5QjVEMDg4NkI1RkIyOTc0QkEyNzY2MDA1QTE1QTc1NzUzQjE3RjgyNTIxNDBGRjFCNTI3RjUxQjdDMTBCNThEOEQwMUY1MDdFQ0M4ODkyQjVFOEIyNjkwQjIwODkwMkQ3QjczMzcxNjI0RTJDM0NCRTgzNjc5MUIwN0IxMkRagAI3RkY5RkZFMDdFRUI2NzIwQjQwMTEzQzE0RTY2RDlCNTc5N0IxN0Y4MjgwNUQ4ODZGNEQ4MUVDQTgwQjUzOUZEMkMyQzkwOTYyQzkzOUY0RkM4RjU5RUMzRUJFQTRFMTNFNzZDRkI0ODVCNzM5QTI2RTlCMzhFMEZDMTI4OUU3MTBCN0Q4M0E2Q0ZGRTI4NDk0M0YyMDQ5NDNDRUMzNDNCREM2NTRBMzIxNUQyQjUxNkU0NjU0RTY1QzFGOEJBNDJCNjY4Q0FGNUU5MTRCQkFDNDQwMTU4NzhCQzMxRkMyMzkyMDVGOUExQjI3REIyNDQxNzFDMTEzMjhEMzFBN0Q5YoACNkU4OTkxNDRGNzYzQTM4QTZBMzI1QjgxRTM2QjU1ODQ2MDFGRjBDNTk2NzJFQTJGNzU0QzY0MDk3NkU3ODk1MDVGOTVBQjRGMzc3MThFQzJERTFGMkJBMDdBNTMwNUZFNDNDOUY1RjUwRENGNENFNDYxMEQ5MkEwQzIzNUJGNUIwMTI5NUFDRDI0MDMwNDUyRjhBMUQwRkI1M0I2QUI1OUIxQUY2QzRGQ0I0QUIwQjcwRjQwRTk3NDEyRjM2Qzk2NEE4RDM2NzQ1QUJBQjQzMjNENzlBQUIyNzQ5RjAyRDA5QkU0QTYwNEY1RjlFMTkyRkFBNDc1RUI3MzkwQzVDRmqABEFERDkzMzRGRDczM0RBQTk3MjMzNTlEODFEQzIzQ0E5QTY3M0RGNjEwNTlBN0E5NzZDNDg4MTJDNTJERUQxNzM1RkU3QTIwN0JCMDExOTY3QUZGN0I0MTFGMzUyMzExQjM0MENFODFGRUJCRjcwNkNGMTNGNTg4QzU3RDIyM0QyODhENEZDNUU5NENFMUUzOTYwN0YyNjcwNzc4QTg3NUIzMDhBRkJCQkY0MDhFRTgwQTUwQzc3RkUyMEE0RUQ2NjhDQjY4Mzg2OEZBQ0ZBQjU1MEJBQjUxMTdCNzBBNzAwM0Y3M0EzQzg4REEyMzgzOTk0NTE2RTRGRkM2NThCRDBCQ0RFMzU4QjRFNkIyMjU3NDdGNTk4MUNFM0Q1N0ZGN0Q0ODU2Rjc0MjQyQTZFNkU1NEM5REZFNzYyODVFNjdCMDlEQzA2NDRCOTgzRkY3NTU4N0NDNjU3QUJGQjM4NzJBQ0Q4N0UwRUQ5RDQ2RENFQkI2NTExRjczRUVENTFDMEEyREEwQ0E3REZFQjJCRjEzNURDRjZFNEMwRTBDQzdEQUQ0MjY1RjlERkFGNEFDODdBQzYyOUZDRDE2QTcwQzVBMEU4MDZFOTc3REJFNTg5Q0Q1Mjk2MjAzMDFFRjgxMDEwREM5QTQ2MDUxREE1MzI5NzBDRTAwNkM2M0VENjZBcoAEQ0U3QzAwNDhBNEQ4NEVBN0FGODVBOTM4QzYwMjZCNDgyQ0Y1Q0JBNUMxQTU1OERCNjI4RjdGRDY4RjBDODRGNUYwOTQ5NjJEMzk0RUQ1NDJGMUE3N0Q5N0RGMjREQTIzNzdDMUQ2QTE1Mjg5RUFCOTk4QTI0NjhGMUFDMkE0RDZGN0I2MDJGNDg1NzZFNEFBODZEN0FFNzAzNEIyNDEzQzA2QkNBNDMyODc3Njk2RDRFRDQ4NkNCRjdDODExRDdGREE0Q0MxMEQ1MTMwNzUzNEYxM0E2QjMwQTE2Nzc2Nzg1Qjc5ODEwQjFBNTgzMEY3MDA1NDE5Qjc2QUFDNEYzNzJGRjk4OUE2MURFNzZGMTczOTRGMjc5Q0UzOEREODU2NUI3NTUyNURBRDZCMjY4NzI0RDM3ODBGMzlFNjYzNDZEM0FCNEI4NjU4NTNFMjlEQzNGNzIxQUY1Q0YzQURENjRBMzAzMUY5NjVEQjQwRUU2NzdERTRDNTQ2RUY5Q0Q4NDdEQ0JGNzhFQ0Y3RENBOTUxNTdDRkE1QUQ2OUZGMEI3ODBFMThFNTlDRDlENTY1OEU4NjcxOUFDQzhFMjU5MkVFMDI1QTQ5Mzk0RUE1RDIyREU4MTNCREYwMTk3NkFFRDZCNTZCRUVFRjZCNjM1QjRDQjI3MzBFQkMwRDVBNDB6gARCRDdCRTlEMjBBOUEwRkY3MUZFREY0REUyOUY3QzA3RUM0RDY1NkZEMTY4QTg4OTJEOEM0RUZBRjQwMzdCMDg0N0NCRDk0RjlCMTRGQ0IzNUFEMzkwMUVCNzQyRTJCQjU5RTUwQUZGMzVEREUxMkFCMTg4RUQ5NDYzMUZDMUU0Njk2Q0ZCNkI2RjZCMjlENjBBMzlFRUI0MUIyRUQ0Mjc5NEU5NUM1QkNBRkZCODBGQjMyOTQ4MDlCRjY3NDcwQzg3RkJCMEIxRDEyNUIyNDRBNjM2MDBFNzU5NDExNUY2QzUyMkNDQkRGODM0ODZDRjdCNzM0NzY4REEwRjE0QzcwRjAxRkVGQjYwNUQ5MTRFQzJBNDkwM0YxREVFMDNGMEUyMTY5MkEyMzY3MTcyMkZFOUY2Q0Y1MkExRTE4REQ2OTc4QzE5NUYyRjQ5OEY0QzQ5RkJERkM2QTJFQkFBRUUxRkQ4MTI0NEJBODdBRjAzMTE5NDg5NDcyQUI3NTNENjU0RjA5OUZGMEU2NzE0MkRENjhDRENFRUQzMEI1MkM4NTE4REExQzEwQ0YxOUNEMkM1QUQwRTA4QjA5NkFCM0YzODIyREUxNjJENDIwRUJEMjBBRjNDNUU5OTQzMTc5REEyRDdEQkY2NTgxMUM4MzI3NzFDMEM4MjlGRkIzRUUxNIIB_gMxRjlFODhGNzk2NjFDQzQ4MjlFNjFBREFCNzdGNTJBMjdENTk2MkY1ODk3MTFBRDI5MENDRkFBNTE1QTE3NTBENzQ2NEFBRTRCQzlERDQxMzgxMUFDQzlGRkVCMDA1RDM2QTYyRjU0RUZFQzkzQTgxMzg0NDRBRkRGRDk3QUZFQkQ4NEFBREM0QjFENjM3RTI3QjYwNkM1ODRENkEzRTVGOUIwNDM1NEQ4QTBGNTFCMjQ4QTM0NTlDNjQ3MzY1RDI5MzNGNDk4NTA2MEQ4QjM1OUNFQjczMjNDMTA0MDlBMzM1MTJBOUNGOTM3REQ1RDAxRDI2QzQ5NTJCRkVDODlGNzhDQTBGQjk0NzRDQzFCNjBCNUE2MjVGNDU0ODBCRjVBMkU5RjVCQTE1ODE0RDZENzQ4MkUxQzg1NTc5NUM4MUE1NkFCMzNENDY3Q0ZCRDgwQjNDMkM4MzM0QTdDNUFDNTY1NjcxOEVEMENBMTMwRTIzNkFFMTI3RUNFRjIyNUU4RDkyNUJBNjhFRDk5MDFGMzI1NkJGMDcxOTI3MDMyNjYwMjRGRjNFOTk0RTVENDkxODg5MjcyNjdBNUEyMTc0MzRENjA3MEJERkE3NTE1NDVBMzMxMkMzQzA0OENENUQ5ODk4M0ExRkI1NEQxMzQzNjAyRTFCM0U2N0Y5NUQysBUKCmNvX3NpZ25lcjEaAjAxOoYICoAEQzE1MDA0QzkwOTg5QTY0N0I2NUE0MzM2NTEyNkEwMDdCODNFMjdFM0IzNTJEMDNCNUFGRDg2ODhCNTQ4RUI5MUU4NERGRTRBQjkwMjc4MjQzMTE3OUU4MjQ4M0EwQjNFNUFBRUFBNEYzOTFFMUQyNEMxMEQ0QjNENUU2RDY3Q0I1QTdDNkJDQzU2MEZGM0U2NTY3NDRGRkE4NjY1OEZBRkEzQjM2NzM3ODMwOTQzQzg1QTFDNDNDNjdEMDg2MzZBRjVFMjU1MjU5MzMzQUIzNkFCM0U2MUI1OUVCMzQ0MThENDgyNEJFQjdCMjdBQzMxMDg0QzQ0RUJGQkVERjIzOTAyOTVCQkI2RDREMDM1MUZENkJFNzFFQzlFMDlDQzM3MDJBRjBBQTI3NzY4QTlGMDU2MTgwQ0I3OEQwQkRCRDNFREI4MDNBMjE1REIxRjM3OEE1NkU5NkMxRDMzMzJEMDE5MTM4RDA3N0U1MUJGMjgyQTVGMTgxMTFFMTgwNEY5OUNGQTc5ODdGQzExMzlBRkIwN0NDQjkzNkIxRUJFQjFFODlCRTA4M0I5MzIyMzU4MjhGQ0NBMjQ4NUVGNzdEODMyMjdGRTY1NEY1RDJBRjlFRjNDQjQ5MTc1MTQwNDgxQzBGMzFCQjlFRDNCNThFNTVDM0UwMUEzNzMyNEVENUQSgARDMTUwMDRDOTA5ODlBNjQ3QjY1QTQzMzY1MTI2QTAwN0I4M0UyN0UzQjM1MkQwM0I1QUZEODY4OEI1NDhFQjkxRTg0REZFNEFCOTAyNzgyNDMxMTc5RTgyNDgzQTBCM0U1QUFFQUE0RjM5MUUxRDI0QzEwRDRCM0Q1RTZENjdDQjVBN0M2QkNDNTYwRkYzRTY1Njc0NEZGQTg2NjU4RkFGQTNCMzY3Mzc4MzA5NDNDODVBMUM0M0M2N0QwODYzNkFGNUUyNTUyNTkzMzNBQjM2QUIzRTYxQjU5RUIzNDQxOEQ0ODI0QkVCN0IyN0FDMzEwODRDNDRFQkZCRURGMjM5MDI5NUJCQjZENEQwMzUxRkQ2QkU3MUVDOUUwOUNDMzcwMkFGMEFBMjc3NjhBOUYwNTYxODBDQjc4RDBCREJEM0VEQjgwM0EyMTVEQjFGMzc4QTU2RTk2QzFEMzMzMkQwMTkxMzhEMDc3RTUxQkYyODJBNUYxODExMUUxODA0Rjk5Q0ZBNzk4N0ZDMTEzOUFGQjA3Q0NCOTM2QjFFQkVCMUU4OUJFMDgzQjkzMjIzNTgyOEZDQ0EyNDg1RUY3N0Q4MzIyN0ZFNjU0RjVEMkFGOUVGM0NCNDkxNzUxNDA0ODFDMEYzMUJCOUVEM0I1OEU1NUMzRTAxQTM3MzI0RUQ1RUqLAQpAMDQyMjNCNkU4RUFBMzBCRDAzQjlBNTNDNzFDMUMzNUU0NzM3RDE0NEQ4OEY1RDdCMUM2QzdBRTJGNEQ1QjE2QxJAMDNDM0UwNTUyMUM5RkM2RkM1NzRBOTFEMDMxQTYzRURBNDRFMzc2OTYwMDVEOTM4Q0M0Njk2Mzk5QTI2QjI4QxoFc3RhcmtSgAQ5Nzk1MDU3RjY5MDAwRjUzNTU5OTE5OUM1RjU5NkNBODcwOTMwNEYzQkZBRUQ5MTBENDc2RkRGQkIxQ0EyQ0JFMTk2MTk2OUI1MEEwOTA3NTIxMTkyOTRBOEQyNDA3NTc5OEMyRTg5MDZERjI2REM4NUVFNzI3QkQzNThCRDgzOEVCOEQ2QUYxNjY2MkEyNzg2M0YzRENERTBEMzAxRjU3N0M0RURBRkRBOUVEQzY4MkJGMzcwNzY0OTc3OTYyOUQ3RUI1QUFFQzg2MzFEMzZGMjY4RTQzOTkxRTA0NzZGN0E1RUMyQjU1MjkxNjQ5RDY4NDhFN0ZCN0QwNjUwMDcxMTVCMEY1RkQ3M0I2Mzc2Njc0QTE3RjA5QjNCNDdGQkIyRTExMEFCRUU1Mzc2OURGQzkzMjgyQjc1QkFENDBFNDFDMzg5NTRGOTVEMEUwOTg1RTY3MDA4ODFDNzA4MzMxMzA2RkYwQ0JDOEZFMUQwRTRCMzYwRDNFQzc2N0QyNjNGNDA4NURGREY1QUY5MjEyOUU0RTM2QzdGMDc5ODU2REI4NTUyQjBEM0RFRkNDNzFCMTM5MDAxQkFCMEEwQUM1Q0NGQzVCQjU4RDYxMkNDRUI3NTc5NEZDQTg5QUJGQTU5ODdDMjBFRDVCNUNCNUVDQkNCMDFFQTJBOTVDNjQ4NWqABDcwQkVDODYyNzkxQTk4Mzk5MjQxRkREREJCNzJGMzI0OTRCM0JERDVBQTcwNzQ3RUNFOTFDM0Y3RjI0RDZBOUQ1NjAxOUE0QjFCMTlGM0VFRDQ5NTlDOUU1QjUyQ0MzRUQ3MTAyMkUyNjI3MUEyMjEzMDMzNUZEQ0MxRkQ1ODRFQTZFRTI3NkU1OUY1NUE3RTRGMUVCNjlBRUVGREQ5MzE0QkRGRTgwMTI4RDUyMTJENTU4OUQwNzRFRDhEOEZCRDg4MUIzQ0JCN0FDNDEyNjdFQTU0QjM1ODcyRjRBMjc3M0RBMTEwMDI5ODIyRUE5OTc2QkQ5RUM0QTFFMDY5OTEwMTc2ODBCM0M5OEQwODJCRkE3RkI3MDM5Qjk3OTk0RTJBMjczOUYwRTNFQzQ4MDRCNDU1RDVFRTIzNzExRTY0QTM1MzdFRjEwM0I3RDI3RDdGNzZBQjFDOTA0Nzc1REIyMjYwMzY5NEExMzhCNzI0RTA2MTI3RDlCQURCRjRBRkU1OTNDOTlEMTNDNTdFRDkzMDdFMkY1RERGNTBEOEEwNDI0MUYyMUIzMzBCQUE4OTZDQkQzNTYxNzZCMDU1ODMxREE1Njk1NzRDNTk0QTBFQzYyN0MzMzRCRjIzRjc5NkRBMjg2MzBGRDdDRUQwNjA3ODQ0NEE4MjE1NUVDNzdFcoAENTExQ0QzRDFDQkExOURCRkY2Njg5NDlGQjc4MkI3MkE1QUVFRUE2MjM1QzE4OTRCRjVGNTNEMjg5N0QxODY4MzM5NTcxQjg4MUNDQjIzRDU4QjQyQzA0RDc5REUzMkQyQURDQzY2RjBBOUM0MTA5MjJBMDA2QjIwMDFEOEU1NzdBMDE3OTZCRjZDNEU5QTdBOTg5Rjk2RDI4MTFGMzZDQjAwNzE5QjhFNkU4Q0E4NENFODkyNzJFOTU1NENFM0M0ODlFOEI0NDU1QUM2MkY3MDRFMjI1RkQ3MjBCQUYzNjkzQjE1NUMzMTNDQkZCQTE4RTY3OTBEMUVGOEFBRDM5MEE1MjgyQ0ZBRkI3OERGNkFBODVDMUIzRjU5OUU0MjUxNUIwMkY1RDhBN0U5RDFEOTM3NjI1Q0FDMjA2NzcxOEI0M0M2QzQ2QUY2QjAwNDM3ODFFOTg0OENBQkUwMDc3ODkzQjVDODk0NDlDRDkzMjVBNjkyRkU1RTg5RTcxMENCREFEOTZFOEI2RURCODJCODQ5NTI4Nzg3M0IwQjJFMjM4OUQ2NzhEOTY5Q0RGQkEzRDRCMjBCMEY5MDdFQTA1NTJBMDBDRjBDQUU3MjZFRTdBM0FBOEFBQTAwQzU2MjYyN0NEM0I5RDZCRjdGOTMzRDFEQ0JFNjMzMEE5NTMyQkEysBUKCmNvX3NpZ25lcjIaAjAyOoYICoAERUI0ODFENjY5QzJFODZBMUI3Qjg2RTM5QjA4MEMwMjZDQzZENUIxNzY3QUY3NTJCNDEwODY3QTExM0U3MTU2REM5QTJGMTgyQUMyRjI4MjdEMDY5MjFDODZGMUMzRUE1QzI3Njk4REUxNTI5NDQ5MzM3QUQwNTNCRTIyREFDNjZFNDYwM0U0REIyRTYwMTQ3QzZFOEM5NkE1QTJFOTVENDExQkM5RDU5M0Y0OUM5ODNFMjQwQzNERjUxMzMxRDA1RjkzODVENzVBMjkwMjU4MzZFQzg2NjVBNEMwNzM0RUFBQTNFRTY4OEFBMzE3NDRENkUxMDNCRDRCOTE4MzE5MzU2MzA3NjgzRkYwRDY2REE2OTA5OTIwNzRGN0FFMTI3RUY5Qzc0QzdDRDI4RkNFNjYyQUIzRTA1RDA3QTUxM0E4MTBGNUJEMzYzOUNCMjI5QkZDMzNEM0Q3MzA1MjY2MzUxREY4RkNFNkQ1MUJGOUQ3NTlGREQ2RUJCNDI4NzE4MDk4N0VGMzhEMUM1RDZFMDE5MUEwN0E2RDM0RkQwNjg2NTJCNjY1NzFGMkI3M0ZFMjQ4MEJGMTE2NzBCOEVBRjQ0QUQ5OERDRkQyNDM3Qzg1NjI1MzEzQTQwODczRUNCRTY0MEM5NDNDQkI5NDQxNDM3REIxREFBREI4MERCMTUSgARFQjQ4MUQ2NjlDMkU4NkExQjdCODZFMzlCMDgwQzAyNkNDNkQ1QjE3NjdBRjc1MkI0MTA4NjdBMTEzRTcxNTZEQzlBMkYxODJBQzJGMjgyN0QwNjkyMUM4NkYxQzNFQTVDMjc2OThERTE1Mjk0NDkzMzdBRDA1M0JFMjJEQUM2NkU0NjAzRTREQjJFNjAxNDdDNkU4Qzk2QTVBMkU5NUQ0MTFCQzlENTkzRjQ5Qzk4M0UyNDBDM0RGNTEzMzFEMDVGOTM4NUQ3NUEyOTAyNTgzNkVDODY2NUE0QzA3MzRFQUFBM0VFNjg4QUEzMTc0NEQ2RTEwM0JENEI5MTgzMTkzNTYzMDc2ODNGRjBENjZEQTY5MDk5MjA3NEY3QUUxMjdFRjlDNzRDN0NEMjhGQ0U2NjJBQjNFMDVEMDdBNTEzQTgxMEY1QkQzNjM5Q0IyMjlCRkMzM0QzRDczMDUyNjYzNTFERjhGQ0U2RDUxQkY5RDc1OUZERDZFQkI0Mjg3MTgwOTg3RUYzOEQxQzVENkUwMTkxQTA3QTZEMzRGRDA2ODY1MkI2NjU3MUYyQjczRkUyNDgwQkYxMTY3MEI4RUFGNDRBRDk4RENGRDI0MzdDODU2MjUzMTNBNDA4NzNFQ0JFNjQwQzk0M0NCQjk0NDE0MzdEQjFEQUFEQjgwREIxNkqLAQpAMDUwRjlCRTUxRjU4QjhCRjU5NDIwRTU1RkZFMDUxMDExRjdGMDhCNEVCQ0Q2OUNBNjFDNEMwREE4QkZENDNDORJAMDU0NjM0QTRDODc1MjgzQzRDMENBM0E0QjQ3MTZFMDhBMDJEQUYwRjk4MDE4RTFEOEJENzBFN0YxQUFBQTdFNRoFc3RhcmtSgARDNTkwMkRCRkU4MTU3OENCMEQ3OTM3NDNBQjM4RDU4Qjg1MUZGMkNBMzUzQkQzNzhCRkJGQjU1NEZDMDQ3MjAyOTJCMTk5NUY2RkM0RUNCMjQ0QzZBODBFMjk1Nzk1NDA5MDFFREE2MERFNjdGNEVEMzRGODM5MDFGMUM5OERGMUNFMUI0Q0RCNkUyNDUzNjE3QzQzMkVENDY2MUVGRkYyMDJFQjM0NkE5ODBFMjA4OTc1MzI0NTYzMUM0QzNBODA1QUVDMTI2RTgyMzU1NUNGNEREMTM2MUYxQjU2NTQyODZFQTQwRTVGM0ExREVDNDQ2NEJFRTkzNzFDMUQ3RTA0MDVGRDI5MTc3MDZCQjJBQjJCRTIxNkQ2NUVGQUFFMDlFQzgzQzAxNTM2NDBEMTVFODE4NkMwQUU2RTBFRTZCMTEyNkI5RDdBMTFGQTA0RjkwMDQyNjE4QUNEODNDN0IzMzRDOEY2MkYyODA1OUNFMEQ5Q0UzOUJGNDA0RTdGMEIxOTkxMEFBQzUwQjExODE3MjY2MkFEREM2RkRFRjEyRjBFMkY1MTY3RDFERjZERjA5MTA3ODgwNUU5OUY1REFFMTg1QzU2MEJBRjdFM0VFOTk0RjA4NjZCQjQxQ0RFQTg4MERFNjFFMDQ3OThENEVCQzk4NzExQ0NCQTFDOUY4MWqABDVDMjhEQ0RBODI4MkRGMzUyMkJBNjkyNTBBQjIyQ0UyOUJGOTg5MzlBNEIwMEMzRDAyQUZFRTcxNEI5OTA5OUYxMUI2RjQxMEZBOThDNzg1NzY3MkNGODNDRjQ0RDZDMzZFQUU3M0MyREUzQjk2NDJCMTQ1QzUyMDRCRjYzMEExRDlCMTAwNUM5NEUzMkEwNUIzMDdGNEQ0QjlEMUQ2QjgyRTEwNUU5RjFERTA5NUNBOENGODRBRUQyMzBGOTVGNDNCNUU1MURDQ0VDQThEMDg2RkNCNDJFNjk1RjIwMEVFMUZGNkFBRjY0MDU0N0UwOUM4ODlDMzdGNUNEQ0Y2MzlFQUFCRThCNDhFMTc3RjY1MUE4QjRFMjAwN0MyNzIxOTU0REE3QjcxODdBQTFBQUNDMzM1RUM3OUVEMzdBMkVCODY3QjI5M0NCNzNCNkUyOTk0MzgxQjJCRkFCOUE1QUU4N0ZCRDQ1ODZEOEYxOTdCMUVFQ0UxQzVDREI4NkU1Q0I5MkY0NEQ1QzgwNzIwQjQ4OURCNTE3MjM3NTc3NzU2OTg0RUNERUFFQjRDMDE1QzhERjkzRDJEQTUzMUEyRjJENEJFOEI0MTg3RjMxNTM1NzY2NjE5NTdBNkJBRUY2MzFGMjFBRjJEODEzNUM4NkY1MUU2ODhGN0FEMUVBQkY2coAENTJFNDA1M0U2NjNDRTRCMDUyNUJCRUY1QzNDQUY1NEE0NjcxMDg2QzNDNzMzN0Y1ODg1NEI1RUMzNkVBQkJCMDdBNTI3RURERUE5RTNGRTk4M0VFMjI1NjM1RjU3RDhFQUMxODcwODQzNjUyMTJEQUI4RTY2MURCRUI0OEYxQkM1RjdDQ0ExQTMwMjEwMEI5Q0U0MjE3RTdGOEUwNUE5OEE2NTU1M0JGRDQ5Mjc0RjJBRDBDRUMwRTRDRkM5MzBEMkNCMUQ3QzU1RkJBNDgwMDk0NTBCQjM4NjdCQTk5RTIwQTVCNzlCMUVBRDBDMzgwRDgwRTA2RUQ1NDI2RjJFRTE4RTM2RERBMDREMzYwOTczRDJDRTk3NTFFNkY5RkFBQjg3NEE3NDc2ODkxN0IxMTJDNTkyMjZFMEFEMjA4RUUzMTMzNTNDRjNFMjFCRTNFNEU0OTAwOEMzNUI5NEY5OTFBRkU4MDU5QTIxMzI5M0IwMTA1RjhGNjE2QkMxODI5OEFGRTQwQUE5MjUwRTYzMDMxRDcyOUVCMDYwNjg5MjM5MTlGRTMwMUQwNUM3MDQ2OEI3REU5N0Q5QkQ1MjU5N0JBMDdBRkI4OUJFQjA5OTc1RjY2Q0I4MDhGNzRBMERDOURGQjk1QTJEOUMyMDk1MzM5QTVFOTlGMzgyNzUzRjI6iQEKQDAxODJEQ0VBOEVEOUNDMDZDMTAyMUM0MzYxOTgxNzE0RUQxODc5RTFCQTk4MzRFRjgzRkJDMkY3QkYxMDBGNEESPjVCQkZGNEEwMTgyRkZDNjBGNkY4OERBQjcyQ0VDQ0E2RkU2ODJCREE3MUFDQUJCMTYxMjRBNjM3ODUxMEYwGgVzdGFyaw.."
+    });
+#endif
+    testBatchKeyRefresh(wallet_key_arr);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
@@ -5,9 +5,15 @@
 #include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/message.h"
 #include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P1Context.h"
 #include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P2Context.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P1BatchContext.h"
+#include "multi-party-sig/two-party-ecdsa/lindell17/key_gen/P2BatchContext.h"
+#include "multi-party-sig/mpc-flow/common/pail_key_pool.h"
 
 using safeheron::two_party_ecdsa::lindell17::key_gen::P1Context;
 using safeheron::two_party_ecdsa::lindell17::key_gen::P2Context;
+using safeheron::two_party_ecdsa::lindell17::key_gen::P1BatchContext;
+using safeheron::two_party_ecdsa::lindell17::key_gen::P2BatchContext;
+using safeheron::mpc_flow::common::PailKeyPool;
 
 using safeheron::two_party_ecdsa::lindell17::key_gen::P1Message1;
 using safeheron::two_party_ecdsa::lindell17::key_gen::P1Message2;
@@ -79,6 +85,64 @@ TEST(lindell17, key_gen) {
     std::cout << "key_share_2:\n" << key_share_2_json_str << std::endl;
 }
 
+TEST(lindell17, batch_key_gen) {
+    const size_t batch_size = 4;
+
+    // Paillier key generated ahead of time
+    PailKeyPool pool(1, 0);
+    pool.Fill();
+    EXPECT_EQ(pool.Size(), (size_t)1);
+    safeheron::pail::PailPrivKey pail_priv;
+    safeheron::pail::PailPubKey pail_pub;
+    pool.Take(pail_priv, pail_pub);
+    EXPECT_EQ(pool.Size(), (size_t)0);
+
+    P1BatchContext p1_context;
+    P2BatchContext p2_context;
+    bool ok = p1_context.CreateContext(safeheron::curve::CurveType::SECP256K1, batch_size, pail_priv, pail_pub);
+    EXPECT_TRUE(ok);
+    ok = p2_context.CreateContext(safeheron::curve::CurveType::SECP256K1, batch_size);
+    EXPECT_TRUE(ok);
+
+    std::string p1_message1, p2_message1, p1_message2, p2_message2, p1_message3, p2_message3, p1_message4;
+    ok = p1_context.Step1(p1_message1);
+    EXPECT_TRUE(ok);
+    ok = p2_context.Step1(p1_message1, p2_message1);
+    EXPECT_TRUE(ok);
+    ok = p1_context.Step2(p2_message1, p1_message2);
+    EXPECT_TRUE(ok);
+    ok = p2_context.Step2(p1_message2, p2_message2);
+    EXPECT_TRUE(ok);
+    ok = p1_context.Step3(p2_message2, p1_message3);
+    EXPECT_TRUE(ok);
+    ok = p2_context.Step3(p1_message3, p2_message3);
+    EXPECT_TRUE(ok);
+    ok = p1_context.Step4(p2_message3, p1_message4);
+    EXPECT_TRUE(ok);
+    ok = p2_context.Step4(p1_message4);
+    EXPECT_TRUE(ok);
+
+    std::vector<std::string> key_share_1_b64_arr;
+    std::vector<std::string> key_share_2_b64_arr;
+    ok = p1_context.export_key_shares(key_share_1_b64_arr);
+    EXPECT_TRUE(ok);
+    ok = p2_context.export_key_shares(key_share_2_b64_arr);
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(key_share_1_b64_arr.size(), batch_size);
+    EXPECT_EQ(key_share_2_b64_arr.size(), batch_size);
+
+    for (size_t i = 0; i < batch_size; ++i) {
+        P1KeyShare key_share_1;
+        ok = key_share_1.FromBase64(key_share_1_b64_arr[i]);
+        EXPECT_TRUE(ok);
+        P2KeyShare key_share_2;
+        ok = key_share_2.FromBase64(key_share_2_b64_arr[i]);
+        EXPECT_TRUE(ok);
+        EXPECT_TRUE(key_share_1.Q_ == key_share_2.Q_);
+        EXPECT_TRUE(key_share_1.pail_pub_.n() == pail_pub.n());
+    }
+}
+
 
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);